@@ -38,7 +38,10 @@ public class KantanDocGen : ModuleRules
 				"DeveloperSettings",
 				"AnimGraph",
 				"ToolMenus",
-				"Kismet"
+				"Kismet",
+				"Json",
+				"JsonUtilities",
+				"ImageCore"
 			}
 		);
 	}
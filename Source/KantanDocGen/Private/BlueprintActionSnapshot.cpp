@@ -0,0 +1,87 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "BlueprintActionSnapshot.h"
+#include "KantanDocGenLog.h"
+#include "NodeDocsGenerator.h"
+#include "BlueprintActionDatabase.h"
+#include "BlueprintNodeSpawner.h"
+#include "Engine/Blueprint.h"
+#include "Stats/StatsMisc.h"
+
+
+void FBlueprintActionSnapshot::GT_Build(TArray< UObject* > const& Objects)
+{
+	check(IsInGameThread());
+	SCOPE_SECONDS_COUNTER(BuildTime);
+
+	Spawners.Empty();
+	Slices.Empty(Objects.Num());
+	FilteredSpawners = 0;
+
+	for (UObject* Object : Objects)
+	{
+		if (Object && !Slices.Contains(Object))
+		{
+			AddObject(Object);
+		}
+	}
+
+	UE_LOG(LogKantanDocGen, Display, TEXT("Blueprint action snapshot: %i objects, %i documentable spawners (%i filtered out), took %.3fs."),
+		Slices.Num(), Spawners.Num(), FilteredSpawners, BuildTime);
+}
+
+FBlueprintActionSnapshot::FSlice FBlueprintActionSnapshot::GT_FindOrAddObject(UObject* Object)
+{
+	check(IsInGameThread());
+
+	if (auto Slice = Slices.Find(Object))
+	{
+		return *Slice;
+	}
+
+	return AddObject(Object);
+}
+
+FBlueprintActionSnapshot::FSlice FBlueprintActionSnapshot::AddObject(UObject* Object)
+{
+	FSlice Slice;
+	Slice.Start = Spawners.Num();
+
+	auto& BPActionMap = FBlueprintActionDatabase::Get().GetAllActions();
+	if (auto ActionList = BPActionMap.Find(Object))
+	{
+		const bool bIsBlueprint = Object->IsA< UBlueprint >();
+
+		TArray< TPair< FString, UBlueprintNodeSpawner* > > Documentable;
+		for (UBlueprintNodeSpawner* Spawner : *ActionList)
+		{
+			if (Spawner && FNodeDocsGenerator::IsSpawnerDocumentable(Spawner, bIsBlueprint))
+			{
+				Documentable.Emplace(Spawner->GetSpawnerSignature().ToString(), Spawner);
+			}
+			else
+			{
+				++FilteredSpawners;
+			}
+		}
+
+		// The database is in registration order, which can vary with load order and refreshes. Signatures don't.
+		Documentable.StableSort([](TPair< FString, UBlueprintNodeSpawner* > const& A, TPair< FString, UBlueprintNodeSpawner* > const& B)
+			{
+				return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+			});
+
+		for (auto const& Entry : Documentable)
+		{
+			Spawners.Add(Entry.Value);
+		}
+	}
+
+	Slice.Num = Spawners.Num() - Slice.Start;
+	Slices.Add(Object, Slice);
+	return Slice;
+}
@@ -0,0 +1,58 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+
+class UBlueprintNodeSpawner;
+
+/*
+One-time copy of the blueprint action database, restricted to the objects we are going to document.
+Spawners are filtered with FNodeDocsGenerator::IsSpawnerDocumentable while copying, and stored contiguously,
+so that each object maps to a slice of a single flat array. Each slice is in spawner signature order.
+*/
+class FBlueprintActionSnapshot
+{
+public:
+	struct FSlice
+	{
+		int32 Start = 0;
+		int32 Num = 0;
+	};
+
+public:
+	/** Callable only from game thread */
+	void GT_Build(TArray< UObject* > const& Objects);
+	// Objects not known at build time (eg. blueprints loaded during enumeration) are snapshotted on first request.
+	FSlice GT_FindOrAddObject(UObject* Object);
+	/**/
+
+	UBlueprintNodeSpawner* GetSpawner(int32 Index) const
+	{
+		return Spawners[Index].Get();
+	}
+
+	int32 NumObjects() const { return Slices.Num(); }
+	int32 NumSpawners() const { return Spawners.Num(); }
+	int32 NumFilteredSpawners() const { return FilteredSpawners; }
+
+protected:
+	FSlice AddObject(UObject* Object);
+
+protected:
+	TArray< TWeakObjectPtr< UBlueprintNodeSpawner > > Spawners;
+	TMap< FObjectKey, FSlice > Slices;
+	int32 FilteredSpawners = 0;
+
+public:
+	//
+	double BuildTime = 0.0;
+	//
+};
@@ -0,0 +1,227 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenCheckpoint.h"
+#include "DocGenSettings.h"
+#include "KantanDocGenLog.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+
+namespace DocGenCheckpoint
+{
+	static const uint32 CheckpointMagic = 0x4B444743;	// 'KDGC'
+	static const int32 CheckpointVersion = 4;
+}
+
+FArchive& operator<< (FArchive& Ar, FDocGenCheckpoint::FState& State)
+{
+	Ar << State.EnumeratorIndex << State.EnumeratorPosition << State.EnumeratorSize;
+	Ar << State.ProcessedPaths;
+
+	int32 NumClasses = State.Classes.Num();
+	Ar << NumClasses;
+	if (Ar.IsLoading())
+	{
+		if (NumClasses < 0)
+		{
+			Ar.SetError();
+			return Ar;
+		}
+
+		State.Classes.Reset(NumClasses);
+		for (int32 Idx = 0; Idx < NumClasses; ++Idx)
+		{
+			State.Classes.Add(MakeShared< FNodeDocsGenerator::FClassDocRecord >());
+		}
+	}
+
+	for (auto& Record : State.Classes)
+	{
+		Ar << *Record;
+	}
+
+	Ar << State.SpawnerCrashCounts;
+	return Ar;
+}
+
+FDocGenCheckpoint::FDocGenCheckpoint(FString const& InDocTitle, uint32 InSettingsHash) :
+	SettingsHash(InSettingsHash)
+{
+	const FString BaseFilename = FPaths::ProjectIntermediateDir() / TEXT("KantanDocGenCache") / InDocTitle;
+	CheckpointFilename = BaseFilename + TEXT(".checkpoint");
+	InFlightFilename = BaseFilename + TEXT(".inflight");
+}
+
+FDocGenCheckpoint::~FDocGenCheckpoint()
+{
+	InFlightWriter.Reset();
+}
+
+uint32 FDocGenCheckpoint::ComputeSettingsHash(FKantanDocGenSettings const& Settings, TArray< FName > const& Modules)
+{
+	FString Key = Settings.DocumentationTitle;
+
+	TArray< FName > SortedModules = Modules;
+	SortedModules.Sort(FNameLexicalLess());
+	for (FName const& Module : SortedModules)
+	{
+		Key += TEXT("|") + Module.ToString();
+	}
+
+	for (auto const& Path : Settings.ContentPaths)
+	{
+		Key += TEXT("|") + Path.Path;
+	}
+
+	for (FName const& Name : Settings.SpecificClasses)
+	{
+		Key += TEXT("|+") + Name.ToString();
+	}
+
+	for (FName const& Name : Settings.ExcludedClasses)
+	{
+		Key += TEXT("|-") + Name.ToString();
+	}
+
+	Key += TEXT("|") + GetPathNameSafe(Settings.BlueprintContextClass.Get());
+	Key += Settings.bUseTemplateNodes ? TEXT("|Template") : TEXT("|Invoke");
+	Key += Settings.bGenerateNodeImages ? TEXT("|Images") : TEXT("|NoImages");
+	Key += Settings.OutputFormat == EKantanDocGenOutputFormat::Json ? TEXT("|Json") : TEXT("|Html");
+
+	return FCrc::StrCrc32(*Key);
+}
+
+bool FDocGenCheckpoint::Load(FState& OutState) const
+{
+	TUniquePtr< FArchive > Reader(IFileManager::Get().CreateFileReader(*CheckpointFilename, FILEREAD_Silent));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	FNameAsStringProxyArchive Ar(*Reader);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	uint32 Hash = 0;
+	Ar << Magic << Version << Hash;
+	if (Magic != DocGenCheckpoint::CheckpointMagic || Version != DocGenCheckpoint::CheckpointVersion)
+	{
+		return false;
+	}
+
+	if (Hash != SettingsHash)
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Checkpoint '%s' was taken with different settings, ignoring it."), *CheckpointFilename);
+		return false;
+	}
+
+	FState State;
+	Ar << State;
+	if (Ar.IsError())
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Checkpoint '%s' is corrupt, ignoring it."), *CheckpointFilename);
+		return false;
+	}
+
+	OutState = MoveTemp(State);
+	return true;
+}
+
+bool FDocGenCheckpoint::Save(FState& State)
+{
+	SCOPE_SECONDS_COUNTER(SaveTime);
+
+	// Written alongside then moved into place, so a crash mid-save leaves the previous checkpoint intact
+	const FString TempFilename = CheckpointFilename + TEXT(".tmp");
+	{
+		TUniquePtr< FArchive > Writer(IFileManager::Get().CreateFileWriter(*TempFilename, FILEWRITE_EvenIfReadOnly));
+		if (!Writer)
+		{
+			return false;
+		}
+
+		FNameAsStringProxyArchive Ar(*Writer);
+
+		uint32 Magic = DocGenCheckpoint::CheckpointMagic;
+		int32 Version = DocGenCheckpoint::CheckpointVersion;
+		Ar << Magic << Version << SettingsHash;
+		Ar << State;
+
+		if (!Writer->Close())
+		{
+			return false;
+		}
+	}
+
+	if (!IFileManager::Get().Move(*CheckpointFilename, *TempFilename, true, true))
+	{
+		return false;
+	}
+
+	++NumSaves;
+	return true;
+}
+
+void FDocGenCheckpoint::Discard()
+{
+	InFlightWriter.Reset();
+
+	IFileManager::Get().Delete(*CheckpointFilename, false, true, true);
+	IFileManager::Get().Delete(*InFlightFilename, false, true, true);
+}
+
+bool FDocGenCheckpoint::GetCrashedSpawner(FGuid& OutSignature) const
+{
+	TUniquePtr< FArchive > Reader(IFileManager::Get().CreateFileReader(*InFlightFilename, FILEREAD_Silent));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	FGuid Signature;
+	*Reader << Signature;
+	if (Reader->IsError() || !Signature.IsValid())
+	{
+		return false;
+	}
+
+	OutSignature = Signature;
+	return true;
+}
+
+void FDocGenCheckpoint::BeginSpawner(FGuid const& Signature)
+{
+	WriteInFlight(Signature);
+}
+
+void FDocGenCheckpoint::EndSpawner()
+{
+	WriteInFlight(FGuid());
+}
+
+void FDocGenCheckpoint::WriteInFlight(FGuid const& Signature)
+{
+	if (!InFlightWriter)
+	{
+		InFlightWriter.Reset(IFileManager::Get().CreateFileWriter(*InFlightFilename, FILEWRITE_EvenIfReadOnly));
+		if (!InFlightWriter)
+		{
+			return;
+		}
+	}
+
+	// Flushed to the OS immediately, which is all that's needed to survive the editor going down
+	FGuid Value = Signature;
+	InFlightWriter->Seek(0);
+	*InFlightWriter << Value;
+	InFlightWriter->Flush();
+}
+
@@ -0,0 +1,81 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NodeDocsGenerator.h"
+
+
+struct FKantanDocGenSettings;
+
+/*
+Progress of a generation run, persisted so that a run which crashed or was cancelled can carry on where it left off.
+Saved only between objects, so a checkpoint never contains a partially documented object.
+Also keeps track of the spawner currently being documented, so that one which takes the editor down can be skipped
+when resuming rather than crashing every attempt.
+*/
+class FDocGenCheckpoint
+{
+public:
+	// A spawner which was in flight for this many crashes is skipped from then on
+	static const int32 MaxSpawnerCrashes = 2;
+
+	struct FState
+	{
+		// Index of the enumerator in progress (all before it are finished) and how far through it we got.
+		// The size is kept to detect the enumerator's object list having changed since, in which case we can't seek.
+		int32 EnumeratorIndex = 0;
+		int32 EnumeratorPosition = 0;
+		int32 EnumeratorSize = 0;
+		// Objects fully documented, for when we can't seek
+		TArray< FString > ProcessedPaths;
+		TArray< TSharedPtr< FNodeDocsGenerator::FClassDocRecord > > Classes;
+		// Spawner signature -> number of crashes it was in flight for
+		TMap< FGuid, int32 > SpawnerCrashCounts;
+
+		friend FArchive& operator<< (FArchive& Ar, FState& State);
+	};
+
+public:
+	FDocGenCheckpoint(FString const& InDocTitle, uint32 InSettingsHash);
+	~FDocGenCheckpoint();
+
+	// Hash of everything affecting which objects are enumerated and what's generated for them.
+	// A checkpoint taken with different settings isn't resumed from.
+	static uint32 ComputeSettingsHash(FKantanDocGenSettings const& Settings, TArray< FName > const& Modules);
+
+	bool Load(FState& OutState) const;
+	bool Save(FState& State);
+	// Deletes the checkpoint and in flight marker
+	void Discard();
+
+	/*
+	The in flight marker. Set before a spawner is spawned and rendered, cleared once its node is released. If we go down
+	in between the marker is left behind, and the next resume knows which spawner to blame.
+	Must be read before the first spawner is begun, which overwrites it.
+	*/
+	bool GetCrashedSpawner(FGuid& OutSignature) const;
+	void BeginSpawner(FGuid const& Signature);
+	void EndSpawner();
+
+protected:
+	void WriteInFlight(FGuid const& Signature);
+
+protected:
+	FString CheckpointFilename;
+	FString InFlightFilename;
+	uint32 SettingsHash;
+	// Kept open for the run, so marking a spawner is just a small overwrite rather than creating a file per node
+	TUniquePtr< FArchive > InFlightWriter;
+
+public:
+	//
+	double SaveTime = 0.0;
+	int32 NumSaves = 0;
+	//
+};
+
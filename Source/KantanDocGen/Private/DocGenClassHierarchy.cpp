@@ -0,0 +1,45 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenClassHierarchy.h"
+#include "DocGenNameCache.h"
+#include "NodeDocsGenerator.h"
+#include "UObject/Class.h"
+
+
+int32 FDocGenClassHierarchy::GT_FindOrAdd(UClass* Class, FDocGenNameCache& NameCache)
+{
+	check(IsInGameThread());
+
+	if (const int32* Existing = IndexMap.Find(Class))
+	{
+		return *Existing;
+	}
+
+	// Ancestors and interfaces first, since adding them may reallocate the entries
+	const int32 ParentIndex = Class->GetSuperClass() ? GT_FindOrAdd(Class->GetSuperClass(), NameCache) : INDEX_NONE;
+
+	TArray< int32 > Interfaces;
+	for (const FImplementedInterface& Interface : Class->Interfaces)
+	{
+		if (ensureAlways(Interface.Class))
+		{
+			Interfaces.Add(GT_FindOrAdd(Interface.Class, NameCache));
+		}
+	}
+
+	FEntry Entry;
+	Entry.Id = FNodeDocsGenerator::GetClassDocId(Class);
+	Entry.DisplayName = NameCache.GetClassDisplayName(Class);
+	Entry.ParentIndex = ParentIndex;
+	Entry.Depth = ParentIndex != INDEX_NONE ? Entries[ParentIndex].Depth + 1 : 0;
+	Entry.Interfaces = MoveTemp(Interfaces);
+
+	const int32 Index = Entries.Add(MoveTemp(Entry));
+	IndexMap.Add(Class, Index);
+	return Index;
+}
+
@@ -0,0 +1,64 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+
+class UClass;
+class FDocGenNameCache;
+
+/*
+Flat table of every class seen during the run along with all of its ancestors and interfaces, each added exactly
+once. Shared ancestors (AActor, UObject...) are therefore resolved once rather than once per documented class,
+and once built the table involves no UObject access, so class docs can be emitted from it on any thread.
+*/
+class FDocGenClassHierarchy
+{
+public:
+	struct FEntry
+	{
+		FString Id;
+		FString DisplayName;
+		int32 ParentIndex = INDEX_NONE;
+		// Number of ancestors
+		int32 Depth = 0;
+		bool bDocumented = false;
+		TArray< int32 > Interfaces;
+	};
+
+public:
+	/** Callable only from game thread */
+	int32 GT_FindOrAdd(UClass* Class, FDocGenNameCache& NameCache);
+	/**/
+
+	void SetDocumented(int32 Index) { Entries[Index].bDocumented = true; }
+
+	FEntry const& Get(int32 Index) const { return Entries[Index]; }
+	int32 Num() const { return Entries.Num(); }
+
+	// Ancestors of the class, root first. Linear in the depth of the class.
+	template < typename TAllocator >
+	void GetAncestors(int32 Index, TArray< int32, TAllocator >& OutAncestors) const
+	{
+		FEntry const& Entry = Entries[Index];
+		OutAncestors.SetNumUninitialized(Entry.Depth);
+
+		int32 Ancestor = Entry.ParentIndex;
+		for (int32 Idx = Entry.Depth - 1; Idx >= 0; --Idx)
+		{
+			OutAncestors[Idx] = Ancestor;
+			Ancestor = Entries[Ancestor].ParentIndex;
+		}
+	}
+
+protected:
+	TArray< FEntry > Entries;
+	TMap< FObjectKey, int32 > IndexMap;
+};
+
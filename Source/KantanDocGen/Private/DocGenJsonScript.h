@@ -0,0 +1,39 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DocGenTrace.h"
+#include "Misc/FileHelper.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+
+/*
+Data loaded by the pages (search index, index fragments, function lists and the json viewer's data) is written as
+scripts which hand their json to a function of the page, rather than as json files. Pages opened from disk can't
+fetch, but they can load scripts, so the docs work the same whether opened locally or hosted.
+*/
+typedef TJsonWriter< TCHAR, TCondensedJsonPrintPolicy< TCHAR > > FDocGenJsonWriter;
+typedef TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy< TCHAR > > FDocGenJsonWriterFactory;
+
+// Saves Function(Json), or Function("Key",Json) if a key is given, as utf8. Returns the size written, or -1 on failure.
+inline int64 SaveJsonScript(FString const& Path, const TCHAR* Function, FString const& Json, FString const& Key = FString())
+{
+	const FString Script = Key.IsEmpty()
+		? FString::Printf(TEXT("%s(%s);\n"), Function, *Json)
+		: FString::Printf(TEXT("%s(\"%s\",%s);\n"), Function, *Key, *Json);
+
+	FTCHARToUTF8 Utf8(*Script);
+	if (!FFileHelper::SaveArrayToFile(TArrayView< const uint8 >((const uint8*)Utf8.Get(), Utf8.Length()), *Path))
+	{
+		return -1;
+	}
+
+	DOCGEN_TRACE_FILE_WRITTEN(Path);
+	return Utf8.Length();
+}
@@ -0,0 +1,67 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenNameCache.h"
+#include "KantanDocGenLog.h"
+#include "EdGraphSchema_K2.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+
+FDocGenNameCache::FPinTypeKey::FPinTypeKey(FEdGraphPinType const& PinType) :
+	PinCategory(PinType.PinCategory)
+	, PinSubCategory(PinType.PinSubCategory)
+	, PinSubCategoryObject(PinType.PinSubCategoryObject.Get())
+	, TerminalCategory(PinType.PinValueType.TerminalCategory)
+	, TerminalSubCategory(PinType.PinValueType.TerminalSubCategory)
+	, TerminalSubCategoryObject(PinType.PinValueType.TerminalSubCategoryObject.Get())
+	, ContainerType(PinType.ContainerType)
+	, bIsReference(PinType.bIsReference)
+{}
+
+bool FDocGenNameCache::FPinTypeKey::operator== (FPinTypeKey const& Other) const
+{
+	return PinCategory == Other.PinCategory
+		&& PinSubCategory == Other.PinSubCategory
+		&& PinSubCategoryObject == Other.PinSubCategoryObject
+		&& TerminalCategory == Other.TerminalCategory
+		&& TerminalSubCategory == Other.TerminalSubCategory
+		&& TerminalSubCategoryObject == Other.TerminalSubCategoryObject
+		&& ContainerType == Other.ContainerType
+		&& bIsReference == Other.bIsReference;
+}
+
+FString FDocGenNameCache::GetClassDisplayName(UClass* Class)
+{
+	return ClassDisplayNames.FindOrAdd(FObjectKey(Class), [Class]
+		{
+			return FBlueprintEditorUtils::GetFriendlyClassDisplayName(Class).ToString();
+		});
+}
+
+FString FDocGenNameCache::GetPinTypeText(FEdGraphPinType const& PinType)
+{
+	// @NOTE: Delegate type text depends on the signature member reference, which isn't part of the key.
+	if (PinType.PinCategory == UEdGraphSchema_K2::PC_Delegate || PinType.PinCategory == UEdGraphSchema_K2::PC_MCDelegate)
+	{
+		return UEdGraphSchema_K2::TypeToText(PinType).ToString();
+	}
+
+	return PinTypeTexts.FindOrAdd(FPinTypeKey(PinType), [&PinType]
+		{
+			return UEdGraphSchema_K2::TypeToText(PinType).ToString();
+		});
+}
+
+void FDocGenNameCache::LogStats() const
+{
+	auto const ClassStats = GetClassDisplayNameStats();
+	auto const PinTypeStats = GetPinTypeTextStats();
+
+	UE_LOG(LogKantanDocGen, Display, TEXT("Name cache: class display names %i hits / %i misses (%.0f%%), pin type text %i hits / %i misses (%.0f%%)."),
+		ClassStats.Hits, ClassStats.Misses, ClassStats.HitRate() * 100.0f,
+		PinTypeStats.Hits, PinTypeStats.Misses, PinTypeStats.HitRate() * 100.0f);
+}
+
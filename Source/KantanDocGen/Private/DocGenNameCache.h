@@ -0,0 +1,114 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/ScopeRWLock.h"
+#include "EdGraph/EdGraphPin.h"
+
+
+class UClass;
+
+/*
+Run-scoped memoization of the text lookups which repeat across classes and nodes: friendly class display names
+(every superclass of every documented class) and pin type text (every pin of every node, and every property).
+Lookups may come from any thread. Readers share a lock, misses are computed outside of it then added.
+*/
+class FDocGenNameCache
+{
+public:
+	struct FTableStats
+	{
+		int32 Hits = 0;
+		int32 Misses = 0;
+
+		float HitRate() const { return Hits + Misses > 0 ? (float)Hits / (Hits + Misses) : 0.0f; }
+	};
+
+public:
+	FString GetClassDisplayName(UClass* Class);
+	FString GetPinTypeText(FEdGraphPinType const& PinType);
+
+	FTableStats GetClassDisplayNameStats() const { return ClassDisplayNames.GetStats(); }
+	FTableStats GetPinTypeTextStats() const { return PinTypeTexts.GetStats(); }
+
+	void LogStats() const;
+
+protected:
+	// The parts of FEdGraphPinType which TypeToText depends on
+	struct FPinTypeKey
+	{
+		FName PinCategory;
+		FName PinSubCategory;
+		FObjectKey PinSubCategoryObject;
+		FName TerminalCategory;
+		FName TerminalSubCategory;
+		FObjectKey TerminalSubCategoryObject;
+		EPinContainerType ContainerType;
+		bool bIsReference;
+
+		explicit FPinTypeKey(FEdGraphPinType const& PinType);
+
+		bool operator== (FPinTypeKey const& Other) const;
+
+		friend uint32 GetTypeHash(FPinTypeKey const& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.PinCategory), GetTypeHash(Key.PinSubCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Key.PinSubCategoryObject));
+			Hash = HashCombine(Hash, GetTypeHash(Key.TerminalCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Key.TerminalSubCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Key.TerminalSubCategoryObject));
+			return HashCombine(Hash, (uint32)Key.ContainerType | ((uint32)Key.bIsReference << 8));
+		}
+	};
+
+	template < typename TKey >
+	class TTable
+	{
+	public:
+		template < typename TCompute >
+		FString FindOrAdd(TKey const& Key, TCompute&& Compute)
+		{
+			{
+				FReadScopeLock ReadLock(Lock);
+				if (const FString* Found = Entries.Find(Key))
+				{
+					Hits.Increment();
+					return *Found;
+				}
+			}
+
+			Misses.Increment();
+			FString Value = Compute();
+
+			FWriteScopeLock WriteLock(Lock);
+			// Another thread may have got there first, in which case the values are the same anyway
+			return Entries.FindOrAdd(Key, MoveTemp(Value));
+		}
+
+		FTableStats GetStats() const
+		{
+			FTableStats Stats;
+			Stats.Hits = Hits.GetValue();
+			Stats.Misses = Misses.GetValue();
+			return Stats;
+		}
+
+	protected:
+		mutable FRWLock Lock;
+		TMap< TKey, FString > Entries;
+		FThreadSafeCounter Hits;
+		FThreadSafeCounter Misses;
+	};
+
+protected:
+	TTable< FObjectKey > ClassDisplayNames;
+	TTable< FPinTypeKey > PinTypeTexts;
+};
+
@@ -0,0 +1,556 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenOutputOptimizer.h"
+#include "DocGenPublisher.h"
+#include "KantanDocGenLog.h"
+#include "DocGenTrace.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+
+namespace DocGenOutputOptimizer
+{
+	static const int32 AssetManifestVersion = 1;
+
+	static bool IsTextAsset(FString const& Extension)
+	{
+		static const TCHAR* const TextExtensions[] = { TEXT("html"), TEXT("htm"), TEXT("css"), TEXT("js"), TEXT("json"), TEXT("xml"), TEXT("svg"), TEXT("txt") };
+		for (const TCHAR* TextExtension : TextExtensions)
+		{
+			if (Extension == TextExtension)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static bool MatchesAt(FString const& Text, int32 Index, const TCHAR* Match)
+	{
+		const int32 MatchLen = FCString::Strlen(Match);
+		return Index + MatchLen <= Text.Len() && FCString::Strnicmp(*Text + Index, Match, MatchLen) == 0;
+	}
+
+	// Copies a quoted string verbatim, returning the index after its closing quote. Html attribute values have no
+	// escapes, so a trailing backslash doesn't hide the quote there.
+	static int32 CopyQuoted(FString const& Text, int32 Index, FString& Out, bool bEscapes = true)
+	{
+		const TCHAR Quote = Text[Index];
+		int32 End = Index + 1;
+		while (End < Text.Len() && Text[End] != Quote)
+		{
+			End += bEscapes && Text[End] == TEXT('\\') ? 2 : 1;
+		}
+		End = FMath::Min(End + 1, Text.Len());
+		Out.AppendChars(*Text + Index, End - Index);
+		return End;
+	}
+
+	// Copies a js regex literal verbatim, returning the index after its closing slash. Flags are left to the caller.
+	static int32 CopyRegex(FString const& Text, int32 Index, FString& Out)
+	{
+		bool bInClass = false;
+		int32 End = Index + 1;
+		while (End < Text.Len() && Text[End] != TEXT('\n'))
+		{
+			const TCHAR Char = Text[End];
+			if (Char == TEXT('\\'))
+			{
+				End += 2;
+				continue;
+			}
+
+			if (Char == TEXT('/') && !bInClass)
+			{
+				break;
+			}
+
+			bInClass = Char == TEXT('[') ? true : Char == TEXT(']') ? false : bInClass;
+			++End;
+		}
+		End = FMath::Min(End + 1, Text.Len());
+		Out.AppendChars(*Text + Index, End - Index);
+		return End;
+	}
+
+	// Whether a '/' following what's been output so far starts a regex literal rather than being a division
+	static bool IsRegexStart(FString const& Out)
+	{
+		static const TCHAR* const Keywords[] = { TEXT("return"), TEXT("typeof"), TEXT("case"), TEXT("do"), TEXT("else"), TEXT("in"),
+			TEXT("of"), TEXT("void"), TEXT("delete"), TEXT("new"), TEXT("throw"), TEXT("yield"), TEXT("await") };
+
+		int32 Last = Out.Len() - 1;
+		while (Last >= 0 && FChar::IsWhitespace(Out[Last]))
+		{
+			--Last;
+		}
+
+		if (Last < 0)
+		{
+			return true;
+		}
+
+		const TCHAR Prev = Out[Last];
+		if (FCString::Strchr(TEXT("(,=:[!&|?{};+-*%<>~^"), Prev) != nullptr)
+		{
+			return true;
+		}
+
+		if (!FChar::IsIdentifier(Prev))
+		{
+			return false;
+		}
+
+		int32 WordStart = Last;
+		while (WordStart > 0 && FChar::IsIdentifier(Out[WordStart - 1]))
+		{
+			--WordStart;
+		}
+
+		const FString Word = Out.Mid(WordStart, Last + 1 - WordStart);
+		for (const TCHAR* Keyword : Keywords)
+		{
+			if (Word == Keyword)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+const TCHAR* const FDocGenOutputOptimizer::AssetManifestFilename = TEXT("asset_manifest.json");
+
+FDocGenOutputOptimizer::FDocGenOutputOptimizer(FString const& InDocsDir, bool bInMinify, bool bInPrecompress) :
+	DocsDir(FPaths::ConvertRelativePathToFull(InDocsDir))
+	, bMinify(bInMinify)
+	, bPrecompress(bInPrecompress)
+{}
+
+bool FDocGenOutputOptimizer::Optimize()
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_OptimizeOutput);
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray< FString > Files;
+	IFileManager::Get().FindFilesRecursive(Files, *DocsDir, TEXT("*"), true, false);
+	Files.Sort();
+
+	TArray< FFileResult > Results;
+	Results.SetNum(Files.Num());
+	ParallelFor(Files.Num(), [&](int32 Index)
+		{
+			Results[Index] = ProcessFile(Files[Index]);
+		});
+
+	// Lists every file, not only the text ones, so anything can be cache busted by its hash
+	FKantanDocGenManifest Manifest;
+	Manifest.Version = DocGenOutputOptimizer::AssetManifestVersion;
+
+	const FString Prefix = DocsDir / TEXT("");
+	for (int32 Index = 0; Index < Files.Num(); ++Index)
+	{
+		FFileResult const& Result = Results[Index];
+		if (!Result.bSucceeded)
+		{
+			UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to optimize '%s'."), *Files[Index]);
+			++NumFailed;
+			continue;
+		}
+
+		if (Result.MinifiedFrom > 0)
+		{
+			++NumMinified;
+			MinifiedBytesBefore += Result.MinifiedFrom;
+			MinifiedBytesAfter += Result.Size;
+		}
+
+		if (Result.CompressedSize > 0)
+		{
+			++NumCompressed;
+			CompressedBytes += Result.CompressedSize;
+		}
+
+		FKantanDocGenManifestFile& Entry = Manifest.Files.AddDefaulted_GetRef();
+		Entry.Path = Files[Index].RightChop(Prefix.Len());
+		Entry.Hash = Result.Hash;
+		Entry.Size = Result.Size;
+	}
+	NumFiles = Files.Num();
+
+	if (!Manifest.SaveToFile(DocsDir / AssetManifestFilename))
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to save the asset manifest."));
+		++NumFailed;
+	}
+
+	OptimizeTime = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogKantanDocGen, Log, TEXT("Optimized %i files in %.2fs: %i minified (%lld -> %lld bytes), %i precompressed (%lld bytes)."),
+		NumFiles, OptimizeTime, NumMinified, MinifiedBytesBefore, MinifiedBytesAfter, NumCompressed, CompressedBytes);
+
+	return NumFailed == 0;
+}
+
+FDocGenOutputOptimizer::FFileResult FDocGenOutputOptimizer::ProcessFile(FString const& Filename) const
+{
+	FFileResult Result;
+
+	TArray< uint8 > Content;
+	if (!FFileHelper::LoadFileToArray(Content, *Filename))
+	{
+		return Result;
+	}
+
+	const FString Extension = FPaths::GetExtension(Filename).ToLower();
+	if (bMinify && (Extension == TEXT("html") || Extension == TEXT("htm") || Extension == TEXT("css") || Extension == TEXT("js")))
+	{
+		FString Text;
+		FFileHelper::BufferToString(Text, Content.GetData(), Content.Num());
+
+		const FString Minified = Extension == TEXT("css") ? MinifyCss(Text) : Extension == TEXT("js") ? MinifyJs(Text) : MinifyHtml(Text);
+
+		// Always written as utf-8, which also shrinks the utf-16 stylesheet
+		FTCHARToUTF8 Utf8(*Minified);
+		if (Utf8.Length() < Content.Num())
+		{
+			Result.MinifiedFrom = Content.Num();
+			Content = TArray< uint8 >((const uint8*)Utf8.Get(), Utf8.Length());
+			if (!FFileHelper::SaveArrayToFile(Content, *Filename))
+			{
+				return Result;
+			}
+		}
+	}
+
+	FMD5 Md5;
+	Md5.Update(Content.GetData(), Content.Num());
+	FMD5Hash Hash;
+	Hash.Set(Md5);
+	Result.Hash = LexToString(Hash);
+	Result.Size = Content.Num();
+
+	if (bPrecompress && DocGenOutputOptimizer::IsTextAsset(Extension))
+	{
+		Result.CompressedSize = Precompress(Filename, Content);
+		if (Result.CompressedSize < 0)
+		{
+			return Result;
+		}
+	}
+
+	Result.bSucceeded = true;
+	return Result;
+}
+
+int64 FDocGenOutputOptimizer::Precompress(FString const& Filename, TArray< uint8 > const& Content)
+{
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Content.Num());
+	TArray< uint8 > Compressed;
+	Compressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Content.GetData(), Content.Num(), COMPRESS_BiasSize))
+	{
+		return -1;
+	}
+
+	// Servers fall back to the original when there's no .gz
+	if (CompressedSize >= Content.Num())
+	{
+		return 0;
+	}
+
+	Compressed.SetNum(CompressedSize);
+	const FString CompressedFilename = Filename + TEXT(".gz");
+	if (!FFileHelper::SaveArrayToFile(Compressed, *CompressedFilename))
+	{
+		return -1;
+	}
+
+	DOCGEN_TRACE_FILE_WRITTEN(CompressedFilename);
+	return CompressedSize;
+}
+
+FString FDocGenOutputOptimizer::MinifyHtml(FString const& Html)
+{
+	using namespace DocGenOutputOptimizer;
+
+	// Elements whose content is copied as is
+	static const TCHAR* const RawElements[] = { TEXT("pre"), TEXT("textarea"), TEXT("script"), TEXT("style") };
+
+	FString Out;
+	Out.Reserve(Html.Len());
+
+	bool bInTag = false;
+	int32 Index = 0;
+	while (Index < Html.Len())
+	{
+		const TCHAR Char = Html[Index];
+		if (bInTag && (Char == TEXT('"') || Char == TEXT('\'')))
+		{
+			Index = CopyQuoted(Html, Index, Out, false);
+			continue;
+		}
+
+		if (Char == TEXT('<'))
+		{
+			// Comments are dropped, other than conditional ones
+			if (MatchesAt(Html, Index, TEXT("<!--")) && !MatchesAt(Html, Index, TEXT("<!--[")))
+			{
+				const int32 End = Html.Find(TEXT("-->"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 4);
+				Index = End == INDEX_NONE ? Html.Len() : End + 3;
+				continue;
+			}
+
+			bool bCopiedRaw = false;
+			for (const TCHAR* Element : RawElements)
+			{
+				const int32 NameEnd = Index + 1 + FCString::Strlen(Element);
+				if (MatchesAt(Html, Index + 1, Element) && NameEnd < Html.Len() && (Html[NameEnd] == TEXT('>') || FChar::IsWhitespace(Html[NameEnd])))
+				{
+					const FString Closing = FString(TEXT("</")) + Element;
+					int32 End = Html.Find(Closing, ESearchCase::IgnoreCase, ESearchDir::FromStart, NameEnd);
+					End = End == INDEX_NONE ? Html.Len() : End + Closing.Len();
+					Out.AppendChars(*Html + Index, End - Index);
+					Index = End;
+					bCopiedRaw = true;
+					break;
+				}
+			}
+
+			if (bCopiedRaw)
+			{
+				continue;
+			}
+
+			// Quotes are only attribute values inside a tag, elsewhere they're text
+			bInTag = true;
+		}
+		else if (Char == TEXT('>'))
+		{
+			bInTag = false;
+		}
+
+		// Whitespace runs render as a single space, kept as a line break where there was one
+		if (FChar::IsWhitespace(Char))
+		{
+			bool bLineBreak = false;
+			while (Index < Html.Len() && FChar::IsWhitespace(Html[Index]))
+			{
+				bLineBreak |= Html[Index] == TEXT('\n');
+				++Index;
+			}
+
+			if (Out.Len() > 0)
+			{
+				Out.AppendChar(bLineBreak ? TEXT('\n') : TEXT(' '));
+			}
+			continue;
+		}
+
+		Out.AppendChar(Char);
+		++Index;
+	}
+
+	return Out;
+}
+
+FString FDocGenOutputOptimizer::MinifyCss(FString const& Css)
+{
+	using namespace DocGenOutputOptimizer;
+
+	// No space is needed next to these. Not ':', which is significant before a pseudo class.
+	auto IsSeparator = [](TCHAR Char)
+		{
+			return Char == TEXT('{') || Char == TEXT('}') || Char == TEXT(';') || Char == TEXT(',') || Char == TEXT('>');
+		};
+
+	FString Out;
+	Out.Reserve(Css.Len());
+
+	bool bPendingSpace = false;
+	int32 Index = 0;
+	while (Index < Css.Len())
+	{
+		const TCHAR Char = Css[Index];
+		if (Char == TEXT('/') && Index + 1 < Css.Len() && Css[Index + 1] == TEXT('*'))
+		{
+			const int32 End = Css.Find(TEXT("*/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 2);
+			Index = End == INDEX_NONE ? Css.Len() : End + 2;
+			bPendingSpace = true;
+			continue;
+		}
+
+		if (FChar::IsWhitespace(Char))
+		{
+			bPendingSpace = true;
+			++Index;
+			continue;
+		}
+
+		if (bPendingSpace)
+		{
+			if (Out.Len() > 0 && !IsSeparator(Out[Out.Len() - 1]) && Out[Out.Len() - 1] != TEXT(':') && !IsSeparator(Char))
+			{
+				Out.AppendChar(TEXT(' '));
+			}
+			bPendingSpace = false;
+		}
+
+		if (Char == TEXT('"') || Char == TEXT('\''))
+		{
+			Index = CopyQuoted(Css, Index, Out);
+			continue;
+		}
+
+		// The last declaration of a block doesn't need its semicolon
+		if (Char == TEXT('}') && Out.Len() > 0 && Out[Out.Len() - 1] == TEXT(';'))
+		{
+			Out.LeftChopInline(1, EAllowShrinking::No);
+		}
+
+		Out.AppendChar(Char);
+		++Index;
+	}
+
+	return Out;
+}
+
+FString FDocGenOutputOptimizer::MinifyJs(FString const& Js)
+{
+	using namespace DocGenOutputOptimizer;
+
+	// @NOTE: Only indentation, repeated whitespace, blank lines and comments are removed. Line breaks are kept, so
+	// automatic semicolon insertion and anything else line sensitive behaves exactly as before. Strings, regexes and
+	// template literals are copied as is, so comment-like text inside them survives.
+	FString Out;
+	Out.Reserve(Js.Len());
+
+	// Template literals being scanned, innermost last. Each counts the braces open in its current ${} expression,
+	// or is INDEX_NONE while in the literal's text.
+	TArray< int32 > Templates;
+
+	bool bLineStart = true;
+	auto EndLine = [&]()
+		{
+			while (Out.Len() > 0 && (Out[Out.Len() - 1] == TEXT(' ') || Out[Out.Len() - 1] == TEXT('\t')))
+			{
+				Out.LeftChopInline(1, EAllowShrinking::No);
+			}
+
+			if (!bLineStart)
+			{
+				Out.AppendChar(TEXT('\n'));
+			}
+			bLineStart = true;
+		};
+
+	int32 Index = 0;
+	while (Index < Js.Len())
+	{
+		const TCHAR Char = Js[Index];
+		const TCHAR Next = Index + 1 < Js.Len() ? Js[Index + 1] : TEXT('\0');
+
+		if (Templates.Num() > 0 && Templates.Last() == INDEX_NONE)
+		{
+			// Template text, line breaks and indentation included, is part of the string
+			const int32 Len = Char == TEXT('\\') ? FMath::Min(2, Js.Len() - Index) : Char == TEXT('$') && Next == TEXT('{') ? 2 : 1;
+			if (Char == TEXT('`'))
+			{
+				Templates.Pop(EAllowShrinking::No);
+			}
+			else if (Len == 2 && Char == TEXT('$'))
+			{
+				Templates.Last() = 0;
+			}
+			Out.AppendChars(*Js + Index, Len);
+			Index += Len;
+			continue;
+		}
+
+		if (Char == TEXT('\n') || Char == TEXT('\r'))
+		{
+			EndLine();
+			++Index;
+			continue;
+		}
+
+		// Outside strings, a whitespace run means no more than a single space
+		const bool bAfterSpace = Out.Len() > 0 && (Out[Out.Len() - 1] == TEXT(' ') || Out[Out.Len() - 1] == TEXT('\t'));
+		if (FChar::IsWhitespace(Char) && (bLineStart || bAfterSpace))
+		{
+			++Index;
+			continue;
+		}
+
+		if (Char == TEXT('/') && Next == TEXT('/'))
+		{
+			const int32 End = Js.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 2);
+			Index = End == INDEX_NONE ? Js.Len() : End;
+			continue;
+		}
+
+		if (Char == TEXT('/') && Next == TEXT('*'))
+		{
+			// Stands in for a line break if it spanned one, otherwise for a space
+			const int32 End = Js.Find(TEXT("*/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 2);
+			const int32 CommentEnd = End == INDEX_NONE ? Js.Len() : End + 2;
+			bool bSpannedLines = false;
+			for (int32 Idx = Index; Idx < CommentEnd && !bSpannedLines; ++Idx)
+			{
+				bSpannedLines = Js[Idx] == TEXT('\n');
+			}
+			Index = CommentEnd;
+
+			if (bSpannedLines)
+			{
+				EndLine();
+			}
+			else if (!bLineStart && !bAfterSpace)
+			{
+				Out.AppendChar(TEXT(' '));
+			}
+			continue;
+		}
+
+		bLineStart = false;
+		if (Char == TEXT('"') || Char == TEXT('\''))
+		{
+			Index = CopyQuoted(Js, Index, Out);
+			continue;
+		}
+
+		if (Char == TEXT('/') && IsRegexStart(Out))
+		{
+			Index = CopyRegex(Js, Index, Out);
+			continue;
+		}
+
+		if (Char == TEXT('`'))
+		{
+			Templates.Add(INDEX_NONE);
+		}
+		else if (Char == TEXT('{') && Templates.Num() > 0)
+		{
+			++Templates.Last();
+		}
+		else if (Char == TEXT('}') && Templates.Num() > 0)
+		{
+			// Closing the ${} expression goes back into the literal's text
+			Templates.Last() = Templates.Last() == 0 ? INDEX_NONE : Templates.Last() - 1;
+		}
+
+		Out.AppendChar(Char);
+		++Index;
+	}
+
+	EndLine();
+	return Out;
+}
@@ -0,0 +1,65 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/*
+Optional post processing of converted docs for static hosting, run on the staged docs before they're swapped in.
+Html, css and js are minified in place, conservatively (whitespace and comments only, so nothing renders differently).
+Every text file gets a gzip compressed copy alongside it, and a manifest of content hashes is written to the docs root,
+so a static server can serve the precompressed files and cache everything for as long as its hash is unchanged.
+All files are processed in parallel.
+*/
+class FDocGenOutputOptimizer
+{
+public:
+	FDocGenOutputOptimizer(FString const& InDocsDir, bool bInMinify, bool bInPrecompress);
+
+	// True if every file was processed
+	bool Optimize();
+
+	static const TCHAR* const AssetManifestFilename;
+
+	static FString MinifyHtml(FString const& Html);
+	static FString MinifyCss(FString const& Css);
+	static FString MinifyJs(FString const& Js);
+
+protected:
+	struct FFileResult
+	{
+		bool bSucceeded = false;
+		// Of the final content
+		FString Hash;
+		int64 Size = 0;
+		int64 MinifiedFrom = 0;
+		int64 CompressedSize = 0;
+	};
+
+	FFileResult ProcessFile(FString const& Filename) const;
+	// Returns the size of the .gz written, 0 if compressing didn't make it any smaller, or -1 on failure
+	static int64 Precompress(FString const& Filename, TArray< uint8 > const& Content);
+
+protected:
+	FString DocsDir;
+	bool bMinify;
+	bool bPrecompress;
+
+public:
+	//
+	double OptimizeTime = 0.0;
+	int32 NumFiles = 0;
+	int32 NumFailed = 0;
+	int32 NumMinified = 0;
+	int64 MinifiedBytesBefore = 0;
+	int64 MinifiedBytesAfter = 0;
+	int32 NumCompressed = 0;
+	int64 CompressedBytes = 0;
+	//
+};
+
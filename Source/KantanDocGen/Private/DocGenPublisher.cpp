@@ -0,0 +1,253 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenPublisher.h"
+#include "KantanDocGenLog.h"
+#include "DocGenTrace.h"
+#include "DocGenSettings.h"
+#include "JsonObjectConverter.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+
+const TCHAR* const FDocGenPublisher::ManifestFilename = TEXT("kantandocgen_manifest.json");
+const int32 FDocGenPublisher::ManifestVersion = 1;
+
+bool FKantanDocGenManifest::SaveToFile(FString const& Filename) const
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(*this, Json))
+	{
+		return false;
+	}
+
+	// Written alongside and moved over, so a partial manifest is never left in place
+	const FString TempFilename = Filename + TEXT(".tmp");
+	return FFileHelper::SaveStringToFile(Json, *TempFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+		&& IFileManager::Get().Move(*Filename, *TempFilename, true, true);
+}
+
+bool FKantanDocGenManifest::LoadFromFile(FString const& Filename, FKantanDocGenManifest& OutManifest)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Filename))
+	{
+		return false;
+	}
+
+	return FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutManifest) && OutManifest.Version == FDocGenPublisher::ManifestVersion;
+}
+
+FDocGenPublisher::FDocGenPublisher(FString const& InSourceDir, FString const& InTargetDir, FString const& InSourceCacheFilename) :
+	SourceDir(FPaths::ConvertRelativePathToFull(InSourceDir))
+	, TargetDir(FPaths::ConvertRelativePathToFull(InTargetDir))
+	, SourceCacheFilename(InSourceCacheFilename)
+{}
+
+FDocGenPublisher::FDocGenPublisher(FKantanDocGenSettings const& Settings) :
+	FDocGenPublisher(
+		Settings.OutputDirectory.Path / Settings.DocumentationTitle,
+		Settings.PublishPath / Settings.DocumentationTitle,
+		GetSourceCacheFilename(Settings.DocumentationTitle))
+{}
+
+FString FDocGenPublisher::GetSourceCacheFilename(FString const& DocTitle)
+{
+	return FPaths::ProjectIntermediateDir() / TEXT("KantanDocGenCache") / (DocTitle + TEXT(".manifest.json"));
+}
+
+void FDocGenPublisher::BuildManifest(FString const& Directory, FKantanDocGenManifest const* Previous, FKantanDocGenManifest& OutManifest)
+{
+	TArray< FString > Files;
+	IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*"), true, false);
+
+	const FString Prefix = Directory / TEXT("");
+	Files.RemoveAll([&Prefix](FString const& File)
+		{
+			return File.RightChop(Prefix.Len()) == ManifestFilename;
+		});
+	Files.Sort();
+
+	TMap< FString, FKantanDocGenManifestFile const* > PreviousFiles;
+	if (Previous)
+	{
+		for (FKantanDocGenManifestFile const& File : Previous->Files)
+		{
+			PreviousFiles.Add(File.Path, &File);
+		}
+	}
+
+	OutManifest = FKantanDocGenManifest();
+	OutManifest.Version = FDocGenPublisher::ManifestVersion;
+	OutManifest.Files.SetNum(Files.Num());
+
+	ParallelFor(Files.Num(), [&](int32 Index)
+		{
+			FKantanDocGenManifestFile& Entry = OutManifest.Files[Index];
+			Entry.Path = Files[Index].RightChop(Prefix.Len());
+
+			const FFileStatData StatData = IFileManager::Get().GetStatData(*Files[Index]);
+			Entry.Size = StatData.FileSize;
+			Entry.ModifiedTicks = StatData.ModificationTime.GetTicks();
+
+			FKantanDocGenManifestFile const* const* PreviousEntry = PreviousFiles.Find(Entry.Path);
+			if (PreviousEntry && (*PreviousEntry)->Size == Entry.Size && (*PreviousEntry)->ModifiedTicks == Entry.ModifiedTicks)
+			{
+				Entry.Hash = (*PreviousEntry)->Hash;
+			}
+			else
+			{
+				Entry.Hash = LexToString(FMD5Hash::HashFile(*Files[Index]));
+			}
+		});
+}
+
+bool FDocGenPublisher::Publish()
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_Publish);
+	const double StartTime = FPlatformTime::Seconds();
+
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.DirectoryExists(*SourceDir))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Nothing to publish, '%s' doesn't exist."), *SourceDir);
+		return false;
+	}
+
+	if (!FileManager.MakeDirectory(*TargetDir, true))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to create publish directory '%s'."), *TargetDir);
+		return false;
+	}
+
+	FKantanDocGenManifest CachedSource;
+	const bool bHaveCachedSource = FKantanDocGenManifest::LoadFromFile(SourceCacheFilename, CachedSource);
+
+	FKantanDocGenManifest Source;
+	BuildManifest(SourceDir, bHaveCachedSource ? &CachedSource : nullptr, Source);
+
+	// Without a manifest, the mirror has to be read to find out what's already there
+	const FString TargetManifestFilename = TargetDir / ManifestFilename;
+	FKantanDocGenManifest Target;
+	if (!FKantanDocGenManifest::LoadFromFile(TargetManifestFilename, Target))
+	{
+		UE_LOG(LogKantanDocGen, Display, TEXT("No manifest in '%s', hashing its contents."), *TargetDir);
+		BuildManifest(TargetDir, nullptr, Target);
+	}
+
+	TMap< FString, FKantanDocGenManifestFile const* > TargetFiles;
+	for (FKantanDocGenManifestFile const& File : Target.Files)
+	{
+		TargetFiles.Add(File.Path, &File);
+	}
+
+	TArray< FKantanDocGenManifestFile const* > ToCopy;
+	for (FKantanDocGenManifestFile const& File : Source.Files)
+	{
+		FKantanDocGenManifestFile const* const* Existing = TargetFiles.Find(File.Path);
+		if (Existing && (*Existing)->Size == File.Size && (*Existing)->Hash == File.Hash)
+		{
+			++NumUnchanged;
+		}
+		else
+		{
+			ToCopy.Add(&File);
+		}
+		TargetFiles.Remove(File.Path);
+	}
+
+	// Whatever's left is no longer part of the docs
+	TArray< FKantanDocGenManifestFile const* > ToDelete;
+	TargetFiles.GenerateValueArray(ToDelete);
+
+	FThreadSafeCounter CopyFailures;
+	FThreadSafeCounter64 CopiedBytes;
+	TArray< bool > Copied;
+	Copied.SetNumZeroed(ToCopy.Num());
+	ParallelFor(ToCopy.Num(), [&](int32 Index)
+		{
+			// Copied alongside and moved over, so the mirror is never left with a partially written file
+			FKantanDocGenManifestFile const& File = *ToCopy[Index];
+			const FString TargetFile = TargetDir / File.Path;
+			const FString TempFile = TargetFile + TEXT(".tmp");
+			IFileManager& FileManager = IFileManager::Get();
+			if (FileManager.Copy(*TempFile, *(SourceDir / File.Path), true, true) == COPY_OK
+				&& FileManager.Move(*TargetFile, *TempFile, true, true))
+			{
+				Copied[Index] = true;
+				CopiedBytes.Add(File.Size);
+			}
+			else
+			{
+				FileManager.Delete(*TempFile, false, true, true);
+				CopyFailures.Increment();
+			}
+		});
+
+	FThreadSafeCounter DeleteFailures;
+	TArray< bool > Deleted;
+	Deleted.SetNumZeroed(ToDelete.Num());
+	ParallelFor(ToDelete.Num(), [&](int32 Index)
+		{
+			if (IFileManager::Get().Delete(*(TargetDir / ToDelete[Index]->Path), false, true, true))
+			{
+				Deleted[Index] = true;
+			}
+			else
+			{
+				DeleteFailures.Increment();
+			}
+		});
+
+	// @NOTE: Files which failed to copy are left out of the mirror's manifest, and those which failed to delete are
+	// kept in it, so both are retried next time.
+	FKantanDocGenManifest Published = Source;
+	for (int32 Index = ToCopy.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Copied[Index])
+		{
+			Published.Files.RemoveAll([&](FKantanDocGenManifestFile const& File) { return File.Path == ToCopy[Index]->Path; });
+		}
+	}
+
+	for (int32 Index = 0; Index < ToDelete.Num(); ++Index)
+	{
+		if (!Deleted[Index])
+		{
+			Published.Files.Add(*ToDelete[Index]);
+		}
+	}
+
+	NumCopied = ToCopy.Num() - CopyFailures.GetValue();
+	NumDeleted = ToDelete.Num() - DeleteFailures.GetValue();
+	NumFailed = CopyFailures.GetValue() + DeleteFailures.GetValue();
+	BytesCopied = CopiedBytes.GetValue();
+
+	bool bSucceeded = NumFailed == 0;
+	if (!Published.SaveToFile(TargetManifestFilename))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to write publish manifest '%s'."), *TargetManifestFilename);
+		bSucceeded = false;
+	}
+
+	if (!Source.SaveToFile(SourceCacheFilename))
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to write source manifest cache '%s'."), *SourceCacheFilename);
+	}
+
+	PublishTime = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogKantanDocGen, Display, TEXT("Published to '%s': %i files copied (%.1fMB), %i deleted, %i unchanged, %i failed, took %.3fs."),
+		*TargetDir, NumCopied, BytesCopied / (1024.0 * 1024.0), NumDeleted, NumUnchanged, NumFailed, PublishTime);
+
+	return bSucceeded;
+}
+
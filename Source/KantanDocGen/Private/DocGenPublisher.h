@@ -0,0 +1,93 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "DocGenPublisher.generated.h"
+
+
+struct FKantanDocGenSettings;
+
+
+USTRUCT()
+struct FKantanDocGenManifestFile
+{
+	GENERATED_BODY()
+
+	// Relative to the manifest's directory
+	UPROPERTY()
+	FString Path;
+
+	UPROPERTY()
+	FString Hash;
+
+	UPROPERTY()
+	int64 Size = 0;
+
+	// Only meaningful for the source manifest, where it lets unchanged files skip rehashing
+	UPROPERTY()
+	int64 ModifiedTicks = 0;
+};
+
+USTRUCT()
+struct FKantanDocGenManifest
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	int32 Version = 0;
+
+	UPROPERTY()
+	TArray< FKantanDocGenManifestFile > Files;
+
+public:
+	bool SaveToFile(FString const& Filename) const;
+	static bool LoadFromFile(FString const& Filename, FKantanDocGenManifest& OutManifest);
+};
+
+/*
+Publishes a docset to a mirror directory (local or network mounted), copying only what changed.
+Both sides are described by a manifest of file hashes and sizes. The mirror's is stored alongside it, so the
+mirror itself is only read when it has no manifest yet. The source's is cached between runs, and only files whose
+size or timestamp changed are rehashed. New and changed files are copied, and removed ones deleted, in parallel.
+*/
+class FDocGenPublisher
+{
+public:
+	FDocGenPublisher(FString const& InSourceDir, FString const& InTargetDir, FString const& InSourceCacheFilename);
+	// Generated docs of the settings to <PublishPath>/<Title>
+	explicit FDocGenPublisher(FKantanDocGenSettings const& Settings);
+
+	// True if the mirror now matches the source
+	bool Publish();
+
+	// Hashes every file in the directory, reusing entries of the previous manifest whose size and timestamp match
+	static void BuildManifest(FString const& Directory, FKantanDocGenManifest const* Previous, FKantanDocGenManifest& OutManifest);
+	// Cached manifest of the generated docs, shared with the staged output
+	static FString GetSourceCacheFilename(FString const& DocTitle);
+
+	static const TCHAR* const ManifestFilename;
+	static const int32 ManifestVersion;
+
+protected:
+	FString SourceDir;
+	FString TargetDir;
+	FString SourceCacheFilename;
+
+public:
+	//
+	double PublishTime = 0.0;
+	int32 NumCopied = 0;
+	int32 NumDeleted = 0;
+	int32 NumUnchanged = 0;
+	int32 NumFailed = 0;
+	int64 BytesCopied = 0;
+	//
+};
+
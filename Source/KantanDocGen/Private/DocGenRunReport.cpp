@@ -0,0 +1,120 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenRunReport.h"
+#include "KantanDocGenLog.h"
+#include "JsonObjectConverter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+
+bool FKantanDocGenRunReport::SaveToFile(FString const& Filename) const
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(*this, Json))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveStringToFile(Json, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+bool FKantanDocGenRunReport::LoadFromFile(FString const& Filename, FKantanDocGenRunReport& OutReport)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Filename))
+	{
+		return false;
+	}
+
+	return FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutReport);
+}
+
+void FKantanDocGenRunReport::CompareToBaseline(FString const& BaselineFilename, float MaxSlowdownPercent, float MaxNodeLossPercent)
+{
+	Baseline = FKantanDocGenReportBaseline();
+	Baseline.Path = BaselineFilename;
+
+	FKantanDocGenRunReport BaselineReport;
+	if (!LoadFromFile(BaselineFilename, BaselineReport))
+	{
+		Baseline.Violations.Add(FString::Printf(TEXT("Failed to load baseline report '%s'."), *BaselineFilename));
+		Baseline.bPassed = false;
+		return;
+	}
+
+	// Percentage change relative to the baseline, positive meaning an increase
+	auto PercentChange = [](double Value, double BaselineValue)
+		{
+			return BaselineValue > 0.0 ? (Value - BaselineValue) * 100.0 / BaselineValue : 0.0;
+		};
+
+	if (!bSucceeded && BaselineReport.bSucceeded)
+	{
+		Baseline.Violations.Add(TEXT("Run failed, baseline succeeded."));
+	}
+
+	const double Slowdown = PercentChange(Times.Total, BaselineReport.Times.Total);
+	if (Slowdown > MaxSlowdownPercent)
+	{
+		Baseline.Violations.Add(FString::Printf(TEXT("Total time %.1fs is %.1f%% slower than baseline %.1fs (limit %.1f%%)."),
+			Times.Total, Slowdown, BaselineReport.Times.Total, MaxSlowdownPercent));
+	}
+
+	const double NodeLoss = -PercentChange(Counts.Nodes, BaselineReport.Counts.Nodes);
+	if (NodeLoss > MaxNodeLossPercent)
+	{
+		Baseline.Violations.Add(FString::Printf(TEXT("%i nodes is %.1f%% fewer than baseline %i (limit %.1f%%)."),
+			Counts.Nodes, NodeLoss, BaselineReport.Counts.Nodes, MaxNodeLossPercent));
+	}
+
+	const double ClassLoss = -PercentChange(Counts.Classes, BaselineReport.Counts.Classes);
+	if (ClassLoss > MaxNodeLossPercent)
+	{
+		Baseline.Violations.Add(FString::Printf(TEXT("%i classes is %.1f%% fewer than baseline %i (limit %.1f%%)."),
+			Counts.Classes, ClassLoss, BaselineReport.Counts.Classes, MaxNodeLossPercent));
+	}
+
+	// @NOTE: Reports from before the output format was recorded are all html
+	const FString BaselineFormat = BaselineReport.Format.IsEmpty() ? FString(TEXT("Html")) : BaselineReport.Format;
+	Baseline.Comparison = FString::Printf(TEXT("%s: %.1f MB in %i files, %.1fs. Baseline %s: %.1f MB in %i files, %.1fs."),
+		*Format, OutputBytes / (1024.0 * 1024.0), OutputFiles, Times.Total,
+		*BaselineFormat, BaselineReport.OutputBytes / (1024.0 * 1024.0), BaselineReport.OutputFiles, BaselineReport.Times.Total);
+	UE_LOG(LogKantanDocGen, Display, TEXT("%s"), *Baseline.Comparison);
+
+	Baseline.bPassed = Baseline.Violations.Num() == 0;
+}
+
+int64 FKantanDocGenRunReport::GetDirectorySize(FString const& Directory)
+{
+	int64 TotalSize = 0;
+	IFileManager::Get().IterateDirectoryStatRecursively(*Directory, [&TotalSize](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			if (!StatData.bIsDirectory)
+			{
+				TotalSize += StatData.FileSize;
+			}
+			return true;
+		});
+
+	return TotalSize;
+}
+
+int32 FKantanDocGenRunReport::GetDirectoryFileCount(FString const& Directory)
+{
+	int32 NumFiles = 0;
+	IFileManager::Get().IterateDirectoryStatRecursively(*Directory, [&NumFiles](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			if (!StatData.bIsDirectory)
+			{
+				++NumFiles;
+			}
+			return true;
+		});
+
+	return NumFiles;
+}
+
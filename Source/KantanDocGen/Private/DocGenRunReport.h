@@ -0,0 +1,318 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "DocGenRunReport.generated.h"
+
+
+// Wall time of each phase of a run, in seconds
+USTRUCT()
+struct FKantanDocGenReportTimes
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	double Prepass = 0.0;
+
+	UPROPERTY()
+	double Enumerate = 0.0;
+
+	UPROPERTY()
+	double Finalize = 0.0;
+
+	UPROPERTY()
+	double Convert = 0.0;
+
+	UPROPERTY()
+	double Total = 0.0;
+};
+
+USTRUCT()
+struct FKantanDocGenReportCounts
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Objects = 0;
+
+	// Including any carried over from a checkpoint
+	UPROPERTY()
+	int32 Nodes = 0;
+
+	UPROPERTY()
+	int32 ResumedNodes = 0;
+
+	UPROPERTY()
+	int32 TemplateNodes = 0;
+
+	UPROPERTY()
+	int32 InvokedNodes = 0;
+
+	UPROPERTY()
+	int32 Classes = 0;
+
+	UPROPERTY()
+	int32 Images = 0;
+};
+
+USTRUCT()
+struct FKantanDocGenReportCaches
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ClassNameHits = 0;
+
+	UPROPERTY()
+	int32 ClassNameMisses = 0;
+
+	UPROPERTY()
+	int32 PinTypeHits = 0;
+
+	UPROPERTY()
+	int32 PinTypeMisses = 0;
+
+	UPROPERTY()
+	int32 SourceIndexScannedModules = 0;
+
+	UPROPERTY()
+	int32 SourceIndexCachedModules = 0;
+};
+
+USTRUCT()
+struct FKantanDocGenReportBaseline
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Path;
+
+	UPROPERTY()
+	bool bPassed = true;
+
+	UPROPERTY()
+	TArray< FString > Violations;
+
+	// Output size, file count and total time against the baseline's, which may be of the other output format
+	UPROPERTY()
+	FString Comparison;
+};
+
+// Weight of the index page, which only lists plugins and modules, and of the module fragments it loads as they're expanded
+USTRUCT()
+struct FKantanDocGenReportIndex
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int64 PageBytes = 0;
+
+	UPROPERTY()
+	int32 Fragments = 0;
+
+	UPROPERTY()
+	int64 FragmentBytes = 0;
+
+	UPROPERTY()
+	int64 LargestFragmentBytes = 0;
+};
+
+// One of the classes with the most nodes. Pages over the inline limit list their functions from a separate script.
+USTRUCT()
+struct FKantanDocGenReportClassPage
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Id;
+
+	UPROPERTY()
+	int32 Nodes = 0;
+
+	UPROPERTY()
+	int64 PageBytes = 0;
+
+	UPROPERTY()
+	int64 FunctionListBytes = 0;
+};
+
+// Minification and precompression of the converted docs, if enabled
+USTRUCT()
+struct FKantanDocGenReportOptimize
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bMinified = false;
+
+	UPROPERTY()
+	bool bPrecompressed = false;
+
+	UPROPERTY()
+	int32 Files = 0;
+
+	UPROPERTY()
+	int32 MinifiedFiles = 0;
+
+	UPROPERTY()
+	int64 MinifiedBytesBefore = 0;
+
+	UPROPERTY()
+	int64 MinifiedBytesAfter = 0;
+
+	UPROPERTY()
+	int32 CompressedFiles = 0;
+
+	// Total size of the .gz files
+	UPROPERTY()
+	int64 CompressedBytes = 0;
+
+	UPROPERTY()
+	double Seconds = 0.0;
+};
+
+// Size of the client side search index. Query time mostly depends on the largest shard.
+USTRUCT()
+struct FKantanDocGenReportSearch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Entries = 0;
+
+	UPROPERTY()
+	int32 Tokens = 0;
+
+	UPROPERTY()
+	int32 Shards = 0;
+
+	UPROPERTY()
+	int64 Bytes = 0;
+
+	UPROPERTY()
+	int64 LargestShardBytes = 0;
+};
+
+USTRUCT()
+struct FKantanDocGenReportPublish
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Path;
+
+	UPROPERTY()
+	int32 FilesCopied = 0;
+
+	UPROPERTY()
+	int32 FilesDeleted = 0;
+
+	UPROPERTY()
+	int32 FilesUnchanged = 0;
+
+	UPROPERTY()
+	int64 BytesCopied = 0;
+
+	UPROPERTY()
+	double Seconds = 0.0;
+};
+
+/*
+Machine readable summary of a generation run, written as json after every run. Given a previous report as a baseline,
+regressions beyond the configured thresholds are recorded and fail the command line run.
+*/
+USTRUCT()
+struct FKantanDocGenRunReport
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FString Title;
+
+	UPROPERTY()
+	FString EngineVersion;
+
+	UPROPERTY()
+	FString Timestamp;
+
+	UPROPERTY()
+	bool bSucceeded = false;
+
+	UPROPERTY()
+	bool bResumed = false;
+
+	// Html or Json
+	UPROPERTY()
+	FString Format;
+
+	UPROPERTY()
+	FKantanDocGenReportTimes Times;
+
+	UPROPERTY()
+	FKantanDocGenReportCounts Counts;
+
+	// Reason -> number of failures
+	UPROPERTY()
+	TMap< FString, int32 > Failures;
+
+	UPROPERTY()
+	double PeakMemoryMB = 0.0;
+
+	UPROPERTY()
+	int64 IntermediateBytes = 0;
+
+	UPROPERTY()
+	int64 OutputBytes = 0;
+
+	UPROPERTY()
+	int32 OutputFiles = 0;
+
+	UPROPERTY()
+	FKantanDocGenReportCaches Caches;
+
+	UPROPERTY()
+	FKantanDocGenReportIndex Index;
+
+	// Largest first
+	UPROPERTY()
+	TArray< FKantanDocGenReportClassPage > LargestClassPages;
+
+	UPROPERTY()
+	FKantanDocGenReportSearch Search;
+
+	UPROPERTY()
+	FKantanDocGenReportOptimize Optimize;
+
+	// Empty unless the run was published
+	UPROPERTY()
+	FKantanDocGenReportPublish Publish;
+
+	UPROPERTY()
+	FKantanDocGenReportBaseline Baseline;
+
+public:
+	void AddFailures(FString const& Reason, int32 Count)
+	{
+		if (Count > 0)
+		{
+			Failures.FindOrAdd(Reason) += Count;
+		}
+	}
+
+	bool SaveToFile(FString const& Filename) const;
+	static bool LoadFromFile(FString const& Filename, FKantanDocGenRunReport& OutReport);
+
+	// Fills in the baseline section. Thresholds are percentages.
+	void CompareToBaseline(FString const& BaselineFilename, float MaxSlowdownPercent, float MaxNodeLossPercent);
+
+	static int64 GetDirectorySize(FString const& Directory);
+	static int32 GetDirectoryFileCount(FString const& Directory);
+};
+
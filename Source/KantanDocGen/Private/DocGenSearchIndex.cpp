@@ -0,0 +1,308 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenSearchIndex.h"
+#include "KantanDocGenLog.h"
+#include "DocGenTrace.h"
+#include "DocGenJsonScript.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/Paths.h"
+
+
+namespace DocGenSearchIndex
+{
+	static const int32 IndexVersion = 1;
+	// Longer tokens are truncated, which still leaves them prefix searchable
+	static const int32 MaxTokenLength = 32;
+	// Identifiers with more camel case words than this have the rest kept together as the last word
+	static const int32 MaxWordParts = 8;
+
+	static void AddToken(FString Token, TArray< FString >& OutTokens)
+	{
+		if (Token.Len() < 2)
+		{
+			return;
+		}
+
+		Token.LeftInline(MaxTokenLength, EAllowShrinking::No);
+		OutTokens.Add(MoveTemp(Token));
+	}
+
+	// The whole word, each of its camel case words, and every suffix of them
+	static void AddWordTokens(FString const& Word, TArray< FString >& OutTokens)
+	{
+		TArray< int32, TInlineAllocator< MaxWordParts > > PartStarts;
+		PartStarts.Add(0);
+		for (int32 Index = 1; Index < Word.Len() && PartStarts.Num() < MaxWordParts; ++Index)
+		{
+			const TCHAR Prev = Word[Index - 1];
+			const TCHAR Cur = Word[Index];
+			const bool bLowerToUpper = FChar::IsLower(Prev) && FChar::IsUpper(Cur);
+			// Last capital of an acronym starts the next word, as in HTTPRequest
+			const bool bAcronymEnd = FChar::IsUpper(Prev) && FChar::IsUpper(Cur) && Index + 1 < Word.Len() && FChar::IsLower(Word[Index + 1]);
+			if (bLowerToUpper || bAcronymEnd)
+			{
+				PartStarts.Add(Index);
+			}
+		}
+
+		const FString Lower = Word.ToLower();
+		for (int32 Part = 0; Part < PartStarts.Num(); ++Part)
+		{
+			AddToken(Lower.Mid(PartStarts[Part]), OutTokens);
+			if (Part + 1 < PartStarts.Num())
+			{
+				AddToken(Lower.Mid(PartStarts[Part], PartStarts[Part + 1] - PartStarts[Part]), OutTokens);
+			}
+		}
+	}
+}
+
+const TCHAR* const FDocGenSearchIndex::DirectoryName = TEXT("search");
+
+int32 FDocGenSearchIndex::AddEntry(EEntryKind Kind, FString const& Title, FString const& Url, FString const& Context)
+{
+	return Entries.Add(FEntry{ Kind, Title, Url, Context });
+}
+
+void FDocGenSearchIndex::AddText(int32 EntryIndex, FString const& Text, int32 Weight)
+{
+	check(Entries.IsValidIndex(EntryIndex));
+
+	TArray< FString > TextTokens;
+	Tokenize(Text, TextTokens);
+
+	TSet< FString > Seen;
+	for (FString& Token : TextTokens)
+	{
+		bool bAlreadySeen = false;
+		Seen.Add(Token, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		int32 TokenId = INDEX_NONE;
+		if (int32 const* Existing = TokenIds.Find(Token))
+		{
+			TokenId = *Existing;
+		}
+		else
+		{
+			TokenId = Tokens.Add(Token);
+			Postings.AddDefaulted();
+			TokenIds.Add(MoveTemp(Token), TokenId);
+		}
+
+		TArray< FPosting >& TokenPostings = Postings[TokenId];
+		if (TokenPostings.Num() > 0 && TokenPostings.Last().Entry == EntryIndex)
+		{
+			TokenPostings.Last().Weight += Weight;
+		}
+		else
+		{
+			check(TokenPostings.Num() == 0 || TokenPostings.Last().Entry < EntryIndex);
+			TokenPostings.Add(FPosting{ EntryIndex, Weight });
+		}
+	}
+}
+
+bool FDocGenSearchIndex::Save(FString const& Directory)
+{
+	using namespace DocGenSearchIndex;
+
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.DeleteDirectory(*Directory, false, true);
+	if (!FileManager.MakeDirectory(*Directory, true))
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to create search index directory '%s'."), *Directory);
+		return false;
+	}
+
+	// Each shard's tokens are sorted, so the client can binary search for the first one with a given prefix
+	TMap< FString, TArray< int32 > > ShardTokens;
+	for (int32 TokenId = 0; TokenId < Tokens.Num(); ++TokenId)
+	{
+		ShardTokens.FindOrAdd(GetShardKey(Tokens[TokenId])).Add(TokenId);
+	}
+	ShardTokens.KeySort([](FString const& A, FString const& B)
+		{
+			return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+		});
+
+	TArray< FString > ShardKeys;
+	ShardTokens.GenerateKeyArray(ShardKeys);
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(Entries.Num(), EntriesPerChunk);
+	TArray< int64 > FileSizes;
+	FileSizes.SetNumZeroed(ShardKeys.Num() + NumChunks);
+
+	FThreadSafeCounter NumFailed;
+	ParallelFor(FileSizes.Num(), [&](int32 Index)
+		{
+			FString Json;
+			TSharedRef< FDocGenJsonWriter > Writer = FDocGenJsonWriterFactory::Create(&Json);
+			const TCHAR* Function = nullptr;
+			FString Key;
+			FString Filename;
+
+			if (Index < ShardKeys.Num())
+			{
+				// {"t":[tokens],"p":[[entry delta, weight, entry delta, weight, ...] per token]}
+				TArray< int32 >& ShardTokenIds = ShardTokens[ShardKeys[Index]];
+				ShardTokenIds.Sort([this](int32 A, int32 B)
+					{
+						return Tokens[A].Compare(Tokens[B], ESearchCase::CaseSensitive) < 0;
+					});
+
+				Writer->WriteObjectStart();
+				Writer->WriteArrayStart(TEXT("t"));
+				for (int32 TokenId : ShardTokenIds)
+				{
+					Writer->WriteValue(Tokens[TokenId]);
+				}
+				Writer->WriteArrayEnd();
+				Writer->WriteArrayStart(TEXT("p"));
+				for (int32 TokenId : ShardTokenIds)
+				{
+					Writer->WriteArrayStart();
+					int32 PrevEntry = 0;
+					for (FPosting const& Posting : Postings[TokenId])
+					{
+						Writer->WriteValue(Posting.Entry - PrevEntry);
+						Writer->WriteValue(Posting.Weight);
+						PrevEntry = Posting.Entry;
+					}
+					Writer->WriteArrayEnd();
+				}
+				Writer->WriteArrayEnd();
+				Writer->WriteObjectEnd();
+				Writer->Close();
+
+				Function = TEXT("KantanDocGenSearch.addShard");
+				Key = ShardKeys[Index];
+				Filename = FString::Printf(TEXT("s_%s.js"), *Key);
+			}
+			else
+			{
+				// [[kind, title, url, context], ...]
+				const int32 Chunk = Index - ShardKeys.Num();
+				const int32 First = Chunk * EntriesPerChunk;
+				const int32 Last = FMath::Min(First + EntriesPerChunk, Entries.Num());
+
+				Writer->WriteArrayStart();
+				for (int32 EntryIndex = First; EntryIndex < Last; ++EntryIndex)
+				{
+					FEntry const& Entry = Entries[EntryIndex];
+					Writer->WriteArrayStart();
+					Writer->WriteValue((int32)Entry.Kind);
+					Writer->WriteValue(Entry.Title);
+					Writer->WriteValue(Entry.Url);
+					Writer->WriteValue(Entry.Context);
+					Writer->WriteArrayEnd();
+				}
+				Writer->WriteArrayEnd();
+				Writer->Close();
+
+				// @NOTE: The chunk number is passed as a string, it's only used as a property name
+				Function = TEXT("KantanDocGenSearch.addEntries");
+				Key = LexToString(Chunk);
+				Filename = FString::Printf(TEXT("e_%i.js"), Chunk);
+			}
+
+			DOCGEN_TRACE_SCOPE(KantanDocGen_SaveSearchIndex);
+			FileSizes[Index] = SaveJsonScript(Directory / Filename, Function, Json, Key);
+			if (FileSizes[Index] < 0)
+			{
+				FileSizes[Index] = 0;
+				NumFailed.Increment();
+			}
+		});
+
+	// Written last, search.js loads it first and only asks for shards it lists
+	FString MetaJson;
+	{
+		TSharedRef< FDocGenJsonWriter > Writer = FDocGenJsonWriterFactory::Create(&MetaJson);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("version"), IndexVersion);
+		Writer->WriteValue(TEXT("chunkSize"), EntriesPerChunk);
+		Writer->WriteValue(TEXT("numEntries"), Entries.Num());
+		Writer->WriteValue(TEXT("shards"), ShardKeys);
+		Writer->WriteObjectEnd();
+		Writer->Close();
+	}
+
+	int64 MetaSize = SaveJsonScript(Directory / TEXT("meta.js"), TEXT("KantanDocGenSearch.setMeta"), MetaJson);
+	if (MetaSize < 0)
+	{
+		MetaSize = 0;
+		NumFailed.Increment();
+	}
+
+	Stats = FStats();
+	Stats.NumEntries = Entries.Num();
+	Stats.NumTokens = Tokens.Num();
+	Stats.NumShards = ShardKeys.Num();
+	Stats.TotalBytes = MetaSize;
+	for (int32 Index = 0; Index < FileSizes.Num(); ++Index)
+	{
+		Stats.TotalBytes += FileSizes[Index];
+		if (Index < ShardKeys.Num())
+		{
+			Stats.LargestShardBytes = FMath::Max(Stats.LargestShardBytes, FileSizes[Index]);
+		}
+	}
+
+	if (NumFailed.GetValue() > 0)
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to save %i search index files."), NumFailed.GetValue());
+		return false;
+	}
+
+	UE_LOG(LogKantanDocGen, Log, TEXT("Search index: %i entries, %i tokens in %i shards, %.1f KB (largest shard %.1f KB)."),
+		Stats.NumEntries, Stats.NumTokens, Stats.NumShards, Stats.TotalBytes / 1024.0, Stats.LargestShardBytes / 1024.0);
+	return true;
+}
+
+void FDocGenSearchIndex::Tokenize(FString const& Text, TArray< FString >& OutTokens)
+{
+	const int32 Len = Text.Len();
+	int32 Index = 0;
+	while (Index < Len)
+	{
+		while (Index < Len && !FChar::IsAlnum(Text[Index]))
+		{
+			++Index;
+		}
+
+		const int32 Start = Index;
+		while (Index < Len && FChar::IsAlnum(Text[Index]))
+		{
+			++Index;
+		}
+
+		if (Index > Start)
+		{
+			DocGenSearchIndex::AddWordTokens(Text.Mid(Start, Index - Start), OutTokens);
+		}
+	}
+}
+
+FString FDocGenSearchIndex::GetShardKey(FString const& Token)
+{
+	// Anything outside [a-z0-9] shares the '_' shards, keeping file names portable
+	FString Key;
+	for (int32 Index = 0; Index < 2 && Index < Token.Len(); ++Index)
+	{
+		const TCHAR Char = Token[Index];
+		const bool bPortable = (Char >= TEXT('a') && Char <= TEXT('z')) || (Char >= TEXT('0') && Char <= TEXT('9'));
+		Key.AppendChar(bPortable ? Char : TEXT('_'));
+	}
+	return Key;
+}
+
@@ -0,0 +1,85 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/*
+Inverted index over the docs, precomputed at finalize and searched client side by css/search.js.
+Text is split into lower case tokens (identifiers also into their camel case words, and every suffix of those, so
+'location' and 'actorloc' both find GetActorLocation). Token postings are sharded by the first two characters of the
+token, so a query only loads the shards for what was typed, and the entries themselves are written in fixed size chunks.
+Everything is written as scripts which hand their data to search.js, since pages opened from disk can't fetch json.
+*/
+class FDocGenSearchIndex
+{
+public:
+	enum class EEntryKind : uint8
+	{
+		Class,
+		Struct,
+		Enum,
+		Node,
+	};
+
+	// Relative weights of the fields an entry's text comes from
+	static const int32 TitleWeight = 8;
+	static const int32 CategoryWeight = 3;
+	static const int32 PinWeight = 2;
+	static const int32 DescriptionWeight = 1;
+
+	static const int32 EntriesPerChunk = 512;
+	static const TCHAR* const DirectoryName;
+
+	struct FStats
+	{
+		int32 NumEntries = 0;
+		int32 NumTokens = 0;
+		int32 NumShards = 0;
+		int64 TotalBytes = 0;
+		int64 LargestShardBytes = 0;
+	};
+
+public:
+	// Url is relative to the docset root. Returns the entry's index, to add its text with.
+	int32 AddEntry(EEntryKind Kind, FString const& Title, FString const& Url, FString const& Context);
+	// Repeated tokens only count once per call, but add up across calls. Text must be added in entry order.
+	void AddText(int32 EntryIndex, FString const& Text, int32 Weight);
+
+	// Writes the meta, shard and entry scripts into Directory, which is emptied first. Identical input gives identical files.
+	bool Save(FString const& Directory);
+	FStats const& GetStats() const { return Stats; }
+
+	// Must match tokenize() and shardKey() in search.js
+	static void Tokenize(FString const& Text, TArray< FString >& OutTokens);
+	static FString GetShardKey(FString const& Token);
+
+protected:
+	struct FEntry
+	{
+		EEntryKind Kind;
+		FString Title;
+		FString Url;
+		FString Context;
+	};
+
+	struct FPosting
+	{
+		int32 Entry;
+		int32 Weight;
+	};
+
+	TArray< FEntry > Entries;
+	TMap< FString, int32 > TokenIds;
+	// Per token id, in entry order since entries are added (and their text with them) in order
+	TArray< FString > Tokens;
+	TArray< TArray< FPosting > > Postings;
+
+	FStats Stats;
+};
+
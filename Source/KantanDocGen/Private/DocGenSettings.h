@@ -23,6 +23,15 @@ enum class EDocumentationSource : uint8
 	UserPreferences,
 };
 
+UENUM()
+enum class EKantanDocGenOutputFormat : uint8
+{
+	// A page per class and node, converted from xml by the conversion tool
+	Html,
+	// Json data per class, written straight from the generator, with a single viewer page to browse it
+	Json,
+};
+
 USTRUCT()
 struct FKantanDocGenSettings
 {
@@ -59,12 +68,13 @@ public:
 	//UPROPERTY(EditAnywhere, Category = "Class Search", Meta = (ContentDir))
 	TArray< FDirectoryPath > ContentPaths;
 
-	/** Names of specific classes/blueprints to document. */
-	//UPROPERTY()
+	// Classes/blueprints to document. If empty, everything in the included modules and content paths is documented.
+	// Each entry is a class name (wildcards allowed), 'Module:Name[/Class]', 'Plugin:Name[/Class]' or 'Child:Class'.
+	UPROPERTY(EditAnywhere, Category = "Class Search")
 	TArray< FName > SpecificClasses;
 
-	/** Names of specific classes/blueprints to exclude. */
-	//UPROPERTY()
+	// Classes/blueprints to exclude, using the same syntax as SpecificClasses. Exclusions always take priority.
+	UPROPERTY(EditAnywhere, Category = "Class Search")
 	TArray< FName > ExcludedClasses;
 
 	//UPROPERTY(EditAnywhere, Category = "Output")
@@ -73,14 +83,79 @@ public:
 	//UPROPERTY(EditAnywhere, Category = "Class Search", AdvancedDisplay)
 	TSubclassOf< UObject > BlueprintContextClass;
 
-	//UPROPERTY(EditAnywhere, Category = "Output")
-	bool bCleanOutputDirectory = true;
+	// Html converts a page for every class and node. Json skips conversion, writing per class data and a single viewer page. Set by -Format=.
+	UPROPERTY(EditAnywhere, Category = "Generation", AdvancedDisplay)
+	EKantanDocGenOutputFormat OutputFormat = EKantanDocGenOutputFormat::Html;
+
+	// Render an image of every node. By far the most expensive part of generation, disable for text only docs.
+	UPROPERTY(EditAnywhere, Category = "Generation", AdvancedDisplay)
+	bool bGenerateNodeImages = true;
+
+	// Stop once the intermediate xml is written, without converting it to html. Used by the benchmark tests.
+	bool bSkipConversion = false;
+
+	// Number of blueprint assets from content paths to load asynchronously ahead of the one being documented.
+	// Higher values overlap more loading with documentation work, at the cost of memory.
+	UPROPERTY(EditAnywhere, Category = "Performance", AdvancedDisplay, Meta = (ClampMin = 1, UIMin = 1, UIMax = 64))
+	int32 ContentLoadWindow = 8;
+
+	// Number of nodes to spawn into the temporary graph before replacing it with a fresh one.
+	// Nodes are released as soon as they're documented, recycling also lets go of anything they left behind.
+	UPROPERTY(EditAnywhere, Category = "Performance", AdvancedDisplay, Meta = (ClampMin = 1, UIMin = 100, UIMax = 10000))
+	int32 MaxNodesPerGraph = 1000;
+
+	// Document nodes using the template instances the editor caches for its action menus, where possible.
+	// Avoids spawning every node into a graph, but template nodes are shared with the editor and haven't yet been
+	// measured or checked against the golden output, so this is off by default.
+	UPROPERTY(EditAnywhere, Category = "Performance", AdvancedDisplay)
+	bool bUseTemplateNodes = false;
+
+	// Physical memory use (in MB) above which garbage is collected between classes. 0 to never collect.
+	// Generating from the command line doesn't tick the engine, so nothing is collected otherwise.
+	UPROPERTY(EditAnywhere, Category = "Performance", AdvancedDisplay, Meta = (ClampMin = 0, UIMin = 0, UIMax = 65536))
+	int32 MemoryCeilingMB = 4096;
+
+	// Periodically save progress to the intermediate directory, so that a crashed or cancelled run can be resumed.
+	UPROPERTY(EditAnywhere, Category = "Performance", AdvancedDisplay)
+	bool bEnableCheckpoints = true;
+
+	// Minimum number of seconds between checkpoints. Checkpoints are only taken between objects.
+	UPROPERTY(EditAnywhere, Category = "Performance", AdvancedDisplay, Meta = (EditCondition = "bEnableCheckpoints", ClampMin = 1, UIMin = 10, UIMax = 600))
+	int32 CheckpointIntervalSeconds = 60;
+
+	// Carry on from the last checkpoint rather than starting over, if it was taken with matching settings. Set by -Resume.
+	bool bResumeFromCheckpoint = false;
+
+	// Percentage by which a run may be slower than the baseline report before it's treated as a regression.
+	UPROPERTY(EditAnywhere, Category = "Run Report", AdvancedDisplay, Meta = (ClampMin = 0))
+	float MaxSlowdownPercent = 20.0f;
+
+	// Percentage fewer nodes or classes than the baseline report which is treated as a regression.
+	UPROPERTY(EditAnywhere, Category = "Run Report", AdvancedDisplay, Meta = (ClampMin = 0))
+	float MaxNodeLossPercent = 5.0f;
+
+	// Where to write the json run report, defaults to Saved/KantanDocGenReports/<Title>.json. Set by -Report=.
+	FString ReportPath;
+
+	// Previous run report to compare against. Set by -Baseline=.
+	FString BaselinePath;
+
+	// Directory to mirror the docs into once generated, only copying what changed. Set by -Publish=.
+	FString PublishPath;
+
+	// Strip whitespace and comments from the converted html, css and js. Set by -Optimize.
+	UPROPERTY(EditAnywhere, Category = "Hosting", AdvancedDisplay)
+	bool bMinifyOutput = false;
+
+	// Write a gzip compressed copy of every text file alongside it, and a manifest of every file's hash, for static servers
+	// to serve precompressed and cache for as long as the hash is unchanged. Set by -Optimize.
+	UPROPERTY(EditAnywhere, Category = "Hosting", AdvancedDisplay)
+	bool bPrecompressOutput = false;
 
 public:
 	FKantanDocGenSettings()
 	{
 		BlueprintContextClass = AActor::StaticClass();
-		bCleanOutputDirectory = true;
 	}
 
 	bool HasAnySources() const
@@ -0,0 +1,253 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenSourceIndex.h"
+#include "KantanDocGenLog.h"
+#include "SourceCodeNavigation.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+
+namespace DocGenSourceIndex
+{
+	static const uint32 CacheMagic = 0x4B444749;	// 'KDGI'
+	static const int32 CacheVersion = 1;
+}
+
+FDocGenSourceIndex::~FDocGenSourceIndex()
+{
+	// The scan task references us
+	WaitUntilReady();
+}
+
+TSharedRef< FDocGenSourceIndex > FDocGenSourceIndex::GT_Build(TArray< FName > const& ModuleNames, FString const& InCacheFilename)
+{
+	check(IsInGameThread());
+
+	TSharedRef< FDocGenSourceIndex > Index = MakeShared< FDocGenSourceIndex >();
+	Index->CacheFilename = InCacheFilename;
+
+	// FSourceCodeNavigation's module lookup isn't safe to use off the game thread, so resolve directories up front
+	TMap< FName, FString > ModuleDirs;
+	for (FName const& ModuleName : ModuleNames)
+	{
+		FString ModuleDir;
+		if (FSourceCodeNavigation::FindModulePath(ModuleName.ToString(), ModuleDir))
+		{
+			ModuleDirs.Add(ModuleName, ModuleDir);
+		}
+	}
+
+	Index->ScanResult = Async(EAsyncExecution::ThreadPool, [IndexPtr = &Index.Get(), ModuleDirs = MoveTemp(ModuleDirs)]
+		{
+			IndexPtr->ScanAll(ModuleDirs);
+		});
+
+	return Index;
+}
+
+void FDocGenSourceIndex::WaitUntilReady() const
+{
+	if (ScanResult.IsValid())
+	{
+		ScanResult.Wait();
+	}
+}
+
+void FDocGenSourceIndex::ScanAll(TMap< FName, FString > const& ModuleDirs)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Cached entries for modules not in this run are kept, so alternating between configurations doesn't rescan
+	TMap< FName, FModuleFiles > AllFiles;
+	LoadCache(AllFiles);
+
+	bool bCacheChanged = false;
+	for (auto const& Entry : ModuleDirs)
+	{
+		FModuleFiles* Files = AllFiles.Find(Entry.Key);
+		if (Files && Files->ModuleDir == Entry.Value && IsUpToDate(*Files))
+		{
+			++NumCachedModules;
+		}
+		else
+		{
+			Files = &AllFiles.Add(Entry.Key);
+			ScanModule(Entry.Value, *Files);
+			++NumScannedModules;
+			bCacheChanged = true;
+		}
+
+		BuildLookup(*Files, Modules.Add(Entry.Key));
+	}
+
+	if (bCacheChanged && !SaveCache(AllFiles))
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to write source index cache '%s'."), *CacheFilename);
+	}
+
+	ScanTime = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogKantanDocGen, Log, TEXT("Source index: %i modules scanned, %i from cache, took %.3fs."), NumScannedModules, NumCachedModules, ScanTime);
+}
+
+bool FDocGenSourceIndex::IsUpToDate(FModuleFiles const& Files)
+{
+	if (Files.Directories.Num() == 0)
+	{
+		return false;
+	}
+
+	IFileManager& FileManager = IFileManager::Get();
+	for (FDirectoryStamp const& Stamp : Files.Directories)
+	{
+		const FFileStatData StatData = FileManager.GetStatData(*(Files.ModuleDir / Stamp.Path));
+		if (!StatData.bIsValid || !StatData.bIsDirectory || StatData.ModificationTime != Stamp.ModificationTime)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FDocGenSourceIndex::ScanModule(FString const& ModuleDir, FModuleFiles& OutFiles)
+{
+	OutFiles = FModuleFiles();
+	OutFiles.ModuleDir = ModuleDir;
+
+	IFileManager& FileManager = IFileManager::Get();
+
+	const FFileStatData RootStatData = FileManager.GetStatData(*ModuleDir);
+	if (!RootStatData.bIsValid)
+	{
+		return;
+	}
+	OutFiles.Directories.Add({ FString(), RootStatData.ModificationTime });
+
+	const FString RootPrefix = ModuleDir / TEXT("");
+	FileManager.IterateDirectoryStatRecursively(*ModuleDir, [&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			FString Path = FilenameOrDirectory;
+			if (Path.StartsWith(RootPrefix))
+			{
+				Path.RightChopInline(RootPrefix.Len());
+			}
+
+			if (StatData.bIsDirectory)
+			{
+				OutFiles.Directories.Add({ MoveTemp(Path), StatData.ModificationTime });
+			}
+			else
+			{
+				const FString Extension = FPaths::GetExtension(Path);
+				if (Extension.Equals(TEXT("h"), ESearchCase::IgnoreCase))
+				{
+					OutFiles.Headers.Add(MoveTemp(Path));
+				}
+				else if (Extension.Equals(TEXT("cpp"), ESearchCase::IgnoreCase))
+				{
+					OutFiles.Sources.Add(MoveTemp(Path));
+				}
+			}
+			return true;
+		});
+
+	// Directory iteration order is filesystem dependent
+	OutFiles.Sources.Sort();
+}
+
+void FDocGenSourceIndex::BuildLookup(FModuleFiles const& Files, FModuleLookup& OutLookup)
+{
+	OutLookup.ModuleDir = Files.ModuleDir;
+	OutLookup.Headers.Append(Files.Headers);
+
+	for (FString const& Source : Files.Sources)
+	{
+		// @NOTE: As with FSourceCodeNavigation, the first source file found with a matching name wins.
+		OutLookup.SourcesByBaseName.FindOrAdd(FPaths::GetBaseFilename(Source), Source);
+	}
+}
+
+bool FDocGenSourceIndex::FindPaths(FName const& ModuleName, FString const& ModuleRelativePath, FString& OutHeaderPath, FString& OutSourcePath) const
+{
+	WaitUntilReady();
+
+	FModuleLookup const* Lookup = Modules.Find(ModuleName);
+	if (Lookup == nullptr)
+	{
+		return false;
+	}
+
+	OutHeaderPath.Reset();
+	OutSourcePath.Reset();
+
+	// FString hashing and comparison are case insensitive, as are the filesystems this runs on
+	FString RelativeHeaderPath = ModuleRelativePath;
+	FPaths::NormalizeFilename(RelativeHeaderPath);
+	if (RelativeHeaderPath.IsEmpty() || !Lookup->Headers.Contains(RelativeHeaderPath))
+	{
+		return true;
+	}
+
+	OutHeaderPath = Lookup->ModuleDir / RelativeHeaderPath;
+	if (FString const* Source = Lookup->SourcesByBaseName.Find(FPaths::GetBaseFilename(RelativeHeaderPath)))
+	{
+		OutSourcePath = Lookup->ModuleDir / *Source;
+	}
+
+	return true;
+}
+
+bool FDocGenSourceIndex::LoadCache(TMap< FName, FModuleFiles >& OutModules) const
+{
+	TUniquePtr< FArchive > Reader(IFileManager::Get().CreateFileReader(*CacheFilename, FILEREAD_Silent));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	// Module names are stored as strings
+	FNameAsStringProxyArchive Ar(*Reader);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Ar << Magic << Version;
+	if (Magic != DocGenSourceIndex::CacheMagic || Version != DocGenSourceIndex::CacheVersion)
+	{
+		return false;
+	}
+
+	Ar << OutModules;
+	if (Ar.IsError())
+	{
+		OutModules.Empty();
+		return false;
+	}
+
+	return true;
+}
+
+bool FDocGenSourceIndex::SaveCache(TMap< FName, FModuleFiles >& InModules) const
+{
+	TUniquePtr< FArchive > Writer(IFileManager::Get().CreateFileWriter(*CacheFilename, FILEWRITE_EvenIfReadOnly));
+	if (!Writer)
+	{
+		return false;
+	}
+
+	FNameAsStringProxyArchive Ar(*Writer);
+
+	uint32 Magic = DocGenSourceIndex::CacheMagic;
+	int32 Version = DocGenSourceIndex::CacheVersion;
+	Ar << Magic << Version;
+	Ar << InModules;
+
+	return Writer->Close();
+}
+
@@ -0,0 +1,94 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+
+
+/*
+Index of the header and source files of a set of code modules, used in place of FSourceCodeNavigation's
+per-class filesystem probing.
+Module directories are resolved once on the game thread, then each module is scanned with a single recursive
+directory walk on the thread pool. Scans are cached on disk between runs, a cached module is rescanned only if
+the modification time of one of its directories has changed (ie. files were added, removed or renamed).
+*/
+class FDocGenSourceIndex
+{
+public:
+	~FDocGenSourceIndex();
+
+	/** Callable only from game thread */
+	static TSharedRef< FDocGenSourceIndex > GT_Build(TArray< FName > const& ModuleNames, FString const& InCacheFilename);
+	/**/
+
+	/*
+	Header and source paths for a type with the given UHT ModuleRelativePath, in the same form as
+	FSourceCodeNavigation::FindClassHeaderPath/FindClassSourcePath would give them.
+	Returns false if the module wasn't indexed, in which case the caller should fall back to FSourceCodeNavigation.
+	Blocks until the background scan has completed.
+	*/
+	bool FindPaths(FName const& ModuleName, FString const& ModuleRelativePath, FString& OutHeaderPath, FString& OutSourcePath) const;
+
+	void WaitUntilReady() const;
+
+protected:
+	struct FDirectoryStamp
+	{
+		FString Path;
+		FDateTime ModificationTime;
+
+		friend FArchive& operator<< (FArchive& Ar, FDirectoryStamp& Stamp)
+		{
+			return Ar << Stamp.Path << Stamp.ModificationTime;
+		}
+	};
+
+	struct FModuleFiles
+	{
+		FString ModuleDir;
+		// Relative to the module directory
+		TArray< FDirectoryStamp > Directories;
+		TArray< FString > Headers;
+		TArray< FString > Sources;
+
+		friend FArchive& operator<< (FArchive& Ar, FModuleFiles& Files)
+		{
+			return Ar << Files.ModuleDir << Files.Directories << Files.Headers << Files.Sources;
+		}
+	};
+
+	// Lookup tables, built from FModuleFiles once scanned or loaded
+	struct FModuleLookup
+	{
+		FString ModuleDir;
+		TSet< FString > Headers;
+		// Base filename -> first matching source file
+		TMap< FString, FString > SourcesByBaseName;
+	};
+
+	void ScanAll(TMap< FName, FString > const& ModuleDirs);
+	static bool IsUpToDate(FModuleFiles const& Files);
+	static void ScanModule(FString const& ModuleDir, FModuleFiles& OutFiles);
+	static void BuildLookup(FModuleFiles const& Files, FModuleLookup& OutLookup);
+
+	bool LoadCache(TMap< FName, FModuleFiles >& OutModules) const;
+	bool SaveCache(TMap< FName, FModuleFiles >& InModules) const;
+
+protected:
+	FString CacheFilename;
+	TMap< FName, FModuleLookup > Modules;
+	TFuture< void > ScanResult;
+
+public:
+	//
+	double ScanTime = 0.0;
+	int32 NumScannedModules = 0;
+	int32 NumCachedModules = 0;
+	//
+};
+
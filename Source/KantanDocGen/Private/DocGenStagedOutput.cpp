@@ -0,0 +1,241 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "DocGenStagedOutput.h"
+#include "KantanDocGenLog.h"
+#include "DocGenTrace.h"
+#include "DocGenPublisher.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#else
+#include <unistd.h>
+#endif
+
+
+FDocGenStagedOutput::FDocGenStagedOutput(FString const& InOutputDir, FString const& InDocTitle)
+{
+	// Siblings of the published docs, so that they're on the same volume and can be renamed into place
+	const FString OutputDir = FPaths::ConvertRelativePathToFull(InOutputDir);
+	PublishedDir = OutputDir / InDocTitle;
+	StagingRoot = OutputDir / (TEXT(".") + InDocTitle + TEXT(".staging"));
+	StagedDir = StagingRoot / InDocTitle;
+	PreviousDir = OutputDir / (TEXT(".") + InDocTitle + TEXT(".previous"));
+	ManifestFilename = FDocGenPublisher::GetSourceCacheFilename(InDocTitle);
+}
+
+FDocGenStagedOutput::~FDocGenStagedOutput()
+{
+	if (bActive)
+	{
+		Abort();
+	}
+}
+
+bool FDocGenStagedOutput::Begin()
+{
+	IFileManager& FileManager = IFileManager::Get();
+
+	// Left behind by a run which didn't get to finish
+	FileManager.DeleteDirectory(*StagingRoot, false, true);
+	FileManager.DeleteDirectory(*PreviousDir, false, true);
+
+	bActive = FileManager.MakeDirectory(*StagingRoot, true);
+	return bActive;
+}
+
+bool FDocGenStagedOutput::Commit()
+{
+	check(bActive);
+	DOCGEN_TRACE_SCOPE(KantanDocGen_CommitOutput);
+	const double StartTime = FPlatformTime::Seconds();
+
+	IFileManager& FileManager = IFileManager::Get();
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	if (!FileManager.DirectoryExists(*StagedDir))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Conversion didn't produce '%s'."), *StagedDir);
+		Abort();
+		return false;
+	}
+
+	if (!LinkUnchangedFiles())
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to link unchanged files into '%s'."), *StagedDir);
+		Abort();
+		return false;
+	}
+
+	// @NOTE: Two renames, so there's a moment where nothing is published, but never one where something partial is.
+	const bool bHadPrevious = FileManager.DirectoryExists(*PublishedDir);
+	if (bHadPrevious && !PlatformFile.MoveFile(*PreviousDir, *PublishedDir))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to move '%s' aside, is it in use?"), *PublishedDir);
+		Abort();
+		return false;
+	}
+
+	if (!PlatformFile.MoveFile(*PublishedDir, *StagedDir))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to move staged docs into '%s'."), *PublishedDir);
+		if (bHadPrevious)
+		{
+			PlatformFile.MoveFile(*PublishedDir, *PreviousDir);
+		}
+		Abort();
+		return false;
+	}
+
+	FileManager.DeleteDirectory(*PreviousDir, false, true);
+	FileManager.DeleteDirectory(*StagingRoot, false, true);
+	bActive = false;
+
+	SaveManifest();
+
+	CommitTime = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogKantanDocGen, Display, TEXT("Published %i files, %i unchanged (%.1fMB) linked from the previous version, took %.3fs."),
+		NumFiles, NumLinkedFiles, LinkedBytes / (1024.0 * 1024.0), CommitTime);
+	return true;
+}
+
+void FDocGenStagedOutput::Abort()
+{
+	IFileManager::Get().DeleteDirectory(*StagingRoot, false, true);
+	bActive = false;
+}
+
+bool FDocGenStagedOutput::LinkUnchangedFiles()
+{
+	IFileManager::Get().FindFilesRecursive(StagedPaths, *StagedDir, TEXT("*"), true, false);
+	NumFiles = StagedPaths.Num();
+
+	const FString StagedPrefix = StagedDir / TEXT("");
+	for (FString& StagedPath : StagedPaths)
+	{
+		StagedPath.RightChopInline(StagedPrefix.Len());
+	}
+	StagedHashes.SetNum(StagedPaths.Num());
+
+	if (!IFileManager::Get().DirectoryExists(*PublishedDir))
+	{
+		return true;
+	}
+
+	// @NOTE: Published files are normally unchanged since the manifest was saved, so this is mostly stat calls
+	FKantanDocGenManifest Cached;
+	const bool bHaveCached = FKantanDocGenManifest::LoadFromFile(ManifestFilename, Cached);
+	FKantanDocGenManifest Published;
+	FDocGenPublisher::BuildManifest(PublishedDir, bHaveCached ? &Cached : nullptr, Published);
+
+	TMap< FString, FKantanDocGenManifestFile const* > PublishedFiles;
+	for (FKantanDocGenManifestFile const& File : Published.Files)
+	{
+		PublishedFiles.Add(File.Path, &File);
+	}
+
+	FThreadSafeCounter NumLinked;
+	FThreadSafeCounter NumLost;
+	FThreadSafeCounter64 BytesLinked;
+
+	ParallelFor(StagedPaths.Num(), [&](int32 Index)
+		{
+			const FString StagedFile = StagedDir / StagedPaths[Index];
+			const FString PublishedFile = PublishedDir / StagedPaths[Index];
+
+			IFileManager& FileManager = IFileManager::Get();
+			FKantanDocGenManifestFile const* const* PublishedEntry = PublishedFiles.Find(StagedPaths[Index]);
+			const int64 Size = FileManager.FileSize(*StagedFile);
+			if (!PublishedEntry || Size < 0 || (*PublishedEntry)->Size != Size)
+			{
+				return;
+			}
+
+			StagedHashes[Index] = LexToString(FMD5Hash::HashFile(*StagedFile));
+			if (StagedHashes[Index] != (*PublishedEntry)->Hash)
+			{
+				return;
+			}
+
+			// Linked under a temporary name and moved over the staged copy, so the staged file is never missing
+			const FString TempLink = StagedFile + TEXT(".link");
+			if (!CreateHardLink(PublishedFile, TempLink))
+			{
+				return;
+			}
+
+			if (FileManager.Move(*StagedFile, *TempLink, true, true))
+			{
+				NumLinked.Increment();
+				BytesLinked.Add(Size);
+				return;
+			}
+
+			FileManager.Delete(*TempLink, false, true, true);
+
+			// Replacing can delete the destination before the move fails, in which case the published file is copied back
+			if (!FileManager.FileExists(*StagedFile) && FileManager.Copy(*StagedFile, *PublishedFile) != COPY_OK)
+			{
+				UE_LOG(LogKantanDocGen, Warning, TEXT("Lost staged file '%s'."), *StagedFile);
+				NumLost.Increment();
+			}
+		});
+
+	NumLinkedFiles = NumLinked.GetValue();
+	LinkedBytes = BytesLinked.GetValue();
+	return NumLost.GetValue() == 0;
+}
+
+void FDocGenStagedOutput::SaveManifest()
+{
+	FKantanDocGenManifest Manifest;
+	Manifest.Version = FDocGenPublisher::ManifestVersion;
+
+	for (int32 Index = 0; Index < StagedPaths.Num(); ++Index)
+	{
+		if (StagedHashes[Index].IsEmpty())
+		{
+			continue;
+		}
+
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*(PublishedDir / StagedPaths[Index]));
+		if (!StatData.bIsValid)
+		{
+			continue;
+		}
+
+		FKantanDocGenManifestFile& Entry = Manifest.Files.AddDefaulted_GetRef();
+		Entry.Path = StagedPaths[Index];
+		Entry.Hash = StagedHashes[Index];
+		Entry.Size = StatData.FileSize;
+		Entry.ModifiedTicks = StatData.ModificationTime.GetTicks();
+	}
+
+	if (!Manifest.SaveToFile(ManifestFilename))
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to write output manifest '%s'."), *ManifestFilename);
+	}
+}
+
+bool FDocGenStagedOutput::CreateHardLink(FString const& ExistingFile, FString const& NewLink)
+{
+#if PLATFORM_WINDOWS
+	return ::CreateHardLinkW(*NewLink, *ExistingFile, nullptr) != 0;
+#else
+	return ::link(TCHAR_TO_UTF8(*ExistingFile), TCHAR_TO_UTF8(*NewLink)) == 0;
+#endif
+}
+
@@ -0,0 +1,62 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/*
+Converted docs are written to a staging directory alongside the published ones, then swapped in with a pair of
+directory renames, so the published docs are never empty or half written and stale files never survive a run.
+Before the swap, staged files identical to their published counterparts are replaced with hard links to them,
+so an unchanged file keeps its identity (and timestamp) from one version to the next. Published files are
+described by the manifest the publisher caches, so only those whose size or timestamp changed are rehashed.
+*/
+class FDocGenStagedOutput
+{
+public:
+	FDocGenStagedOutput(FString const& InOutputDir, FString const& InDocTitle);
+	~FDocGenStagedOutput();
+
+	// Creates an empty staging directory. Convert into GetStagingRoot() with the same doc title.
+	bool Begin();
+	FString const& GetStagingRoot() const { return StagingRoot; }
+
+	// Swaps the staged docs in and removes the previous version. On failure the previous version stays published.
+	bool Commit();
+	// Discards the staged docs
+	void Abort();
+
+protected:
+	// False if a staged file was lost and couldn't be restored
+	bool LinkUnchangedFiles();
+	// Records the hashes of the newly published files, for the next run and the publisher
+	void SaveManifest();
+	static bool CreateHardLink(FString const& ExistingFile, FString const& NewLink);
+
+protected:
+	FString PublishedDir;
+	FString StagingRoot;
+	FString StagedDir;
+	FString PreviousDir;
+	FString ManifestFilename;
+	bool bActive = false;
+
+	// Staged files hashed while linking, relative to the staged directory. Only those with a published counterpart
+	// of the same size get hashed, the rest are left to be hashed when next needed.
+	TArray< FString > StagedPaths;
+	TArray< FString > StagedHashes;
+
+public:
+	//
+	double CommitTime = 0.0;
+	int32 NumFiles = 0;
+	int32 NumLinkedFiles = 0;
+	int64 LinkedBytes = 0;
+	//
+};
+
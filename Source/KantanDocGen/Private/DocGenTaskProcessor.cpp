@@ -6,24 +6,39 @@
 
 #include "DocGenTaskProcessor.h"
 #include "KantanDocGenLog.h"
+#include "DocGenTrace.h"
 #include "NodeDocsGenerator.h"
-#include "BlueprintActionDatabase.h"
+#include "BlueprintActionSnapshot.h"
+#include "ReflectionDocsGenerator.h"
+#include "DocGenSourceIndex.h"
+#include "DocGenOutputOptimizer.h"
+#include "DocGenStagedOutput.h"
+#include "DocGenPublisher.h"
 #include "BlueprintNodeSpawner.h"
 #include "K2Node.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "Async/Async.h"
 #include "Enumeration/ISourceObjectEnumerator.h"
 #include "Enumeration/NativeModuleEnumerator.h"
+#include "Enumeration/NativeTypeIndex.h"
 #include "Enumeration/ContentPathEnumerator.h"
 #include "Enumeration/CompositeEnumerator.h"
+#include "Enumeration/ClassFilter.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "ThreadingHelpers.h"
 #include "Interfaces/IPluginManager.h"
 #include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
 #include "HAL/PlatformProcess.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectGlobals.h"
 #include "KantanDocGenModule.h"
 #include "Interfaces/IProjectManager.h"
 #include "ProjectDescriptor.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/EngineVersion.h"
 
 
 #define LOCTEXT_NAMESPACE "KantanDocGen"
@@ -31,6 +46,19 @@
 #define PLAY_FAIL_SOUND() GEditor->PlayEditorSound(TEXT("/Engine/EditorSounds/Notifications/CompileFailed_Cue.CompileFailed_Cue"))
 #define PLAY_SUCC_SOUND() GEditor->PlayEditorSound(TEXT("/Engine/EditorSounds/Notifications/CompileSuccess_Cue.CompileSuccess_Cue"));
 
+namespace DocGenProgress
+{
+	// Seconds between progress snapshots, and between progress log lines when running from the command line
+	static const double UpdateInterval = 0.25;
+	static const double LogInterval = 10.0;
+}
+
+namespace DocGenLoading
+{
+	// Seconds of async loading to process between spawners when nothing else is ticking it
+	static const float AsyncLoadingBudget = 0.002f;
+}
+
 FDocGenTaskProcessor::FDocGenTaskProcessor()
 {
 	bRunning = false;
@@ -45,6 +73,17 @@ void FDocGenTaskProcessor::QueueTask(FKantanDocGenSettings const& Settings, EKan
 
 	NewTask->ModulePluginNameAndDesc = GenerateModulePluginNameAndDesc(Settings);
 
+	// @NOTE: Nothing from a previous run may be mistaken for this one's. If a task is already being processed, it
+	// resets these itself when this one starts.
+	if (!bRunning)
+	{
+		{
+			FScopeLock Lock(&ProgressLock);
+			Progress = FDocGenProgress();
+		}
+		LastReport = FKantanDocGenRunReport();
+		LastExitCode = 0;
+	}
 
 	if (Mode == EKantanDocGenerationMode::UI)
 	{
@@ -140,6 +179,8 @@ bool FDocGenTaskProcessor::IsRunning() const
 
 bool FDocGenTaskProcessor::Init()
 {
+	// Run inline, the processor is stopped at the end of every run and then reused
+	bTerminationRequest = false;
 	bRunning = true;
 	return true;
 }
@@ -174,31 +215,164 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 			if (Mode == EKantanDocGenerationMode::UI)
 			{
 				Current->Task->Notification->SetExpireDuration(2.0f);
-				Current->Task->Notification->SetText(LOCTEXT("DocGenInProgress", "Doc gen in progress"));
+				// Polled by the notification, so it follows along without us having to push updates to the game thread
+				Current->Task->Notification->SetText(TAttribute< FText >::Create(TAttribute< FText >::FGetter::CreateRaw(this, &FDocGenTaskProcessor::GetProgressText)));
 			}
 
 			return Current->DocGen->GT_Init(DocTitle, IntermediateDir, Current->Task->ModulePluginNameAndDesc,
-				Current->Task->Settings.BlueprintContextClass);
+				Current->Task->Settings.BlueprintContextClass, Current->Task->Settings.bUseTemplateNodes);
 		};
 
-	TFunction<void()> GameThread_EnqueueEnumerators = [this]()
+	TFunction<bool()> GameThread_EnqueueEnumerators = [this]() -> bool
 		{
+			DOCGEN_TRACE_SCOPE(KantanDocGen_Prepass);
+
+			const double PrepassStartTime = FPlatformTime::Seconds();
+			ON_SCOPE_EXIT
+			{
+				Current->PrepassTime = FPlatformTime::Seconds() - PrepassStartTime;
+			};
+
+			// When resuming, enumerators the checkpoint had finished aren't enqueued at all, and the one it was part way
+			// through carries on from where it got to
+			auto EnqueueEnumerator = [this](TSharedRef< ISourceObjectEnumerator > const& Enumerator) -> bool
+				{
+					const int32 Index = Current->NumEnumerators++;
+					if (Current->bResumed)
+					{
+						auto const& State = Current->CheckpointState;
+						if (Index < State.EnumeratorIndex)
+						{
+							return false;
+						}
+
+						if (Index == State.EnumeratorIndex)
+						{
+							if (Enumerator->EstimatedSize() == State.EnumeratorSize)
+							{
+								Enumerator->Seek(State.EnumeratorPosition);
+							}
+							else
+							{
+								// Objects already documented are still skipped by path, we just can't jump straight past them
+								UE_LOG(LogKantanDocGen, Warning, TEXT("Objects to document have changed since the checkpoint, rescanning."));
+							}
+						}
+					}
+
+					if (Current->Enumerators.IsEmpty())
+					{
+						Current->EnumeratorIndex = Index - 1;
+					}
+					Current->Enumerators.Enqueue(Enumerator);
+					Current->EnumerationSize += Enumerator->EstimatedSize();
+					return true;
+				};
+
 			TArray<FName> AllModules;
 			Current->Task->ModulePluginNameAndDesc.GenerateKeyArray(AllModules);
-			Current->Enumerators.Enqueue(MakeShared< FCompositeEnumerator< FNativeModuleEnumerator > >(AllModules));
+
+			// Single pass over all native types, shared by every module enumerator
+			TSharedRef< const FNativeTypeIndex > TypeIndex = FNativeTypeIndex::GT_Build(AllModules);
+			Current->TypeIndex = TypeIndex;
+
+			// Scans source directories on the thread pool while we get on with everything else
+			Current->SourceIndex = FDocGenSourceIndex::GT_Build(AllModules, FPaths::ProjectIntermediateDir() / TEXT("KantanDocGenCache") / TEXT("SourceIndex.bin"));
+
+			// Applied by the enumerator prepasses, so that nothing filtered out gets spawned, loaded or snapshotted
+			TSharedRef< const FDocGenClassFilter > ClassFilter = MakeShared< FDocGenClassFilter >(Current->Task->Settings, Current->Task->ModulePluginNameAndDesc);
+			Current->ClassFilter = ClassFilter;
+			if (!ClassFilter->IsValid())
+			{
+				return false;
+			}
+
+			auto NativeEnumerator = MakeShared< FCompositeEnumerator< FNativeModuleEnumerator > >(AllModules, TypeIndex, ClassFilter);
+			const bool bNativeEnqueued = EnqueueEnumerator(NativeEnumerator);
+
+			UE_LOG(LogKantanDocGen, Display, TEXT("Native prepass: indexed %i classes in %i packages in %.3fs, enumerator prepass total %.3fs."),
+				TypeIndex->NumClasses(), TypeIndex->NumPackages(), TypeIndex->BuildTime, FPlatformTime::Seconds() - PrepassStartTime);
 
 			TArray< FName > ContentPackagePaths;
 			for (auto const& Path : Current->Task->Settings.ContentPaths)
 			{
 				ContentPackagePaths.AddUnique(FName(*Path.Path));
 			}
-			Current->Enumerators.Enqueue(MakeShared< FCompositeEnumerator< FContentPathEnumerator > >(ContentPackagePaths));
+			EnqueueEnumerator(MakeShared< FCompositeEnumerator< FContentPathEnumerator > >(ContentPackagePaths, Current->Task->Settings.ContentLoadWindow, ClassFilter));
+
+			if (!ClassFilter->IsEmpty())
+			{
+				UE_LOG(LogKantanDocGen, Display, TEXT("Class filter pruned %i classes and blueprints before enumeration."), ClassFilter->GetNumPruned());
+			}
+
+			// Snapshot the spawners for everything we already know will be enumerated, in one pass
+			TArray< UObject* > PrepassObjects;
+			if (bNativeEnqueued)
+			{
+				NativeEnumerator->GetPrepassObjects(PrepassObjects);
+			}
+
+			Current->Actions = MakeUnique< FBlueprintActionSnapshot >();
+			Current->Actions->GT_Build(PrepassObjects);
+			return true;
 		};
 
-	auto GameThread_EnumerateNextObject = [this]() -> bool
+	auto GameThread_ManageMemory = [this]()
 		{
+			auto const& Settings = Current->Task->Settings;
+			const uint64 CeilingBytes = (uint64)FMath::Max(Settings.MemoryCeilingMB, 0) * 1024 * 1024;
+			const bool bOverCeiling = CeilingBytes > 0 && FPlatformMemory::GetStats().UsedPhysical >= FMath::Max(CeilingBytes, Current->MemoryCeilingBytes);
+
+			const int32 NumNodesInGraph = Current->DocGen->GetNumNodesInGraph();
+			if (NumNodesInGraph >= Settings.MaxNodesPerGraph || (bOverCeiling && NumNodesInGraph > 0))
+			{
+				DOCGEN_TRACE_SCOPE(KantanDocGen_RecycleGraph);
+
+				if (!Current->DocGen->GT_RecycleGraph())
+				{
+					UE_LOG(LogKantanDocGen, Error, TEXT("Failed to recycle temporary graph!"));
+				}
+				++Current->NumGraphRecycles;
+			}
+
+			// Nothing documented since the last collection means nothing of ours to free
+			if (bOverCeiling && Current->NumNodesSinceCollect > 0)
+			{
+				DOCGEN_TRACE_SCOPE(KantanDocGen_CollectGarbage);
+
+				Current->NumNodesSinceCollect = 0;
+
+				const double StartTime = FPlatformTime::Seconds();
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+				Current->GarbageCollectTime += FPlatformTime::Seconds() - StartTime;
+				++Current->NumGarbageCollects;
+
+				// If we couldn't get back under, the memory isn't ours. Raise the ceiling rather than collecting after every class.
+				const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+				if (UsedPhysical >= CeilingBytes)
+				{
+					Current->MemoryCeilingBytes = UsedPhysical + CeilingBytes / 4;
+					UE_LOG(LogKantanDocGen, Warning, TEXT("Memory use still %.0fMB after garbage collection, raising ceiling to %.0fMB."),
+						UsedPhysical / (1024.0 * 1024.0), Current->MemoryCeilingBytes / (1024.0 * 1024.0));
+				}
+			}
+		};
+
+	auto GameThread_EnumerateNextObject = [this, GameThread_ManageMemory]() -> bool
+		{
+			// No nodes are in flight between objects, so this is where we clean up
+			GameThread_ManageMemory();
+
+			DOCGEN_TRACE_SCOPE(KantanDocGen_EnumerateObject);
+
+			const double StartTime = FPlatformTime::Seconds();
+			ON_SCOPE_EXIT
+			{
+				Current->EnumerateObjectTime += FPlatformTime::Seconds() - StartTime;
+			};
+
 			Current->SourceObject.Reset();
-			Current->CurrentSpawners.Empty();
+			Current->CurrentSpawnerIndex = Current->CurrentSpawnerEnd = 0;
 
 			while (auto Obj = Current->CurrentEnumerator->GetNext())
 			{
@@ -208,34 +382,63 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 					continue;
 				}
 
-				// Cache list of spawners for this object
-				auto& BPActionMap = FBlueprintActionDatabase::Get().GetAllActions();
-				if (auto ActionList = BPActionMap.Find(Obj))
+				const FString ObjPath = Current->Checkpoint.IsValid() ? Obj->GetPathName() : FString();
+				if (Current->ResumedPaths.Contains(ObjPath))
 				{
-					if (ActionList->Num() == 0)
-					{
-						continue;
-					}
+					continue;
+				}
 
-					Current->SourceObject = Obj;
-					for (auto Spawner : *ActionList)
-					{
-						// Add to queue as weak ptr
-						check(Current->CurrentSpawners.Enqueue(Spawner));
-					}
+				// Spawners were pre-filtered when snapshotted, so this is just a slice lookup
+				const FBlueprintActionSnapshot::FSlice Slice = Current->Actions->GT_FindOrAddObject(Obj);
+				if (Slice.Num == 0)
+				{
+					continue;
+				}
 
-					// Done
-					Current->Processed.Add(Obj);
-					return true;
+				Current->SourceObject = Obj;
+				Current->CurrentSpawnerIndex = Slice.Start;
+				Current->CurrentSpawnerEnd = Slice.Start + Slice.Num;
+
+				// Done
+				Current->Processed.Add(Obj);
+				if (Current->Checkpoint.IsValid())
+				{
+					Current->CheckpointState.ProcessedPaths.Add(ObjPath);
 				}
+				++Current->NumEnumeratedObjects;
+				TRACE_COUNTER_SET(KantanDocGen_Objects, Current->NumEnumeratedObjects);
+				return true;
 			}
 
 			// This enumerator is finished
 			return false;
 		};
 
-	auto GameThread_EnumerateNextNode = [this](FNodeDocsGenerator::FNodeProcessingState& OutState) -> UK2Node*
+	// @NOTE: Run inline (from the command line), nothing ticks the engine while we're processing, so content loads
+	// requested ahead by the enumerators would only progress when we block on them. Give them a slice between spawners.
+	const bool bPumpAsyncLoading = IsInGameThread();
+
+	auto GameThread_EnumerateNextNode = [this, bPumpAsyncLoading](FNodeDocsGenerator::FNodeProcessingState& OutState) -> UK2Node*
 		{
+			DOCGEN_TRACE_SCOPE(KantanDocGen_EnumerateNode);
+
+			if (bPumpAsyncLoading && IsAsyncLoading())
+			{
+				ProcessAsyncLoading(true, false, DocGenLoading::AsyncLoadingBudget);
+			}
+
+			// Whatever happened to the previous node, we're done with it
+			if (Current->PendingReleaseNode)
+			{
+				Current->DocGen->GT_ReleaseNode(Current->PendingReleaseNode);
+				Current->PendingReleaseNode = nullptr;
+
+				if (Current->Checkpoint.IsValid())
+				{
+					Current->Checkpoint->EndSpawner();
+				}
+			}
+
 			// We've just come in from another thread, check the source object is still around
 			if (!Current->SourceObject.IsValid())
 			{
@@ -244,32 +447,51 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 			}
 
 			// Try to grab the next spawner in the cached list
-			TWeakObjectPtr< UBlueprintNodeSpawner > Spawner;
-			while (Current->CurrentSpawners.Dequeue(Spawner))
+			while (Current->CurrentSpawnerIndex < Current->CurrentSpawnerEnd)
 			{
-				if (Spawner.IsValid())
+				if (auto Spawner = Current->Actions->GetSpawner(Current->CurrentSpawnerIndex++))
 				{
+					if (Current->Checkpoint.IsValid())
+					{
+						const FGuid Signature = Spawner->GetSpawnerSignature().AsGuid();
+						if (Current->CheckpointState.SpawnerCrashCounts.FindRef(Signature) >= FDocGenCheckpoint::MaxSpawnerCrashes)
+						{
+							UE_LOG(LogKantanDocGen, Warning, TEXT("Skipping spawner %s for '%s', previous runs crashed while documenting it."),
+								*Signature.ToString(), *Current->SourceObject->GetName());
+							++Current->NumQuarantinedNodes;
+							continue;
+						}
+
+						Current->Checkpoint->BeginSpawner(Signature);
+					}
+
 					// See if we can document this spawner
-					auto K2_NodeInst = Current->DocGen->GT_InitializeForSpawner(Spawner.Get(), Current->SourceObject.Get(), OutState);
+					auto K2_NodeInst = Current->DocGen->GT_InitializeForSpawner(Spawner, Current->SourceObject.Get(), OutState);
 
 					if (K2_NodeInst == nullptr)
 					{
+						if (Current->Checkpoint.IsValid())
+						{
+							Current->Checkpoint->EndSpawner();
+						}
 						continue;
 					}
 
 					// Make sure this node object will never be GCd until we're done with it.
 					K2_NodeInst->AddToRoot();
+					Current->PendingReleaseNode = K2_NodeInst;
+					++Current->NumNodesSinceCollect;
 					return K2_NodeInst;
 				}
 			}
 
-			// No spawners left in the queue
+			// No spawners left in the slice
 			return nullptr;
 		};
 
 	auto GameThread_FinalizeDocs = [this](FString const& OutputPath) -> bool
 		{
-			bool const Result = Current->DocGen->GT_Finalize(OutputPath);
+			bool const Result = Current->DocGen->GT_Finalize(OutputPath, Current->ReflectionDocs.Get());
 
 			if (!Result)
 			{
@@ -294,12 +516,50 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 			Current->Task = InTask;
 		});
 
-	FString IntermediateDir = FPaths::ProjectIntermediateDir() / TEXT("KantanDocGen") / Current->Task->Settings.DocumentationTitle;
+	const double RunStartTime = FPlatformTime::Seconds();
+	Current->StartTime = RunStartTime;
+	UpdateProgress(EDocGenPhase::Preparing, 0, true);
+
+	LastReport = FKantanDocGenRunReport();
+	LastReport.Title = InTask->Settings.DocumentationTitle;
+	LastReport.EngineVersion = FEngineVersion::Current().ToString();
+	LastReport.Timestamp = FDateTime::UtcNow().ToIso8601();
+	LastReport.Format = InTask->Settings.OutputFormat == EKantanDocGenOutputFormat::Json ? TEXT("Json") : TEXT("Html");
+
+	// Any way out other than success is a failure. Either way, there's a report.
+	ON_SCOPE_EXIT
+	{
+		{
+			FScopeLock Lock(&ProgressLock);
+			if (Progress.Phase != EDocGenPhase::Succeeded)
+			{
+				Progress.Phase = EDocGenPhase::Failed;
+			}
+			LastReport.bSucceeded = Progress.Phase == EDocGenPhase::Succeeded;
+		}
+
+		LastReport.Times.Total = FPlatformTime::Seconds() - RunStartTime;
+
+		WriteRunReport(InTask->Settings);
+	};
 
-	DocGenThreads::RunOnGameThread(GameThread_EnqueueEnumerators);
+	FString IntermediateDir = GetIntermediateDir(Current->Task->Settings.DocumentationTitle);
+	const FString ScriptsDir = GetIntermediateScriptsDir(Current->Task->Settings.DocumentationTitle);
+
+	InitCheckpoint();
+
+	if (!DocGenThreads::RunOnGameThreadRetVal(GameThread_EnqueueEnumerators))
+	{
+		LastReport.AddFailures(TEXT("ClassFilter"), Current->ClassFilter->GetNumInvalidRules());
+		UE_LOG(LogKantanDocGen, Error, TEXT("Class filter has %i invalid rules, fix them in Specific Classes/Excluded Classes."), Current->ClassFilter->GetNumInvalidRules());
+		return;
+	}
 
 	// Initialize the doc generator
 	Current->DocGen = MakeUnique< FNodeDocsGenerator >();
+	Current->DocGen->SetSourceIndex(Current->SourceIndex);
+	Current->DocGen->SetOutputFormat(Current->Task->Settings.OutputFormat);
+	Current->DocGen->SetScriptsDir(ScriptsDir);
 
 	if (!DocGenThreads::RunOnGameThreadRetVal(GameThread_InitDocGen, Current->Task->Settings.DocumentationTitle, IntermediateDir))
 	{
@@ -307,35 +567,71 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 		return;
 	}
 
-	bool const bCleanIntermediate = true;
+	// Resuming, the intermediate docs written before the checkpoint are part of the result
+	bool const bCleanIntermediate = !Current->bResumed;
+
+	// Scripts are all written at finalize, so never carried over
+	IFileManager::Get().DeleteDirectory(*ScriptsDir, false, true);
+
 	if (bCleanIntermediate)
 	{
 		IFileManager::Get().DeleteDirectory(*IntermediateDir, false, true);
 	}
-
-	for (auto const& Name : Current->Task->Settings.ExcludedClasses)
+	else
 	{
-		Current->Excluded.Add(Name);
+		Current->NumResumedNodes = DocGenThreads::RunOnGameThreadRetVal([this]
+			{
+				return Current->DocGen->GT_RestoreClassDocRecords(Current->CheckpointState.Classes);
+			});
 	}
 
+	// Game thread: snapshot reflection data (properties, structs, enums) in a single pass.
+	// Formatting it into docs is independent of node generation, so runs alongside it on the thread pool.
+	Current->ReflectionDocs = MakeUnique< FReflectionDocsGenerator >();
+	DocGenThreads::RunOnGameThread([this]
+		{
+			DOCGEN_TRACE_SCOPE(KantanDocGen_ReflectionSnapshot);
+			Current->ReflectionDocs->GT_Snapshot(Current->Task->ModulePluginNameAndDesc, *Current->TypeIndex, *Current->ClassFilter,
+				Current->DocGen->GetNameCache());
+		});
+
+	// Json output writes the types along with the classes at finalize, from the snapshot
+	const bool bTypeDocsXml = Current->Task->Settings.OutputFormat == EKantanDocGenOutputFormat::Html;
+	TFuture< bool > ReflectionDocsResult = Async(EAsyncExecution::ThreadPool,
+		[ReflectionDocs = Current->ReflectionDocs.Get(), DocTitle = Current->Task->Settings.DocumentationTitle, IntermediateDir, bTypeDocsXml]
+		{
+			DOCGEN_TRACE_SCOPE(KantanDocGen_ReflectionDocs);
+			return !bTypeDocsXml || ReflectionDocs->GenerateTypeDocs(DocTitle, IntermediateDir);
+		});
+
+	// Whichever way we leave, the reflection docs task must not outlive the data it's working on
+	ON_SCOPE_EXIT
+	{
+		ReflectionDocsResult.Wait();
+	};
+
 	int SuccessfulNodeCount = 0;
 	while (Current->Enumerators.Dequeue(Current->CurrentEnumerator))
 	{
-		while (DocGenThreads::RunOnGameThreadRetVal(GameThread_EnumerateNextObject))	// Game thread: Enumerate next Obj, get spawner list for Obj, store as array of weak ptrs.
+		++Current->EnumeratorIndex;
+
+		if (Current->EnumerateStartTime == 0.0)
 		{
-			if (bTerminationRequest)
-			{
-				return;
-			}
+			Current->EnumerateStartTime = FPlatformTime::Seconds();
+			Current->EnumerateStartFraction = EstimateEnumerationProgress();
+		}
 
+		while (DocGenThreads::RunOnGameThreadRetVal(GameThread_EnumerateNextObject))	// Game thread: Enumerate next Obj, get spawner list for Obj, store as array of weak ptrs.
+		{
 			FNodeDocsGenerator::FNodeProcessingState NodeState;
 			while (auto NodeInst = DocGenThreads::RunOnGameThreadRetVal(GameThread_EnumerateNextNode, NodeState))	// Game thread: Get next still valid spawner, spawn node, add to root, return it)
 			{
 				// NodeInst should hopefully not reference anything except stuff we control (ie graph object), and it's rooted so should be safe to deal with here
 
 				// Generate image
-				if (!Current->DocGen->GenerateNodeImage(NodeInst, NodeState))
+				if (Current->Task->Settings.bGenerateNodeImages && !Current->DocGen->GenerateNodeImage(NodeInst, NodeState))
 				{
+					++Current->NumImageFailures;
 					UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to generate node image!"))
 						continue;
 				}
@@ -343,17 +639,77 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 				// Generate doc
 				if (!Current->DocGen->GenerateNodeDocs(NodeInst, NodeState))
 				{
+					++Current->NumDocsFailures;
 					UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to generate node doc xml!"))
 						continue;
 				}
 
 				++SuccessfulNodeCount;
+				TRACE_COUNTER_SET(KantanDocGen_Nodes, SuccessfulNodeCount);
+				UpdateProgress(EDocGenPhase::Enumerating, SuccessfulNodeCount);
+			}
+
+			UpdateProgress(EDocGenPhase::Enumerating, SuccessfulNodeCount);
+
+			// @NOTE: Checkpoints are only taken here, once an object is finished, so they never include part of one.
+			if (bTerminationRequest)
+			{
+				if (Current->Checkpoint.IsValid())
+				{
+					SaveCheckpoint();
+				}
+				return;
+			}
+
+			if (Current->Checkpoint.IsValid() && FPlatformTime::Seconds() - Current->LastCheckpointTime >= Current->Task->Settings.CheckpointIntervalSeconds)
+			{
+				SaveCheckpoint();
 			}
 		}
+
+		Current->CompletedEnumerationSize += Current->CurrentEnumerator->EstimatedSize();
+	}
+
+	LastReport.Times.Enumerate = Current->EnumerateStartTime > 0.0 ? FPlatformTime::Seconds() - Current->EnumerateStartTime : 0.0;
+
+	// Everything enumerated. Should finalizing or conversion fail, resuming goes straight back to it.
+	Current->CurrentEnumerator.Reset();
+	Current->EnumeratorIndex = Current->NumEnumerators;
+	if (Current->Checkpoint.IsValid())
+	{
+		SaveCheckpoint();
+	}
+
+	if (Current->NumEnumeratedObjects > 0)
+	{
+		UE_LOG(LogKantanDocGen, Display, TEXT("Object enumeration: %i objects, average game thread time per object %.1fus (action snapshot took %.3fs)."),
+			Current->NumEnumeratedObjects, Current->EnumerateObjectTime * 1e6 / Current->NumEnumeratedObjects, Current->Actions->BuildTime);
+	}
+
+	auto const& DocGen = *Current->DocGen;
+	UE_LOG(LogKantanDocGen, Display, TEXT("Node spawning: %i template nodes averaging %.1fus, %i invoked nodes averaging %.1fus."),
+		DocGen.NumTemplateNodes, DocGen.NumTemplateNodes > 0 ? DocGen.SpawnTemplateNodeTime * 1e6 / DocGen.NumTemplateNodes : 0.0,
+		DocGen.NumInvokedNodes, DocGen.NumInvokedNodes > 0 ? DocGen.SpawnInvokedNodeTime * 1e6 / DocGen.NumInvokedNodes : 0.0);
+
+	UE_LOG(LogKantanDocGen, Display, TEXT("Node output: images took %.3fs, docs took %.3fs, %.1f nodes/s overall."),
+		DocGen.GenerateNodeImageTime, DocGen.GenerateNodeDocsTime, Current->EnumerateStartTime > 0.0 ? SuccessfulNodeCount / FMath::Max(FPlatformTime::Seconds() - Current->EnumerateStartTime, 0.001) : 0.0);
+
+	Current->DocGen->GetNameCache().LogStats();
+
+	UE_LOG(LogKantanDocGen, Display, TEXT("Memory: peak %.0fMB physical, %i graph recycles, %i garbage collections took %.3fs."),
+		FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0), Current->NumGraphRecycles, Current->NumGarbageCollects, Current->GarbageCollectTime);
+
+	if (Current->Checkpoint.IsValid())
+	{
+		UE_LOG(LogKantanDocGen, Display, TEXT("Checkpoints: %i saved taking %.3fs, %i nodes resumed, %i nodes skipped after crashing previous runs."),
+			Current->Checkpoint->NumSaves, Current->Checkpoint->SaveTime, Current->NumResumedNodes, Current->NumQuarantinedNodes);
 	}
 
-	if (SuccessfulNodeCount == 0)
+	GatherRunReport(SuccessfulNodeCount);
+
+	if (SuccessfulNodeCount + Current->NumResumedNodes == 0)
 	{
+		LastReport.AddFailures(TEXT("NoNodes"), 1);
 		UE_LOG(LogKantanDocGen, Error, TEXT("No nodes were found to document!"));
 
 		if (Mode == EKantanDocGenerationMode::UI)
@@ -369,10 +725,54 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 		return;
 	}
 
+	if (!ReflectionDocsResult.Get())
+	{
+		LastReport.AddFailures(TEXT("ReflectionDocs"), 1);
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Some struct/enum docs failed to generate."));
+	}
+
+	UpdateProgress(EDocGenPhase::Finalizing, SuccessfulNodeCount, true);
+
 	// Game thread: DocGen.GT_Finalize()
-	if (!DocGenThreads::RunOnGameThreadRetVal(GameThread_FinalizeDocs, IntermediateDir))
+	const double FinalizeStartTime = FPlatformTime::Seconds();
+	const bool bFinalized = DocGenThreads::RunOnGameThreadRetVal(GameThread_FinalizeDocs, IntermediateDir);
+	LastReport.Times.Finalize = FPlatformTime::Seconds() - FinalizeStartTime;
+	LastReport.AddFailures(TEXT("ClassDocs"), Current->DocGen->NumClassDocFailures);
+	LastReport.Search.Entries = Current->DocGen->SearchIndexStats.NumEntries;
+	LastReport.Search.Tokens = Current->DocGen->SearchIndexStats.NumTokens;
+	LastReport.Search.Shards = Current->DocGen->SearchIndexStats.NumShards;
+	LastReport.Search.Bytes = Current->DocGen->SearchIndexStats.TotalBytes;
+	LastReport.Search.LargestShardBytes = Current->DocGen->SearchIndexStats.LargestShardBytes;
+	LastReport.Index.Fragments = Current->DocGen->NumIndexFragments;
+	LastReport.Index.FragmentBytes = Current->DocGen->IndexFragmentBytes;
+	LastReport.Index.LargestFragmentBytes = Current->DocGen->LargestIndexFragmentBytes;
+	LastReport.IntermediateBytes = FKantanDocGenRunReport::GetDirectorySize(IntermediateDir);
+
+	if (!bFinalized)
 	{
 		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to finalize xml docs!"));
+		LastReport.AddFailures(TEXT("Finalize"), 1);
+		return;
+	}
+
+	if (Current->Task->Settings.bSkipConversion)
+	{
+		if (Current->Checkpoint.IsValid())
+		{
+			Current->Checkpoint->Discard();
+		}
+
+		UpdateProgress(EDocGenPhase::Succeeded, SuccessfulNodeCount, true);
+
+		if (Mode == EKantanDocGenerationMode::UI)
+		{
+			DocGenThreads::RunOnGameThread([this]
+				{
+					Current->Task->Notification->SetText(LOCTEXT("DocGenerationSuccessful", "Doc gen completed (xml only)"));
+					Current->Task->Notification->SetCompletionState(SNotificationItem::CS_Success);
+					Current->Task->Notification->ExpireAndFadeout();
+				});
+		}
 		return;
 	}
 
@@ -384,18 +784,85 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 			});
 	}
 
-	auto TransformationResult = ProcessIntermediateDocs(
-		IntermediateDir,
-		Current->Task->Settings.OutputDirectory.Path,
-		Current->Task->Settings.DocumentationTitle,
-		Current->Task->Settings.bCleanOutputDirectory
-	);
+	UpdateProgress(EDocGenPhase::Converting, SuccessfulNodeCount, true);
+
+	// Converted into a staging directory and swapped in, the published docs stay intact until then
+	const double ConvertStartTime = FPlatformTime::Seconds();
+	FDocGenStagedOutput StagedOutput(Current->Task->Settings.OutputDirectory.Path, Current->Task->Settings.DocumentationTitle);
+	const bool bJsonOutput = Current->Task->Settings.OutputFormat == EKantanDocGenOutputFormat::Json;
+	auto TransformationResult = EIntermediateProcessingResult::DiskWriteFailure;
+	if (StagedOutput.Begin())
+	{
+		if (bJsonOutput)
+		{
+			TransformationResult = AssembleViewerDocs(IntermediateDir, StagedOutput.GetStagingRoot() / Current->Task->Settings.DocumentationTitle);
+		}
+		else
+		{
+			TransformationResult = ProcessIntermediateDocs(
+				IntermediateDir,
+				StagedOutput.GetStagingRoot(),
+				Current->Task->Settings.DocumentationTitle,
+				true
+			);
+		}
+	}
+
+	// The conversion tool only knows about the xml, so the scripts the pages load are copied over before the swap
+	if (TransformationResult == EIntermediateProcessingResult::Success)
+	{
+		const FString DocsDir = StagedOutput.GetStagingRoot() / Current->Task->Settings.DocumentationTitle;
+		if (!bJsonOutput && !CopyIntermediateScripts(ScriptsDir, DocsDir))
+		{
+			TransformationResult = EIntermediateProcessingResult::DiskWriteFailure;
+		}
+
+		FKantanDocGenSettings const& Settings = Current->Task->Settings;
+		if (TransformationResult == EIntermediateProcessingResult::Success && (Settings.bMinifyOutput || Settings.bPrecompressOutput))
+		{
+			FDocGenOutputOptimizer Optimizer(DocsDir, Settings.bMinifyOutput, Settings.bPrecompressOutput);
+			if (!Optimizer.Optimize())
+			{
+				TransformationResult = EIntermediateProcessingResult::DiskWriteFailure;
+			}
+
+			LastReport.Optimize.bMinified = Settings.bMinifyOutput;
+			LastReport.Optimize.bPrecompressed = Settings.bPrecompressOutput;
+			LastReport.Optimize.Files = Optimizer.NumFiles;
+			LastReport.Optimize.MinifiedFiles = Optimizer.NumMinified;
+			LastReport.Optimize.MinifiedBytesBefore = Optimizer.MinifiedBytesBefore;
+			LastReport.Optimize.MinifiedBytesAfter = Optimizer.MinifiedBytesAfter;
+			LastReport.Optimize.CompressedFiles = Optimizer.NumCompressed;
+			LastReport.Optimize.CompressedBytes = Optimizer.CompressedBytes;
+			LastReport.Optimize.Seconds = Optimizer.OptimizeTime;
+		}
+
+		LastReport.Index.PageBytes = FMath::Max< int64 >(0, IFileManager::Get().FileSize(*(DocsDir / TEXT("index.html"))));
+		for (FNodeDocsGenerator::FClassPageStats const& ClassPage : Current->DocGen->LargestClassPages)
+		{
+			FKantanDocGenReportClassPage& Page = LastReport.LargestClassPages.AddDefaulted_GetRef();
+			Page.Id = ClassPage.Id;
+			Page.Nodes = ClassPage.NumNodes;
+			Page.PageBytes = FMath::Max< int64 >(0, IFileManager::Get().FileSize(*(DocsDir / ClassPage.Id / (ClassPage.Id + TEXT(".html")))));
+			Page.FunctionListBytes = ClassPage.FunctionListBytes;
+		}
+	}
+
+	if (TransformationResult == EIntermediateProcessingResult::Success && !StagedOutput.Commit())
+	{
+		TransformationResult = EIntermediateProcessingResult::DiskWriteFailure;
+	}
+	LastReport.Times.Convert = FPlatformTime::Seconds() - ConvertStartTime;
+	LastReport.OutputBytes = FKantanDocGenRunReport::GetDirectorySize(Current->Task->Settings.OutputDirectory.Path);
+	LastReport.OutputFiles = FKantanDocGenRunReport::GetDirectoryFileCount(Current->Task->Settings.OutputDirectory.Path);
+
 	if (TransformationResult != EIntermediateProcessingResult::Success)
 	{
+		LastReport.AddFailures(TEXT("Conversion"), 1);
 		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to transform xml to html!"));
 
 		auto Msg = FText::Format(LOCTEXT("DocConversionFailed", "Doc gen failed - {0}"),
-			TransformationResult == EIntermediateProcessingResult::DiskWriteFailure ? LOCTEXT("CouldNotWriteToOutput", "Could not write output, please clear output directory or enable 'Clean Output Directory' option") : LOCTEXT("GenericTransformationFailure", "Conversion failure")
+			TransformationResult == EIntermediateProcessingResult::DiskWriteFailure ? LOCTEXT("CouldNotWriteToOutput", "Could not write output, check the output directory isn't in use") : LOCTEXT("GenericTransformationFailure", "Conversion failure")
 		);
 
 		if (Mode == EKantanDocGenerationMode::UI)
@@ -411,6 +878,54 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 		return;
 	}
 
+	// Nothing left to resume
+	if (Current->Checkpoint.IsValid())
+	{
+		Current->Checkpoint->Discard();
+	}
+
+	// @NOTE: Should publishing fail, the docs are still there to publish again with -Publish alone.
+	if (!Current->Task->Settings.PublishPath.IsEmpty())
+	{
+		if (Mode == EKantanDocGenerationMode::UI)
+		{
+			DocGenThreads::RunOnGameThread([this]
+				{
+					Current->Task->Notification->SetText(LOCTEXT("DocPublishInProgress", "Publishing docs"));
+				});
+		}
+
+		FDocGenPublisher Publisher(Current->Task->Settings);
+		const bool bPublished = Publisher.Publish();
+
+		LastReport.Publish.Path = Current->Task->Settings.PublishPath;
+		LastReport.Publish.FilesCopied = Publisher.NumCopied;
+		LastReport.Publish.FilesDeleted = Publisher.NumDeleted;
+		LastReport.Publish.FilesUnchanged = Publisher.NumUnchanged;
+		LastReport.Publish.BytesCopied = Publisher.BytesCopied;
+		LastReport.Publish.Seconds = Publisher.PublishTime;
+
+		if (!bPublished)
+		{
+			LastReport.AddFailures(TEXT("Publish"), FMath::Max(Publisher.NumFailed, 1));
+			UE_LOG(LogKantanDocGen, Error, TEXT("Failed to publish docs to '%s'!"), *Current->Task->Settings.PublishPath);
+
+			if (Mode == EKantanDocGenerationMode::UI)
+			{
+				DocGenThreads::RunOnGameThread([this]
+					{
+						Current->Task->Notification->SetText(LOCTEXT("DocPublishFailed", "Doc gen failed - Could not publish"));
+						Current->Task->Notification->SetCompletionState(SNotificationItem::CS_Fail);
+						Current->Task->Notification->ExpireAndFadeout();
+						PLAY_FAIL_SOUND();
+					});
+			}
+			return;
+		}
+	}
+
+	UpdateProgress(EDocGenPhase::Succeeded, SuccessfulNodeCount, true);
+
 	if (Mode == EKantanDocGenerationMode::UI)
 	{
 		DocGenThreads::RunOnGameThread([this]
@@ -436,8 +951,317 @@ void FDocGenTaskProcessor::ProcessTask(TSharedPtr< FDocGenTask > InTask)
 	}
 }
 
+void FDocGenTaskProcessor::InitCheckpoint()
+{
+	auto const& Settings = Current->Task->Settings;
+	if (!Settings.bEnableCheckpoints)
+	{
+		return;
+	}
+
+	TArray< FName > AllModules;
+	Current->Task->ModulePluginNameAndDesc.GenerateKeyArray(AllModules);
+
+	Current->Checkpoint = MakeUnique< FDocGenCheckpoint >(Settings.DocumentationTitle, FDocGenCheckpoint::ComputeSettingsHash(Settings, AllModules));
+	Current->LastCheckpointTime = FPlatformTime::Seconds();
+
+	if (!Settings.bResumeFromCheckpoint)
+	{
+		Current->Checkpoint->Discard();
+		return;
+	}
+
+	Current->bResumed = Current->Checkpoint->Load(Current->CheckpointState);
+	if (Current->bResumed)
+	{
+		Current->ResumedPaths.Append(Current->CheckpointState.ProcessedPaths);
+		UE_LOG(LogKantanDocGen, Display, TEXT("Resuming from checkpoint: %i objects and %i classes already documented."),
+			Current->CheckpointState.ProcessedPaths.Num(), Current->CheckpointState.Classes.Num());
+	}
+	else
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("No usable checkpoint to resume from, starting over."));
+	}
+
+	// If we went down part way through a node last time, its spawner gets the blame
+	FGuid CrashedSpawner;
+	if (Current->Checkpoint->GetCrashedSpawner(CrashedSpawner))
+	{
+		int32& NumCrashes = Current->CheckpointState.SpawnerCrashCounts.FindOrAdd(CrashedSpawner);
+		++NumCrashes;
+
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Previous run crashed while documenting spawner %s (%i times)%s."), *CrashedSpawner.ToString(), NumCrashes,
+			NumCrashes >= FDocGenCheckpoint::MaxSpawnerCrashes ? TEXT(", it will be skipped") : TEXT(""));
+
+		// Persisted right away, in case it happens again before the next checkpoint
+		Current->Checkpoint->Save(Current->CheckpointState);
+	}
+}
+
+void FDocGenTaskProcessor::SaveCheckpoint()
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_SaveCheckpoint);
+
+	auto& State = Current->CheckpointState;
+	State.EnumeratorIndex = Current->EnumeratorIndex;
+	State.EnumeratorPosition = Current->CurrentEnumerator.IsValid() ? Current->CurrentEnumerator->GetPosition() : 0;
+	State.EnumeratorSize = Current->CurrentEnumerator.IsValid() ? Current->CurrentEnumerator->EstimatedSize() : 0;
+	Current->DocGen->GetClassDocRecords(State.Classes);
+
+	if (!Current->Checkpoint->Save(State))
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to save checkpoint."));
+	}
+
+	Current->LastCheckpointTime = FPlatformTime::Seconds();
+}
+
+FDocGenProgress FDocGenTaskProcessor::GetProgress() const
+{
+	FScopeLock Lock(&ProgressLock);
+	return Progress;
+}
+
+void FDocGenTaskProcessor::GatherRunReport(int32 NumNodes)
+{
+	auto& Report = LastReport;
+	Report.bResumed = Current->bResumed;
+	Report.Times.Prepass = Current->PrepassTime;
+
+	auto const& DocGen = *Current->DocGen;
+	Report.Counts.Objects = Current->NumEnumeratedObjects;
+	Report.Counts.Nodes = NumNodes + Current->NumResumedNodes;
+	Report.Counts.ResumedNodes = Current->NumResumedNodes;
+	Report.Counts.TemplateNodes = DocGen.NumTemplateNodes;
+	Report.Counts.InvokedNodes = DocGen.NumInvokedNodes;
+	Report.Counts.Classes = DocGen.GetNumClassDocs();
+	Report.Counts.Images = DocGen.NumImagesWritten;
+
+	Report.AddFailures(TEXT("Spawn"), DocGen.NumSpawnFailures);
+	Report.AddFailures(TEXT("NodeImage"), Current->NumImageFailures);
+	Report.AddFailures(TEXT("NodeDocs"), Current->NumDocsFailures);
+	Report.AddFailures(TEXT("Quarantined"), Current->NumQuarantinedNodes);
+
+	Report.PeakMemoryMB = FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0);
+
+	auto const ClassStats = Current->DocGen->GetNameCache().GetClassDisplayNameStats();
+	auto const PinTypeStats = Current->DocGen->GetNameCache().GetPinTypeTextStats();
+	Report.Caches.ClassNameHits = ClassStats.Hits;
+	Report.Caches.ClassNameMisses = ClassStats.Misses;
+	Report.Caches.PinTypeHits = PinTypeStats.Hits;
+	Report.Caches.PinTypeMisses = PinTypeStats.Misses;
+	if (Current->SourceIndex.IsValid())
+	{
+		Report.Caches.SourceIndexScannedModules = Current->SourceIndex->NumScannedModules;
+		Report.Caches.SourceIndexCachedModules = Current->SourceIndex->NumCachedModules;
+	}
+}
+
+void FDocGenTaskProcessor::WriteRunReport(FKantanDocGenSettings const& Settings)
+{
+	if (!Settings.BaselinePath.IsEmpty())
+	{
+		LastReport.CompareToBaseline(Settings.BaselinePath, Settings.MaxSlowdownPercent, Settings.MaxNodeLossPercent);
+		for (FString const& Violation : LastReport.Baseline.Violations)
+		{
+			UE_LOG(LogKantanDocGen, Error, TEXT("Regression against baseline: %s"), *Violation);
+		}
+	}
+
+	LastExitCode = !LastReport.bSucceeded ? 1 : (!LastReport.Baseline.bPassed ? 2 : 0);
+
+	const FString ReportPath = !Settings.ReportPath.IsEmpty() ? Settings.ReportPath
+		: FPaths::ProjectSavedDir() / TEXT("KantanDocGenReports") / (Settings.DocumentationTitle + TEXT(".json"));
+	if (LastReport.SaveToFile(ReportPath))
+	{
+		UE_LOG(LogKantanDocGen, Display, TEXT("Run report written to '%s'."), *ReportPath);
+	}
+	else
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to write run report '%s'."), *ReportPath);
+	}
+}
+
+float FDocGenTaskProcessor::EstimateEnumerationProgress() const
+{
+	if (Current->EnumerationSize <= 0)
+	{
+		return Current->Enumerators.IsEmpty() && !Current->CurrentEnumerator.IsValid() ? 1.0f : 0.0f;
+	}
+
+	float Done = (float)Current->CompletedEnumerationSize;
+	if (Current->CurrentEnumerator.IsValid())
+	{
+		Done += Current->CurrentEnumerator->EstimateProgress() * Current->CurrentEnumerator->EstimatedSize();
+	}
+
+	return FMath::Clamp(Done / Current->EnumerationSize, 0.0f, 1.0f);
+}
+
+void FDocGenTaskProcessor::UpdateProgress(EDocGenPhase Phase, int32 NumNodes, bool bForce)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (!bForce && Now - Current->LastProgressTime < DocGenProgress::UpdateInterval)
+	{
+		return;
+	}
+	Current->LastProgressTime = Now;
+
+	const EDocGenPhase PrevPhase = GetProgress().Phase;
+	if (Phase != PrevPhase)
+	{
+		TRACE_BOOKMARK(TEXT("KantanDocGen: %s"), LexToString(Phase));
+	}
+
+	FDocGenProgress NewProgress;
+	NewProgress.Phase = Phase;
+	NewProgress.Fraction = Phase >= EDocGenPhase::Finalizing ? 1.0f : (Phase == EDocGenPhase::Enumerating ? EstimateEnumerationProgress() : 0.0f);
+	NewProgress.NumObjects = Current->NumEnumeratedObjects;
+	NewProgress.NumNodes = NumNodes;
+	NewProgress.ElapsedSeconds = Now - Current->StartTime;
+
+	if (Current->EnumerateStartTime > 0.0)
+	{
+		// Rates are from when enumeration started, so they aren't skewed by the prepass or by work a resumed run skipped
+		const double EnumerateElapsed = Now - Current->EnumerateStartTime;
+		const float Progressed = NewProgress.Fraction - Current->EnumerateStartFraction;
+		NewProgress.NodesPerSecond = EnumerateElapsed > 0.0 ? NumNodes / EnumerateElapsed : 0.0;
+		NewProgress.EtaSeconds = Progressed > 0.001f ? EnumerateElapsed * (1.0f - NewProgress.Fraction) / Progressed : -1.0;
+	}
+
+	NewProgress.EnumerateTime = Current->EnumerateObjectTime;
+	NewProgress.GarbageCollectTime = Current->GarbageCollectTime;
+	if (Current->DocGen.IsValid())
+	{
+		NewProgress.SpawnTime = Current->DocGen->SpawnTemplateNodeTime + Current->DocGen->SpawnInvokedNodeTime;
+		NewProgress.ImageTime = Current->DocGen->GenerateNodeImageTime;
+		NewProgress.DocsTime = Current->DocGen->GenerateNodeDocsTime;
+
+		auto const ClassStats = Current->DocGen->GetNameCache().GetClassDisplayNameStats();
+		auto const PinTypeStats = Current->DocGen->GetNameCache().GetPinTypeTextStats();
+		TRACE_COUNTER_SET(KantanDocGen_NameCacheHits, ClassStats.Hits + PinTypeStats.Hits);
+		TRACE_COUNTER_SET(KantanDocGen_NameCacheMisses, ClassStats.Misses + PinTypeStats.Misses);
+	}
+
+	{
+		FScopeLock Lock(&ProgressLock);
+		Progress = NewProgress;
+	}
+
+	// The notification covers the UI, nobody's watching the log there
+	if (Mode == EKantanDocGenerationMode::ExecCommand && (bForce || Now - Current->LastProgressLogTime >= DocGenProgress::LogInterval))
+	{
+		Current->LastProgressLogTime = Now;
+
+		UE_LOG(LogKantanDocGen, Display, TEXT("Progress: %.0f%%, %i objects, %i nodes (%.1f nodes/s), elapsed %s, ETA %s. Enumerate %.1fs, spawn %.1fs, image %.1fs, docs %.1fs, GC %.1fs."),
+			NewProgress.Fraction * 100.0f, NewProgress.NumObjects, NewProgress.NumNodes, NewProgress.NodesPerSecond,
+			*FTimespan::FromSeconds(NewProgress.ElapsedSeconds).ToString(TEXT("%h:%m:%s")),
+			NewProgress.EtaSeconds >= 0.0 ? *FTimespan::FromSeconds(NewProgress.EtaSeconds).ToString(TEXT("%h:%m:%s")) : TEXT("unknown"),
+			NewProgress.EnumerateTime, NewProgress.SpawnTime, NewProgress.ImageTime, NewProgress.DocsTime, NewProgress.GarbageCollectTime);
+	}
+}
+
+FText FDocGenTaskProcessor::GetProgressText() const
+{
+	const FDocGenProgress Snapshot = GetProgress();
+	if (Snapshot.Phase != EDocGenPhase::Enumerating)
+	{
+		return LOCTEXT("DocGenInProgress", "Doc gen in progress");
+	}
+
+	FFormatNamedArguments Args;
+	Args.Add(TEXT("Percent"), FText::AsPercent(Snapshot.Fraction));
+	Args.Add(TEXT("NodesPerSecond"), FText::AsNumber(FMath::RoundToInt(Snapshot.NodesPerSecond)));
+	Args.Add(TEXT("Eta"), Snapshot.EtaSeconds >= 0.0 ? FText::AsTimespan(FTimespan::FromSeconds(Snapshot.EtaSeconds)) : LOCTEXT("DocGenEtaUnknown", "--"));
+	return FText::Format(LOCTEXT("DocGenProgress", "Doc gen {Percent} ({NodesPerSecond} nodes/s, {Eta} left)"), Args);
+}
+
+FString FDocGenTaskProcessor::GetIntermediateDir(FString const& DocTitle)
+{
+	return FPaths::ProjectIntermediateDir() / TEXT("KantanDocGen") / DocTitle;
+}
+
+FString FDocGenTaskProcessor::GetIntermediateScriptsDir(FString const& DocTitle)
+{
+	return GetIntermediateDir(DocTitle) + TEXT(".scripts");
+}
+
+bool FDocGenTaskProcessor::CopyIntermediateScripts(FString const& ScriptsDir, FString const& DocsDir)
+{
+	// Everything in the scripts dir goes into the docs as is
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (PlatformFile.DirectoryExists(*ScriptsDir) && !PlatformFile.CopyDirectoryTree(*DocsDir, *ScriptsDir, true))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to copy '%s' into the docs."), *ScriptsDir);
+		return false;
+	}
+
+	return true;
+}
+
+FDocGenTaskProcessor::EIntermediateProcessingResult FDocGenTaskProcessor::AssembleViewerDocs(FString const& IntermediateDir, FString const& DocsDir)
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_AssembleViewer);
+
+	auto Plugin = IPluginManager::Get().FindPlugin(TEXT("KantanDocGen"));
+	if (!Plugin.IsValid())
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to locate plugin info"));
+		return EIntermediateProcessingResult::UnknownError;
+	}
+
+	const FString ToolDir = Plugin->GetBaseDir() / TEXT("ThirdParty") / TEXT("KantanDocGenTool");
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.CreateDirectoryTree(*(DocsDir / TEXT("css"))))
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to create '%s'."), *DocsDir);
+		return EIntermediateProcessingResult::DiskWriteFailure;
+	}
+
+	// The viewer page and its script, sharing the html output's stylesheet
+	const TPair< FString, FString > ViewerFiles[] = {
+		{ ToolDir / TEXT("viewer") / TEXT("index.html"), DocsDir / TEXT("index.html") },
+		{ ToolDir / TEXT("viewer") / TEXT("viewer.js"), DocsDir / TEXT("viewer.js") },
+		{ ToolDir / TEXT("css") / TEXT("bpdoc.css"), DocsDir / TEXT("css") / TEXT("bpdoc.css") },
+		{ ToolDir / TEXT("css") / TEXT("timing.js"), DocsDir / TEXT("css") / TEXT("timing.js") },
+	};
+	for (auto const& File : ViewerFiles)
+	{
+		if (!PlatformFile.CopyFile(*File.Value, *File.Key))
+		{
+			UE_LOG(LogKantanDocGen, Error, TEXT("Failed to copy '%s' into the docs."), *File.Key);
+			return EIntermediateProcessingResult::DiskWriteFailure;
+		}
+	}
+
+	// The data, and each class's node images, which are the only other things in the intermediate dir in json output
+	TArray< FString > Sources;
+	Sources.Add(FNodeDocsGenerator::ViewerDataDirName);
+	PlatformFile.IterateDirectory(*IntermediateDir, [&PlatformFile, &Sources](const TCHAR* FilenameOrDirectory, bool bIsDirectory)
+		{
+			if (bIsDirectory && PlatformFile.DirectoryExists(*(FString(FilenameOrDirectory) / TEXT("img"))))
+			{
+				Sources.Add(FPaths::GetCleanFilename(FilenameOrDirectory) / TEXT("img"));
+			}
+			return true;
+		});
+
+	for (FString const& Source : Sources)
+	{
+		if (!PlatformFile.CopyDirectoryTree(*(DocsDir / Source), *(IntermediateDir / Source), true))
+		{
+			UE_LOG(LogKantanDocGen, Error, TEXT("Failed to copy '%s' into the docs."), *(IntermediateDir / Source));
+			return EIntermediateProcessingResult::DiskWriteFailure;
+		}
+	}
+
+	return EIntermediateProcessingResult::Success;
+}
+
 FDocGenTaskProcessor::EIntermediateProcessingResult FDocGenTaskProcessor::ProcessIntermediateDocs(FString const& IntermediateDir, FString const& OutputDir, FString const& DocTitle, bool bCleanOutput)
 {
+	DOCGEN_TRACE_SCOPE(KantanDocGen_ConvertDocs);
+
 	auto& PluginManager = IPluginManager::Get();
 	auto Plugin = PluginManager.FindPlugin(TEXT("KantanDocGen"));
 	if (!Plugin.IsValid())
@@ -7,9 +7,12 @@
 #pragma once
 
 #include "DocGenSettings.h"
+#include "DocGenCheckpoint.h"
+#include "DocGenRunReport.h"
 
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
+#include "HAL/CriticalSection.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 #include "Containers/Queue.h"
 #include "CoreMinimal.h"
@@ -17,8 +20,14 @@
 
 class ISourceObjectEnumerator;
 class FNodeDocsGenerator;
+class FReflectionDocsGenerator;
+class FNativeTypeIndex;
+class FDocGenClassFilter;
+class FDocGenSourceIndex;
+class FBlueprintActionSnapshot;
 
 class UBlueprintNodeSpawner;
+class UK2Node;
 
 enum class EKantanDocGenerationMode : uint8
 {
@@ -26,6 +35,53 @@ enum class EKantanDocGenerationMode : uint8
 	ExecCommand
 };
 
+enum class EDocGenPhase : uint8
+{
+	Idle,
+	Preparing,
+	Enumerating,
+	Finalizing,
+	Converting,
+	Succeeded,
+	Failed
+};
+
+inline const TCHAR* LexToString(EDocGenPhase Phase)
+{
+	switch (Phase)
+	{
+	case EDocGenPhase::Idle:		return TEXT("Idle");
+	case EDocGenPhase::Preparing:	return TEXT("Preparing");
+	case EDocGenPhase::Enumerating:	return TEXT("Enumerating");
+	case EDocGenPhase::Finalizing:	return TEXT("Finalizing");
+	case EDocGenPhase::Converting:	return TEXT("Converting");
+	case EDocGenPhase::Succeeded:	return TEXT("Succeeded");
+	case EDocGenPhase::Failed:		return TEXT("Failed");
+	default:						return TEXT("Unknown");
+	}
+}
+
+// Snapshot of the progress of the task being processed
+struct FDocGenProgress
+{
+	EDocGenPhase Phase = EDocGenPhase::Idle;
+	// Estimated fraction of the objects to document which are done. Doesn't cover finalizing or conversion.
+	float Fraction = 0.0f;
+	int32 NumObjects = 0;
+	int32 NumNodes = 0;
+	double ElapsedSeconds = 0.0;
+	double NodesPerSecond = 0.0;
+	// Estimated time to finish enumerating, negative if we can't tell yet
+	double EtaSeconds = -1.0;
+
+	// Time split between the phases of documenting nodes, in seconds
+	double EnumerateTime = 0.0;
+	double SpawnTime = 0.0;
+	double ImageTime = 0.0;
+	double DocsTime = 0.0;
+	double GarbageCollectTime = 0.0;
+};
+
 class FDocGenTaskProcessor : public FRunnable
 {
 public:
@@ -34,6 +90,16 @@ public:
 public:
 	void QueueTask(FKantanDocGenSettings const& Settings, EKantanDocGenerationMode InMode);
 	bool IsRunning() const;
+	// Callable from any thread
+	FDocGenProgress GetProgress() const;
+	int32 GetLastExitCode() const { return LastExitCode; }
+	// Only safe to read once the processor has stopped
+	FKantanDocGenRunReport const& GetLastReport() const { return LastReport; }
+	// Where the xml and images are written before conversion
+	static FString GetIntermediateDir(FString const& DocTitle);
+	// Where the scripts the pages load are written. Outside the intermediate dir, which the conversion tool treats
+	// as a directory per class.
+	static FString GetIntermediateScriptsDir(FString const& DocTitle);
 
 public:
 	virtual bool Init() override;
@@ -53,15 +119,63 @@ protected:
 	{
 		TSharedPtr< FDocGenTask > Task;
 
+		TSharedPtr< const FNativeTypeIndex > TypeIndex;
+		TSharedPtr< const FDocGenSourceIndex > SourceIndex;
 		TQueue< TSharedPtr< ISourceObjectEnumerator > > Enumerators;
-		TSet< FName > Excluded;
+		// Index of the current enumerator, counting any skipped on resume
+		int32 EnumeratorIndex = INDEX_NONE;
+		int32 NumEnumerators = 0;
+		// Sum of the enumerators' estimated sizes, and of those finished with
+		int32 EnumerationSize = 0;
+		int32 CompletedEnumerationSize = 0;
+		TSharedPtr< const FDocGenClassFilter > ClassFilter;
 		TSet< TWeakObjectPtr< UObject > > Processed;
 
+		TUniquePtr< FBlueprintActionSnapshot > Actions;
+
 		TSharedPtr< ISourceObjectEnumerator > CurrentEnumerator;
 		TWeakObjectPtr< UObject > SourceObject;
-		TQueue< TWeakObjectPtr< UBlueprintNodeSpawner > > CurrentSpawners;
+		// Range of the action snapshot's spawner array still to be processed for the current source object
+		int32 CurrentSpawnerIndex = 0;
+		int32 CurrentSpawnerEnd = 0;
+		// Last node returned for documenting, released on the next game thread visit
+		UK2Node* PendingReleaseNode = nullptr;
+
+		// Game thread time spent selecting the next object, for reporting
+		double EnumerateObjectTime = 0.0;
+		int32 NumEnumeratedObjects = 0;
+
+		// Memory management, for reporting
+		double GarbageCollectTime = 0.0;
+		int32 NumGarbageCollects = 0;
+		int32 NumGraphRecycles = 0;
+		int32 NumNodesSinceCollect = 0;
+		// Raised above the configured ceiling if collecting garbage can't get us back under it
+		uint64 MemoryCeilingBytes = 0;
+
+		// Null if checkpoints are disabled. The state is kept up to date as we go, other than the cursor and class records.
+		TUniquePtr< FDocGenCheckpoint > Checkpoint;
+		FDocGenCheckpoint::FState CheckpointState;
+		bool bResumed = false;
+		TSet< FString > ResumedPaths;
+		double LastCheckpointTime = 0.0;
+		int32 NumResumedNodes = 0;
+		int32 NumQuarantinedNodes = 0;
+
+		// For the run report
+		double PrepassTime = 0.0;
+		int32 NumImageFailures = 0;
+		int32 NumDocsFailures = 0;
+
+		// Progress reporting. Start fraction is non-zero when resuming.
+		double StartTime = 0.0;
+		double EnumerateStartTime = 0.0;
+		float EnumerateStartFraction = 0.0f;
+		double LastProgressTime = 0.0;
+		double LastProgressLogTime = 0.0;
 
 		TUniquePtr< FNodeDocsGenerator > DocGen;
+		TUniquePtr< FReflectionDocsGenerator > ReflectionDocs;
 	};
 
 	struct FDocGenOutputTask
@@ -72,6 +186,15 @@ protected:
 protected:
 	TMap<FName, TPair<FString, FString>> GenerateModulePluginNameAndDesc(FKantanDocGenSettings const& Settings);
 	void ProcessTask(TSharedPtr< FDocGenTask > InTask);
+	void InitCheckpoint();
+	void SaveCheckpoint();
+	float EstimateEnumerationProgress() const;
+	// Throttled unless forced. Logs periodically when running from the command line.
+	void UpdateProgress(EDocGenPhase Phase, int32 NumNodes, bool bForce = false);
+	FText GetProgressText() const;
+	// Copies the run's stats so far into the report
+	void GatherRunReport(int32 NumNodes);
+	void WriteRunReport(FKantanDocGenSettings const& Settings);
 
 	enum EIntermediateProcessingResult : uint8 {
 		Success,
@@ -81,6 +204,10 @@ protected:
 	};
 
 	EIntermediateProcessingResult ProcessIntermediateDocs(FString const& IntermediateDir, FString const& OutputDir, FString const& DocTitle, bool bCleanOutput);
+	// Copies the index fragments, function lists and search index, which the conversion tool doesn't know about, into the converted docs
+	static bool CopyIntermediateScripts(FString const& ScriptsDir, FString const& DocsDir);
+	// Json output has nothing to convert, the docs are the viewer page plus the data and images from the intermediate dir
+	static EIntermediateProcessingResult AssembleViewerDocs(FString const& IntermediateDir, FString const& DocsDir);
 
 protected:
 	EKantanDocGenerationMode Mode = EKantanDocGenerationMode::UI;
@@ -89,6 +216,12 @@ protected:
 	TUniquePtr< FDocGenCurrentTask > Current;
 	TQueue< TSharedPtr< FDocGenOutputTask > > Converting;
 
+	FKantanDocGenRunReport LastReport;
+	int32 LastExitCode = 0;
+
+	mutable FCriticalSection ProgressLock;
+	FDocGenProgress Progress;
+
 	FThreadSafeBool bRunning;	// @NOTE: Using this to sync with module calls from game thread is not 100% okay (we're not atomically testing), but whatevs.
 	FThreadSafeBool bTerminationRequest;
 };
@@ -0,0 +1,40 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "HAL/FileManager.h"
+
+
+/*
+Insights instrumentation. Capture with -trace=cpu,counters,bookmark,kantandocgen (or enable the channel at runtime
+with 'Trace.Enable KantanDocGen'). Scopes cost a single channel check when the channel is off.
+*/
+UE_TRACE_CHANNEL_EXTERN(KantanDocGenChannel);
+
+#define DOCGEN_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, KantanDocGenChannel)
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(KantanDocGen_Objects);
+TRACE_DECLARE_INT_COUNTER_EXTERN(KantanDocGen_Nodes);
+TRACE_DECLARE_INT_COUNTER_EXTERN(KantanDocGen_Images);
+TRACE_DECLARE_INT_COUNTER_EXTERN(KantanDocGen_BytesWritten);
+TRACE_DECLARE_INT_COUNTER_EXTERN(KantanDocGen_NameCacheHits);
+TRACE_DECLARE_INT_COUNTER_EXTERN(KantanDocGen_NameCacheMisses);
+
+// Sizes of written files aren't otherwise known, so they're only looked up while we're being traced
+#define DOCGEN_TRACE_FILE_WRITTEN(Path) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(KantanDocGenChannel)) \
+		{ \
+			TRACE_COUNTER_ADD(KantanDocGen_BytesWritten, IFileManager::Get().FileSize(*(Path))); \
+		} \
+	} while (0)
+
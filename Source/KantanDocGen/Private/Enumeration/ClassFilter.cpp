@@ -0,0 +1,237 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "ClassFilter.h"
+#include "KantanDocGenLog.h"
+#include "DocGenSettings.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+
+FDocGenClassFilter::FDocGenClassFilter(FKantanDocGenSettings const& Settings,
+	const TMap<FName, TPair<FString, FString>>& InModulePluginNameAndDesc)
+{
+	check(IsInGameThread());
+
+	for (auto const& Entry : InModulePluginNameAndDesc)
+	{
+		ModuleToPlugin.Add(Entry.Key, Entry.Value.Key);
+	}
+
+	// @NOTE: Dropping an invalid include rule could leave no include rules at all, which lets everything through.
+	// So invalid rules are never dropped, the filter is marked invalid and the task fails instead.
+	auto ParseRules = [this](TArray< FName > const& Entries, TArray< FRule >& OutRules)
+		{
+			for (FName const& Entry : Entries)
+			{
+				FRule Rule;
+				if (ParseRule(Entry.ToString(), Rule))
+				{
+					OutRules.Add(MoveTemp(Rule));
+				}
+				else
+				{
+					UE_LOG(LogKantanDocGen, Error, TEXT("Invalid class filter rule '%s'."), *Entry.ToString());
+					++NumInvalidRules;
+				}
+			}
+		};
+
+	ParseRules(Settings.SpecificClasses, IncludeRules);
+	ParseRules(Settings.ExcludedClasses, ExcludeRules);
+}
+
+bool FDocGenClassFilter::ParseRule(FString const& Entry, FRule& OutRule)
+{
+	FString Rule = Entry.TrimStartAndEnd();
+	if (Rule.IsEmpty())
+	{
+		return false;
+	}
+
+	FString Scope, Value;
+	if (!Rule.Split(TEXT(":"), &Scope, &Value))
+	{
+		OutRule.Kind = ERuleKind::Name;
+		OutRule.Pattern = Rule;
+		return true;
+	}
+
+	Value.TrimStartAndEndInline();
+	if (Value.IsEmpty())
+	{
+		return false;
+	}
+
+	if (Scope.Equals(TEXT("Module"), ESearchCase::IgnoreCase) || Scope.Equals(TEXT("Plugin"), ESearchCase::IgnoreCase))
+	{
+		OutRule.Kind = Scope.Equals(TEXT("Module"), ESearchCase::IgnoreCase) ? ERuleKind::Module : ERuleKind::Plugin;
+		if (!Value.Split(TEXT("/"), &OutRule.ScopePattern, &OutRule.Pattern))
+		{
+			OutRule.ScopePattern = Value;
+			OutRule.Pattern = TEXT("*");
+		}
+		return true;
+	}
+
+	if (Scope.Equals(TEXT("Child"), ESearchCase::IgnoreCase))
+	{
+		OutRule.Kind = ERuleKind::Child;
+		OutRule.Pattern = Value;
+
+		UClass* ParentClass = FindFirstObject< UClass >(*Value, EFindFirstObjectOptions::NativeFirst);
+		if (ParentClass == nullptr && Value.Len() > 1)
+		{
+			// Allow the C++ name, eg. 'UGameplayAbility' or 'AActor'
+			ParentClass = FindFirstObject< UClass >(*Value.Mid(1), EFindFirstObjectOptions::NativeFirst);
+		}
+
+		if (ParentClass == nullptr)
+		{
+			UE_LOG(LogKantanDocGen, Error, TEXT("Class filter rule '%s': class not found."), *Entry);
+			return false;
+		}
+
+		OutRule.ParentClass = ParentClass;
+		return true;
+	}
+
+	return false;
+}
+
+bool FDocGenClassFilter::MatchesPattern(FString const& Value, FString const& Pattern)
+{
+	int32 WildcardIdx;
+	if (Pattern.FindChar(TEXT('*'), WildcardIdx) || Pattern.FindChar(TEXT('?'), WildcardIdx))
+	{
+		return Value.MatchesWildcard(Pattern, ESearchCase::IgnoreCase);
+	}
+
+	return Value.Equals(Pattern, ESearchCase::IgnoreCase);
+}
+
+bool FDocGenClassFilter::MatchesName(UField* Type, FString const& Pattern)
+{
+	const FString Name = Type->GetName();
+	if (MatchesPattern(Name, Pattern))
+	{
+		return true;
+	}
+
+	if (auto Struct = Cast< UStruct >(Type))
+	{
+		return MatchesPattern(Struct->GetPrefixCPP() + Name, Pattern);
+	}
+
+	return false;
+}
+
+template < typename TPredicate >
+bool FDocGenClassFilter::Evaluate(TPredicate&& Matches) const
+{
+	bool bPasses = IncludeRules.Num() == 0 || IncludeRules.ContainsByPredicate(Matches);
+	if (bPasses && ExcludeRules.ContainsByPredicate(Matches))
+	{
+		bPasses = false;
+	}
+
+	return bPasses;
+}
+
+bool FDocGenClassFilter::PassesFilter(UField* Type, FName const& ModuleName) const
+{
+	if (IsEmpty())
+	{
+		return true;
+	}
+
+	const bool bPasses = Evaluate([&](FRule const& Rule)
+		{
+			return MatchesRule(Rule, Type, ModuleName);
+		});
+
+	// Only classes count towards the pruned total, structs and enums are filtered for consistency but are cheap
+	if (!bPasses && Type->IsA< UClass >())
+	{
+		NumPruned.Increment();
+	}
+
+	return bPasses;
+}
+
+bool FDocGenClassFilter::PassesFilter(FAssetData const& BlueprintAsset) const
+{
+	if (IsEmpty())
+	{
+		return true;
+	}
+
+	// Resolve the native parent from the asset registry tags, so we don't need to load the blueprint to test it
+	UClass* NativeParent = nullptr;
+	FString NativeParentPath;
+	if (BlueprintAsset.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentPath))
+	{
+		const FSoftObjectPath NativeParentObjectPath(FPackageName::ExportTextPathToObjectPath(NativeParentPath));
+		NativeParent = Cast< UClass >(NativeParentObjectPath.ResolveObject());
+	}
+
+	const bool bPasses = Evaluate([&](FRule const& Rule)
+		{
+			return MatchesRule(Rule, BlueprintAsset, NativeParent);
+		});
+
+	if (!bPasses)
+	{
+		NumPruned.Increment();
+	}
+
+	return bPasses;
+}
+
+bool FDocGenClassFilter::MatchesRule(FRule const& Rule, UField* Type, FName const& ModuleName) const
+{
+	switch (Rule.Kind)
+	{
+	case ERuleKind::Name:
+		return MatchesName(Type, Rule.Pattern);
+
+	case ERuleKind::Module:
+		return MatchesPattern(ModuleName.ToString(), Rule.ScopePattern) && MatchesName(Type, Rule.Pattern);
+
+	case ERuleKind::Plugin:
+	{
+		const FString* PluginName = ModuleToPlugin.Find(ModuleName);
+		return PluginName && MatchesPattern(*PluginName, Rule.ScopePattern) && MatchesName(Type, Rule.Pattern);
+	}
+
+	case ERuleKind::Child:
+	{
+		const UClass* Class = Cast< UClass >(Type);
+		return Class && Rule.ParentClass.IsValid() && Class->IsChildOf(Rule.ParentClass.Get());
+	}
+
+	default:
+		return false;
+	}
+}
+
+bool FDocGenClassFilter::MatchesRule(FRule const& Rule, FAssetData const& BlueprintAsset, UClass* NativeParent) const
+{
+	switch (Rule.Kind)
+	{
+	case ERuleKind::Name:
+		return MatchesPattern(BlueprintAsset.AssetName.ToString(), Rule.Pattern);
+
+	case ERuleKind::Child:
+		return NativeParent && Rule.ParentClass.IsValid() && NativeParent->IsChildOf(Rule.ParentClass.Get());
+
+	// Content has no module or plugin
+	default:
+		return false;
+	}
+}
@@ -0,0 +1,85 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+
+class UClass;
+class UField;
+struct FAssetData;
+struct FKantanDocGenSettings;
+
+/*
+Include/exclude filter built from FKantanDocGenSettings::SpecificClasses and ExcludedClasses, applied by the
+enumerators during their prepass so that filtered out classes never reach the game thread spawning stage.
+
+Each entry is one rule:
+	Name				Exact class name, with or without its prefix (eg. 'Actor' or 'AActor'). Blueprints match on asset name.
+	Na*e				As above, with '*' and '?' wildcards.
+	Module:Pattern		Any class in a module whose name matches Pattern. May be followed by '/ClassPattern'.
+	Plugin:Pattern		Any class in a module of a plugin whose name matches Pattern. May be followed by '/ClassPattern'.
+	Child:Name			The named class and everything deriving from it. Blueprints match on their native parent class.
+
+If there are any include rules, a class must match at least one of them. A class matching any exclude rule is
+always filtered out. A rule which can't be parsed (or a Child: rule naming a class that isn't loaded) makes the
+filter invalid, and generation fails rather than documenting more or less than was asked for.
+*/
+class FDocGenClassFilter
+{
+public:
+	/** Callable only from game thread */
+	FDocGenClassFilter(FKantanDocGenSettings const& Settings,
+		const TMap<FName, TPair<FString, FString>>& InModulePluginNameAndDesc);
+
+	// Native classes, structs and enums. Only classes which fail count as pruned.
+	bool PassesFilter(UField* Type, FName const& ModuleName) const;
+	bool PassesFilter(FAssetData const& BlueprintAsset) const;
+	/**/
+
+	bool IsEmpty() const { return IncludeRules.Num() == 0 && ExcludeRules.Num() == 0; }
+	bool IsValid() const { return NumInvalidRules == 0; }
+	int32 GetNumInvalidRules() const { return NumInvalidRules; }
+	int32 GetNumPruned() const { return NumPruned.GetValue(); }
+
+protected:
+	enum class ERuleKind : uint8
+	{
+		Name,
+		Module,
+		Plugin,
+		Child,
+	};
+
+	struct FRule
+	{
+		ERuleKind Kind = ERuleKind::Name;
+		FString ScopePattern;
+		FString Pattern;
+		TWeakObjectPtr< UClass > ParentClass;
+	};
+
+	static bool ParseRule(FString const& Entry, FRule& OutRule);
+	static bool MatchesPattern(FString const& Value, FString const& Pattern);
+	static bool MatchesName(UField* Type, FString const& Pattern);
+
+	bool MatchesRule(FRule const& Rule, UField* Type, FName const& ModuleName) const;
+	bool MatchesRule(FRule const& Rule, FAssetData const& BlueprintAsset, UClass* NativeParent) const;
+
+	template < typename TPredicate >
+	bool Evaluate(TPredicate&& Matches) const;
+
+protected:
+	TArray< FRule > IncludeRules;
+	TArray< FRule > ExcludeRules;
+	TMap< FName, FString > ModuleToPlugin;
+	int32 NumInvalidRules = 0;
+
+	mutable FThreadSafeCounter NumPruned;
+};
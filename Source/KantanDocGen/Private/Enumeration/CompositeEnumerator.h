@@ -13,15 +13,18 @@ template < typename TChildEnum >
 class FCompositeEnumerator: public ISourceObjectEnumerator
 {
 public:
+	// Any additional arguments are passed on to the constructor of every child enumerator
+	template < typename... TChildArgs >
 	FCompositeEnumerator(
-		TArray< FName > const& InNames
+		TArray< FName > const& InNames,
+		TChildArgs const&... ChildArgs
 	)
 	{
 		CurEnumIndex = 0;
 		TotalSize = 0;
 		Completed = 0;
 
-		Prepass(InNames);
+		Prepass(InNames, ChildArgs...);
 	}
 
 public:
@@ -47,7 +50,7 @@ public:
 
 	virtual float EstimateProgress() const override
 	{
-		if(CurEnumIndex < ChildEnumList.Num())
+		if(CurEnumIndex < ChildEnumList.Num() && TotalSize > 0)
 		{
 			return (float)(Completed + ChildEnumList[CurEnumIndex]->EstimateProgress() * ChildEnumList[CurEnumIndex]->EstimatedSize()) / TotalSize;
 		}
@@ -62,12 +65,42 @@ public:
 		return TotalSize;
 	}
 
+	virtual void GetPrepassObjects(TArray< UObject* >& OutObjects) const override
+	{
+		for(int32 Idx = CurEnumIndex; Idx < ChildEnumList.Num(); ++Idx)
+		{
+			ChildEnumList[Idx]->GetPrepassObjects(OutObjects);
+		}
+	}
+
+	virtual int32 GetPosition() const override
+	{
+		return CurEnumIndex < ChildEnumList.Num() ? Completed + ChildEnumList[CurEnumIndex]->GetPosition() : Completed;
+	}
+
+	virtual void Seek(int32 Position) override
+	{
+		// Children are exhausted exactly when their position reaches their size, so whole children can be skipped
+		while(CurEnumIndex < ChildEnumList.Num() && Position - Completed >= ChildEnumList[CurEnumIndex]->EstimatedSize())
+		{
+			Completed += ChildEnumList[CurEnumIndex]->EstimatedSize();
+			ChildEnumList[CurEnumIndex].Reset();
+			++CurEnumIndex;
+		}
+
+		if(CurEnumIndex < ChildEnumList.Num())
+		{
+			ChildEnumList[CurEnumIndex]->Seek(Position - Completed);
+		}
+	}
+
 protected:
-	void Prepass(TArray< FName > const& Names)
+	template < typename... TChildArgs >
+	void Prepass(TArray< FName > const& Names, TChildArgs const&... ChildArgs)
 	{
 		for(auto Name : Names)
 		{
-			auto Child = MakeUnique< TChildEnum >(Name);
+			auto Child = MakeUnique< TChildEnum >(Name, ChildArgs...);
 			TotalSize += Child->EstimatedSize();
 
 			ChildEnumList.Add(MoveTemp(Child));
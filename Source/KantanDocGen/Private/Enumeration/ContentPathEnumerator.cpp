@@ -6,22 +6,42 @@
 
 #include "ContentPathEnumerator.h"
 #include "KantanDocGenLog.h"
+#include "ClassFilter.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/ARFilter.h"
 #include "Engine/Blueprint.h"
 #include "Animation/AnimBlueprint.h"
+#include "UObject/UObjectGlobals.h"
+#include "Async/Async.h"
 
 
 FContentPathEnumerator::FContentPathEnumerator(
-	FName const& InPath
-)
+	FName const& InPath,
+	int32 InLoadWindow,
+	TSharedRef< const FDocGenClassFilter > const& InFilter
+) :
+	Streaming(MakeShared< FStreamingState >())
 {
 	CurIndex = 0;
+	NextRequestIndex = 0;
+	LoadWindow = FMath::Max(InLoadWindow, 1);
 
-	Prepass(InPath);
+	Prepass(InPath, *InFilter);
 }
 
-void FContentPathEnumerator::Prepass(FName const& Path)
+FContentPathEnumerator::~FContentPathEnumerator()
+{
+	// Strong object references must be released on the game thread
+	if (!IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::GameThread, [Streaming = Streaming]
+			{
+				Streaming->Loaded.Empty();
+			});
+	}
+}
+
+void FContentPathEnumerator::Prepass(FName const& Path, FDocGenClassFilter const& ClassFilter)
 {
 	auto& AssetRegistryModule = FModuleManager::GetModuleChecked< FAssetRegistryModule >("AssetRegistry");
 	auto& AssetRegistry = AssetRegistryModule.Get();
@@ -35,32 +55,113 @@ void FContentPathEnumerator::Prepass(FName const& Path)
 
 	AssetRegistry.GetAssetsByPath(Path, AssetList, true);
 	AssetRegistry.RunAssetsThroughFilter(AssetList, Filter);
+
+	// Filter before anything gets loaded
+	AssetList.RemoveAll([&ClassFilter](FAssetData const& AssetData)
+		{
+			return !ClassFilter.PassesFilter(AssetData);
+		});
+
+	// Registry order isn't stable between runs, and node ids are made unique in the order their nodes arrive
+	AssetList.Sort([](FAssetData const& A, FAssetData const& B)
+		{
+			return A.PackageName == B.PackageName ? A.AssetName.LexicalLess(B.AssetName) : A.PackageName.LexicalLess(B.PackageName);
+		});
+
+	RequestIds.Init(INDEX_NONE, AssetList.Num());
+}
+
+void FContentPathEnumerator::RequestLoads()
+{
+	// Keep async loads in flight for the next LoadWindow assets, so that loading overlaps with documenting.
+	// @NOTE: When run from the command line the engine isn't ticked, the task processor pumps async loading between spawners.
+	const int32 WindowEnd = FMath::Min(CurIndex + LoadWindow, AssetList.Num());
+	for (; NextRequestIndex < WindowEnd; ++NextRequestIndex)
+	{
+		const int32 Index = NextRequestIndex;
+		auto const& AssetData = AssetList[Index];
+
+		if (AssetData.IsAssetLoaded())
+		{
+			Streaming->Loaded.Add(Index, TStrongObjectPtr< UObject >(AssetData.FastGetAsset(false)));
+			Streaming->Completed.Add(Index);
+			continue;
+		}
+
+		TWeakPtr< FStreamingState > WeakStreaming = Streaming;
+		const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+
+		RequestIds[Index] = LoadPackageAsync(AssetData.PackageName.ToString(),
+			FLoadPackageAsyncDelegate::CreateLambda([WeakStreaming, Index, ObjectPath](const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+				{
+					if (auto PinnedStreaming = WeakStreaming.Pin())
+					{
+						PinnedStreaming->Completed.Add(Index);
+						if (Result == EAsyncLoadingResult::Succeeded && LoadedPackage)
+						{
+							// Hold on to it, otherwise it may be GCd before we get to it
+							PinnedStreaming->Loaded.Add(Index, TStrongObjectPtr< UObject >(ObjectPath.ResolveObject()));
+						}
+					}
+				}));
+	}
+}
+
+UObject* FContentPathEnumerator::WaitForAsset(int32 Index)
+{
+	if (!Streaming->Completed.Contains(Index) && RequestIds[Index] != INDEX_NONE)
+	{
+		// Still in flight, block on this request only. Those further ahead carry on in the background.
+		FlushAsyncLoading(RequestIds[Index]);
+	}
+
+	auto Loaded = Streaming->Loaded.Find(Index);
+	return Loaded ? Loaded->Get() : nullptr;
 }
 
 UObject* FContentPathEnumerator::GetNext()
 {
 	UObject* Result = nullptr;
 
+	// Whatever we handed out last time has been fully documented by now, so release it to bound memory use.
+	if (CurIndex > 0)
+	{
+		Streaming->Loaded.Remove(CurIndex - 1);
+	}
+
 	while (CurIndex < AssetList.Num())
 	{
-		auto const& AssetData = AssetList[CurIndex];
+		RequestLoads();
+
+		const int32 Index = CurIndex;
+		auto const& AssetData = AssetList[Index];
 		++CurIndex;
 
-		if (auto Blueprint = Cast< UBlueprint >(AssetData.GetAsset()))
+		if (auto Blueprint = Cast< UBlueprint >(WaitForAsset(Index)))
 		{
 			UE_LOG(LogKantanDocGen, Log, TEXT("Enumerating object '%s' at '%s'"), *Blueprint->GetName(), *AssetData.GetObjectPathString());
 
 			Result = Blueprint;
 			break;
 		}
+
+		Streaming->Loaded.Remove(Index);
 	}
 
 	return Result;
 }
 
+void FContentPathEnumerator::Seek(int32 Position)
+{
+	check(NextRequestIndex == 0);
+
+	// Nothing has been requested yet, so we can just start the load window from here
+	CurIndex = NextRequestIndex = FMath::Clamp(Position, 0, AssetList.Num());
+}
+
 float FContentPathEnumerator::EstimateProgress() const
 {
-	return (float)CurIndex / (AssetList.Num() - 1);
+	return AssetList.Num() > 0 ? (float)CurIndex / AssetList.Num() : 1.0f;
 }
 
 int32 FContentPathEnumerator::EstimatedSize() const
@@ -8,26 +8,47 @@
 
 #include "ISourceObjectEnumerator.h"
 #include "AssetRegistry/AssetData.h"
+#include "UObject/StrongObjectPtr.h"
+
+
+class FDocGenClassFilter;
 
 
 class FContentPathEnumerator : public ISourceObjectEnumerator
 {
 public:
 	FContentPathEnumerator(
-		FName const& InPath
+		FName const& InPath,
+		int32 InLoadWindow,
+		TSharedRef< const FDocGenClassFilter > const& InFilter
 	);
+	virtual ~FContentPathEnumerator();
 
 public:
 	virtual UObject* GetNext() override;
 	virtual float EstimateProgress() const override;
 	virtual int32 EstimatedSize() const override;
+	virtual int32 GetPosition() const override { return CurIndex; }
+	virtual void Seek(int32 Position) override;
 
 protected:
-	void Prepass(FName const& Path);
+	void Prepass(FName const& Path, FDocGenClassFilter const& ClassFilter);
+	void RequestLoads();
+	UObject* WaitForAsset(int32 Index);
 
 protected:
+	// Shared with the async load callbacks, which may fire after we're gone
+	struct FStreamingState
+	{
+		// Keeps each asset alive from load completion until we've finished documenting it
+		TMap< int32, TStrongObjectPtr< UObject > > Loaded;
+		TSet< int32 > Completed;
+	};
+
 	TArray< FAssetData > AssetList;
+	TArray< int32 > RequestIds;
+	TSharedRef< FStreamingState > Streaming;
 	int32 CurIndex;
+	int32 NextRequestIndex;
+	int32 LoadWindow;
 };
-
-
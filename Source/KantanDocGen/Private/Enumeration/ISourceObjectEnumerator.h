@@ -18,6 +18,14 @@ public:
 	virtual float EstimateProgress() const = 0;
 	virtual int32 EstimatedSize() const = 0;
 
+	// Objects known up front, before any have been enumerated. Enumerators which discover objects lazily add nothing.
+	virtual void GetPrepassObjects(TArray< UObject* >& OutObjects) const {}
+
+	// Number of objects returned (or skipped) so far, for checkpointing.
+	virtual int32 GetPosition() const = 0;
+	// Skip ahead to a position previously returned by GetPosition. Only valid before the first call to GetNext.
+	virtual void Seek(int32 Position) = 0;
+
 	virtual ~ISourceObjectEnumerator() {}
 };
 
@@ -6,76 +6,44 @@
 
 #include "NativeModuleEnumerator.h"
 #include "KantanDocGenLog.h"
-#include "UObject/UnrealType.h"
-#include "UObject/Package.h"
-#include "UObject/UObjectHash.h"
+#include "NativeTypeIndex.h"
+#include "ClassFilter.h"
 
 
 FNativeModuleEnumerator::FNativeModuleEnumerator(
-	FName const& InModuleName
+	FName const& InModuleName,
+	TSharedRef< const FNativeTypeIndex > const& InTypeIndex,
+	TSharedRef< const FDocGenClassFilter > const& InFilter
 )
 {
 	CurIndex = 0;
 
-	Prepass(InModuleName);
+	Prepass(InModuleName, *InTypeIndex, *InFilter);
 }
 
-void FNativeModuleEnumerator::Prepass(FName const& ModuleName)
+void FNativeModuleEnumerator::Prepass(FName const& ModuleName, FNativeTypeIndex const& TypeIndex, FDocGenClassFilter const& Filter)
 {
 	// For native package, all classes are already loaded so it's no problem to fully enumerate during prepass.
 	// That way we have more info for progress estimation.
+	// The classes themselves were gathered once for all modules when the type index was built.
 
-	// Attempt to find the package
-	auto PkgName = TEXT("/Script/") + ModuleName.ToString();
-
-	auto Package = FindPackage(nullptr, *PkgName);
-	if(Package == nullptr)
-	{
-		// If it is not in memory, try to load it.
-		Package = LoadPackage(nullptr, *PkgName, LOAD_None);
-	}
-	if(Package == nullptr)
+	auto Types = TypeIndex.FindModule(ModuleName);
+	if (Types == nullptr)
 	{
-		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to find specified package '%s', skipping."), *PkgName);
 		return;
 	}
 
-	// Make sure it's fully loaded (probably unnecessary since only native packages here, but no harm)
-	Package->FullyLoad();
-
-	// @TODO: Work out why the below enumeration is called twice for every class in the package (it's called on the exact same uclass instance)
-	TSet< UObject* > Processed;
-
-	// Functor to invoke on every object found in the package
-	TFunction< void(UObject*) > ObjectEnumFtr = [&](UObject* Obj)
+	ObjectList.Reserve(Types->Classes.Num());
+	for (auto const& Class : Types->Classes)
 	{
-		// The BP action database appears to be keyed either on native UClass objects, or, in the
-		// case of blueprints, on the Blueprint object itself, as opposed to the generated class.
-
-		UObject* ObjectToProcess = nullptr;
-
-		// Native class?
-		if(auto Class = Cast< UClass >(Obj))
+		// Filtering here means excluded classes never make it to the (game thread) spawning stage
+		if (Class.IsValid() && Filter.PassesFilter(Class.Get(), ModuleName))
 		{
-			if(Class->HasAllClassFlags(CLASS_Native) && !Class->HasAnyFlags(RF_ClassDefaultObject))
-			{
-				ObjectToProcess = Class;
-			}
+			ObjectList.Add(Class.Get());
 		}
+	}
 
-		if(ObjectToProcess && !Processed.Contains(ObjectToProcess))
-		{
-			UE_LOG(LogKantanDocGen, Log, TEXT("Enumerating object '%s' in package '%s'"), *ObjectToProcess->GetName(), *PkgName);
-
-			// Store this class
-			ObjectList.Add(ObjectToProcess);
-
-			Processed.Add(ObjectToProcess);
-		}
-	};
-
-	// Enumerate all objects in the package
-	ForEachObjectWithOuter(Package, ObjectEnumFtr, true /* Include nested */);
+	UE_LOG(LogKantanDocGen, Log, TEXT("Enumerating %i classes in module '%s'"), ObjectList.Num(), *ModuleName.ToString());
 }
 
 UObject* FNativeModuleEnumerator::GetNext()
@@ -85,7 +53,7 @@ UObject* FNativeModuleEnumerator::GetNext()
 
 float FNativeModuleEnumerator::EstimateProgress() const
 {
-	return (float)CurIndex / (ObjectList.Num() - 1);
+	return ObjectList.Num() > 0 ? (float)CurIndex / ObjectList.Num() : 1.0f;
 }
 
 int32 FNativeModuleEnumerator::EstimatedSize() const
@@ -93,3 +61,14 @@ int32 FNativeModuleEnumerator::EstimatedSize() const
 	return ObjectList.Num();
 }
 
+void FNativeModuleEnumerator::GetPrepassObjects(TArray< UObject* >& OutObjects) const
+{
+	OutObjects.Reserve(OutObjects.Num() + ObjectList.Num() - CurIndex);
+	for (int32 Idx = CurIndex; Idx < ObjectList.Num(); ++Idx)
+	{
+		if (auto Obj = ObjectList[Idx].Get())
+		{
+			OutObjects.Add(Obj);
+		}
+	}
+}
@@ -9,20 +9,29 @@
 #include "ISourceObjectEnumerator.h"
 
 
+class FNativeTypeIndex;
+class FDocGenClassFilter;
+
+
 class FNativeModuleEnumerator: public ISourceObjectEnumerator
 {
 public:
 	FNativeModuleEnumerator(
-		FName const& InModuleName
+		FName const& InModuleName,
+		TSharedRef< const FNativeTypeIndex > const& InTypeIndex,
+		TSharedRef< const FDocGenClassFilter > const& InFilter
 	);
 
 public:
 	virtual UObject* GetNext() override;
 	virtual float EstimateProgress() const override;
 	virtual int32 EstimatedSize() const override;
+	virtual void GetPrepassObjects(TArray< UObject* >& OutObjects) const override;
+	virtual int32 GetPosition() const override { return CurIndex; }
+	virtual void Seek(int32 Position) override { CurIndex = FMath::Clamp(Position, 0, ObjectList.Num()); }
 
 protected:
-	void Prepass(FName const& ModuleName);
+	void Prepass(FName const& ModuleName, FNativeTypeIndex const& TypeIndex, FDocGenClassFilter const& Filter);
 
 protected:
 	TArray< TWeakObjectPtr< UObject > > ObjectList;
@@ -0,0 +1,110 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "NativeTypeIndex.h"
+#include "KantanDocGenLog.h"
+#include "UObject/UnrealType.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "HAL/PlatformTime.h"
+
+
+TSharedRef< FNativeTypeIndex > FNativeTypeIndex::GT_Build(TArray< FName > const& ModuleNames)
+{
+	check(IsInGameThread());
+
+	const double StartTime = FPlatformTime::Seconds();
+	TSharedRef< FNativeTypeIndex > Index = MakeShared< FNativeTypeIndex >();
+
+	for (FName const& ModuleName : ModuleNames)
+	{
+		const FName PkgName = GetScriptPackageName(ModuleName);
+
+		auto Package = FindPackage(nullptr, *PkgName.ToString());
+		if (Package == nullptr)
+		{
+			// If it is not in memory, try to load it.
+			Package = LoadPackage(nullptr, *PkgName.ToString(), LOAD_None);
+		}
+		if (Package == nullptr)
+		{
+			UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to find specified package '%s', skipping."), *PkgName.ToString());
+			continue;
+		}
+
+		Index->Packages.Add(PkgName);
+	}
+
+	// One pass over the global object list of each type, rather than one package scan per module.
+	// Unlike ForEachObjectWithOuter, each object is visited exactly once.
+	auto FindPackageTypes = [&Index](UObject* Obj) -> FPackageTypes*
+		{
+			return Index->Packages.Find(Obj->GetOutermost()->GetFName());
+		};
+
+	ForEachObjectOfClass(UClass::StaticClass(), [&](UObject* Obj)
+		{
+			// The BP action database appears to be keyed either on native UClass objects, or, in the
+			// case of blueprints, on the Blueprint object itself, as opposed to the generated class.
+			auto Class = static_cast< UClass* >(Obj);
+			if (Class->HasAllClassFlags(CLASS_Native))
+			{
+				if (FPackageTypes* Types = FindPackageTypes(Class))
+				{
+					Types->Classes.Add(Class);
+					++Index->TotalClasses;
+				}
+			}
+		}, true, RF_ClassDefaultObject);
+
+	ForEachObjectOfClass(UScriptStruct::StaticClass(), [&](UObject* Obj)
+		{
+			// Only top level structs, ie. not function parameter structs
+			if (Obj->GetOuter()->IsA< UPackage >())
+			{
+				if (FPackageTypes* Types = FindPackageTypes(Obj))
+				{
+					Types->Structs.Add(static_cast< UScriptStruct* >(Obj));
+				}
+			}
+		}, true, RF_ClassDefaultObject);
+
+	ForEachObjectOfClass(UEnum::StaticClass(), [&](UObject* Obj)
+		{
+			if (FPackageTypes* Types = FindPackageTypes(Obj))
+			{
+				Types->Enums.Add(static_cast< UEnum* >(Obj));
+			}
+		}, true, RF_ClassDefaultObject);
+
+	// The object lists are in whatever order the types were created or loaded, which varies from run to run. Sorted, so
+	// that docs are generated in the same order every time (node ids are made unique in the order their nodes arrive).
+	// @NOTE: These are all top level objects of the one package, so ordering by name is ordering by path name.
+	auto ByName = [](auto const& A, auto const& B)
+		{
+			return A->GetFName().LexicalLess(B->GetFName());
+		};
+
+	for (auto& Package : Index->Packages)
+	{
+		Package.Value.Classes.Sort(ByName);
+		Package.Value.Structs.Sort(ByName);
+		Package.Value.Enums.Sort(ByName);
+	}
+
+	Index->BuildTime = FPlatformTime::Seconds() - StartTime;
+	return Index;
+}
+
+FNativeTypeIndex::FPackageTypes const* FNativeTypeIndex::FindModule(FName const& ModuleName) const
+{
+	return Packages.Find(GetScriptPackageName(ModuleName));
+}
+
+FName FNativeTypeIndex::GetScriptPackageName(FName const& ModuleName)
+{
+	return FName(*(TEXT("/Script/") + ModuleName.ToString()));
+}
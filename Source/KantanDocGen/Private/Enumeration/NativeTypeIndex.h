@@ -0,0 +1,52 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+
+class UClass;
+class UScriptStruct;
+class UEnum;
+
+/*
+Index of all native classes, structs and enums in a set of script packages, grouped by outermost package.
+Built once per run on the game thread, with a single pass over each type's object list, and then shared by
+all module enumerators (and the reflection docs snapshot) instead of each one scanning its own package.
+*/
+class FNativeTypeIndex
+{
+public:
+	struct FPackageTypes
+	{
+		TArray< TWeakObjectPtr< UClass > > Classes;
+		TArray< TWeakObjectPtr< UScriptStruct > > Structs;
+		TArray< TWeakObjectPtr< UEnum > > Enums;
+	};
+
+public:
+	/** Callable only from game thread */
+	static TSharedRef< FNativeTypeIndex > GT_Build(TArray< FName > const& ModuleNames);
+	/**/
+
+	FPackageTypes const* FindModule(FName const& ModuleName) const;
+
+	int32 NumClasses() const { return TotalClasses; }
+	int32 NumPackages() const { return Packages.Num(); }
+
+	static FName GetScriptPackageName(FName const& ModuleName);
+
+protected:
+	TMap< FName, FPackageTypes > Packages;
+	int32 TotalClasses = 0;
+
+public:
+	//
+	double BuildTime = 0.0;
+	//
+};
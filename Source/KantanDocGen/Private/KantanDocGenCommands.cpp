@@ -33,11 +33,47 @@ static bool KantanDocGenExec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& A
 		Settings.OutputDirectory = FDirectoryPath(NewOutput);
 	}
 
+	if (FParse::Param(Cmd, TEXT("Resume")))
+	{
+		Settings.bResumeFromCheckpoint = true;
+	}
+
+	FParse::Value(Cmd, TEXT("-Report="), Settings.ReportPath);
+	FParse::Value(Cmd, TEXT("-Baseline="), Settings.BaselinePath);
+	FParse::Value(Cmd, TEXT("-MaxSlowdown="), Settings.MaxSlowdownPercent);
+	FParse::Value(Cmd, TEXT("-MaxNodeLoss="), Settings.MaxNodeLossPercent);
+	FParse::Value(Cmd, TEXT("-Publish="), Settings.PublishPath);
+
+	FString Format;
+	if (FParse::Value(Cmd, TEXT("-Format="), Format))
+	{
+		Settings.OutputFormat = Format.Equals(TEXT("Json"), ESearchCase::IgnoreCase) ? EKantanDocGenOutputFormat::Json : EKantanDocGenOutputFormat::Html;
+	}
+
+	if (FParse::Param(Cmd, TEXT("Optimize")))
+	{
+		Settings.bMinifyOutput = true;
+		Settings.bPrecompressOutput = true;
+	}
+
 
 	if (FParse::Param(Cmd, TEXT("Generate")))
 	{
 		FKantanDocGenModule& Module = FModuleManager::LoadModuleChecked< FKantanDocGenModule >(TEXT("KantanDocGen"));
-		Module.GenerateDocs(Settings, EKantanDocGenerationMode::ExecCommand);
+		if (FParse::Param(Cmd, TEXT("SelfCheck")))
+		{
+			Module.SelfCheckDocs(Settings);
+		}
+		else
+		{
+			Module.GenerateDocs(Settings, EKantanDocGenerationMode::ExecCommand);
+		}
+	}
+	else if (!Settings.PublishPath.IsEmpty())
+	{
+		// Publish what's already been generated
+		FKantanDocGenModule& Module = FModuleManager::LoadModuleChecked< FKantanDocGenModule >(TEXT("KantanDocGen"));
+		Module.PublishDocs(Settings);
 	}
 
 	if (FParse::Param(Cmd, TEXT("Open")))
@@ -47,7 +83,10 @@ static bool KantanDocGenExec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& A
 
 	if (FParse::Param(Cmd, TEXT("Quit")))
 	{
-		FPlatformMisc::RequestExitWithStatus(true, GIsCriticalError ? -1 : 0);
+		// Non-zero if generation failed, regressed against the baseline or failed its self check
+		FKantanDocGenModule* Module = FModuleManager::GetModulePtr< FKantanDocGenModule >(TEXT("KantanDocGen"));
+		const int32 ExitCode = Module ? Module->GetLastExitCode() : 0;
+		FPlatformMisc::RequestExitWithStatus(true, GIsCriticalError ? -1 : ExitCode);
 	}
 	return true;
 }
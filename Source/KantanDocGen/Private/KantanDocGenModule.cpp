@@ -6,9 +6,11 @@
 
 #include "KantanDocGenModule.h"
 #include "KantanDocGenLog.h"
+#include "DocGenTrace.h"
 #include "KantanDocGenCommands.h"
 #include "DocGenSettings.h"
 #include "DocGenTaskProcessor.h"
+#include "DocGenPublisher.h"
 #include "UI/SKantanDocGenWidget.h"
 
 #include "HAL/IConsoleManager.h"
@@ -17,6 +19,9 @@
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Framework/Application/SlateApplication.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 #include "BlueprintEditorModule.h"
 #include "BlueprintEditor.h"
 #include "BlueprintEditorContext.h"
@@ -30,6 +35,15 @@ IMPLEMENT_MODULE(FKantanDocGenModule, KantanDocGen)
 
 DEFINE_LOG_CATEGORY(LogKantanDocGen);
 
+UE_TRACE_CHANNEL_DEFINE(KantanDocGenChannel);
+
+TRACE_DECLARE_INT_COUNTER(KantanDocGen_Objects, TEXT("KantanDocGen/Objects"));
+TRACE_DECLARE_INT_COUNTER(KantanDocGen_Nodes, TEXT("KantanDocGen/Nodes"));
+TRACE_DECLARE_INT_COUNTER(KantanDocGen_Images, TEXT("KantanDocGen/Images"));
+TRACE_DECLARE_INT_COUNTER(KantanDocGen_BytesWritten, TEXT("KantanDocGen/BytesWritten"));
+TRACE_DECLARE_INT_COUNTER(KantanDocGen_NameCacheHits, TEXT("KantanDocGen/NameCacheHits"));
+TRACE_DECLARE_INT_COUNTER(KantanDocGen_NameCacheMisses, TEXT("KantanDocGen/NameCacheMisses"));
+
 
 void FKantanDocGenModule::StartupModule()
 {
@@ -184,6 +198,7 @@ void FKantanDocGenModule::GenerateDocs(const FKantanDocGenSettings& Settings, EK
 		Processor = MakeUnique< FDocGenTaskProcessor >();
 	}
 
+	CommandExitCode = 0;
 	Processor->QueueTask(Settings, Mode);
 
 	if (!Processor->IsRunning())
@@ -202,6 +217,130 @@ void FKantanDocGenModule::GenerateDocs(const FKantanDocGenSettings& Settings, EK
 	}
 }
 
+FDocGenProgress FKantanDocGenModule::GetProgress() const
+{
+	return Processor.IsValid() ? Processor->GetProgress() : FDocGenProgress();
+}
+
+int32 FKantanDocGenModule::GetLastExitCode() const
+{
+	const int32 ExitCode = Processor.IsValid() ? Processor->GetLastExitCode() : 0;
+	return ExitCode == 0 ? CommandExitCode : ExitCode;
+}
+
+namespace DocGenSelfCheck
+{
+	// Prefix + relative path -> content hash
+	static void HashDirectory(FString const& Directory, FString const& Prefix, TMap< FString, FMD5Hash >& OutHashes)
+	{
+		TArray< FString > Files;
+		IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*"), true, false);
+
+		for (FString const& File : Files)
+		{
+			FString Relative = File;
+			FPaths::MakePathRelativeTo(Relative, *(Directory / TEXT("")));
+			OutHashes.Add(Prefix / Relative, FMD5Hash::HashFile(*File));
+		}
+	}
+}
+
+bool FKantanDocGenModule::SelfCheckDocs(const FKantanDocGenSettings& Settings)
+{
+	// Both runs from scratch, so the second can't reuse anything from the first. Nothing is published.
+	FKantanDocGenSettings RunSettings = Settings;
+	RunSettings.bResumeFromCheckpoint = false;
+	RunSettings.PublishPath.Reset();
+
+	const FString IntermediateDir = FDocGenTaskProcessor::GetIntermediateDir(Settings.DocumentationTitle);
+	const FString DocsDir = Settings.OutputDirectory.Path / Settings.DocumentationTitle;
+
+	// Both the intermediate files and the final docs, which are what the user actually gets
+	FString PrevTimestamp;
+	auto GenerateAndHash = [&](const TCHAR* RunName, TMap< FString, FMD5Hash >& OutHashes)
+		{
+			GenerateDocs(RunSettings, EKantanDocGenerationMode::ExecCommand);
+			if (GetProgress().Phase != EDocGenPhase::Succeeded)
+			{
+				UE_LOG(LogKantanDocGen, Error, TEXT("Self check: %s run failed."), RunName);
+				return false;
+			}
+
+			// Guards against comparing a run's output with itself, if a run were to be skipped
+			FString const& Timestamp = Processor->GetLastReport().Timestamp;
+			if (Timestamp.IsEmpty() || Timestamp == PrevTimestamp)
+			{
+				UE_LOG(LogKantanDocGen, Error, TEXT("Self check: %s run didn't generate anything."), RunName);
+				return false;
+			}
+			PrevTimestamp = Timestamp;
+
+			DocGenSelfCheck::HashDirectory(IntermediateDir, TEXT("Intermediate"), OutHashes);
+			DocGenSelfCheck::HashDirectory(DocsDir, TEXT("Docs"), OutHashes);
+			return true;
+		};
+
+	TMap< FString, FMD5Hash > First;
+	TMap< FString, FMD5Hash > Second;
+	if (!GenerateAndHash(TEXT("first"), First) || !GenerateAndHash(TEXT("second"), Second))
+	{
+		CommandExitCode = 3;
+		return false;
+	}
+
+	TArray< FString > Mismatches;
+	for (auto const& Entry : First)
+	{
+		FMD5Hash const* Other = Second.Find(Entry.Key);
+		if (Other == nullptr)
+		{
+			Mismatches.Add(Entry.Key + TEXT(" (only in first run)"));
+		}
+		else if (*Other != Entry.Value)
+		{
+			Mismatches.Add(Entry.Key + TEXT(" (differs)"));
+		}
+	}
+
+	for (auto const& Entry : Second)
+	{
+		if (!First.Contains(Entry.Key))
+		{
+			Mismatches.Add(Entry.Key + TEXT(" (only in second run)"));
+		}
+	}
+
+	if (Mismatches.Num() == 0)
+	{
+		UE_LOG(LogKantanDocGen, Display, TEXT("Self check passed: %i files identical across runs."), First.Num());
+		return true;
+	}
+
+	Mismatches.Sort();
+	const int32 MaxListed = 20;
+	for (int32 Idx = 0; Idx < FMath::Min(Mismatches.Num(), MaxListed); ++Idx)
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Self check: %s"), *Mismatches[Idx]);
+	}
+	UE_LOG(LogKantanDocGen, Error, TEXT("Self check failed: %i of %i files not identical across runs."), Mismatches.Num(), FMath::Max(First.Num(), Second.Num()));
+
+	CommandExitCode = 3;
+	return false;
+}
+
+bool FKantanDocGenModule::PublishDocs(const FKantanDocGenSettings& Settings)
+{
+	if (Settings.PublishPath.IsEmpty())
+	{
+		return false;
+	}
+
+	FDocGenPublisher Publisher(Settings);
+	const bool bPublished = Publisher.Publish();
+	CommandExitCode = bPublished ? 0 : 4;
+	return bPublished;
+}
+
 void FKantanDocGenModule::ShowDocGenUI()
 {
 	const FText WindowTitle = LOCTEXT("DocGenWindowTitle", "Kantan Doc Gen");
@@ -266,8 +405,10 @@ void FKantanDocGenModule::OpenClassURL(const FKantanDocGenSettings& Settings, UC
 		return;
 	}
 
-	FString HyperlinkTarget = Settings.OutputDirectory.Path / Settings.DocumentationTitle /
-		Class->GetName() / Class->GetName() + TEXT(".html");
+	// Json output has the one viewer page, which routes to the class from the fragment
+	FString HyperlinkTarget = Settings.OutputFormat == EKantanDocGenOutputFormat::Json
+		? Settings.OutputDirectory.Path / Settings.DocumentationTitle / TEXT("index.html#/") + Class->GetName()
+		: Settings.OutputDirectory.Path / Settings.DocumentationTitle / Class->GetName() / Class->GetName() + TEXT(".html");
 	if (IsFile)
 	{
 		HyperlinkTarget = TEXT("file://") / FPaths::ConvertRelativePathToFull(HyperlinkTarget);
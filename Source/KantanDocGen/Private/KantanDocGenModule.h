@@ -32,6 +32,15 @@ public:
 
 public:
 	void GenerateDocs(const FKantanDocGenSettings& Settings, EKantanDocGenerationMode Mode);
+	// Progress of the current (or last) generation, for automation. Callable from any thread.
+	FDocGenProgress GetProgress() const;
+	// Generates twice in ExecCommand mode, and checks that the second run's xml and images are identical to the first's.
+	bool SelfCheckDocs(const FKantanDocGenSettings& Settings);
+	// Mirrors previously generated docs to the settings' publish path
+	bool PublishDocs(const FKantanDocGenSettings& Settings);
+	// 0 if the last generation succeeded, 1 if it failed, 2 if it regressed against its baseline report,
+	// 3 if it didn't pass a self check, 4 if publishing on its own failed
+	int32 GetLastExitCode() const;
 	static void OpenURL(const FKantanDocGenSettings& Settings, bool IsFile = true);
 	void OpenClassURL(const FKantanDocGenSettings& Settings, UClass* Class, bool IsFile = true);
 	void OpenDefaultURL();
@@ -52,6 +61,8 @@ protected:
 protected:
 	TUniquePtr< FDocGenTaskProcessor > Processor;
 	TSharedPtr< FUICommandList > UICommands;
+	// Exit code of a self check or standalone publish, in the absence of a failed generation
+	int32 CommandExitCode = 0;
 };
 
 
@@ -25,6 +25,8 @@
 #include "K2Node_Message.h"
 #include "HighResScreenshot.h"
 #include "XmlFile.h"
+#include "XmlHelpers.h"
+#include "DocGenJsonScript.h"
 #include "Slate/WidgetRenderer.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "TextureResource.h"
@@ -33,6 +35,15 @@
 #include "ImageWriteTask.h"
 #include "AnimGraphNode_Base.h"
 #include "SourceCodeNavigation.h"
+#include "ReflectionDocsGenerator.h"
+#include "DocGenSourceIndex.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "DocGenTrace.h"
+
+const TCHAR* const FNodeDocsGenerator::IndexFragmentsDirName = TEXT("index");
+const TCHAR* const FNodeDocsGenerator::FunctionListsDirName = TEXT("functions");
+const TCHAR* const FNodeDocsGenerator::ViewerDataDirName = TEXT("data");
 
 FNodeDocsGenerator::~FNodeDocsGenerator()
 {
@@ -40,9 +51,10 @@ FNodeDocsGenerator::~FNodeDocsGenerator()
 }
 
 bool FNodeDocsGenerator::GT_Init(FString const& InDocsTitle, FString const& InOutputDir,
-	const TMap<FName, TPair<FString, FString>>& InModulePluginNameAndDesc, UClass* BlueprintContextClass)
+	const TMap<FName, TPair<FString, FString>>& InModulePluginNameAndDesc, UClass* BlueprintContextClass, bool bInUseTemplateNodes)
 {
 	ModulePluginNameAndDesc = InModulePluginNameAndDesc;
+	bUseTemplateNodes = bInUseTemplateNodes;
 
 	DummyBP = CastChecked< UBlueprint >(FKismetEditorUtilities::CreateBlueprint(
 		BlueprintContextClass,
@@ -58,10 +70,34 @@ bool FNodeDocsGenerator::GT_Init(FString const& InDocsTitle, FString const& InOu
 		return false;
 	}
 
-	Graph = FBlueprintEditorUtils::CreateNewGraph(DummyBP.Get(), TEXT("TempoGraph"), UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
-
 	DummyBP->AddToRoot();
+
+	if (!CreateGraph())
+	{
+		return false;
+	}
+
+	DocsTitle = InDocsTitle;
+
+	ClassDocsMap.Empty();
+
+	OutputDir = InOutputDir;
+
+	return true;
+}
+
+bool FNodeDocsGenerator::CreateGraph()
+{
+	// Names must be unique within the dummy blueprint, since recycled graphs may not have been GCd yet
+	const FName GraphName = MakeUniqueObjectName(DummyBP.Get(), UEdGraph::StaticClass(), TEXT("TempoGraph"));
+	Graph = FBlueprintEditorUtils::CreateNewGraph(DummyBP.Get(), GraphName, UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+	if (!Graph.IsValid())
+	{
+		return false;
+	}
+
 	Graph->AddToRoot();
+	NumNodesInGraph = 0;
 
 	GraphPanel = SNew(SGraphPanel)
 		.GraphObj(Graph.Get())
@@ -69,106 +105,235 @@ bool FNodeDocsGenerator::GT_Init(FString const& InDocsTitle, FString const& InOu
 	// We want full detail for rendering, passing a super-high zoom value will guarantee the highest LOD.
 	GraphPanel->RestoreViewSettings(FVector2D(0, 0), 10.0f);
 
-	DocsTitle = InDocsTitle;
+	return true;
+}
 
-	IndexXml = InitIndexXml(DocsTitle);
-	ClassDocsMap.Empty();
+void FNodeDocsGenerator::ReleaseGraph()
+{
+	if (GraphPanel.IsValid())
+	{
+		GraphPanel.Reset();
+	}
 
-	OutputDir = InOutputDir;
+	if (Graph.IsValid())
+	{
+		Graph->RemoveFromRoot();
+		Graph.Reset();
+	}
+}
 
-	return true;
+bool FNodeDocsGenerator::GT_RecycleGraph()
+{
+	check(IsInGameThread());
+
+	ReleaseGraph();
+	return CreateGraph();
 }
 
-UK2Node* FNodeDocsGenerator::GT_InitializeForSpawner(UBlueprintNodeSpawner* Spawner, UObject* SourceObject, FNodeProcessingState& OutState)
+void FNodeDocsGenerator::GT_ReleaseNode(UEdGraphNode* Node)
 {
-	if (!IsSpawnerDocumentable(Spawner, SourceObject->IsA< UBlueprint >()))
+	check(IsInGameThread());
+
+	Node->RemoveFromRoot();
+
+	// Template nodes belong to the engine's template cache, and the node may belong to a graph which has since been recycled
+	if (Graph.IsValid() && Node->GetGraph() == Graph.Get())
 	{
-		return nullptr;
+		Graph->RemoveNode(Node);
 	}
+}
 
-	// Spawn an instance into the graph
-	auto NodeInst = Spawner->Invoke(Graph.Get(), IBlueprintNodeBinder::FBindingSet{}, FVector2D(0, 0));
-
-	// Currently Blueprint nodes only
-	auto K2NodeInst = Cast< UK2Node >(NodeInst);
+UK2Node* FNodeDocsGenerator::GT_InitializeForSpawner(UBlueprintNodeSpawner* Spawner, UObject* SourceObject, FNodeProcessingState& OutState)
+{
+	// @NOTE: Spawners have already been filtered with IsSpawnerDocumentable when the action snapshot was taken.
 
+	auto K2NodeInst = GT_SpawnNode(Spawner);
 	if (K2NodeInst == nullptr)
 	{
 		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to create node from spawner of class %s with node class %s."), *Spawner->GetClass()->GetName(), Spawner->NodeClass ? *Spawner->NodeClass->GetName() : TEXT("None"));
+		++NumSpawnFailures;
 		return nullptr;
 	}
 
 	UClass* AssociatedClass = MapToAssociatedClass(K2NodeInst, SourceObject);
 	UPackage* Package = AssociatedClass->GetOutermost();
 	const FString ModuleName = Package->GetName().Replace(TEXT("/Script/"), TEXT(""));
-	const TPair<FString, FString>& PluginNameAndDescription = ModulePluginNameAndDesc.FindChecked(*ModuleName);
+	check(ModulePluginNameAndDesc.Contains(*ModuleName));
 
 	if (!ClassDocsMap.Contains(AssociatedClass))
 	{
-		// New class xml file needs adding
-		ClassDocsMap.Add(AssociatedClass, InitClassDocXml(AssociatedClass, ModuleName));
-		// Also update the index xml
-		UpdateIndexDocWithClass(IndexXml.Get(), AssociatedClass, ModuleName,
-			PluginNameAndDescription.Key, PluginNameAndDescription.Value);
+		// New class record needs adding, its xml and index entry are built from it at finalize
+		ClassDocsMap.Add(AssociatedClass, InitClassDocRecord(AssociatedClass, ModuleName));
 	}
 
 	OutState = FNodeProcessingState();
-	OutState.ClassDocXml = ClassDocsMap.FindChecked(AssociatedClass);
+	OutState.ClassDoc = ClassDocsMap.FindChecked(AssociatedClass);
 	OutState.ClassDocsPath = OutputDir / GetClassDocId(AssociatedClass);
+	OutState.NodeId = MakeUniqueNodeDocId(*OutState.ClassDoc, GetNodeDocId(K2NodeInst));
 
 	return K2NodeInst;
 }
 
-bool FNodeDocsGenerator::GT_Finalize(FString OutputPath)
+UK2Node* FNodeDocsGenerator::GT_SpawnNode(UBlueprintNodeSpawner* Spawner)
 {
-	for (TPair<TWeakObjectPtr<UClass>, TSharedPtr<FXmlFile>>& ClassDoc : ClassDocsMap)
+	DOCGEN_TRACE_SCOPE(KantanDocGen_SpawnNode);
+
+	if (bUseTemplateNodes)
+	{
+		SCOPE_SECONDS_COUNTER(SpawnTemplateNodeTime);
+
+		// Template nodes are cached by the engine (they're what the action menu uses), with pins allocated but without
+		// the transactions and notifications that go with placing a node. Our graph is passed as the model for its outer.
+		// @NOTE: Nodes which haven't allocated any pins as a template need a proper spawn to be documented.
+		auto TemplateNode = Cast< UK2Node >(Spawner->GetTemplateNode(Graph.Get()));
+		if (TemplateNode && TemplateNode->Pins.Num() > 0)
+		{
+			++NumTemplateNodes;
+			return TemplateNode;
+		}
+	}
+
+	SCOPE_SECONDS_COUNTER(SpawnInvokedNodeTime);
+
+	// Spawn an instance into the graph
+	auto NodeInst = Spawner->Invoke(Graph.Get(), IBlueprintNodeBinder::FBindingSet{}, FVector2D(0, 0));
+
+	// Currently Blueprint nodes only
+	auto K2NodeInst = Cast< UK2Node >(NodeInst);
+	if (K2NodeInst)
+	{
+		++NumNodesInGraph;
+		++NumInvokedNodes;
+	}
+
+	return K2NodeInst;
+}
+
+bool FNodeDocsGenerator::GT_Finalize(FString OutputPath, FReflectionDocsGenerator const* ReflectionDocs)
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_Finalize);
+
+	// Classes with blueprint visible properties get docs even if none of their nodes were documented
+	if (ReflectionDocs)
+	{
+		for (auto const& Entry : ReflectionDocs->GetClasses())
+		{
+			UClass* Class = Entry.Value.Class.Get();
+			if (Class && !ClassDocsMap.Contains(Class))
+			{
+				ClassDocsMap.Add(Class, InitClassDocRecord(Class, Entry.Value.ModuleName));
+			}
+		}
+	}
+
+	// @NOTE: Classes, their nodes and the index are all written out sorted, so that identical input gives byte identical
+	// output regardless of the order things were enumerated (or resumed) in.
+	TArray< FClassDocRecord const* > Records;
+	Records.Reserve(ClassDocsMap.Num());
+	for (auto const& Entry : ClassDocsMap)
+	{
+		Entry.Value->Nodes.Sort([](FNodeRecord const& A, FNodeRecord const& B)
+			{
+				return A.Id.Compare(B.Id, ESearchCase::CaseSensitive) < 0;
+			});
+		Records.Add(Entry.Value.Get());
+	}
+
+	Records.Sort([](FClassDocRecord const& A, FClassDocRecord const& B)
+		{
+			return A.Id.Compare(B.Id, ESearchCase::CaseSensitive) < 0;
+		});
+
+	// @NOTE: Json output has no conversion step, the viewer renders everything from the data written here.
+	if (OutputFormat == EKantanDocGenOutputFormat::Json)
+	{
+		return SaveViewerData(Records, OutputPath, ReflectionDocs);
+	}
+
+	if (!SaveClassDocXml(Records, OutputPath, ReflectionDocs))
 	{
-		FinalizeClassDocXml(ClassDoc.Key.Get(), ClassDoc.Value);
+		return false;
+	}
+
+	TSharedPtr< FXmlFile > IndexXml = InitIndexXml(DocsTitle);
+	AddIndexModules(IndexXml.Get(), Records, ReflectionDocs);
+	for (FClassDocRecord const* Record : Records)
+	{
+		UpdateIndexDocWithClass(IndexXml.Get(), *Record);
+	}
+
+	if (ReflectionDocs)
+	{
+		UpdateIndexDocWithReflectedTypes(IndexXml.Get(), *ReflectionDocs);
 	}
 
-	if (!SaveClassDocXml(OutputPath))
+	if (!SaveIndexXml(IndexXml.Get(), OutputPath))
 	{
 		return false;
 	}
 
-	if (!SaveIndexXml(OutputPath))
+	if (!SaveIndexFragments(Records, ScriptsDir, ReflectionDocs))
 	{
 		return false;
 	}
 
+	// @NOTE: The docs are still usable without search, so failing to write the index doesn't fail the run.
+	SaveSearchIndex(Records, ScriptsDir, ReflectionDocs);
+
 	return true;
 }
 
-void FNodeDocsGenerator::CleanUp()
+int32 FNodeDocsGenerator::GT_RestoreClassDocRecords(TArray< TSharedPtr< FClassDocRecord > > const& Records)
 {
-	if (GraphPanel.IsValid())
+	check(IsInGameThread());
+
+	int32 NumNodes = 0;
+	for (auto const& Record : Records)
 	{
-		GraphPanel.Reset();
+		UClass* Class = FindObject< UClass >(nullptr, *Record->ClassPath);
+		if (Class == nullptr)
+		{
+			// Blueprint classes won't be loaded yet
+			Class = LoadObject< UClass >(nullptr, *Record->ClassPath, nullptr, LOAD_NoWarn);
+		}
+
+		if (Class == nullptr)
+		{
+			UE_LOG(LogKantanDocGen, Warning, TEXT("Class '%s' from checkpoint no longer exists, dropping its docs."), *Record->ClassPath);
+			continue;
+		}
+
+		Record->HierarchyIndex = ClassHierarchy.GT_FindOrAdd(Class, NameCache);
+		ClassHierarchy.SetDocumented(Record->HierarchyIndex);
+
+		ClassDocsMap.Add(Class, Record);
+		NumNodes += Record->Nodes.Num();
 	}
 
+	return NumNodes;
+}
+
+void FNodeDocsGenerator::CleanUp()
+{
+	ReleaseGraph();
+
 	if (DummyBP.IsValid())
 	{
 		DummyBP->RemoveFromRoot();
 		DummyBP.Reset();
 	}
-	if (Graph.IsValid())
-	{
-		Graph->RemoveFromRoot();
-		Graph.Reset();
-	}
 }
 
 bool FNodeDocsGenerator::GenerateNodeImage(UEdGraphNode* Node, FNodeProcessingState& State)
 {
 	SCOPE_SECONDS_COUNTER(GenerateNodeImageTime);
+	DOCGEN_TRACE_SCOPE(KantanDocGen_NodeImage);
 
 	const FVector2D DrawSize(1024.0f, 1024.0f);
 
 	bool bSuccess = false;
 
-	AdjustNodeForSnapshot(Node);
-
-	FString NodeName = GetNodeDocId(Node);
+	FString NodeName = State.NodeId;
 
 	FIntRect Rect;
 
@@ -176,13 +341,31 @@ bool FNodeDocsGenerator::GenerateNodeImage(UEdGraphNode* Node, FNodeProcessingSt
 
 	bSuccess = DocGenThreads::RunOnGameThreadRetVal([this, Node, NodeName, DrawSize, &Rect, &PixelData]
 		{
-			auto NodeWidget = FNodeFactory::CreateNodeWidget(Node);
-			NodeWidget->SetOwner(GraphPanel.ToSharedRef());
-
 			const bool bUseGammaCorrection = true;
 			FWidgetRenderer Renderer(bUseGammaCorrection);
 			Renderer.SetIsPrepassNeeded(true);
-			auto RenderTarget = Renderer.DrawWidget(NodeWidget.ToSharedRef(), DrawSize);
+
+			TSharedPtr< SGraphNode > NodeWidget;
+			UTextureRenderTarget2D* RenderTarget = nullptr;
+			{
+				// Widget creation, Slate prepass and draw
+				DOCGEN_TRACE_SCOPE(KantanDocGen_DrawNodeWidget);
+
+				// @NOTE: Template nodes are shared with the editor's action menus, so the adjustment is only made for
+				// as long as it takes to draw the widget, and always on the game thread.
+				UEdGraphPin* AdjustedPin = AdjustNodeForSnapshot(Node);
+
+				NodeWidget = FNodeFactory::CreateNodeWidget(Node);
+				NodeWidget->SetOwner(GraphPanel.ToSharedRef());
+				RenderTarget = Renderer.DrawWidget(NodeWidget.ToSharedRef(), DrawSize);
+
+				if (AdjustedPin)
+				{
+					AdjustedPin->bDefaultValueIsIgnored = false;
+				}
+			}
+
+			DOCGEN_TRACE_SCOPE(KantanDocGen_ReadbackNodeImage);
 
 			auto DesiredAsFloat = NodeWidget->GetDesiredSize();
 			const FIntPoint Desired(static_cast<int32>(DesiredAsFloat.X), static_cast<int32>(DesiredAsFloat.Y));
@@ -227,11 +410,21 @@ bool FNodeDocsGenerator::GenerateNodeImage(UEdGraphNode* Node, FNodeProcessingSt
 	ImageTask->bOverwriteFile = true;
 	ImageTask->PixelPreProcessors.Add(TAsyncAlphaWrite<FLinearColor>(255));
 
-	if (ImageTask->RunTask())
+	bool bWritten = false;
+	{
+		DOCGEN_TRACE_SCOPE(KantanDocGen_EncodeNodeImage);
+		bWritten = ImageTask->RunTask();
+	}
+
+	if (bWritten)
 	{
 		// Success!
 		bSuccess = true;
 		State.ImageFilename = ImgFilename;
+
+		++NumImagesWritten;
+		TRACE_COUNTER_INCREMENT(KantanDocGen_Images);
+		DOCGEN_TRACE_FILE_WRITTEN(ScreenshotSaveName);
 	}
 	else
 	{
@@ -241,51 +434,8 @@ bool FNodeDocsGenerator::GenerateNodeImage(UEdGraphNode* Node, FNodeProcessingSt
 	return bSuccess;
 }
 
-inline FString WrapAsCDATA(FString const& InString)
-{
-	return TEXT("<![CDATA[") + InString + TEXT("]]>");
-}
-
-inline FXmlNode* AppendChild(FXmlNode* Parent, FString const& Name)
-{
-	Parent->AppendChildNode(Name, FString());
-	return Parent->GetChildrenNodes().Last();
-}
-
-inline FXmlNode* AppendChildRaw(FXmlNode* Parent, FString const& Name, FString const& TextContent)
-{
-	Parent->AppendChildNode(Name, TextContent);
-	return Parent->GetChildrenNodes().Last();
-}
-
-inline FXmlNode* AppendChildCDATA(FXmlNode* Parent, FString const& Name, FString const& TextContent)
-{
-	Parent->AppendChildNode(Name, WrapAsCDATA(TextContent));
-	return Parent->GetChildrenNodes().Last();
-}
-
-inline TArray<FXmlNode*> FindChildrenNodes(FXmlNode* Parent, FString const& Name)
-{
-	TArray<FXmlNode*> AllChildren = Parent->GetChildrenNodes();
-	return AllChildren.FilterByPredicate([Name](FXmlNode* Child)
-		{ return Child->GetTag() == Name; });
-}
-
-inline FXmlNode* FindChildWithGrandchildOfContent(FXmlNode* Parent, FString const& ChildName,
-	FString const& GrandchildName, FString const& GrandchildContent)
-{
-	TArray<FXmlNode*> AllChildren = FindChildrenNodes(Parent, ChildName);
-	FXmlNode** FoundGrandchild = AllChildren.FindByPredicate([GrandchildName, GrandchildContent](FXmlNode* Child)
-		{
-			const FXmlNode* Grandchild = Child->FindChildNode(GrandchildName);
-			return Grandchild && Grandchild->GetContent() == WrapAsCDATA(GrandchildContent);
-		});
-
-	return FoundGrandchild ? *FoundGrandchild : nullptr;
-}
-
 // For K2 pins only!
-bool ExtractPinInformation(UEdGraphPin* Pin, FString& OutName, FString& OutType, FString& OutDescription)
+bool ExtractPinInformation(UEdGraphPin* Pin, FDocGenNameCache& NameCache, FString& OutName, FString& OutType, FString& OutDescription)
 {
 	FString Tooltip;
 	Pin->GetOwningNode()->GetPinHoverText(*Pin, Tooltip);
@@ -322,7 +472,7 @@ bool ExtractPinInformation(UEdGraphPin* Pin, FString& OutName, FString& OutType,
 		OutName = Pin->Direction == EEdGraphPinDirection::EGPD_Input ? TEXT("In") : TEXT("Out");
 	}
 
-	OutType = UEdGraphSchema_K2::TypeToText(Pin->PinType).ToString();
+	OutType = NameCache.GetPinTypeText(Pin->PinType);
 
 	return true;
 }
@@ -340,35 +490,29 @@ TSharedPtr< FXmlFile > FNodeDocsGenerator::InitIndexXml(FString const& IndexTitl
 	return File;
 }
 
-TSharedPtr< FXmlFile > FNodeDocsGenerator::InitClassDocXml(UClass* Class, const FString& ModuleName)
+TSharedPtr< FNodeDocsGenerator::FClassDocRecord > FNodeDocsGenerator::InitClassDocRecord(UClass* Class, const FString& ModuleName)
 {
-	const FString FileTemplate = R"xxx(<?xml version="1.0" encoding="UTF-8"?>
-<root></root>)xxx";
+	TSharedPtr< FClassDocRecord > Record = MakeShared< FClassDocRecord >();
 
-	TSharedPtr< FXmlFile > File = MakeShared< FXmlFile >(FileTemplate, EConstructMethod::ConstructFromBuffer);
-	FXmlNode* Root = File->GetRootNode();
-
-	AppendChildCDATA(Root, TEXT("docs_name"), DocsTitle);
-	AppendChildCDATA(Root, TEXT("id"), GetClassDocId(Class));
-
-	const FString ClassDisplayName = FBlueprintEditorUtils::GetFriendlyClassDisplayName(Class).ToString();
-	AppendChildCDATA(Root, TEXT("display_name"), FBlueprintEditorUtils::GetFriendlyClassDisplayName(Class).ToString());
+	Record->ClassPath = Class->GetPathName();
+	Record->Id = GetClassDocId(Class);
+	Record->DisplayName = NameCache.GetClassDisplayName(Class);
 
 	const FString ClassTooltip = Class->GetToolTipText().ToString();
-	if (ClassTooltip != ClassDisplayName)
+	if (ClassTooltip != Record->DisplayName)
 	{
-		AppendChildCDATA(Root, TEXT("description"), ClassTooltip);
+		Record->Description = ClassTooltip;
 	}
 
-	FXmlNode* References = AppendChild(Root, TEXT("references"));
-	if (!ModuleName.IsEmpty())
-	{
-		AppendChildCDATA(References, TEXT("module"), ModuleName);
-	}
+	Record->ModuleName = ModuleName;
 
 	FString ClassHeaderPath, ClassSourcePath;
-	FSourceCodeNavigation::FindClassHeaderPath(Class, ClassHeaderPath);
-	FSourceCodeNavigation::FindClassSourcePath(Class, ClassSourcePath);
+	if (!SourceIndex.IsValid() || !SourceIndex->FindPaths(*ModuleName, Class->GetMetaData(TEXT("ModuleRelativePath")), ClassHeaderPath, ClassSourcePath))
+	{
+		// Not an indexed module, probe the filesystem
+		FSourceCodeNavigation::FindClassHeaderPath(Class, ClassHeaderPath);
+		FSourceCodeNavigation::FindClassSourcePath(Class, ClassSourcePath);
+	}
 
 	if (!ClassHeaderPath.IsEmpty())
 	{
@@ -391,91 +535,115 @@ TSharedPtr< FXmlFile > FNodeDocsGenerator::InitClassDocXml(UClass* Class, const
 			}
 		}
 
-		AppendChildCDATA(References, TEXT("header"), ClassHeaderPath);
-		if (!ClassSourcePath.IsEmpty())
-		{
-			AppendChildCDATA(References, TEXT("source"), ClassSourcePath);
-		}
+		Record->HeaderPath = ClassHeaderPath;
+		Record->SourcePath = ClassSourcePath;
 	}
 
-	const FString IncludePath = Class->GetMetaData(TEXT("IncludePath"));
-	if (!IncludePath.IsEmpty())
-	{
-		AppendChildCDATA(References, TEXT("include"), IncludePath);
-	}
+	Record->IncludePath = Class->GetMetaData(TEXT("IncludePath"));
 
-	AppendChild(Root, TEXT("nodes"));
+	// Captured now, since blueprint classes may well have been unloaded by the time we finalize
+	Record->HierarchyIndex = ClassHierarchy.GT_FindOrAdd(Class, NameCache);
+	ClassHierarchy.SetDocumented(Record->HierarchyIndex);
 
-	return File;
+	return Record;
 }
 
-void FNodeDocsGenerator::FinalizeClassDocXml(UClass* Class, TSharedPtr<FXmlFile> Doc)
+TSharedPtr< FXmlFile > FNodeDocsGenerator::BuildClassDocXml(FClassDocRecord const& Record) const
 {
-	FXmlNode* Root = Doc->GetRootNode();
+	TSharedPtr< FXmlFile > File = MakeEmptyDocXml();
+	FXmlNode* Root = File->GetRootNode();
 
+	AppendChildCDATA(Root, TEXT("docs_name"), DocsTitle);
+	AppendChildCDATA(Root, TEXT("id"), Record.Id);
+	AppendChildCDATA(Root, TEXT("display_name"), Record.DisplayName);
 
-	// Inheritance and interface documentation needs to be done on finalize because it requires knowing which classes are documented.
-	TArray<UClass*> InheritanceHierarchy;
-	UClass* Parent = Class->GetSuperClass();
-	while (Parent)
+	if (!Record.Description.IsEmpty())
 	{
-		InheritanceHierarchy.Add(Parent);
-		Parent = Parent->GetSuperClass();
+		AppendChildCDATA(Root, TEXT("description"), Record.Description);
 	}
 
-	Algo::Reverse(InheritanceHierarchy);
-
-	FXmlNode* Inheritance = AppendChild(Root, TEXT("inheritance"));
-	for (UClass* SuperClass : InheritanceHierarchy)
+	FXmlNode* References = AppendChild(Root, TEXT("references"));
+	if (!Record.ModuleName.IsEmpty())
 	{
-		const FString SuperClassId = GetClassDocId(SuperClass);
-		FXmlNode* ClassElem = AppendChild(Inheritance, TEXT("superClass"));
+		AppendChildCDATA(References, TEXT("module"), Record.ModuleName);
+	}
 
-		if (ClassDocsMap.Contains(SuperClass))
+	if (!Record.HeaderPath.IsEmpty())
+	{
+		AppendChildCDATA(References, TEXT("header"), Record.HeaderPath);
+		if (!Record.SourcePath.IsEmpty())
 		{
-			AppendChildCDATA(ClassElem, TEXT("id"), SuperClassId);
+			AppendChildCDATA(References, TEXT("source"), Record.SourcePath);
 		}
+	}
+
+	if (!Record.IncludePath.IsEmpty())
+	{
+		AppendChildCDATA(References, TEXT("include"), Record.IncludePath);
+	}
 
-		const FString SuperClassDisplayName = FBlueprintEditorUtils::GetFriendlyClassDisplayName(SuperClass).ToString();
-		AppendChildCDATA(ClassElem, TEXT("display_name"), SuperClassDisplayName);
+	// Big classes list their functions from a separate script, a page at a time. The nodes stay in the xml regardless.
+	if (Record.Nodes.Num() > MaxInlineFunctions)
+	{
+		AppendChildCDATA(Root, TEXT("functions_script"), FString(TEXT("../")) / FunctionListsDirName / (Record.Id + TEXT(".js")));
 	}
 
-	if (Class->Interfaces.Num() > 0)
+	FXmlNode* Nodes = AppendChild(Root, TEXT("nodes"));
+	for (FNodeRecord const& Node : Record.Nodes)
 	{
-		if (Class->Interfaces.Num() > 1)
+		FXmlNode* NodeElem = AppendChild(Nodes, TEXT("node"));
+		AppendChildCDATA(NodeElem, TEXT("id"), Node.Id);
+		AppendChildCDATA(NodeElem, TEXT("shorttitle"), Node.ShortTitle);
+		if (!Node.Description.IsEmpty())
 		{
-			int32 BreakHere = 1;
+			AppendChildCDATA(NodeElem, TEXT("description"), Node.Description);
 		}
+	}
 
-		FXmlNode* Interfaces = AppendChild(Root, TEXT("interfaces"));
-		for (const FImplementedInterface& Interface : Class->Interfaces)
+	// Inheritance and interfaces only link to classes which ended up documented.
+	TArray< int32, TInlineAllocator< 32 > > Ancestors;
+	ClassHierarchy.GetAncestors(Record.HierarchyIndex, Ancestors);
+
+	FXmlNode* Inheritance = AppendChild(Root, TEXT("inheritance"));
+	for (int32 AncestorIndex : Ancestors)
+	{
+		FDocGenClassHierarchy::FEntry const& SuperClass = ClassHierarchy.Get(AncestorIndex);
+		FXmlNode* ClassElem = AppendChild(Inheritance, TEXT("superClass"));
+
+		if (SuperClass.bDocumented)
 		{
-			UClass* InterfaceClass = Interface.Class.Get();
-			ensureAlways(InterfaceClass);
+			AppendChildCDATA(ClassElem, TEXT("id"), SuperClass.Id);
+		}
+
+		AppendChildCDATA(ClassElem, TEXT("display_name"), SuperClass.DisplayName);
+	}
 
-			const FString InterfaceId = GetClassDocId(InterfaceClass);
+	FDocGenClassHierarchy::FEntry const& ClassEntry = ClassHierarchy.Get(Record.HierarchyIndex);
+	if (ClassEntry.Interfaces.Num() > 0)
+	{
+		FXmlNode* Interfaces = AppendChild(Root, TEXT("interfaces"));
+		for (int32 InterfaceIndex : ClassEntry.Interfaces)
+		{
+			FDocGenClassHierarchy::FEntry const& Interface = ClassHierarchy.Get(InterfaceIndex);
 			FXmlNode* InterfaceElement = AppendChild(Interfaces, TEXT("interface"));
 
-			if (ClassDocsMap.Contains(InterfaceClass))
+			if (Interface.bDocumented)
 			{
-				AppendChildCDATA(InterfaceElement, TEXT("id"), InterfaceId);
+				AppendChildCDATA(InterfaceElement, TEXT("id"), Interface.Id);
 			}
 
-			const FString InterfaceDisplayName = FBlueprintEditorUtils::GetFriendlyClassDisplayName(InterfaceClass).ToString();
-			AppendChildCDATA(InterfaceElement, TEXT("display_name"), InterfaceDisplayName);
+			AppendChildCDATA(InterfaceElement, TEXT("display_name"), Interface.DisplayName);
 		}
 	}
 
+	return File;
 }
 
-bool FNodeDocsGenerator::UpdateIndexDocWithClass(FXmlFile* DocFile, UClass* Class, const FString& ModuleName,
+FXmlNode* FNodeDocsGenerator::FindOrAddIndexModule(FXmlFile* DocFile, const FString& ModuleName,
 	const FString& PluginName, const FString& PluginDescription)
 {
-	const FString ClassId = GetClassDocId(Class);
 	const FString PluginId = PluginName.Replace(TEXT(" "), TEXT("_"));
 
-	TArray<FXmlNode*> RootChildren = FindChildrenNodes(DocFile->GetRootNode(), TEXT("plugin"));
-
 	FXmlNode* Plugin = FindChildWithGrandchildOfContent(DocFile->GetRootNode(), TEXT("plugin"), TEXT("id"), PluginId);
 	if (!Plugin)
 	{
@@ -496,35 +664,109 @@ bool FNodeDocsGenerator::UpdateIndexDocWithClass(FXmlFile* DocFile, UClass* Clas
 		AppendChild(Module, TEXT("classes"));
 	}
 
+	return Module;
+}
+
+void FNodeDocsGenerator::AddIndexModules(FXmlFile* DocFile, TArray< FClassDocRecord const* > const& Records, FReflectionDocsGenerator const* ReflectionDocs)
+{
+	// Every module with something in it, created up front so that plugins and modules are in (plugin, module) order
+	TSet< FString > ModuleNames;
+	for (FClassDocRecord const* Record : Records)
+	{
+		ModuleNames.Add(Record->ModuleName);
+	}
+
+	if (ReflectionDocs)
+	{
+		for (FReflectionDocsGenerator::FTypeRecord const& Type : ReflectionDocs->GetTypes())
+		{
+			ModuleNames.Add(Type.ModuleName);
+		}
+	}
+
+	TArray< TPair< FString const*, TPair< FString, FString > const* > > Modules;
+	for (FString const& ModuleName : ModuleNames)
+	{
+		Modules.Emplace(&ModuleName, &ModulePluginNameAndDesc.FindChecked(*ModuleName));
+	}
+
+	Modules.Sort([](auto const& A, auto const& B)
+		{
+			const int32 PluginOrder = A.Value->Key.Compare(B.Value->Key, ESearchCase::CaseSensitive);
+			return PluginOrder != 0 ? PluginOrder < 0 : A.Key->Compare(*B.Key, ESearchCase::CaseSensitive) < 0;
+		});
+
+	for (auto const& Module : Modules)
+	{
+		FindOrAddIndexModule(DocFile, *Module.Key, Module.Value->Key, Module.Value->Value);
+	}
+}
+
+bool FNodeDocsGenerator::UpdateIndexDocWithClass(FXmlFile* DocFile, FClassDocRecord const& Record)
+{
+	const TPair<FString, FString>& PluginNameAndDescription = ModulePluginNameAndDesc.FindChecked(*Record.ModuleName);
+
+	FXmlNode* Module = FindOrAddIndexModule(DocFile, Record.ModuleName, PluginNameAndDescription.Key, PluginNameAndDescription.Value);
 	FXmlNode* Classes = Module->FindChildNode(TEXT("classes"));
 	FXmlNode* ClassElem = AppendChild(Classes, TEXT("class"));
 
-	AppendChildCDATA(ClassElem, TEXT("id"), ClassId);
-
-	const FString ClassDisplayName = FBlueprintEditorUtils::GetFriendlyClassDisplayName(Class).ToString();
-	AppendChildCDATA(ClassElem, TEXT("display_name"), ClassDisplayName);
+	AppendChildCDATA(ClassElem, TEXT("id"), Record.Id);
+	AppendChildCDATA(ClassElem, TEXT("display_name"), Record.DisplayName);
 
-	const FString ClassTooltip = Class->GetToolTipText().ToString();
-	if (ClassTooltip != ClassDisplayName)
+	if (!Record.Description.IsEmpty())
 	{
-		AppendChildCDATA(ClassElem, TEXT("description"), ClassTooltip);
+		AppendChildCDATA(ClassElem, TEXT("description"), Record.Description);
 	}
 
 	return true;
 }
 
-bool FNodeDocsGenerator::UpdateClassDocWithNode(FXmlFile* DocFile, UEdGraphNode* Node, const FString& NodeDesc)
+bool FNodeDocsGenerator::UpdateIndexDocWithReflectedTypes(FXmlFile* DocFile, FReflectionDocsGenerator const& ReflectionDocs)
 {
-	auto NodeId = GetNodeDocId(Node);
-	auto Nodes = DocFile->GetRootNode()->FindChildNode(TEXT("nodes"));
-	auto NodeElem = AppendChild(Nodes, TEXT("node"));
-	AppendChildCDATA(NodeElem, TEXT("id"), NodeId);
-	AppendChildCDATA(NodeElem, TEXT("shorttitle"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-	if (!NodeDesc.IsEmpty())
+	// Structs before enums, each by id
+	TArray< FReflectionDocsGenerator::FTypeRecord const* > Types;
+	for (FReflectionDocsGenerator::FTypeRecord const& Type : ReflectionDocs.GetTypes())
 	{
-		AppendChildCDATA(NodeElem, TEXT("description"), NodeDesc);
+		Types.Add(&Type);
 	}
 
+	Types.Sort([](FReflectionDocsGenerator::FTypeRecord const& A, FReflectionDocsGenerator::FTypeRecord const& B)
+		{
+			return A.Kind != B.Kind ? A.Kind < B.Kind : A.Id.Compare(B.Id, ESearchCase::CaseSensitive) < 0;
+		});
+
+	for (FReflectionDocsGenerator::FTypeRecord const* TypePtr : Types)
+	{
+		FReflectionDocsGenerator::FTypeRecord const& Type = *TypePtr;
+		const TPair<FString, FString>& PluginNameAndDescription = ModulePluginNameAndDesc.FindChecked(*Type.ModuleName);
+		FXmlNode* Module = FindOrAddIndexModule(DocFile, Type.ModuleName,
+			PluginNameAndDescription.Key, PluginNameAndDescription.Value);
+
+		const bool bIsStruct = Type.Kind == FReflectionDocsGenerator::ETypeKind::Struct;
+		const FString ListTag = bIsStruct ? TEXT("structs") : TEXT("enums");
+
+		FXmlNode* TypeList = Module->FindChildNode(ListTag);
+		if (!TypeList)
+		{
+			TypeList = AppendChild(Module, ListTag);
+		}
+
+		FXmlNode* TypeElem = AppendChild(TypeList, bIsStruct ? TEXT("struct") : TEXT("enum"));
+		AppendChildCDATA(TypeElem, TEXT("id"), Type.Id);
+		AppendChildCDATA(TypeElem, TEXT("display_name"), Type.DisplayName);
+		if (!Type.Description.IsEmpty())
+		{
+			AppendChildCDATA(TypeElem, TEXT("description"), Type.Description);
+		}
+	}
+
+	return true;
+}
+
+bool FNodeDocsGenerator::UpdateClassDocWithNode(FClassDocRecord& Record, FNodeRecord&& NodeRecord)
+{
+	Record.Nodes.Add(MoveTemp(NodeRecord));
+
 	return true;
 }
 
@@ -536,9 +778,56 @@ inline bool ShouldDocumentPin(UEdGraphPin* Pin)
 bool FNodeDocsGenerator::GenerateNodeDocs(UK2Node* Node, FNodeProcessingState& State)
 {
 	SCOPE_SECONDS_COUNTER(GenerateNodeDocsTime);
+	DOCGEN_TRACE_SCOPE(KantanDocGen_NodeDocs);
+
+	FNodeRecord NodeRecord;
+	NodeRecord.Id = State.NodeId;
+	NodeRecord.ShortTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+
+	NodeRecord.FullTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+	auto TargetIdx = NodeRecord.FullTitle.Find(TEXT("Target is "), ESearchCase::CaseSensitive);
+	if (TargetIdx != INDEX_NONE)
+	{
+		NodeRecord.FullTitle = NodeRecord.FullTitle.Left(TargetIdx).TrimEnd();
+	}
+
+	NodeRecord.Description = Node->GetTooltipText().ToString();
+	TargetIdx = NodeRecord.Description.Find(TEXT("Target is "), ESearchCase::CaseSensitive);
+	if (TargetIdx != INDEX_NONE)
+	{
+		NodeRecord.Description = NodeRecord.Description.Left(TargetIdx).TrimEnd();
+	}
+
+	NodeRecord.Category = Node->GetMenuCategory().ToString();
+	NodeRecord.ImageFilename = State.ImageFilename;
 
+	for (auto Pin : Node->Pins)
+	{
+		if (ShouldDocumentPin(Pin) && (Pin->Direction == EEdGraphPinDirection::EGPD_Input || Pin->Direction == EEdGraphPinDirection::EGPD_Output))
+		{
+			FPinRecord& PinRecord = (Pin->Direction == EEdGraphPinDirection::EGPD_Input ? NodeRecord.Inputs : NodeRecord.Outputs).AddDefaulted_GetRef();
+			ExtractPinInformation(Pin, NameCache, PinRecord.Name, PinRecord.Type, PinRecord.Description);
+		}
+	}
+
+	// Json output is written from the records at finalize
+	if (OutputFormat == EKantanDocGenOutputFormat::Html && !SaveNodeDocXml(State, NodeRecord))
+	{
+		return false;
+	}
+
+	if (!UpdateClassDocWithNode(*State.ClassDoc, MoveTemp(NodeRecord)))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool FNodeDocsGenerator::SaveNodeDocXml(FNodeProcessingState const& State, FNodeRecord const& NodeRecord)
+{
 	auto NodeDocsPath = State.ClassDocsPath / TEXT("nodes");
-	FString DocFilePath = NodeDocsPath / (GetNodeDocId(Node) + TEXT(".xml"));
+	FString DocFilePath = NodeDocsPath / (NodeRecord.Id + TEXT(".xml"));
 
 	const FString FileTemplate = R"xxx(<?xml version="1.0" encoding="UTF-8"?>
 <root></root>)xxx";
@@ -547,113 +836,662 @@ bool FNodeDocsGenerator::GenerateNodeDocs(UK2Node* Node, FNodeProcessingState& S
 	auto Root = File.GetRootNode();
 
 	AppendChildCDATA(Root, TEXT("docs_name"), DocsTitle);
-	// Since we pull these from the class xml file, the entries are already CDATA wrapped
-	AppendChildRaw(Root, TEXT("class_id"), State.ClassDocXml->GetRootNode()->FindChildNode(TEXT("id"))->GetContent());//GetClassDocId(Class));
-	AppendChildRaw(Root, TEXT("class_name"), State.ClassDocXml->GetRootNode()->FindChildNode(TEXT("display_name"))->GetContent());// FBlueprintEditorUtils::GetFriendlyClassDisplayName(Class).ToString());
+	AppendChildCDATA(Root, TEXT("class_id"), State.ClassDoc->Id);
+	AppendChildCDATA(Root, TEXT("class_name"), State.ClassDoc->DisplayName);
+	AppendChildCDATA(Root, TEXT("shorttitle"), NodeRecord.ShortTitle.TrimEnd());
+	AppendChildCDATA(Root, TEXT("fulltitle"), NodeRecord.FullTitle);
+	AppendChildCDATA(Root, TEXT("description"), NodeRecord.Description);
+	// No image if they're disabled
+	if (!NodeRecord.ImageFilename.IsEmpty())
+	{
+		AppendChildCDATA(Root, TEXT("imgpath"), State.RelImageBasePath / NodeRecord.ImageFilename);
+	}
+	AppendChildCDATA(Root, TEXT("category"), NodeRecord.Category);
+
+	auto AppendPins = [Root](const TCHAR* Name, TArray< FPinRecord > const& Pins)
+		{
+			auto Params = AppendChild(Root, Name);
+			for (FPinRecord const& Pin : Pins)
+			{
+				auto Param = AppendChild(Params, TEXT("param"));
+				AppendChildCDATA(Param, TEXT("name"), Pin.Name);
+				AppendChildCDATA(Param, TEXT("type"), Pin.Type);
+				AppendChildCDATA(Param, TEXT("description"), Pin.Description);
+			}
+		};
 
-	FString NodeShortTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-	AppendChildCDATA(Root, TEXT("shorttitle"), NodeShortTitle.TrimEnd());
+	AppendPins(TEXT("inputs"), NodeRecord.Inputs);
+	AppendPins(TEXT("outputs"), NodeRecord.Outputs);
 
-	FString NodeFullTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
-	auto TargetIdx = NodeFullTitle.Find(TEXT("Target is "), ESearchCase::CaseSensitive);
-	if (TargetIdx != INDEX_NONE)
 	{
-		NodeFullTitle = NodeFullTitle.Left(TargetIdx).TrimEnd();
+		DOCGEN_TRACE_SCOPE(KantanDocGen_SaveNodeXml);
+		if (!File.Save(DocFilePath))
+		{
+			return false;
+		}
 	}
-	AppendChildCDATA(Root, TEXT("fulltitle"), NodeFullTitle);
+	DOCGEN_TRACE_FILE_WRITTEN(DocFilePath);
 
-	FString NodeDesc = Node->GetTooltipText().ToString();
-	TargetIdx = NodeDesc.Find(TEXT("Target is "), ESearchCase::CaseSensitive);
-	if (TargetIdx != INDEX_NONE)
+	return true;
+}
+
+bool FNodeDocsGenerator::SaveIndexXml(FXmlFile* DocFile, FString const& OutDir)
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_SaveIndexXml);
+
+	auto Path = OutDir / TEXT("index.xml");
+	DocFile->Save(Path);
+	DOCGEN_TRACE_FILE_WRITTEN(Path);
+
+	return true;
+}
+
+bool FNodeDocsGenerator::SaveClassDocXml(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs)
+{
+	// @NOTE: The pages refer to the lists where they end up in the docs, alongside the class directories
+	const FString FunctionListsDir = ScriptsDir / FunctionListsDirName;
+	IFileManager::Get().DeleteDirectory(*FunctionListsDir, false, true);
+	IFileManager::Get().MakeDirectory(*FunctionListsDir, true);
+
+	// Everything needed is in the records and the hierarchy table, so classes can be written out in parallel.
+	// Each task only holds the DOM for the class it's working on.
+	TArray< int64 > FunctionListSizes;
+	FunctionListSizes.SetNumZeroed(Records.Num());
+	FThreadSafeCounter NumFailed;
+	ParallelFor(Records.Num(), [&](int32 Index)
+		{
+			DOCGEN_TRACE_SCOPE(KantanDocGen_ClassXml);
+
+			FClassDocRecord const& Record = *Records[Index];
+			TSharedPtr< FXmlFile > Doc = BuildClassDocXml(Record);
+
+			if (Record.Nodes.Num() > MaxInlineFunctions)
+			{
+				FunctionListSizes[Index] = SaveFunctionList(Record, FunctionListsDir);
+				if (FunctionListSizes[Index] < 0)
+				{
+					NumFailed.Increment();
+				}
+			}
+
+			if (ReflectionDocs)
+			{
+				if (auto Properties = ReflectionDocs->FindClassProperties(Record.Id))
+				{
+					FReflectionDocsGenerator::AppendPropertiesXml(Doc->GetRootNode(), *Properties);
+				}
+			}
+
+			auto Path = OutDir / Record.Id / (Record.Id + TEXT(".xml"));
+			if (!Doc->Save(Path))
+			{
+				NumFailed.Increment();
+			}
+			else
+			{
+				DOCGEN_TRACE_FILE_WRITTEN(Path);
+			}
+		});
+
+	NumClassDocFailures += NumFailed.GetValue();
+	if (NumFailed.GetValue() > 0)
 	{
-		NodeDesc = NodeDesc.Left(TargetIdx).TrimEnd();
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to save %i class doc files."), NumFailed.GetValue());
 	}
-	AppendChildCDATA(Root, TEXT("description"), NodeDesc);
-	AppendChildCDATA(Root, TEXT("imgpath"), State.RelImageBasePath / State.ImageFilename);
-	AppendChildCDATA(Root, TEXT("category"), Node->GetMenuCategory().ToString());
 
-	auto Inputs = AppendChild(Root, TEXT("inputs"));
-	for (auto Pin : Node->Pins)
+	TArray< int32 > BySize;
+	for (int32 Index = 0; Index < Records.Num(); ++Index)
 	{
-		if (Pin->Direction == EEdGraphPinDirection::EGPD_Input)
+		BySize.Add(Index);
+	}
+	BySize.StableSort([&Records](int32 A, int32 B)
 		{
-			if (ShouldDocumentPin(Pin))
-			{
-				auto Input = AppendChild(Inputs, TEXT("param"));
+			return Records[A]->Nodes.Num() > Records[B]->Nodes.Num();
+		});
 
-				FString PinName, PinType, PinDesc;
-				ExtractPinInformation(Pin, PinName, PinType, PinDesc);
+	LargestClassPages.Reset();
+	for (int32 Index = 0; Index < BySize.Num() && Index < NumLargestClassPages; ++Index)
+	{
+		FClassPageStats& Stats = LargestClassPages.AddDefaulted_GetRef();
+		Stats.Id = Records[BySize[Index]]->Id;
+		Stats.NumNodes = Records[BySize[Index]]->Nodes.Num();
+		Stats.FunctionListBytes = FMath::Max< int64 >(0, FunctionListSizes[BySize[Index]]);
+	}
 
-				AppendChildCDATA(Input, TEXT("name"), PinName);
-				AppendChildCDATA(Input, TEXT("type"), PinType);
-				AppendChildCDATA(Input, TEXT("description"), PinDesc);
+	return true;
+}
+
+int64 FNodeDocsGenerator::SaveFunctionList(FClassDocRecord const& Record, FString const& OutDir) const
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_FunctionList);
+
+	// Sorted by title as the page lists them, so it never has to sort
+	TArray< FNodeRecord const* > Nodes;
+	for (FNodeRecord const& Node : Record.Nodes)
+	{
+		Nodes.Add(&Node);
+	}
+	Nodes.Sort([](FNodeRecord const& A, FNodeRecord const& B)
+		{
+			const int32 TitleOrder = A.ShortTitle.Compare(B.ShortTitle, ESearchCase::CaseSensitive);
+			return TitleOrder != 0 ? TitleOrder < 0 : A.Id.Compare(B.Id, ESearchCase::CaseSensitive) < 0;
+		});
+
+	// [[id, title, description], ...]
+	FString Json;
+	TSharedRef< FDocGenJsonWriter > Writer = FDocGenJsonWriterFactory::Create(&Json);
+	Writer->WriteArrayStart();
+	for (FNodeRecord const* Node : Nodes)
+	{
+		Writer->WriteArrayStart();
+		Writer->WriteValue(Node->Id);
+		Writer->WriteValue(Node->ShortTitle);
+		Writer->WriteValue(Node->Description);
+		Writer->WriteArrayEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->Close();
+
+	return SaveJsonScript(OutDir / (Record.Id + TEXT(".js")), TEXT("KantanDocGenFunctions.load"), Json);
+}
+
+bool FNodeDocsGenerator::SaveSearchIndex(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs)
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_SearchIndex);
+
+	// Records (and their nodes) are already sorted, and types are added in the index's order, so entries are stable.
+	FDocGenSearchIndex SearchIndex;
+	for (FClassDocRecord const* Record : Records)
+	{
+		const int32 ClassEntry = SearchIndex.AddEntry(FDocGenSearchIndex::EEntryKind::Class, Record->DisplayName,
+			Record->Id / (Record->Id + TEXT(".html")), Record->ModuleName);
+		SearchIndex.AddText(ClassEntry, Record->DisplayName, FDocGenSearchIndex::TitleWeight);
+		SearchIndex.AddText(ClassEntry, Record->Id, FDocGenSearchIndex::TitleWeight);
+		SearchIndex.AddText(ClassEntry, Record->Description, FDocGenSearchIndex::DescriptionWeight);
+
+		for (FNodeRecord const& NodeRecord : Record->Nodes)
+		{
+			const int32 NodeEntry = SearchIndex.AddEntry(FDocGenSearchIndex::EEntryKind::Node, NodeRecord.ShortTitle.TrimEnd(),
+				Record->Id / TEXT("nodes") / (NodeRecord.Id + TEXT(".html")), Record->DisplayName);
+			SearchIndex.AddText(NodeEntry, NodeRecord.ShortTitle, FDocGenSearchIndex::TitleWeight);
+			SearchIndex.AddText(NodeEntry, NodeRecord.Category, FDocGenSearchIndex::CategoryWeight);
+			for (FPinRecord const& Pin : NodeRecord.Inputs)
+			{
+				SearchIndex.AddText(NodeEntry, Pin.Name, FDocGenSearchIndex::PinWeight);
+			}
+			for (FPinRecord const& Pin : NodeRecord.Outputs)
+			{
+				SearchIndex.AddText(NodeEntry, Pin.Name, FDocGenSearchIndex::PinWeight);
 			}
+			SearchIndex.AddText(NodeEntry, NodeRecord.Description, FDocGenSearchIndex::DescriptionWeight);
 		}
 	}
 
-	auto Outputs = AppendChild(Root, TEXT("outputs"));
-	for (auto Pin : Node->Pins)
+	if (ReflectionDocs)
 	{
-		if (Pin->Direction == EEdGraphPinDirection::EGPD_Output)
+		TArray< FReflectionDocsGenerator::FTypeRecord const* > Types;
+		for (FReflectionDocsGenerator::FTypeRecord const& Type : ReflectionDocs->GetTypes())
 		{
-			if (ShouldDocumentPin(Pin))
+			Types.Add(&Type);
+		}
+
+		Types.Sort([](FReflectionDocsGenerator::FTypeRecord const& A, FReflectionDocsGenerator::FTypeRecord const& B)
 			{
-				auto Output = AppendChild(Outputs, TEXT("param"));
+				return A.Kind != B.Kind ? A.Kind < B.Kind : A.Id.Compare(B.Id, ESearchCase::CaseSensitive) < 0;
+			});
 
-				FString PinName, PinType, PinDesc;
-				ExtractPinInformation(Pin, PinName, PinType, PinDesc);
+		for (FReflectionDocsGenerator::FTypeRecord const* Type : Types)
+		{
+			const bool bIsStruct = Type->Kind == FReflectionDocsGenerator::ETypeKind::Struct;
+			const int32 TypeEntry = SearchIndex.AddEntry(bIsStruct ? FDocGenSearchIndex::EEntryKind::Struct : FDocGenSearchIndex::EEntryKind::Enum,
+				Type->DisplayName, Type->Id / (Type->Id + TEXT(".html")), Type->ModuleName);
+			SearchIndex.AddText(TypeEntry, Type->DisplayName, FDocGenSearchIndex::TitleWeight);
+			SearchIndex.AddText(TypeEntry, Type->Id, FDocGenSearchIndex::TitleWeight);
+			SearchIndex.AddText(TypeEntry, Type->Description, FDocGenSearchIndex::DescriptionWeight);
+		}
+	}
 
-				AppendChildCDATA(Output, TEXT("name"), PinName);
-				AppendChildCDATA(Output, TEXT("type"), PinType);
-				AppendChildCDATA(Output, TEXT("description"), PinDesc);
-			}
+	const bool bSaved = SearchIndex.Save(OutDir / FDocGenSearchIndex::DirectoryName);
+	SearchIndexStats = SearchIndex.GetStats();
+	return bSaved;
+}
+
+bool FNodeDocsGenerator::SaveIndexFragments(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs)
+{
+	DOCGEN_TRACE_SCOPE(KantanDocGen_IndexFragments);
+
+	// @NOTE: The index page only lists plugins and modules, each module's contents are written out here as a script
+	// (so it loads from disk too) which the page runs when the module is first expanded. Module names are unique, and
+	// safe to use as file names.
+	struct FIndexRow
+	{
+		FString const* Id;
+		FString const* DisplayName;
+		FString const* Description;
+	};
+
+	struct FModuleFragment
+	{
+		TArray< FIndexRow > Classes;
+		TArray< FIndexRow > Structs;
+		TArray< FIndexRow > Enums;
+	};
+
+	TMap< FString, FModuleFragment > Fragments;
+	for (FClassDocRecord const* Record : Records)
+	{
+		Fragments.FindOrAdd(Record->ModuleName).Classes.Add(FIndexRow{ &Record->Id, &Record->DisplayName, &Record->Description });
+	}
+
+	if (ReflectionDocs)
+	{
+		for (FReflectionDocsGenerator::FTypeRecord const& Type : ReflectionDocs->GetTypes())
+		{
+			FModuleFragment& Fragment = Fragments.FindOrAdd(Type.ModuleName);
+			TArray< FIndexRow >& Rows = Type.Kind == FReflectionDocsGenerator::ETypeKind::Struct ? Fragment.Structs : Fragment.Enums;
+			Rows.Add(FIndexRow{ &Type.Id, &Type.DisplayName, &Type.Description });
 		}
 	}
 
-	if (!File.Save(DocFilePath))
+	TArray< FString > ModuleNames;
+	Fragments.GenerateKeyArray(ModuleNames);
+
+	const FString FragmentsDir = OutDir / IndexFragmentsDirName;
+	IFileManager::Get().DeleteDirectory(*FragmentsDir, false, true);
+	IFileManager::Get().MakeDirectory(*FragmentsDir, true);
+
+	TArray< int64 > FragmentSizes;
+	FragmentSizes.SetNumZeroed(ModuleNames.Num());
+	FThreadSafeCounter NumFailed;
+	ParallelFor(ModuleNames.Num(), [&](int32 Index)
+		{
+			FModuleFragment& Fragment = Fragments[ModuleNames[Index]];
+
+			FString Json;
+			TSharedRef< FDocGenJsonWriter > Writer = FDocGenJsonWriterFactory::Create(&Json);
+			Writer->WriteObjectStart();
+
+			// Listed by display name, as the index always has been
+			auto WriteRows = [&Writer](const TCHAR* Name, TArray< FIndexRow >& Rows)
+				{
+					Rows.Sort([](FIndexRow const& A, FIndexRow const& B)
+						{
+							const int32 NameOrder = A.DisplayName->Compare(*B.DisplayName, ESearchCase::CaseSensitive);
+							return NameOrder != 0 ? NameOrder < 0 : A.Id->Compare(*B.Id, ESearchCase::CaseSensitive) < 0;
+						});
+
+					Writer->WriteArrayStart(Name);
+					for (FIndexRow const& Row : Rows)
+					{
+						Writer->WriteArrayStart();
+						Writer->WriteValue(*Row.Id);
+						Writer->WriteValue(*Row.DisplayName);
+						Writer->WriteValue(*Row.Description);
+						Writer->WriteArrayEnd();
+					}
+					Writer->WriteArrayEnd();
+				};
+
+			WriteRows(TEXT("classes"), Fragment.Classes);
+			WriteRows(TEXT("structs"), Fragment.Structs);
+			WriteRows(TEXT("enums"), Fragment.Enums);
+			Writer->WriteObjectEnd();
+			Writer->Close();
+
+			FragmentSizes[Index] = SaveJsonScript(FragmentsDir / (ModuleNames[Index] + TEXT(".js")), TEXT("KantanDocGenIndex.addModule"), Json, ModuleNames[Index]);
+			if (FragmentSizes[Index] < 0)
+			{
+				FragmentSizes[Index] = 0;
+				NumFailed.Increment();
+			}
+		});
+
+	NumIndexFragments = ModuleNames.Num();
+	IndexFragmentBytes = 0;
+	LargestIndexFragmentBytes = 0;
+	for (int64 Size : FragmentSizes)
 	{
-		return false;
+		IndexFragmentBytes += Size;
+		LargestIndexFragmentBytes = FMath::Max(LargestIndexFragmentBytes, Size);
 	}
 
-	if (!UpdateClassDocWithNode(State.ClassDocXml.Get(), Node, NodeDesc))
+	if (NumFailed.GetValue() > 0)
 	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to save %i index fragments."), NumFailed.GetValue());
 		return false;
 	}
 
 	return true;
 }
 
-bool FNodeDocsGenerator::SaveIndexXml(FString const& OutDir)
+bool FNodeDocsGenerator::SaveViewerData(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs)
 {
-	auto Path = OutDir / TEXT("index.xml");
-	IndexXml->Save(Path);
+	DOCGEN_TRACE_SCOPE(KantanDocGen_ViewerData);
 
-	return true;
-}
+	auto WriteProperties = [](TSharedRef< FDocGenJsonWriter > const& Writer, TArray< FReflectionDocsGenerator::FPropertyRecord > const& Properties)
+		{
+			// [[name, type, description, category, read only], ...]
+			Writer->WriteArrayStart(TEXT("properties"));
+			for (FReflectionDocsGenerator::FPropertyRecord const& Property : Properties)
+			{
+				Writer->WriteArrayStart();
+				Writer->WriteValue(Property.Name);
+				Writer->WriteValue(Property.Type);
+				Writer->WriteValue(Property.Description);
+				Writer->WriteValue(Property.Category);
+				Writer->WriteValue(Property.bReadOnly);
+				Writer->WriteArrayEnd();
+			}
+			Writer->WriteArrayEnd();
+		};
 
-bool FNodeDocsGenerator::SaveClassDocXml(FString const& OutDir)
-{
-	for (auto const& Entry : ClassDocsMap)
+	auto WritePins = [](TSharedRef< FDocGenJsonWriter > const& Writer, const TCHAR* Name, TArray< FPinRecord > const& Pins)
+		{
+			// [[name, type, description], ...]
+			Writer->WriteArrayStart(Name);
+			for (FPinRecord const& Pin : Pins)
+			{
+				Writer->WriteArrayStart();
+				Writer->WriteValue(Pin.Name);
+				Writer->WriteValue(Pin.Type);
+				Writer->WriteValue(Pin.Description);
+				Writer->WriteArrayEnd();
+			}
+			Writer->WriteArrayEnd();
+		};
+
+	// @NOTE: Classes, structs and enums can share an id, so each kind gets its own prefix. Without one, a type could
+	// also overwrite the index.
+	auto GetDataKey = [](const TCHAR* Kind, FString const& Id)
+		{
+			return FString::Printf(TEXT("%s_%s"), Kind, *Id);
+		};
+
+	auto WriteHierarchyEntry = [this, &GetDataKey](TSharedRef< FDocGenJsonWriter > const& Writer, int32 EntryIndex)
+		{
+			// [key, name], with an empty key if the class isn't documented
+			FDocGenClassHierarchy::FEntry const& Entry = ClassHierarchy.Get(EntryIndex);
+			Writer->WriteArrayStart();
+			Writer->WriteValue(Entry.bDocumented ? GetDataKey(TEXT("class"), Entry.Id) : FString());
+			Writer->WriteValue(Entry.DisplayName);
+			Writer->WriteArrayEnd();
+		};
+
+	struct FIndexRow
+	{
+		FString Key;
+		FString const* DisplayName;
+		FString const* Description;
+	};
+
+	TArray< FReflectionDocsGenerator::FTypeRecord const* > Types;
+	if (ReflectionDocs)
+	{
+		for (FReflectionDocsGenerator::FTypeRecord const& Type : ReflectionDocs->GetTypes())
+		{
+			Types.Add(&Type);
+		}
+
+		Types.Sort([](FReflectionDocsGenerator::FTypeRecord const& A, FReflectionDocsGenerator::FTypeRecord const& B)
+			{
+				return A.Kind != B.Kind ? A.Kind < B.Kind : A.Id.Compare(B.Id, ESearchCase::CaseSensitive) < 0;
+			});
+	}
+
+	const FString DataDir = OutDir / ViewerDataDirName;
+	IFileManager::Get().DeleteDirectory(*DataDir, false, true);
+	IFileManager::Get().MakeDirectory(*DataDir, true);
+
+	// A file per class and per type, then the index
+	const int32 NumFiles = Records.Num() + Types.Num() + 1;
+	TArray< int64 > FileSizes;
+	FileSizes.SetNumZeroed(NumFiles);
+	FThreadSafeCounter NumFailed;
+	ParallelFor(NumFiles, [&](int32 Index)
+		{
+			FString Json;
+			TSharedRef< FDocGenJsonWriter > Writer = FDocGenJsonWriterFactory::Create(&Json);
+			FString Key;
+
+			if (Index < Records.Num())
+			{
+				FClassDocRecord const& Record = *Records[Index];
+				Key = GetDataKey(TEXT("class"), Record.Id);
+
+				Writer->WriteObjectStart();
+				Writer->WriteValue(TEXT("kind"), TEXT("class"));
+				Writer->WriteValue(TEXT("id"), Record.Id);
+				Writer->WriteValue(TEXT("name"), Record.DisplayName);
+				Writer->WriteValue(TEXT("description"), Record.Description);
+				Writer->WriteValue(TEXT("module"), Record.ModuleName);
+				Writer->WriteValue(TEXT("header"), Record.HeaderPath);
+				Writer->WriteValue(TEXT("source"), Record.HeaderPath.IsEmpty() ? FString() : Record.SourcePath);
+				Writer->WriteValue(TEXT("include"), Record.IncludePath);
+
+				TArray< int32, TInlineAllocator< 32 > > Ancestors;
+				ClassHierarchy.GetAncestors(Record.HierarchyIndex, Ancestors);
+				Writer->WriteArrayStart(TEXT("inheritance"));
+				for (int32 AncestorIndex : Ancestors)
+				{
+					WriteHierarchyEntry(Writer, AncestorIndex);
+				}
+				Writer->WriteArrayEnd();
+
+				Writer->WriteArrayStart(TEXT("interfaces"));
+				for (int32 InterfaceIndex : ClassHierarchy.Get(Record.HierarchyIndex).Interfaces)
+				{
+					WriteHierarchyEntry(Writer, InterfaceIndex);
+				}
+				Writer->WriteArrayEnd();
+
+				auto Properties = ReflectionDocs ? ReflectionDocs->FindClassProperties(Record.Id) : nullptr;
+				WriteProperties(Writer, Properties ? *Properties : TArray< FReflectionDocsGenerator::FPropertyRecord >());
+
+				Writer->WriteArrayStart(TEXT("nodes"));
+				for (FNodeRecord const& Node : Record.Nodes)
+				{
+					Writer->WriteObjectStart();
+					Writer->WriteValue(TEXT("id"), Node.Id);
+					Writer->WriteValue(TEXT("title"), Node.ShortTitle.TrimEnd());
+					Writer->WriteValue(TEXT("fullTitle"), Node.FullTitle);
+					Writer->WriteValue(TEXT("description"), Node.Description);
+					Writer->WriteValue(TEXT("category"), Node.Category);
+					// Images stay where the html output puts them, relative to the viewer page
+					Writer->WriteValue(TEXT("image"), Node.ImageFilename.IsEmpty() ? FString() : Record.Id / TEXT("img") / Node.ImageFilename);
+					WritePins(Writer, TEXT("inputs"), Node.Inputs);
+					WritePins(Writer, TEXT("outputs"), Node.Outputs);
+					Writer->WriteObjectEnd();
+				}
+				Writer->WriteArrayEnd();
+				Writer->WriteObjectEnd();
+			}
+			else if (Index < Records.Num() + Types.Num())
+			{
+				FReflectionDocsGenerator::FTypeRecord const& Type = *Types[Index - Records.Num()];
+				const bool bIsStruct = Type.Kind == FReflectionDocsGenerator::ETypeKind::Struct;
+				Key = GetDataKey(bIsStruct ? TEXT("struct") : TEXT("enum"), Type.Id);
+
+				Writer->WriteObjectStart();
+				Writer->WriteValue(TEXT("kind"), bIsStruct ? TEXT("struct") : TEXT("enum"));
+				Writer->WriteValue(TEXT("id"), Type.Id);
+				Writer->WriteValue(TEXT("name"), Type.DisplayName);
+				Writer->WriteValue(TEXT("description"), Type.Description);
+				Writer->WriteValue(TEXT("module"), Type.ModuleName);
+				Writer->WriteValue(TEXT("include"), Type.IncludePath);
+				if (bIsStruct)
+				{
+					WriteProperties(Writer, Type.Properties);
+				}
+				else
+				{
+					// [[name, description, value], ...]
+					Writer->WriteArrayStart(TEXT("enumerators"));
+					for (FReflectionDocsGenerator::FEnumeratorRecord const& Enumerator : Type.Enumerators)
+					{
+						Writer->WriteArrayStart();
+						Writer->WriteValue(Enumerator.Name);
+						Writer->WriteValue(Enumerator.Description);
+						Writer->WriteValue(Enumerator.Value);
+						Writer->WriteArrayEnd();
+					}
+					Writer->WriteArrayEnd();
+				}
+				Writer->WriteObjectEnd();
+			}
+			else
+			{
+				// {title, plugins: [{name, description, modules: [{name, classes, structs, enums}]}]}, in the order the
+				// html index lists them, with [key, name, description] rows
+				Key = TEXT("index");
+
+				TMap< FString, TArray< FClassDocRecord const* > > ModuleClasses;
+				for (FClassDocRecord const* Record : Records)
+				{
+					ModuleClasses.FindOrAdd(Record->ModuleName).Add(Record);
+				}
+
+				TMap< FString, TArray< FReflectionDocsGenerator::FTypeRecord const* > > ModuleTypes;
+				for (FReflectionDocsGenerator::FTypeRecord const* Type : Types)
+				{
+					ModuleTypes.FindOrAdd(Type->ModuleName).Add(Type);
+				}
+
+				TSet< FString > ModuleNameSet;
+				for (auto const& Entry : ModuleClasses)
+				{
+					ModuleNameSet.Add(Entry.Key);
+				}
+				for (auto const& Entry : ModuleTypes)
+				{
+					ModuleNameSet.Add(Entry.Key);
+				}
+
+				TArray< TPair< FString const*, TPair< FString, FString > const* > > Modules;
+				for (FString const& ModuleName : ModuleNameSet)
+				{
+					Modules.Emplace(&ModuleName, &ModulePluginNameAndDesc.FindChecked(*ModuleName));
+				}
+
+				Modules.Sort([](auto const& A, auto const& B)
+					{
+						const int32 PluginOrder = A.Value->Key.Compare(B.Value->Key, ESearchCase::CaseSensitive);
+						return PluginOrder != 0 ? PluginOrder < 0 : A.Key->Compare(*B.Key, ESearchCase::CaseSensitive) < 0;
+					});
+
+				auto WriteRows = [&Writer](const TCHAR* Name, TArray< FIndexRow >& Rows)
+					{
+						Rows.Sort([](FIndexRow const& A, FIndexRow const& B)
+							{
+								const int32 NameOrder = A.DisplayName->Compare(*B.DisplayName, ESearchCase::CaseSensitive);
+								return NameOrder != 0 ? NameOrder < 0 : A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+							});
+
+						Writer->WriteArrayStart(Name);
+						for (FIndexRow const& Row : Rows)
+						{
+							Writer->WriteArrayStart();
+							Writer->WriteValue(Row.Key);
+							Writer->WriteValue(*Row.DisplayName);
+							Writer->WriteValue(*Row.Description);
+							Writer->WriteArrayEnd();
+						}
+						Writer->WriteArrayEnd();
+					};
+
+				Writer->WriteObjectStart();
+				Writer->WriteValue(TEXT("title"), DocsTitle);
+				Writer->WriteArrayStart(TEXT("plugins"));
+				FString const* CurrentPlugin = nullptr;
+				for (auto const& Module : Modules)
+				{
+					if (CurrentPlugin == nullptr || !CurrentPlugin->Equals(Module.Value->Key, ESearchCase::CaseSensitive))
+					{
+						if (CurrentPlugin)
+						{
+							Writer->WriteArrayEnd();
+							Writer->WriteObjectEnd();
+						}
+						CurrentPlugin = &Module.Value->Key;
+						Writer->WriteObjectStart();
+						Writer->WriteValue(TEXT("name"), Module.Value->Key);
+						Writer->WriteValue(TEXT("description"), Module.Value->Value);
+						Writer->WriteArrayStart(TEXT("modules"));
+					}
+
+					TArray< FIndexRow > Classes, Structs, Enums;
+					if (auto ClassRecords = ModuleClasses.Find(*Module.Key))
+					{
+						for (FClassDocRecord const* Record : *ClassRecords)
+						{
+							Classes.Add(FIndexRow{ GetDataKey(TEXT("class"), Record->Id), &Record->DisplayName, &Record->Description });
+						}
+					}
+					if (auto TypeRecords = ModuleTypes.Find(*Module.Key))
+					{
+						for (FReflectionDocsGenerator::FTypeRecord const* Type : *TypeRecords)
+						{
+							const bool bIsStruct = Type->Kind == FReflectionDocsGenerator::ETypeKind::Struct;
+							TArray< FIndexRow >& Rows = bIsStruct ? Structs : Enums;
+							Rows.Add(FIndexRow{ GetDataKey(bIsStruct ? TEXT("struct") : TEXT("enum"), Type->Id), &Type->DisplayName, &Type->Description });
+						}
+					}
+
+					Writer->WriteObjectStart();
+					Writer->WriteValue(TEXT("name"), *Module.Key);
+					WriteRows(TEXT("classes"), Classes);
+					WriteRows(TEXT("structs"), Structs);
+					WriteRows(TEXT("enums"), Enums);
+					Writer->WriteObjectEnd();
+				}
+				if (CurrentPlugin)
+				{
+					Writer->WriteArrayEnd();
+					Writer->WriteObjectEnd();
+				}
+				Writer->WriteArrayEnd();
+				Writer->WriteObjectEnd();
+			}
+
+			Writer->Close();
+
+			FileSizes[Index] = SaveJsonScript(DataDir / (Key + TEXT(".js")), TEXT("KantanDocGenViewer.addData"), Json, Key);
+			if (FileSizes[Index] < 0)
+			{
+				NumFailed.Increment();
+			}
+		});
+
+	int64 TotalBytes = 0;
+	for (int64 Size : FileSizes)
 	{
-		auto ClassId = GetClassDocId(Entry.Key.Get());
-		auto Path = OutDir / ClassId / (ClassId + TEXT(".xml"));
-		Entry.Value->Save(Path);
+		TotalBytes += FMath::Max< int64 >(0, Size);
 	}
 
+	NumClassDocFailures += NumFailed.GetValue();
+	if (NumFailed.GetValue() > 0)
+	{
+		UE_LOG(LogKantanDocGen, Error, TEXT("Failed to save %i viewer data files."), NumFailed.GetValue());
+		return false;
+	}
+
+	UE_LOG(LogKantanDocGen, Log, TEXT("Viewer data: %i files, %.1f KB."), NumFiles, TotalBytes / 1024.0);
 	return true;
 }
 
-
-void FNodeDocsGenerator::AdjustNodeForSnapshot(UEdGraphNode* Node)
+UEdGraphPin* FNodeDocsGenerator::AdjustNodeForSnapshot(UEdGraphNode* Node)
 {
 	// Hide default value box containing 'self' for Target pin
 	if (auto K2_Schema = Cast< UEdGraphSchema_K2 >(Node->GetSchema()))
 	{
-		if (auto TargetPin = Node->FindPin(K2_Schema->PN_Self))
+		auto TargetPin = Node->FindPin(K2_Schema->PN_Self);
+		if (TargetPin && !TargetPin->bDefaultValueIsIgnored)
 		{
 			TargetPin->bDefaultValueIsIgnored = true;
+			return TargetPin;
 		}
 	}
+
+	return nullptr;
 }
 
 FString FNodeDocsGenerator::GetClassDocId(UClass* Class)
@@ -667,6 +1505,22 @@ FString FNodeDocsGenerator::GetNodeDocId(UEdGraphNode* Node)
 	return Node->GetDocumentationExcerptName();
 }
 
+FString FNodeDocsGenerator::MakeUniqueNodeDocId(FClassDocRecord& Record, FString const& BaseId)
+{
+	// Distinct nodes can share an excerpt name, and would otherwise overwrite each other's docs.
+	// Source objects are enumerated in path order (see FNativeTypeIndex and FContentPathEnumerator), spawners within
+	// each in signature order, and ids are reserved whether or not the node succeeds, so which one gets which suffix
+	// is the same from run to run.
+	// @NOTE: FString hashing and comparison ignore case, as do the filesystems the docs get written to.
+	FString Id = BaseId;
+	for (int32 Suffix = 2; Record.NodeIds.Contains(Id); ++Suffix)
+	{
+		Id = FString::Printf(TEXT("%s_%i"), *BaseId, Suffix);
+	}
+	Record.NodeIds.Add(Id);
+	return Id;
+}
+
 
 #include "BlueprintVariableNodeSpawner.h"
 #include "BlueprintDelegateNodeSpawner.h"
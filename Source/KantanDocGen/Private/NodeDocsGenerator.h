@@ -9,6 +9,10 @@
 #include "Modules/ModuleManager.h"
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "DocGenNameCache.h"
+#include "DocGenClassHierarchy.h"
+#include "DocGenSearchIndex.h"
+#include "DocGenSettings.h"
 
 
 class UClass;
@@ -18,6 +22,9 @@ class UEdGraphNode;
 class UK2Node;
 class UBlueprintNodeSpawner;
 class FXmlFile;
+class FXmlNode;
+class FReflectionDocsGenerator;
+class FDocGenSourceIndex;
 
 class FNodeDocsGenerator
 {
@@ -27,16 +34,80 @@ public:
 	~FNodeDocsGenerator();
 
 public:
+	struct FPinRecord
+	{
+		FString Name;
+		FString Type;
+		FString Description;
+
+		friend FArchive& operator<< (FArchive& Ar, FPinRecord& Record)
+		{
+			return Ar << Record.Name << Record.Type << Record.Description;
+		}
+	};
+
+	/*
+	Compact, append-only record of a documented class. The class xml is only built from it (and discarded again)
+	at finalize, so we don't hold a DOM per class for the whole run.
+	*/
+	struct FNodeRecord
+	{
+		FString Id;
+		FString ShortTitle;
+		FString FullTitle;
+		FString Description;
+		FString Category;
+		// Within the class's img directory, empty if there's no image
+		FString ImageFilename;
+		TArray< FPinRecord > Inputs;
+		TArray< FPinRecord > Outputs;
+
+		friend FArchive& operator<< (FArchive& Ar, FNodeRecord& Record)
+		{
+			return Ar << Record.Id << Record.ShortTitle << Record.FullTitle << Record.Description << Record.Category
+				<< Record.ImageFilename << Record.Inputs << Record.Outputs;
+		}
+	};
+
+	struct FClassDocRecord
+	{
+		// Used to resolve the class again when resuming from a checkpoint
+		FString ClassPath;
+		FString Id;
+		FString DisplayName;
+		// Empty if the same as the display name
+		FString Description;
+		FString ModuleName;
+		FString HeaderPath;
+		FString SourcePath;
+		FString IncludePath;
+		// Inheritance and interfaces, linked up at finalize once we know which classes are documented
+		int32 HierarchyIndex = INDEX_NONE;
+		TArray< FNodeRecord > Nodes;
+		// Every node id handed out for the class, including those of nodes which then failed
+		TSet< FString > NodeIds;
+
+		// The hierarchy index isn't persisted, it's rebuilt when the class is resolved
+		friend FArchive& operator<< (FArchive& Ar, FClassDocRecord& Record)
+		{
+			return Ar << Record.ClassPath << Record.Id << Record.DisplayName << Record.Description << Record.ModuleName
+				<< Record.HeaderPath << Record.SourcePath << Record.IncludePath << Record.Nodes << Record.NodeIds;
+		}
+	};
+
 	struct FNodeProcessingState
 	{
-		TSharedPtr< FXmlFile > ClassDocXml;
+		TSharedPtr< FClassDocRecord > ClassDoc;
 		FString ClassDocsPath;
+		// Unique within the class
+		FString NodeId;
 		FString RelImageBasePath;
 		FString ImageFilename;
 
 		FNodeProcessingState() :
-			ClassDocXml()
+			ClassDoc()
 			, ClassDocsPath()
+			, NodeId()
 			, RelImageBasePath()
 			, ImageFilename()
 		{}
@@ -46,9 +117,16 @@ public:
 	/** Callable only from game thread */
 	bool GT_Init(FString const& InDocsTitle, FString const& InOutputDir,
 		const TMap<FName, TPair<FString, FString>>& InModulePluginNameAndDesc,
-		UClass* BlueprintContextClass = AActor::StaticClass());
+		UClass* BlueprintContextClass = AActor::StaticClass(), bool bInUseTemplateNodes = false);
 	UK2Node* GT_InitializeForSpawner(UBlueprintNodeSpawner* Spawner, UObject* SourceObject, FNodeProcessingState& OutState);
-	bool GT_Finalize(FString OutputPath);
+	UK2Node* GT_SpawnNode(UBlueprintNodeSpawner* Spawner);
+	// Unroots the node and, unless it's a shared template node, removes it from the graph once its image and docs are done.
+	void GT_ReleaseNode(UEdGraphNode* Node);
+	// Replaces the graph (and its panel) with a fresh one, so that anything the old one accumulated can be GCd.
+	bool GT_RecycleGraph();
+	bool GT_Finalize(FString OutputPath, FReflectionDocsGenerator const* ReflectionDocs = nullptr);
+	// Re-adds class records saved in a checkpoint. Returns the number of nodes they hold.
+	int32 GT_RestoreClassDocRecords(TArray< TSharedPtr< FClassDocRecord > > const& Records);
 	/**/
 
 	/** Callable from background thread */
@@ -56,39 +134,107 @@ public:
 	bool GenerateNodeDocs(UK2Node* Node, FNodeProcessingState& State);
 	/**/
 
+	// Where each module's classes, structs and enums are written for the index page to load as it's expanded
+	static const TCHAR* const IndexFragmentsDirName;
+	// Where the viewer's data is written in json output
+	static const TCHAR* const ViewerDataDirName;
+	// Where the function lists of classes with more than MaxInlineFunctions nodes are written, for their pages to page through
+	static const TCHAR* const FunctionListsDirName;
+	static const int32 MaxInlineFunctions = 100;
+	// The classes with the most nodes, whose pages are reported on
+	static const int32 NumLargestClassPages = 5;
+
+	struct FClassPageStats
+	{
+		FString Id;
+		int32 NumNodes = 0;
+		// Zero if the functions are listed in the page itself
+		int64 FunctionListBytes = 0;
+	};
+
+	static bool IsSpawnerDocumentable(UBlueprintNodeSpawner* Spawner, bool bIsBlueprint);
+	static FString GetClassDocId(UClass* Class);
+
+	int32 GetNumNodesInGraph() const { return NumNodesInGraph; }
+	int32 GetNumClassDocs() const { return ClassDocsMap.Num(); }
+	FDocGenNameCache& GetNameCache() { return NameCache; }
+	// Json output writes no xml, only data for the viewer at finalize
+	void SetOutputFormat(EKantanDocGenOutputFormat InOutputFormat) { OutputFormat = InOutputFormat; }
+	// Used for class header/source paths where possible, instead of FSourceCodeNavigation
+	void SetSourceIndex(TSharedPtr< const FDocGenSourceIndex > InSourceIndex) { SourceIndex = InSourceIndex; }
+	// Scripts loaded by the pages are written here, rather than among the xml handed to the conversion tool
+	void SetScriptsDir(FString const& InScriptsDir) { ScriptsDir = InScriptsDir; }
+	// Only valid while no nodes are being processed
+	void GetClassDocRecords(TArray< TSharedPtr< FClassDocRecord > >& OutRecords) const { ClassDocsMap.GenerateValueArray(OutRecords); }
+
 protected:
 	void CleanUp();
+	bool CreateGraph();
+	void ReleaseGraph();
 	TSharedPtr< FXmlFile > InitIndexXml(FString const& IndexTitle);
-	TSharedPtr< FXmlFile > InitClassDocXml(UClass* Class, const FString& ModuleName);
-	void FinalizeClassDocXml(UClass* Class, TSharedPtr<FXmlFile> Doc);
-	bool UpdateIndexDocWithClass(FXmlFile* DocFile, UClass* Class, const FString& ModuleName,
+	TSharedPtr< FClassDocRecord > InitClassDocRecord(UClass* Class, const FString& ModuleName);
+	TSharedPtr< FXmlFile > BuildClassDocXml(FClassDocRecord const& Record) const;
+	// Node summaries sorted by title, as a script for the class page to render a page at a time. Returns its size, or -1 on failure.
+	int64 SaveFunctionList(FClassDocRecord const& Record, FString const& OutDir) const;
+	void AddIndexModules(FXmlFile* DocFile, TArray< FClassDocRecord const* > const& Records, FReflectionDocsGenerator const* ReflectionDocs);
+	bool UpdateIndexDocWithClass(FXmlFile* DocFile, FClassDocRecord const& Record);
+	bool UpdateIndexDocWithReflectedTypes(FXmlFile* DocFile, FReflectionDocsGenerator const& ReflectionDocs);
+	static FXmlNode* FindOrAddIndexModule(FXmlFile* DocFile, const FString& ModuleName,
 		const FString& PluginName, const FString& PluginDescription);
-	bool UpdateClassDocWithNode(FXmlFile* DocFile, UEdGraphNode* Node, const FString& NodeDesc);
-	bool SaveIndexXml(FString const& OutDir);
-	bool SaveClassDocXml(FString const& OutDir);
-
-	static void AdjustNodeForSnapshot(UEdGraphNode* Node);
-	static FString GetClassDocId(UClass* Class);
+	bool UpdateClassDocWithNode(FClassDocRecord& Record, FNodeRecord&& NodeRecord);
+	bool SaveNodeDocXml(FNodeProcessingState const& State, FNodeRecord const& NodeRecord);
+	bool SaveIndexXml(FXmlFile* DocFile, FString const& OutDir);
+	bool SaveClassDocXml(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs);
+	bool SaveSearchIndex(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs);
+	bool SaveIndexFragments(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs);
+	// The index and a file per class, struct and enum, for the viewer
+	bool SaveViewerData(TArray< FClassDocRecord const* > const& Records, FString const& OutDir, FReflectionDocsGenerator const* ReflectionDocs);
+
+	// Returns the pin that was changed, if any, so it can be restored once the image is drawn
+	static UEdGraphPin* AdjustNodeForSnapshot(UEdGraphNode* Node);
 	static FString GetNodeDocId(UEdGraphNode* Node);
+	// Reserves the id in the record, whether or not the node goes on to be documented
+	static FString MakeUniqueNodeDocId(FClassDocRecord& Record, FString const& BaseId);
 	static UClass* MapToAssociatedClass(UK2Node* NodeInst, UObject* Source);
-	static bool IsSpawnerDocumentable(UBlueprintNodeSpawner* Spawner, bool bIsBlueprint);
 
 protected:
 	TWeakObjectPtr< UBlueprint > DummyBP;
 	TWeakObjectPtr< UEdGraph > Graph;
 	TSharedPtr< class SGraphPanel > GraphPanel;
+	// Nodes spawned into the current graph since it was created
+	int32 NumNodesInGraph = 0;
+	// Document the spawners' cached template nodes where possible, rather than invoking each spawner into our graph
+	bool bUseTemplateNodes = false;
+	EKantanDocGenOutputFormat OutputFormat = EKantanDocGenOutputFormat::Html;
 
 	FString DocsTitle;
-	TSharedPtr< FXmlFile > IndexXml;
-	TMap< TWeakObjectPtr< UClass >, TSharedPtr< FXmlFile > > ClassDocsMap;
+	FString ScriptsDir;
+	TMap< TWeakObjectPtr< UClass >, TSharedPtr< FClassDocRecord > > ClassDocsMap;
 	TMap<FName, TPair<FString, FString>> ModulePluginNameAndDesc;
 
 	FString OutputDir;
 
+	// Shared with the reflection docs, lives for the run
+	FDocGenNameCache NameCache;
+	FDocGenClassHierarchy ClassHierarchy;
+	TSharedPtr< const FDocGenSourceIndex > SourceIndex;
+
 public:
 	//
 	double GenerateNodeImageTime = 0.0;
 	double GenerateNodeDocsTime = 0.0;
+	double SpawnTemplateNodeTime = 0.0;
+	double SpawnInvokedNodeTime = 0.0;
+	int32 NumTemplateNodes = 0;
+	int32 NumInvokedNodes = 0;
+	int32 NumImagesWritten = 0;
+	int32 NumSpawnFailures = 0;
+	int32 NumClassDocFailures = 0;
+	FDocGenSearchIndex::FStats SearchIndexStats;
+	int32 NumIndexFragments = 0;
+	int64 IndexFragmentBytes = 0;
+	int64 LargestIndexFragmentBytes = 0;
+	TArray< FClassPageStats > LargestClassPages;
 	//
 };
 
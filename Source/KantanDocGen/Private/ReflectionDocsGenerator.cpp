@@ -0,0 +1,276 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "ReflectionDocsGenerator.h"
+#include "KantanDocGenLog.h"
+#include "XmlHelpers.h"
+#include "EdGraphSchema_K2.h"
+#include "UObject/UnrealType.h"
+#include "Enumeration/NativeTypeIndex.h"
+#include "Enumeration/ClassFilter.h"
+#include "DocGenNameCache.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Stats/StatsMisc.h"
+
+
+void FReflectionDocsGenerator::GT_Snapshot(const TMap<FName, TPair<FString, FString>>& InModulePluginNameAndDesc, FNativeTypeIndex const& TypeIndex,
+	FDocGenClassFilter const& ClassFilter, FDocGenNameCache& NameCache)
+{
+	SCOPE_SECONDS_COUNTER(SnapshotTime);
+
+	Classes.Empty();
+	Types.Empty();
+
+	for (auto const& Entry : InModulePluginNameAndDesc)
+	{
+		const FString ModuleName = Entry.Key.ToString();
+
+		auto PackageTypes = TypeIndex.FindModule(Entry.Key);
+		if (PackageTypes == nullptr)
+		{
+			continue;
+		}
+
+		for (auto const& Class : PackageTypes->Classes)
+		{
+			if (Class.IsValid() && ClassFilter.PassesFilter(Class.Get(), Entry.Key))
+			{
+				SnapshotClass(Class.Get(), ModuleName, NameCache);
+			}
+		}
+
+		for (auto const& Struct : PackageTypes->Structs)
+		{
+			if (Struct.IsValid() && ClassFilter.PassesFilter(Struct.Get(), Entry.Key))
+			{
+				SnapshotStruct(Struct.Get(), ModuleName, NameCache);
+			}
+		}
+
+		for (auto const& Enum : PackageTypes->Enums)
+		{
+			if (Enum.IsValid() && ClassFilter.PassesFilter(Enum.Get(), Entry.Key))
+			{
+				SnapshotEnum(Enum.Get(), ModuleName);
+			}
+		}
+	}
+
+	UE_LOG(LogKantanDocGen, Log, TEXT("Reflection snapshot: %i classes with properties, %i types, took %.3fs."),
+		Classes.Num(), Types.Num(), SnapshotTime);
+}
+
+void FReflectionDocsGenerator::SnapshotClass(UClass* Class, FString const& ModuleName, FDocGenNameCache& NameCache)
+{
+	TArray< FPropertyRecord > Properties;
+	SnapshotProperties(Class, true, NameCache, Properties);
+
+	if (Properties.Num() > 0)
+	{
+		// Keyed on the same id as the class docs (see FNodeDocsGenerator::GetClassDocId)
+		FClassRecord& Record = Classes.Add(Class->GetName());
+		Record.Class = Class;
+		Record.ModuleName = ModuleName;
+		Record.Properties = MoveTemp(Properties);
+	}
+}
+
+void FReflectionDocsGenerator::SnapshotStruct(UScriptStruct* Struct, FString const& ModuleName, FDocGenNameCache& NameCache)
+{
+	if (!UEdGraphSchema_K2::IsAllowableBlueprintVariableType(Struct))
+	{
+		return;
+	}
+
+	FTypeRecord& Type = Types.AddDefaulted_GetRef();
+	Type.Kind = ETypeKind::Struct;
+	Type.Id = Struct->GetStructCPPName();
+	Type.DisplayName = Struct->GetDisplayNameText().ToString();
+	Type.ModuleName = ModuleName;
+	Type.IncludePath = Struct->GetMetaData(TEXT("IncludePath"));
+
+	const FString Tooltip = Struct->GetToolTipText().ToString();
+	if (Tooltip != Type.DisplayName)
+	{
+		Type.Description = Tooltip;
+	}
+
+	SnapshotProperties(Struct, true, NameCache, Type.Properties);
+}
+
+void FReflectionDocsGenerator::SnapshotEnum(UEnum* Enum, FString const& ModuleName)
+{
+	if (!UEdGraphSchema_K2::IsAllowableBlueprintVariableType(Enum))
+	{
+		return;
+	}
+
+	FTypeRecord& Type = Types.AddDefaulted_GetRef();
+	Type.Kind = ETypeKind::Enum;
+	Type.Id = Enum->GetName();
+	Type.DisplayName = Enum->GetDisplayNameText().ToString();
+	Type.ModuleName = ModuleName;
+	Type.IncludePath = Enum->GetMetaData(TEXT("IncludePath"));
+
+	const FString Tooltip = Enum->GetToolTipText().ToString();
+	if (Tooltip != Type.DisplayName)
+	{
+		Type.Description = Tooltip;
+	}
+
+	// The autogenerated _MAX entry is never exposed to blueprint
+	const int32 NumEnumerators = Enum->ContainsExistingMax() ? Enum->NumEnums() - 1 : Enum->NumEnums();
+	for (int32 Index = 0; Index < NumEnumerators; ++Index)
+	{
+		if (Enum->HasMetaData(TEXT("Hidden"), Index))
+		{
+			continue;
+		}
+
+		FEnumeratorRecord& Enumerator = Type.Enumerators.AddDefaulted_GetRef();
+		Enumerator.Name = Enum->GetDisplayNameTextByIndex(Index).ToString();
+		Enumerator.Value = Enum->GetValueByIndex(Index);
+
+		const FString EnumeratorTooltip = Enum->GetToolTipTextByIndex(Index).ToString();
+		if (EnumeratorTooltip != Enumerator.Name)
+		{
+			Enumerator.Description = EnumeratorTooltip;
+		}
+	}
+}
+
+void FReflectionDocsGenerator::SnapshotProperties(UStruct* Struct, bool bRequireBlueprintVisible, FDocGenNameCache& NameCache, TArray< FPropertyRecord >& OutProperties)
+{
+	const UEdGraphSchema_K2* K2_Schema = GetDefault< UEdGraphSchema_K2 >();
+
+	// Inherited properties are documented on the struct/class that declares them
+	for (TFieldIterator< FProperty > It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		FProperty* Property = *It;
+		if (bRequireBlueprintVisible && !Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+		{
+			continue;
+		}
+
+		FPropertyRecord& Record = OutProperties.AddDefaulted_GetRef();
+		Record.Name = Property->GetDisplayNameText().ToString();
+		Record.Category = Property->GetMetaData(TEXT("Category"));
+		Record.bReadOnly = Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly);
+
+		FEdGraphPinType PinType;
+		if (K2_Schema->ConvertPropertyToPinType(Property, PinType))
+		{
+			Record.Type = NameCache.GetPinTypeText(PinType);
+		}
+		else
+		{
+			Record.Type = Property->GetCPPType();
+		}
+
+		const FString Tooltip = Property->GetToolTipText().ToString();
+		if (Tooltip != Record.Name)
+		{
+			Record.Description = Tooltip;
+		}
+	}
+}
+
+bool FReflectionDocsGenerator::GenerateTypeDocs(FString const& DocsTitle, FString const& OutputDir) const
+{
+	FThreadSafeCounter NumFailed;
+
+	ParallelFor(Types.Num(), [&](int32 Index)
+		{
+			if (!SaveTypeDocXml(Types[Index], DocsTitle, OutputDir))
+			{
+				NumFailed.Increment();
+			}
+		});
+
+	if (NumFailed.GetValue() > 0)
+	{
+		UE_LOG(LogKantanDocGen, Warning, TEXT("Failed to save %i struct/enum doc files."), NumFailed.GetValue());
+	}
+
+	return NumFailed.GetValue() == 0;
+}
+
+const TArray< FReflectionDocsGenerator::FPropertyRecord >* FReflectionDocsGenerator::FindClassProperties(FString const& ClassId) const
+{
+	FClassRecord const* Record = Classes.Find(ClassId);
+	return Record ? &Record->Properties : nullptr;
+}
+
+void FReflectionDocsGenerator::AppendPropertiesXml(FXmlNode* Parent, TArray< FPropertyRecord > const& Properties)
+{
+	FXmlNode* PropertiesElem = AppendChild(Parent, TEXT("properties"));
+	for (FPropertyRecord const& Property : Properties)
+	{
+		FXmlNode* PropertyElem = AppendChild(PropertiesElem, TEXT("property"));
+		AppendChildCDATA(PropertyElem, TEXT("name"), Property.Name);
+		AppendChildCDATA(PropertyElem, TEXT("type"), Property.Type);
+		AppendChildCDATA(PropertyElem, TEXT("access"), Property.bReadOnly ? TEXT("Read Only") : TEXT("Read/Write"));
+		if (!Property.Category.IsEmpty())
+		{
+			AppendChildCDATA(PropertyElem, TEXT("category"), Property.Category);
+		}
+		if (!Property.Description.IsEmpty())
+		{
+			AppendChildCDATA(PropertyElem, TEXT("description"), Property.Description);
+		}
+	}
+}
+
+bool FReflectionDocsGenerator::SaveTypeDocXml(FTypeRecord const& Type, FString const& DocsTitle, FString const& OutputDir)
+{
+	TSharedPtr< FXmlFile > File = MakeEmptyDocXml();
+	FXmlNode* Root = File->GetRootNode();
+
+	AppendChildCDATA(Root, TEXT("docs_name"), DocsTitle);
+	AppendChildCDATA(Root, TEXT("id"), Type.Id);
+	AppendChildCDATA(Root, TEXT("kind"), Type.Kind == ETypeKind::Struct ? TEXT("struct") : TEXT("enum"));
+	AppendChildCDATA(Root, TEXT("display_name"), Type.DisplayName);
+	if (!Type.Description.IsEmpty())
+	{
+		AppendChildCDATA(Root, TEXT("description"), Type.Description);
+	}
+
+	FXmlNode* References = AppendChild(Root, TEXT("references"));
+	AppendChildCDATA(References, TEXT("module"), Type.ModuleName);
+	if (!Type.IncludePath.IsEmpty())
+	{
+		AppendChildCDATA(References, TEXT("include"), Type.IncludePath);
+	}
+
+	if (Type.Properties.Num() > 0)
+	{
+		AppendPropertiesXml(Root, Type.Properties);
+	}
+
+	if (Type.Enumerators.Num() > 0)
+	{
+		FXmlNode* Enumerators = AppendChild(Root, TEXT("enumerators"));
+		for (FEnumeratorRecord const& Enumerator : Type.Enumerators)
+		{
+			FXmlNode* EnumeratorElem = AppendChild(Enumerators, TEXT("enumerator"));
+			AppendChildCDATA(EnumeratorElem, TEXT("name"), Enumerator.Name);
+			AppendChildCDATA(EnumeratorElem, TEXT("value"), LexToString(Enumerator.Value));
+			if (!Enumerator.Description.IsEmpty())
+			{
+				AppendChildCDATA(EnumeratorElem, TEXT("description"), Enumerator.Description);
+			}
+		}
+	}
+
+	const FString TypeDocsPath = OutputDir / Type.Id;
+
+	// The conversion tool expects every documented type folder to have a nodes subfolder, even if empty.
+	IFileManager::Get().MakeDirectory(*(TypeDocsPath / TEXT("nodes")), true);
+
+	return File->Save(TypeDocsPath / (Type.Id + TEXT(".xml")));
+}
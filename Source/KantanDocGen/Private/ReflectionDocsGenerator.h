@@ -0,0 +1,104 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+class UClass;
+class UStruct;
+class UScriptStruct;
+class UEnum;
+class FXmlNode;
+class FNativeTypeIndex;
+class FDocGenClassFilter;
+class FDocGenNameCache;
+
+/*
+Documents reflected data that has no blueprint node spawner: BlueprintVisible properties of native classes,
+and BlueprintType structs and enums. Classes with properties get a page even if none of their nodes are documented.
+All UObject access happens in a single game thread pass (GT_Snapshot), which copies everything needed into plain
+records. Formatting of those records into intermediate xml can then happen on any thread, in parallel.
+*/
+class FReflectionDocsGenerator
+{
+public:
+	enum class ETypeKind : uint8
+	{
+		Struct,
+		Enum,
+	};
+
+	struct FPropertyRecord
+	{
+		FString Name;
+		FString Type;
+		FString Description;
+		FString Category;
+		bool bReadOnly = false;
+	};
+
+	struct FEnumeratorRecord
+	{
+		FString Name;
+		FString Description;
+		int64 Value = 0;
+	};
+
+	struct FClassRecord
+	{
+		TWeakObjectPtr< UClass > Class;
+		FString ModuleName;
+		TArray< FPropertyRecord > Properties;
+	};
+
+	struct FTypeRecord
+	{
+		ETypeKind Kind = ETypeKind::Struct;
+		FString Id;
+		FString DisplayName;
+		FString Description;
+		FString ModuleName;
+		FString IncludePath;
+		TArray< FPropertyRecord > Properties;
+		TArray< FEnumeratorRecord > Enumerators;
+	};
+
+public:
+	/** Callable only from game thread */
+	void GT_Snapshot(const TMap<FName, TPair<FString, FString>>& InModulePluginNameAndDesc, FNativeTypeIndex const& TypeIndex,
+		FDocGenClassFilter const& ClassFilter, FDocGenNameCache& NameCache);
+	/**/
+
+	/** Callable from background thread, once the snapshot has been taken */
+	bool GenerateTypeDocs(FString const& DocsTitle, FString const& OutputDir) const;
+	/**/
+
+	const TArray< FPropertyRecord >* FindClassProperties(FString const& ClassId) const;
+	// Keyed on class doc id. The class pointers are only to be used from the game thread.
+	const TMap< FString, FClassRecord >& GetClasses() const { return Classes; }
+	const TArray< FTypeRecord >& GetTypes() const { return Types; }
+
+	static void AppendPropertiesXml(FXmlNode* Parent, TArray< FPropertyRecord > const& Properties);
+
+protected:
+	void SnapshotClass(UClass* Class, FString const& ModuleName, FDocGenNameCache& NameCache);
+	void SnapshotStruct(UScriptStruct* Struct, FString const& ModuleName, FDocGenNameCache& NameCache);
+	void SnapshotEnum(UEnum* Enum, FString const& ModuleName);
+	static void SnapshotProperties(UStruct* Struct, bool bRequireBlueprintVisible, FDocGenNameCache& NameCache, TArray< FPropertyRecord >& OutProperties);
+
+	static bool SaveTypeDocXml(FTypeRecord const& Type, FString const& DocsTitle, FString const& OutputDir);
+
+protected:
+	TMap< FString, FClassRecord > Classes;
+	TArray< FTypeRecord > Types;
+
+public:
+	//
+	double SnapshotTime = 0.0;
+	//
+};
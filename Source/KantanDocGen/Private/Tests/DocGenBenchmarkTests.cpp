@@ -0,0 +1,174 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "KantanDocGenModule.h"
+#include "DocGenSettings.h"
+#include "DocGenRunReport.h"
+#include "Algo/Find.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+
+/*
+End to end generation throughput, over the synthetic classes of the KantanDocGenBenchmark module.
+Each scale is run with and without node images, stopping short of html conversion. Reports are written to
+Saved/KantanDocGenBenchmark/<Title>.json; copy one into Saved/KantanDocGenBenchmark/Baseline to have later runs
+fail on regressing against it.
+*/
+namespace DocGenBenchmark
+{
+	static const FName ModuleName = TEXT("KantanDocGenBenchmark");
+
+	struct FScale
+	{
+		const TCHAR* Name;
+		const TCHAR* ClassFilter;
+		// Fewest nodes the filter can select
+		int32 MinNodes;
+	};
+
+	// Each generated library class has 100 functions
+	static const FScale Scales[] =
+	{
+		{ TEXT("100"), TEXT("KDGBenchLib_000"), 100 },
+		{ TEXT("1k"), TEXT("KDGBenchLib_00*"), 1000 },
+		{ TEXT("10k"), TEXT("Module:KantanDocGenBenchmark"), 10000 },
+	};
+
+	static bool IsGenerating(EDocGenPhase Phase)
+	{
+		return Phase != EDocGenPhase::Idle && Phase != EDocGenPhase::Succeeded && Phase != EDocGenPhase::Failed;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FKantanDocGenBenchmarkTest, "Plugins.KantanDocGen.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FKantanDocGenBenchmarkTest::GetTests(TArray< FString >& OutBeautifiedNames, TArray< FString >& OutTestCommands) const
+{
+	for (auto const& Scale : DocGenBenchmark::Scales)
+	{
+		for (bool bImages : { true, false })
+		{
+			const FString Name = FString::Printf(TEXT("%s.%s"), Scale.Name, bImages ? TEXT("Images") : TEXT("NoImages"));
+			OutBeautifiedNames.Add(Name);
+			OutTestCommands.Add(Name);
+		}
+	}
+}
+
+bool FKantanDocGenBenchmarkTest::RunTest(FString const& Parameters)
+{
+	FString ScaleName, Variant;
+	Parameters.Split(TEXT("."), &ScaleName, &Variant);
+
+	auto const* Scale = Algo::FindByPredicate(DocGenBenchmark::Scales, [&ScaleName](auto const& Entry)
+		{
+			return ScaleName == Entry.Name;
+		});
+	if (Scale == nullptr)
+	{
+		AddError(FString::Printf(TEXT("Unknown benchmark '%s'."), *Parameters));
+		return false;
+	}
+
+	if (FModuleManager::Get().LoadModule(DocGenBenchmark::ModuleName) == nullptr)
+	{
+		AddError(TEXT("Failed to load the KantanDocGenBenchmark module."));
+		return false;
+	}
+
+	auto& Module = FModuleManager::LoadModuleChecked< FKantanDocGenModule >(TEXT("KantanDocGen"));
+	if (DocGenBenchmark::IsGenerating(Module.GetProgress().Phase))
+	{
+		AddError(TEXT("Doc generation is already in progress."));
+		return false;
+	}
+
+	const FString Title = FString::Printf(TEXT("KantanDocGenBenchmark_%s_%s"), *ScaleName, *Variant);
+	const FString BenchmarkDir = FPaths::ProjectSavedDir() / TEXT("KantanDocGenBenchmark");
+
+	FKantanDocGenSettings Settings;
+	Settings.DocumentationTitle = Title;
+	Settings.BaseEngineModulesToInclude = { DocGenBenchmark::ModuleName };
+	Settings.IncludeEnginePlugins = false;
+	Settings.IncludeBaseProject = false;
+	Settings.IncludeProjectPlugins = false;
+	Settings.SpecificClasses = { FName(Scale->ClassFilter) };
+	Settings.OutputDirectory.Path = BenchmarkDir / TEXT("Output");
+	Settings.bGenerateNodeImages = Variant == TEXT("Images");
+	Settings.bSkipConversion = true;
+	Settings.bEnableCheckpoints = false;
+	Settings.ReportPath = BenchmarkDir / Title + TEXT(".json");
+
+	const FString BaselinePath = BenchmarkDir / TEXT("Baseline") / Title + TEXT(".json");
+	if (FPaths::FileExists(BaselinePath))
+	{
+		Settings.BaselinePath = BaselinePath;
+	}
+
+	// A report left by an earlier run must never be mistaken for this one's
+	IFileManager::Get().Delete(*Settings.ReportPath, false, true, true);
+	const FDateTime StartTime = FDateTime::UtcNow();
+
+	// Peak use is process wide, so retained memory is the more telling figure when running several scales
+	const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+	Module.GenerateDocs(Settings, EKantanDocGenerationMode::ExecCommand);
+	const uint64 UsedAfter = FPlatformMemory::GetStats().UsedPhysical;
+
+	FKantanDocGenRunReport Report;
+	if (!FKantanDocGenRunReport::LoadFromFile(Settings.ReportPath, Report))
+	{
+		AddError(FString::Printf(TEXT("Failed to read run report '%s'."), *Settings.ReportPath));
+		return false;
+	}
+
+	// Reports are timestamped to the millisecond, the start time is truncated to match
+	FDateTime ReportTime;
+	if (!FDateTime::ParseIso8601(*Report.Timestamp, ReportTime) || ReportTime < StartTime - FTimespan::FromMilliseconds(1))
+	{
+		AddError(FString::Printf(TEXT("Run report '%s' (%s) isn't from this run."), *Settings.ReportPath, *Report.Timestamp));
+		return false;
+	}
+
+	TestTrue(TEXT("Generation succeeded"), Report.bSucceeded);
+	TestTrue(FString::Printf(TEXT("At least %i nodes documented"), Scale->MinNodes), Report.Counts.Nodes >= Scale->MinNodes);
+	if (Settings.bGenerateNodeImages)
+	{
+		TestTrue(TEXT("Every node has an image"), Report.Counts.Images >= Report.Counts.Nodes);
+	}
+	else
+	{
+		TestEqual(TEXT("No node images"), Report.Counts.Images, 0);
+	}
+
+	for (FString const& Violation : Report.Baseline.Violations)
+	{
+		AddError(FString::Printf(TEXT("Regressed against baseline: %s"), *Violation));
+	}
+
+	const double NodesPerSecond = Report.Counts.Nodes / FMath::Max(Report.Times.Enumerate, 0.001);
+	const double RetainedMB = ((int64)UsedAfter - (int64)UsedBefore) / (1024.0 * 1024.0);
+
+	AddInfo(FString::Printf(TEXT("%s: %i nodes in %.3fs (%.1f nodes/s), %.3fs total, peak %.0fMB, %+.0fMB retained."),
+		*Title, Report.Counts.Nodes, Report.Times.Enumerate, NodesPerSecond, Report.Times.Total, Report.PeakMemoryMB, RetainedMB));
+
+	AddTelemetryData(TEXT("NodesPerSecond"), NodesPerSecond, Title);
+	AddTelemetryData(TEXT("EnumerateSeconds"), Report.Times.Enumerate, Title);
+	AddTelemetryData(TEXT("TotalSeconds"), Report.Times.Total, Title);
+	AddTelemetryData(TEXT("PeakMemoryMB"), Report.PeakMemoryMB, Title);
+	AddTelemetryData(TEXT("RetainedMemoryMB"), RetainedMB, Title);
+
+	return true;
+}
+
+#endif
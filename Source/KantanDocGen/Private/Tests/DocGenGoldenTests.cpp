@@ -0,0 +1,389 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "KantanDocGenModule.h"
+#include "DocGenSettings.h"
+#include "DocGenRunReport.h"
+#include "XmlFile.h"
+#include "ImageCore.h"
+#include "ImageUtils.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Internationalization/Regex.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+
+/*
+Golden output regression test. Generates docs for a fixed fixture (a slice of the KantanDocGenBenchmark module),
+normalizes the intermediate xml and converted html, and compares them against the files checked in under
+Tests/Golden in the plugin directory. Node images are compared with a per pixel tolerance, so that changes to how
+they're rendered or read back can be validated without being bit exact.
+
+Run with -UpdateDocGenGoldens to record the current output as the new goldens. The test fails if no goldens have
+been recorded. Normalized output of the last run is always left in Saved/KantanDocGenGolden for inspection.
+*/
+namespace DocGenGolden
+{
+	static const FName FixtureModule = TEXT("KantanDocGenBenchmark");
+	static const TCHAR* const FixtureTitle = TEXT("KantanDocGenGolden");
+
+	// Channel difference below which pixels are considered equal, and percentage of pixels allowed to differ
+	static const int32 PixelTolerance = 16;
+	static const float MaxDifferentPixelsPercent = 1.0f;
+
+	enum class EFileKind
+	{
+		Xml,
+		Html,
+		Image,
+		Other,
+	};
+
+	static EFileKind GetFileKind(FString const& Path)
+	{
+		const FString Extension = FPaths::GetExtension(Path).ToLower();
+		if (Extension == TEXT("xml"))
+		{
+			return EFileKind::Xml;
+		}
+		if (Extension == TEXT("html") || Extension == TEXT("htm"))
+		{
+			return EFileKind::Html;
+		}
+		if (Extension == TEXT("png"))
+		{
+			return EFileKind::Image;
+		}
+		return EFileKind::Other;
+	}
+
+	static FString ReplaceAll(FString const& Input, FString const& Pattern, FString const& Replacement)
+	{
+		FRegexMatcher Matcher(FRegexPattern(Pattern), Input);
+
+		FString Result;
+		int32 Last = 0;
+		while (Matcher.FindNext())
+		{
+			Result += Input.Mid(Last, Matcher.GetMatchBeginning() - Last) + Replacement;
+			Last = Matcher.GetMatchEnding();
+		}
+		return Result + Input.Mid(Last);
+	}
+
+	// Machine specific paths and timestamps
+	static FString NormalizeText(FString Text)
+	{
+		const TPair< FString, const TCHAR* > Roots[] =
+		{
+			{ FPaths::ConvertRelativePathToFull(IPluginManager::Get().FindPlugin(TEXT("KantanDocGen"))->GetBaseDir()), TEXT("{Plugin}") },
+			{ FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()), TEXT("{Project}") },
+			{ FPaths::ConvertRelativePathToFull(FPaths::EngineDir()), TEXT("{Engine}") },
+		};
+
+		Text.ReplaceInline(TEXT("\r\n"), TEXT("\n"));
+		Text.ReplaceInline(TEXT("\\"), TEXT("/"));
+		for (auto const& Root : Roots)
+		{
+			FString RootPath = Root.Key;
+			RootPath.RemoveFromEnd(TEXT("/"));
+			Text.ReplaceInline(*RootPath, Root.Value);
+		}
+
+		Text = ReplaceAll(Text, TEXT("\\d{4}-\\d{2}-\\d{2}[T ]\\d{2}:\\d{2}(:\\d{2}(\\.\\d+)?)?Z?"), TEXT("{Timestamp}"));
+		Text = ReplaceAll(Text, TEXT("\\d{1,2}/\\d{1,2}/\\d{4},? \\d{1,2}:\\d{2}(:\\d{2})?( [AP]M)?"), TEXT("{Timestamp}"));
+		Text = ReplaceAll(Text, TEXT("[ \\t]+\\n"), TEXT("\n"));
+		return Text.TrimEnd() + TEXT("\n");
+	}
+
+	static void WriteCanonicalNode(FXmlNode const* Node, int32 Depth, FString& Out)
+	{
+		Out += FString::ChrN(Depth, TEXT('\t')) + TEXT("<") + Node->GetTag();
+		for (FXmlAttribute const& Attribute : Node->GetAttributes())
+		{
+			Out += FString::Printf(TEXT(" %s=\"%s\""), *Attribute.GetTag(), *Attribute.GetValue());
+		}
+		Out += TEXT(">") + Node->GetContent().TrimStartAndEnd() + TEXT("\n");
+
+		// @NOTE: Children are kept in the order they were written. Output is meant to be deterministic, so a change
+		// in ordering is a regression like any other.
+		for (FXmlNode const* Child : Node->GetChildrenNodes())
+		{
+			WriteCanonicalNode(Child, Depth + 1, Out);
+		}
+	}
+
+	static bool NormalizeXml(FString const& Filename, FString& OutText)
+	{
+		FXmlFile File(Filename, EConstructMethod::ConstructFromFile);
+		if (!File.IsValid() || File.GetRootNode() == nullptr)
+		{
+			return false;
+		}
+
+		OutText.Reset();
+		WriteCanonicalNode(File.GetRootNode(), 0, OutText);
+		OutText = NormalizeText(OutText);
+		return true;
+	}
+
+	// Relative path -> absolute path, of every file of interest under the directory
+	static TMap< FString, FString > FindFiles(FString const& Directory, TArrayView< const EFileKind > Kinds)
+	{
+		TArray< FString > Files;
+		IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*"), true, false);
+
+		TMap< FString, FString > Result;
+		for (FString const& File : Files)
+		{
+			if (Kinds.Contains(GetFileKind(File)))
+			{
+				FString Relative = File;
+				FPaths::MakePathRelativeTo(Relative, *(Directory / TEXT("")));
+				Result.Add(Relative, File);
+			}
+		}
+		Result.KeySort(TLess< FString >());
+		return Result;
+	}
+
+	struct FImageDiff
+	{
+		bool bLoaded = false;
+		bool bSameSize = false;
+		float DifferentPixelsPercent = 0.0f;
+		int32 MaxChannelDifference = 0;
+	};
+
+	static FImageDiff CompareImages(FString const& ExpectedFilename, FString const& ActualFilename)
+	{
+		FImageDiff Diff;
+
+		FImage Expected, Actual;
+		if (!FImageUtils::LoadImage(*ExpectedFilename, Expected) || !FImageUtils::LoadImage(*ActualFilename, Actual))
+		{
+			return Diff;
+		}
+		Diff.bLoaded = true;
+
+		Diff.bSameSize = Expected.SizeX == Actual.SizeX && Expected.SizeY == Actual.SizeY;
+		if (!Diff.bSameSize)
+		{
+			return Diff;
+		}
+
+		Expected.ChangeFormat(ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+		Actual.ChangeFormat(ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+
+		TArrayView64< FColor > ExpectedPixels = Expected.AsBGRA8();
+		TArrayView64< FColor > ActualPixels = Actual.AsBGRA8();
+
+		int64 NumDifferent = 0;
+		for (int64 Idx = 0; Idx < ExpectedPixels.Num(); ++Idx)
+		{
+			FColor const& A = ExpectedPixels[Idx];
+			FColor const& B = ActualPixels[Idx];
+			const int32 Difference = FMath::Max(
+				FMath::Max(FMath::Abs(A.R - B.R), FMath::Abs(A.G - B.G)),
+				FMath::Max(FMath::Abs(A.B - B.B), FMath::Abs(A.A - B.A)));
+
+			Diff.MaxChannelDifference = FMath::Max(Diff.MaxChannelDifference, Difference);
+			NumDifferent += Difference > PixelTolerance ? 1 : 0;
+		}
+
+		Diff.DifferentPixelsPercent = ExpectedPixels.Num() > 0 ? NumDifferent * 100.0f / ExpectedPixels.Num() : 0.0f;
+		return Diff;
+	}
+
+	static FString DescribeTextDiff(FString const& Expected, FString const& Actual)
+	{
+		TArray< FString > ExpectedLines, ActualLines;
+		Expected.ParseIntoArrayLines(ExpectedLines, false);
+		Actual.ParseIntoArrayLines(ActualLines, false);
+
+		const int32 NumLines = FMath::Max(ExpectedLines.Num(), ActualLines.Num());
+		for (int32 Idx = 0; Idx < NumLines; ++Idx)
+		{
+			FString const* ExpectedLine = ExpectedLines.IsValidIndex(Idx) ? &ExpectedLines[Idx] : nullptr;
+			FString const* ActualLine = ActualLines.IsValidIndex(Idx) ? &ActualLines[Idx] : nullptr;
+			if (!ExpectedLine || !ActualLine || *ExpectedLine != *ActualLine)
+			{
+				return FString::Printf(TEXT("line %i, expected '%s', got '%s'"), Idx + 1,
+					ExpectedLine ? **ExpectedLine : TEXT("<end of file>"), ActualLine ? **ActualLine : TEXT("<end of file>"));
+			}
+		}
+		return FString();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKantanDocGenGoldenTest, "Plugins.KantanDocGen.Golden",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FKantanDocGenGoldenTest::RunTest(FString const& Parameters)
+{
+	using namespace DocGenGolden;
+
+	if (FModuleManager::Get().LoadModule(FixtureModule) == nullptr)
+	{
+		AddError(TEXT("Failed to load the KantanDocGenBenchmark module."));
+		return false;
+	}
+
+	const bool bUpdate = FParse::Param(FCommandLine::Get(), TEXT("UpdateDocGenGoldens"));
+	const FString GoldenDir = IPluginManager::Get().FindPlugin(TEXT("KantanDocGen"))->GetBaseDir() / TEXT("Tests") / TEXT("Golden");
+	const FString WorkDir = FPaths::ProjectSavedDir() / TEXT("KantanDocGenGolden");
+	const FString ActualDir = WorkDir / TEXT("Actual");
+
+	if (!bUpdate && !IFileManager::Get().DirectoryExists(*(GoldenDir / TEXT("xml"))))
+	{
+		AddError(FString::Printf(TEXT("No goldens in '%s', run with -UpdateDocGenGoldens to record them."), *GoldenDir));
+		return false;
+	}
+
+	// @NOTE: The conversion tool is a Windows executable, elsewhere only the xml and images are checked.
+	const bool bConvert = PLATFORM_WINDOWS != 0;
+
+	FKantanDocGenSettings Settings;
+	Settings.DocumentationTitle = FixtureTitle;
+	Settings.BaseEngineModulesToInclude = { FixtureModule };
+	Settings.IncludeEnginePlugins = false;
+	Settings.IncludeBaseProject = false;
+	Settings.IncludeProjectPlugins = false;
+	Settings.SpecificClasses = { TEXT("KDGBenchLib_000"), TEXT("KDGBenchInterface"), TEXT("Child:KDGBenchDeep_00") };
+	Settings.OutputDirectory.Path = WorkDir / TEXT("Output");
+	Settings.bSkipConversion = !bConvert;
+	Settings.bEnableCheckpoints = false;
+	Settings.ReportPath = WorkDir / TEXT("Report.json");
+
+	auto& Module = FModuleManager::LoadModuleChecked< FKantanDocGenModule >(TEXT("KantanDocGen"));
+	Module.GenerateDocs(Settings, EKantanDocGenerationMode::ExecCommand);
+	if (Module.GetProgress().Phase != EDocGenPhase::Succeeded)
+	{
+		AddError(TEXT("Doc generation failed, see the log for details."));
+		return false;
+	}
+
+	// Normalize everything into the actual directory, in the same layout as the goldens
+	const FString IntermediateDir = FDocGenTaskProcessor::GetIntermediateDir(FixtureTitle);
+	IFileManager::Get().DeleteDirectory(*ActualDir, false, true);
+
+	const EFileKind IntermediateKinds[] = { EFileKind::Xml, EFileKind::Image };
+	for (auto const& File : FindFiles(IntermediateDir, IntermediateKinds))
+	{
+		if (GetFileKind(File.Key) == EFileKind::Image)
+		{
+			IFileManager::Get().Copy(*(ActualDir / TEXT("img") / File.Key), *File.Value);
+			continue;
+		}
+
+		FString Text;
+		if (!NormalizeXml(File.Value, Text))
+		{
+			// Still comparable, just not reordered
+			AddWarning(FString::Printf(TEXT("Failed to parse generated xml '%s', comparing it as text."), *File.Value));
+			FFileHelper::LoadFileToString(Text, *File.Value);
+			Text = NormalizeText(Text);
+		}
+		FFileHelper::SaveStringToFile(Text, *(ActualDir / TEXT("xml") / File.Key), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	if (bConvert)
+	{
+		const EFileKind OutputKinds[] = { EFileKind::Html };
+		for (auto const& File : FindFiles(Settings.OutputDirectory.Path, OutputKinds))
+		{
+			FString Text;
+			FFileHelper::LoadFileToString(Text, *File.Value);
+			FFileHelper::SaveStringToFile(NormalizeText(Text), *(ActualDir / TEXT("html") / File.Key), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		}
+	}
+
+	if (bUpdate)
+	{
+		// Html goldens are left alone where they can't be regenerated
+		TArray< FString > Subdirs = { TEXT("xml"), TEXT("img") };
+		if (bConvert)
+		{
+			Subdirs.Add(TEXT("html"));
+		}
+
+		for (FString const& Subdir : Subdirs)
+		{
+			IFileManager::Get().DeleteDirectory(*(GoldenDir / Subdir), false, true);
+			if (IFileManager::Get().DirectoryExists(*(ActualDir / Subdir)) && !IFileManager::Get().Move(*(GoldenDir / Subdir), *(ActualDir / Subdir)))
+			{
+				AddError(FString::Printf(TEXT("Failed to update goldens in '%s'."), *(GoldenDir / Subdir)));
+			}
+		}
+
+		AddInfo(FString::Printf(TEXT("Updated goldens in '%s'."), *GoldenDir));
+		return !HasAnyErrors();
+	}
+
+	TArray< EFileKind > Kinds = { EFileKind::Xml, EFileKind::Image };
+	if (bConvert)
+	{
+		Kinds.Add(EFileKind::Html);
+	}
+
+	const TMap< FString, FString > Expected = FindFiles(GoldenDir, Kinds);
+	const TMap< FString, FString > Actual = FindFiles(ActualDir, Kinds);
+
+	int32 NumCompared = 0;
+	for (auto const& File : Expected)
+	{
+		FString const* ActualFile = Actual.Find(File.Key);
+		if (ActualFile == nullptr)
+		{
+			AddError(FString::Printf(TEXT("Missing output: %s"), *File.Key));
+			continue;
+		}
+
+		++NumCompared;
+		if (GetFileKind(File.Key) == EFileKind::Image)
+		{
+			const FImageDiff Diff = CompareImages(File.Value, *ActualFile);
+			if (!Diff.bLoaded || !Diff.bSameSize)
+			{
+				AddError(FString::Printf(TEXT("Image %s: %s."), *File.Key, Diff.bLoaded ? TEXT("size differs") : TEXT("failed to load")));
+			}
+			else if (Diff.DifferentPixelsPercent > MaxDifferentPixelsPercent)
+			{
+				AddError(FString::Printf(TEXT("Image %s: %.2f%% of pixels differ (max channel difference %i)."),
+					*File.Key, Diff.DifferentPixelsPercent, Diff.MaxChannelDifference));
+			}
+			continue;
+		}
+
+		FString ExpectedText, ActualText;
+		FFileHelper::LoadFileToString(ExpectedText, *File.Value);
+		FFileHelper::LoadFileToString(ActualText, **ActualFile);
+		if (ExpectedText != ActualText)
+		{
+			AddError(FString::Printf(TEXT("Output %s differs from golden: %s"), *File.Key, *DescribeTextDiff(ExpectedText, ActualText)));
+		}
+	}
+
+	for (auto const& File : Actual)
+	{
+		if (!Expected.Contains(File.Key))
+		{
+			AddError(FString::Printf(TEXT("Unexpected output: %s"), *File.Key));
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Compared %i of %i golden files%s."), NumCompared, Expected.Num(), bConvert ? TEXT("") : TEXT(" (html skipped)")));
+	return !HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,69 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "DocGenOutputOptimizer.h"
+
+
+/*
+Minifier cases, each an input and the exact output expected. Mostly things that look like comments or collapsible
+whitespace but aren't, which must come through untouched.
+*/
+namespace DocGenOptimizerTest
+{
+	struct FCase
+	{
+		const TCHAR* Name;
+		const TCHAR* Input;
+		const TCHAR* Expected;
+	};
+
+	static const FCase JsCases[] =
+	{
+		{ TEXT("Leading block comment"), TEXT("/* note */ doThing();\n"), TEXT("doThing();\n") },
+		{ TEXT("Inline block comment"), TEXT("var a = 1; /* inline */ var b = 2;\n"), TEXT("var a = 1; var b = 2;\n") },
+		{ TEXT("Multi line block comment"), TEXT("/* one\n   two */\nvar c = 3;\n"), TEXT("var c = 3;\n") },
+		{ TEXT("Template literal"), TEXT("const s = `\n// not a comment\n  /* nor this */\n`;\n"), TEXT("const s = `\n// not a comment\n  /* nor this */\n`;\n") },
+		{ TEXT("Nested template literal"), TEXT("const t = `a${ b ? `//c` : {k: '/*'}.k }d`; // end\n"), TEXT("const t = `a${ b ? `//c` : {k: '/*'}.k }d`;\n") },
+		{ TEXT("String"), TEXT("var u = 'http://x'; // trailing\n"), TEXT("var u = 'http://x';\n") },
+		{ TEXT("Regex and division"), TEXT("var r = /[/*]+/g; var d = a / b / c; // half\n"), TEXT("var r = /[/*]+/g; var d = a / b / c;\n") },
+		{ TEXT("Regex after keyword"), TEXT("if (x) return /\\/\\//.test(y);\n"), TEXT("if (x) return /\\/\\//.test(y);\n") },
+		{ TEXT("Indentation and blank lines"), TEXT("function f() {\n\n\t\treturn 1;\n}\n"), TEXT("function f() {\nreturn 1;\n}\n") },
+	};
+
+	static const FCase HtmlCases[] =
+	{
+		{ TEXT("Attribute value"), TEXT("<div title=\"a   b\n  c\">x   y</div>"), TEXT("<div title=\"a   b\n  c\">x y</div>") },
+		{ TEXT("Attribute value with backslash"), TEXT("<a title='C:\\'  href=\"#\">x</a>"), TEXT("<a title='C:\\' href=\"#\">x</a>") },
+		{ TEXT("Apostrophe in text"), TEXT("<p>Don't   stop</p>"), TEXT("<p>Don't stop</p>") },
+		{ TEXT("Comment"), TEXT("<!-- c --><b>x</b>"), TEXT("<b>x</b>") },
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKantanDocGenOptimizerTest, "Plugins.KantanDocGen.Optimizer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FKantanDocGenOptimizerTest::RunTest(FString const& Parameters)
+{
+	using namespace DocGenOptimizerTest;
+
+	for (FCase const& Case : JsCases)
+	{
+		TestEqual(FString::Printf(TEXT("Js: %s"), Case.Name), FDocGenOutputOptimizer::MinifyJs(Case.Input), FString(Case.Expected));
+	}
+
+	for (FCase const& Case : HtmlCases)
+	{
+		TestEqual(FString::Printf(TEXT("Html: %s"), Case.Name), FDocGenOutputOptimizer::MinifyHtml(Case.Input), FString(Case.Expected));
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif
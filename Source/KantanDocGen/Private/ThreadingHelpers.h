@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Async/TaskGraphInterfaces.h"
+#include "DocGenTrace.h"
 
 
 namespace DocGenThreads
@@ -21,6 +22,8 @@ namespace DocGenThreads
 		}
 		else
 		{
+			DOCGEN_TRACE_SCOPE(KantanDocGen_GameThreadHop);
+
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady(MoveTemp(Func), TStatId(), nullptr, ENamedThreads::GameThread);
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		}
@@ -37,6 +40,8 @@ namespace DocGenThreads
 		}
 		else
 		{
+			DOCGEN_TRACE_SCOPE(KantanDocGen_GameThreadHop);
+
 			TResult Result;
 			TFunction<void()> NullaryFunc = [&]
 				{
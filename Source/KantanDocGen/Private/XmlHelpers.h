@@ -0,0 +1,61 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+#pragma once
+
+#include "XmlFile.h"
+
+
+inline FString WrapAsCDATA(FString const& InString)
+{
+	return TEXT("<![CDATA[") + InString + TEXT("]]>");
+}
+
+inline FXmlNode* AppendChild(FXmlNode* Parent, FString const& Name)
+{
+	Parent->AppendChildNode(Name, FString());
+	return Parent->GetChildrenNodes().Last();
+}
+
+inline FXmlNode* AppendChildRaw(FXmlNode* Parent, FString const& Name, FString const& TextContent)
+{
+	Parent->AppendChildNode(Name, TextContent);
+	return Parent->GetChildrenNodes().Last();
+}
+
+inline FXmlNode* AppendChildCDATA(FXmlNode* Parent, FString const& Name, FString const& TextContent)
+{
+	Parent->AppendChildNode(Name, WrapAsCDATA(TextContent));
+	return Parent->GetChildrenNodes().Last();
+}
+
+inline TArray<FXmlNode*> FindChildrenNodes(FXmlNode* Parent, FString const& Name)
+{
+	TArray<FXmlNode*> AllChildren = Parent->GetChildrenNodes();
+	return AllChildren.FilterByPredicate([Name](FXmlNode* Child)
+		{ return Child->GetTag() == Name; });
+}
+
+inline FXmlNode* FindChildWithGrandchildOfContent(FXmlNode* Parent, FString const& ChildName,
+	FString const& GrandchildName, FString const& GrandchildContent)
+{
+	TArray<FXmlNode*> AllChildren = FindChildrenNodes(Parent, ChildName);
+	FXmlNode** FoundGrandchild = AllChildren.FindByPredicate([GrandchildName, GrandchildContent](FXmlNode* Child)
+		{
+			const FXmlNode* Grandchild = Child->FindChildNode(GrandchildName);
+			return Grandchild && Grandchild->GetContent() == WrapAsCDATA(GrandchildContent);
+		});
+
+	return FoundGrandchild ? *FoundGrandchild : nullptr;
+}
+
+inline TSharedPtr< FXmlFile > MakeEmptyDocXml()
+{
+	const FString FileTemplate = R"xxx(<?xml version="1.0" encoding="UTF-8"?>
+<root></root>)xxx";
+
+	return MakeShared< FXmlFile >(FileTemplate, EConstructMethod::ConstructFromBuffer);
+}
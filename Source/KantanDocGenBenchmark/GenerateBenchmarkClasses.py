@@ -0,0 +1,166 @@
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+# Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+"""
+Generates the synthetic classes of the KantanDocGenBenchmark module into Private/Bench.
+
+The output is deterministic (fixed seed), so the workload only changes when this script does. Rerun it and commit
+the result after changing any of the constants below:
+
+    python GenerateBenchmarkClasses.py
+"""
+
+import os
+import random
+
+SEED = 0x4B444742
+# Function libraries, each of FUNCTIONS_PER_LIBRARY nodes, LIBRARIES_PER_FILE to a header
+NUM_LIBRARIES = 100
+FUNCTIONS_PER_LIBRARY = 100
+LIBRARIES_PER_FILE = 10
+# Chain of UObject classes, each deriving from the last
+HIERARCHY_DEPTH = 16
+FUNCTIONS_PER_HIERARCHY_CLASS = 4
+MAX_PARAMS = 8
+
+OUTPUT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Private", "Bench")
+
+FILE_HEADER = """// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+"""
+
+# (declaration, is output)
+PARAM_TYPES = [
+    ("int32", False),
+    ("float", False),
+    ("bool", False),
+    ("FName", False),
+    ("const FString&", False),
+    ("const FVector&", False),
+    ("const FTransform&", False),
+    ("UObject*", False),
+    ("const TArray< int32 >&", False),
+    ("int32&", True),
+    ("FString&", True),
+    ("FVector&", True),
+]
+
+RETURN_TYPES = ["void", "int32", "float", "bool", "FString", "FVector"]
+
+
+def make_params(rng):
+    count = rng.randint(0, MAX_PARAMS)
+    return ["{0} {1}{2}".format(decl, "Out" if is_out else "In", idx)
+            for idx, (decl, is_out) in enumerate(rng.choice(PARAM_TYPES) for _ in range(count))]
+
+
+def make_function(rng, prefix, index, static):
+    kind = rng.choices(["callable", "pure", "latent"], weights=[6, 3, 1])[0]
+    params = make_params(rng)
+    ret = rng.choice(RETURN_TYPES)
+    name = "{0}_Fn{1:03d}".format(prefix, index)
+
+    if kind == "pure" and ret == "void":
+        ret = "int32"
+
+    specifiers = "BlueprintPure" if kind == "pure" else "BlueprintCallable"
+    meta = ""
+    if kind == "latent":
+        # Latent functions can't return anything
+        ret = "void"
+        params = ["UObject* WorldContextObject", "FLatentActionInfo LatentInfo"] + params
+        meta = ", Meta = (Latent, LatentInfo = \"LatentInfo\", WorldContext = \"WorldContextObject\")"
+
+    tooltip = "Benchmark {0} node {1} with {2} parameters.".format(kind, name, len(params))
+    decl = "\t/** {0} */\n\tUFUNCTION({1}, Category = \"KDG Bench|{2}\"{3})\n\t{4}{5} {6}({7});\n".format(
+        tooltip, specifiers, prefix, meta, "static " if static else "", ret, name, ", ".join(params))
+    body = "" if ret == "void" else " return {}; "
+    return decl, (ret, name, params, body)
+
+
+def write_file(path, content):
+    with open(path, "w", newline="\n") as f:
+        f.write(content)
+
+
+def generate_libraries(rng):
+    for file_index in range(NUM_LIBRARIES // LIBRARIES_PER_FILE):
+        base = "KDGBenchLibraries_{0}".format(file_index)
+        header = [FILE_HEADER, "\n#pragma once\n\n#include \"CoreMinimal.h\"\n#include \"Kismet/BlueprintFunctionLibrary.h\"\n"
+                  "#include \"Engine/LatentActionManager.h\"\n#include \"{0}.generated.h\"\n".format(base)]
+        source = [FILE_HEADER, "\n#include \"{0}.h\"\n".format(base)]
+
+        for lib in range(file_index * LIBRARIES_PER_FILE, (file_index + 1) * LIBRARIES_PER_FILE):
+            class_name = "UKDGBenchLib_{0:03d}".format(lib)
+            prefix = "Lib{0:03d}".format(lib)
+            header.append("\n\nUCLASS()\nclass {0} : public UBlueprintFunctionLibrary\n{{\n\tGENERATED_BODY()\n\npublic:\n".format(class_name))
+            source.append("\n")
+
+            for index in range(FUNCTIONS_PER_LIBRARY):
+                decl, (ret, name, params, body) = make_function(rng, prefix, index, True)
+                header.append(decl)
+                source.append("{0} {1}::{2}({3}) {{{4}}}\n".format(ret, class_name, name, ", ".join(params), body))
+
+            header.append("};\n")
+
+        write_file(os.path.join(OUTPUT_DIR, base + ".h"), "".join(header) + "\n")
+        write_file(os.path.join(OUTPUT_DIR, base + ".cpp"), "".join(source) + "\n")
+
+
+def generate_hierarchy(rng):
+    base = "KDGBenchHierarchy"
+    header = [FILE_HEADER, "\n#pragma once\n\n#include \"CoreMinimal.h\"\n#include \"UObject/Interface.h\"\n"
+              "#include \"Engine/LatentActionManager.h\"\n#include \"{0}.generated.h\"\n".format(base)]
+    source = [FILE_HEADER, "\n#include \"{0}.h\"\n".format(base)]
+
+    # Interface nodes are documented against the interface, message nodes against implementers
+    header.append("\n\nUINTERFACE(BlueprintType)\nclass UKDGBenchInterface : public UInterface\n{\n\tGENERATED_BODY()\n};\n\n"
+                  "class IKDGBenchInterface\n{\n\tGENERATED_BODY()\n\npublic:\n"
+                  "\t/** Benchmark interface query. */\n"
+                  "\tUFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = \"KDG Bench|Interface\")\n"
+                  "\tint32 BenchQuery(int32 Value, const FString& Label);\n\n"
+                  "\t/** Benchmark interface event. */\n"
+                  "\tUFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = \"KDG Bench|Interface\")\n"
+                  "\tvoid BenchNotify(bool bFlag, const FVector& Location);\n};\n")
+
+    parent = "UObject"
+    for depth in range(HIERARCHY_DEPTH):
+        class_name = "UKDGBenchDeep_{0:02d}".format(depth)
+        prefix = "Deep{0:02d}".format(depth)
+        interfaces = ", public IKDGBenchInterface" if depth == 0 else ""
+        header.append("\n\nUCLASS(Blueprintable, BlueprintType)\nclass {0} : public {1}{2}\n{{\n\tGENERATED_BODY()\n\npublic:\n".format(
+            class_name, parent, interfaces))
+        source.append("\n")
+
+        if depth == 0:
+            header.append("\tvirtual int32 BenchQuery_Implementation(int32 Value, const FString& Label) override { return Value; }\n\n")
+
+        for index in range(FUNCTIONS_PER_HIERARCHY_CLASS):
+            decl, (ret, name, params, body) = make_function(rng, prefix, index, False)
+            header.append(decl)
+            source.append("{0} {1}::{2}({3}) {{{4}}}\n".format(ret, class_name, name, ", ".join(params), body))
+
+        header.append("};\n")
+        parent = class_name
+
+    write_file(os.path.join(OUTPUT_DIR, base + ".h"), "".join(header) + "\n")
+    write_file(os.path.join(OUTPUT_DIR, base + ".cpp"), "".join(source) + "\n")
+
+
+def main():
+    os.makedirs(OUTPUT_DIR, exist_ok=True)
+    rng = random.Random(SEED)
+    generate_libraries(rng)
+    generate_hierarchy(rng)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,29 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+using UnrealBuildTool;
+using System.IO;
+
+// Synthetic classes for the KantanDocGen benchmark tests, never loaded unless a test asks for it.
+// The contents of Private/Bench are generated by GenerateBenchmarkClasses.py.
+public class KantanDocGenBenchmark : ModuleRules
+{
+	public KantanDocGenBenchmark(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		IWYUSupport = IWYUSupport.KeepAsIs;
+
+		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private", "Bench"));
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[] {
+				"Core",
+				"CoreUObject",
+				"Engine"
+			}
+		);
+	}
+}
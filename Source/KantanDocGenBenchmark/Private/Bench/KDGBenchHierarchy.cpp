@@ -0,0 +1,90 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#include "KDGBenchHierarchy.h"
+
+bool UKDGBenchDeep_00::Deep00_Fn000(UObject* In0, FName In1, bool In2, int32 In3, const FString& In4, const TArray< int32 >& In5, int32 In6, const FTransform& In7) { return {}; }
+void UKDGBenchDeep_00::Deep00_Fn001(UObject* In0, const FVector& In1, FString& Out2, FName In3, bool In4) {}
+int32 UKDGBenchDeep_00::Deep00_Fn002(bool In0, const FTransform& In1, FVector& Out2) { return {}; }
+void UKDGBenchDeep_00::Deep00_Fn003(bool In0) {}
+
+FString UKDGBenchDeep_01::Deep01_Fn000(int32 In0, const FTransform& In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, FName In5) { return {}; }
+int32 UKDGBenchDeep_01::Deep01_Fn001(const FString& In0, float In1, UObject* In2) { return {}; }
+FVector UKDGBenchDeep_01::Deep01_Fn002(FString& Out0, int32& Out1, UObject* In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchDeep_01::Deep01_Fn003(FName In0, int32& Out1, const TArray< int32 >& In2, FName In3) { return {}; }
+
+void UKDGBenchDeep_02::Deep02_Fn000(const FVector& In0, FName In1) {}
+int32 UKDGBenchDeep_02::Deep02_Fn001() { return {}; }
+int32 UKDGBenchDeep_02::Deep02_Fn002(FName In0, UObject* In1, const FString& In2, UObject* In3) { return {}; }
+bool UKDGBenchDeep_02::Deep02_Fn003(int32& Out0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5) { return {}; }
+
+FString UKDGBenchDeep_03::Deep03_Fn000(const FString& In0, bool In1, int32& Out2, const TArray< int32 >& In3, const FVector& In4) { return {}; }
+float UKDGBenchDeep_03::Deep03_Fn001(FString& Out0, FString& Out1, const FVector& In2, const FTransform& In3, float In4, const TArray< int32 >& In5, FName In6) { return {}; }
+void UKDGBenchDeep_03::Deep03_Fn002(bool In0, int32& Out1, bool In2, const FTransform& In3, const FVector& In4, const TArray< int32 >& In5, const TArray< int32 >& In6) {}
+FString UKDGBenchDeep_03::Deep03_Fn003(int32 In0, bool In1, int32& Out2, FName In3, int32 In4) { return {}; }
+
+int32 UKDGBenchDeep_04::Deep04_Fn000(float In0, const FVector& In1, const FString& In2, UObject* In3, bool In4) { return {}; }
+void UKDGBenchDeep_04::Deep04_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1, FString& Out2, bool In3) {}
+void UKDGBenchDeep_04::Deep04_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FVector& In1, const FVector& In2, const FVector& In3, float In4) {}
+int32 UKDGBenchDeep_04::Deep04_Fn003(const FVector& In0) { return {}; }
+
+int32 UKDGBenchDeep_05::Deep05_Fn000(FVector& Out0, int32 In1, float In2, const FString& In3, const FVector& In4) { return {}; }
+bool UKDGBenchDeep_05::Deep05_Fn001(float In0, const FTransform& In1, const FString& In2, const FTransform& In3, const FString& In4, const TArray< int32 >& In5, FVector& Out6) { return {}; }
+bool UKDGBenchDeep_05::Deep05_Fn002(FString& Out0) { return {}; }
+float UKDGBenchDeep_05::Deep05_Fn003(FString& Out0, int32 In1, FString& Out2, const FString& In3, FString& Out4, const FVector& In5) { return {}; }
+
+int32 UKDGBenchDeep_06::Deep06_Fn000() { return {}; }
+float UKDGBenchDeep_06::Deep06_Fn001() { return {}; }
+FVector UKDGBenchDeep_06::Deep06_Fn002(int32 In0, FName In1, FVector& Out2, const FVector& In3, FString& Out4, float In5, float In6) { return {}; }
+void UKDGBenchDeep_06::Deep06_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, float In2, UObject* In3, const FTransform& In4, float In5, const FTransform& In6) {}
+
+int32 UKDGBenchDeep_07::Deep07_Fn000(UObject* In0, bool In1, const FVector& In2, FString& Out3, bool In4) { return {}; }
+FVector UKDGBenchDeep_07::Deep07_Fn001() { return {}; }
+void UKDGBenchDeep_07::Deep07_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, FName In2, const TArray< int32 >& In3, int32& Out4) {}
+void UKDGBenchDeep_07::Deep07_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FString& In1) {}
+
+void UKDGBenchDeep_08::Deep08_Fn000(int32 In0, const FVector& In1, bool In2, FVector& Out3) {}
+FString UKDGBenchDeep_08::Deep08_Fn001(int32& Out0, int32 In1) { return {}; }
+bool UKDGBenchDeep_08::Deep08_Fn002(int32 In0, const FVector& In1, float In2, const FString& In3) { return {}; }
+void UKDGBenchDeep_08::Deep08_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1, FString& Out2, int32& Out3, int32& Out4, FString& Out5) {}
+
+int32 UKDGBenchDeep_09::Deep09_Fn000(bool In0, const FVector& In1, int32& Out2, bool In3, FString& Out4, int32& Out5) { return {}; }
+FString UKDGBenchDeep_09::Deep09_Fn001(const FString& In0) { return {}; }
+void UKDGBenchDeep_09::Deep09_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchDeep_09::Deep09_Fn003(UObject* In0, FVector& Out1, const FString& In2) {}
+
+float UKDGBenchDeep_10::Deep10_Fn000(const TArray< int32 >& In0, const FVector& In1) { return {}; }
+int32 UKDGBenchDeep_10::Deep10_Fn001(int32 In0, FName In1) { return {}; }
+void UKDGBenchDeep_10::Deep10_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FString UKDGBenchDeep_10::Deep10_Fn003(const TArray< int32 >& In0, const FString& In1, const FString& In2, const FString& In3, const FString& In4) { return {}; }
+
+float UKDGBenchDeep_11::Deep11_Fn000(const FVector& In0, const TArray< int32 >& In1) { return {}; }
+FVector UKDGBenchDeep_11::Deep11_Fn001() { return {}; }
+FVector UKDGBenchDeep_11::Deep11_Fn002() { return {}; }
+FVector UKDGBenchDeep_11::Deep11_Fn003(bool In0, int32 In1, const FTransform& In2, const TArray< int32 >& In3, const FTransform& In4) { return {}; }
+
+bool UKDGBenchDeep_12::Deep12_Fn000(const FString& In0, float In1, UObject* In2, const TArray< int32 >& In3, FString& Out4, bool In5, bool In6, const TArray< int32 >& In7) { return {}; }
+int32 UKDGBenchDeep_12::Deep12_Fn001(const TArray< int32 >& In0, int32& Out1, float In2) { return {}; }
+int32 UKDGBenchDeep_12::Deep12_Fn002(int32 In0, int32 In1, FVector& Out2) { return {}; }
+float UKDGBenchDeep_12::Deep12_Fn003(int32 In0, UObject* In1) { return {}; }
+
+int32 UKDGBenchDeep_13::Deep13_Fn000(bool In0, const FVector& In1) { return {}; }
+void UKDGBenchDeep_13::Deep13_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, FVector& Out2) {}
+int32 UKDGBenchDeep_13::Deep13_Fn002() { return {}; }
+FString UKDGBenchDeep_13::Deep13_Fn003(const FVector& In0, FVector& Out1, const FVector& In2, FString& Out3, bool In4) { return {}; }
+
+void UKDGBenchDeep_14::Deep14_Fn000() {}
+FVector UKDGBenchDeep_14::Deep14_Fn001(const FTransform& In0, FString& Out1, const FTransform& In2, const TArray< int32 >& In3, FString& Out4, int32& Out5, const FTransform& In6, bool In7) { return {}; }
+void UKDGBenchDeep_14::Deep14_Fn002(FName In0) {}
+void UKDGBenchDeep_14::Deep14_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1, bool In2, const FVector& In3) {}
+
+float UKDGBenchDeep_15::Deep15_Fn000(int32 In0, bool In1, FName In2, UObject* In3, UObject* In4, const FVector& In5, float In6, float In7) { return {}; }
+bool UKDGBenchDeep_15::Deep15_Fn001(const FString& In0, UObject* In1) { return {}; }
+void UKDGBenchDeep_15::Deep15_Fn002(int32 In0, int32 In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4) {}
+int32 UKDGBenchDeep_15::Deep15_Fn003(const FTransform& In0) { return {}; }
+
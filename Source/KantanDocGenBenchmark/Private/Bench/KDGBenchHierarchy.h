@@ -0,0 +1,374 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchHierarchy.generated.h"
+
+
+UINTERFACE(BlueprintType)
+class UKDGBenchInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class IKDGBenchInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark interface query. */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "KDG Bench|Interface")
+	int32 BenchQuery(int32 Value, const FString& Label);
+
+	/** Benchmark interface event. */
+	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "KDG Bench|Interface")
+	void BenchNotify(bool bFlag, const FVector& Location);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_00 : public UObject, public IKDGBenchInterface
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 BenchQuery_Implementation(int32 Value, const FString& Label) override { return Value; }
+
+	/** Benchmark callable node Deep00_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep00")
+	bool Deep00_Fn000(UObject* In0, FName In1, bool In2, int32 In3, const FString& In4, const TArray< int32 >& In5, int32 In6, const FTransform& In7);
+	/** Benchmark callable node Deep00_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep00")
+	void Deep00_Fn001(UObject* In0, const FVector& In1, FString& Out2, FName In3, bool In4);
+	/** Benchmark callable node Deep00_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep00")
+	int32 Deep00_Fn002(bool In0, const FTransform& In1, FVector& Out2);
+	/** Benchmark callable node Deep00_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep00")
+	void Deep00_Fn003(bool In0);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_01 : public UKDGBenchDeep_00
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep01_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep01")
+	FString Deep01_Fn000(int32 In0, const FTransform& In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, FName In5);
+	/** Benchmark pure node Deep01_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep01")
+	int32 Deep01_Fn001(const FString& In0, float In1, UObject* In2);
+	/** Benchmark pure node Deep01_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep01")
+	FVector Deep01_Fn002(FString& Out0, int32& Out1, UObject* In2, const FTransform& In3);
+	/** Benchmark pure node Deep01_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep01")
+	int32 Deep01_Fn003(FName In0, int32& Out1, const TArray< int32 >& In2, FName In3);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_02 : public UKDGBenchDeep_01
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep02_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep02")
+	void Deep02_Fn000(const FVector& In0, FName In1);
+	/** Benchmark callable node Deep02_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep02")
+	int32 Deep02_Fn001();
+	/** Benchmark pure node Deep02_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep02")
+	int32 Deep02_Fn002(FName In0, UObject* In1, const FString& In2, UObject* In3);
+	/** Benchmark pure node Deep02_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep02")
+	bool Deep02_Fn003(int32& Out0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_03 : public UKDGBenchDeep_02
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep03_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep03")
+	FString Deep03_Fn000(const FString& In0, bool In1, int32& Out2, const TArray< int32 >& In3, const FVector& In4);
+	/** Benchmark pure node Deep03_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep03")
+	float Deep03_Fn001(FString& Out0, FString& Out1, const FVector& In2, const FTransform& In3, float In4, const TArray< int32 >& In5, FName In6);
+	/** Benchmark callable node Deep03_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep03")
+	void Deep03_Fn002(bool In0, int32& Out1, bool In2, const FTransform& In3, const FVector& In4, const TArray< int32 >& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Deep03_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep03")
+	FString Deep03_Fn003(int32 In0, bool In1, int32& Out2, FName In3, int32 In4);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_04 : public UKDGBenchDeep_03
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep04_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep04")
+	int32 Deep04_Fn000(float In0, const FVector& In1, const FString& In2, UObject* In3, bool In4);
+	/** Benchmark latent node Deep04_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep04", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep04_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1, FString& Out2, bool In3);
+	/** Benchmark latent node Deep04_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep04", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep04_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FVector& In1, const FVector& In2, const FVector& In3, float In4);
+	/** Benchmark pure node Deep04_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep04")
+	int32 Deep04_Fn003(const FVector& In0);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_05 : public UKDGBenchDeep_04
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Deep05_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep05")
+	int32 Deep05_Fn000(FVector& Out0, int32 In1, float In2, const FString& In3, const FVector& In4);
+	/** Benchmark callable node Deep05_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep05")
+	bool Deep05_Fn001(float In0, const FTransform& In1, const FString& In2, const FTransform& In3, const FString& In4, const TArray< int32 >& In5, FVector& Out6);
+	/** Benchmark pure node Deep05_Fn002 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep05")
+	bool Deep05_Fn002(FString& Out0);
+	/** Benchmark callable node Deep05_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep05")
+	float Deep05_Fn003(FString& Out0, int32 In1, FString& Out2, const FString& In3, FString& Out4, const FVector& In5);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_06 : public UKDGBenchDeep_05
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Deep06_Fn000 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep06")
+	int32 Deep06_Fn000();
+	/** Benchmark callable node Deep06_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep06")
+	float Deep06_Fn001();
+	/** Benchmark callable node Deep06_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep06")
+	FVector Deep06_Fn002(int32 In0, FName In1, FVector& Out2, const FVector& In3, FString& Out4, float In5, float In6);
+	/** Benchmark latent node Deep06_Fn003 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep06", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep06_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, float In2, UObject* In3, const FTransform& In4, float In5, const FTransform& In6);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_07 : public UKDGBenchDeep_06
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep07_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep07")
+	int32 Deep07_Fn000(UObject* In0, bool In1, const FVector& In2, FString& Out3, bool In4);
+	/** Benchmark pure node Deep07_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep07")
+	FVector Deep07_Fn001();
+	/** Benchmark latent node Deep07_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep07", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep07_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, FName In2, const TArray< int32 >& In3, int32& Out4);
+	/** Benchmark latent node Deep07_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep07", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep07_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FString& In1);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_08 : public UKDGBenchDeep_07
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep08_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep08")
+	void Deep08_Fn000(int32 In0, const FVector& In1, bool In2, FVector& Out3);
+	/** Benchmark callable node Deep08_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep08")
+	FString Deep08_Fn001(int32& Out0, int32 In1);
+	/** Benchmark callable node Deep08_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep08")
+	bool Deep08_Fn002(int32 In0, const FVector& In1, float In2, const FString& In3);
+	/** Benchmark latent node Deep08_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep08", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep08_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1, FString& Out2, int32& Out3, int32& Out4, FString& Out5);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_09 : public UKDGBenchDeep_08
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Deep09_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep09")
+	int32 Deep09_Fn000(bool In0, const FVector& In1, int32& Out2, bool In3, FString& Out4, int32& Out5);
+	/** Benchmark pure node Deep09_Fn001 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep09")
+	FString Deep09_Fn001(const FString& In0);
+	/** Benchmark latent node Deep09_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep09", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep09_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Deep09_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep09")
+	void Deep09_Fn003(UObject* In0, FVector& Out1, const FString& In2);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_10 : public UKDGBenchDeep_09
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Deep10_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep10")
+	float Deep10_Fn000(const TArray< int32 >& In0, const FVector& In1);
+	/** Benchmark callable node Deep10_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep10")
+	int32 Deep10_Fn001(int32 In0, FName In1);
+	/** Benchmark latent node Deep10_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep10", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep10_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Deep10_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep10")
+	FString Deep10_Fn003(const TArray< int32 >& In0, const FString& In1, const FString& In2, const FString& In3, const FString& In4);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_11 : public UKDGBenchDeep_10
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep11_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep11")
+	float Deep11_Fn000(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Deep11_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep11")
+	FVector Deep11_Fn001();
+	/** Benchmark pure node Deep11_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep11")
+	FVector Deep11_Fn002();
+	/** Benchmark pure node Deep11_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep11")
+	FVector Deep11_Fn003(bool In0, int32 In1, const FTransform& In2, const TArray< int32 >& In3, const FTransform& In4);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_12 : public UKDGBenchDeep_11
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep12_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep12")
+	bool Deep12_Fn000(const FString& In0, float In1, UObject* In2, const TArray< int32 >& In3, FString& Out4, bool In5, bool In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Deep12_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep12")
+	int32 Deep12_Fn001(const TArray< int32 >& In0, int32& Out1, float In2);
+	/** Benchmark pure node Deep12_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep12")
+	int32 Deep12_Fn002(int32 In0, int32 In1, FVector& Out2);
+	/** Benchmark callable node Deep12_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep12")
+	float Deep12_Fn003(int32 In0, UObject* In1);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_13 : public UKDGBenchDeep_12
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Deep13_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep13")
+	int32 Deep13_Fn000(bool In0, const FVector& In1);
+	/** Benchmark latent node Deep13_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep13", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep13_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, FVector& Out2);
+	/** Benchmark pure node Deep13_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep13")
+	int32 Deep13_Fn002();
+	/** Benchmark pure node Deep13_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep13")
+	FString Deep13_Fn003(const FVector& In0, FVector& Out1, const FVector& In2, FString& Out3, bool In4);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_14 : public UKDGBenchDeep_13
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep14_Fn000 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep14")
+	void Deep14_Fn000();
+	/** Benchmark callable node Deep14_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep14")
+	FVector Deep14_Fn001(const FTransform& In0, FString& Out1, const FTransform& In2, const TArray< int32 >& In3, FString& Out4, int32& Out5, const FTransform& In6, bool In7);
+	/** Benchmark callable node Deep14_Fn002 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep14")
+	void Deep14_Fn002(FName In0);
+	/** Benchmark latent node Deep14_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep14", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	void Deep14_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1, bool In2, const FVector& In3);
+};
+
+
+UCLASS(Blueprintable, BlueprintType)
+class UKDGBenchDeep_15 : public UKDGBenchDeep_14
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Deep15_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep15")
+	float Deep15_Fn000(int32 In0, bool In1, FName In2, UObject* In3, UObject* In4, const FVector& In5, float In6, float In7);
+	/** Benchmark pure node Deep15_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep15")
+	bool Deep15_Fn001(const FString& In0, UObject* In1);
+	/** Benchmark callable node Deep15_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Deep15")
+	void Deep15_Fn002(int32 In0, int32 In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4);
+	/** Benchmark pure node Deep15_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Deep15")
+	int32 Deep15_Fn003(const FTransform& In0);
+};
+
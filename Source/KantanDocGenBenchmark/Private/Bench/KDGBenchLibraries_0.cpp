@@ -0,0 +1,1020 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#include "KDGBenchLibraries_0.h"
+
+void UKDGBenchLib_000::Lib000_Fn000(const TArray< int32 >& In0, const FTransform& In1, const TArray< int32 >& In2, UObject* In3, FName In4, FString& Out5, const FTransform& In6, const FTransform& In7) {}
+void UKDGBenchLib_000::Lib000_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FVector& In1, bool In2) {}
+FString UKDGBenchLib_000::Lib000_Fn002(int32& Out0, int32 In1, FName In2, float In3) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn003(float In0, int32 In1, FVector& Out2, const FVector& In3, const FVector& In4, const FVector& In5, const FVector& In6, const FVector& In7) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn004() { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn005(FString& Out0, const FTransform& In1, UObject* In2, const FString& In3, const FVector& In4, FName In5, FVector& Out6, UObject* In7) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn006(FVector& Out0) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FName In1, const FVector& In2, const FTransform& In3) {}
+int32 UKDGBenchLib_000::Lib000_Fn008(float In0, const FTransform& In1, FName In2, const TArray< int32 >& In3, const FVector& In4, FString& Out5, FString& Out6, int32& Out7) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn009(const TArray< int32 >& In0, const FString& In1, bool In2, const TArray< int32 >& In3, bool In4, bool In5, FString& Out6) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn010(const FVector& In0, UObject* In1, FString& Out2, FName In3, FString& Out4, UObject* In5) {}
+float UKDGBenchLib_000::Lib000_Fn011(float In0, float In1, FVector& Out2, bool In3) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn012(bool In0, int32& Out1, const FTransform& In2, float In3, const TArray< int32 >& In4, bool In5, const TArray< int32 >& In6, int32 In7) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn013(int32 In0, float In1, FVector& Out2, FVector& Out3, bool In4, int32 In5, const FVector& In6) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn014(FVector& Out0, const FTransform& In1, int32 In2, bool In3) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn015(float In0, const FVector& In1, UObject* In2, FName In3, const FTransform& In4, FName In5, const FVector& In6) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn016(const FTransform& In0, UObject* In1, FVector& Out2, const FVector& In3, FVector& Out4, float In5, float In6) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn017(const FTransform& In0, FName In1, const FVector& In2, const FString& In3, FString& Out4, FName In5) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn018(FVector& Out0, UObject* In1, int32& Out2, float In3, int32 In4, const FVector& In5, const TArray< int32 >& In6, bool In7) {}
+bool UKDGBenchLib_000::Lib000_Fn019(FName In0, FVector& Out1, FVector& Out2) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn020(int32& Out0, FString& Out1, const FTransform& In2, const FTransform& In3, int32 In4, UObject* In5) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn021(int32& Out0, const FString& In1) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn022(const FString& In0, UObject* In1, FVector& Out2) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn023() { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn024(const TArray< int32 >& In0) { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn025() { return {}; }
+float UKDGBenchLib_000::Lib000_Fn026(int32& Out0, const FTransform& In1, const FTransform& In2, FString& Out3, UObject* In4, FString& Out5) { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn027(int32& Out0, const TArray< int32 >& In1, int32& Out2) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn028(const FVector& In0, FName In1, const FVector& In2, FName In3, FString& Out4, bool In5) {}
+int32 UKDGBenchLib_000::Lib000_Fn029(const FTransform& In0, UObject* In1, int32 In2, const FString& In3, FName In4) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn030() { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn031(const FVector& In0, const FString& In1, bool In2, FVector& Out3, UObject* In4) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn032(bool In0, const TArray< int32 >& In1, const FTransform& In2, bool In3, bool In4, bool In5, const TArray< int32 >& In6, int32 In7) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn033(const FString& In0) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn034(float In0, const FVector& In1, FString& Out2, FVector& Out3) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn035(float In0, float In1, int32& Out2, const FTransform& In3, const FVector& In4) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn036(const FString& In0, int32 In1, bool In2, FString& Out3, const FTransform& In4) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn037(bool In0, FName In1, const FString& In2, const FString& In3, FName In4, const FVector& In5, bool In6, FName In7) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn038(int32& Out0, FVector& Out1, FVector& Out2, int32 In3, FName In4, FName In5) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn039(float In0, const FString& In1, FVector& Out2) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn040(UObject* In0, const TArray< int32 >& In1, int32 In2, float In3, FString& Out4, const FString& In5, const FString& In6, int32 In7) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn041(int32& Out0) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn042(FName In0) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn043(FName In0, int32& Out1) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn044(FString& Out0, bool In1, int32 In2, FString& Out3, const FString& In4) { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn045() { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn046(FString& Out0, UObject* In1) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn047(float In0, const TArray< int32 >& In1, const FString& In2, int32& Out3, FString& Out4, const TArray< int32 >& In5) {}
+FString UKDGBenchLib_000::Lib000_Fn048(bool In0) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn049(int32 In0, UObject* In1, const FString& In2, int32& Out3, int32 In4, int32 In5, const FTransform& In6, const FTransform& In7) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn050(const TArray< int32 >& In0, int32& Out1, FVector& Out2, const TArray< int32 >& In3) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, const FString& In2, FVector& Out3, const FVector& In4, UObject* In5) {}
+bool UKDGBenchLib_000::Lib000_Fn052(float In0, bool In1, int32 In2, FVector& Out3) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn053(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const TArray< int32 >& In1) {}
+float UKDGBenchLib_000::Lib000_Fn054(FVector& Out0) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn055(UObject* In0, FString& Out1, const FString& In2) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn056() { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn057(const FTransform& In0, UObject* In1, const TArray< int32 >& In2) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn058(const FVector& In0, FString& Out1, const FTransform& In2) {}
+FString UKDGBenchLib_000::Lib000_Fn059(int32 In0, int32 In1, FString& Out2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5, const FString& In6, FName In7) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn060(float In0) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn061(UObject* In0, UObject* In1, int32& Out2, bool In3, FVector& Out4, const FTransform& In5) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn062(FName In0, float In1, const FVector& In2, int32& Out3, int32 In4, float In5) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn063(const TArray< int32 >& In0, int32& Out1) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32& Out1) {}
+float UKDGBenchLib_000::Lib000_Fn065(float In0, float In1, bool In2) { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn066(int32 In0, UObject* In1, float In2) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn067(UObject* In0, const FTransform& In1, FVector& Out2, FName In3, UObject* In4) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn068(int32 In0) {}
+int32 UKDGBenchLib_000::Lib000_Fn069(float In0, const FVector& In1, float In2, const FTransform& In3, const FString& In4, int32 In5) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn070(FString& Out0, const FVector& In1, const FTransform& In2, const TArray< int32 >& In3, const FVector& In4, FVector& Out5, float In6, FString& Out7) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn071(float In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FString& In3) {}
+void UKDGBenchLib_000::Lib000_Fn072(FVector& Out0, const FString& In1, int32 In2, int32 In3, FVector& Out4, FString& Out5) {}
+int32 UKDGBenchLib_000::Lib000_Fn073(FName In0, FString& Out1, FVector& Out2, const FString& In3, int32& Out4, const FTransform& In5, float In6, int32 In7) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn074(const FTransform& In0) {}
+FString UKDGBenchLib_000::Lib000_Fn075(float In0, const FTransform& In1, int32& Out2, const FTransform& In3, const TArray< int32 >& In4, UObject* In5, int32 In6, FVector& Out7) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn076(FString& Out0, FVector& Out1, float In2, int32 In3, FName In4, FString& Out5) {}
+int32 UKDGBenchLib_000::Lib000_Fn077(int32 In0) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn078(int32 In0, const FTransform& In1, const FString& In2, UObject* In3, FVector& Out4, FVector& Out5, UObject* In6, FString& Out7) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+float UKDGBenchLib_000::Lib000_Fn080(FName In0, const FVector& In1) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn081(const FVector& In0, float In1, int32& Out2, FString& Out3, const FVector& In4) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn082(const FTransform& In0, float In1, bool In2, int32 In3, FName In4, bool In5, FName In6, const FVector& In7) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn083(int32 In0, UObject* In1) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn084(const FTransform& In0, const FString& In1, FString& Out2) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn085(const FString& In0, bool In1) { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn086(FName In0, float In1, const FVector& In2, const FVector& In3, bool In4, int32& Out5) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn087(int32& Out0, const FString& In1, FVector& Out2) { return {}; }
+void UKDGBenchLib_000::Lib000_Fn088(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, UObject* In1, int32& Out2, float In3) {}
+void UKDGBenchLib_000::Lib000_Fn089(UObject* In0, int32& Out1, int32& Out2, float In3, FName In4, FString& Out5) {}
+FString UKDGBenchLib_000::Lib000_Fn090(const FTransform& In0, FVector& Out1, bool In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn091(FVector& Out0, FVector& Out1, const FString& In2, const FVector& In3) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn092(UObject* In0, const TArray< int32 >& In1, int32& Out2, bool In3) { return {}; }
+float UKDGBenchLib_000::Lib000_Fn093(int32& Out0, UObject* In1, const FTransform& In2, FString& Out3, const FVector& In4, FName In5) { return {}; }
+int32 UKDGBenchLib_000::Lib000_Fn094(int32& Out0) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn095() { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn096(int32 In0, bool In1, FName In2, int32 In3, int32 In4) { return {}; }
+FString UKDGBenchLib_000::Lib000_Fn097(const FString& In0, FVector& Out1, const FTransform& In2) { return {}; }
+FVector UKDGBenchLib_000::Lib000_Fn098(int32 In0, bool In1, const TArray< int32 >& In2) { return {}; }
+bool UKDGBenchLib_000::Lib000_Fn099(FString& Out0, bool In1, const FTransform& In2) { return {}; }
+
+int32 UKDGBenchLib_001::Lib001_Fn000(const FString& In0, const FTransform& In1, const FTransform& In2, float In3, const TArray< int32 >& In4, float In5) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn001() { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn002(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, FName In3, const FString& In4, const FString& In5, int32 In6) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn003(FVector& Out0, FVector& Out1, const FTransform& In2, const TArray< int32 >& In3, const FString& In4, UObject* In5, const FVector& In6) {}
+FVector UKDGBenchLib_001::Lib001_Fn004(float In0) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn005() {}
+int32 UKDGBenchLib_001::Lib001_Fn006(bool In0, const TArray< int32 >& In1, bool In2, FVector& Out3, float In4) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn007(const FTransform& In0, const FTransform& In1) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn008(const FVector& In0, FString& Out1, FName In2, FName In3, const FVector& In4, FName In5, const FString& In6, int32& Out7) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn009(UObject* In0, FString& Out1, int32 In2, const FTransform& In3, const FTransform& In4, FName In5, float In6, const FVector& In7) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn010(int32& Out0, FName In1, FVector& Out2, const FTransform& In3, const TArray< int32 >& In4, const FTransform& In5, int32 In6) { return {}; }
+bool UKDGBenchLib_001::Lib001_Fn011(FString& Out0, const FTransform& In1, int32& Out2, bool In3) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn012(FName In0, UObject* In1, FVector& Out2, float In3) {}
+void UKDGBenchLib_001::Lib001_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FString& In1, FVector& Out2) {}
+FVector UKDGBenchLib_001::Lib001_Fn014(int32 In0, FName In1, const FTransform& In2, UObject* In3, FVector& Out4, const FVector& In5, const FVector& In6) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn015(FName In0) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn016(FName In0, int32& Out1, bool In2, UObject* In3, FVector& Out4, const TArray< int32 >& In5, const FString& In6) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn017(const FString& In0, int32& Out1, const FString& In2, const FVector& In3, const TArray< int32 >& In4, FVector& Out5, FName In6, bool In7) {}
+bool UKDGBenchLib_001::Lib001_Fn018(FName In0, FName In1, const TArray< int32 >& In2, int32 In3, FName In4) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn019() { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn020() { return {}; }
+float UKDGBenchLib_001::Lib001_Fn021(const FTransform& In0, FName In1, FVector& Out2, const FVector& In3, int32& Out4, float In5) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn022(const FVector& In0, FVector& Out1, const TArray< int32 >& In2, int32& Out3, const FVector& In4) { return {}; }
+bool UKDGBenchLib_001::Lib001_Fn023(FName In0, int32 In1) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn024() { return {}; }
+void UKDGBenchLib_001::Lib001_Fn025(FVector& Out0, const FTransform& In1, FName In2, const FString& In3, const FTransform& In4, FName In5) {}
+bool UKDGBenchLib_001::Lib001_Fn026(const FTransform& In0, FName In1, float In2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5, int32 In6) { return {}; }
+bool UKDGBenchLib_001::Lib001_Fn027(float In0, const FTransform& In1, const FTransform& In2, UObject* In3, int32 In4, const TArray< int32 >& In5, const FString& In6) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn028() {}
+int32 UKDGBenchLib_001::Lib001_Fn029(FString& Out0, float In1, UObject* In2) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn030(int32 In0, float In1, const FString& In2, int32& Out3, const FVector& In4, bool In5, const TArray< int32 >& In6, const FVector& In7) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_001::Lib001_Fn032(FVector& Out0, const FString& In1, const FTransform& In2, FString& Out3, float In4, const FTransform& In5) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn033(const FString& In0, const FTransform& In1, UObject* In2, const FTransform& In3, int32 In4, FString& Out5, FName In6) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn034() { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn035(UObject* In0) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn036(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn037(const FVector& In0, int32 In1, bool In2, int32& Out3) { return {}; }
+bool UKDGBenchLib_001::Lib001_Fn038(const FTransform& In0) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn039(const FTransform& In0, const FVector& In1, int32& Out2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5, FVector& Out6, const FString& In7) {}
+float UKDGBenchLib_001::Lib001_Fn040(int32& Out0) { return {}; }
+bool UKDGBenchLib_001::Lib001_Fn041(FName In0, FName In1, const FVector& In2, int32 In3, float In4) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn042(FName In0, const FTransform& In1, FName In2) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn043() { return {}; }
+float UKDGBenchLib_001::Lib001_Fn044() { return {}; }
+void UKDGBenchLib_001::Lib001_Fn045(bool In0, bool In1, int32 In2, FString& Out3, UObject* In4) {}
+FString UKDGBenchLib_001::Lib001_Fn046(float In0, bool In1, FVector& Out2, UObject* In3, const FVector& In4, FName In5, int32& Out6) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn047(UObject* In0, FName In1, const TArray< int32 >& In2, const FTransform& In3, FVector& Out4, UObject* In5, const FVector& In6) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn048() { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn049(bool In0, FVector& Out1, const FTransform& In2, UObject* In3, const FTransform& In4, FVector& Out5) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, float In2, int32& Out3, FVector& Out4, bool In5) {}
+float UKDGBenchLib_001::Lib001_Fn051(bool In0, int32& Out1, const FTransform& In2, int32& Out3, const FTransform& In4, const TArray< int32 >& In5, bool In6, FVector& Out7) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn052(float In0, bool In1, int32& Out2) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn053(const FVector& In0, int32 In1) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn054() { return {}; }
+void UKDGBenchLib_001::Lib001_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1) {}
+bool UKDGBenchLib_001::Lib001_Fn056(FName In0) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn057(FName In0, bool In1, int32& Out2, FName In3, const FVector& In4) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn058(UObject* In0, FName In1, FVector& Out2, const TArray< int32 >& In3, FName In4) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn059() { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn060(bool In0, const FString& In1, FVector& Out2, FVector& Out3, const FVector& In4, FString& Out5, float In6) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn061(const TArray< int32 >& In0, UObject* In1, float In2, const TArray< int32 >& In3, FVector& Out4, const FString& In5) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn062(int32& Out0, FString& Out1) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn063(float In0, float In1, const FString& In2, const FVector& In3, bool In4) {}
+float UKDGBenchLib_001::Lib001_Fn064(UObject* In0, int32 In1, FVector& Out2) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn065(int32& Out0, bool In1, const FString& In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn066(int32 In0, const FString& In1, const TArray< int32 >& In2) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn067() { return {}; }
+void UKDGBenchLib_001::Lib001_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, const FVector& In2, int32& Out3) {}
+void UKDGBenchLib_001::Lib001_Fn069(const FTransform& In0, float In1, bool In2, float In3, UObject* In4, UObject* In5, const TArray< int32 >& In6) {}
+FString UKDGBenchLib_001::Lib001_Fn070(FName In0, const FTransform& In1, const TArray< int32 >& In2, int32& Out3) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn071(const FTransform& In0, int32& Out1, FString& Out2, float In3) { return {}; }
+bool UKDGBenchLib_001::Lib001_Fn072(int32& Out0, FVector& Out1, bool In2, FName In3, FString& Out4) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn073(const FTransform& In0, const FString& In1, bool In2) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn074(FVector& Out0, FString& Out1, FVector& Out2, bool In3, const FTransform& In4, const FTransform& In5, UObject* In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn075(float In0, const FTransform& In1, float In2, const FString& In3) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn076(FString& Out0) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, const FVector& In2, FVector& Out3, FString& Out4, const FVector& In5, int32 In6, FName In7) {}
+FString UKDGBenchLib_001::Lib001_Fn078(FString& Out0, const FVector& In1, int32& Out2, FName In3, float In4, FVector& Out5, const FString& In6) { return {}; }
+float UKDGBenchLib_001::Lib001_Fn079(FName In0, UObject* In1, FString& Out2) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn080(const FTransform& In0, const FString& In1, bool In2) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn081(float In0, const FVector& In1, const FString& In2, const FVector& In3, const FVector& In4, FString& Out5, float In6, const TArray< int32 >& In7) {}
+void UKDGBenchLib_001::Lib001_Fn082(int32& Out0, const FVector& In1, FVector& Out2, UObject* In3, float In4) {}
+FVector UKDGBenchLib_001::Lib001_Fn083(const FString& In0) { return {}; }
+bool UKDGBenchLib_001::Lib001_Fn084(int32 In0, bool In1, FString& Out2, FVector& Out3, int32 In4, int32 In5, int32& Out6, const TArray< int32 >& In7) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn085(float In0, int32& Out1, FVector& Out2) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn086(const FString& In0, UObject* In1, const FString& In2, FVector& Out3) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn087(float In0) { return {}; }
+FString UKDGBenchLib_001::Lib001_Fn088(const TArray< int32 >& In0, const TArray< int32 >& In1, bool In2, const FTransform& In3, const FString& In4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn089(int32 In0, FString& Out1, const FVector& In2, const FTransform& In3, UObject* In4, int32& Out5, const FString& In6, FString& Out7) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn090(int32 In0, FName In1, bool In2, FName In3, bool In4) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn091(const FString& In0, const FString& In1, const FVector& In2, const TArray< int32 >& In3, const FTransform& In4, FVector& Out5, float In6) { return {}; }
+int32 UKDGBenchLib_001::Lib001_Fn092(float In0, int32& Out1, int32& Out2) { return {}; }
+FVector UKDGBenchLib_001::Lib001_Fn093(FString& Out0, FVector& Out1, const TArray< int32 >& In2, const FVector& In3, FString& Out4) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, const TArray< int32 >& In2, int32& Out3, FString& Out4, const FString& In5, bool In6) {}
+void UKDGBenchLib_001::Lib001_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1) {}
+void UKDGBenchLib_001::Lib001_Fn096(FString& Out0, int32 In1, FString& Out2, const FTransform& In3, FVector& Out4) {}
+FString UKDGBenchLib_001::Lib001_Fn097(const FVector& In0, UObject* In1) { return {}; }
+void UKDGBenchLib_001::Lib001_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FVector& In1, FString& Out2, FString& Out3, FString& Out4) {}
+void UKDGBenchLib_001::Lib001_Fn099(bool In0, const TArray< int32 >& In1) {}
+
+void UKDGBenchLib_002::Lib002_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, FName In4, const FString& In5, const FVector& In6) {}
+int32 UKDGBenchLib_002::Lib002_Fn001(FName In0, const FString& In1, UObject* In2, const FVector& In3, const TArray< int32 >& In4, bool In5) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn002(bool In0, int32 In1, FVector& Out2, FString& Out3) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn003(const FVector& In0, const FString& In1, FString& Out2) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn004(const FString& In0, float In1) {}
+bool UKDGBenchLib_002::Lib002_Fn005(FString& Out0, const FVector& In1, float In2, UObject* In3, const FTransform& In4, bool In5, bool In6, bool In7) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn006(int32 In0, UObject* In1, FName In2) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn007(int32& Out0, float In1, FVector& Out2, FString& Out3, FString& Out4, const FVector& In5, const TArray< int32 >& In6, FString& Out7) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn008(FString& Out0, const TArray< int32 >& In1, const FTransform& In2, const FString& In3, const FTransform& In4) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn009(int32 In0) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn010(FName In0, int32 In1, FVector& Out2, FString& Out3, float In4) {}
+int32 UKDGBenchLib_002::Lib002_Fn011(const FString& In0, const TArray< int32 >& In1, FString& Out2, UObject* In3) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn012(const FString& In0, const TArray< int32 >& In1, FName In2, int32 In3) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn013(int32 In0, UObject* In1, const FString& In2, UObject* In3, float In4) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, bool In1, float In2, const TArray< int32 >& In3, FVector& Out4, int32& Out5) {}
+FString UKDGBenchLib_002::Lib002_Fn015(FVector& Out0, const FVector& In1, int32 In2, float In3, UObject* In4) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn016(FString& Out0, FString& Out1, const FVector& In2, const FTransform& In3, const FTransform& In4) {}
+void UKDGBenchLib_002::Lib002_Fn017(FVector& Out0, const TArray< int32 >& In1, bool In2, bool In3, bool In4, FVector& Out5, UObject* In6) {}
+void UKDGBenchLib_002::Lib002_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, int32& Out2, const FString& In3, UObject* In4, int32 In5) {}
+float UKDGBenchLib_002::Lib002_Fn019(const FVector& In0) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn020(const TArray< int32 >& In0, float In1, const FVector& In2, const TArray< int32 >& In3, float In4) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn021(FVector& Out0, FVector& Out1, bool In2, const FString& In3) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn022(const FVector& In0, const FTransform& In1, const TArray< int32 >& In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn023(const FTransform& In0, const FVector& In1, FName In2, int32& Out3, const FVector& In4) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn024(const FVector& In0, int32& Out1, bool In2, const FString& In3) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn025(float In0, bool In1, bool In2, int32 In3, FName In4, const FVector& In5, const TArray< int32 >& In6, FVector& Out7) {}
+FString UKDGBenchLib_002::Lib002_Fn026(const FString& In0, const FTransform& In1, int32& Out2, const FVector& In3, FVector& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, const FString& In7) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn027(const FTransform& In0, FVector& Out1, FVector& Out2, const FTransform& In3) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn028(int32& Out0, FName In1, FString& Out2, FVector& Out3) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn029(int32 In0, FString& Out1, bool In2, FString& Out3, const FString& In4, const FString& In5) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, const FTransform& In4, int32& Out5, float In6, FVector& Out7) {}
+void UKDGBenchLib_002::Lib002_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, FName In2, float In3, bool In4) {}
+int32 UKDGBenchLib_002::Lib002_Fn032(const FString& In0, const FVector& In1, UObject* In2, UObject* In3, const FTransform& In4, const FVector& In5, UObject* In6) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn033(float In0) {}
+int32 UKDGBenchLib_002::Lib002_Fn034(FString& Out0) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn035(FName In0) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn036(float In0, int32& Out1, FVector& Out2, const FVector& In3, const FTransform& In4, UObject* In5, FString& Out6, const TArray< int32 >& In7) {}
+void UKDGBenchLib_002::Lib002_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1, float In2) {}
+FString UKDGBenchLib_002::Lib002_Fn038(const TArray< int32 >& In0, float In1, FVector& Out2, bool In3, int32& Out4, FName In5, const FTransform& In6, int32 In7) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn039(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const TArray< int32 >& In1, int32& Out2, UObject* In3, const FTransform& In4, const FString& In5, float In6, FVector& Out7) {}
+bool UKDGBenchLib_002::Lib002_Fn040(const FString& In0, const FTransform& In1, const TArray< int32 >& In2) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn041(FVector& Out0, FString& Out1, int32& Out2, const TArray< int32 >& In3, UObject* In4, const FVector& In5, const FVector& In6, const FTransform& In7) {}
+FString UKDGBenchLib_002::Lib002_Fn042() { return {}; }
+float UKDGBenchLib_002::Lib002_Fn043() { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn044(int32 In0) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn045(bool In0) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn046(float In0, const FVector& In1, UObject* In2, const TArray< int32 >& In3) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn047(const FVector& In0, float In1, bool In2) {}
+FString UKDGBenchLib_002::Lib002_Fn048(const FString& In0, int32 In1, FName In2, bool In3, FName In4, int32 In5, float In6) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn049(UObject* In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1, UObject* In2, float In3) {}
+int32 UKDGBenchLib_002::Lib002_Fn051(const FString& In0, const FString& In1) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn052(FName In0, const FTransform& In1, const FVector& In2, const FString& In3, const FTransform& In4, const FVector& In5) { return {}; }
+FString UKDGBenchLib_002::Lib002_Fn053(FString& Out0, const TArray< int32 >& In1, FName In2) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn054(const FString& In0, const FString& In1) {}
+int32 UKDGBenchLib_002::Lib002_Fn055(FString& Out0, const TArray< int32 >& In1, int32& Out2, int32& Out3, FString& Out4) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn056() { return {}; }
+FString UKDGBenchLib_002::Lib002_Fn057() { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn058(int32& Out0, UObject* In1) { return {}; }
+FString UKDGBenchLib_002::Lib002_Fn059(const FString& In0, const FVector& In1, bool In2, FName In3, FName In4, UObject* In5, float In6, const TArray< int32 >& In7) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn060(const FVector& In0, UObject* In1, float In2, float In3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_002::Lib002_Fn061(int32& Out0) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn062(const TArray< int32 >& In0, const FTransform& In1, int32& Out2, int32 In3, const FString& In4) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn063(const FVector& In0, bool In1, UObject* In2) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn064() { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn065() { return {}; }
+void UKDGBenchLib_002::Lib002_Fn066(const FTransform& In0, FName In1, float In2) {}
+bool UKDGBenchLib_002::Lib002_Fn067(UObject* In0, float In1, int32& Out2, UObject* In3, const FVector& In4, const FVector& In5, const FTransform& In6, const FVector& In7) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn068(UObject* In0, const FString& In1, float In2) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, FVector& Out2, float In3) {}
+FString UKDGBenchLib_002::Lib002_Fn070(const TArray< int32 >& In0, FString& Out1, FName In2, const FTransform& In3, UObject* In4) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn071(FString& Out0, int32 In1, int32& Out2, UObject* In3) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn072(float In0, int32 In1, const TArray< int32 >& In2, FName In3) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn073(int32& Out0) {}
+int32 UKDGBenchLib_002::Lib002_Fn074(const FVector& In0, int32 In1, UObject* In2, UObject* In3, const FString& In4, const TArray< int32 >& In5, FString& Out6, const FVector& In7) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn075(FVector& Out0) { return {}; }
+FVector UKDGBenchLib_002::Lib002_Fn076(bool In0, int32 In1, UObject* In2, FVector& Out3, const TArray< int32 >& In4, FName In5, const TArray< int32 >& In6) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn077(const TArray< int32 >& In0, const TArray< int32 >& In1, const FVector& In2) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn078(const FTransform& In0, int32 In1, FVector& Out2, const TArray< int32 >& In3, const FTransform& In4, FVector& Out5, const TArray< int32 >& In6, FName In7) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn079(int32 In0) {}
+void UKDGBenchLib_002::Lib002_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1) {}
+FVector UKDGBenchLib_002::Lib002_Fn081() { return {}; }
+FString UKDGBenchLib_002::Lib002_Fn082(float In0, const TArray< int32 >& In1, int32 In2) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn083(int32 In0, int32 In1) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn084(const FVector& In0, float In1, const FString& In2, int32 In3, int32& Out4, FName In5, const TArray< int32 >& In6) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn085(int32 In0, int32 In1, int32& Out2, int32& Out3, FVector& Out4, UObject* In5, const FVector& In6, const FString& In7) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn086(FName In0) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn087(FString& Out0, float In1, bool In2, UObject* In3, const FString& In4, UObject* In5, int32 In6) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn088(int32& Out0, const FString& In1) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn089(float In0, float In1, float In2, const FVector& In3, int32 In4, int32& Out5) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn090(const TArray< int32 >& In0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3, float In4, const FString& In5, const FVector& In6) { return {}; }
+void UKDGBenchLib_002::Lib002_Fn091() {}
+bool UKDGBenchLib_002::Lib002_Fn092(const TArray< int32 >& In0, UObject* In1, UObject* In2) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn093(const FString& In0) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn094(int32 In0, int32& Out1, const FVector& In2) { return {}; }
+bool UKDGBenchLib_002::Lib002_Fn095(int32& Out0, const FString& In1, const FVector& In2, FVector& Out3) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn096(const FString& In0, bool In1, int32 In2, float In3, bool In4, int32& Out5, float In6, int32& Out7) { return {}; }
+float UKDGBenchLib_002::Lib002_Fn097(FVector& Out0, FName In1, int32 In2) { return {}; }
+FString UKDGBenchLib_002::Lib002_Fn098(const FString& In0, bool In1, int32& Out2) { return {}; }
+int32 UKDGBenchLib_002::Lib002_Fn099() { return {}; }
+
+int32 UKDGBenchLib_003::Lib003_Fn000(float In0) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_003::Lib003_Fn002(const FString& In0, UObject* In1) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn003(FVector& Out0, int32& Out1, int32& Out2, const FVector& In3, FVector& Out4, const FTransform& In5, FString& Out6) {}
+FVector UKDGBenchLib_003::Lib003_Fn004(const FString& In0, float In1, FName In2, const FTransform& In3, FVector& Out4, const FTransform& In5, const FTransform& In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn005() { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn006(float In0, const FVector& In1, const TArray< int32 >& In2, const FTransform& In3, const FString& In4, FName In5) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn007(const FTransform& In0, const FString& In1, FName In2, const FVector& In3, int32 In4, const FVector& In5, const FString& In6) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn008(const TArray< int32 >& In0, FString& Out1) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn009(int32& Out0, FString& Out1, FString& Out2, const FTransform& In3) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn010() { return {}; }
+void UKDGBenchLib_003::Lib003_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, bool In1, const FTransform& In2, const FTransform& In3) {}
+float UKDGBenchLib_003::Lib003_Fn012(FVector& Out0, int32& Out1, const FTransform& In2, int32& Out3, float In4, const FTransform& In5, const TArray< int32 >& In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn013(float In0, int32& Out1) {}
+FVector UKDGBenchLib_003::Lib003_Fn014(float In0, int32 In1) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn015(int32 In0, const TArray< int32 >& In1, FName In2, int32 In3, UObject* In4) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, int32 In2, int32 In3, bool In4, const FVector& In5) {}
+int32 UKDGBenchLib_003::Lib003_Fn017(FString& Out0) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn018(const FString& In0) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn019(int32& Out0) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn020(const FVector& In0, UObject* In1, int32 In2, const FString& In3, float In4, const TArray< int32 >& In5, const FVector& In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, const FVector& In2, bool In3, const FTransform& In4, FName In5) {}
+FString UKDGBenchLib_003::Lib003_Fn022(UObject* In0, int32 In1, const FTransform& In2, bool In3, FName In4, FVector& Out5) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn023(FName In0, FString& Out1, bool In2, FName In3, float In4) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn024(FVector& Out0, int32& Out1, const FVector& In2, const FString& In3, const TArray< int32 >& In4, FString& Out5) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FString& In1) {}
+int32 UKDGBenchLib_003::Lib003_Fn026(int32 In0, const FTransform& In1, const FString& In2, FVector& Out3, const FVector& In4, bool In5) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn027(const FVector& In0, const FString& In1, const FVector& In2) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn028(const FString& In0, const TArray< int32 >& In1, const FTransform& In2, UObject* In3, UObject* In4, const FString& In5, FString& Out6) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn029(bool In0, FName In1, const FTransform& In2, const TArray< int32 >& In3) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FTransform& In1, FString& Out2, const FVector& In3, const FVector& In4, float In5) {}
+FVector UKDGBenchLib_003::Lib003_Fn031(int32 In0, FString& Out1, int32& Out2, const FTransform& In3, int32& Out4, const FTransform& In5, UObject* In6, const FTransform& In7) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn032(FName In0, int32& Out1, UObject* In2, int32& Out3, int32 In4, const TArray< int32 >& In5, float In6, const FVector& In7) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn033(const TArray< int32 >& In0, bool In1) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn034(const FVector& In0, const FVector& In1, int32 In2, const FVector& In3, bool In4, const FString& In5, int32 In6, UObject* In7) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn035(bool In0, int32& Out1, int32 In2, int32& Out3, const FTransform& In4, const FVector& In5, const TArray< int32 >& In6) { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn036(FString& Out0, bool In1) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn037(UObject* In0, int32 In1, FString& Out2, int32 In3, FVector& Out4, FName In5) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FString UKDGBenchLib_003::Lib003_Fn039(UObject* In0, const TArray< int32 >& In1, float In2, int32& Out3, float In4, UObject* In5) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn040(int32 In0, FName In1, FName In2) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn041(float In0) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn042(int32& Out0, UObject* In1, int32& Out2, const TArray< int32 >& In3, bool In4, const FTransform& In5) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32& Out1, const FVector& In2, bool In3, const FVector& In4) {}
+bool UKDGBenchLib_003::Lib003_Fn044(FName In0) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn045(UObject* In0, const FTransform& In1, const FString& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, const FString& In5, FVector& Out6, int32& Out7) {}
+void UKDGBenchLib_003::Lib003_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, float In1, FString& Out2, const FTransform& In3, const FString& In4, float In5, int32 In6) {}
+int32 UKDGBenchLib_003::Lib003_Fn047() { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn048(UObject* In0, const TArray< int32 >& In1, bool In2, const FVector& In3, const TArray< int32 >& In4, FName In5, UObject* In6, FName In7) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn049(bool In0, int32 In1, UObject* In2) {}
+void UKDGBenchLib_003::Lib003_Fn050() {}
+int32 UKDGBenchLib_003::Lib003_Fn051(float In0, int32& Out1, int32& Out2) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn052(const TArray< int32 >& In0, const FVector& In1, UObject* In2) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn053(FName In0, UObject* In1, FVector& Out2, const FString& In3, int32& Out4, const FVector& In5, int32& Out6) { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn054(const FString& In0, int32& Out1, const TArray< int32 >& In2, bool In3) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn055(float In0, const FTransform& In1, const FString& In2, float In3) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0) {}
+int32 UKDGBenchLib_003::Lib003_Fn057(FString& Out0) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn058(UObject* In0, FName In1, FVector& Out2, const TArray< int32 >& In3, bool In4, UObject* In5, const FVector& In6, int32& Out7) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn059(float In0, int32& Out1, int32 In2, float In3, FName In4, const FTransform& In5, const FVector& In6) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn060() { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn061() { return {}; }
+void UKDGBenchLib_003::Lib003_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FName In1, FString& Out2) {}
+float UKDGBenchLib_003::Lib003_Fn063(int32& Out0, float In1, UObject* In2) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn064(float In0) {}
+bool UKDGBenchLib_003::Lib003_Fn065(bool In0, UObject* In1, const FTransform& In2, const FString& In3, UObject* In4, float In5, FName In6) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, UObject* In1, FString& Out2) {}
+int32 UKDGBenchLib_003::Lib003_Fn067(const FString& In0, float In1, const FString& In2) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn068(FVector& Out0, const TArray< int32 >& In1) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn069(int32& Out0) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn070(FVector& Out0, int32& Out1, FName In2) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1, UObject* In2, FName In3, const FVector& In4, int32 In5, FString& Out6) {}
+int32 UKDGBenchLib_003::Lib003_Fn072(const FVector& In0, const FString& In1, FString& Out2, const FTransform& In3, float In4, bool In5, FName In6) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn073() { return {}; }
+void UKDGBenchLib_003::Lib003_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, UObject* In1, const FString& In2, int32& Out3, const FVector& In4) {}
+float UKDGBenchLib_003::Lib003_Fn075(float In0, bool In1, FName In2, const TArray< int32 >& In3, UObject* In4, UObject* In5, float In6) { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn076(int32& Out0, FName In1) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn077(UObject* In0, FVector& Out1, FVector& Out2, UObject* In3, UObject* In4, FName In5, bool In6) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn078(float In0, FName In1, int32 In2) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn079(UObject* In0, const FString& In1, UObject* In2, FVector& Out3, int32 In4, const FTransform& In5) { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn080(float In0) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn081(FString& Out0, int32 In1) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn082(bool In0, int32& Out1, bool In2, int32& Out3, const FTransform& In4, int32& Out5, UObject* In6, int32 In7) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn083(int32 In0, bool In1, int32& Out2, int32 In3, FString& Out4, const TArray< int32 >& In5, const FVector& In6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn084(int32 In0, const FString& In1, FString& Out2, FName In3) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn085(int32 In0, const FTransform& In1, UObject* In2, FVector& Out3, bool In4, bool In5, UObject* In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn086(const FString& In0, FVector& Out1, FString& Out2, FString& Out3) { return {}; }
+FString UKDGBenchLib_003::Lib003_Fn087(const FVector& In0, int32 In1, float In2, const FVector& In3, const FVector& In4, UObject* In5, int32 In6) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn088(int32& Out0, UObject* In1, int32& Out2, int32 In3, bool In4) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn089(int32& Out0) { return {}; }
+bool UKDGBenchLib_003::Lib003_Fn090(FString& Out0, const FString& In1, int32& Out2, int32 In3, int32 In4, FString& Out5) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn091(bool In0, UObject* In1, bool In2) { return {}; }
+void UKDGBenchLib_003::Lib003_Fn092(UObject* In0, const FTransform& In1, const FString& In2, FString& Out3, bool In4, int32& Out5, bool In6, const FVector& In7) {}
+int32 UKDGBenchLib_003::Lib003_Fn093(int32& Out0, int32& Out1, FVector& Out2, FName In3, int32& Out4, const TArray< int32 >& In5, int32 In6, const FString& In7) { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn094(int32& Out0, FString& Out1) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn095(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const TArray< int32 >& In3) { return {}; }
+int32 UKDGBenchLib_003::Lib003_Fn096(const FVector& In0, const TArray< int32 >& In1, FVector& Out2, UObject* In3, FVector& Out4, int32 In5, FVector& Out6, int32 In7) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn097(const FString& In0, int32 In1, FName In2, FName In3, FName In4, int32 In5, const FVector& In6) { return {}; }
+float UKDGBenchLib_003::Lib003_Fn098() { return {}; }
+FVector UKDGBenchLib_003::Lib003_Fn099(int32 In0, int32& Out1) { return {}; }
+
+void UKDGBenchLib_004::Lib004_Fn000(UObject* In0, float In1, bool In2, const FVector& In3) {}
+float UKDGBenchLib_004::Lib004_Fn001(const TArray< int32 >& In0, int32 In1) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn002(const FVector& In0, const FVector& In1, const FVector& In2, const TArray< int32 >& In3, const TArray< int32 >& In4) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn003(const FTransform& In0, int32 In1, const TArray< int32 >& In2, FString& Out3, const TArray< int32 >& In4, FString& Out5) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0) {}
+float UKDGBenchLib_004::Lib004_Fn005(int32 In0, const FVector& In1, float In2, FName In3, const FString& In4, int32& Out5, FName In6) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn006(float In0) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn007(FVector& Out0, FName In1, const FVector& In2, FString& Out3, FName In4, UObject* In5, const FString& In6) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn008(FVector& Out0, const FString& In1, int32& Out2, const FString& In3) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FName In1, UObject* In2, UObject* In3) {}
+float UKDGBenchLib_004::Lib004_Fn010(const TArray< int32 >& In0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn011(const FTransform& In0, bool In1) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn012(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn013(float In0, FName In1, FName In2, bool In3, UObject* In4, FString& Out5) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn014() { return {}; }
+void UKDGBenchLib_004::Lib004_Fn015(int32& Out0, UObject* In1, FName In2, const FString& In3) {}
+bool UKDGBenchLib_004::Lib004_Fn016(UObject* In0, const FTransform& In1) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn017() { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn018(FName In0, FVector& Out1, float In2, bool In3, const FString& In4) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn019(const FString& In0, UObject* In1, bool In2, int32& Out3, const FTransform& In4, const TArray< int32 >& In5) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn020(FString& Out0) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn021(FVector& Out0, const FString& In1) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn022(int32 In0) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn023() { return {}; }
+void UKDGBenchLib_004::Lib004_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, int32& Out2) {}
+int32 UKDGBenchLib_004::Lib004_Fn025(const FVector& In0, FVector& Out1, const FString& In2, int32& Out3) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn026(const FTransform& In0, const FTransform& In1, FName In2, FVector& Out3) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32& Out1, FVector& Out2, int32 In3, int32& Out4, FString& Out5) {}
+void UKDGBenchLib_004::Lib004_Fn028(int32 In0, int32 In1, const FTransform& In2, int32& Out3, const FVector& In4, const FString& In5) {}
+void UKDGBenchLib_004::Lib004_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1, const FString& In2, float In3) {}
+float UKDGBenchLib_004::Lib004_Fn030(FString& Out0, const TArray< int32 >& In1) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn031(int32 In0, FVector& Out1, UObject* In2, FName In3, bool In4, int32 In5) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn032(bool In0, const FTransform& In1, const FString& In2, int32 In3) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn033(const FVector& In0, bool In1, const FTransform& In2, int32& Out3, UObject* In4) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn034(bool In0, const FVector& In1, FName In2, UObject* In3, FString& Out4, const FString& In5, FName In6) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn035(float In0, const FVector& In1, FVector& Out2, FVector& Out3, float In4) {}
+void UKDGBenchLib_004::Lib004_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3) {}
+int32 UKDGBenchLib_004::Lib004_Fn037(const FVector& In0) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn038(int32& Out0, float In1, float In2, int32& Out3, int32 In4, FName In5, UObject* In6) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn039(const FTransform& In0, bool In1, int32& Out2, FString& Out3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn040(int32& Out0, bool In1, UObject* In2, int32 In3, const FVector& In4) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn041(FString& Out0) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn042(const FVector& In0, bool In1, const FString& In2, const TArray< int32 >& In3, const FTransform& In4, FVector& Out5, const FTransform& In6) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn043(const FVector& In0, int32& Out1, bool In2, const FVector& In3, const FVector& In4, FVector& Out5, const FVector& In6) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1) {}
+FString UKDGBenchLib_004::Lib004_Fn045(FString& Out0, FVector& Out1, FName In2, int32 In3) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn046(const TArray< int32 >& In0, int32 In1, const FTransform& In2) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn047(const TArray< int32 >& In0, UObject* In1, const FTransform& In2, const TArray< int32 >& In3, bool In4, float In5) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn048() { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn049(const FVector& In0, FVector& Out1, const TArray< int32 >& In2, FName In3) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn050(int32 In0) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, const FVector& In2) {}
+void UKDGBenchLib_004::Lib004_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const TArray< int32 >& In1, FString& Out2, int32 In3, UObject* In4) {}
+void UKDGBenchLib_004::Lib004_Fn053(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0) {}
+void UKDGBenchLib_004::Lib004_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FString& In1, bool In2) {}
+void UKDGBenchLib_004::Lib004_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0) {}
+FString UKDGBenchLib_004::Lib004_Fn056(FName In0, FString& Out1, float In2, bool In3, bool In4, const FVector& In5) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn057(const TArray< int32 >& In0, int32 In1, int32 In2, bool In3) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn058(const TArray< int32 >& In0, float In1, FString& Out2, float In3, FString& Out4, bool In5, const FTransform& In6, UObject* In7) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn059(FName In0, const FString& In1, const FTransform& In2, bool In3, const TArray< int32 >& In4) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn060(const TArray< int32 >& In0, float In1, const FTransform& In2, FName In3, FString& Out4, FName In5, bool In6) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn061(const TArray< int32 >& In0, FVector& Out1, FString& Out2) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn062(const FVector& In0, FString& Out1, bool In2, int32 In3, UObject* In4, FString& Out5) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn063(FString& Out0) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn064(const FTransform& In0, const FVector& In1) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn065(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_004::Lib004_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, const FString& In2, const FString& In3, const FTransform& In4, UObject* In5, float In6, FName In7) {}
+int32 UKDGBenchLib_004::Lib004_Fn067(const TArray< int32 >& In0, int32 In1, const FVector& In2) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FString& In1, FString& Out2) {}
+void UKDGBenchLib_004::Lib004_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, bool In1, bool In2, FString& Out3) {}
+float UKDGBenchLib_004::Lib004_Fn070(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn071(FString& Out0) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn072(bool In0) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn073(int32& Out0) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn074(const FVector& In0) { return {}; }
+bool UKDGBenchLib_004::Lib004_Fn075(const TArray< int32 >& In0, bool In1, FString& Out2, FVector& Out3, const FString& In4, bool In5, const FVector& In6, int32& Out7) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn076(UObject* In0) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn077(const FTransform& In0, const TArray< int32 >& In1) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn078(float In0, FVector& Out1, bool In2, int32& Out3) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1) {}
+int32 UKDGBenchLib_004::Lib004_Fn080(FString& Out0, float In1, int32 In2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn081(float In0, const FString& In1, FName In2, FName In3, FName In4, FVector& Out5) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn082(const TArray< int32 >& In0, const FVector& In1, FVector& Out2, bool In3, const FVector& In4, FName In5) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn083(float In0, const FTransform& In1, UObject* In2, bool In3, FString& Out4, bool In5, UObject* In6, const FString& In7) {}
+FVector UKDGBenchLib_004::Lib004_Fn084(FVector& Out0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4, const FString& In5) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn085(int32 In0, UObject* In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, const FVector& In5, int32& Out6) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1, UObject* In2, FString& Out3, const FTransform& In4) {}
+float UKDGBenchLib_004::Lib004_Fn087(const FString& In0, float In1, const TArray< int32 >& In2, const FString& In3, const FTransform& In4) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn088(const FTransform& In0) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn089(UObject* In0, const FTransform& In1, FVector& Out2, const FVector& In3, UObject* In4, FVector& Out5, FString& Out6, const TArray< int32 >& In7) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn090(const FTransform& In0, const FTransform& In1, const FTransform& In2, FName In3, FName In4, float In5, bool In6, float In7) { return {}; }
+FVector UKDGBenchLib_004::Lib004_Fn091(int32& Out0, FVector& Out1, FName In2, FVector& Out3) { return {}; }
+FString UKDGBenchLib_004::Lib004_Fn092(FName In0, const TArray< int32 >& In1, FName In2, const FString& In3, bool In4, UObject* In5, FString& Out6, const FString& In7) { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn093(int32& Out0, const FString& In1, bool In2) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn094(float In0) { return {}; }
+float UKDGBenchLib_004::Lib004_Fn095(FName In0, const TArray< int32 >& In1, float In2) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_004::Lib004_Fn097() { return {}; }
+int32 UKDGBenchLib_004::Lib004_Fn098(UObject* In0) { return {}; }
+void UKDGBenchLib_004::Lib004_Fn099(FName In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3, FString& Out4, FString& Out5, const TArray< int32 >& In6, int32 In7) {}
+
+int32 UKDGBenchLib_005::Lib005_Fn000(const FString& In0) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn001(bool In0, const TArray< int32 >& In1) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn002(UObject* In0, int32 In1, int32& Out2, float In3, FString& Out4, FString& Out5, float In6, int32& Out7) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn003(FString& Out0, FName In1, UObject* In2, FName In3, const FString& In4, int32& Out5, bool In6) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn004(const FTransform& In0) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn005() { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn006(const FVector& In0, const FString& In1) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn007(const FVector& In0) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn008() { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn009(FName In0, const TArray< int32 >& In1, UObject* In2, FVector& Out3) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn010(int32& Out0, const FString& In1, FVector& Out2, int32 In3, FName In4, FVector& Out5, int32& Out6, int32 In7) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn011(const FString& In0, FString& Out1, float In2, const FVector& In3, const FTransform& In4) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn012(bool In0, UObject* In1, UObject* In2, int32& Out3) {}
+FVector UKDGBenchLib_005::Lib005_Fn013(float In0, FName In1, const FVector& In2) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, bool In2, const TArray< int32 >& In3, UObject* In4, bool In5, float In6) {}
+void UKDGBenchLib_005::Lib005_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, UObject* In1, float In2, FString& Out3, FString& Out4, int32& Out5) {}
+FString UKDGBenchLib_005::Lib005_Fn016(const TArray< int32 >& In0, UObject* In1, int32& Out2, bool In3) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn017(UObject* In0, const FString& In1, FName In2, bool In3) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn018(const FTransform& In0, const FVector& In1, UObject* In2, const FString& In3, bool In4, FName In5) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn019(FString& Out0, const FString& In1) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn020(FName In0, int32& Out1, float In2, UObject* In3, const TArray< int32 >& In4) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1) {}
+FVector UKDGBenchLib_005::Lib005_Fn022(FString& Out0, FName In1, UObject* In2, const TArray< int32 >& In3, FName In4) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn023(FName In0, int32 In1, const TArray< int32 >& In2) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn024(int32& Out0, const TArray< int32 >& In1, FVector& Out2) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn025(const TArray< int32 >& In0) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn026(const FString& In0, int32 In1) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn027() { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn028(FString& Out0, const FTransform& In1, FName In2, int32& Out3) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn029(bool In0) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn030() { return {}; }
+float UKDGBenchLib_005::Lib005_Fn031(int32 In0) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn032() { return {}; }
+float UKDGBenchLib_005::Lib005_Fn033(FVector& Out0, float In1, FName In2, int32 In3, const FVector& In4) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn034(FVector& Out0, FString& Out1, const FTransform& In2, bool In3, FVector& Out4, const TArray< int32 >& In5) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn035(const FString& In0, UObject* In1, int32 In2, bool In3, UObject* In4, FString& Out5) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn036(FString& Out0, FString& Out1, int32 In2, const FTransform& In3, const TArray< int32 >& In4) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn037(UObject* In0, UObject* In1, bool In2, const TArray< int32 >& In3) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn038(bool In0, int32 In1, FVector& Out2, int32& Out3, FString& Out4, const TArray< int32 >& In5, const FTransform& In6) {}
+FString UKDGBenchLib_005::Lib005_Fn039(UObject* In0, bool In1, const FString& In2, FVector& Out3, float In4, FVector& Out5, const FString& In6) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn040(float In0, FString& Out1, const FString& In2, float In3) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn041(FVector& Out0, const TArray< int32 >& In1, float In2) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FVector& In1, int32 In2, const TArray< int32 >& In3, const FTransform& In4, const FString& In5, FString& Out6) {}
+int32 UKDGBenchLib_005::Lib005_Fn043(FString& Out0, const TArray< int32 >& In1, FVector& Out2, const FVector& In3, int32 In4, bool In5) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn044(const FTransform& In0, const FString& In1) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn045(FName In0, bool In1, UObject* In2, FVector& Out3) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn046(float In0, const FTransform& In1) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn047(const FString& In0, float In1, UObject* In2, FString& Out3, FString& Out4) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn048(const FString& In0, float In1, UObject* In2, FName In3, FName In4, int32& Out5) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn049(FString& Out0) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn050(const FString& In0, const TArray< int32 >& In1, UObject* In2, FName In3, int32& Out4, FName In5, FString& Out6) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn051(FName In0, FName In1, FString& Out2, const FVector& In3, const TArray< int32 >& In4) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn052(bool In0, float In1, const FVector& In2, FName In3, const FString& In4, int32 In5, FVector& Out6) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn053() { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn054(const FTransform& In0, const TArray< int32 >& In1, const FString& In2, const TArray< int32 >& In3, FVector& Out4, const FTransform& In5, const FVector& In6, int32& Out7) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn055(const FVector& In0, float In1, UObject* In2, FName In3, bool In4, bool In5) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn056(bool In0) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn057(UObject* In0, const FTransform& In1, bool In2, const FString& In3, FString& Out4, FVector& Out5, FVector& Out6) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn058(UObject* In0, FName In1) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn059(const FVector& In0, FString& Out1, const TArray< int32 >& In2, const FString& In3, int32& Out4, FString& Out5, UObject* In6) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn060(const FTransform& In0, int32 In1, const FTransform& In2, FVector& Out3, const FString& In4, int32& Out5, FName In6) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn061(const FTransform& In0, FString& Out1, int32& Out2, FString& Out3, const FVector& In4, int32 In5, FName In6) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn062(int32 In0, FString& Out1, const TArray< int32 >& In2, FName In3) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn063(FVector& Out0, UObject* In1, bool In2, const FVector& In3, int32 In4, const FVector& In5) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn064(const FString& In0, const FVector& In1, FString& Out2, FName In3) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn065(const FString& In0, FString& Out1, const FVector& In2, float In3, float In4, UObject* In5, int32& Out6) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn066(FVector& Out0, bool In1) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn067(const FString& In0, const FTransform& In1) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn068(const FTransform& In0, float In1, bool In2) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn069(FName In0) {}
+void UKDGBenchLib_005::Lib005_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FString& Out1, UObject* In2, FVector& Out3, const FTransform& In4, UObject* In5, FVector& Out6) {}
+float UKDGBenchLib_005::Lib005_Fn071(int32 In0, float In1, const FString& In2, FVector& Out3, const FVector& In4, int32& Out5, FString& Out6) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1, int32& Out2, const FTransform& In3) {}
+void UKDGBenchLib_005::Lib005_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FString& Out1, float In2, const FTransform& In3, FName In4, int32 In5) {}
+int32 UKDGBenchLib_005::Lib005_Fn074(float In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn075() { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn076(const FTransform& In0, const TArray< int32 >& In1, FName In2) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn077(FString& Out0) { return {}; }
+bool UKDGBenchLib_005::Lib005_Fn078() { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn079(const TArray< int32 >& In0, float In1) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn080(const TArray< int32 >& In0, const FString& In1, FString& Out2) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn081(int32 In0) {}
+void UKDGBenchLib_005::Lib005_Fn082(const FTransform& In0, const FString& In1, const FString& In2) {}
+bool UKDGBenchLib_005::Lib005_Fn083(const FVector& In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, FName In2, int32& Out3) {}
+int32 UKDGBenchLib_005::Lib005_Fn085(const TArray< int32 >& In0, const FTransform& In1, int32 In2) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FVector& In1, const TArray< int32 >& In2, const FString& In3, UObject* In4, const FString& In5, int32 In6, const TArray< int32 >& In7) {}
+void UKDGBenchLib_005::Lib005_Fn087(FName In0, UObject* In1, const FVector& In2, FVector& Out3, const FTransform& In4, int32& Out5) {}
+bool UKDGBenchLib_005::Lib005_Fn088() { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn089(float In0, FString& Out1, const TArray< int32 >& In2, FVector& Out3, const TArray< int32 >& In4, FString& Out5, const FString& In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn090(FVector& Out0) {}
+FString UKDGBenchLib_005::Lib005_Fn091(const FString& In0, FString& Out1, UObject* In2, FString& Out3, UObject* In4, int32& Out5) { return {}; }
+FVector UKDGBenchLib_005::Lib005_Fn092(FName In0, const FString& In1, FName In2, float In3) { return {}; }
+void UKDGBenchLib_005::Lib005_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, bool In1, const FString& In2, int32 In3) {}
+int32 UKDGBenchLib_005::Lib005_Fn094(FVector& Out0) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn095(bool In0) { return {}; }
+float UKDGBenchLib_005::Lib005_Fn096(FVector& Out0, UObject* In1, FVector& Out2, FVector& Out3, const FVector& In4, const FVector& In5, bool In6) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn097(const FVector& In0, const TArray< int32 >& In1, const FString& In2) { return {}; }
+int32 UKDGBenchLib_005::Lib005_Fn098(float In0, int32 In1, UObject* In2, const FTransform& In3, int32& Out4, UObject* In5) { return {}; }
+FString UKDGBenchLib_005::Lib005_Fn099(float In0) { return {}; }
+
+void UKDGBenchLib_006::Lib006_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, float In2, const FVector& In3) {}
+float UKDGBenchLib_006::Lib006_Fn001(int32 In0, int32& Out1, UObject* In2, float In3) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn002(UObject* In0, FName In1, const FTransform& In2, const FString& In3, const FVector& In4, const FString& In5) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn003() { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn004(int32& Out0, float In1, bool In2, FName In3) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn005() { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn006(FVector& Out0, const TArray< int32 >& In1, int32& Out2, const TArray< int32 >& In3, FString& Out4, const FTransform& In5) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn007(bool In0) { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn008(int32 In0, FString& Out1, FName In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn009(const FString& In0, int32& Out1, int32 In2, FName In3, UObject* In4, const FTransform& In5, const FString& In6, int32& Out7) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn010() {}
+bool UKDGBenchLib_006::Lib006_Fn011(float In0, UObject* In1, FVector& Out2, int32& Out3, const TArray< int32 >& In4) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn012(float In0, UObject* In1) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn013(const FTransform& In0, const FVector& In1, UObject* In2, int32& Out3, UObject* In4, const FVector& In5, const FTransform& In6, bool In7) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn014(int32& Out0, const FVector& In1, FName In2, int32& Out3) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const TArray< int32 >& In1) {}
+void UKDGBenchLib_006::Lib006_Fn016(const TArray< int32 >& In0) {}
+int32 UKDGBenchLib_006::Lib006_Fn017(float In0) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn018(bool In0, const FString& In1, float In2) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn019(int32 In0, const TArray< int32 >& In1, FVector& Out2, int32 In3, const FString& In4, float In5) { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn020(FVector& Out0, FVector& Out1, int32 In2, FName In3) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn021(FName In0, UObject* In1, bool In2, float In3, const FVector& In4, bool In5, const FVector& In6, const FString& In7) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn022(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1) {}
+float UKDGBenchLib_006::Lib006_Fn023(int32& Out0, float In1, bool In2, float In3, FString& Out4) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn024(float In0) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn025(int32 In0, FVector& Out1, int32& Out2, const TArray< int32 >& In3, FVector& Out4, int32& Out5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn026(float In0, FVector& Out1, const FTransform& In2, const FVector& In3, UObject* In4, bool In5, int32& Out6) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn027(FName In0, const FString& In1) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn028(int32 In0, FVector& Out1) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn029(const FVector& In0, FVector& Out1, UObject* In2, bool In3, int32 In4) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn030(UObject* In0, int32& Out1, FVector& Out2, const FVector& In3, bool In4, const TArray< int32 >& In5) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn031() { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn032() { return {}; }
+void UKDGBenchLib_006::Lib006_Fn033(const TArray< int32 >& In0, int32& Out1) {}
+float UKDGBenchLib_006::Lib006_Fn034(FName In0, const FString& In1, bool In2) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn035(FString& Out0, bool In1, FString& Out2) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1) {}
+FString UKDGBenchLib_006::Lib006_Fn037(bool In0, const TArray< int32 >& In1, bool In2, int32& Out3) { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn038(int32 In0, const TArray< int32 >& In1, const FTransform& In2, FString& Out3) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn039(FString& Out0, FString& Out1) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn040(const FTransform& In0, int32 In1) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn041() {}
+FVector UKDGBenchLib_006::Lib006_Fn042() { return {}; }
+float UKDGBenchLib_006::Lib006_Fn043(int32 In0, const FVector& In1, float In2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn044(FVector& Out0, const FVector& In1, int32& Out2) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn045() { return {}; }
+void UKDGBenchLib_006::Lib006_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32 In1, FVector& Out2, const FVector& In3) {}
+FString UKDGBenchLib_006::Lib006_Fn047(int32& Out0, float In1, bool In2, UObject* In3, int32& Out4, const TArray< int32 >& In5, FString& Out6, FName In7) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn048(const FTransform& In0, const FVector& In1, float In2) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn049() { return {}; }
+void UKDGBenchLib_006::Lib006_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1, FVector& Out2, int32 In3) {}
+int32 UKDGBenchLib_006::Lib006_Fn051(int32 In0, FString& Out1, const FTransform& In2) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn052(int32& Out0, FName In1, const FString& In2, bool In3, const FTransform& In4, float In5, FVector& Out6, FName In7) {}
+void UKDGBenchLib_006::Lib006_Fn053(FVector& Out0, const FTransform& In1, FString& Out2) {}
+int32 UKDGBenchLib_006::Lib006_Fn054(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn055(const FTransform& In0, const FString& In1) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn056(const FString& In0, const FTransform& In1, int32 In2, int32 In3, const FVector& In4, const FVector& In5, const FString& In6) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn057(FName In0, float In1, const TArray< int32 >& In2, const FString& In3) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn058(const FString& In0, int32& Out1, bool In2, bool In3, FString& Out4, const FVector& In5, UObject* In6, FName In7) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn059(const FString& In0, const FString& In1) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32 In1, const TArray< int32 >& In2) {}
+int32 UKDGBenchLib_006::Lib006_Fn061(const FString& In0, const TArray< int32 >& In1, UObject* In2, const FVector& In3, int32& Out4, float In5) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn062(float In0, float In1, int32 In2, int32 In3) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn063(FVector& Out0, FVector& Out1, FString& Out2, const FString& In3, bool In4) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn064() { return {}; }
+void UKDGBenchLib_006::Lib006_Fn065(int32& Out0, const FString& In1, const TArray< int32 >& In2, int32& Out3, int32 In4) {}
+FString UKDGBenchLib_006::Lib006_Fn066(FVector& Out0, UObject* In1, bool In2) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn067(FVector& Out0, FName In1, const TArray< int32 >& In2, const FVector& In3, const FString& In4, UObject* In5, FVector& Out6, const FString& In7) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn068(const FVector& In0, bool In1, const FVector& In2, UObject* In3, const TArray< int32 >& In4, FString& Out5, FName In6, int32 In7) { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn069() { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn070() { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn071(FString& Out0, UObject* In1, const TArray< int32 >& In2, UObject* In3, int32 In4) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn072() { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn073(int32 In0, const FTransform& In1, const FVector& In2, float In3, UObject* In4, float In5, int32 In6) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn074(int32& Out0, FString& Out1, const FTransform& In2, UObject* In3, const FTransform& In4, FName In5, const FTransform& In6, FName In7) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn075(FName In0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn076(float In0, FString& Out1, UObject* In2, int32& Out3, const TArray< int32 >& In4, UObject* In5, const FVector& In6, const FString& In7) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn077(int32& Out0) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn078() { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn079(FString& Out0, float In1, FName In2) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn080(FString& Out0, UObject* In1, FName In2, bool In3) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn081(bool In0, int32& Out1, int32 In2, float In3, const FString& In4, const FVector& In5) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn082(const FTransform& In0, int32 In1, float In2, bool In3, const FTransform& In4) {}
+int32 UKDGBenchLib_006::Lib006_Fn083(FString& Out0, FVector& Out1, float In2, const FVector& In3) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn084(float In0, int32& Out1, const TArray< int32 >& In2) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn085(bool In0, int32& Out1) { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn086(const FVector& In0, UObject* In1) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn087(const TArray< int32 >& In0, UObject* In1) { return {}; }
+int32 UKDGBenchLib_006::Lib006_Fn088(FString& Out0, const FVector& In1, float In2) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32& Out1) {}
+FVector UKDGBenchLib_006::Lib006_Fn090(int32 In0, const TArray< int32 >& In1, FVector& Out2, bool In3, int32& Out4, FVector& Out5) { return {}; }
+bool UKDGBenchLib_006::Lib006_Fn091(const FTransform& In0, bool In1, int32& Out2, const FString& In3, UObject* In4, int32 In5, FString& Out6, const FTransform& In7) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn092(FVector& Out0) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn093(const FString& In0, int32 In1) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn094(const FTransform& In0, FString& Out1) { return {}; }
+FString UKDGBenchLib_006::Lib006_Fn095(int32 In0, const FVector& In1) { return {}; }
+float UKDGBenchLib_006::Lib006_Fn096(int32 In0, const FString& In1, FString& Out2, FString& Out3) { return {}; }
+FVector UKDGBenchLib_006::Lib006_Fn097(const FTransform& In0, int32 In1, FVector& Out2, const TArray< int32 >& In3, int32& Out4) { return {}; }
+void UKDGBenchLib_006::Lib006_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0) {}
+void UKDGBenchLib_006::Lib006_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FString& In1, bool In2) {}
+
+int32 UKDGBenchLib_007::Lib007_Fn000(FVector& Out0, FName In1, const FTransform& In2, float In3, const FString& In4) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, float In1, int32 In2, FString& Out3, const TArray< int32 >& In4, const FString& In5) {}
+void UKDGBenchLib_007::Lib007_Fn002(const TArray< int32 >& In0, const FVector& In1) {}
+float UKDGBenchLib_007::Lib007_Fn003(const TArray< int32 >& In0, bool In1, float In2, int32 In3, bool In4) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn004(int32& Out0, FString& Out1, const TArray< int32 >& In2, const FString& In3) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn005(bool In0, int32 In1, FString& Out2, const TArray< int32 >& In3, float In4, float In5, bool In6, const FTransform& In7) {}
+FVector UKDGBenchLib_007::Lib007_Fn006(int32 In0, const FTransform& In1, FString& Out2) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn007() { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn008(const FVector& In0, int32& Out1, FName In2, const TArray< int32 >& In3, const TArray< int32 >& In4, int32 In5) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn009(FName In0, FString& Out1, int32 In2, UObject* In3, const FTransform& In4, const FTransform& In5) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn010(bool In0, FVector& Out1, bool In2, int32 In3, float In4, const TArray< int32 >& In5, float In6) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FTransform& In1, FVector& Out2, int32& Out3, FVector& Out4, const FTransform& In5) {}
+bool UKDGBenchLib_007::Lib007_Fn012(int32& Out0, FName In1, const FVector& In2) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn013(UObject* In0, bool In1, const TArray< int32 >& In2, const FTransform& In3, const FString& In4, FString& Out5, const FString& In6, const FString& In7) {}
+float UKDGBenchLib_007::Lib007_Fn014(float In0, FString& Out1) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn015(int32 In0) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn016(bool In0, const TArray< int32 >& In1, const FVector& In2, int32 In3, FVector& Out4, const TArray< int32 >& In5, float In6) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn017(FName In0) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1, FName In2, const FTransform& In3) {}
+int32 UKDGBenchLib_007::Lib007_Fn019(const FString& In0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn020(const FTransform& In0, int32 In1, const FTransform& In2) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn021(bool In0) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn022() { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn023(FName In0) { return {}; }
+bool UKDGBenchLib_007::Lib007_Fn024(const FVector& In0, int32 In1, FName In2, const FVector& In3, const FVector& In4, bool In5, const FString& In6) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, float In1, const FString& In2, const TArray< int32 >& In3, FName In4, const FVector& In5) {}
+float UKDGBenchLib_007::Lib007_Fn026(int32 In0, const TArray< int32 >& In1, int32 In2, FString& Out3, bool In4, int32& Out5, int32 In6) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn027(const FVector& In0, int32 In1, float In2, FName In3, bool In4, UObject* In5) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn028(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn029() { return {}; }
+void UKDGBenchLib_007::Lib007_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0) {}
+bool UKDGBenchLib_007::Lib007_Fn031(int32& Out0, int32& Out1, const FString& In2, bool In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, UObject* In1, bool In2, const FVector& In3, FName In4, UObject* In5) {}
+float UKDGBenchLib_007::Lib007_Fn033(const FVector& In0, const FVector& In1, FString& Out2, const FString& In3, FVector& Out4, int32 In5) { return {}; }
+bool UKDGBenchLib_007::Lib007_Fn034(int32 In0, const FTransform& In1, int32 In2, float In3, const FVector& In4, const FString& In5, int32& Out6) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn035(FVector& Out0, int32& Out1, const FVector& In2, const FVector& In3, FString& Out4, const TArray< int32 >& In5, const FTransform& In6, FVector& Out7) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn036(const FVector& In0, const FString& In1, const FTransform& In2, FString& Out3, float In4, bool In5) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn037() { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn038(FName In0, bool In1, FVector& Out2, int32 In3) { return {}; }
+bool UKDGBenchLib_007::Lib007_Fn039(const FTransform& In0, FName In1, const TArray< int32 >& In2, const FString& In3, float In4, float In5, const FString& In6, const FVector& In7) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, UObject* In1) {}
+float UKDGBenchLib_007::Lib007_Fn041(FString& Out0, float In1, const FString& In2, int32 In3, bool In4) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn042(int32& Out0, const TArray< int32 >& In1) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn043(const FTransform& In0, int32 In1) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn044() { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn045(bool In0, FName In1, int32& Out2, FString& Out3, const FTransform& In4, FVector& Out5, FVector& Out6) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn046(FString& Out0) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn047(FName In0, const TArray< int32 >& In1) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn048(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, int32 In1, const FTransform& In2, const TArray< int32 >& In3, const FString& In4, const FVector& In5, const TArray< int32 >& In6) {}
+void UKDGBenchLib_007::Lib007_Fn049(const TArray< int32 >& In0, FName In1) {}
+int32 UKDGBenchLib_007::Lib007_Fn050(int32& Out0) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn051(const FTransform& In0, const FString& In1, FVector& Out2) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn052(const FTransform& In0) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn053(FString& Out0, float In1, FVector& Out2, FName In3, bool In4, const FTransform& In5, FVector& Out6) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn054(UObject* In0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, bool In4, const FTransform& In5, FVector& Out6) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn055(FName In0, FVector& Out1) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn056(float In0, int32 In1, const FVector& In2, FString& Out3, int32 In4) {}
+FVector UKDGBenchLib_007::Lib007_Fn057(FString& Out0, int32& Out1, const TArray< int32 >& In2, const FVector& In3) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn058(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn059(FName In0, UObject* In1, const FString& In2) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn060() { return {}; }
+float UKDGBenchLib_007::Lib007_Fn061(FVector& Out0, const TArray< int32 >& In1, const FVector& In2, float In3) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_007::Lib007_Fn063(const FVector& In0, int32 In1, const FTransform& In2, FString& Out3, const FTransform& In4, FVector& Out5, FName In6, UObject* In7) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn064(FString& Out0, int32 In1, FVector& Out2, bool In3) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn065(FName In0, FString& Out1, const TArray< int32 >& In2, int32 In3, UObject* In4, bool In5, UObject* In6) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn066(bool In0, const FString& In1, FName In2, FVector& Out3) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn067(const TArray< int32 >& In0, FString& Out1, const FString& In2) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn068(FString& Out0, const FVector& In1, const FTransform& In2, int32& Out3) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn069(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn070(FVector& Out0, int32& Out1, const FString& In2, FName In3, FName In4) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FTransform& In1, const FTransform& In2, FVector& Out3, const FTransform& In4, int32 In5, int32 In6, float In7) {}
+int32 UKDGBenchLib_007::Lib007_Fn072(const TArray< int32 >& In0, const TArray< int32 >& In1, float In2, FString& Out3, int32 In4, const FVector& In5, const FTransform& In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_007::Lib007_Fn073(UObject* In0, float In1) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn074(const FVector& In0, FVector& Out1) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn075(float In0, float In1, FVector& Out2, const TArray< int32 >& In3, const FTransform& In4, float In5) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn076(int32 In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, FString& Out4, int32& Out5) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn077() { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn078(const FVector& In0, FString& Out1, const TArray< int32 >& In2, bool In3) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn079(bool In0, int32& Out1, FVector& Out2, const TArray< int32 >& In3, int32& Out4, float In5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn080(const TArray< int32 >& In0, FString& Out1, const FString& In2, const FString& In3, int32& Out4, int32 In5, FString& Out6, const FTransform& In7) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn081(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, int32 In3, const FTransform& In4, const FVector& In5, FName In6) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn082(const FTransform& In0, const TArray< int32 >& In1, const FVector& In2, FVector& Out3, const TArray< int32 >& In4) { return {}; }
+void UKDGBenchLib_007::Lib007_Fn083(float In0, FVector& Out1, FVector& Out2, const FTransform& In3) {}
+FVector UKDGBenchLib_007::Lib007_Fn084(FVector& Out0, const FVector& In1, FName In2, const FString& In3, FName In4) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn085(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn086(const FVector& In0, FName In1, float In2) { return {}; }
+bool UKDGBenchLib_007::Lib007_Fn087(FString& Out0, UObject* In1, bool In2, int32 In3, const FVector& In4) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn088(bool In0, bool In1, int32 In2, bool In3, UObject* In4, FVector& Out5, FVector& Out6, bool In7) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn089(FVector& Out0, bool In1, FVector& Out2, const TArray< int32 >& In3, float In4, FString& Out5) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn090(FName In0, const FVector& In1, const TArray< int32 >& In2, float In3, int32 In4, const FTransform& In5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn091(int32 In0, UObject* In1, bool In2, int32& Out3, FVector& Out4, FString& Out5) { return {}; }
+FVector UKDGBenchLib_007::Lib007_Fn092(FVector& Out0, bool In1) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn093(const TArray< int32 >& In0, bool In1, int32 In2, const FVector& In3, UObject* In4, FVector& Out5, const FVector& In6, const TArray< int32 >& In7) { return {}; }
+bool UKDGBenchLib_007::Lib007_Fn094(const FVector& In0, const FTransform& In1, FName In2, FName In3, const TArray< int32 >& In4, int32 In5, const FString& In6, FName In7) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn095(float In0, const TArray< int32 >& In1, const FVector& In2, const FVector& In3, const FVector& In4, UObject* In5, const FString& In6) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn096(const FString& In0, const TArray< int32 >& In1, const FString& In2) { return {}; }
+int32 UKDGBenchLib_007::Lib007_Fn097(const FString& In0, FVector& Out1, int32 In2, const FTransform& In3, const FTransform& In4, FName In5) { return {}; }
+float UKDGBenchLib_007::Lib007_Fn098(float In0) { return {}; }
+FString UKDGBenchLib_007::Lib007_Fn099() { return {}; }
+
+float UKDGBenchLib_008::Lib008_Fn000(const TArray< int32 >& In0, FString& Out1, FString& Out2, const FTransform& In3, const FString& In4, const FVector& In5) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn001(const FTransform& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4, const FVector& In5) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn002(bool In0, FName In1) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn003(const TArray< int32 >& In0) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, float In1, UObject* In2) {}
+bool UKDGBenchLib_008::Lib008_Fn005(FVector& Out0, int32 In1, FName In2) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn006(bool In0, float In1, int32& Out2) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn007(FVector& Out0, FName In1, const FVector& In2, FVector& Out3, const FVector& In4) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn008(FString& Out0) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn009() { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn010(const FVector& In0, FString& Out1, float In2, FName In3, bool In4) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn011(FString& Out0, const FVector& In1, const TArray< int32 >& In2, FVector& Out3, int32 In4) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn012(int32 In0) { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn013(FName In0, FVector& Out1) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn014(const TArray< int32 >& In0, const FVector& In1, bool In2, int32& Out3, FString& Out4, int32& Out5) {}
+bool UKDGBenchLib_008::Lib008_Fn015(bool In0, FName In1, FString& Out2, UObject* In3) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn016(FString& Out0, FName In1, int32& Out2, const FString& In3) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn017(const TArray< int32 >& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, float In3, const FTransform& In4, const FVector& In5, bool In6, const FTransform& In7) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn018(const FVector& In0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn019(const TArray< int32 >& In0, const TArray< int32 >& In1, const FString& In2, float In3, float In4, const FString& In5, bool In6, FString& Out7) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn020(const FVector& In0, FString& Out1, bool In2, const FVector& In3, const FVector& In4, FName In5, int32& Out6, int32 In7) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn021(const FString& In0, FVector& Out1, UObject* In2, FVector& Out3, int32 In4) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn022(const FTransform& In0, const FString& In1) {}
+int32 UKDGBenchLib_008::Lib008_Fn023(const FString& In0, FName In1, const FVector& In2, const TArray< int32 >& In3) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn024(FVector& Out0, FName In1, const FString& In2, const FString& In3, UObject* In4, int32& Out5) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn025() { return {}; }
+void UKDGBenchLib_008::Lib008_Fn026(FString& Out0, bool In1, UObject* In2, const FVector& In3, bool In4, const FString& In5, const FString& In6, bool In7) {}
+float UKDGBenchLib_008::Lib008_Fn027(FName In0, FVector& Out1, float In2, int32& Out3) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn028() { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn029(int32 In0, float In1, FName In2) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0) {}
+FString UKDGBenchLib_008::Lib008_Fn031() { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn032(float In0, bool In1, const TArray< int32 >& In2, FName In3, UObject* In4, float In5, int32 In6) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn033(const FTransform& In0, const FVector& In1, const FString& In2, int32& Out3) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn034(int32& Out0, FName In1, FName In2, int32 In3, FName In4, FName In5) {}
+float UKDGBenchLib_008::Lib008_Fn035(const FVector& In0, FVector& Out1, int32& Out2, const FTransform& In3, FVector& Out4, FVector& Out5, int32& Out6, const FVector& In7) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn036(float In0, const FVector& In1, int32& Out2, bool In3) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn037(const FVector& In0, float In1, int32 In2, const FTransform& In3, int32& Out4) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn038(float In0, const TArray< int32 >& In1, FVector& Out2, FVector& Out3, const FTransform& In4, UObject* In5) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn039(FVector& Out0, FVector& Out1, int32 In2, float In3) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn040(const TArray< int32 >& In0, float In1, const FTransform& In2, FString& Out3, int32 In4, float In5, float In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn041(const TArray< int32 >& In0, UObject* In1, float In2, int32 In3, FVector& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, FString& Out7) {}
+void UKDGBenchLib_008::Lib008_Fn042(const TArray< int32 >& In0, bool In1, FName In2, FString& Out3) {}
+void UKDGBenchLib_008::Lib008_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FString& In1, const FString& In2, FName In3, const TArray< int32 >& In4) {}
+int32 UKDGBenchLib_008::Lib008_Fn044(const FVector& In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, FString& Out4, int32 In5, FVector& Out6, int32 In7) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn045(FString& Out0, bool In1, FName In2) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn046(int32& Out0, const FString& In1, const FVector& In2, int32 In3, const TArray< int32 >& In4, const TArray< int32 >& In5, bool In6) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn047(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn048(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn049(const FString& In0, FString& Out1, FString& Out2, FName In3, const FString& In4, int32 In5, FName In6) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn050(const FVector& In0, FVector& Out1, FVector& Out2, const TArray< int32 >& In3, int32 In4) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn051(bool In0, const FString& In1) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn052(bool In0, const FTransform& In1, int32 In2, const FString& In3, FName In4, FName In5, FName In6) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn053(UObject* In0, const FTransform& In1, int32 In2, int32& Out3, const FTransform& In4, FString& Out5) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn054(const FTransform& In0, const FTransform& In1, UObject* In2, float In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn055(int32& Out0, const FString& In1, const FTransform& In2, UObject* In3) {}
+void UKDGBenchLib_008::Lib008_Fn056(FVector& Out0, const FVector& In1, const TArray< int32 >& In2) {}
+FString UKDGBenchLib_008::Lib008_Fn057(FVector& Out0, FVector& Out1, int32 In2, int32 In3, const FTransform& In4, bool In5, UObject* In6, const TArray< int32 >& In7) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn058(int32& Out0, const FVector& In1) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn059(const FString& In0, int32& Out1, bool In2) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, UObject* In2, FString& Out3) {}
+void UKDGBenchLib_008::Lib008_Fn061(FString& Out0, float In1, int32 In2, const FString& In3, UObject* In4, UObject* In5, FName In6) {}
+int32 UKDGBenchLib_008::Lib008_Fn062(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn063(FString& Out0, FVector& Out1) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0) {}
+void UKDGBenchLib_008::Lib008_Fn065(float In0, const TArray< int32 >& In1, FString& Out2, float In3) {}
+float UKDGBenchLib_008::Lib008_Fn066(FVector& Out0, const FTransform& In1, FString& Out2, int32 In3, const FTransform& In4, int32 In5, FName In6, const FTransform& In7) { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn067(int32& Out0, int32& Out1, float In2, const FTransform& In3, int32 In4, int32 In5) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, const FTransform& In4, const FVector& In5) {}
+FString UKDGBenchLib_008::Lib008_Fn069(UObject* In0) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn070(FVector& Out0, int32 In1, int32& Out2, const FString& In3, const TArray< int32 >& In4, FName In5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn071(int32& Out0, UObject* In1, float In2, FVector& Out3, float In4, const TArray< int32 >& In5, const FVector& In6) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn072(const FString& In0) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn073(FName In0, const TArray< int32 >& In1, float In2, int32 In3, FName In4) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn074(float In0, float In1, bool In2) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn075(FString& Out0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn076(float In0, FName In1, const FString& In2, const FString& In3, FString& Out4, int32& Out5, const TArray< int32 >& In6) { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn077() { return {}; }
+void UKDGBenchLib_008::Lib008_Fn078(FVector& Out0, const FString& In1, FName In2, const FTransform& In3, const FTransform& In4, const FString& In5, const TArray< int32 >& In6, int32 In7) {}
+void UKDGBenchLib_008::Lib008_Fn079(const FVector& In0, const FVector& In1) {}
+float UKDGBenchLib_008::Lib008_Fn080(const FString& In0, int32 In1, float In2) { return {}; }
+void UKDGBenchLib_008::Lib008_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1, float In2, const FString& In3, const FVector& In4, int32 In5, const FVector& In6, FString& Out7) {}
+bool UKDGBenchLib_008::Lib008_Fn082(int32& Out0) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn083() { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn084(UObject* In0, const FVector& In1, const FTransform& In2) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn085(const FString& In0, const FTransform& In1, const FVector& In2, bool In3) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn086(float In0, const FString& In1, FName In2, const FTransform& In3) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn087(int32 In0, const FString& In1, const FVector& In2, const FVector& In3, const FVector& In4, FVector& Out5, const FVector& In6) { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn088(int32& Out0, UObject* In1) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn089(UObject* In0, const FTransform& In1, bool In2, FVector& Out3, FVector& Out4, const FString& In5, bool In6) { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn090(const FTransform& In0, float In1, const FTransform& In2, UObject* In3, UObject* In4, bool In5, FString& Out6, UObject* In7) { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn091(FName In0, FName In1, const FVector& In2, FName In3, const FVector& In4) { return {}; }
+FVector UKDGBenchLib_008::Lib008_Fn092(int32 In0, FString& Out1, const TArray< int32 >& In2, int32 In3, UObject* In4, const TArray< int32 >& In5) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn093(const FString& In0, UObject* In1) { return {}; }
+float UKDGBenchLib_008::Lib008_Fn094(const TArray< int32 >& In0, UObject* In1, const FTransform& In2, const FString& In3, float In4, FString& Out5, bool In6, float In7) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn095(bool In0, const FVector& In1, const FVector& In2, UObject* In3, const FString& In4, FName In5) { return {}; }
+int32 UKDGBenchLib_008::Lib008_Fn096(int32& Out0, int32& Out1) { return {}; }
+bool UKDGBenchLib_008::Lib008_Fn097() { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn098(FString& Out0, int32& Out1, int32& Out2, const FString& In3, float In4, FVector& Out5, UObject* In6, FVector& Out7) { return {}; }
+FString UKDGBenchLib_008::Lib008_Fn099(FString& Out0) { return {}; }
+
+float UKDGBenchLib_009::Lib009_Fn000(FName In0) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn001(const FTransform& In0, FString& Out1, FString& Out2, int32 In3) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn002(UObject* In0, FVector& Out1, int32& Out2, FString& Out3, UObject* In4, bool In5, int32& Out6, float In7) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn003(const FString& In0, FName In1, float In2, const TArray< int32 >& In3, FString& Out4, int32 In5, const TArray< int32 >& In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn004(const FVector& In0, bool In1, const TArray< int32 >& In2, FName In3, const TArray< int32 >& In4, bool In5, bool In6, const FTransform& In7) {}
+FString UKDGBenchLib_009::Lib009_Fn005(const FTransform& In0, const FString& In1, UObject* In2, const FVector& In3, const FVector& In4, FName In5, UObject* In6, float In7) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn006(const FVector& In0, FString& Out1, int32& Out2, UObject* In3, int32& Out4, UObject* In5, bool In6) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn007(UObject* In0, const FString& In1, UObject* In2, FVector& Out3, FString& Out4, const FString& In5) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn008(FName In0, const TArray< int32 >& In1) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn009(FName In0, UObject* In1, UObject* In2, const FTransform& In3, int32 In4, const TArray< int32 >& In5, FString& Out6, const FString& In7) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn010(const FString& In0, bool In1, FName In2, int32 In3, int32& Out4, const TArray< int32 >& In5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn011(const FVector& In0, int32 In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn012(int32 In0, UObject* In1) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn013(const FString& In0, UObject* In1, int32 In2, const TArray< int32 >& In3, const FString& In4, FString& Out5, FVector& Out6, FString& Out7) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn014(int32 In0) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn015(float In0) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FString& In1, FString& Out2, bool In3) {}
+float UKDGBenchLib_009::Lib009_Fn017(float In0, const FString& In1, FName In2) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn018(const FVector& In0) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn019(float In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, bool In2) {}
+FString UKDGBenchLib_009::Lib009_Fn021(const FVector& In0, FName In1, const FTransform& In2, int32 In3, const TArray< int32 >& In4, UObject* In5, const FVector& In6, FVector& Out7) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn022(int32& Out0, FVector& Out1, FName In2, const FString& In3, int32 In4, const FString& In5, int32& Out6, FString& Out7) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn023(FName In0, UObject* In1, FString& Out2, UObject* In3, const FTransform& In4, FString& Out5) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn024(int32 In0, const TArray< int32 >& In1, FVector& Out2, const TArray< int32 >& In3, bool In4, int32 In5, float In6) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn025(const FTransform& In0, const FVector& In1, bool In2, int32& Out3, const TArray< int32 >& In4, UObject* In5, float In6) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn026() { return {}; }
+void UKDGBenchLib_009::Lib009_Fn027(float In0, int32& Out1, const FTransform& In2, FString& Out3) {}
+FVector UKDGBenchLib_009::Lib009_Fn028(FName In0, UObject* In1, FString& Out2, FVector& Out3) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn029(float In0) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn030(FName In0, int32 In1, const TArray< int32 >& In2) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn031(const TArray< int32 >& In0, float In1) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn032() { return {}; }
+float UKDGBenchLib_009::Lib009_Fn033(UObject* In0, const FString& In1, bool In2, FVector& Out3, bool In4, FVector& Out5, const FString& In6) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn034(const FString& In0) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn035(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_009::Lib009_Fn036(const TArray< int32 >& In0, FString& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, FVector& Out4, float In5, int32 In6) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, int32& Out2) {}
+float UKDGBenchLib_009::Lib009_Fn038(bool In0) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn039(float In0, FName In1) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn040(FString& Out0, bool In1, const FVector& In2, float In3, FString& Out4) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1, FName In2) {}
+bool UKDGBenchLib_009::Lib009_Fn042(int32& Out0, FName In1) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn043() { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn044(int32& Out0, const FVector& In1, int32 In2, const FString& In3, const FString& In4, UObject* In5) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn045(const TArray< int32 >& In0, const TArray< int32 >& In1) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn046(bool In0, bool In1, const TArray< int32 >& In2, UObject* In3, int32 In4) {}
+void UKDGBenchLib_009::Lib009_Fn047() {}
+void UKDGBenchLib_009::Lib009_Fn048(FVector& Out0, const TArray< int32 >& In1, float In2) {}
+FString UKDGBenchLib_009::Lib009_Fn049(int32& Out0, const TArray< int32 >& In1) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn050() { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn051(const TArray< int32 >& In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, float In4) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn052(int32& Out0) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn053(int32& Out0, float In1, FVector& Out2, FString& Out3, float In4) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn054(FName In0, const FTransform& In1, float In2, FName In3, FString& Out4, float In5) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn055(FName In0, FString& Out1, FName In2) {}
+int32 UKDGBenchLib_009::Lib009_Fn056(UObject* In0) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn057(const FVector& In0, bool In1) {}
+FVector UKDGBenchLib_009::Lib009_Fn058(const TArray< int32 >& In0, bool In1, const TArray< int32 >& In2, UObject* In3, const TArray< int32 >& In4, const FTransform& In5) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn059() { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn060(FString& Out0, bool In1, FString& Out2, const FString& In3, const TArray< int32 >& In4) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn061(const FTransform& In0, const FVector& In1, UObject* In2, const TArray< int32 >& In3, const FTransform& In4, const FString& In5, const FTransform& In6) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn062(UObject* In0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, UObject* In4) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn063(FVector& Out0) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn064(FVector& Out0, const FTransform& In1, bool In2) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn065() { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn066(int32 In0, const FString& In1, const FTransform& In2, const FTransform& In3, bool In4) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn067(FString& Out0, UObject* In1) {}
+void UKDGBenchLib_009::Lib009_Fn068(int32 In0) {}
+bool UKDGBenchLib_009::Lib009_Fn069(const FVector& In0, FString& Out1, const FTransform& In2, const FVector& In3, const TArray< int32 >& In4) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn070(const FVector& In0) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn071(const FString& In0, const TArray< int32 >& In1) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn072(float In0, const FVector& In1, const TArray< int32 >& In2, FName In3) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn073(const FString& In0, UObject* In1, bool In2, FString& Out3, int32& Out4, FName In5, FVector& Out6) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn074(bool In0, FName In1) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn075(FString& Out0, FString& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32& Out4, FName In5, FVector& Out6) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FVector UKDGBenchLib_009::Lib009_Fn077(float In0, float In1, int32& Out2, float In3, FVector& Out4, bool In5, FString& Out6) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn078(int32& Out0, int32& Out1, int32 In2, const TArray< int32 >& In3) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn079(const TArray< int32 >& In0, const FVector& In1, const FVector& In2, int32 In3, const FVector& In4, const FString& In5, float In6) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn080() { return {}; }
+void UKDGBenchLib_009::Lib009_Fn081(FVector& Out0, const FVector& In1, const FVector& In2, int32& Out3) {}
+int32 UKDGBenchLib_009::Lib009_Fn082(FString& Out0, const FString& In1, int32 In2) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn083(const FTransform& In0, const FVector& In1, FVector& Out2, FName In3, const FString& In4, FString& Out5) { return {}; }
+bool UKDGBenchLib_009::Lib009_Fn084(FString& Out0, FString& Out1, FName In2) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn085(FVector& Out0, FName In1, const TArray< int32 >& In2, UObject* In3) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn086(FName In0, int32 In1) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn087(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, FVector& Out3, FVector& Out4, const FTransform& In5, const FTransform& In6) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn088(float In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn089(const FString& In0, FName In1, const FString& In2, float In3) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn090(FName In0, const FTransform& In1, FName In2, FString& Out3, FName In4, const TArray< int32 >& In5, int32& Out6) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FName In1, int32 In2) {}
+int32 UKDGBenchLib_009::Lib009_Fn092(const TArray< int32 >& In0, float In1, bool In2, FVector& Out3, FVector& Out4, FName In5, UObject* In6) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn093(FString& Out0, int32 In1, int32 In2) { return {}; }
+float UKDGBenchLib_009::Lib009_Fn094(const FTransform& In0, const FVector& In1, const FString& In2) { return {}; }
+FString UKDGBenchLib_009::Lib009_Fn095(UObject* In0, const TArray< int32 >& In1, const FTransform& In2, const FString& In3, FName In4) { return {}; }
+void UKDGBenchLib_009::Lib009_Fn096(const FTransform& In0, UObject* In1) {}
+FVector UKDGBenchLib_009::Lib009_Fn097(float In0) { return {}; }
+FVector UKDGBenchLib_009::Lib009_Fn098(const FVector& In0, UObject* In1, float In2, bool In3, const TArray< int32 >& In4) { return {}; }
+int32 UKDGBenchLib_009::Lib009_Fn099() { return {}; }
+
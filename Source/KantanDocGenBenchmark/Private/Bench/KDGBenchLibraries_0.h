@@ -0,0 +1,3105 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchLibraries_0.generated.h"
+
+
+UCLASS()
+class UKDGBenchLib_000 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib000_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn000(const TArray< int32 >& In0, const FTransform& In1, const TArray< int32 >& In2, UObject* In3, FName In4, FString& Out5, const FTransform& In6, const FTransform& In7);
+	/** Benchmark latent node Lib000_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib000_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FVector& In1, bool In2);
+	/** Benchmark pure node Lib000_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn002(int32& Out0, int32 In1, FName In2, float In3);
+	/** Benchmark callable node Lib000_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn003(float In0, int32 In1, FVector& Out2, const FVector& In3, const FVector& In4, const FVector& In5, const FVector& In6, const FVector& In7);
+	/** Benchmark callable node Lib000_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn004();
+	/** Benchmark pure node Lib000_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn005(FString& Out0, const FTransform& In1, UObject* In2, const FString& In3, const FVector& In4, FName In5, FVector& Out6, UObject* In7);
+	/** Benchmark callable node Lib000_Fn006 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn006(FVector& Out0);
+	/** Benchmark latent node Lib000_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib000_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FName In1, const FVector& In2, const FTransform& In3);
+	/** Benchmark callable node Lib000_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn008(float In0, const FTransform& In1, FName In2, const TArray< int32 >& In3, const FVector& In4, FString& Out5, FString& Out6, int32& Out7);
+	/** Benchmark callable node Lib000_Fn009 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn009(const TArray< int32 >& In0, const FString& In1, bool In2, const TArray< int32 >& In3, bool In4, bool In5, FString& Out6);
+	/** Benchmark callable node Lib000_Fn010 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn010(const FVector& In0, UObject* In1, FString& Out2, FName In3, FString& Out4, UObject* In5);
+	/** Benchmark pure node Lib000_Fn011 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn011(float In0, float In1, FVector& Out2, bool In3);
+	/** Benchmark pure node Lib000_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn012(bool In0, int32& Out1, const FTransform& In2, float In3, const TArray< int32 >& In4, bool In5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark pure node Lib000_Fn013 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn013(int32 In0, float In1, FVector& Out2, FVector& Out3, bool In4, int32 In5, const FVector& In6);
+	/** Benchmark callable node Lib000_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn014(FVector& Out0, const FTransform& In1, int32 In2, bool In3);
+	/** Benchmark callable node Lib000_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn015(float In0, const FVector& In1, UObject* In2, FName In3, const FTransform& In4, FName In5, const FVector& In6);
+	/** Benchmark callable node Lib000_Fn016 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn016(const FTransform& In0, UObject* In1, FVector& Out2, const FVector& In3, FVector& Out4, float In5, float In6);
+	/** Benchmark callable node Lib000_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn017(const FTransform& In0, FName In1, const FVector& In2, const FString& In3, FString& Out4, FName In5);
+	/** Benchmark callable node Lib000_Fn018 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn018(FVector& Out0, UObject* In1, int32& Out2, float In3, int32 In4, const FVector& In5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark callable node Lib000_Fn019 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn019(FName In0, FVector& Out1, FVector& Out2);
+	/** Benchmark callable node Lib000_Fn020 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn020(int32& Out0, FString& Out1, const FTransform& In2, const FTransform& In3, int32 In4, UObject* In5);
+	/** Benchmark callable node Lib000_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn021(int32& Out0, const FString& In1);
+	/** Benchmark callable node Lib000_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn022(const FString& In0, UObject* In1, FVector& Out2);
+	/** Benchmark pure node Lib000_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn023();
+	/** Benchmark callable node Lib000_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn024(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib000_Fn025 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn025();
+	/** Benchmark callable node Lib000_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn026(int32& Out0, const FTransform& In1, const FTransform& In2, FString& Out3, UObject* In4, FString& Out5);
+	/** Benchmark pure node Lib000_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn027(int32& Out0, const TArray< int32 >& In1, int32& Out2);
+	/** Benchmark callable node Lib000_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn028(const FVector& In0, FName In1, const FVector& In2, FName In3, FString& Out4, bool In5);
+	/** Benchmark pure node Lib000_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn029(const FTransform& In0, UObject* In1, int32 In2, const FString& In3, FName In4);
+	/** Benchmark callable node Lib000_Fn030 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn030();
+	/** Benchmark callable node Lib000_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn031(const FVector& In0, const FString& In1, bool In2, FVector& Out3, UObject* In4);
+	/** Benchmark callable node Lib000_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn032(bool In0, const TArray< int32 >& In1, const FTransform& In2, bool In3, bool In4, bool In5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark callable node Lib000_Fn033 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn033(const FString& In0);
+	/** Benchmark callable node Lib000_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn034(float In0, const FVector& In1, FString& Out2, FVector& Out3);
+	/** Benchmark callable node Lib000_Fn035 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn035(float In0, float In1, int32& Out2, const FTransform& In3, const FVector& In4);
+	/** Benchmark callable node Lib000_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn036(const FString& In0, int32 In1, bool In2, FString& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib000_Fn037 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn037(bool In0, FName In1, const FString& In2, const FString& In3, FName In4, const FVector& In5, bool In6, FName In7);
+	/** Benchmark callable node Lib000_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn038(int32& Out0, FVector& Out1, FVector& Out2, int32 In3, FName In4, FName In5);
+	/** Benchmark callable node Lib000_Fn039 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn039(float In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib000_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn040(UObject* In0, const TArray< int32 >& In1, int32 In2, float In3, FString& Out4, const FString& In5, const FString& In6, int32 In7);
+	/** Benchmark pure node Lib000_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn041(int32& Out0);
+	/** Benchmark pure node Lib000_Fn042 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn042(FName In0);
+	/** Benchmark pure node Lib000_Fn043 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn043(FName In0, int32& Out1);
+	/** Benchmark pure node Lib000_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn044(FString& Out0, bool In1, int32 In2, FString& Out3, const FString& In4);
+	/** Benchmark pure node Lib000_Fn045 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn045();
+	/** Benchmark pure node Lib000_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn046(FString& Out0, UObject* In1);
+	/** Benchmark callable node Lib000_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn047(float In0, const TArray< int32 >& In1, const FString& In2, int32& Out3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib000_Fn048 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn048(bool In0);
+	/** Benchmark callable node Lib000_Fn049 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn049(int32 In0, UObject* In1, const FString& In2, int32& Out3, int32 In4, int32 In5, const FTransform& In6, const FTransform& In7);
+	/** Benchmark pure node Lib000_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn050(const TArray< int32 >& In0, int32& Out1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark latent node Lib000_Fn051 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib000_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, const FString& In2, FVector& Out3, const FVector& In4, UObject* In5);
+	/** Benchmark callable node Lib000_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn052(float In0, bool In1, int32 In2, FVector& Out3);
+	/** Benchmark latent node Lib000_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib000_Fn053(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib000_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn054(FVector& Out0);
+	/** Benchmark callable node Lib000_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn055(UObject* In0, FString& Out1, const FString& In2);
+	/** Benchmark callable node Lib000_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn056();
+	/** Benchmark callable node Lib000_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn057(const FTransform& In0, UObject* In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib000_Fn058 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn058(const FVector& In0, FString& Out1, const FTransform& In2);
+	/** Benchmark pure node Lib000_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn059(int32 In0, int32 In1, FString& Out2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5, const FString& In6, FName In7);
+	/** Benchmark pure node Lib000_Fn060 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn060(float In0);
+	/** Benchmark callable node Lib000_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn061(UObject* In0, UObject* In1, int32& Out2, bool In3, FVector& Out4, const FTransform& In5);
+	/** Benchmark pure node Lib000_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn062(FName In0, float In1, const FVector& In2, int32& Out3, int32 In4, float In5);
+	/** Benchmark callable node Lib000_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn063(const TArray< int32 >& In0, int32& Out1);
+	/** Benchmark latent node Lib000_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib000_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib000_Fn065 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn065(float In0, float In1, bool In2);
+	/** Benchmark callable node Lib000_Fn066 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn066(int32 In0, UObject* In1, float In2);
+	/** Benchmark callable node Lib000_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn067(UObject* In0, const FTransform& In1, FVector& Out2, FName In3, UObject* In4);
+	/** Benchmark callable node Lib000_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn068(int32 In0);
+	/** Benchmark callable node Lib000_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn069(float In0, const FVector& In1, float In2, const FTransform& In3, const FString& In4, int32 In5);
+	/** Benchmark callable node Lib000_Fn070 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn070(FString& Out0, const FVector& In1, const FTransform& In2, const TArray< int32 >& In3, const FVector& In4, FVector& Out5, float In6, FString& Out7);
+	/** Benchmark callable node Lib000_Fn071 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn071(float In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib000_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn072(FVector& Out0, const FString& In1, int32 In2, int32 In3, FVector& Out4, FString& Out5);
+	/** Benchmark callable node Lib000_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn073(FName In0, FString& Out1, FVector& Out2, const FString& In3, int32& Out4, const FTransform& In5, float In6, int32 In7);
+	/** Benchmark callable node Lib000_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn074(const FTransform& In0);
+	/** Benchmark callable node Lib000_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn075(float In0, const FTransform& In1, int32& Out2, const FTransform& In3, const TArray< int32 >& In4, UObject* In5, int32 In6, FVector& Out7);
+	/** Benchmark callable node Lib000_Fn076 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn076(FString& Out0, FVector& Out1, float In2, int32 In3, FName In4, FString& Out5);
+	/** Benchmark callable node Lib000_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn077(int32 In0);
+	/** Benchmark callable node Lib000_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn078(int32 In0, const FTransform& In1, const FString& In2, UObject* In3, FVector& Out4, FVector& Out5, UObject* In6, FString& Out7);
+	/** Benchmark latent node Lib000_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib000_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib000_Fn080 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn080(FName In0, const FVector& In1);
+	/** Benchmark callable node Lib000_Fn081 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn081(const FVector& In0, float In1, int32& Out2, FString& Out3, const FVector& In4);
+	/** Benchmark callable node Lib000_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn082(const FTransform& In0, float In1, bool In2, int32 In3, FName In4, bool In5, FName In6, const FVector& In7);
+	/** Benchmark callable node Lib000_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn083(int32 In0, UObject* In1);
+	/** Benchmark pure node Lib000_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn084(const FTransform& In0, const FString& In1, FString& Out2);
+	/** Benchmark pure node Lib000_Fn085 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn085(const FString& In0, bool In1);
+	/** Benchmark callable node Lib000_Fn086 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn086(FName In0, float In1, const FVector& In2, const FVector& In3, bool In4, int32& Out5);
+	/** Benchmark callable node Lib000_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn087(int32& Out0, const FString& In1, FVector& Out2);
+	/** Benchmark latent node Lib000_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib000_Fn088(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, UObject* In1, int32& Out2, float In3);
+	/** Benchmark callable node Lib000_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static void Lib000_Fn089(UObject* In0, int32& Out1, int32& Out2, float In3, FName In4, FString& Out5);
+	/** Benchmark callable node Lib000_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn090(const FTransform& In0, FVector& Out1, bool In2, const FTransform& In3);
+	/** Benchmark callable node Lib000_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn091(FVector& Out0, FVector& Out1, const FString& In2, const FVector& In3);
+	/** Benchmark callable node Lib000_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn092(UObject* In0, const TArray< int32 >& In1, int32& Out2, bool In3);
+	/** Benchmark pure node Lib000_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static float Lib000_Fn093(int32& Out0, UObject* In1, const FTransform& In2, FString& Out3, const FVector& In4, FName In5);
+	/** Benchmark callable node Lib000_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static int32 Lib000_Fn094(int32& Out0);
+	/** Benchmark pure node Lib000_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn095();
+	/** Benchmark pure node Lib000_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn096(int32 In0, bool In1, FName In2, int32 In3, int32 In4);
+	/** Benchmark callable node Lib000_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FString Lib000_Fn097(const FString& In0, FVector& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib000_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static FVector Lib000_Fn098(int32 In0, bool In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib000_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib000")
+	static bool Lib000_Fn099(FString& Out0, bool In1, const FTransform& In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_001 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib001_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn000(const FString& In0, const FTransform& In1, const FTransform& In2, float In3, const TArray< int32 >& In4, float In5);
+	/** Benchmark pure node Lib001_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn001();
+	/** Benchmark callable node Lib001_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn002(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, FName In3, const FString& In4, const FString& In5, int32 In6);
+	/** Benchmark callable node Lib001_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn003(FVector& Out0, FVector& Out1, const FTransform& In2, const TArray< int32 >& In3, const FString& In4, UObject* In5, const FVector& In6);
+	/** Benchmark callable node Lib001_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn004(float In0);
+	/** Benchmark callable node Lib001_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn005();
+	/** Benchmark pure node Lib001_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn006(bool In0, const TArray< int32 >& In1, bool In2, FVector& Out3, float In4);
+	/** Benchmark callable node Lib001_Fn007 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn007(const FTransform& In0, const FTransform& In1);
+	/** Benchmark callable node Lib001_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn008(const FVector& In0, FString& Out1, FName In2, FName In3, const FVector& In4, FName In5, const FString& In6, int32& Out7);
+	/** Benchmark callable node Lib001_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn009(UObject* In0, FString& Out1, int32 In2, const FTransform& In3, const FTransform& In4, FName In5, float In6, const FVector& In7);
+	/** Benchmark pure node Lib001_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn010(int32& Out0, FName In1, FVector& Out2, const FTransform& In3, const TArray< int32 >& In4, const FTransform& In5, int32 In6);
+	/** Benchmark pure node Lib001_Fn011 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn011(FString& Out0, const FTransform& In1, int32& Out2, bool In3);
+	/** Benchmark callable node Lib001_Fn012 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn012(FName In0, UObject* In1, FVector& Out2, float In3);
+	/** Benchmark latent node Lib001_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib001_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn014(int32 In0, FName In1, const FTransform& In2, UObject* In3, FVector& Out4, const FVector& In5, const FVector& In6);
+	/** Benchmark callable node Lib001_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn015(FName In0);
+	/** Benchmark callable node Lib001_Fn016 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn016(FName In0, int32& Out1, bool In2, UObject* In3, FVector& Out4, const TArray< int32 >& In5, const FString& In6);
+	/** Benchmark callable node Lib001_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn017(const FString& In0, int32& Out1, const FString& In2, const FVector& In3, const TArray< int32 >& In4, FVector& Out5, FName In6, bool In7);
+	/** Benchmark callable node Lib001_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn018(FName In0, FName In1, const TArray< int32 >& In2, int32 In3, FName In4);
+	/** Benchmark pure node Lib001_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn019();
+	/** Benchmark callable node Lib001_Fn020 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn020();
+	/** Benchmark callable node Lib001_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn021(const FTransform& In0, FName In1, FVector& Out2, const FVector& In3, int32& Out4, float In5);
+	/** Benchmark callable node Lib001_Fn022 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn022(const FVector& In0, FVector& Out1, const TArray< int32 >& In2, int32& Out3, const FVector& In4);
+	/** Benchmark callable node Lib001_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn023(FName In0, int32 In1);
+	/** Benchmark callable node Lib001_Fn024 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn024();
+	/** Benchmark callable node Lib001_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn025(FVector& Out0, const FTransform& In1, FName In2, const FString& In3, const FTransform& In4, FName In5);
+	/** Benchmark callable node Lib001_Fn026 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn026(const FTransform& In0, FName In1, float In2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5, int32 In6);
+	/** Benchmark callable node Lib001_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn027(float In0, const FTransform& In1, const FTransform& In2, UObject* In3, int32 In4, const TArray< int32 >& In5, const FString& In6);
+	/** Benchmark callable node Lib001_Fn028 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn028();
+	/** Benchmark callable node Lib001_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn029(FString& Out0, float In1, UObject* In2);
+	/** Benchmark callable node Lib001_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn030(int32 In0, float In1, const FString& In2, int32& Out3, const FVector& In4, bool In5, const TArray< int32 >& In6, const FVector& In7);
+	/** Benchmark latent node Lib001_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib001_Fn032 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn032(FVector& Out0, const FString& In1, const FTransform& In2, FString& Out3, float In4, const FTransform& In5);
+	/** Benchmark pure node Lib001_Fn033 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn033(const FString& In0, const FTransform& In1, UObject* In2, const FTransform& In3, int32 In4, FString& Out5, FName In6);
+	/** Benchmark pure node Lib001_Fn034 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn034();
+	/** Benchmark pure node Lib001_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn035(UObject* In0);
+	/** Benchmark pure node Lib001_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn036(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib001_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn037(const FVector& In0, int32 In1, bool In2, int32& Out3);
+	/** Benchmark callable node Lib001_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn038(const FTransform& In0);
+	/** Benchmark callable node Lib001_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn039(const FTransform& In0, const FVector& In1, int32& Out2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5, FVector& Out6, const FString& In7);
+	/** Benchmark callable node Lib001_Fn040 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn040(int32& Out0);
+	/** Benchmark pure node Lib001_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn041(FName In0, FName In1, const FVector& In2, int32 In3, float In4);
+	/** Benchmark callable node Lib001_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn042(FName In0, const FTransform& In1, FName In2);
+	/** Benchmark callable node Lib001_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn043();
+	/** Benchmark callable node Lib001_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn044();
+	/** Benchmark callable node Lib001_Fn045 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn045(bool In0, bool In1, int32 In2, FString& Out3, UObject* In4);
+	/** Benchmark callable node Lib001_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn046(float In0, bool In1, FVector& Out2, UObject* In3, const FVector& In4, FName In5, int32& Out6);
+	/** Benchmark callable node Lib001_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn047(UObject* In0, FName In1, const TArray< int32 >& In2, const FTransform& In3, FVector& Out4, UObject* In5, const FVector& In6);
+	/** Benchmark callable node Lib001_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn048();
+	/** Benchmark callable node Lib001_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn049(bool In0, FVector& Out1, const FTransform& In2, UObject* In3, const FTransform& In4, FVector& Out5);
+	/** Benchmark latent node Lib001_Fn050 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, float In2, int32& Out3, FVector& Out4, bool In5);
+	/** Benchmark callable node Lib001_Fn051 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn051(bool In0, int32& Out1, const FTransform& In2, int32& Out3, const FTransform& In4, const TArray< int32 >& In5, bool In6, FVector& Out7);
+	/** Benchmark callable node Lib001_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn052(float In0, bool In1, int32& Out2);
+	/** Benchmark callable node Lib001_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn053(const FVector& In0, int32 In1);
+	/** Benchmark callable node Lib001_Fn054 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn054();
+	/** Benchmark latent node Lib001_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1);
+	/** Benchmark callable node Lib001_Fn056 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn056(FName In0);
+	/** Benchmark pure node Lib001_Fn057 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn057(FName In0, bool In1, int32& Out2, FName In3, const FVector& In4);
+	/** Benchmark callable node Lib001_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn058(UObject* In0, FName In1, FVector& Out2, const TArray< int32 >& In3, FName In4);
+	/** Benchmark callable node Lib001_Fn059 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn059();
+	/** Benchmark pure node Lib001_Fn060 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn060(bool In0, const FString& In1, FVector& Out2, FVector& Out3, const FVector& In4, FString& Out5, float In6);
+	/** Benchmark callable node Lib001_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn061(const TArray< int32 >& In0, UObject* In1, float In2, const TArray< int32 >& In3, FVector& Out4, const FString& In5);
+	/** Benchmark pure node Lib001_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn062(int32& Out0, FString& Out1);
+	/** Benchmark callable node Lib001_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn063(float In0, float In1, const FString& In2, const FVector& In3, bool In4);
+	/** Benchmark pure node Lib001_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn064(UObject* In0, int32 In1, FVector& Out2);
+	/** Benchmark callable node Lib001_Fn065 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn065(int32& Out0, bool In1, const FString& In2, const FTransform& In3);
+	/** Benchmark callable node Lib001_Fn066 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn066(int32 In0, const FString& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib001_Fn067 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn067();
+	/** Benchmark latent node Lib001_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, const FVector& In2, int32& Out3);
+	/** Benchmark callable node Lib001_Fn069 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn069(const FTransform& In0, float In1, bool In2, float In3, UObject* In4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib001_Fn070 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn070(FName In0, const FTransform& In1, const TArray< int32 >& In2, int32& Out3);
+	/** Benchmark pure node Lib001_Fn071 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn071(const FTransform& In0, int32& Out1, FString& Out2, float In3);
+	/** Benchmark callable node Lib001_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn072(int32& Out0, FVector& Out1, bool In2, FName In3, FString& Out4);
+	/** Benchmark pure node Lib001_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn073(const FTransform& In0, const FString& In1, bool In2);
+	/** Benchmark pure node Lib001_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn074(FVector& Out0, FString& Out1, FVector& Out2, bool In3, const FTransform& In4, const FTransform& In5, UObject* In6, FVector& Out7);
+	/** Benchmark callable node Lib001_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn075(float In0, const FTransform& In1, float In2, const FString& In3);
+	/** Benchmark callable node Lib001_Fn076 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn076(FString& Out0);
+	/** Benchmark latent node Lib001_Fn077 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, const FVector& In2, FVector& Out3, FString& Out4, const FVector& In5, int32 In6, FName In7);
+	/** Benchmark pure node Lib001_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn078(FString& Out0, const FVector& In1, int32& Out2, FName In3, float In4, FVector& Out5, const FString& In6);
+	/** Benchmark callable node Lib001_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static float Lib001_Fn079(FName In0, UObject* In1, FString& Out2);
+	/** Benchmark pure node Lib001_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn080(const FTransform& In0, const FString& In1, bool In2);
+	/** Benchmark callable node Lib001_Fn081 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn081(float In0, const FVector& In1, const FString& In2, const FVector& In3, const FVector& In4, FString& Out5, float In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib001_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn082(int32& Out0, const FVector& In1, FVector& Out2, UObject* In3, float In4);
+	/** Benchmark callable node Lib001_Fn083 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn083(const FString& In0);
+	/** Benchmark callable node Lib001_Fn084 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static bool Lib001_Fn084(int32 In0, bool In1, FString& Out2, FVector& Out3, int32 In4, int32 In5, int32& Out6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib001_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn085(float In0, int32& Out1, FVector& Out2);
+	/** Benchmark pure node Lib001_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn086(const FString& In0, UObject* In1, const FString& In2, FVector& Out3);
+	/** Benchmark pure node Lib001_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn087(float In0);
+	/** Benchmark pure node Lib001_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn088(const TArray< int32 >& In0, const TArray< int32 >& In1, bool In2, const FTransform& In3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib001_Fn089 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn089(int32 In0, FString& Out1, const FVector& In2, const FTransform& In3, UObject* In4, int32& Out5, const FString& In6, FString& Out7);
+	/** Benchmark callable node Lib001_Fn090 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn090(int32 In0, FName In1, bool In2, FName In3, bool In4);
+	/** Benchmark pure node Lib001_Fn091 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn091(const FString& In0, const FString& In1, const FVector& In2, const TArray< int32 >& In3, const FTransform& In4, FVector& Out5, float In6);
+	/** Benchmark pure node Lib001_Fn092 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static int32 Lib001_Fn092(float In0, int32& Out1, int32& Out2);
+	/** Benchmark callable node Lib001_Fn093 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static FVector Lib001_Fn093(FString& Out0, FVector& Out1, const TArray< int32 >& In2, const FVector& In3, FString& Out4);
+	/** Benchmark latent node Lib001_Fn094 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, const TArray< int32 >& In2, int32& Out3, FString& Out4, const FString& In5, bool In6);
+	/** Benchmark latent node Lib001_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1);
+	/** Benchmark callable node Lib001_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn096(FString& Out0, int32 In1, FString& Out2, const FTransform& In3, FVector& Out4);
+	/** Benchmark pure node Lib001_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib001")
+	static FString Lib001_Fn097(const FVector& In0, UObject* In1);
+	/** Benchmark latent node Lib001_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib001_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FVector& In1, FString& Out2, FString& Out3, FString& Out4);
+	/** Benchmark callable node Lib001_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib001")
+	static void Lib001_Fn099(bool In0, const TArray< int32 >& In1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_002 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib002_Fn000 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, FName In4, const FString& In5, const FVector& In6);
+	/** Benchmark pure node Lib002_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn001(FName In0, const FString& In1, UObject* In2, const FVector& In3, const TArray< int32 >& In4, bool In5);
+	/** Benchmark callable node Lib002_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn002(bool In0, int32 In1, FVector& Out2, FString& Out3);
+	/** Benchmark pure node Lib002_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn003(const FVector& In0, const FString& In1, FString& Out2);
+	/** Benchmark callable node Lib002_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn004(const FString& In0, float In1);
+	/** Benchmark callable node Lib002_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn005(FString& Out0, const FVector& In1, float In2, UObject* In3, const FTransform& In4, bool In5, bool In6, bool In7);
+	/** Benchmark callable node Lib002_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn006(int32 In0, UObject* In1, FName In2);
+	/** Benchmark callable node Lib002_Fn007 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn007(int32& Out0, float In1, FVector& Out2, FString& Out3, FString& Out4, const FVector& In5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark callable node Lib002_Fn008 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn008(FString& Out0, const TArray< int32 >& In1, const FTransform& In2, const FString& In3, const FTransform& In4);
+	/** Benchmark callable node Lib002_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn009(int32 In0);
+	/** Benchmark callable node Lib002_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn010(FName In0, int32 In1, FVector& Out2, FString& Out3, float In4);
+	/** Benchmark callable node Lib002_Fn011 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn011(const FString& In0, const TArray< int32 >& In1, FString& Out2, UObject* In3);
+	/** Benchmark callable node Lib002_Fn012 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn012(const FString& In0, const TArray< int32 >& In1, FName In2, int32 In3);
+	/** Benchmark callable node Lib002_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn013(int32 In0, UObject* In1, const FString& In2, UObject* In3, float In4);
+	/** Benchmark latent node Lib002_Fn014 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, bool In1, float In2, const TArray< int32 >& In3, FVector& Out4, int32& Out5);
+	/** Benchmark callable node Lib002_Fn015 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn015(FVector& Out0, const FVector& In1, int32 In2, float In3, UObject* In4);
+	/** Benchmark callable node Lib002_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn016(FString& Out0, FString& Out1, const FVector& In2, const FTransform& In3, const FTransform& In4);
+	/** Benchmark callable node Lib002_Fn017 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn017(FVector& Out0, const TArray< int32 >& In1, bool In2, bool In3, bool In4, FVector& Out5, UObject* In6);
+	/** Benchmark latent node Lib002_Fn018 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, int32& Out2, const FString& In3, UObject* In4, int32 In5);
+	/** Benchmark callable node Lib002_Fn019 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn019(const FVector& In0);
+	/** Benchmark callable node Lib002_Fn020 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn020(const TArray< int32 >& In0, float In1, const FVector& In2, const TArray< int32 >& In3, float In4);
+	/** Benchmark callable node Lib002_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn021(FVector& Out0, FVector& Out1, bool In2, const FString& In3);
+	/** Benchmark callable node Lib002_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn022(const FVector& In0, const FTransform& In1, const TArray< int32 >& In2, const FTransform& In3);
+	/** Benchmark callable node Lib002_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn023(const FTransform& In0, const FVector& In1, FName In2, int32& Out3, const FVector& In4);
+	/** Benchmark callable node Lib002_Fn024 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn024(const FVector& In0, int32& Out1, bool In2, const FString& In3);
+	/** Benchmark callable node Lib002_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn025(float In0, bool In1, bool In2, int32 In3, FName In4, const FVector& In5, const TArray< int32 >& In6, FVector& Out7);
+	/** Benchmark callable node Lib002_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn026(const FString& In0, const FTransform& In1, int32& Out2, const FVector& In3, FVector& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, const FString& In7);
+	/** Benchmark pure node Lib002_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn027(const FTransform& In0, FVector& Out1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib002_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn028(int32& Out0, FName In1, FString& Out2, FVector& Out3);
+	/** Benchmark callable node Lib002_Fn029 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn029(int32 In0, FString& Out1, bool In2, FString& Out3, const FString& In4, const FString& In5);
+	/** Benchmark latent node Lib002_Fn030 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, const FTransform& In4, int32& Out5, float In6, FVector& Out7);
+	/** Benchmark latent node Lib002_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, FName In2, float In3, bool In4);
+	/** Benchmark callable node Lib002_Fn032 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn032(const FString& In0, const FVector& In1, UObject* In2, UObject* In3, const FTransform& In4, const FVector& In5, UObject* In6);
+	/** Benchmark callable node Lib002_Fn033 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn033(float In0);
+	/** Benchmark callable node Lib002_Fn034 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn034(FString& Out0);
+	/** Benchmark callable node Lib002_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn035(FName In0);
+	/** Benchmark callable node Lib002_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn036(float In0, int32& Out1, FVector& Out2, const FVector& In3, const FTransform& In4, UObject* In5, FString& Out6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib002_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1, float In2);
+	/** Benchmark callable node Lib002_Fn038 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn038(const TArray< int32 >& In0, float In1, FVector& Out2, bool In3, int32& Out4, FName In5, const FTransform& In6, int32 In7);
+	/** Benchmark latent node Lib002_Fn039 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn039(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const TArray< int32 >& In1, int32& Out2, UObject* In3, const FTransform& In4, const FString& In5, float In6, FVector& Out7);
+	/** Benchmark pure node Lib002_Fn040 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn040(const FString& In0, const FTransform& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib002_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn041(FVector& Out0, FString& Out1, int32& Out2, const TArray< int32 >& In3, UObject* In4, const FVector& In5, const FVector& In6, const FTransform& In7);
+	/** Benchmark pure node Lib002_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn042();
+	/** Benchmark pure node Lib002_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn043();
+	/** Benchmark callable node Lib002_Fn044 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn044(int32 In0);
+	/** Benchmark callable node Lib002_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn045(bool In0);
+	/** Benchmark pure node Lib002_Fn046 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn046(float In0, const FVector& In1, UObject* In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib002_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn047(const FVector& In0, float In1, bool In2);
+	/** Benchmark callable node Lib002_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn048(const FString& In0, int32 In1, FName In2, bool In3, FName In4, int32 In5, float In6);
+	/** Benchmark pure node Lib002_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn049(UObject* In0, const FTransform& In1);
+	/** Benchmark latent node Lib002_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1, UObject* In2, float In3);
+	/** Benchmark callable node Lib002_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn051(const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib002_Fn052 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn052(FName In0, const FTransform& In1, const FVector& In2, const FString& In3, const FTransform& In4, const FVector& In5);
+	/** Benchmark pure node Lib002_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn053(FString& Out0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark callable node Lib002_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn054(const FString& In0, const FString& In1);
+	/** Benchmark pure node Lib002_Fn055 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn055(FString& Out0, const TArray< int32 >& In1, int32& Out2, int32& Out3, FString& Out4);
+	/** Benchmark callable node Lib002_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn056();
+	/** Benchmark pure node Lib002_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn057();
+	/** Benchmark callable node Lib002_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn058(int32& Out0, UObject* In1);
+	/** Benchmark callable node Lib002_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn059(const FString& In0, const FVector& In1, bool In2, FName In3, FName In4, UObject* In5, float In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib002_Fn060 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn060(const FVector& In0, UObject* In1, float In2, float In3, FVector& Out4);
+	/** Benchmark callable node Lib002_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn061(int32& Out0);
+	/** Benchmark pure node Lib002_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn062(const TArray< int32 >& In0, const FTransform& In1, int32& Out2, int32 In3, const FString& In4);
+	/** Benchmark callable node Lib002_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn063(const FVector& In0, bool In1, UObject* In2);
+	/** Benchmark callable node Lib002_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn064();
+	/** Benchmark callable node Lib002_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn065();
+	/** Benchmark callable node Lib002_Fn066 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn066(const FTransform& In0, FName In1, float In2);
+	/** Benchmark callable node Lib002_Fn067 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn067(UObject* In0, float In1, int32& Out2, UObject* In3, const FVector& In4, const FVector& In5, const FTransform& In6, const FVector& In7);
+	/** Benchmark pure node Lib002_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn068(UObject* In0, const FString& In1, float In2);
+	/** Benchmark latent node Lib002_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, FVector& Out2, float In3);
+	/** Benchmark callable node Lib002_Fn070 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn070(const TArray< int32 >& In0, FString& Out1, FName In2, const FTransform& In3, UObject* In4);
+	/** Benchmark callable node Lib002_Fn071 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn071(FString& Out0, int32 In1, int32& Out2, UObject* In3);
+	/** Benchmark callable node Lib002_Fn072 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn072(float In0, int32 In1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib002_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn073(int32& Out0);
+	/** Benchmark pure node Lib002_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn074(const FVector& In0, int32 In1, UObject* In2, UObject* In3, const FString& In4, const TArray< int32 >& In5, FString& Out6, const FVector& In7);
+	/** Benchmark pure node Lib002_Fn075 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn075(FVector& Out0);
+	/** Benchmark pure node Lib002_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn076(bool In0, int32 In1, UObject* In2, FVector& Out3, const TArray< int32 >& In4, FName In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib002_Fn077 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn077(const TArray< int32 >& In0, const TArray< int32 >& In1, const FVector& In2);
+	/** Benchmark callable node Lib002_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn078(const FTransform& In0, int32 In1, FVector& Out2, const TArray< int32 >& In3, const FTransform& In4, FVector& Out5, const TArray< int32 >& In6, FName In7);
+	/** Benchmark callable node Lib002_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn079(int32 In0);
+	/** Benchmark latent node Lib002_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib002_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1);
+	/** Benchmark pure node Lib002_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static FVector Lib002_Fn081();
+	/** Benchmark callable node Lib002_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn082(float In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark callable node Lib002_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn083(int32 In0, int32 In1);
+	/** Benchmark pure node Lib002_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn084(const FVector& In0, float In1, const FString& In2, int32 In3, int32& Out4, FName In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib002_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn085(int32 In0, int32 In1, int32& Out2, int32& Out3, FVector& Out4, UObject* In5, const FVector& In6, const FString& In7);
+	/** Benchmark callable node Lib002_Fn086 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn086(FName In0);
+	/** Benchmark pure node Lib002_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn087(FString& Out0, float In1, bool In2, UObject* In3, const FString& In4, UObject* In5, int32 In6);
+	/** Benchmark pure node Lib002_Fn088 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn088(int32& Out0, const FString& In1);
+	/** Benchmark callable node Lib002_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn089(float In0, float In1, float In2, const FVector& In3, int32 In4, int32& Out5);
+	/** Benchmark callable node Lib002_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn090(const TArray< int32 >& In0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3, float In4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib002_Fn091 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static void Lib002_Fn091();
+	/** Benchmark callable node Lib002_Fn092 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn092(const TArray< int32 >& In0, UObject* In1, UObject* In2);
+	/** Benchmark callable node Lib002_Fn093 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn093(const FString& In0);
+	/** Benchmark callable node Lib002_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn094(int32 In0, int32& Out1, const FVector& In2);
+	/** Benchmark callable node Lib002_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static bool Lib002_Fn095(int32& Out0, const FString& In1, const FVector& In2, FVector& Out3);
+	/** Benchmark pure node Lib002_Fn096 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn096(const FString& In0, bool In1, int32 In2, float In3, bool In4, int32& Out5, float In6, int32& Out7);
+	/** Benchmark callable node Lib002_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static float Lib002_Fn097(FVector& Out0, FName In1, int32 In2);
+	/** Benchmark callable node Lib002_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static FString Lib002_Fn098(const FString& In0, bool In1, int32& Out2);
+	/** Benchmark callable node Lib002_Fn099 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib002")
+	static int32 Lib002_Fn099();
+};
+
+
+UCLASS()
+class UKDGBenchLib_003 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib003_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn000(float In0);
+	/** Benchmark latent node Lib003_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib003_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn002(const FString& In0, UObject* In1);
+	/** Benchmark callable node Lib003_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static void Lib003_Fn003(FVector& Out0, int32& Out1, int32& Out2, const FVector& In3, FVector& Out4, const FTransform& In5, FString& Out6);
+	/** Benchmark callable node Lib003_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn004(const FString& In0, float In1, FName In2, const FTransform& In3, FVector& Out4, const FTransform& In5, const FTransform& In6, const FTransform& In7);
+	/** Benchmark callable node Lib003_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn005();
+	/** Benchmark pure node Lib003_Fn006 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn006(float In0, const FVector& In1, const TArray< int32 >& In2, const FTransform& In3, const FString& In4, FName In5);
+	/** Benchmark pure node Lib003_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn007(const FTransform& In0, const FString& In1, FName In2, const FVector& In3, int32 In4, const FVector& In5, const FString& In6);
+	/** Benchmark pure node Lib003_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn008(const TArray< int32 >& In0, FString& Out1);
+	/** Benchmark callable node Lib003_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn009(int32& Out0, FString& Out1, FString& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib003_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn010();
+	/** Benchmark latent node Lib003_Fn011 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, bool In1, const FTransform& In2, const FTransform& In3);
+	/** Benchmark pure node Lib003_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn012(FVector& Out0, int32& Out1, const FTransform& In2, int32& Out3, float In4, const FTransform& In5, const TArray< int32 >& In6, const FTransform& In7);
+	/** Benchmark callable node Lib003_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static void Lib003_Fn013(float In0, int32& Out1);
+	/** Benchmark callable node Lib003_Fn014 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn014(float In0, int32 In1);
+	/** Benchmark callable node Lib003_Fn015 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn015(int32 In0, const TArray< int32 >& In1, FName In2, int32 In3, UObject* In4);
+	/** Benchmark latent node Lib003_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, int32 In2, int32 In3, bool In4, const FVector& In5);
+	/** Benchmark callable node Lib003_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn017(FString& Out0);
+	/** Benchmark callable node Lib003_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn018(const FString& In0);
+	/** Benchmark pure node Lib003_Fn019 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn019(int32& Out0);
+	/** Benchmark callable node Lib003_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn020(const FVector& In0, UObject* In1, int32 In2, const FString& In3, float In4, const TArray< int32 >& In5, const FVector& In6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib003_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, const FVector& In2, bool In3, const FTransform& In4, FName In5);
+	/** Benchmark callable node Lib003_Fn022 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn022(UObject* In0, int32 In1, const FTransform& In2, bool In3, FName In4, FVector& Out5);
+	/** Benchmark callable node Lib003_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn023(FName In0, FString& Out1, bool In2, FName In3, float In4);
+	/** Benchmark pure node Lib003_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn024(FVector& Out0, int32& Out1, const FVector& In2, const FString& In3, const TArray< int32 >& In4, FString& Out5);
+	/** Benchmark latent node Lib003_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FString& In1);
+	/** Benchmark pure node Lib003_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn026(int32 In0, const FTransform& In1, const FString& In2, FVector& Out3, const FVector& In4, bool In5);
+	/** Benchmark callable node Lib003_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn027(const FVector& In0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib003_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn028(const FString& In0, const TArray< int32 >& In1, const FTransform& In2, UObject* In3, UObject* In4, const FString& In5, FString& Out6);
+	/** Benchmark callable node Lib003_Fn029 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn029(bool In0, FName In1, const FTransform& In2, const TArray< int32 >& In3);
+	/** Benchmark latent node Lib003_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FTransform& In1, FString& Out2, const FVector& In3, const FVector& In4, float In5);
+	/** Benchmark pure node Lib003_Fn031 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn031(int32 In0, FString& Out1, int32& Out2, const FTransform& In3, int32& Out4, const FTransform& In5, UObject* In6, const FTransform& In7);
+	/** Benchmark pure node Lib003_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn032(FName In0, int32& Out1, UObject* In2, int32& Out3, int32 In4, const TArray< int32 >& In5, float In6, const FVector& In7);
+	/** Benchmark callable node Lib003_Fn033 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn033(const TArray< int32 >& In0, bool In1);
+	/** Benchmark callable node Lib003_Fn034 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn034(const FVector& In0, const FVector& In1, int32 In2, const FVector& In3, bool In4, const FString& In5, int32 In6, UObject* In7);
+	/** Benchmark callable node Lib003_Fn035 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn035(bool In0, int32& Out1, int32 In2, int32& Out3, const FTransform& In4, const FVector& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib003_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn036(FString& Out0, bool In1);
+	/** Benchmark callable node Lib003_Fn037 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn037(UObject* In0, int32 In1, FString& Out2, int32 In3, FVector& Out4, FName In5);
+	/** Benchmark latent node Lib003_Fn038 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib003_Fn039 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn039(UObject* In0, const TArray< int32 >& In1, float In2, int32& Out3, float In4, UObject* In5);
+	/** Benchmark pure node Lib003_Fn040 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn040(int32 In0, FName In1, FName In2);
+	/** Benchmark callable node Lib003_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn041(float In0);
+	/** Benchmark callable node Lib003_Fn042 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn042(int32& Out0, UObject* In1, int32& Out2, const TArray< int32 >& In3, bool In4, const FTransform& In5);
+	/** Benchmark latent node Lib003_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32& Out1, const FVector& In2, bool In3, const FVector& In4);
+	/** Benchmark callable node Lib003_Fn044 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn044(FName In0);
+	/** Benchmark callable node Lib003_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static void Lib003_Fn045(UObject* In0, const FTransform& In1, const FString& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, const FString& In5, FVector& Out6, int32& Out7);
+	/** Benchmark latent node Lib003_Fn046 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, float In1, FString& Out2, const FTransform& In3, const FString& In4, float In5, int32 In6);
+	/** Benchmark pure node Lib003_Fn047 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn047();
+	/** Benchmark callable node Lib003_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn048(UObject* In0, const TArray< int32 >& In1, bool In2, const FVector& In3, const TArray< int32 >& In4, FName In5, UObject* In6, FName In7);
+	/** Benchmark callable node Lib003_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static void Lib003_Fn049(bool In0, int32 In1, UObject* In2);
+	/** Benchmark callable node Lib003_Fn050 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static void Lib003_Fn050();
+	/** Benchmark pure node Lib003_Fn051 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn051(float In0, int32& Out1, int32& Out2);
+	/** Benchmark callable node Lib003_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn052(const TArray< int32 >& In0, const FVector& In1, UObject* In2);
+	/** Benchmark pure node Lib003_Fn053 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn053(FName In0, UObject* In1, FVector& Out2, const FString& In3, int32& Out4, const FVector& In5, int32& Out6);
+	/** Benchmark callable node Lib003_Fn054 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn054(const FString& In0, int32& Out1, const TArray< int32 >& In2, bool In3);
+	/** Benchmark callable node Lib003_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn055(float In0, const FTransform& In1, const FString& In2, float In3);
+	/** Benchmark latent node Lib003_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark callable node Lib003_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn057(FString& Out0);
+	/** Benchmark pure node Lib003_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn058(UObject* In0, FName In1, FVector& Out2, const TArray< int32 >& In3, bool In4, UObject* In5, const FVector& In6, int32& Out7);
+	/** Benchmark pure node Lib003_Fn059 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn059(float In0, int32& Out1, int32 In2, float In3, FName In4, const FTransform& In5, const FVector& In6);
+	/** Benchmark callable node Lib003_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn060();
+	/** Benchmark pure node Lib003_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn061();
+	/** Benchmark latent node Lib003_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FName In1, FString& Out2);
+	/** Benchmark pure node Lib003_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn063(int32& Out0, float In1, UObject* In2);
+	/** Benchmark callable node Lib003_Fn064 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static void Lib003_Fn064(float In0);
+	/** Benchmark callable node Lib003_Fn065 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn065(bool In0, UObject* In1, const FTransform& In2, const FString& In3, UObject* In4, float In5, FName In6);
+	/** Benchmark latent node Lib003_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, UObject* In1, FString& Out2);
+	/** Benchmark callable node Lib003_Fn067 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn067(const FString& In0, float In1, const FString& In2);
+	/** Benchmark callable node Lib003_Fn068 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn068(FVector& Out0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib003_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn069(int32& Out0);
+	/** Benchmark pure node Lib003_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn070(FVector& Out0, int32& Out1, FName In2);
+	/** Benchmark latent node Lib003_Fn071 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1, UObject* In2, FName In3, const FVector& In4, int32 In5, FString& Out6);
+	/** Benchmark callable node Lib003_Fn072 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn072(const FVector& In0, const FString& In1, FString& Out2, const FTransform& In3, float In4, bool In5, FName In6);
+	/** Benchmark callable node Lib003_Fn073 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn073();
+	/** Benchmark latent node Lib003_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib003_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, UObject* In1, const FString& In2, int32& Out3, const FVector& In4);
+	/** Benchmark callable node Lib003_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn075(float In0, bool In1, FName In2, const TArray< int32 >& In3, UObject* In4, UObject* In5, float In6);
+	/** Benchmark callable node Lib003_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn076(int32& Out0, FName In1);
+	/** Benchmark callable node Lib003_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn077(UObject* In0, FVector& Out1, FVector& Out2, UObject* In3, UObject* In4, FName In5, bool In6);
+	/** Benchmark pure node Lib003_Fn078 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn078(float In0, FName In1, int32 In2);
+	/** Benchmark pure node Lib003_Fn079 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn079(UObject* In0, const FString& In1, UObject* In2, FVector& Out3, int32 In4, const FTransform& In5);
+	/** Benchmark callable node Lib003_Fn080 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn080(float In0);
+	/** Benchmark callable node Lib003_Fn081 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn081(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib003_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn082(bool In0, int32& Out1, bool In2, int32& Out3, const FTransform& In4, int32& Out5, UObject* In6, int32 In7);
+	/** Benchmark pure node Lib003_Fn083 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn083(int32 In0, bool In1, int32& Out2, int32 In3, FString& Out4, const TArray< int32 >& In5, const FVector& In6, int32& Out7);
+	/** Benchmark pure node Lib003_Fn084 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn084(int32 In0, const FString& In1, FString& Out2, FName In3);
+	/** Benchmark callable node Lib003_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn085(int32 In0, const FTransform& In1, UObject* In2, FVector& Out3, bool In4, bool In5, UObject* In6, const FTransform& In7);
+	/** Benchmark pure node Lib003_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn086(const FString& In0, FVector& Out1, FString& Out2, FString& Out3);
+	/** Benchmark callable node Lib003_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FString Lib003_Fn087(const FVector& In0, int32 In1, float In2, const FVector& In3, const FVector& In4, UObject* In5, int32 In6);
+	/** Benchmark callable node Lib003_Fn088 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn088(int32& Out0, UObject* In1, int32& Out2, int32 In3, bool In4);
+	/** Benchmark callable node Lib003_Fn089 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn089(int32& Out0);
+	/** Benchmark callable node Lib003_Fn090 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static bool Lib003_Fn090(FString& Out0, const FString& In1, int32& Out2, int32 In3, int32 In4, FString& Out5);
+	/** Benchmark pure node Lib003_Fn091 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn091(bool In0, UObject* In1, bool In2);
+	/** Benchmark callable node Lib003_Fn092 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static void Lib003_Fn092(UObject* In0, const FTransform& In1, const FString& In2, FString& Out3, bool In4, int32& Out5, bool In6, const FVector& In7);
+	/** Benchmark pure node Lib003_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn093(int32& Out0, int32& Out1, FVector& Out2, FName In3, int32& Out4, const TArray< int32 >& In5, int32 In6, const FString& In7);
+	/** Benchmark pure node Lib003_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn094(int32& Out0, FString& Out1);
+	/** Benchmark pure node Lib003_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn095(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib003_Fn096 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static int32 Lib003_Fn096(const FVector& In0, const TArray< int32 >& In1, FVector& Out2, UObject* In3, FVector& Out4, int32 In5, FVector& Out6, int32 In7);
+	/** Benchmark callable node Lib003_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn097(const FString& In0, int32 In1, FName In2, FName In3, FName In4, int32 In5, const FVector& In6);
+	/** Benchmark pure node Lib003_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib003")
+	static float Lib003_Fn098();
+	/** Benchmark callable node Lib003_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib003")
+	static FVector Lib003_Fn099(int32 In0, int32& Out1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_004 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib004_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static void Lib004_Fn000(UObject* In0, float In1, bool In2, const FVector& In3);
+	/** Benchmark callable node Lib004_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn001(const TArray< int32 >& In0, int32 In1);
+	/** Benchmark callable node Lib004_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn002(const FVector& In0, const FVector& In1, const FVector& In2, const TArray< int32 >& In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib004_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn003(const FTransform& In0, int32 In1, const TArray< int32 >& In2, FString& Out3, const TArray< int32 >& In4, FString& Out5);
+	/** Benchmark latent node Lib004_Fn004 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0);
+	/** Benchmark pure node Lib004_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn005(int32 In0, const FVector& In1, float In2, FName In3, const FString& In4, int32& Out5, FName In6);
+	/** Benchmark callable node Lib004_Fn006 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn006(float In0);
+	/** Benchmark pure node Lib004_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn007(FVector& Out0, FName In1, const FVector& In2, FString& Out3, FName In4, UObject* In5, const FString& In6);
+	/** Benchmark pure node Lib004_Fn008 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn008(FVector& Out0, const FString& In1, int32& Out2, const FString& In3);
+	/** Benchmark latent node Lib004_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FName In1, UObject* In2, UObject* In3);
+	/** Benchmark pure node Lib004_Fn010 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn010(const TArray< int32 >& In0, int32& Out1);
+	/** Benchmark callable node Lib004_Fn011 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn011(const FTransform& In0, bool In1);
+	/** Benchmark callable node Lib004_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn012(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib004_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn013(float In0, FName In1, FName In2, bool In3, UObject* In4, FString& Out5);
+	/** Benchmark pure node Lib004_Fn014 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn014();
+	/** Benchmark callable node Lib004_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static void Lib004_Fn015(int32& Out0, UObject* In1, FName In2, const FString& In3);
+	/** Benchmark callable node Lib004_Fn016 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn016(UObject* In0, const FTransform& In1);
+	/** Benchmark callable node Lib004_Fn017 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn017();
+	/** Benchmark callable node Lib004_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn018(FName In0, FVector& Out1, float In2, bool In3, const FString& In4);
+	/** Benchmark pure node Lib004_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn019(const FString& In0, UObject* In1, bool In2, int32& Out3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib004_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn020(FString& Out0);
+	/** Benchmark callable node Lib004_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn021(FVector& Out0, const FString& In1);
+	/** Benchmark callable node Lib004_Fn022 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn022(int32 In0);
+	/** Benchmark pure node Lib004_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn023();
+	/** Benchmark latent node Lib004_Fn024 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, int32& Out2);
+	/** Benchmark callable node Lib004_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn025(const FVector& In0, FVector& Out1, const FString& In2, int32& Out3);
+	/** Benchmark callable node Lib004_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn026(const FTransform& In0, const FTransform& In1, FName In2, FVector& Out3);
+	/** Benchmark latent node Lib004_Fn027 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32& Out1, FVector& Out2, int32 In3, int32& Out4, FString& Out5);
+	/** Benchmark callable node Lib004_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static void Lib004_Fn028(int32 In0, int32 In1, const FTransform& In2, int32& Out3, const FVector& In4, const FString& In5);
+	/** Benchmark latent node Lib004_Fn029 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1, const FString& In2, float In3);
+	/** Benchmark callable node Lib004_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn030(FString& Out0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib004_Fn031 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn031(int32 In0, FVector& Out1, UObject* In2, FName In3, bool In4, int32 In5);
+	/** Benchmark pure node Lib004_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn032(bool In0, const FTransform& In1, const FString& In2, int32 In3);
+	/** Benchmark pure node Lib004_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn033(const FVector& In0, bool In1, const FTransform& In2, int32& Out3, UObject* In4);
+	/** Benchmark callable node Lib004_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn034(bool In0, const FVector& In1, FName In2, UObject* In3, FString& Out4, const FString& In5, FName In6);
+	/** Benchmark callable node Lib004_Fn035 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static void Lib004_Fn035(float In0, const FVector& In1, FVector& Out2, FVector& Out3, float In4);
+	/** Benchmark latent node Lib004_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib004_Fn037 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn037(const FVector& In0);
+	/** Benchmark callable node Lib004_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn038(int32& Out0, float In1, float In2, int32& Out3, int32 In4, FName In5, UObject* In6);
+	/** Benchmark pure node Lib004_Fn039 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn039(const FTransform& In0, bool In1, int32& Out2, FString& Out3, FVector& Out4);
+	/** Benchmark callable node Lib004_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn040(int32& Out0, bool In1, UObject* In2, int32 In3, const FVector& In4);
+	/** Benchmark pure node Lib004_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn041(FString& Out0);
+	/** Benchmark pure node Lib004_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn042(const FVector& In0, bool In1, const FString& In2, const TArray< int32 >& In3, const FTransform& In4, FVector& Out5, const FTransform& In6);
+	/** Benchmark pure node Lib004_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn043(const FVector& In0, int32& Out1, bool In2, const FVector& In3, const FVector& In4, FVector& Out5, const FVector& In6);
+	/** Benchmark latent node Lib004_Fn044 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1);
+	/** Benchmark pure node Lib004_Fn045 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn045(FString& Out0, FVector& Out1, FName In2, int32 In3);
+	/** Benchmark callable node Lib004_Fn046 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn046(const TArray< int32 >& In0, int32 In1, const FTransform& In2);
+	/** Benchmark callable node Lib004_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn047(const TArray< int32 >& In0, UObject* In1, const FTransform& In2, const TArray< int32 >& In3, bool In4, float In5);
+	/** Benchmark pure node Lib004_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn048();
+	/** Benchmark callable node Lib004_Fn049 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn049(const FVector& In0, FVector& Out1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib004_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn050(int32 In0);
+	/** Benchmark latent node Lib004_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, const FVector& In2);
+	/** Benchmark latent node Lib004_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const TArray< int32 >& In1, FString& Out2, int32 In3, UObject* In4);
+	/** Benchmark latent node Lib004_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn053(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark latent node Lib004_Fn054 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FString& In1, bool In2);
+	/** Benchmark latent node Lib004_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark pure node Lib004_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn056(FName In0, FString& Out1, float In2, bool In3, bool In4, const FVector& In5);
+	/** Benchmark callable node Lib004_Fn057 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn057(const TArray< int32 >& In0, int32 In1, int32 In2, bool In3);
+	/** Benchmark pure node Lib004_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn058(const TArray< int32 >& In0, float In1, FString& Out2, float In3, FString& Out4, bool In5, const FTransform& In6, UObject* In7);
+	/** Benchmark callable node Lib004_Fn059 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn059(FName In0, const FString& In1, const FTransform& In2, bool In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib004_Fn060 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn060(const TArray< int32 >& In0, float In1, const FTransform& In2, FName In3, FString& Out4, FName In5, bool In6);
+	/** Benchmark pure node Lib004_Fn061 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn061(const TArray< int32 >& In0, FVector& Out1, FString& Out2);
+	/** Benchmark callable node Lib004_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn062(const FVector& In0, FString& Out1, bool In2, int32 In3, UObject* In4, FString& Out5);
+	/** Benchmark callable node Lib004_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn063(FString& Out0);
+	/** Benchmark callable node Lib004_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn064(const FTransform& In0, const FVector& In1);
+	/** Benchmark latent node Lib004_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn065(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib004_Fn066 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, const FString& In2, const FString& In3, const FTransform& In4, UObject* In5, float In6, FName In7);
+	/** Benchmark callable node Lib004_Fn067 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn067(const TArray< int32 >& In0, int32 In1, const FVector& In2);
+	/** Benchmark latent node Lib004_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FString& In1, FString& Out2);
+	/** Benchmark latent node Lib004_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, bool In1, bool In2, FString& Out3);
+	/** Benchmark pure node Lib004_Fn070 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn070(FVector& Out0);
+	/** Benchmark callable node Lib004_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn071(FString& Out0);
+	/** Benchmark callable node Lib004_Fn072 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn072(bool In0);
+	/** Benchmark pure node Lib004_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn073(int32& Out0);
+	/** Benchmark callable node Lib004_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn074(const FVector& In0);
+	/** Benchmark callable node Lib004_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static bool Lib004_Fn075(const TArray< int32 >& In0, bool In1, FString& Out2, FVector& Out3, const FString& In4, bool In5, const FVector& In6, int32& Out7);
+	/** Benchmark pure node Lib004_Fn076 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn076(UObject* In0);
+	/** Benchmark callable node Lib004_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn077(const FTransform& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib004_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn078(float In0, FVector& Out1, bool In2, int32& Out3);
+	/** Benchmark latent node Lib004_Fn079 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1);
+	/** Benchmark callable node Lib004_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn080(FString& Out0, float In1, int32 In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib004_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn081(float In0, const FString& In1, FName In2, FName In3, FName In4, FVector& Out5);
+	/** Benchmark callable node Lib004_Fn082 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn082(const TArray< int32 >& In0, const FVector& In1, FVector& Out2, bool In3, const FVector& In4, FName In5);
+	/** Benchmark callable node Lib004_Fn083 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static void Lib004_Fn083(float In0, const FTransform& In1, UObject* In2, bool In3, FString& Out4, bool In5, UObject* In6, const FString& In7);
+	/** Benchmark callable node Lib004_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn084(FVector& Out0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4, const FString& In5);
+	/** Benchmark callable node Lib004_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn085(int32 In0, UObject* In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, const FVector& In5, int32& Out6);
+	/** Benchmark latent node Lib004_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1, UObject* In2, FString& Out3, const FTransform& In4);
+	/** Benchmark callable node Lib004_Fn087 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn087(const FString& In0, float In1, const TArray< int32 >& In2, const FString& In3, const FTransform& In4);
+	/** Benchmark callable node Lib004_Fn088 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn088(const FTransform& In0);
+	/** Benchmark callable node Lib004_Fn089 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn089(UObject* In0, const FTransform& In1, FVector& Out2, const FVector& In3, UObject* In4, FVector& Out5, FString& Out6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib004_Fn090 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn090(const FTransform& In0, const FTransform& In1, const FTransform& In2, FName In3, FName In4, float In5, bool In6, float In7);
+	/** Benchmark callable node Lib004_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FVector Lib004_Fn091(int32& Out0, FVector& Out1, FName In2, FVector& Out3);
+	/** Benchmark callable node Lib004_Fn092 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static FString Lib004_Fn092(FName In0, const TArray< int32 >& In1, FName In2, const FString& In3, bool In4, UObject* In5, FString& Out6, const FString& In7);
+	/** Benchmark pure node Lib004_Fn093 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn093(int32& Out0, const FString& In1, bool In2);
+	/** Benchmark pure node Lib004_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn094(float In0);
+	/** Benchmark callable node Lib004_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static float Lib004_Fn095(FName In0, const TArray< int32 >& In1, float In2);
+	/** Benchmark latent node Lib004_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib004_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib004_Fn097 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn097();
+	/** Benchmark pure node Lib004_Fn098 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib004")
+	static int32 Lib004_Fn098(UObject* In0);
+	/** Benchmark callable node Lib004_Fn099 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib004")
+	static void Lib004_Fn099(FName In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3, FString& Out4, FString& Out5, const TArray< int32 >& In6, int32 In7);
+};
+
+
+UCLASS()
+class UKDGBenchLib_005 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib005_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn000(const FString& In0);
+	/** Benchmark pure node Lib005_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn001(bool In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib005_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn002(UObject* In0, int32 In1, int32& Out2, float In3, FString& Out4, FString& Out5, float In6, int32& Out7);
+	/** Benchmark callable node Lib005_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn003(FString& Out0, FName In1, UObject* In2, FName In3, const FString& In4, int32& Out5, bool In6);
+	/** Benchmark pure node Lib005_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn004(const FTransform& In0);
+	/** Benchmark pure node Lib005_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn005();
+	/** Benchmark callable node Lib005_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn006(const FVector& In0, const FString& In1);
+	/** Benchmark callable node Lib005_Fn007 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn007(const FVector& In0);
+	/** Benchmark callable node Lib005_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn008();
+	/** Benchmark pure node Lib005_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn009(FName In0, const TArray< int32 >& In1, UObject* In2, FVector& Out3);
+	/** Benchmark callable node Lib005_Fn010 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn010(int32& Out0, const FString& In1, FVector& Out2, int32 In3, FName In4, FVector& Out5, int32& Out6, int32 In7);
+	/** Benchmark pure node Lib005_Fn011 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn011(const FString& In0, FString& Out1, float In2, const FVector& In3, const FTransform& In4);
+	/** Benchmark callable node Lib005_Fn012 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static void Lib005_Fn012(bool In0, UObject* In1, UObject* In2, int32& Out3);
+	/** Benchmark callable node Lib005_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn013(float In0, FName In1, const FVector& In2);
+	/** Benchmark latent node Lib005_Fn014 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, bool In2, const TArray< int32 >& In3, UObject* In4, bool In5, float In6);
+	/** Benchmark latent node Lib005_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, UObject* In1, float In2, FString& Out3, FString& Out4, int32& Out5);
+	/** Benchmark callable node Lib005_Fn016 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn016(const TArray< int32 >& In0, UObject* In1, int32& Out2, bool In3);
+	/** Benchmark callable node Lib005_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn017(UObject* In0, const FString& In1, FName In2, bool In3);
+	/** Benchmark pure node Lib005_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn018(const FTransform& In0, const FVector& In1, UObject* In2, const FString& In3, bool In4, FName In5);
+	/** Benchmark callable node Lib005_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn019(FString& Out0, const FString& In1);
+	/** Benchmark callable node Lib005_Fn020 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn020(FName In0, int32& Out1, float In2, UObject* In3, const TArray< int32 >& In4);
+	/** Benchmark latent node Lib005_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1);
+	/** Benchmark pure node Lib005_Fn022 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn022(FString& Out0, FName In1, UObject* In2, const TArray< int32 >& In3, FName In4);
+	/** Benchmark callable node Lib005_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn023(FName In0, int32 In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib005_Fn024 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn024(int32& Out0, const TArray< int32 >& In1, FVector& Out2);
+	/** Benchmark callable node Lib005_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn025(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib005_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn026(const FString& In0, int32 In1);
+	/** Benchmark callable node Lib005_Fn027 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn027();
+	/** Benchmark pure node Lib005_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn028(FString& Out0, const FTransform& In1, FName In2, int32& Out3);
+	/** Benchmark callable node Lib005_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn029(bool In0);
+	/** Benchmark callable node Lib005_Fn030 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn030();
+	/** Benchmark callable node Lib005_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn031(int32 In0);
+	/** Benchmark pure node Lib005_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn032();
+	/** Benchmark callable node Lib005_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn033(FVector& Out0, float In1, FName In2, int32 In3, const FVector& In4);
+	/** Benchmark pure node Lib005_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn034(FVector& Out0, FString& Out1, const FTransform& In2, bool In3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib005_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn035(const FString& In0, UObject* In1, int32 In2, bool In3, UObject* In4, FString& Out5);
+	/** Benchmark pure node Lib005_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn036(FString& Out0, FString& Out1, int32 In2, const FTransform& In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib005_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn037(UObject* In0, UObject* In1, bool In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib005_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static void Lib005_Fn038(bool In0, int32 In1, FVector& Out2, int32& Out3, FString& Out4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark callable node Lib005_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn039(UObject* In0, bool In1, const FString& In2, FVector& Out3, float In4, FVector& Out5, const FString& In6);
+	/** Benchmark callable node Lib005_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn040(float In0, FString& Out1, const FString& In2, float In3);
+	/** Benchmark pure node Lib005_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn041(FVector& Out0, const TArray< int32 >& In1, float In2);
+	/** Benchmark latent node Lib005_Fn042 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FVector& In1, int32 In2, const TArray< int32 >& In3, const FTransform& In4, const FString& In5, FString& Out6);
+	/** Benchmark callable node Lib005_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn043(FString& Out0, const TArray< int32 >& In1, FVector& Out2, const FVector& In3, int32 In4, bool In5);
+	/** Benchmark callable node Lib005_Fn044 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn044(const FTransform& In0, const FString& In1);
+	/** Benchmark callable node Lib005_Fn045 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn045(FName In0, bool In1, UObject* In2, FVector& Out3);
+	/** Benchmark callable node Lib005_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn046(float In0, const FTransform& In1);
+	/** Benchmark callable node Lib005_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn047(const FString& In0, float In1, UObject* In2, FString& Out3, FString& Out4);
+	/** Benchmark callable node Lib005_Fn048 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn048(const FString& In0, float In1, UObject* In2, FName In3, FName In4, int32& Out5);
+	/** Benchmark callable node Lib005_Fn049 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn049(FString& Out0);
+	/** Benchmark callable node Lib005_Fn050 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn050(const FString& In0, const TArray< int32 >& In1, UObject* In2, FName In3, int32& Out4, FName In5, FString& Out6);
+	/** Benchmark pure node Lib005_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn051(FName In0, FName In1, FString& Out2, const FVector& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib005_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn052(bool In0, float In1, const FVector& In2, FName In3, const FString& In4, int32 In5, FVector& Out6);
+	/** Benchmark pure node Lib005_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn053();
+	/** Benchmark callable node Lib005_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn054(const FTransform& In0, const TArray< int32 >& In1, const FString& In2, const TArray< int32 >& In3, FVector& Out4, const FTransform& In5, const FVector& In6, int32& Out7);
+	/** Benchmark callable node Lib005_Fn055 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn055(const FVector& In0, float In1, UObject* In2, FName In3, bool In4, bool In5);
+	/** Benchmark callable node Lib005_Fn056 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn056(bool In0);
+	/** Benchmark pure node Lib005_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn057(UObject* In0, const FTransform& In1, bool In2, const FString& In3, FString& Out4, FVector& Out5, FVector& Out6);
+	/** Benchmark callable node Lib005_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn058(UObject* In0, FName In1);
+	/** Benchmark callable node Lib005_Fn059 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn059(const FVector& In0, FString& Out1, const TArray< int32 >& In2, const FString& In3, int32& Out4, FString& Out5, UObject* In6);
+	/** Benchmark callable node Lib005_Fn060 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn060(const FTransform& In0, int32 In1, const FTransform& In2, FVector& Out3, const FString& In4, int32& Out5, FName In6);
+	/** Benchmark pure node Lib005_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn061(const FTransform& In0, FString& Out1, int32& Out2, FString& Out3, const FVector& In4, int32 In5, FName In6);
+	/** Benchmark callable node Lib005_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn062(int32 In0, FString& Out1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib005_Fn063 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn063(FVector& Out0, UObject* In1, bool In2, const FVector& In3, int32 In4, const FVector& In5);
+	/** Benchmark callable node Lib005_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn064(const FString& In0, const FVector& In1, FString& Out2, FName In3);
+	/** Benchmark pure node Lib005_Fn065 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn065(const FString& In0, FString& Out1, const FVector& In2, float In3, float In4, UObject* In5, int32& Out6);
+	/** Benchmark callable node Lib005_Fn066 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn066(FVector& Out0, bool In1);
+	/** Benchmark callable node Lib005_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn067(const FString& In0, const FTransform& In1);
+	/** Benchmark pure node Lib005_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn068(const FTransform& In0, float In1, bool In2);
+	/** Benchmark callable node Lib005_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static void Lib005_Fn069(FName In0);
+	/** Benchmark latent node Lib005_Fn070 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FString& Out1, UObject* In2, FVector& Out3, const FTransform& In4, UObject* In5, FVector& Out6);
+	/** Benchmark callable node Lib005_Fn071 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn071(int32 In0, float In1, const FString& In2, FVector& Out3, const FVector& In4, int32& Out5, FString& Out6);
+	/** Benchmark latent node Lib005_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1, int32& Out2, const FTransform& In3);
+	/** Benchmark latent node Lib005_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FString& Out1, float In2, const FTransform& In3, FName In4, int32 In5);
+	/** Benchmark pure node Lib005_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn074(float In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib005_Fn075 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn075();
+	/** Benchmark callable node Lib005_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn076(const FTransform& In0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark callable node Lib005_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn077(FString& Out0);
+	/** Benchmark callable node Lib005_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn078();
+	/** Benchmark pure node Lib005_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn079(const TArray< int32 >& In0, float In1);
+	/** Benchmark pure node Lib005_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn080(const TArray< int32 >& In0, const FString& In1, FString& Out2);
+	/** Benchmark callable node Lib005_Fn081 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static void Lib005_Fn081(int32 In0);
+	/** Benchmark callable node Lib005_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static void Lib005_Fn082(const FTransform& In0, const FString& In1, const FString& In2);
+	/** Benchmark callable node Lib005_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn083(const FVector& In0, const FTransform& In1);
+	/** Benchmark latent node Lib005_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, FName In2, int32& Out3);
+	/** Benchmark pure node Lib005_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn085(const TArray< int32 >& In0, const FTransform& In1, int32 In2);
+	/** Benchmark latent node Lib005_Fn086 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FVector& In1, const TArray< int32 >& In2, const FString& In3, UObject* In4, const FString& In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib005_Fn087 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static void Lib005_Fn087(FName In0, UObject* In1, const FVector& In2, FVector& Out3, const FTransform& In4, int32& Out5);
+	/** Benchmark pure node Lib005_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static bool Lib005_Fn088();
+	/** Benchmark pure node Lib005_Fn089 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn089(float In0, FString& Out1, const TArray< int32 >& In2, FVector& Out3, const TArray< int32 >& In4, FString& Out5, const FString& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib005_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static void Lib005_Fn090(FVector& Out0);
+	/** Benchmark pure node Lib005_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn091(const FString& In0, FString& Out1, UObject* In2, FString& Out3, UObject* In4, int32& Out5);
+	/** Benchmark callable node Lib005_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FVector Lib005_Fn092(FName In0, const FString& In1, FName In2, float In3);
+	/** Benchmark latent node Lib005_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib005_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, bool In1, const FString& In2, int32 In3);
+	/** Benchmark pure node Lib005_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn094(FVector& Out0);
+	/** Benchmark callable node Lib005_Fn095 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn095(bool In0);
+	/** Benchmark callable node Lib005_Fn096 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static float Lib005_Fn096(FVector& Out0, UObject* In1, FVector& Out2, FVector& Out3, const FVector& In4, const FVector& In5, bool In6);
+	/** Benchmark pure node Lib005_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn097(const FVector& In0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib005_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static int32 Lib005_Fn098(float In0, int32 In1, UObject* In2, const FTransform& In3, int32& Out4, UObject* In5);
+	/** Benchmark callable node Lib005_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib005")
+	static FString Lib005_Fn099(float In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_006 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib006_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, float In2, const FVector& In3);
+	/** Benchmark callable node Lib006_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn001(int32 In0, int32& Out1, UObject* In2, float In3);
+	/** Benchmark callable node Lib006_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn002(UObject* In0, FName In1, const FTransform& In2, const FString& In3, const FVector& In4, const FString& In5);
+	/** Benchmark callable node Lib006_Fn003 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn003();
+	/** Benchmark callable node Lib006_Fn004 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn004(int32& Out0, float In1, bool In2, FName In3);
+	/** Benchmark pure node Lib006_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn005();
+	/** Benchmark callable node Lib006_Fn006 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn006(FVector& Out0, const TArray< int32 >& In1, int32& Out2, const TArray< int32 >& In3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib006_Fn007 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn007(bool In0);
+	/** Benchmark pure node Lib006_Fn008 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn008(int32 In0, FString& Out1, FName In2, const FTransform& In3);
+	/** Benchmark callable node Lib006_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn009(const FString& In0, int32& Out1, int32 In2, FName In3, UObject* In4, const FTransform& In5, const FString& In6, int32& Out7);
+	/** Benchmark callable node Lib006_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn010();
+	/** Benchmark pure node Lib006_Fn011 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn011(float In0, UObject* In1, FVector& Out2, int32& Out3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib006_Fn012 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn012(float In0, UObject* In1);
+	/** Benchmark callable node Lib006_Fn013 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn013(const FTransform& In0, const FVector& In1, UObject* In2, int32& Out3, UObject* In4, const FVector& In5, const FTransform& In6, bool In7);
+	/** Benchmark callable node Lib006_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn014(int32& Out0, const FVector& In1, FName In2, int32& Out3);
+	/** Benchmark latent node Lib006_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib006_Fn016 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn016(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib006_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn017(float In0);
+	/** Benchmark pure node Lib006_Fn018 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn018(bool In0, const FString& In1, float In2);
+	/** Benchmark callable node Lib006_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn019(int32 In0, const TArray< int32 >& In1, FVector& Out2, int32 In3, const FString& In4, float In5);
+	/** Benchmark callable node Lib006_Fn020 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn020(FVector& Out0, FVector& Out1, int32 In2, FName In3);
+	/** Benchmark callable node Lib006_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn021(FName In0, UObject* In1, bool In2, float In3, const FVector& In4, bool In5, const FVector& In6, const FString& In7);
+	/** Benchmark latent node Lib006_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn022(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1);
+	/** Benchmark callable node Lib006_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn023(int32& Out0, float In1, bool In2, float In3, FString& Out4);
+	/** Benchmark callable node Lib006_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn024(float In0);
+	/** Benchmark pure node Lib006_Fn025 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn025(int32 In0, FVector& Out1, int32& Out2, const TArray< int32 >& In3, FVector& Out4, int32& Out5, FString& Out6);
+	/** Benchmark callable node Lib006_Fn026 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn026(float In0, FVector& Out1, const FTransform& In2, const FVector& In3, UObject* In4, bool In5, int32& Out6);
+	/** Benchmark callable node Lib006_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn027(FName In0, const FString& In1);
+	/** Benchmark callable node Lib006_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn028(int32 In0, FVector& Out1);
+	/** Benchmark callable node Lib006_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn029(const FVector& In0, FVector& Out1, UObject* In2, bool In3, int32 In4);
+	/** Benchmark callable node Lib006_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn030(UObject* In0, int32& Out1, FVector& Out2, const FVector& In3, bool In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib006_Fn031 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn031();
+	/** Benchmark callable node Lib006_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn032();
+	/** Benchmark callable node Lib006_Fn033 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn033(const TArray< int32 >& In0, int32& Out1);
+	/** Benchmark callable node Lib006_Fn034 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn034(FName In0, const FString& In1, bool In2);
+	/** Benchmark callable node Lib006_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn035(FString& Out0, bool In1, FString& Out2);
+	/** Benchmark latent node Lib006_Fn036 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1);
+	/** Benchmark pure node Lib006_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn037(bool In0, const TArray< int32 >& In1, bool In2, int32& Out3);
+	/** Benchmark callable node Lib006_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn038(int32 In0, const TArray< int32 >& In1, const FTransform& In2, FString& Out3);
+	/** Benchmark callable node Lib006_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn039(FString& Out0, FString& Out1);
+	/** Benchmark callable node Lib006_Fn040 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn040(const FTransform& In0, int32 In1);
+	/** Benchmark callable node Lib006_Fn041 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn041();
+	/** Benchmark pure node Lib006_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn042();
+	/** Benchmark callable node Lib006_Fn043 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn043(int32 In0, const FVector& In1, float In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib006_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn044(FVector& Out0, const FVector& In1, int32& Out2);
+	/** Benchmark pure node Lib006_Fn045 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn045();
+	/** Benchmark latent node Lib006_Fn046 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32 In1, FVector& Out2, const FVector& In3);
+	/** Benchmark callable node Lib006_Fn047 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn047(int32& Out0, float In1, bool In2, UObject* In3, int32& Out4, const TArray< int32 >& In5, FString& Out6, FName In7);
+	/** Benchmark callable node Lib006_Fn048 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn048(const FTransform& In0, const FVector& In1, float In2);
+	/** Benchmark callable node Lib006_Fn049 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn049();
+	/** Benchmark latent node Lib006_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1, FVector& Out2, int32 In3);
+	/** Benchmark pure node Lib006_Fn051 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn051(int32 In0, FString& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib006_Fn052 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn052(int32& Out0, FName In1, const FString& In2, bool In3, const FTransform& In4, float In5, FVector& Out6, FName In7);
+	/** Benchmark callable node Lib006_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn053(FVector& Out0, const FTransform& In1, FString& Out2);
+	/** Benchmark pure node Lib006_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn054(const FTransform& In0);
+	/** Benchmark callable node Lib006_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn055(const FTransform& In0, const FString& In1);
+	/** Benchmark pure node Lib006_Fn056 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn056(const FString& In0, const FTransform& In1, int32 In2, int32 In3, const FVector& In4, const FVector& In5, const FString& In6);
+	/** Benchmark pure node Lib006_Fn057 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn057(FName In0, float In1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib006_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn058(const FString& In0, int32& Out1, bool In2, bool In3, FString& Out4, const FVector& In5, UObject* In6, FName In7);
+	/** Benchmark callable node Lib006_Fn059 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn059(const FString& In0, const FString& In1);
+	/** Benchmark latent node Lib006_Fn060 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32 In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib006_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn061(const FString& In0, const TArray< int32 >& In1, UObject* In2, const FVector& In3, int32& Out4, float In5);
+	/** Benchmark pure node Lib006_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn062(float In0, float In1, int32 In2, int32 In3);
+	/** Benchmark callable node Lib006_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn063(FVector& Out0, FVector& Out1, FString& Out2, const FString& In3, bool In4);
+	/** Benchmark callable node Lib006_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn064();
+	/** Benchmark callable node Lib006_Fn065 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn065(int32& Out0, const FString& In1, const TArray< int32 >& In2, int32& Out3, int32 In4);
+	/** Benchmark callable node Lib006_Fn066 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn066(FVector& Out0, UObject* In1, bool In2);
+	/** Benchmark callable node Lib006_Fn067 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn067(FVector& Out0, FName In1, const TArray< int32 >& In2, const FVector& In3, const FString& In4, UObject* In5, FVector& Out6, const FString& In7);
+	/** Benchmark pure node Lib006_Fn068 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn068(const FVector& In0, bool In1, const FVector& In2, UObject* In3, const TArray< int32 >& In4, FString& Out5, FName In6, int32 In7);
+	/** Benchmark pure node Lib006_Fn069 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn069();
+	/** Benchmark callable node Lib006_Fn070 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn070();
+	/** Benchmark callable node Lib006_Fn071 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn071(FString& Out0, UObject* In1, const TArray< int32 >& In2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib006_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn072();
+	/** Benchmark pure node Lib006_Fn073 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn073(int32 In0, const FTransform& In1, const FVector& In2, float In3, UObject* In4, float In5, int32 In6);
+	/** Benchmark pure node Lib006_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn074(int32& Out0, FString& Out1, const FTransform& In2, UObject* In3, const FTransform& In4, FName In5, const FTransform& In6, FName In7);
+	/** Benchmark pure node Lib006_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn075(FName In0, int32& Out1);
+	/** Benchmark pure node Lib006_Fn076 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn076(float In0, FString& Out1, UObject* In2, int32& Out3, const TArray< int32 >& In4, UObject* In5, const FVector& In6, const FString& In7);
+	/** Benchmark callable node Lib006_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn077(int32& Out0);
+	/** Benchmark pure node Lib006_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn078();
+	/** Benchmark callable node Lib006_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn079(FString& Out0, float In1, FName In2);
+	/** Benchmark callable node Lib006_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn080(FString& Out0, UObject* In1, FName In2, bool In3);
+	/** Benchmark pure node Lib006_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn081(bool In0, int32& Out1, int32 In2, float In3, const FString& In4, const FVector& In5);
+	/** Benchmark callable node Lib006_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static void Lib006_Fn082(const FTransform& In0, int32 In1, float In2, bool In3, const FTransform& In4);
+	/** Benchmark pure node Lib006_Fn083 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn083(FString& Out0, FVector& Out1, float In2, const FVector& In3);
+	/** Benchmark pure node Lib006_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn084(float In0, int32& Out1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib006_Fn085 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn085(bool In0, int32& Out1);
+	/** Benchmark callable node Lib006_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn086(const FVector& In0, UObject* In1);
+	/** Benchmark pure node Lib006_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn087(const TArray< int32 >& In0, UObject* In1);
+	/** Benchmark pure node Lib006_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static int32 Lib006_Fn088(FString& Out0, const FVector& In1, float In2);
+	/** Benchmark latent node Lib006_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32& Out1);
+	/** Benchmark callable node Lib006_Fn090 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn090(int32 In0, const TArray< int32 >& In1, FVector& Out2, bool In3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib006_Fn091 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static bool Lib006_Fn091(const FTransform& In0, bool In1, int32& Out2, const FString& In3, UObject* In4, int32 In5, FString& Out6, const FTransform& In7);
+	/** Benchmark pure node Lib006_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn092(FVector& Out0);
+	/** Benchmark callable node Lib006_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn093(const FString& In0, int32 In1);
+	/** Benchmark callable node Lib006_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn094(const FTransform& In0, FString& Out1);
+	/** Benchmark callable node Lib006_Fn095 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006")
+	static FString Lib006_Fn095(int32 In0, const FVector& In1);
+	/** Benchmark pure node Lib006_Fn096 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static float Lib006_Fn096(int32 In0, const FString& In1, FString& Out2, FString& Out3);
+	/** Benchmark pure node Lib006_Fn097 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib006")
+	static FVector Lib006_Fn097(const FTransform& In0, int32 In1, FVector& Out2, const TArray< int32 >& In3, int32& Out4);
+	/** Benchmark latent node Lib006_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark latent node Lib006_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib006", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib006_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FString& In1, bool In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_007 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib007_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn000(FVector& Out0, FName In1, const FTransform& In2, float In3, const FString& In4);
+	/** Benchmark latent node Lib007_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, float In1, int32 In2, FString& Out3, const TArray< int32 >& In4, const FString& In5);
+	/** Benchmark callable node Lib007_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static void Lib007_Fn002(const TArray< int32 >& In0, const FVector& In1);
+	/** Benchmark callable node Lib007_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn003(const TArray< int32 >& In0, bool In1, float In2, int32 In3, bool In4);
+	/** Benchmark callable node Lib007_Fn004 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn004(int32& Out0, FString& Out1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib007_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static void Lib007_Fn005(bool In0, int32 In1, FString& Out2, const TArray< int32 >& In3, float In4, float In5, bool In6, const FTransform& In7);
+	/** Benchmark callable node Lib007_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn006(int32 In0, const FTransform& In1, FString& Out2);
+	/** Benchmark pure node Lib007_Fn007 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn007();
+	/** Benchmark callable node Lib007_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn008(const FVector& In0, int32& Out1, FName In2, const TArray< int32 >& In3, const TArray< int32 >& In4, int32 In5);
+	/** Benchmark pure node Lib007_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn009(FName In0, FString& Out1, int32 In2, UObject* In3, const FTransform& In4, const FTransform& In5);
+	/** Benchmark pure node Lib007_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn010(bool In0, FVector& Out1, bool In2, int32 In3, float In4, const TArray< int32 >& In5, float In6);
+	/** Benchmark latent node Lib007_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FTransform& In1, FVector& Out2, int32& Out3, FVector& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib007_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn012(int32& Out0, FName In1, const FVector& In2);
+	/** Benchmark callable node Lib007_Fn013 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static void Lib007_Fn013(UObject* In0, bool In1, const TArray< int32 >& In2, const FTransform& In3, const FString& In4, FString& Out5, const FString& In6, const FString& In7);
+	/** Benchmark pure node Lib007_Fn014 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn014(float In0, FString& Out1);
+	/** Benchmark callable node Lib007_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn015(int32 In0);
+	/** Benchmark callable node Lib007_Fn016 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn016(bool In0, const TArray< int32 >& In1, const FVector& In2, int32 In3, FVector& Out4, const TArray< int32 >& In5, float In6);
+	/** Benchmark callable node Lib007_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn017(FName In0);
+	/** Benchmark latent node Lib007_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1, FName In2, const FTransform& In3);
+	/** Benchmark callable node Lib007_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn019(const FString& In0, const FTransform& In1);
+	/** Benchmark pure node Lib007_Fn020 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn020(const FTransform& In0, int32 In1, const FTransform& In2);
+	/** Benchmark callable node Lib007_Fn021 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn021(bool In0);
+	/** Benchmark callable node Lib007_Fn022 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn022();
+	/** Benchmark pure node Lib007_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn023(FName In0);
+	/** Benchmark callable node Lib007_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn024(const FVector& In0, int32 In1, FName In2, const FVector& In3, const FVector& In4, bool In5, const FString& In6);
+	/** Benchmark latent node Lib007_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, float In1, const FString& In2, const TArray< int32 >& In3, FName In4, const FVector& In5);
+	/** Benchmark pure node Lib007_Fn026 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn026(int32 In0, const TArray< int32 >& In1, int32 In2, FString& Out3, bool In4, int32& Out5, int32 In6);
+	/** Benchmark pure node Lib007_Fn027 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn027(const FVector& In0, int32 In1, float In2, FName In3, bool In4, UObject* In5);
+	/** Benchmark pure node Lib007_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn028(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib007_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn029();
+	/** Benchmark latent node Lib007_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark callable node Lib007_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn031(int32& Out0, int32& Out1, const FString& In2, bool In3, FVector& Out4);
+	/** Benchmark latent node Lib007_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, UObject* In1, bool In2, const FVector& In3, FName In4, UObject* In5);
+	/** Benchmark pure node Lib007_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn033(const FVector& In0, const FVector& In1, FString& Out2, const FString& In3, FVector& Out4, int32 In5);
+	/** Benchmark callable node Lib007_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn034(int32 In0, const FTransform& In1, int32 In2, float In3, const FVector& In4, const FString& In5, int32& Out6);
+	/** Benchmark callable node Lib007_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn035(FVector& Out0, int32& Out1, const FVector& In2, const FVector& In3, FString& Out4, const TArray< int32 >& In5, const FTransform& In6, FVector& Out7);
+	/** Benchmark callable node Lib007_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn036(const FVector& In0, const FString& In1, const FTransform& In2, FString& Out3, float In4, bool In5);
+	/** Benchmark callable node Lib007_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn037();
+	/** Benchmark callable node Lib007_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn038(FName In0, bool In1, FVector& Out2, int32 In3);
+	/** Benchmark callable node Lib007_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn039(const FTransform& In0, FName In1, const TArray< int32 >& In2, const FString& In3, float In4, float In5, const FString& In6, const FVector& In7);
+	/** Benchmark latent node Lib007_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, UObject* In1);
+	/** Benchmark pure node Lib007_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn041(FString& Out0, float In1, const FString& In2, int32 In3, bool In4);
+	/** Benchmark pure node Lib007_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn042(int32& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib007_Fn043 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn043(const FTransform& In0, int32 In1);
+	/** Benchmark callable node Lib007_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn044();
+	/** Benchmark pure node Lib007_Fn045 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn045(bool In0, FName In1, int32& Out2, FString& Out3, const FTransform& In4, FVector& Out5, FVector& Out6);
+	/** Benchmark callable node Lib007_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn046(FString& Out0);
+	/** Benchmark pure node Lib007_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn047(FName In0, const TArray< int32 >& In1);
+	/** Benchmark latent node Lib007_Fn048 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn048(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, int32 In1, const FTransform& In2, const TArray< int32 >& In3, const FString& In4, const FVector& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib007_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static void Lib007_Fn049(const TArray< int32 >& In0, FName In1);
+	/** Benchmark pure node Lib007_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn050(int32& Out0);
+	/** Benchmark callable node Lib007_Fn051 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn051(const FTransform& In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib007_Fn052 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn052(const FTransform& In0);
+	/** Benchmark pure node Lib007_Fn053 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn053(FString& Out0, float In1, FVector& Out2, FName In3, bool In4, const FTransform& In5, FVector& Out6);
+	/** Benchmark callable node Lib007_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn054(UObject* In0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, bool In4, const FTransform& In5, FVector& Out6);
+	/** Benchmark pure node Lib007_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn055(FName In0, FVector& Out1);
+	/** Benchmark callable node Lib007_Fn056 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static void Lib007_Fn056(float In0, int32 In1, const FVector& In2, FString& Out3, int32 In4);
+	/** Benchmark callable node Lib007_Fn057 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn057(FString& Out0, int32& Out1, const TArray< int32 >& In2, const FVector& In3);
+	/** Benchmark callable node Lib007_Fn058 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn058(FVector& Out0);
+	/** Benchmark callable node Lib007_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn059(FName In0, UObject* In1, const FString& In2);
+	/** Benchmark callable node Lib007_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn060();
+	/** Benchmark pure node Lib007_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn061(FVector& Out0, const TArray< int32 >& In1, const FVector& In2, float In3);
+	/** Benchmark latent node Lib007_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib007_Fn063 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn063(const FVector& In0, int32 In1, const FTransform& In2, FString& Out3, const FTransform& In4, FVector& Out5, FName In6, UObject* In7);
+	/** Benchmark pure node Lib007_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn064(FString& Out0, int32 In1, FVector& Out2, bool In3);
+	/** Benchmark callable node Lib007_Fn065 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn065(FName In0, FString& Out1, const TArray< int32 >& In2, int32 In3, UObject* In4, bool In5, UObject* In6);
+	/** Benchmark callable node Lib007_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn066(bool In0, const FString& In1, FName In2, FVector& Out3);
+	/** Benchmark pure node Lib007_Fn067 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn067(const TArray< int32 >& In0, FString& Out1, const FString& In2);
+	/** Benchmark pure node Lib007_Fn068 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn068(FString& Out0, const FVector& In1, const FTransform& In2, int32& Out3);
+	/** Benchmark pure node Lib007_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn069(FVector& Out0);
+	/** Benchmark callable node Lib007_Fn070 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn070(FVector& Out0, int32& Out1, const FString& In2, FName In3, FName In4);
+	/** Benchmark latent node Lib007_Fn071 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib007_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FTransform& In1, const FTransform& In2, FVector& Out3, const FTransform& In4, int32 In5, int32 In6, float In7);
+	/** Benchmark pure node Lib007_Fn072 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn072(const TArray< int32 >& In0, const TArray< int32 >& In1, float In2, FString& Out3, int32 In4, const FVector& In5, const FTransform& In6, const FTransform& In7);
+	/** Benchmark callable node Lib007_Fn073 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn073(UObject* In0, float In1);
+	/** Benchmark pure node Lib007_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn074(const FVector& In0, FVector& Out1);
+	/** Benchmark pure node Lib007_Fn075 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn075(float In0, float In1, FVector& Out2, const TArray< int32 >& In3, const FTransform& In4, float In5);
+	/** Benchmark callable node Lib007_Fn076 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn076(int32 In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, FString& Out4, int32& Out5);
+	/** Benchmark callable node Lib007_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn077();
+	/** Benchmark callable node Lib007_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn078(const FVector& In0, FString& Out1, const TArray< int32 >& In2, bool In3);
+	/** Benchmark pure node Lib007_Fn079 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn079(bool In0, int32& Out1, FVector& Out2, const TArray< int32 >& In3, int32& Out4, float In5, const FVector& In6);
+	/** Benchmark pure node Lib007_Fn080 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn080(const TArray< int32 >& In0, FString& Out1, const FString& In2, const FString& In3, int32& Out4, int32 In5, FString& Out6, const FTransform& In7);
+	/** Benchmark callable node Lib007_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn081(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, int32 In3, const FTransform& In4, const FVector& In5, FName In6);
+	/** Benchmark callable node Lib007_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn082(const FTransform& In0, const TArray< int32 >& In1, const FVector& In2, FVector& Out3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib007_Fn083 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static void Lib007_Fn083(float In0, FVector& Out1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib007_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn084(FVector& Out0, const FVector& In1, FName In2, const FString& In3, FName In4);
+	/** Benchmark pure node Lib007_Fn085 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn085(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib007_Fn086 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn086(const FVector& In0, FName In1, float In2);
+	/** Benchmark pure node Lib007_Fn087 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn087(FString& Out0, UObject* In1, bool In2, int32 In3, const FVector& In4);
+	/** Benchmark callable node Lib007_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn088(bool In0, bool In1, int32 In2, bool In3, UObject* In4, FVector& Out5, FVector& Out6, bool In7);
+	/** Benchmark callable node Lib007_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn089(FVector& Out0, bool In1, FVector& Out2, const TArray< int32 >& In3, float In4, FString& Out5);
+	/** Benchmark callable node Lib007_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn090(FName In0, const FVector& In1, const TArray< int32 >& In2, float In3, int32 In4, const FTransform& In5, const FVector& In6);
+	/** Benchmark pure node Lib007_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn091(int32 In0, UObject* In1, bool In2, int32& Out3, FVector& Out4, FString& Out5);
+	/** Benchmark callable node Lib007_Fn092 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FVector Lib007_Fn092(FVector& Out0, bool In1);
+	/** Benchmark pure node Lib007_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn093(const TArray< int32 >& In0, bool In1, int32 In2, const FVector& In3, UObject* In4, FVector& Out5, const FVector& In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib007_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static bool Lib007_Fn094(const FVector& In0, const FTransform& In1, FName In2, FName In3, const TArray< int32 >& In4, int32 In5, const FString& In6, FName In7);
+	/** Benchmark callable node Lib007_Fn095 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn095(float In0, const TArray< int32 >& In1, const FVector& In2, const FVector& In3, const FVector& In4, UObject* In5, const FString& In6);
+	/** Benchmark callable node Lib007_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn096(const FString& In0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark pure node Lib007_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib007")
+	static int32 Lib007_Fn097(const FString& In0, FVector& Out1, int32 In2, const FTransform& In3, const FTransform& In4, FName In5);
+	/** Benchmark callable node Lib007_Fn098 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static float Lib007_Fn098(float In0);
+	/** Benchmark callable node Lib007_Fn099 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib007")
+	static FString Lib007_Fn099();
+};
+
+
+UCLASS()
+class UKDGBenchLib_008 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib008_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn000(const TArray< int32 >& In0, FString& Out1, FString& Out2, const FTransform& In3, const FString& In4, const FVector& In5);
+	/** Benchmark pure node Lib008_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn001(const FTransform& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4, const FVector& In5);
+	/** Benchmark callable node Lib008_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn002(bool In0, FName In1);
+	/** Benchmark callable node Lib008_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn003(const TArray< int32 >& In0);
+	/** Benchmark latent node Lib008_Fn004 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib008_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, float In1, UObject* In2);
+	/** Benchmark pure node Lib008_Fn005 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn005(FVector& Out0, int32 In1, FName In2);
+	/** Benchmark pure node Lib008_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn006(bool In0, float In1, int32& Out2);
+	/** Benchmark pure node Lib008_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn007(FVector& Out0, FName In1, const FVector& In2, FVector& Out3, const FVector& In4);
+	/** Benchmark callable node Lib008_Fn008 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn008(FString& Out0);
+	/** Benchmark pure node Lib008_Fn009 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn009();
+	/** Benchmark callable node Lib008_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn010(const FVector& In0, FString& Out1, float In2, FName In3, bool In4);
+	/** Benchmark pure node Lib008_Fn011 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn011(FString& Out0, const FVector& In1, const TArray< int32 >& In2, FVector& Out3, int32 In4);
+	/** Benchmark callable node Lib008_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn012(int32 In0);
+	/** Benchmark pure node Lib008_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn013(FName In0, FVector& Out1);
+	/** Benchmark callable node Lib008_Fn014 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn014(const TArray< int32 >& In0, const FVector& In1, bool In2, int32& Out3, FString& Out4, int32& Out5);
+	/** Benchmark callable node Lib008_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn015(bool In0, FName In1, FString& Out2, UObject* In3);
+	/** Benchmark pure node Lib008_Fn016 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn016(FString& Out0, FName In1, int32& Out2, const FString& In3);
+	/** Benchmark pure node Lib008_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn017(const TArray< int32 >& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, float In3, const FTransform& In4, const FVector& In5, bool In6, const FTransform& In7);
+	/** Benchmark callable node Lib008_Fn018 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn018(const FVector& In0, int32& Out1);
+	/** Benchmark callable node Lib008_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn019(const TArray< int32 >& In0, const TArray< int32 >& In1, const FString& In2, float In3, float In4, const FString& In5, bool In6, FString& Out7);
+	/** Benchmark callable node Lib008_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn020(const FVector& In0, FString& Out1, bool In2, const FVector& In3, const FVector& In4, FName In5, int32& Out6, int32 In7);
+	/** Benchmark callable node Lib008_Fn021 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn021(const FString& In0, FVector& Out1, UObject* In2, FVector& Out3, int32 In4);
+	/** Benchmark callable node Lib008_Fn022 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn022(const FTransform& In0, const FString& In1);
+	/** Benchmark callable node Lib008_Fn023 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn023(const FString& In0, FName In1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib008_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn024(FVector& Out0, FName In1, const FString& In2, const FString& In3, UObject* In4, int32& Out5);
+	/** Benchmark pure node Lib008_Fn025 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn025();
+	/** Benchmark callable node Lib008_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn026(FString& Out0, bool In1, UObject* In2, const FVector& In3, bool In4, const FString& In5, const FString& In6, bool In7);
+	/** Benchmark callable node Lib008_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn027(FName In0, FVector& Out1, float In2, int32& Out3);
+	/** Benchmark callable node Lib008_Fn028 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn028();
+	/** Benchmark pure node Lib008_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn029(int32 In0, float In1, FName In2);
+	/** Benchmark latent node Lib008_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib008_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark pure node Lib008_Fn031 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn031();
+	/** Benchmark pure node Lib008_Fn032 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn032(float In0, bool In1, const TArray< int32 >& In2, FName In3, UObject* In4, float In5, int32 In6);
+	/** Benchmark pure node Lib008_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn033(const FTransform& In0, const FVector& In1, const FString& In2, int32& Out3);
+	/** Benchmark callable node Lib008_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn034(int32& Out0, FName In1, FName In2, int32 In3, FName In4, FName In5);
+	/** Benchmark callable node Lib008_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn035(const FVector& In0, FVector& Out1, int32& Out2, const FTransform& In3, FVector& Out4, FVector& Out5, int32& Out6, const FVector& In7);
+	/** Benchmark callable node Lib008_Fn036 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn036(float In0, const FVector& In1, int32& Out2, bool In3);
+	/** Benchmark pure node Lib008_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn037(const FVector& In0, float In1, int32 In2, const FTransform& In3, int32& Out4);
+	/** Benchmark pure node Lib008_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn038(float In0, const TArray< int32 >& In1, FVector& Out2, FVector& Out3, const FTransform& In4, UObject* In5);
+	/** Benchmark pure node Lib008_Fn039 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn039(FVector& Out0, FVector& Out1, int32 In2, float In3);
+	/** Benchmark pure node Lib008_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn040(const TArray< int32 >& In0, float In1, const FTransform& In2, FString& Out3, int32 In4, float In5, float In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib008_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn041(const TArray< int32 >& In0, UObject* In1, float In2, int32 In3, FVector& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark callable node Lib008_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn042(const TArray< int32 >& In0, bool In1, FName In2, FString& Out3);
+	/** Benchmark latent node Lib008_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib008_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FString& In1, const FString& In2, FName In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib008_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn044(const FVector& In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, FString& Out4, int32 In5, FVector& Out6, int32 In7);
+	/** Benchmark callable node Lib008_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn045(FString& Out0, bool In1, FName In2);
+	/** Benchmark callable node Lib008_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn046(int32& Out0, const FString& In1, const FVector& In2, int32 In3, const TArray< int32 >& In4, const TArray< int32 >& In5, bool In6);
+	/** Benchmark callable node Lib008_Fn047 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn047(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib008_Fn048 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn048(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib008_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn049(const FString& In0, FString& Out1, FString& Out2, FName In3, const FString& In4, int32 In5, FName In6);
+	/** Benchmark pure node Lib008_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn050(const FVector& In0, FVector& Out1, FVector& Out2, const TArray< int32 >& In3, int32 In4);
+	/** Benchmark pure node Lib008_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn051(bool In0, const FString& In1);
+	/** Benchmark pure node Lib008_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn052(bool In0, const FTransform& In1, int32 In2, const FString& In3, FName In4, FName In5, FName In6);
+	/** Benchmark callable node Lib008_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn053(UObject* In0, const FTransform& In1, int32 In2, int32& Out3, const FTransform& In4, FString& Out5);
+	/** Benchmark callable node Lib008_Fn054 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn054(const FTransform& In0, const FTransform& In1, UObject* In2, float In3, FVector& Out4);
+	/** Benchmark callable node Lib008_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn055(int32& Out0, const FString& In1, const FTransform& In2, UObject* In3);
+	/** Benchmark callable node Lib008_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn056(FVector& Out0, const FVector& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib008_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn057(FVector& Out0, FVector& Out1, int32 In2, int32 In3, const FTransform& In4, bool In5, UObject* In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib008_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn058(int32& Out0, const FVector& In1);
+	/** Benchmark pure node Lib008_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn059(const FString& In0, int32& Out1, bool In2);
+	/** Benchmark latent node Lib008_Fn060 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib008_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, UObject* In2, FString& Out3);
+	/** Benchmark callable node Lib008_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn061(FString& Out0, float In1, int32 In2, const FString& In3, UObject* In4, UObject* In5, FName In6);
+	/** Benchmark callable node Lib008_Fn062 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn062(FVector& Out0);
+	/** Benchmark pure node Lib008_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn063(FString& Out0, FVector& Out1);
+	/** Benchmark latent node Lib008_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib008_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark callable node Lib008_Fn065 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn065(float In0, const TArray< int32 >& In1, FString& Out2, float In3);
+	/** Benchmark callable node Lib008_Fn066 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn066(FVector& Out0, const FTransform& In1, FString& Out2, int32 In3, const FTransform& In4, int32 In5, FName In6, const FTransform& In7);
+	/** Benchmark callable node Lib008_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn067(int32& Out0, int32& Out1, float In2, const FTransform& In3, int32 In4, int32 In5);
+	/** Benchmark latent node Lib008_Fn068 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib008_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, const FTransform& In4, const FVector& In5);
+	/** Benchmark pure node Lib008_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn069(UObject* In0);
+	/** Benchmark callable node Lib008_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn070(FVector& Out0, int32 In1, int32& Out2, const FString& In3, const TArray< int32 >& In4, FName In5, const FVector& In6);
+	/** Benchmark pure node Lib008_Fn071 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn071(int32& Out0, UObject* In1, float In2, FVector& Out3, float In4, const TArray< int32 >& In5, const FVector& In6);
+	/** Benchmark pure node Lib008_Fn072 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn072(const FString& In0);
+	/** Benchmark callable node Lib008_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn073(FName In0, const TArray< int32 >& In1, float In2, int32 In3, FName In4);
+	/** Benchmark pure node Lib008_Fn074 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn074(float In0, float In1, bool In2);
+	/** Benchmark callable node Lib008_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn075(FString& Out0, const FTransform& In1);
+	/** Benchmark pure node Lib008_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn076(float In0, FName In1, const FString& In2, const FString& In3, FString& Out4, int32& Out5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib008_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn077();
+	/** Benchmark callable node Lib008_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn078(FVector& Out0, const FString& In1, FName In2, const FTransform& In3, const FTransform& In4, const FString& In5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark callable node Lib008_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static void Lib008_Fn079(const FVector& In0, const FVector& In1);
+	/** Benchmark callable node Lib008_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn080(const FString& In0, int32 In1, float In2);
+	/** Benchmark latent node Lib008_Fn081 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib008_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1, float In2, const FString& In3, const FVector& In4, int32 In5, const FVector& In6, FString& Out7);
+	/** Benchmark callable node Lib008_Fn082 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn082(int32& Out0);
+	/** Benchmark callable node Lib008_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn083();
+	/** Benchmark callable node Lib008_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn084(UObject* In0, const FVector& In1, const FTransform& In2);
+	/** Benchmark callable node Lib008_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn085(const FString& In0, const FTransform& In1, const FVector& In2, bool In3);
+	/** Benchmark callable node Lib008_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn086(float In0, const FString& In1, FName In2, const FTransform& In3);
+	/** Benchmark callable node Lib008_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn087(int32 In0, const FString& In1, const FVector& In2, const FVector& In3, const FVector& In4, FVector& Out5, const FVector& In6);
+	/** Benchmark callable node Lib008_Fn088 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn088(int32& Out0, UObject* In1);
+	/** Benchmark pure node Lib008_Fn089 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn089(UObject* In0, const FTransform& In1, bool In2, FVector& Out3, FVector& Out4, const FString& In5, bool In6);
+	/** Benchmark pure node Lib008_Fn090 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn090(const FTransform& In0, float In1, const FTransform& In2, UObject* In3, UObject* In4, bool In5, FString& Out6, UObject* In7);
+	/** Benchmark callable node Lib008_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn091(FName In0, FName In1, const FVector& In2, FName In3, const FVector& In4);
+	/** Benchmark callable node Lib008_Fn092 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FVector Lib008_Fn092(int32 In0, FString& Out1, const TArray< int32 >& In2, int32 In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib008_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn093(const FString& In0, UObject* In1);
+	/** Benchmark callable node Lib008_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static float Lib008_Fn094(const TArray< int32 >& In0, UObject* In1, const FTransform& In2, const FString& In3, float In4, FString& Out5, bool In6, float In7);
+	/** Benchmark callable node Lib008_Fn095 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn095(bool In0, const FVector& In1, const FVector& In2, UObject* In3, const FString& In4, FName In5);
+	/** Benchmark callable node Lib008_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static int32 Lib008_Fn096(int32& Out0, int32& Out1);
+	/** Benchmark pure node Lib008_Fn097 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib008")
+	static bool Lib008_Fn097();
+	/** Benchmark callable node Lib008_Fn098 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn098(FString& Out0, int32& Out1, int32& Out2, const FString& In3, float In4, FVector& Out5, UObject* In6, FVector& Out7);
+	/** Benchmark callable node Lib008_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib008")
+	static FString Lib008_Fn099(FString& Out0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_009 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib009_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn000(FName In0);
+	/** Benchmark callable node Lib009_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn001(const FTransform& In0, FString& Out1, FString& Out2, int32 In3);
+	/** Benchmark callable node Lib009_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn002(UObject* In0, FVector& Out1, int32& Out2, FString& Out3, UObject* In4, bool In5, int32& Out6, float In7);
+	/** Benchmark callable node Lib009_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn003(const FString& In0, FName In1, float In2, const TArray< int32 >& In3, FString& Out4, int32 In5, const TArray< int32 >& In6, const FTransform& In7);
+	/** Benchmark callable node Lib009_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn004(const FVector& In0, bool In1, const TArray< int32 >& In2, FName In3, const TArray< int32 >& In4, bool In5, bool In6, const FTransform& In7);
+	/** Benchmark callable node Lib009_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn005(const FTransform& In0, const FString& In1, UObject* In2, const FVector& In3, const FVector& In4, FName In5, UObject* In6, float In7);
+	/** Benchmark pure node Lib009_Fn006 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn006(const FVector& In0, FString& Out1, int32& Out2, UObject* In3, int32& Out4, UObject* In5, bool In6);
+	/** Benchmark pure node Lib009_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn007(UObject* In0, const FString& In1, UObject* In2, FVector& Out3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib009_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn008(FName In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib009_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn009(FName In0, UObject* In1, UObject* In2, const FTransform& In3, int32 In4, const TArray< int32 >& In5, FString& Out6, const FString& In7);
+	/** Benchmark pure node Lib009_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn010(const FString& In0, bool In1, FName In2, int32 In3, int32& Out4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark callable node Lib009_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn011(const FVector& In0, int32 In1, FString& Out2);
+	/** Benchmark callable node Lib009_Fn012 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn012(int32 In0, UObject* In1);
+	/** Benchmark pure node Lib009_Fn013 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn013(const FString& In0, UObject* In1, int32 In2, const TArray< int32 >& In3, const FString& In4, FString& Out5, FVector& Out6, FString& Out7);
+	/** Benchmark callable node Lib009_Fn014 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn014(int32 In0);
+	/** Benchmark callable node Lib009_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn015(float In0);
+	/** Benchmark latent node Lib009_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib009_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FString& In1, FString& Out2, bool In3);
+	/** Benchmark callable node Lib009_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn017(float In0, const FString& In1, FName In2);
+	/** Benchmark callable node Lib009_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn018(const FVector& In0);
+	/** Benchmark callable node Lib009_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn019(float In0, const FTransform& In1);
+	/** Benchmark latent node Lib009_Fn020 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib009_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, bool In2);
+	/** Benchmark callable node Lib009_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn021(const FVector& In0, FName In1, const FTransform& In2, int32 In3, const TArray< int32 >& In4, UObject* In5, const FVector& In6, FVector& Out7);
+	/** Benchmark callable node Lib009_Fn022 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn022(int32& Out0, FVector& Out1, FName In2, const FString& In3, int32 In4, const FString& In5, int32& Out6, FString& Out7);
+	/** Benchmark callable node Lib009_Fn023 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn023(FName In0, UObject* In1, FString& Out2, UObject* In3, const FTransform& In4, FString& Out5);
+	/** Benchmark callable node Lib009_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn024(int32 In0, const TArray< int32 >& In1, FVector& Out2, const TArray< int32 >& In3, bool In4, int32 In5, float In6);
+	/** Benchmark callable node Lib009_Fn025 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn025(const FTransform& In0, const FVector& In1, bool In2, int32& Out3, const TArray< int32 >& In4, UObject* In5, float In6);
+	/** Benchmark pure node Lib009_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn026();
+	/** Benchmark callable node Lib009_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn027(float In0, int32& Out1, const FTransform& In2, FString& Out3);
+	/** Benchmark pure node Lib009_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn028(FName In0, UObject* In1, FString& Out2, FVector& Out3);
+	/** Benchmark pure node Lib009_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn029(float In0);
+	/** Benchmark callable node Lib009_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn030(FName In0, int32 In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib009_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn031(const TArray< int32 >& In0, float In1);
+	/** Benchmark callable node Lib009_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn032();
+	/** Benchmark pure node Lib009_Fn033 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn033(UObject* In0, const FString& In1, bool In2, FVector& Out3, bool In4, FVector& Out5, const FString& In6);
+	/** Benchmark pure node Lib009_Fn034 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn034(const FString& In0);
+	/** Benchmark latent node Lib009_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib009_Fn035(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib009_Fn036 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn036(const TArray< int32 >& In0, FString& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, FVector& Out4, float In5, int32 In6);
+	/** Benchmark latent node Lib009_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib009_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, int32& Out2);
+	/** Benchmark callable node Lib009_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn038(bool In0);
+	/** Benchmark callable node Lib009_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn039(float In0, FName In1);
+	/** Benchmark callable node Lib009_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn040(FString& Out0, bool In1, const FVector& In2, float In3, FString& Out4);
+	/** Benchmark latent node Lib009_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib009_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1, FName In2);
+	/** Benchmark callable node Lib009_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn042(int32& Out0, FName In1);
+	/** Benchmark pure node Lib009_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn043();
+	/** Benchmark callable node Lib009_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn044(int32& Out0, const FVector& In1, int32 In2, const FString& In3, const FString& In4, UObject* In5);
+	/** Benchmark pure node Lib009_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn045(const TArray< int32 >& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib009_Fn046 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn046(bool In0, bool In1, const TArray< int32 >& In2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib009_Fn047 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn047();
+	/** Benchmark callable node Lib009_Fn048 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn048(FVector& Out0, const TArray< int32 >& In1, float In2);
+	/** Benchmark callable node Lib009_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn049(int32& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib009_Fn050 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn050();
+	/** Benchmark callable node Lib009_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn051(const TArray< int32 >& In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, float In4);
+	/** Benchmark pure node Lib009_Fn052 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn052(int32& Out0);
+	/** Benchmark callable node Lib009_Fn053 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn053(int32& Out0, float In1, FVector& Out2, FString& Out3, float In4);
+	/** Benchmark callable node Lib009_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn054(FName In0, const FTransform& In1, float In2, FName In3, FString& Out4, float In5);
+	/** Benchmark callable node Lib009_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn055(FName In0, FString& Out1, FName In2);
+	/** Benchmark callable node Lib009_Fn056 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn056(UObject* In0);
+	/** Benchmark callable node Lib009_Fn057 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn057(const FVector& In0, bool In1);
+	/** Benchmark callable node Lib009_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn058(const TArray< int32 >& In0, bool In1, const TArray< int32 >& In2, UObject* In3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark pure node Lib009_Fn059 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn059();
+	/** Benchmark pure node Lib009_Fn060 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn060(FString& Out0, bool In1, FString& Out2, const FString& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib009_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn061(const FTransform& In0, const FVector& In1, UObject* In2, const TArray< int32 >& In3, const FTransform& In4, const FString& In5, const FTransform& In6);
+	/** Benchmark callable node Lib009_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn062(UObject* In0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, UObject* In4);
+	/** Benchmark pure node Lib009_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn063(FVector& Out0);
+	/** Benchmark callable node Lib009_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn064(FVector& Out0, const FTransform& In1, bool In2);
+	/** Benchmark callable node Lib009_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn065();
+	/** Benchmark callable node Lib009_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn066(int32 In0, const FString& In1, const FTransform& In2, const FTransform& In3, bool In4);
+	/** Benchmark callable node Lib009_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn067(FString& Out0, UObject* In1);
+	/** Benchmark callable node Lib009_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn068(int32 In0);
+	/** Benchmark callable node Lib009_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn069(const FVector& In0, FString& Out1, const FTransform& In2, const FVector& In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib009_Fn070 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn070(const FVector& In0);
+	/** Benchmark pure node Lib009_Fn071 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn071(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib009_Fn072 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn072(float In0, const FVector& In1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib009_Fn073 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn073(const FString& In0, UObject* In1, bool In2, FString& Out3, int32& Out4, FName In5, FVector& Out6);
+	/** Benchmark callable node Lib009_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn074(bool In0, FName In1);
+	/** Benchmark callable node Lib009_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn075(FString& Out0, FString& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32& Out4, FName In5, FVector& Out6);
+	/** Benchmark latent node Lib009_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib009_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib009_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn077(float In0, float In1, int32& Out2, float In3, FVector& Out4, bool In5, FString& Out6);
+	/** Benchmark callable node Lib009_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn078(int32& Out0, int32& Out1, int32 In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib009_Fn079 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn079(const TArray< int32 >& In0, const FVector& In1, const FVector& In2, int32 In3, const FVector& In4, const FString& In5, float In6);
+	/** Benchmark callable node Lib009_Fn080 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn080();
+	/** Benchmark callable node Lib009_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn081(FVector& Out0, const FVector& In1, const FVector& In2, int32& Out3);
+	/** Benchmark callable node Lib009_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn082(FString& Out0, const FString& In1, int32 In2);
+	/** Benchmark callable node Lib009_Fn083 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn083(const FTransform& In0, const FVector& In1, FVector& Out2, FName In3, const FString& In4, FString& Out5);
+	/** Benchmark callable node Lib009_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static bool Lib009_Fn084(FString& Out0, FString& Out1, FName In2);
+	/** Benchmark callable node Lib009_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn085(FVector& Out0, FName In1, const TArray< int32 >& In2, UObject* In3);
+	/** Benchmark pure node Lib009_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn086(FName In0, int32 In1);
+	/** Benchmark callable node Lib009_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn087(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, FVector& Out3, FVector& Out4, const FTransform& In5, const FTransform& In6);
+	/** Benchmark pure node Lib009_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn088(float In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3);
+	/** Benchmark callable node Lib009_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn089(const FString& In0, FName In1, const FString& In2, float In3);
+	/** Benchmark pure node Lib009_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn090(FName In0, const FTransform& In1, FName In2, FString& Out3, FName In4, const TArray< int32 >& In5, int32& Out6);
+	/** Benchmark latent node Lib009_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib009_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FName In1, int32 In2);
+	/** Benchmark callable node Lib009_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn092(const TArray< int32 >& In0, float In1, bool In2, FVector& Out3, FVector& Out4, FName In5, UObject* In6);
+	/** Benchmark pure node Lib009_Fn093 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn093(FString& Out0, int32 In1, int32 In2);
+	/** Benchmark pure node Lib009_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static float Lib009_Fn094(const FTransform& In0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib009_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FString Lib009_Fn095(UObject* In0, const TArray< int32 >& In1, const FTransform& In2, const FString& In3, FName In4);
+	/** Benchmark callable node Lib009_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static void Lib009_Fn096(const FTransform& In0, UObject* In1);
+	/** Benchmark pure node Lib009_Fn097 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn097(float In0);
+	/** Benchmark callable node Lib009_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static FVector Lib009_Fn098(const FVector& In0, UObject* In1, float In2, bool In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib009_Fn099 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib009")
+	static int32 Lib009_Fn099();
+};
+
@@ -0,0 +1,3105 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchLibraries_1.generated.h"
+
+
+UCLASS()
+class UKDGBenchLib_010 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib010_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib010_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn001(const FString& In0, bool In1, int32 In2, UObject* In3);
+	/** Benchmark callable node Lib010_Fn002 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn002(FVector& Out0);
+	/** Benchmark callable node Lib010_Fn003 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn003();
+	/** Benchmark callable node Lib010_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn004(const FTransform& In0);
+	/** Benchmark pure node Lib010_Fn005 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn005(float In0, bool In1, FString& Out2);
+	/** Benchmark callable node Lib010_Fn006 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn006(int32& Out0);
+	/** Benchmark pure node Lib010_Fn007 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn007(FString& Out0);
+	/** Benchmark pure node Lib010_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn008(const TArray< int32 >& In0, const FVector& In1, float In2, const TArray< int32 >& In3, float In4, UObject* In5);
+	/** Benchmark pure node Lib010_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn009(bool In0);
+	/** Benchmark pure node Lib010_Fn010 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn010(int32& Out0, const FVector& In1, float In2, bool In3);
+	/** Benchmark pure node Lib010_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn011(const FTransform& In0, const TArray< int32 >& In1, UObject* In2, const FString& In3, FName In4, float In5, float In6);
+	/** Benchmark callable node Lib010_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn012(FString& Out0, FString& Out1, UObject* In2, FName In3, FVector& Out4, float In5, UObject* In6);
+	/** Benchmark callable node Lib010_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn013(float In0, int32& Out1, FString& Out2);
+	/** Benchmark callable node Lib010_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn014(const FVector& In0, const TArray< int32 >& In1, bool In2, const FTransform& In3, FName In4, FName In5, bool In6);
+	/** Benchmark callable node Lib010_Fn015 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn015(const TArray< int32 >& In0, int32& Out1, FString& Out2, UObject* In3, FVector& Out4);
+	/** Benchmark callable node Lib010_Fn016 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn016(FString& Out0, int32 In1, int32 In2, const FTransform& In3, bool In4, float In5, bool In6);
+	/** Benchmark callable node Lib010_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn017(const FVector& In0, const FString& In1, UObject* In2);
+	/** Benchmark latent node Lib010_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1);
+	/** Benchmark callable node Lib010_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn019(float In0, const FVector& In1, FString& Out2, FVector& Out3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib010_Fn020 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn020(FString& Out0, UObject* In1, FName In2, const FTransform& In3, const FVector& In4, int32& Out5);
+	/** Benchmark pure node Lib010_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn021(const FVector& In0, FName In1);
+	/** Benchmark callable node Lib010_Fn022 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn022(int32 In0);
+	/** Benchmark callable node Lib010_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn023(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib010_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn024(int32& Out0, FVector& Out1, const FTransform& In2, const FString& In3, const FString& In4, FName In5);
+	/** Benchmark pure node Lib010_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn025(FName In0, const FString& In1);
+	/** Benchmark callable node Lib010_Fn026 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn026(FVector& Out0, const FTransform& In1, const FTransform& In2, FVector& Out3, const FTransform& In4, UObject* In5, FVector& Out6);
+	/** Benchmark pure node Lib010_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn027(FName In0, FString& Out1, UObject* In2, FName In3);
+	/** Benchmark callable node Lib010_Fn028 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn028(UObject* In0, int32& Out1, float In2, FString& Out3, FName In4, const FTransform& In5, int32 In6, UObject* In7);
+	/** Benchmark callable node Lib010_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn029();
+	/** Benchmark pure node Lib010_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn030(const FTransform& In0, FName In1);
+	/** Benchmark callable node Lib010_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn031(UObject* In0, FVector& Out1, const FVector& In2, float In3, const TArray< int32 >& In4, UObject* In5, FString& Out6);
+	/** Benchmark callable node Lib010_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn032();
+	/** Benchmark latent node Lib010_Fn033 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FTransform& In1, const FString& In2, const TArray< int32 >& In3, const FTransform& In4, int32& Out5, FString& Out6);
+	/** Benchmark callable node Lib010_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn034(bool In0, const FVector& In1, FString& Out2, const FVector& In3, UObject* In4, const FTransform& In5);
+	/** Benchmark callable node Lib010_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn035(int32 In0);
+	/** Benchmark pure node Lib010_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn036(FVector& Out0);
+	/** Benchmark callable node Lib010_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn037(int32& Out0, const FString& In1, int32& Out2, int32& Out3, bool In4, const TArray< int32 >& In5, const FVector& In6);
+	/** Benchmark pure node Lib010_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn038(int32 In0, FString& Out1, const TArray< int32 >& In2, UObject* In3, float In4, const FString& In5, int32& Out6);
+	/** Benchmark callable node Lib010_Fn039 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn039(FName In0, bool In1, float In2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark pure node Lib010_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn040(const FVector& In0, UObject* In1, int32 In2, const FVector& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib010_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn041(const FTransform& In0, UObject* In1, const FTransform& In2, UObject* In3, float In4, float In5, FName In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib010_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn042(const FTransform& In0, const FTransform& In1, int32& Out2);
+	/** Benchmark latent node Lib010_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, int32& Out2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib010_Fn044 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn044(FString& Out0, FName In1, int32 In2, FName In3, FName In4, FString& Out5, FString& Out6);
+	/** Benchmark callable node Lib010_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn045(int32 In0, bool In1, const FVector& In2, FVector& Out3, bool In4, int32 In5, bool In6, bool In7);
+	/** Benchmark callable node Lib010_Fn046 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn046(FName In0, int32 In1, const FTransform& In2, FVector& Out3);
+	/** Benchmark callable node Lib010_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn047(const TArray< int32 >& In0, const FVector& In1, const TArray< int32 >& In2, int32& Out3, const FTransform& In4, FName In5, int32& Out6);
+	/** Benchmark callable node Lib010_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn048();
+	/** Benchmark callable node Lib010_Fn049 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn049();
+	/** Benchmark callable node Lib010_Fn050 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn050();
+	/** Benchmark callable node Lib010_Fn051 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn051(const FVector& In0, const FVector& In1, const FString& In2, FString& Out3, FString& Out4, const FTransform& In5, int32 In6, UObject* In7);
+	/** Benchmark callable node Lib010_Fn052 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn052(int32 In0, const FTransform& In1, FString& Out2, FName In3, bool In4, float In5, const TArray< int32 >& In6, const FString& In7);
+	/** Benchmark latent node Lib010_Fn053 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn053(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FVector& In1, float In2, UObject* In3, float In4, const FVector& In5, const FString& In6, int32 In7);
+	/** Benchmark callable node Lib010_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn054(FVector& Out0, float In1, UObject* In2, FVector& Out3, bool In4, float In5, FString& Out6);
+	/** Benchmark pure node Lib010_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn055(float In0, const FVector& In1, UObject* In2);
+	/** Benchmark pure node Lib010_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn056(const FTransform& In0, int32& Out1, const FString& In2);
+	/** Benchmark callable node Lib010_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn057(UObject* In0, UObject* In1, const FString& In2, const FTransform& In3, bool In4, FName In5, int32 In6);
+	/** Benchmark pure node Lib010_Fn058 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn058(const TArray< int32 >& In0, int32 In1, const FTransform& In2, float In3, UObject* In4, int32& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib010_Fn059 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn059(int32 In0);
+	/** Benchmark pure node Lib010_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn060();
+	/** Benchmark callable node Lib010_Fn061 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn061(FString& Out0, bool In1, FVector& Out2, const FString& In3, UObject* In4);
+	/** Benchmark callable node Lib010_Fn062 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn062();
+	/** Benchmark callable node Lib010_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn063(bool In0, const FString& In1, bool In2, int32& Out3, FString& Out4);
+	/** Benchmark pure node Lib010_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn064();
+	/** Benchmark callable node Lib010_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn065(const FTransform& In0, FString& Out1, const TArray< int32 >& In2, int32& Out3, int32& Out4, UObject* In5);
+	/** Benchmark callable node Lib010_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn066(int32 In0, const TArray< int32 >& In1, float In2, float In3);
+	/** Benchmark latent node Lib010_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1, FString& Out2, FName In3, FString& Out4);
+	/** Benchmark pure node Lib010_Fn068 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn068(int32 In0, const FTransform& In1, float In2, UObject* In3);
+	/** Benchmark pure node Lib010_Fn069 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn069();
+	/** Benchmark pure node Lib010_Fn070 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn070(const FVector& In0, FString& Out1, FName In2, UObject* In3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib010_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn071(FVector& Out0);
+	/** Benchmark callable node Lib010_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn072();
+	/** Benchmark callable node Lib010_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn073(float In0, const FTransform& In1, const FVector& In2, float In3, int32& Out4, FString& Out5);
+	/** Benchmark pure node Lib010_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn074(FName In0, FVector& Out1, float In2, int32& Out3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib010_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn075(const FTransform& In0, float In1, const FTransform& In2, FVector& Out3);
+	/** Benchmark callable node Lib010_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn076(UObject* In0, const TArray< int32 >& In1, const FTransform& In2, int32 In3, int32& Out4);
+	/** Benchmark callable node Lib010_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn077(FString& Out0, float In1);
+	/** Benchmark callable node Lib010_Fn078 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn078(FString& Out0, int32 In1);
+	/** Benchmark pure node Lib010_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn079(const FTransform& In0, bool In1);
+	/** Benchmark latent node Lib010_Fn080 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FTransform& In1, int32& Out2, const FString& In3, int32 In4);
+	/** Benchmark callable node Lib010_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn081();
+	/** Benchmark pure node Lib010_Fn082 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn082(bool In0, float In1);
+	/** Benchmark pure node Lib010_Fn083 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn083(int32 In0, const TArray< int32 >& In1, const FVector& In2, FName In3, const FVector& In4, FVector& Out5, FVector& Out6, FName In7);
+	/** Benchmark pure node Lib010_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn084(FName In0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3, FVector& Out4, UObject* In5, int32 In6);
+	/** Benchmark callable node Lib010_Fn085 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static void Lib010_Fn085(const FTransform& In0, const FString& In1, FName In2, const FString& In3, FString& Out4);
+	/** Benchmark callable node Lib010_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn086(const TArray< int32 >& In0, FName In1, FString& Out2, const FString& In3, const FString& In4);
+	/** Benchmark latent node Lib010_Fn087 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn087(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, float In4, int32& Out5, FString& Out6, FName In7);
+	/** Benchmark pure node Lib010_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static FVector Lib010_Fn088(const TArray< int32 >& In0, FName In1, int32& Out2, UObject* In3);
+	/** Benchmark latent node Lib010_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1);
+	/** Benchmark callable node Lib010_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static FString Lib010_Fn090(const TArray< int32 >& In0);
+	/** Benchmark latent node Lib010_Fn091 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib010_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib010_Fn092 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn092(FString& Out0, int32& Out1, const TArray< int32 >& In2, int32 In3, UObject* In4, int32 In5, FString& Out6, const FString& In7);
+	/** Benchmark callable node Lib010_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static bool Lib010_Fn093(int32 In0, int32 In1);
+	/** Benchmark callable node Lib010_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn094(float In0);
+	/** Benchmark pure node Lib010_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn095(const FVector& In0, FName In1, FName In2, float In3, FVector& Out4, FString& Out5, bool In6, int32 In7);
+	/** Benchmark callable node Lib010_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn096(const FVector& In0, bool In1, int32& Out2, int32& Out3, UObject* In4, UObject* In5);
+	/** Benchmark callable node Lib010_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static float Lib010_Fn097(FName In0, FVector& Out1, int32 In2, UObject* In3, const FTransform& In4, bool In5);
+	/** Benchmark callable node Lib010_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn098(bool In0, int32 In1);
+	/** Benchmark pure node Lib010_Fn099 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib010")
+	static int32 Lib010_Fn099(FVector& Out0, FName In1, const FString& In2, const TArray< int32 >& In3, int32& Out4, FString& Out5, const FVector& In6, bool In7);
+};
+
+
+UCLASS()
+class UKDGBenchLib_011 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib011_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn000(float In0, UObject* In1, bool In2, FVector& Out3);
+	/** Benchmark pure node Lib011_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn001(FVector& Out0, const FTransform& In1, int32& Out2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib011_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn002();
+	/** Benchmark latent node Lib011_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FString& In1, FVector& Out2, const FVector& In3, int32& Out4);
+	/** Benchmark callable node Lib011_Fn004 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn004(bool In0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib011_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn005(FName In0, FVector& Out1, const TArray< int32 >& In2, FVector& Out3, FString& Out4, const FString& In5, UObject* In6);
+	/** Benchmark callable node Lib011_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn006(const TArray< int32 >& In0, float In1, FString& Out2, int32 In3);
+	/** Benchmark callable node Lib011_Fn007 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn007(const FVector& In0);
+	/** Benchmark callable node Lib011_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn008(FString& Out0, FName In1);
+	/** Benchmark pure node Lib011_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn009(UObject* In0, UObject* In1, const FVector& In2, const FTransform& In3, float In4, bool In5, int32& Out6, FString& Out7);
+	/** Benchmark callable node Lib011_Fn010 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn010(bool In0, UObject* In1, float In2, int32& Out3, int32& Out4, FString& Out5);
+	/** Benchmark callable node Lib011_Fn011 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn011(bool In0, const FString& In1, float In2, UObject* In3);
+	/** Benchmark latent node Lib011_Fn012 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, const FTransform& In2, float In3, const FVector& In4, FVector& Out5, const FVector& In6, FName In7);
+	/** Benchmark callable node Lib011_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn013(bool In0, const FString& In1);
+	/** Benchmark latent node Lib011_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32& Out1);
+	/** Benchmark callable node Lib011_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn015(const FString& In0, FName In1, const FVector& In2, FVector& Out3, const FString& In4, const FVector& In5);
+	/** Benchmark callable node Lib011_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn016(bool In0, int32 In1, UObject* In2, float In3, FString& Out4);
+	/** Benchmark callable node Lib011_Fn017 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn017(FVector& Out0, const TArray< int32 >& In1, const FVector& In2, FVector& Out3, const FVector& In4);
+	/** Benchmark pure node Lib011_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn018(UObject* In0, int32 In1, int32& Out2, bool In3, const FVector& In4, const FTransform& In5, float In6);
+	/** Benchmark callable node Lib011_Fn019 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn019(const TArray< int32 >& In0, FString& Out1, int32 In2, const FVector& In3, FVector& Out4, const FString& In5, const FVector& In6);
+	/** Benchmark latent node Lib011_Fn020 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, FVector& Out2);
+	/** Benchmark pure node Lib011_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn021(const FString& In0, const FString& In1, FString& Out2);
+	/** Benchmark pure node Lib011_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn022(FVector& Out0, const FVector& In1, UObject* In2, float In3);
+	/** Benchmark pure node Lib011_Fn023 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn023(bool In0, const FString& In1, const TArray< int32 >& In2, int32& Out3, float In4, float In5, FString& Out6);
+	/** Benchmark pure node Lib011_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn024(int32 In0, int32 In1, int32& Out2, int32& Out3, float In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib011_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn025(const FTransform& In0);
+	/** Benchmark pure node Lib011_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn026();
+	/** Benchmark latent node Lib011_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib011_Fn028 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn028(const FVector& In0, int32 In1, int32 In2, FVector& Out3, bool In4, float In5, bool In6, FName In7);
+	/** Benchmark callable node Lib011_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn029(const FTransform& In0);
+	/** Benchmark callable node Lib011_Fn030 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn030();
+	/** Benchmark latent node Lib011_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const TArray< int32 >& In1, float In2);
+	/** Benchmark callable node Lib011_Fn032 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn032(int32& Out0, float In1);
+	/** Benchmark callable node Lib011_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn033(FVector& Out0, float In1, FString& Out2, float In3);
+	/** Benchmark latent node Lib011_Fn034 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FTransform& In1, float In2, float In3, int32& Out4, int32& Out5, FString& Out6, const FTransform& In7);
+	/** Benchmark callable node Lib011_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn035(const FTransform& In0, int32 In1, const TArray< int32 >& In2, const TArray< int32 >& In3, UObject* In4, int32 In5, const FTransform& In6, bool In7);
+	/** Benchmark pure node Lib011_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn036(const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib011_Fn037 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn037(UObject* In0, const FTransform& In1, const FTransform& In2);
+	/** Benchmark callable node Lib011_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn038(bool In0, const TArray< int32 >& In1, const FVector& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, UObject* In5, const FString& In6);
+	/** Benchmark pure node Lib011_Fn039 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn039();
+	/** Benchmark callable node Lib011_Fn040 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn040();
+	/** Benchmark callable node Lib011_Fn041 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn041();
+	/** Benchmark callable node Lib011_Fn042 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn042(FVector& Out0);
+	/** Benchmark callable node Lib011_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn043(bool In0, int32& Out1, UObject* In2);
+	/** Benchmark callable node Lib011_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn044(const TArray< int32 >& In0, const TArray< int32 >& In1, bool In2);
+	/** Benchmark callable node Lib011_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn045(const FString& In0, float In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib011_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn046(FVector& Out0, FVector& Out1, const FString& In2, UObject* In3, const FString& In4, UObject* In5, FVector& Out6);
+	/** Benchmark callable node Lib011_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn047(int32 In0, int32& Out1, const FString& In2);
+	/** Benchmark callable node Lib011_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn048();
+	/** Benchmark pure node Lib011_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn049(const TArray< int32 >& In0, const FString& In1, FName In2, FVector& Out3, int32 In4, int32 In5, bool In6);
+	/** Benchmark pure node Lib011_Fn050 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn050(const TArray< int32 >& In0, const FVector& In1, int32& Out2);
+	/** Benchmark callable node Lib011_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn051(UObject* In0, float In1, bool In2, float In3);
+	/** Benchmark callable node Lib011_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn052(FName In0, FString& Out1, float In2, int32 In3, const TArray< int32 >& In4, const FVector& In5, int32 In6);
+	/** Benchmark pure node Lib011_Fn053 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn053(const FTransform& In0);
+	/** Benchmark callable node Lib011_Fn054 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn054();
+	/** Benchmark callable node Lib011_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn055(const TArray< int32 >& In0, FName In1);
+	/** Benchmark callable node Lib011_Fn056 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn056(float In0, FName In1, int32 In2, FString& Out3, FString& Out4, int32& Out5, const FTransform& In6);
+	/** Benchmark latent node Lib011_Fn057 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1);
+	/** Benchmark pure node Lib011_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn058(int32& Out0, const FTransform& In1, int32& Out2, float In3, bool In4);
+	/** Benchmark callable node Lib011_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn059(const FString& In0, const FVector& In1, UObject* In2, int32& Out3, bool In4, FVector& Out5);
+	/** Benchmark pure node Lib011_Fn060 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn060(const FString& In0, int32& Out1, int32 In2);
+	/** Benchmark callable node Lib011_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn061(float In0);
+	/** Benchmark callable node Lib011_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn062(FString& Out0, const FTransform& In1, const FString& In2, bool In3, bool In4);
+	/** Benchmark pure node Lib011_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn063(UObject* In0, bool In1, FString& Out2, const FString& In3, int32 In4);
+	/** Benchmark callable node Lib011_Fn064 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn064(const FTransform& In0, float In1, FName In2, float In3, FName In4);
+	/** Benchmark callable node Lib011_Fn065 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn065(FString& Out0, const FVector& In1, int32 In2, FVector& Out3, bool In4);
+	/** Benchmark callable node Lib011_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn066(float In0, bool In1, float In2, UObject* In3, bool In4, bool In5);
+	/** Benchmark pure node Lib011_Fn067 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn067(int32& Out0, FVector& Out1, FVector& Out2, const FString& In3, bool In4, int32 In5, const TArray< int32 >& In6, FName In7);
+	/** Benchmark callable node Lib011_Fn068 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn068(UObject* In0, const FVector& In1, UObject* In2, FVector& Out3);
+	/** Benchmark callable node Lib011_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn069(int32& Out0, const FTransform& In1, int32 In2, FVector& Out3);
+	/** Benchmark callable node Lib011_Fn070 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn070();
+	/** Benchmark callable node Lib011_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn071(float In0, FVector& Out1, bool In2, int32& Out3, FName In4, FVector& Out5);
+	/** Benchmark callable node Lib011_Fn072 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn072(const FTransform& In0, const TArray< int32 >& In1, UObject* In2);
+	/** Benchmark callable node Lib011_Fn073 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn073(FVector& Out0, FName In1);
+	/** Benchmark callable node Lib011_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn074(const TArray< int32 >& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib011_Fn075 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn075(FName In0);
+	/** Benchmark callable node Lib011_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn076(int32 In0, float In1, int32 In2, const FVector& In3, int32 In4, UObject* In5, int32& Out6);
+	/** Benchmark pure node Lib011_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn077(int32 In0);
+	/** Benchmark callable node Lib011_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn078(int32 In0, const FString& In1, float In2, const FVector& In3, bool In4, float In5, const FTransform& In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib011_Fn079 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn079(float In0, FVector& Out1, bool In2, int32& Out3);
+	/** Benchmark callable node Lib011_Fn080 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn080(UObject* In0, const FVector& In1, FName In2, float In3, int32 In4, bool In5, int32& Out6, FVector& Out7);
+	/** Benchmark pure node Lib011_Fn081 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn081(const FString& In0, const FVector& In1);
+	/** Benchmark latent node Lib011_Fn082 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, bool In2, UObject* In3);
+	/** Benchmark pure node Lib011_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn083(int32& Out0, bool In1, int32& Out2, float In3, const FTransform& In4);
+	/** Benchmark callable node Lib011_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn084(const FString& In0, bool In1, int32 In2, UObject* In3, int32 In4, FVector& Out5);
+	/** Benchmark callable node Lib011_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn085(UObject* In0, const FTransform& In1, FName In2, const FTransform& In3, int32& Out4, float In5, FVector& Out6);
+	/** Benchmark pure node Lib011_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn086(FVector& Out0, bool In1, const FVector& In2, const FString& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib011_Fn087 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn087(bool In0, const FTransform& In1, int32& Out2, UObject* In3, const FTransform& In4, const TArray< int32 >& In5, int32 In6, UObject* In7);
+	/** Benchmark callable node Lib011_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn088();
+	/** Benchmark callable node Lib011_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static float Lib011_Fn089(int32 In0, UObject* In1, FVector& Out2, int32 In3);
+	/** Benchmark callable node Lib011_Fn090 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn090(FString& Out0, FString& Out1, const FTransform& In2, int32 In3, FVector& Out4);
+	/** Benchmark callable node Lib011_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn091(UObject* In0, FVector& Out1, bool In2, float In3, FVector& Out4, FName In5);
+	/** Benchmark callable node Lib011_Fn092 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static void Lib011_Fn092(FName In0, FName In1);
+	/** Benchmark callable node Lib011_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn093(FName In0, int32 In1, const FString& In2, const FString& In3, float In4, const FVector& In5, FVector& Out6, const FTransform& In7);
+	/** Benchmark pure node Lib011_Fn094 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib011")
+	static FString Lib011_Fn094(FName In0, const FString& In1, const FString& In2, UObject* In3, const TArray< int32 >& In4, UObject* In5, int32& Out6);
+	/** Benchmark callable node Lib011_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static bool Lib011_Fn095(const TArray< int32 >& In0, const FString& In1, float In2, bool In3, const TArray< int32 >& In4);
+	/** Benchmark latent node Lib011_Fn096 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, UObject* In2, FName In3, int32 In4, float In5, FVector& Out6);
+	/** Benchmark callable node Lib011_Fn097 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static FVector Lib011_Fn097(FName In0, FString& Out1, UObject* In2, bool In3);
+	/** Benchmark latent node Lib011_Fn098 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib011_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FString& Out1, const FVector& In2, const FString& In3, int32& Out4, const FVector& In5);
+	/** Benchmark callable node Lib011_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib011")
+	static int32 Lib011_Fn099(const FTransform& In0, float In1, FString& Out2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_012 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib012_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn000(FString& Out0, int32 In1, FVector& Out2);
+	/** Benchmark callable node Lib012_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn001(float In0, const FString& In1, FString& Out2, float In3, FName In4, const FString& In5, const TArray< int32 >& In6, int32& Out7);
+	/** Benchmark callable node Lib012_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn002(FVector& Out0, bool In1, int32 In2, const FString& In3);
+	/** Benchmark callable node Lib012_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn003(FName In0, FVector& Out1);
+	/** Benchmark latent node Lib012_Fn004 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, FName In2, UObject* In3, FString& Out4, bool In5, FVector& Out6, float In7);
+	/** Benchmark callable node Lib012_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn005(const TArray< int32 >& In0, int32& Out1, const FTransform& In2, float In3, const FVector& In4, int32 In5, FVector& Out6);
+	/** Benchmark pure node Lib012_Fn006 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn006(const TArray< int32 >& In0, float In1, const FVector& In2, const FVector& In3, FString& Out4, int32& Out5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib012_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn007(FName In0, const FTransform& In1, FVector& Out2, const FString& In3, const FString& In4, const FTransform& In5, float In6);
+	/** Benchmark callable node Lib012_Fn008 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn008(const FTransform& In0, bool In1, UObject* In2, const FTransform& In3);
+	/** Benchmark callable node Lib012_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn009(const FVector& In0, const FVector& In1, FString& Out2, FName In3);
+	/** Benchmark callable node Lib012_Fn010 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn010(const FTransform& In0, FName In1);
+	/** Benchmark callable node Lib012_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn011(FVector& Out0, float In1, bool In2, int32& Out3, bool In4, float In5, const TArray< int32 >& In6, float In7);
+	/** Benchmark callable node Lib012_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn012(const FVector& In0, const TArray< int32 >& In1, const FString& In2, const FString& In3, const FString& In4, FName In5, FVector& Out6);
+	/** Benchmark callable node Lib012_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn013(const TArray< int32 >& In0, const FVector& In1, FString& Out2, const TArray< int32 >& In3, bool In4, const FTransform& In5);
+	/** Benchmark callable node Lib012_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn014(FVector& Out0, UObject* In1, const FTransform& In2);
+	/** Benchmark callable node Lib012_Fn015 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn015(int32 In0, const FVector& In1, FString& Out2);
+	/** Benchmark callable node Lib012_Fn016 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn016(float In0);
+	/** Benchmark callable node Lib012_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn017(bool In0);
+	/** Benchmark callable node Lib012_Fn018 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn018(FVector& Out0, FName In1);
+	/** Benchmark callable node Lib012_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn019(FName In0, const FString& In1, int32& Out2, bool In3);
+	/** Benchmark callable node Lib012_Fn020 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn020(FName In0, const FVector& In1, int32& Out2, const FVector& In3, const FString& In4);
+	/** Benchmark pure node Lib012_Fn021 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn021(float In0, const FVector& In1, FVector& Out2, FName In3, FName In4, FName In5, bool In6);
+	/** Benchmark latent node Lib012_Fn022 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn022(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, const FTransform& In2, UObject* In3, const FTransform& In4, FName In5, bool In6);
+	/** Benchmark callable node Lib012_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn023();
+	/** Benchmark callable node Lib012_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn024(const FString& In0, const FVector& In1, const FVector& In2, FName In3, const FVector& In4, FVector& Out5, float In6, bool In7);
+	/** Benchmark callable node Lib012_Fn025 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn025();
+	/** Benchmark latent node Lib012_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1);
+	/** Benchmark callable node Lib012_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn027(UObject* In0, const FVector& In1, const FTransform& In2, const TArray< int32 >& In3, bool In4, const FString& In5, const FVector& In6);
+	/** Benchmark pure node Lib012_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn028(const FTransform& In0, int32& Out1, float In2, FName In3);
+	/** Benchmark callable node Lib012_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn029(UObject* In0, int32& Out1, FVector& Out2, int32& Out3, bool In4);
+	/** Benchmark callable node Lib012_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn030(const TArray< int32 >& In0, float In1, FName In2);
+	/** Benchmark pure node Lib012_Fn031 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn031();
+	/** Benchmark callable node Lib012_Fn032 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn032(int32 In0, bool In1);
+	/** Benchmark callable node Lib012_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn033(bool In0, int32& Out1, int32 In2, float In3);
+	/** Benchmark callable node Lib012_Fn034 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn034(float In0, int32& Out1, const TArray< int32 >& In2, const FTransform& In3, float In4);
+	/** Benchmark pure node Lib012_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn035(float In0, FName In1, float In2, FVector& Out3, const TArray< int32 >& In4, int32 In5);
+	/** Benchmark callable node Lib012_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn036(UObject* In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib012_Fn037 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn037(FString& Out0, FString& Out1);
+	/** Benchmark callable node Lib012_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn038();
+	/** Benchmark callable node Lib012_Fn039 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn039(const FVector& In0, const FTransform& In1, const TArray< int32 >& In2, const FTransform& In3, bool In4);
+	/** Benchmark callable node Lib012_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn040(int32& Out0, const FTransform& In1, float In2, float In3, const FTransform& In4, const FString& In5, const FVector& In6, int32& Out7);
+	/** Benchmark pure node Lib012_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn041(FVector& Out0, int32& Out1, int32& Out2, const FVector& In3, const TArray< int32 >& In4, const FString& In5);
+	/** Benchmark callable node Lib012_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn042();
+	/** Benchmark callable node Lib012_Fn043 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn043(int32 In0, bool In1, const FString& In2, FString& Out3, float In4, const FVector& In5, UObject* In6, bool In7);
+	/** Benchmark callable node Lib012_Fn044 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn044(FString& Out0, bool In1);
+	/** Benchmark pure node Lib012_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn045(int32 In0, float In1);
+	/** Benchmark latent node Lib012_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib012_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn047(const FVector& In0, FString& Out1, FVector& Out2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib012_Fn048 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn048(const FTransform& In0);
+	/** Benchmark pure node Lib012_Fn049 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn049(FVector& Out0, const FVector& In1, int32 In2, FName In3);
+	/** Benchmark callable node Lib012_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn050(UObject* In0);
+	/** Benchmark callable node Lib012_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn051(FVector& Out0, FString& Out1, const TArray< int32 >& In2, FVector& Out3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark callable node Lib012_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn052(FVector& Out0, int32 In1);
+	/** Benchmark callable node Lib012_Fn053 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn053(int32 In0, const FTransform& In1, const FTransform& In2, FString& Out3, int32 In4);
+	/** Benchmark callable node Lib012_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn054(FVector& Out0, FName In1, int32& Out2, UObject* In3, FVector& Out4, UObject* In5, const FTransform& In6, FName In7);
+	/** Benchmark callable node Lib012_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn055(FVector& Out0, const FVector& In1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib012_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn056(const TArray< int32 >& In0, int32 In1, UObject* In2);
+	/** Benchmark callable node Lib012_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn057(int32& Out0);
+	/** Benchmark callable node Lib012_Fn058 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn058(const FString& In0, FVector& Out1, bool In2);
+	/** Benchmark callable node Lib012_Fn059 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn059(FVector& Out0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib012_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn060();
+	/** Benchmark callable node Lib012_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn061(const FTransform& In0, FVector& Out1, const FString& In2, float In3);
+	/** Benchmark pure node Lib012_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn062(float In0, int32& Out1, FName In2, int32 In3, UObject* In4);
+	/** Benchmark callable node Lib012_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn063(const TArray< int32 >& In0, float In1, int32 In2, int32 In3, const FTransform& In4);
+	/** Benchmark pure node Lib012_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn064(int32& Out0, FString& Out1, FVector& Out2, int32 In3);
+	/** Benchmark callable node Lib012_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn065(const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib012_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn066(UObject* In0, int32 In1, FVector& Out2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib012_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn067(const FString& In0);
+	/** Benchmark callable node Lib012_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn068(bool In0, const FTransform& In1, bool In2, bool In3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib012_Fn069 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn069();
+	/** Benchmark pure node Lib012_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn070(const FVector& In0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib012_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn071(FVector& Out0, const FString& In1, FVector& Out2, const TArray< int32 >& In3, const FVector& In4, FVector& Out5);
+	/** Benchmark pure node Lib012_Fn072 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn072(bool In0, int32 In1, FString& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib012_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn073(UObject* In0, FVector& Out1, const FVector& In2, const FString& In3, FName In4, const FVector& In5);
+	/** Benchmark callable node Lib012_Fn074 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn074(FString& Out0, FVector& Out1, int32 In2, const FVector& In3, const FString& In4);
+	/** Benchmark pure node Lib012_Fn075 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn075(UObject* In0, int32 In1, const FString& In2, int32& Out3, const TArray< int32 >& In4, int32& Out5);
+	/** Benchmark latent node Lib012_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, const FVector& In2, FString& Out3, UObject* In4);
+	/** Benchmark pure node Lib012_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn077(bool In0, const FVector& In1);
+	/** Benchmark callable node Lib012_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn078(FString& Out0, UObject* In1, const FString& In2, const FVector& In3, FVector& Out4, const FString& In5, float In6);
+	/** Benchmark latent node Lib012_Fn079 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FTransform& In1, int32& Out2, const FVector& In3, const FVector& In4, FVector& Out5, const FString& In6, UObject* In7);
+	/** Benchmark latent node Lib012_Fn080 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, bool In1, const FString& In2, int32& Out3, const FString& In4);
+	/** Benchmark pure node Lib012_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn081(FString& Out0, int32& Out1, UObject* In2, UObject* In3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib012_Fn082 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FVector& Out1);
+	/** Benchmark callable node Lib012_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn083();
+	/** Benchmark latent node Lib012_Fn084 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib012_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn085(const FTransform& In0, int32 In1, bool In2, FString& Out3);
+	/** Benchmark callable node Lib012_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn086(const FTransform& In0, const FTransform& In1, int32 In2, float In3, const FString& In4);
+	/** Benchmark pure node Lib012_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn087();
+	/** Benchmark latent node Lib012_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib012_Fn088(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, float In1, float In2, const TArray< int32 >& In3, FName In4, FName In5);
+	/** Benchmark pure node Lib012_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static int32 Lib012_Fn089(FVector& Out0, const FString& In1);
+	/** Benchmark pure node Lib012_Fn090 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FVector Lib012_Fn090();
+	/** Benchmark pure node Lib012_Fn091 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn091(FString& Out0);
+	/** Benchmark callable node Lib012_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn092(const FTransform& In0, int32 In1, const FTransform& In2, const FVector& In3);
+	/** Benchmark pure node Lib012_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static bool Lib012_Fn093(float In0, FVector& Out1, FString& Out2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib012_Fn094 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn094(FString& Out0, int32& Out1, int32 In2, int32& Out3, int32 In4, UObject* In5, int32& Out6);
+	/** Benchmark callable node Lib012_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static void Lib012_Fn095(bool In0, const FString& In1, const FString& In2);
+	/** Benchmark pure node Lib012_Fn096 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn096(int32 In0, int32 In1, bool In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib012_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static FString Lib012_Fn097(bool In0, FName In1);
+	/** Benchmark pure node Lib012_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn098(int32& Out0, FVector& Out1, const FVector& In2);
+	/** Benchmark callable node Lib012_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib012")
+	static float Lib012_Fn099(const FString& In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_013 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib013_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib013_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib013_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn002(FName In0, FName In1, const FString& In2, const FTransform& In3, float In4, float In5, FVector& Out6, bool In7);
+	/** Benchmark pure node Lib013_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn003(int32& Out0, int32& Out1, FString& Out2, FName In3, const FTransform& In4, bool In5, const FTransform& In6, UObject* In7);
+	/** Benchmark callable node Lib013_Fn004 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn004(FVector& Out0, int32 In1, const TArray< int32 >& In2, const FVector& In3, const FString& In4, FName In5);
+	/** Benchmark callable node Lib013_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn005(int32 In0, FString& Out1, const FString& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib013_Fn006 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn006();
+	/** Benchmark callable node Lib013_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn007(bool In0, int32 In1, FString& Out2);
+	/** Benchmark pure node Lib013_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn008(const TArray< int32 >& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib013_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn009(bool In0, bool In1, const FVector& In2, UObject* In3, const FString& In4, float In5, UObject* In6, const FVector& In7);
+	/** Benchmark callable node Lib013_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn010();
+	/** Benchmark latent node Lib013_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, bool In2, float In3, int32 In4);
+	/** Benchmark pure node Lib013_Fn012 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn012(const TArray< int32 >& In0, const FString& In1, float In2, const FTransform& In3, FName In4, FVector& Out5);
+	/** Benchmark callable node Lib013_Fn013 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn013(FVector& Out0, const FVector& In1, FString& Out2, FName In3);
+	/** Benchmark callable node Lib013_Fn014 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn014(const FTransform& In0);
+	/** Benchmark callable node Lib013_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn015(int32& Out0, FVector& Out1, int32& Out2, FVector& Out3, FString& Out4, FVector& Out5);
+	/** Benchmark callable node Lib013_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn016(float In0, const FTransform& In1, FVector& Out2, bool In3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib013_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn017(int32& Out0, bool In1, FVector& Out2, int32& Out3, const FVector& In4, FName In5);
+	/** Benchmark callable node Lib013_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn018(FVector& Out0, const FTransform& In1, const FVector& In2, FVector& Out3, FName In4, const FVector& In5, FVector& Out6);
+	/** Benchmark latent node Lib013_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn019(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, bool In1, bool In2, FName In3);
+	/** Benchmark pure node Lib013_Fn020 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn020(const FString& In0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib013_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn021(UObject* In0, UObject* In1, bool In2, int32 In3, float In4, FVector& Out5);
+	/** Benchmark latent node Lib013_Fn022 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn022(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, int32 In2, const FVector& In3, const FString& In4, UObject* In5, int32& Out6);
+	/** Benchmark pure node Lib013_Fn023 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn023(UObject* In0, float In1, const FString& In2, int32& Out3, const FString& In4, FName In5, const FTransform& In6);
+	/** Benchmark callable node Lib013_Fn024 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn024(FString& Out0, int32 In1, bool In2, UObject* In3);
+	/** Benchmark pure node Lib013_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn025(const TArray< int32 >& In0, int32& Out1, bool In2, float In3, FVector& Out4, UObject* In5, const FVector& In6, bool In7);
+	/** Benchmark callable node Lib013_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn026();
+	/** Benchmark latent node Lib013_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark pure node Lib013_Fn028 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn028(FVector& Out0, FName In1, float In2);
+	/** Benchmark latent node Lib013_Fn029 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, float In2, float In3, const FString& In4, const FString& In5, int32 In6);
+	/** Benchmark callable node Lib013_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn030(float In0, int32 In1, float In2, int32& Out3);
+	/** Benchmark callable node Lib013_Fn031 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn031(const FVector& In0, const FVector& In1, UObject* In2);
+	/** Benchmark callable node Lib013_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn032(UObject* In0, int32 In1, float In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib013_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn033(const FVector& In0, FVector& Out1, int32 In2, FString& Out3, const FString& In4, const FVector& In5);
+	/** Benchmark callable node Lib013_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn034(float In0, float In1, FName In2, UObject* In3, const TArray< int32 >& In4, FName In5);
+	/** Benchmark callable node Lib013_Fn035 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn035(bool In0, int32 In1, float In2, int32& Out3);
+	/** Benchmark callable node Lib013_Fn036 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn036(const FVector& In0, const FVector& In1, int32 In2, FString& Out3);
+	/** Benchmark pure node Lib013_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn037(FVector& Out0, const FString& In1, UObject* In2, FName In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib013_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn038(bool In0, UObject* In1, FVector& Out2, float In3);
+	/** Benchmark callable node Lib013_Fn039 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn039(const FVector& In0, const TArray< int32 >& In1, FName In2, bool In3, UObject* In4);
+	/** Benchmark callable node Lib013_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn040(const FVector& In0, const FString& In1, const TArray< int32 >& In2, FString& Out3, const TArray< int32 >& In4, bool In5);
+	/** Benchmark latent node Lib013_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib013_Fn042 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn042(const FString& In0, const FVector& In1, const FString& In2, const TArray< int32 >& In3, const FString& In4);
+	/** Benchmark callable node Lib013_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn043(int32 In0, FString& Out1, FString& Out2, FName In3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark callable node Lib013_Fn044 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn044(const FVector& In0, const FTransform& In1, UObject* In2, const FTransform& In3, UObject* In4, const FString& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib013_Fn045 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn045(FVector& Out0, const FVector& In1, int32 In2, FName In3, float In4, const FTransform& In5, const FVector& In6);
+	/** Benchmark callable node Lib013_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn046(UObject* In0);
+	/** Benchmark latent node Lib013_Fn047 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn047(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32& Out1);
+	/** Benchmark callable node Lib013_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn048(const TArray< int32 >& In0, FVector& Out1, UObject* In2, const FString& In3);
+	/** Benchmark callable node Lib013_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn049(UObject* In0, bool In1);
+	/** Benchmark pure node Lib013_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn050(FString& Out0, int32& Out1, int32& Out2, FName In3, const FVector& In4);
+	/** Benchmark callable node Lib013_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn051(const FTransform& In0, int32& Out1);
+	/** Benchmark latent node Lib013_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark callable node Lib013_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn053(UObject* In0, const TArray< int32 >& In1, FVector& Out2, int32& Out3);
+	/** Benchmark callable node Lib013_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn054(float In0, const FTransform& In1, FString& Out2, float In3, const FVector& In4, FVector& Out5);
+	/** Benchmark callable node Lib013_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn055(FString& Out0, const FString& In1, const FString& In2);
+	/** Benchmark latent node Lib013_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1);
+	/** Benchmark callable node Lib013_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn057(UObject* In0, int32 In1, FString& Out2, FVector& Out3, UObject* In4, FString& Out5, const FTransform& In6);
+	/** Benchmark latent node Lib013_Fn058 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, const FTransform& In2, float In3, bool In4);
+	/** Benchmark pure node Lib013_Fn059 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn059(const FVector& In0, FName In1, const FTransform& In2, float In3, int32 In4);
+	/** Benchmark pure node Lib013_Fn060 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn060(FString& Out0, int32 In1, bool In2);
+	/** Benchmark callable node Lib013_Fn061 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn061(const FString& In0, UObject* In1, const FVector& In2, int32 In3, FName In4, const FString& In5, FName In6, const FString& In7);
+	/** Benchmark callable node Lib013_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn062(bool In0, FVector& Out1, FString& Out2, int32 In3, const FVector& In4);
+	/** Benchmark callable node Lib013_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn063(const FVector& In0, const FString& In1, UObject* In2, FName In3, FVector& Out4);
+	/** Benchmark callable node Lib013_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn064(FName In0, FString& Out1, const FString& In2, const FTransform& In3, UObject* In4, int32& Out5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib013_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn065(const FTransform& In0);
+	/** Benchmark callable node Lib013_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn066(int32& Out0, const FTransform& In1, const FTransform& In2, const FTransform& In3, FString& Out4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib013_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn067(FString& Out0, int32& Out1, bool In2, float In3, FString& Out4, float In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib013_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn068(UObject* In0);
+	/** Benchmark callable node Lib013_Fn069 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn069(const FVector& In0, const FVector& In1, FVector& Out2);
+	/** Benchmark callable node Lib013_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn070(FVector& Out0, const FString& In1, const FVector& In2);
+	/** Benchmark latent node Lib013_Fn071 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib013_Fn072 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn072(bool In0, bool In1, FName In2, const FString& In3, int32& Out4, float In5, int32& Out6, FName In7);
+	/** Benchmark callable node Lib013_Fn073 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn073(FString& Out0, FName In1, float In2, UObject* In3, const FTransform& In4, int32& Out5, FString& Out6);
+	/** Benchmark callable node Lib013_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn074(bool In0, int32& Out1, int32 In2, FVector& Out3);
+	/** Benchmark latent node Lib013_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn075(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FTransform& In1, UObject* In2, const FVector& In3, bool In4);
+	/** Benchmark latent node Lib013_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib013_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn077(FString& Out0);
+	/** Benchmark pure node Lib013_Fn078 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn078(int32 In0, FString& Out1, const TArray< int32 >& In2, int32 In3, const FVector& In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib013_Fn079 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn079(int32& Out0, bool In1, const FTransform& In2, FName In3, const FTransform& In4, FVector& Out5, FString& Out6);
+	/** Benchmark callable node Lib013_Fn080 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static bool Lib013_Fn080(FString& Out0);
+	/** Benchmark pure node Lib013_Fn081 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn081(int32 In0, bool In1, float In2);
+	/** Benchmark callable node Lib013_Fn082 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn082(int32 In0, int32& Out1, FName In2, FName In3, const FString& In4, const FTransform& In5);
+	/** Benchmark pure node Lib013_Fn083 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn083(UObject* In0);
+	/** Benchmark callable node Lib013_Fn084 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn084();
+	/** Benchmark latent node Lib013_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn085(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3, const FVector& In4);
+	/** Benchmark callable node Lib013_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn086(int32 In0, const FVector& In1);
+	/** Benchmark pure node Lib013_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn087(float In0, FVector& Out1, const FVector& In2, UObject* In3, const FString& In4, float In5, UObject* In6);
+	/** Benchmark pure node Lib013_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn088(const TArray< int32 >& In0, const FString& In1, FName In2);
+	/** Benchmark latent node Lib013_Fn089 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FString& In1, UObject* In2, int32 In3, const FVector& In4, const FVector& In5, UObject* In6);
+	/** Benchmark callable node Lib013_Fn090 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn090(bool In0, int32 In1, int32& Out2, const FVector& In3, UObject* In4, float In5);
+	/** Benchmark pure node Lib013_Fn091 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn091(bool In0, const FTransform& In1, const TArray< int32 >& In2, FString& Out3, const TArray< int32 >& In4, const FVector& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib013_Fn092 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn092(FVector& Out0, bool In1);
+	/** Benchmark callable node Lib013_Fn093 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FVector Lib013_Fn093(const FString& In0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark callable node Lib013_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static float Lib013_Fn094(bool In0, const FTransform& In1, const FString& In2);
+	/** Benchmark latent node Lib013_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, const TArray< int32 >& In2, UObject* In3, FVector& Out4, FString& Out5);
+	/** Benchmark callable node Lib013_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static void Lib013_Fn096(bool In0, UObject* In1, bool In2, FName In3, FVector& Out4, UObject* In5);
+	/** Benchmark latent node Lib013_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib013_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, int32& Out1, bool In2, int32 In3, const FVector& In4);
+	/** Benchmark callable node Lib013_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static FString Lib013_Fn098(bool In0, FName In1, int32& Out2, FName In3, float In4, FVector& Out5);
+	/** Benchmark callable node Lib013_Fn099 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib013")
+	static int32 Lib013_Fn099();
+};
+
+
+UCLASS()
+class UKDGBenchLib_014 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib014_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn000(FVector& Out0);
+	/** Benchmark callable node Lib014_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn001(int32& Out0, UObject* In1, int32& Out2, int32& Out3, bool In4, const FVector& In5, const FString& In6, FVector& Out7);
+	/** Benchmark latent node Lib014_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1, const FString& In2);
+	/** Benchmark callable node Lib014_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn003(FString& Out0, int32& Out1, const FVector& In2, int32 In3, const FString& In4, bool In5);
+	/** Benchmark latent node Lib014_Fn004 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1, FString& Out2);
+	/** Benchmark pure node Lib014_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn005(FName In0, const FString& In1, UObject* In2, int32 In3, bool In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark callable node Lib014_Fn006 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn006(FName In0);
+	/** Benchmark latent node Lib014_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1);
+	/** Benchmark callable node Lib014_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn008(FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib014_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn009(const FVector& In0, FString& Out1, const FVector& In2);
+	/** Benchmark pure node Lib014_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn010(const FVector& In0, const FTransform& In1, int32& Out2, UObject* In3, FName In4, int32 In5, float In6);
+	/** Benchmark callable node Lib014_Fn011 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn011(float In0, const TArray< int32 >& In1, FVector& Out2, UObject* In3);
+	/** Benchmark pure node Lib014_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn012(const FString& In0);
+	/** Benchmark pure node Lib014_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn013(FVector& Out0, const TArray< int32 >& In1, const FVector& In2, int32& Out3, int32& Out4);
+	/** Benchmark pure node Lib014_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn014(FString& Out0, const FString& In1, int32 In2, const FTransform& In3, const FVector& In4);
+	/** Benchmark callable node Lib014_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn015(const FVector& In0, int32 In1, const FString& In2, const FVector& In3, const FString& In4, const FTransform& In5, FName In6);
+	/** Benchmark latent node Lib014_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1, FVector& Out2);
+	/** Benchmark pure node Lib014_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn017(int32& Out0, FVector& Out1, int32 In2, FName In3, FVector& Out4, UObject* In5);
+	/** Benchmark callable node Lib014_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn018(float In0, const FVector& In1, FVector& Out2, int32 In3);
+	/** Benchmark pure node Lib014_Fn019 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn019(const FTransform& In0);
+	/** Benchmark pure node Lib014_Fn020 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn020();
+	/** Benchmark callable node Lib014_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn021(int32 In0, const FTransform& In1, const FVector& In2, int32& Out3, const FString& In4, float In5, float In6, const FVector& In7);
+	/** Benchmark pure node Lib014_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn022(int32& Out0, float In1, UObject* In2);
+	/** Benchmark pure node Lib014_Fn023 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn023(float In0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3, int32& Out4, float In5);
+	/** Benchmark callable node Lib014_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn024(int32& Out0, UObject* In1, FName In2, bool In3, float In4, const FTransform& In5);
+	/** Benchmark latent node Lib014_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, UObject* In2, int32 In3);
+	/** Benchmark callable node Lib014_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn026(float In0, FString& Out1, FName In2, float In3, FName In4);
+	/** Benchmark pure node Lib014_Fn027 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn027(float In0, const FTransform& In1, const FString& In2, float In3, const FTransform& In4);
+	/** Benchmark callable node Lib014_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn028(const TArray< int32 >& In0, UObject* In1, const FTransform& In2, FString& Out3, FName In4, int32& Out5, UObject* In6);
+	/** Benchmark callable node Lib014_Fn029 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn029(int32 In0, FVector& Out1, const FString& In2, FString& Out3);
+	/** Benchmark callable node Lib014_Fn030 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn030(const FString& In0, const FVector& In1, const FTransform& In2, FName In3, const FString& In4);
+	/** Benchmark callable node Lib014_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn031(bool In0, const FTransform& In1, int32 In2, const FTransform& In3, const FVector& In4, const TArray< int32 >& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib014_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn032(FName In0, FVector& Out1, const FString& In2);
+	/** Benchmark callable node Lib014_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn033();
+	/** Benchmark pure node Lib014_Fn034 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn034(FVector& Out0);
+	/** Benchmark callable node Lib014_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn035(UObject* In0, const FVector& In1);
+	/** Benchmark pure node Lib014_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn036(bool In0, const FTransform& In1, FVector& Out2, FString& Out3, const FTransform& In4, FString& Out5);
+	/** Benchmark callable node Lib014_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn037(float In0, int32 In1, const FVector& In2, UObject* In3, bool In4, FVector& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib014_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn038(UObject* In0, FVector& Out1, int32 In2, const FString& In3, int32 In4, int32& Out5, const FTransform& In6);
+	/** Benchmark latent node Lib014_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn039(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib014_Fn040 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn040(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib014_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn041(const FVector& In0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib014_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn042(FName In0, bool In1, const FVector& In2, const FTransform& In3, FString& Out4, UObject* In5, bool In6);
+	/** Benchmark latent node Lib014_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, bool In1, FString& Out2, FString& Out3);
+	/** Benchmark callable node Lib014_Fn044 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn044(FString& Out0, const FTransform& In1);
+	/** Benchmark pure node Lib014_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn045(FName In0, FString& Out1, const FVector& In2);
+	/** Benchmark pure node Lib014_Fn046 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn046();
+	/** Benchmark callable node Lib014_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn047(FVector& Out0, bool In1, FName In2, int32 In3, FName In4, const FString& In5);
+	/** Benchmark callable node Lib014_Fn048 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn048(FName In0, bool In1, const FVector& In2, FString& Out3, const TArray< int32 >& In4, int32& Out5);
+	/** Benchmark pure node Lib014_Fn049 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn049();
+	/** Benchmark callable node Lib014_Fn050 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn050();
+	/** Benchmark latent node Lib014_Fn051 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const TArray< int32 >& In1, FString& Out2, int32& Out3, FString& Out4, FString& Out5, int32 In6, UObject* In7);
+	/** Benchmark callable node Lib014_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn052(FString& Out0, const FTransform& In1, const FTransform& In2, FVector& Out3);
+	/** Benchmark callable node Lib014_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn053(const TArray< int32 >& In0, int32 In1, FName In2, const FString& In3, float In4, float In5);
+	/** Benchmark pure node Lib014_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn054(float In0);
+	/** Benchmark callable node Lib014_Fn055 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn055(bool In0);
+	/** Benchmark callable node Lib014_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn056(int32& Out0, UObject* In1, int32& Out2, const FString& In3);
+	/** Benchmark callable node Lib014_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn057(FVector& Out0, const TArray< int32 >& In1, const FVector& In2, const FTransform& In3, FVector& Out4, FString& Out5, FVector& Out6, FString& Out7);
+	/** Benchmark callable node Lib014_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn058(bool In0, const FTransform& In1, const FString& In2, FName In3, bool In4, bool In5);
+	/** Benchmark callable node Lib014_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn059(FString& Out0, int32 In1, UObject* In2, int32& Out3, const FString& In4, FVector& Out5, const FVector& In6, int32 In7);
+	/** Benchmark callable node Lib014_Fn060 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn060(FVector& Out0, bool In1, UObject* In2);
+	/** Benchmark pure node Lib014_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn061();
+	/** Benchmark pure node Lib014_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn062(const FTransform& In0, bool In1);
+	/** Benchmark callable node Lib014_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn063(FVector& Out0, FName In1);
+	/** Benchmark pure node Lib014_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn064();
+	/** Benchmark callable node Lib014_Fn065 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn065(FString& Out0, FString& Out1, const TArray< int32 >& In2, float In3, const FTransform& In4, int32& Out5, float In6);
+	/** Benchmark callable node Lib014_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn066();
+	/** Benchmark pure node Lib014_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn067(const FString& In0, FString& Out1, FString& Out2, UObject* In3, const FVector& In4);
+	/** Benchmark callable node Lib014_Fn068 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn068(FName In0, int32& Out1, bool In2, UObject* In3, int32& Out4, const FVector& In5, int32 In6, FVector& Out7);
+	/** Benchmark callable node Lib014_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn069(const TArray< int32 >& In0, UObject* In1, FVector& Out2, FVector& Out3);
+	/** Benchmark callable node Lib014_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn070(int32& Out0, UObject* In1, int32 In2, UObject* In3, const FString& In4, int32& Out5, FName In6);
+	/** Benchmark callable node Lib014_Fn071 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn071(FName In0, FName In1, int32 In2, FName In3, const FString& In4);
+	/** Benchmark pure node Lib014_Fn072 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn072(FName In0, const TArray< int32 >& In1, const FTransform& In2, FName In3, float In4, const FTransform& In5, bool In6);
+	/** Benchmark callable node Lib014_Fn073 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn073(const FVector& In0, const FTransform& In1, FString& Out2, int32 In3);
+	/** Benchmark callable node Lib014_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn074(bool In0, FVector& Out1, int32& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib014_Fn075 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn075(const FString& In0, float In1, bool In2);
+	/** Benchmark pure node Lib014_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn076(FString& Out0, FName In1, const FString& In2, int32& Out3, bool In4, int32 In5, const FString& In6);
+	/** Benchmark callable node Lib014_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn077();
+	/** Benchmark callable node Lib014_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn078(const FVector& In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, const FString& In4, FName In5, int32 In6);
+	/** Benchmark callable node Lib014_Fn079 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn079(const FVector& In0, const FVector& In1, FVector& Out2, FName In3, int32 In4, UObject* In5, bool In6);
+	/** Benchmark callable node Lib014_Fn080 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn080(const FTransform& In0, int32 In1, float In2, FName In3, float In4, FVector& Out5, FName In6, FVector& Out7);
+	/** Benchmark pure node Lib014_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn081(const FTransform& In0, FVector& Out1, bool In2, bool In3, float In4, const FString& In5, bool In6);
+	/** Benchmark latent node Lib014_Fn082 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib014_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn083();
+	/** Benchmark callable node Lib014_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn084(bool In0, int32 In1, FName In2, FVector& Out3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark callable node Lib014_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn085();
+	/** Benchmark callable node Lib014_Fn086 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn086(FName In0, FString& Out1, const FVector& In2, UObject* In3, bool In4, const FTransform& In5, FName In6, const FVector& In7);
+	/** Benchmark pure node Lib014_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn087(UObject* In0, const FTransform& In1);
+	/** Benchmark pure node Lib014_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn088(const FString& In0, const FString& In1, const FVector& In2, const FVector& In3);
+	/** Benchmark callable node Lib014_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn089();
+	/** Benchmark callable node Lib014_Fn090 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FString Lib014_Fn090(bool In0, FVector& Out1, int32 In2, int32& Out3, FString& Out4, FName In5, int32& Out6, bool In7);
+	/** Benchmark callable node Lib014_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn091(float In0, FName In1, UObject* In2, UObject* In3, const FString& In4);
+	/** Benchmark pure node Lib014_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn092();
+	/** Benchmark callable node Lib014_Fn093 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static float Lib014_Fn093(float In0);
+	/** Benchmark callable node Lib014_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn094(float In0, const TArray< int32 >& In1, const TArray< int32 >& In2);
+	/** Benchmark latent node Lib014_Fn095 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib014_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, bool In4, bool In5, FString& Out6);
+	/** Benchmark callable node Lib014_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static FVector Lib014_Fn096(FString& Out0, const TArray< int32 >& In1, int32& Out2, FName In3, const TArray< int32 >& In4, bool In5);
+	/** Benchmark callable node Lib014_Fn097 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static bool Lib014_Fn097(FName In0, FString& Out1, FVector& Out2, FString& Out3);
+	/** Benchmark callable node Lib014_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib014")
+	static void Lib014_Fn098();
+	/** Benchmark pure node Lib014_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib014")
+	static int32 Lib014_Fn099(const FString& In0, const FTransform& In1, const FTransform& In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_015 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib015_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn000(const FTransform& In0, const FString& In1, const FTransform& In2, FString& Out3, FName In4, int32& Out5);
+	/** Benchmark callable node Lib015_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn001(const FTransform& In0, FString& Out1, const TArray< int32 >& In2, FName In3, bool In4, const FString& In5);
+	/** Benchmark callable node Lib015_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn002(bool In0, const FString& In1, const TArray< int32 >& In2, const FTransform& In3, FName In4);
+	/** Benchmark callable node Lib015_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn003(FString& Out0, const FString& In1, FVector& Out2, const FVector& In3, bool In4, FVector& Out5, FName In6);
+	/** Benchmark pure node Lib015_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn004(int32 In0, int32 In1);
+	/** Benchmark callable node Lib015_Fn005 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn005(FVector& Out0, int32& Out1, FVector& Out2, float In3, float In4, FString& Out5);
+	/** Benchmark callable node Lib015_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn006(const FString& In0, const FVector& In1, int32& Out2);
+	/** Benchmark pure node Lib015_Fn007 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn007(const TArray< int32 >& In0, int32 In1, int32 In2, const FVector& In3, FString& Out4, FString& Out5, int32& Out6, const FString& In7);
+	/** Benchmark pure node Lib015_Fn008 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn008(FVector& Out0, const FTransform& In1, const FVector& In2, FName In3, int32& Out4);
+	/** Benchmark latent node Lib015_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32 In1, FVector& Out2, FString& Out3);
+	/** Benchmark callable node Lib015_Fn010 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn010(const FTransform& In0, const FTransform& In1, const FTransform& In2, float In3, const TArray< int32 >& In4, UObject* In5, const FVector& In6, FVector& Out7);
+	/** Benchmark callable node Lib015_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn011(FVector& Out0, UObject* In1, const TArray< int32 >& In2);
+	/** Benchmark latent node Lib015_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0);
+	/** Benchmark callable node Lib015_Fn013 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn013(UObject* In0, float In1, bool In2, const TArray< int32 >& In3, const FVector& In4, const FString& In5, const FTransform& In6);
+	/** Benchmark pure node Lib015_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn014(UObject* In0, int32& Out1, const FVector& In2);
+	/** Benchmark callable node Lib015_Fn015 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn015(FString& Out0, int32 In1, const FTransform& In2, FVector& Out3, const FString& In4);
+	/** Benchmark callable node Lib015_Fn016 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn016(const FVector& In0, FVector& Out1, FName In2, const FString& In3);
+	/** Benchmark callable node Lib015_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn017(FVector& Out0, FVector& Out1, int32& Out2);
+	/** Benchmark callable node Lib015_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn018(bool In0, int32& Out1, FString& Out2, int32 In3, bool In4, bool In5, int32& Out6);
+	/** Benchmark callable node Lib015_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn019();
+	/** Benchmark callable node Lib015_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn020(UObject* In0);
+	/** Benchmark callable node Lib015_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn021(bool In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark latent node Lib015_Fn022 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn022(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1, bool In2, const FString& In3);
+	/** Benchmark pure node Lib015_Fn023 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn023(float In0, FName In1, int32 In2, FVector& Out3);
+	/** Benchmark callable node Lib015_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn024(const FTransform& In0, int32& Out1, FVector& Out2, const FString& In3, int32& Out4, bool In5, const FTransform& In6, const FTransform& In7);
+	/** Benchmark callable node Lib015_Fn025 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn025(UObject* In0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib015_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn026(int32& Out0, float In1, const FVector& In2, const TArray< int32 >& In3, const FString& In4, FVector& Out5);
+	/** Benchmark callable node Lib015_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn027(float In0);
+	/** Benchmark latent node Lib015_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib015_Fn029 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn029(const FVector& In0, FName In1, const FVector& In2, float In3, const FString& In4, int32 In5);
+	/** Benchmark callable node Lib015_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn030(float In0, const FString& In1);
+	/** Benchmark pure node Lib015_Fn031 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn031(const FTransform& In0, FName In1, UObject* In2);
+	/** Benchmark callable node Lib015_Fn032 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn032(const FTransform& In0, UObject* In1);
+	/** Benchmark callable node Lib015_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn033(FName In0, FVector& Out1, FVector& Out2);
+	/** Benchmark callable node Lib015_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn034(FString& Out0, const FTransform& In1, FString& Out2, const FTransform& In3, FName In4, const FVector& In5);
+	/** Benchmark pure node Lib015_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn035(bool In0, int32 In1, const FVector& In2, int32 In3, const FVector& In4, float In5, const FVector& In6, const FVector& In7);
+	/** Benchmark latent node Lib015_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const TArray< int32 >& In1, int32& Out2, int32 In3);
+	/** Benchmark callable node Lib015_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn037();
+	/** Benchmark callable node Lib015_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn038(const FString& In0, int32& Out1, const FTransform& In2, FString& Out3, const FVector& In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib015_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn039(const FString& In0, const FString& In1, FName In2, UObject* In3, FVector& Out4, FVector& Out5, bool In6);
+	/** Benchmark callable node Lib015_Fn040 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn040();
+	/** Benchmark callable node Lib015_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn041(FName In0);
+	/** Benchmark callable node Lib015_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn042();
+	/** Benchmark callable node Lib015_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn043(const TArray< int32 >& In0, const FVector& In1, FName In2, const TArray< int32 >& In3, FVector& Out4);
+	/** Benchmark callable node Lib015_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn044(FVector& Out0, bool In1, FName In2, FName In3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib015_Fn045 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn045(FString& Out0, int32 In1, const FString& In2, const FVector& In3, bool In4, int32 In5);
+	/** Benchmark pure node Lib015_Fn046 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn046(int32 In0, const FTransform& In1, bool In2, int32 In3, int32 In4);
+	/** Benchmark pure node Lib015_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn047(int32 In0, UObject* In1, UObject* In2);
+	/** Benchmark callable node Lib015_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn048(const FString& In0, int32& Out1, int32 In2, bool In3, float In4, float In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib015_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn049(const FString& In0, int32 In1);
+	/** Benchmark callable node Lib015_Fn050 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn050(const FVector& In0, int32 In1, const FTransform& In2, FName In3, const TArray< int32 >& In4, const FVector& In5, const FString& In6, int32 In7);
+	/** Benchmark callable node Lib015_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn051(float In0, int32& Out1, UObject* In2, UObject* In3, UObject* In4);
+	/** Benchmark latent node Lib015_Fn052 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FVector& In1, UObject* In2, const FTransform& In3, const FTransform& In4, FVector& Out5, const FVector& In6);
+	/** Benchmark pure node Lib015_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn053();
+	/** Benchmark callable node Lib015_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn054(int32 In0, float In1, int32 In2, FString& Out3, const FString& In4, int32 In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib015_Fn055 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn055(FString& Out0, bool In1, FName In2, const FString& In3, bool In4, const FString& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib015_Fn056 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn056(int32& Out0, FName In1, FVector& Out2, const FString& In3, bool In4, float In5, float In6);
+	/** Benchmark callable node Lib015_Fn057 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn057(FVector& Out0, float In1, bool In2, float In3, FVector& Out4);
+	/** Benchmark callable node Lib015_Fn058 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn058(const TArray< int32 >& In0, FString& Out1, FName In2, int32 In3, const FString& In4, bool In5, float In6);
+	/** Benchmark callable node Lib015_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn059(const FString& In0, const FTransform& In1, bool In2, int32& Out3, FVector& Out4, FString& Out5, bool In6, FName In7);
+	/** Benchmark callable node Lib015_Fn060 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn060(const FString& In0);
+	/** Benchmark callable node Lib015_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn061(FName In0, UObject* In1, FVector& Out2, FVector& Out3, const FTransform& In4, const FVector& In5);
+	/** Benchmark callable node Lib015_Fn062 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn062(int32& Out0, UObject* In1, UObject* In2, FName In3, bool In4, float In5, const FTransform& In6, FString& Out7);
+	/** Benchmark pure node Lib015_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn063(float In0, UObject* In1, const FVector& In2);
+	/** Benchmark callable node Lib015_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn064(const FTransform& In0, FString& Out1, int32 In2);
+	/** Benchmark callable node Lib015_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn065(const FVector& In0);
+	/** Benchmark latent node Lib015_Fn066 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, bool In1, const FVector& In2, const FString& In3, bool In4, bool In5);
+	/** Benchmark callable node Lib015_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn067(float In0, FName In1, UObject* In2, const FTransform& In3, const FVector& In4);
+	/** Benchmark callable node Lib015_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn068(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib015_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn069(const FString& In0);
+	/** Benchmark pure node Lib015_Fn070 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn070(bool In0);
+	/** Benchmark pure node Lib015_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn071(FName In0);
+	/** Benchmark callable node Lib015_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn072();
+	/** Benchmark pure node Lib015_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn073(float In0, const FString& In1, int32 In2, int32& Out3, int32 In4);
+	/** Benchmark callable node Lib015_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn074(FName In0, UObject* In1);
+	/** Benchmark callable node Lib015_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn075(float In0, FVector& Out1, float In2, float In3);
+	/** Benchmark callable node Lib015_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn076(bool In0, float In1, FName In2, bool In3, UObject* In4);
+	/** Benchmark callable node Lib015_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn077(const FString& In0);
+	/** Benchmark pure node Lib015_Fn078 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn078(bool In0, int32 In1);
+	/** Benchmark callable node Lib015_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn079(FName In0, const FVector& In1, UObject* In2, int32& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib015_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn080(UObject* In0, int32 In1, FString& Out2);
+	/** Benchmark callable node Lib015_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn081();
+	/** Benchmark callable node Lib015_Fn082 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn082(UObject* In0);
+	/** Benchmark pure node Lib015_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static int32 Lib015_Fn083(UObject* In0, const FVector& In1, int32 In2, UObject* In3, FString& Out4);
+	/** Benchmark callable node Lib015_Fn084 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn084();
+	/** Benchmark callable node Lib015_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn085();
+	/** Benchmark pure node Lib015_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn086(int32 In0, int32 In1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4, const FTransform& In5, const FVector& In6);
+	/** Benchmark callable node Lib015_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn087(int32& Out0, FName In1, const FTransform& In2);
+	/** Benchmark pure node Lib015_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn088(UObject* In0, const FTransform& In1, UObject* In2, FVector& Out3);
+	/** Benchmark callable node Lib015_Fn089 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FString Lib015_Fn089(const FString& In0, FVector& Out1, int32 In2, FName In3, const FTransform& In4, float In5, FString& Out6);
+	/** Benchmark latent node Lib015_Fn090 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0);
+	/** Benchmark callable node Lib015_Fn091 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn091(int32 In0, float In1, float In2, bool In3, int32 In4, float In5, const FVector& In6);
+	/** Benchmark latent node Lib015_Fn092 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib015_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1, FString& Out2, FString& Out3, const FVector& In4, bool In5, int32& Out6);
+	/** Benchmark callable node Lib015_Fn093 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn093(const FTransform& In0);
+	/** Benchmark callable node Lib015_Fn094 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn094();
+	/** Benchmark callable node Lib015_Fn095 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn095(FName In0);
+	/** Benchmark callable node Lib015_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static bool Lib015_Fn096(const FVector& In0, FString& Out1, UObject* In2);
+	/** Benchmark callable node Lib015_Fn097 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static float Lib015_Fn097(FName In0, float In1, const FVector& In2, const FTransform& In3);
+	/** Benchmark callable node Lib015_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static FVector Lib015_Fn098(FVector& Out0, int32& Out1, FVector& Out2);
+	/** Benchmark callable node Lib015_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib015")
+	static void Lib015_Fn099(FName In0, const FString& In1, const FString& In2, int32& Out3, const TArray< int32 >& In4);
+};
+
+
+UCLASS()
+class UKDGBenchLib_016 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib016_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn000(bool In0, const FTransform& In1, bool In2);
+	/** Benchmark callable node Lib016_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn001(const FString& In0, FVector& Out1, FVector& Out2, const FString& In3, const FTransform& In4, bool In5, const FString& In6);
+	/** Benchmark callable node Lib016_Fn002 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn002(float In0);
+	/** Benchmark callable node Lib016_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn003(int32 In0, int32 In1, const FString& In2, const TArray< int32 >& In3, bool In4, float In5);
+	/** Benchmark pure node Lib016_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn004(const FString& In0, const FTransform& In1);
+	/** Benchmark pure node Lib016_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn005(const FVector& In0, int32& Out1, FString& Out2, int32& Out3, const FString& In4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark latent node Lib016_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib016_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib016_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn008(bool In0, UObject* In1, FString& Out2, float In3, UObject* In4, const FTransform& In5);
+	/** Benchmark callable node Lib016_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn009(const FVector& In0);
+	/** Benchmark callable node Lib016_Fn010 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn010(int32& Out0, FVector& Out1);
+	/** Benchmark latent node Lib016_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32& Out1, FVector& Out2, int32& Out3, float In4, FName In5);
+	/** Benchmark pure node Lib016_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn012(FName In0, int32& Out1, int32 In2);
+	/** Benchmark callable node Lib016_Fn013 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn013(int32 In0, FName In1, const FVector& In2, const TArray< int32 >& In3, const FTransform& In4, const FVector& In5, UObject* In6, FString& Out7);
+	/** Benchmark callable node Lib016_Fn014 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn014(bool In0, FVector& Out1, float In2, float In3, int32& Out4, bool In5);
+	/** Benchmark pure node Lib016_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn015(FString& Out0, int32& Out1, const FTransform& In2, FVector& Out3);
+	/** Benchmark pure node Lib016_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn016(float In0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib016_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn017(FName In0, int32 In1, FName In2, UObject* In3, float In4, FVector& Out5, float In6, UObject* In7);
+	/** Benchmark pure node Lib016_Fn018 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn018();
+	/** Benchmark callable node Lib016_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn019(UObject* In0, bool In1, bool In2, const FString& In3);
+	/** Benchmark callable node Lib016_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn020(FName In0, const FTransform& In1, int32 In2, UObject* In3, FVector& Out4, const FString& In5, const FString& In6, UObject* In7);
+	/** Benchmark callable node Lib016_Fn021 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn021(const FTransform& In0);
+	/** Benchmark pure node Lib016_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn022(UObject* In0, const TArray< int32 >& In1, FString& Out2, int32 In3, bool In4, FVector& Out5, FVector& Out6);
+	/** Benchmark pure node Lib016_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn023();
+	/** Benchmark pure node Lib016_Fn024 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn024(float In0, const FString& In1, FName In2, FString& Out3);
+	/** Benchmark callable node Lib016_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static void Lib016_Fn025(const TArray< int32 >& In0, UObject* In1, int32& Out2, const FString& In3, float In4, const FString& In5, bool In6, bool In7);
+	/** Benchmark latent node Lib016_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib016_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn027(const FTransform& In0);
+	/** Benchmark callable node Lib016_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn028(bool In0, int32& Out1, UObject* In2, float In3, FName In4, int32& Out5, const FString& In6);
+	/** Benchmark callable node Lib016_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn029(const TArray< int32 >& In0, FVector& Out1, const FTransform& In2, FName In3, const FTransform& In4);
+	/** Benchmark pure node Lib016_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn030(const FTransform& In0, FVector& Out1, const FString& In2, const FTransform& In3, bool In4, UObject* In5, bool In6, FVector& Out7);
+	/** Benchmark callable node Lib016_Fn031 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn031(FVector& Out0, float In1, FString& Out2, bool In3, const FTransform& In4, const FVector& In5);
+	/** Benchmark latent node Lib016_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, UObject* In1);
+	/** Benchmark pure node Lib016_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn033();
+	/** Benchmark callable node Lib016_Fn034 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn034();
+	/** Benchmark callable node Lib016_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn035(UObject* In0, bool In1, FName In2);
+	/** Benchmark callable node Lib016_Fn036 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn036(const FString& In0, const FVector& In1, float In2);
+	/** Benchmark pure node Lib016_Fn037 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn037(bool In0);
+	/** Benchmark latent node Lib016_Fn038 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FTransform& In1, int32& Out2);
+	/** Benchmark callable node Lib016_Fn039 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn039(FString& Out0, int32 In1, float In2);
+	/** Benchmark pure node Lib016_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn040(FString& Out0, FString& Out1, int32& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib016_Fn041 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn041(bool In0, FVector& Out1, float In2, const FVector& In3, FName In4, FVector& Out5, FVector& Out6);
+	/** Benchmark callable node Lib016_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn042(const TArray< int32 >& In0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib016_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn043(FString& Out0, int32 In1, const TArray< int32 >& In2, FVector& Out3, const FString& In4, const FTransform& In5);
+	/** Benchmark callable node Lib016_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn044(int32 In0, bool In1, const TArray< int32 >& In2, const FTransform& In3, FName In4);
+	/** Benchmark callable node Lib016_Fn045 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn045(int32 In0, FName In1, bool In2, FString& Out3, FString& Out4, float In5);
+	/** Benchmark latent node Lib016_Fn046 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1, int32 In2, int32& Out3, UObject* In4, const FTransform& In5, UObject* In6);
+	/** Benchmark callable node Lib016_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn047(FVector& Out0, FName In1);
+	/** Benchmark latent node Lib016_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn048(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FVector& Out1, const FTransform& In2, const FTransform& In3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib016_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn049(int32 In0, const FString& In1);
+	/** Benchmark callable node Lib016_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static void Lib016_Fn050(int32& Out0, int32& Out1, float In2, UObject* In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib016_Fn051 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn051(float In0, int32& Out1, const FVector& In2, UObject* In3, UObject* In4, FString& Out5, int32& Out6);
+	/** Benchmark pure node Lib016_Fn052 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn052(const FString& In0, bool In1, UObject* In2, UObject* In3, FName In4, bool In5);
+	/** Benchmark callable node Lib016_Fn053 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn053(const FTransform& In0, bool In1, int32 In2, UObject* In3, const FVector& In4, FName In5, FName In6, FName In7);
+	/** Benchmark callable node Lib016_Fn054 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn054(int32 In0, UObject* In1, UObject* In2);
+	/** Benchmark latent node Lib016_Fn055 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, const FTransform& In2, UObject* In3, const FTransform& In4, FVector& Out5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib016_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn056(const FTransform& In0, const FTransform& In1, const FString& In2, bool In3, int32 In4, int32 In5);
+	/** Benchmark callable node Lib016_Fn057 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn057(float In0, const FString& In1, FName In2, bool In3, const FVector& In4);
+	/** Benchmark callable node Lib016_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn058(int32& Out0, const FString& In1, const FVector& In2, FString& Out3);
+	/** Benchmark pure node Lib016_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn059(UObject* In0, const FTransform& In1, bool In2);
+	/** Benchmark pure node Lib016_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn060(const TArray< int32 >& In0, int32& Out1, bool In2, UObject* In3, UObject* In4, int32& Out5, const TArray< int32 >& In6, const FVector& In7);
+	/** Benchmark pure node Lib016_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn061(UObject* In0);
+	/** Benchmark latent node Lib016_Fn062 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FTransform& In1, int32 In2, int32& Out3, FString& Out4, UObject* In5, int32& Out6, const FString& In7);
+	/** Benchmark latent node Lib016_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark pure node Lib016_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn064(const FTransform& In0, int32& Out1, float In2, bool In3);
+	/** Benchmark pure node Lib016_Fn065 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn065(FVector& Out0, bool In1, bool In2, UObject* In3);
+	/** Benchmark callable node Lib016_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn066(bool In0, FVector& Out1, const FVector& In2, FName In3, const FString& In4, FVector& Out5);
+	/** Benchmark callable node Lib016_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn067(bool In0, FName In1, int32 In2, FString& Out3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib016_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn068(FName In0, UObject* In1, int32& Out2, int32 In3, bool In4);
+	/** Benchmark pure node Lib016_Fn069 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn069(const TArray< int32 >& In0, const FVector& In1, FName In2, const FTransform& In3, int32 In4, const TArray< int32 >& In5, const FString& In6);
+	/** Benchmark pure node Lib016_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn070(FVector& Out0, int32& Out1, FVector& Out2);
+	/** Benchmark callable node Lib016_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn071();
+	/** Benchmark callable node Lib016_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn072(FName In0, const FString& In1, FVector& Out2, float In3, const TArray< int32 >& In4, int32 In5);
+	/** Benchmark callable node Lib016_Fn073 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn073(const FTransform& In0, FName In1, int32 In2, FVector& Out3);
+	/** Benchmark callable node Lib016_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn074(const TArray< int32 >& In0, FString& Out1, float In2, UObject* In3, int32& Out4, FString& Out5);
+	/** Benchmark callable node Lib016_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn075(const FTransform& In0, const FTransform& In1, const FVector& In2, FString& Out3, bool In4, FVector& Out5, int32 In6, FVector& Out7);
+	/** Benchmark callable node Lib016_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static void Lib016_Fn076(int32& Out0, FString& Out1, FVector& Out2, UObject* In3, int32& Out4, FVector& Out5, const FString& In6);
+	/** Benchmark latent node Lib016_Fn077 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FString& Out1, int32& Out2, const FTransform& In3, bool In4, FName In5, const TArray< int32 >& In6, float In7);
+	/** Benchmark latent node Lib016_Fn078 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn078(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FVector& In1, bool In2, int32 In3, FVector& Out4, int32& Out5, float In6);
+	/** Benchmark callable node Lib016_Fn079 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn079(const FString& In0, UObject* In1, const FString& In2, const TArray< int32 >& In3, const FString& In4, bool In5);
+	/** Benchmark pure node Lib016_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn080(int32& Out0, bool In1, UObject* In2, int32 In3, const FTransform& In4);
+	/** Benchmark callable node Lib016_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn081();
+	/** Benchmark callable node Lib016_Fn082 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static bool Lib016_Fn082(int32 In0);
+	/** Benchmark latent node Lib016_Fn083 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32 In1, FVector& Out2, FName In3, UObject* In4, const FTransform& In5, UObject* In6, const FVector& In7);
+	/** Benchmark pure node Lib016_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn084(FString& Out0, float In1, const FVector& In2, const FVector& In3, bool In4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib016_Fn085 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn085(FVector& Out0, int32 In1, FString& Out2, const FString& In3, int32 In4);
+	/** Benchmark pure node Lib016_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn086(UObject* In0, FVector& Out1, int32 In2, FName In3);
+	/** Benchmark callable node Lib016_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static void Lib016_Fn087();
+	/** Benchmark latent node Lib016_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn088(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, float In2, FName In3, bool In4);
+	/** Benchmark callable node Lib016_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static int32 Lib016_Fn089(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib016_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn090(const TArray< int32 >& In0, const FTransform& In1, FString& Out2, const TArray< int32 >& In3, float In4, UObject* In5, int32 In6);
+	/** Benchmark callable node Lib016_Fn091 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn091();
+	/** Benchmark latent node Lib016_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib016_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn093(const FString& In0, const FVector& In1, const TArray< int32 >& In2, FName In3, const FString& In4, int32& Out5);
+	/** Benchmark latent node Lib016_Fn094 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib016_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, float In2, int32& Out3);
+	/** Benchmark callable node Lib016_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn095(const TArray< int32 >& In0, FString& Out1, const TArray< int32 >& In2, bool In3, FName In4, const FTransform& In5, const TArray< int32 >& In6, const FString& In7);
+	/** Benchmark pure node Lib016_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib016")
+	static FVector Lib016_Fn096(const FString& In0, float In1, const TArray< int32 >& In2, int32& Out3, float In4);
+	/** Benchmark callable node Lib016_Fn097 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static float Lib016_Fn097();
+	/** Benchmark callable node Lib016_Fn098 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static FString Lib016_Fn098(FString& Out0);
+	/** Benchmark callable node Lib016_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib016")
+	static void Lib016_Fn099(FVector& Out0, const FString& In1, const TArray< int32 >& In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_017 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib017_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn000(const FTransform& In0, int32 In1);
+	/** Benchmark latent node Lib017_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, int32& Out1, const FTransform& In2, int32& Out3, int32 In4, FString& Out5);
+	/** Benchmark callable node Lib017_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn002(FName In0, const TArray< int32 >& In1, FVector& Out2, UObject* In3, FString& Out4, FString& Out5, const FVector& In6, int32& Out7);
+	/** Benchmark callable node Lib017_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn003(const FString& In0, bool In1, bool In2, FString& Out3, bool In4, FVector& Out5, bool In6);
+	/** Benchmark callable node Lib017_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn004(const FString& In0);
+	/** Benchmark pure node Lib017_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn005(const FString& In0, FString& Out1, FString& Out2, FVector& Out3, UObject* In4, const FTransform& In5, const FTransform& In6);
+	/** Benchmark pure node Lib017_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn006(const FVector& In0, int32 In1, FString& Out2, FString& Out3);
+	/** Benchmark latent node Lib017_Fn007 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1, UObject* In2, const FString& In3, FString& Out4, int32 In5, bool In6);
+	/** Benchmark callable node Lib017_Fn008 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn008(int32 In0, int32& Out1, const FVector& In2, int32 In3);
+	/** Benchmark callable node Lib017_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn009(const TArray< int32 >& In0, bool In1, int32& Out2, FName In3);
+	/** Benchmark latent node Lib017_Fn010 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, const FTransform& In2, int32& Out3, const FVector& In4, const FTransform& In5);
+	/** Benchmark latent node Lib017_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FTransform& In1, const FTransform& In2, const FTransform& In3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib017_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn012(int32 In0);
+	/** Benchmark callable node Lib017_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn013(int32 In0, const FTransform& In1, UObject* In2, const FTransform& In3, const FString& In4);
+	/** Benchmark callable node Lib017_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn014(FName In0, float In1, const TArray< int32 >& In2);
+	/** Benchmark latent node Lib017_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1, const FTransform& In2, float In3, const FString& In4, const FVector& In5);
+	/** Benchmark callable node Lib017_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn016(FString& Out0, const FVector& In1, float In2, int32& Out3, bool In4, const FTransform& In5);
+	/** Benchmark callable node Lib017_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn017(int32& Out0, const TArray< int32 >& In1, const FString& In2, const FVector& In3, int32& Out4, bool In5, bool In6, const FTransform& In7);
+	/** Benchmark callable node Lib017_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn018(FVector& Out0, float In1, FVector& Out2, const FString& In3, int32& Out4);
+	/** Benchmark callable node Lib017_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn019(FString& Out0, float In1, bool In2, int32& Out3, bool In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib017_Fn020 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn020(UObject* In0, int32& Out1);
+	/** Benchmark pure node Lib017_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn021(FString& Out0, int32 In1, const TArray< int32 >& In2, FString& Out3, bool In4, const FString& In5, FString& Out6, FName In7);
+	/** Benchmark pure node Lib017_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn022(UObject* In0, const FString& In1, float In2, FString& Out3, const FVector& In4, int32& Out5, bool In6);
+	/** Benchmark pure node Lib017_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn023(FName In0);
+	/** Benchmark callable node Lib017_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn024(bool In0);
+	/** Benchmark callable node Lib017_Fn025 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn025();
+	/** Benchmark pure node Lib017_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn026(const FTransform& In0, float In1, const FString& In2, int32& Out3);
+	/** Benchmark callable node Lib017_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn027(const TArray< int32 >& In0, int32 In1);
+	/** Benchmark callable node Lib017_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn028(bool In0, float In1);
+	/** Benchmark callable node Lib017_Fn029 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn029(const TArray< int32 >& In0, const FVector& In1);
+	/** Benchmark callable node Lib017_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn030(FString& Out0, int32& Out1, bool In2, FName In3);
+	/** Benchmark callable node Lib017_Fn031 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn031(const FTransform& In0, const TArray< int32 >& In1, const FVector& In2, bool In3, float In4, FName In5);
+	/** Benchmark pure node Lib017_Fn032 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn032(FVector& Out0, FVector& Out1, const FVector& In2, UObject* In3, const FVector& In4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark callable node Lib017_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn033(bool In0, UObject* In1, FVector& Out2, FVector& Out3, int32 In4, FName In5);
+	/** Benchmark callable node Lib017_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn034(bool In0, FString& Out1, bool In2, float In3, float In4, UObject* In5);
+	/** Benchmark pure node Lib017_Fn035 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn035(int32 In0, const FString& In1, UObject* In2, const FVector& In3);
+	/** Benchmark callable node Lib017_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn036(float In0, int32 In1, int32& Out2, const FTransform& In3, int32 In4);
+	/** Benchmark callable node Lib017_Fn037 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn037(int32& Out0, const TArray< int32 >& In1, UObject* In2);
+	/** Benchmark callable node Lib017_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn038(const TArray< int32 >& In0, const FTransform& In1, const FTransform& In2, FString& Out3);
+	/** Benchmark callable node Lib017_Fn039 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn039(FName In0, FName In1, float In2, float In3, FVector& Out4, const FString& In5);
+	/** Benchmark callable node Lib017_Fn040 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn040(UObject* In0, const FVector& In1, const FString& In2);
+	/** Benchmark pure node Lib017_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn041(const FString& In0, const FString& In1, UObject* In2, int32& Out3);
+	/** Benchmark callable node Lib017_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn042();
+	/** Benchmark callable node Lib017_Fn043 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn043(FName In0, const TArray< int32 >& In1, int32 In2, const TArray< int32 >& In3, UObject* In4, float In5, FString& Out6, FVector& Out7);
+	/** Benchmark latent node Lib017_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, bool In1, float In2, const FTransform& In3, const FTransform& In4, FVector& Out5);
+	/** Benchmark callable node Lib017_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn045(bool In0, const FVector& In1, const FTransform& In2);
+	/** Benchmark latent node Lib017_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib017_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn047(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib017_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn048(FName In0, FName In1, FVector& Out2, FVector& Out3);
+	/** Benchmark callable node Lib017_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn049(bool In0, const FString& In1, FString& Out2, const FVector& In3, const FVector& In4, FVector& Out5);
+	/** Benchmark pure node Lib017_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn050(FVector& Out0, FString& Out1);
+	/** Benchmark pure node Lib017_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn051(int32 In0);
+	/** Benchmark callable node Lib017_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn052();
+	/** Benchmark callable node Lib017_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn053();
+	/** Benchmark pure node Lib017_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn054(UObject* In0, int32& Out1, int32& Out2, FString& Out3, UObject* In4, float In5, const FString& In6);
+	/** Benchmark pure node Lib017_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn055(const TArray< int32 >& In0, int32 In1, bool In2, int32& Out3);
+	/** Benchmark pure node Lib017_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn056(bool In0, int32& Out1, int32& Out2, FVector& Out3, int32 In4, const FTransform& In5);
+	/** Benchmark pure node Lib017_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn057(FName In0, const FVector& In1, const FTransform& In2, FString& Out3, const FVector& In4, FString& Out5, FString& Out6);
+	/** Benchmark callable node Lib017_Fn058 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn058(const FVector& In0, FName In1, UObject* In2, UObject* In3, FName In4, int32 In5, const FVector& In6);
+	/** Benchmark callable node Lib017_Fn059 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn059(UObject* In0, const TArray< int32 >& In1, int32 In2, bool In3, float In4);
+	/** Benchmark callable node Lib017_Fn060 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn060(FVector& Out0, FVector& Out1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib017_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn061(int32& Out0, const FString& In1, float In2, bool In3, bool In4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib017_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn062(FVector& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib017_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn063(UObject* In0, UObject* In1, FName In2);
+	/** Benchmark pure node Lib017_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn064(FName In0, int32& Out1, const FVector& In2);
+	/** Benchmark callable node Lib017_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn065(const FString& In0, float In1, float In2, const FVector& In3, float In4, bool In5, const FString& In6, int32 In7);
+	/** Benchmark callable node Lib017_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn066(const FVector& In0, const FVector& In1, const FString& In2, const FTransform& In3, float In4, const FTransform& In5, FString& Out6);
+	/** Benchmark callable node Lib017_Fn067 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn067();
+	/** Benchmark pure node Lib017_Fn068 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn068(const FVector& In0, int32 In1, UObject* In2, UObject* In3);
+	/** Benchmark pure node Lib017_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn069(const FVector& In0, const TArray< int32 >& In1, const FString& In2, float In3);
+	/** Benchmark callable node Lib017_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn070(FName In0, int32 In1, float In2);
+	/** Benchmark pure node Lib017_Fn071 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn071(FString& Out0, int32 In1, int32 In2, FName In3, int32& Out4, int32& Out5, UObject* In6, int32 In7);
+	/** Benchmark callable node Lib017_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn072();
+	/** Benchmark pure node Lib017_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn073(float In0, int32& Out1, FName In2);
+	/** Benchmark pure node Lib017_Fn074 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn074(bool In0, const FString& In1, float In2, FName In3, int32& Out4);
+	/** Benchmark callable node Lib017_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn075(int32& Out0, FVector& Out1, int32 In2, UObject* In3, float In4, float In5, const FVector& In6);
+	/** Benchmark callable node Lib017_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static float Lib017_Fn076(bool In0, UObject* In1);
+	/** Benchmark callable node Lib017_Fn077 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn077(UObject* In0, const FTransform& In1, FName In2, int32 In3);
+	/** Benchmark callable node Lib017_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn078();
+	/** Benchmark pure node Lib017_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static FVector Lib017_Fn079();
+	/** Benchmark pure node Lib017_Fn080 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn080(const FString& In0, FString& Out1, const FString& In2, int32 In3, FName In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib017_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn081(const FString& In0, int32 In1, FString& Out2, FString& Out3, UObject* In4, const FString& In5, UObject* In6);
+	/** Benchmark callable node Lib017_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn082(const FString& In0, FString& Out1, const FTransform& In2);
+	/** Benchmark pure node Lib017_Fn083 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn083(int32 In0, bool In1, int32 In2, const FVector& In3, FName In4, int32& Out5, FVector& Out6, FString& Out7);
+	/** Benchmark latent node Lib017_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark pure node Lib017_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn085(const FString& In0, FString& Out1, const FVector& In2, const TArray< int32 >& In3, const FTransform& In4, int32 In5, int32 In6, const FString& In7);
+	/** Benchmark pure node Lib017_Fn086 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn086();
+	/** Benchmark pure node Lib017_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn087();
+	/** Benchmark callable node Lib017_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn088(bool In0, int32 In1, const FVector& In2);
+	/** Benchmark latent node Lib017_Fn089 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib017_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FString& Out1, const FTransform& In2, int32 In3, const TArray< int32 >& In4, const FTransform& In5, FVector& Out6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib017_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn090(const FVector& In0, FVector& Out1);
+	/** Benchmark pure node Lib017_Fn091 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn091(const TArray< int32 >& In0, UObject* In1, const FString& In2);
+	/** Benchmark callable node Lib017_Fn092 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn092(int32 In0, int32 In1, FName In2, UObject* In3, int32& Out4, FName In5, const TArray< int32 >& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib017_Fn093 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static bool Lib017_Fn093(FString& Out0, bool In1, bool In2, const FVector& In3, const FVector& In4);
+	/** Benchmark callable node Lib017_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn094(const FVector& In0);
+	/** Benchmark callable node Lib017_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn095(FName In0, const FVector& In1, UObject* In2, FString& Out3);
+	/** Benchmark callable node Lib017_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static int32 Lib017_Fn096(int32 In0, const FString& In1, const TArray< int32 >& In2, FName In3, FString& Out4, int32 In5);
+	/** Benchmark callable node Lib017_Fn097 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn097(int32 In0, int32 In1, const FTransform& In2, int32& Out3, int32 In4, bool In5, FName In6, UObject* In7);
+	/** Benchmark callable node Lib017_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static void Lib017_Fn098(const TArray< int32 >& In0, bool In1, const FVector& In2, FVector& Out3, int32 In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib017_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib017")
+	static FString Lib017_Fn099(float In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_018 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib018_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn000(FString& Out0, UObject* In1, const FString& In2, int32 In3, FVector& Out4, UObject* In5);
+	/** Benchmark pure node Lib018_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn001(const FString& In0, FVector& Out1, const FVector& In2, const FString& In3);
+	/** Benchmark callable node Lib018_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn002(int32 In0, float In1, int32& Out2, FName In3, const FTransform& In4);
+	/** Benchmark pure node Lib018_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn003(const FVector& In0, const FString& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib018_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn004(int32 In0);
+	/** Benchmark callable node Lib018_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn005(const FTransform& In0, FName In1, int32 In2, int32& Out3, FVector& Out4, float In5, const FVector& In6, const FVector& In7);
+	/** Benchmark callable node Lib018_Fn006 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn006(int32& Out0, bool In1, const FString& In2, const FTransform& In3, FVector& Out4, int32& Out5);
+	/** Benchmark callable node Lib018_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn007(const TArray< int32 >& In0, FName In1, const FTransform& In2, const FVector& In3, bool In4);
+	/** Benchmark callable node Lib018_Fn008 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn008(FString& Out0, bool In1, UObject* In2, float In3, FString& Out4, int32& Out5, FVector& Out6);
+	/** Benchmark callable node Lib018_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn009(float In0, float In1, FVector& Out2, const FString& In3, const FString& In4, UObject* In5, const FTransform& In6, const FString& In7);
+	/** Benchmark callable node Lib018_Fn010 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn010(float In0);
+	/** Benchmark callable node Lib018_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn011(int32& Out0, bool In1, const FString& In2, FVector& Out3, const FTransform& In4, float In5, int32 In6, FName In7);
+	/** Benchmark pure node Lib018_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn012(int32 In0, FVector& Out1, float In2);
+	/** Benchmark callable node Lib018_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn013(UObject* In0, float In1);
+	/** Benchmark latent node Lib018_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1, float In2);
+	/** Benchmark callable node Lib018_Fn015 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn015(FString& Out0, FString& Out1);
+	/** Benchmark callable node Lib018_Fn016 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn016(int32 In0, const FString& In1, bool In2, FVector& Out3);
+	/** Benchmark pure node Lib018_Fn017 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn017(UObject* In0, const FVector& In1, int32 In2, int32& Out3, const FString& In4, bool In5, float In6);
+	/** Benchmark pure node Lib018_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn018(FVector& Out0);
+	/** Benchmark pure node Lib018_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn019(int32 In0, const FTransform& In1, FString& Out2, UObject* In3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark pure node Lib018_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn020(bool In0, FVector& Out1, int32& Out2, FString& Out3, const FTransform& In4, int32& Out5, const FString& In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib018_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn021(const TArray< int32 >& In0, const FString& In1, int32& Out2, const TArray< int32 >& In3, FName In4, UObject* In5, const FString& In6, bool In7);
+	/** Benchmark callable node Lib018_Fn022 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn022();
+	/** Benchmark pure node Lib018_Fn023 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn023(float In0, int32& Out1, const FVector& In2, bool In3, int32 In4, int32& Out5, FName In6, FName In7);
+	/** Benchmark callable node Lib018_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn024(int32 In0, FName In1, int32 In2, int32 In3, float In4, FVector& Out5);
+	/** Benchmark callable node Lib018_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn025(FVector& Out0, const TArray< int32 >& In1, float In2, FString& Out3);
+	/** Benchmark callable node Lib018_Fn026 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn026(FName In0);
+	/** Benchmark latent node Lib018_Fn027 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32 In1, const FString& In2, bool In3, const TArray< int32 >& In4, const FString& In5);
+	/** Benchmark pure node Lib018_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn028(const FVector& In0, bool In1, const TArray< int32 >& In2, FVector& Out3, int32& Out4, const FVector& In5);
+	/** Benchmark callable node Lib018_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn029();
+	/** Benchmark pure node Lib018_Fn030 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn030(FString& Out0, FName In1, bool In2, FString& Out3, FName In4);
+	/** Benchmark callable node Lib018_Fn031 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn031(bool In0, const FString& In1, int32& Out2, bool In3, const TArray< int32 >& In4, FName In5, FVector& Out6, FName In7);
+	/** Benchmark pure node Lib018_Fn032 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn032(FString& Out0, bool In1);
+	/** Benchmark pure node Lib018_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn033(int32& Out0, int32 In1, const TArray< int32 >& In2, int32& Out3, const FVector& In4);
+	/** Benchmark pure node Lib018_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn034(UObject* In0, int32& Out1);
+	/** Benchmark latent node Lib018_Fn035 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn035(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib018_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn036(FVector& Out0, FName In1, FName In2, FString& Out3, const FVector& In4);
+	/** Benchmark callable node Lib018_Fn037 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn037(const FTransform& In0, int32 In1, int32 In2, float In3, FVector& Out4, const FString& In5, FString& Out6, const FString& In7);
+	/** Benchmark callable node Lib018_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn038(float In0, const FString& In1, int32& Out2, const FTransform& In3, const FVector& In4, FName In5);
+	/** Benchmark callable node Lib018_Fn039 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn039(int32& Out0, UObject* In1, const FString& In2, FName In3, const TArray< int32 >& In4, int32& Out5);
+	/** Benchmark pure node Lib018_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn040(const FVector& In0, int32& Out1, bool In2, bool In3, const FTransform& In4);
+	/** Benchmark callable node Lib018_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn041(FString& Out0, FName In1, FString& Out2);
+	/** Benchmark pure node Lib018_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn042(const FString& In0, int32& Out1, int32& Out2);
+	/** Benchmark latent node Lib018_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0);
+	/** Benchmark callable node Lib018_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn044();
+	/** Benchmark callable node Lib018_Fn045 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn045();
+	/** Benchmark callable node Lib018_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn046(FVector& Out0);
+	/** Benchmark callable node Lib018_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn047(int32& Out0, FName In1);
+	/** Benchmark callable node Lib018_Fn048 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn048(bool In0, const FString& In1, const FVector& In2, bool In3, FName In4, FString& Out5);
+	/** Benchmark pure node Lib018_Fn049 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn049(FString& Out0);
+	/** Benchmark callable node Lib018_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn050(float In0, bool In1, int32& Out2, const TArray< int32 >& In3, FString& Out4);
+	/** Benchmark callable node Lib018_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn051(const TArray< int32 >& In0, int32 In1, const TArray< int32 >& In2, const FString& In3, bool In4, bool In5);
+	/** Benchmark latent node Lib018_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FString& Out1);
+	/** Benchmark callable node Lib018_Fn053 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn053(const FString& In0, UObject* In1, int32& Out2, FName In3, FName In4);
+	/** Benchmark pure node Lib018_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn054(int32 In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib018_Fn055 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn055(const FTransform& In0);
+	/** Benchmark callable node Lib018_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn056(const FTransform& In0, bool In1, FString& Out2, FString& Out3);
+	/** Benchmark pure node Lib018_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn057(FString& Out0, FName In1, bool In2);
+	/** Benchmark callable node Lib018_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn058(int32& Out0, const FString& In1, FName In2, const TArray< int32 >& In3, const FVector& In4);
+	/** Benchmark callable node Lib018_Fn059 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn059(float In0, const FTransform& In1);
+	/** Benchmark pure node Lib018_Fn060 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn060(const FTransform& In0);
+	/** Benchmark pure node Lib018_Fn061 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn061(UObject* In0, bool In1, int32& Out2);
+	/** Benchmark pure node Lib018_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn062(const FTransform& In0, const FTransform& In1, bool In2, int32 In3, float In4, const FTransform& In5, FName In6);
+	/** Benchmark callable node Lib018_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn063(FString& Out0);
+	/** Benchmark callable node Lib018_Fn064 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn064(FName In0);
+	/** Benchmark callable node Lib018_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn065();
+	/** Benchmark callable node Lib018_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn066();
+	/** Benchmark pure node Lib018_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn067(FVector& Out0, UObject* In1, int32 In2, int32& Out3, FName In4);
+	/** Benchmark latent node Lib018_Fn068 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, int32 In1, int32& Out2, int32& Out3, UObject* In4, const TArray< int32 >& In5, int32 In6);
+	/** Benchmark callable node Lib018_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn069(const FTransform& In0);
+	/** Benchmark callable node Lib018_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn070(const FTransform& In0, FString& Out1, float In2, FVector& Out3, const FVector& In4, const FString& In5, const FVector& In6);
+	/** Benchmark latent node Lib018_Fn071 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, const TArray< int32 >& In2, const FString& In3, FVector& Out4, const TArray< int32 >& In5, FName In6, const FVector& In7);
+	/** Benchmark callable node Lib018_Fn072 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn072(const FVector& In0, FVector& Out1, const FString& In2, const FTransform& In3, bool In4, const TArray< int32 >& In5, FVector& Out6, float In7);
+	/** Benchmark callable node Lib018_Fn073 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn073(const FVector& In0, int32 In1);
+	/** Benchmark callable node Lib018_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn074(const TArray< int32 >& In0, FName In1);
+	/** Benchmark callable node Lib018_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn075(FVector& Out0, UObject* In1);
+	/** Benchmark pure node Lib018_Fn076 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn076(int32& Out0, int32 In1, const FVector& In2, float In3, const FTransform& In4, float In5, const TArray< int32 >& In6, const FVector& In7);
+	/** Benchmark callable node Lib018_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FVector Lib018_Fn077(bool In0, FString& Out1);
+	/** Benchmark callable node Lib018_Fn078 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn078(float In0, const FVector& In1, const FString& In2, FName In3, int32& Out4, FName In5);
+	/** Benchmark pure node Lib018_Fn079 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn079(const FVector& In0, const FString& In1, const FTransform& In2, bool In3, FString& Out4, FVector& Out5);
+	/** Benchmark pure node Lib018_Fn080 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn080(UObject* In0, int32& Out1, int32 In2, FName In3, FString& Out4, const FString& In5, FString& Out6);
+	/** Benchmark callable node Lib018_Fn081 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn081(const FTransform& In0);
+	/** Benchmark callable node Lib018_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn082(FString& Out0, float In1, const FString& In2);
+	/** Benchmark callable node Lib018_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn083(const FTransform& In0, FName In1);
+	/** Benchmark callable node Lib018_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn084(UObject* In0, const FTransform& In1, bool In2);
+	/** Benchmark callable node Lib018_Fn085 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn085(const FTransform& In0, FVector& Out1, FName In2, const FVector& In3, UObject* In4, FVector& Out5);
+	/** Benchmark callable node Lib018_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn086(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FVector& In3, int32 In4);
+	/** Benchmark callable node Lib018_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn087(const FString& In0, FVector& Out1, FName In2, FName In3, const FVector& In4, int32& Out5, FName In6);
+	/** Benchmark callable node Lib018_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn088(int32 In0, int32 In1, bool In2, const FString& In3, float In4, float In5);
+	/** Benchmark callable node Lib018_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn089();
+	/** Benchmark callable node Lib018_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static FString Lib018_Fn090(FVector& Out0, FVector& Out1, UObject* In2, float In3);
+	/** Benchmark callable node Lib018_Fn091 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn091(FString& Out0, float In1, const FVector& In2);
+	/** Benchmark pure node Lib018_Fn092 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn092(const TArray< int32 >& In0, UObject* In1, const FTransform& In2, UObject* In3, int32& Out4, float In5, UObject* In6, int32& Out7);
+	/** Benchmark callable node Lib018_Fn093 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static bool Lib018_Fn093(const FTransform& In0, float In1, const TArray< int32 >& In2, const FString& In3, const FVector& In4, int32& Out5, UObject* In6);
+	/** Benchmark callable node Lib018_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn094(const TArray< int32 >& In0, const FVector& In1);
+	/** Benchmark latent node Lib018_Fn095 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib018_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, FVector& Out2, FString& Out3, FName In4, FString& Out5, const FVector& In6, FString& Out7);
+	/** Benchmark callable node Lib018_Fn096 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static void Lib018_Fn096(const TArray< int32 >& In0, FString& Out1, const FVector& In2, float In3, const FString& In4, const FTransform& In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib018_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn097(FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib018_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static int32 Lib018_Fn098(UObject* In0, int32 In1, bool In2);
+	/** Benchmark callable node Lib018_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib018")
+	static float Lib018_Fn099(FName In0, const FTransform& In1, FName In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_019 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib019_Fn000 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FString& Out1, FString& Out2, const FString& In3, float In4, int32 In5, const FVector& In6);
+	/** Benchmark pure node Lib019_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn001(const FString& In0, FName In1, FString& Out2, const FString& In3, FName In4);
+	/** Benchmark callable node Lib019_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn002();
+	/** Benchmark callable node Lib019_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn003(int32 In0, int32& Out1);
+	/** Benchmark pure node Lib019_Fn004 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn004(const FString& In0, const FString& In1, bool In2, const TArray< int32 >& In3, bool In4);
+	/** Benchmark pure node Lib019_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn005(int32& Out0, FString& Out1, UObject* In2, float In3, FVector& Out4, FVector& Out5, const FVector& In6, const FTransform& In7);
+	/** Benchmark callable node Lib019_Fn006 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn006(int32& Out0, UObject* In1, int32 In2, FName In3, const FTransform& In4, UObject* In5, const FVector& In6);
+	/** Benchmark callable node Lib019_Fn007 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn007();
+	/** Benchmark callable node Lib019_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn008(const FString& In0, UObject* In1, UObject* In2, FVector& Out3, const FTransform& In4, FString& Out5);
+	/** Benchmark latent node Lib019_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32& Out1, const FVector& In2, int32 In3);
+	/** Benchmark pure node Lib019_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn010();
+	/** Benchmark latent node Lib019_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0);
+	/** Benchmark pure node Lib019_Fn012 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn012(const FString& In0, const FVector& In1);
+	/** Benchmark latent node Lib019_Fn013 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1, const FVector& In2, UObject* In3, bool In4);
+	/** Benchmark callable node Lib019_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn014(const FString& In0, const FVector& In1, FString& Out2);
+	/** Benchmark callable node Lib019_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn015(float In0);
+	/** Benchmark callable node Lib019_Fn016 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn016(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib019_Fn017 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn017(const TArray< int32 >& In0, const FString& In1);
+	/** Benchmark callable node Lib019_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn018(bool In0, float In1, bool In2, float In3, bool In4, int32& Out5, bool In6);
+	/** Benchmark pure node Lib019_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn019(const FVector& In0, FVector& Out1, FVector& Out2, const FString& In3, int32 In4, int32& Out5);
+	/** Benchmark callable node Lib019_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn020(const FTransform& In0);
+	/** Benchmark pure node Lib019_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn021(FString& Out0, const FVector& In1, const FString& In2, float In3, int32 In4, int32 In5);
+	/** Benchmark pure node Lib019_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn022(UObject* In0, const FString& In1, UObject* In2);
+	/** Benchmark pure node Lib019_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn023(int32 In0, int32& Out1, const FTransform& In2);
+	/** Benchmark pure node Lib019_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn024(const FTransform& In0, const TArray< int32 >& In1, int32 In2, FVector& Out3, const FTransform& In4, UObject* In5, FVector& Out6);
+	/** Benchmark callable node Lib019_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn025(const FString& In0);
+	/** Benchmark pure node Lib019_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn026(UObject* In0, bool In1, const FTransform& In2, const FVector& In3);
+	/** Benchmark pure node Lib019_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn027(const FString& In0, FName In1);
+	/** Benchmark pure node Lib019_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn028(const TArray< int32 >& In0, bool In1, int32 In2, int32 In3);
+	/** Benchmark callable node Lib019_Fn029 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn029(FName In0, UObject* In1);
+	/** Benchmark callable node Lib019_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn030(int32& Out0, const FVector& In1, const FString& In2);
+	/** Benchmark pure node Lib019_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn031(FName In0);
+	/** Benchmark callable node Lib019_Fn032 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn032(const FTransform& In0);
+	/** Benchmark callable node Lib019_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn033();
+	/** Benchmark latent node Lib019_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib019_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn035(const TArray< int32 >& In0, FName In1, FVector& Out2, bool In3, FVector& Out4, UObject* In5);
+	/** Benchmark latent node Lib019_Fn036 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FString& Out1);
+	/** Benchmark callable node Lib019_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn037();
+	/** Benchmark latent node Lib019_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, float In2, FVector& Out3);
+	/** Benchmark callable node Lib019_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn039(UObject* In0, FVector& Out1);
+	/** Benchmark pure node Lib019_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn040(FVector& Out0, UObject* In1, UObject* In2, FString& Out3, FName In4, int32& Out5);
+	/** Benchmark latent node Lib019_Fn041 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib019_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn042(UObject* In0, const FVector& In1, const FVector& In2, bool In3, float In4, FString& Out5, UObject* In6);
+	/** Benchmark callable node Lib019_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn043();
+	/** Benchmark callable node Lib019_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn044();
+	/** Benchmark callable node Lib019_Fn045 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn045(const TArray< int32 >& In0, FName In1, int32 In2, FName In3, bool In4, const FTransform& In5);
+	/** Benchmark callable node Lib019_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn046(const FString& In0, FName In1);
+	/** Benchmark callable node Lib019_Fn047 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn047(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib019_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn048(bool In0, float In1, int32& Out2, int32& Out3, int32& Out4, FName In5, UObject* In6, float In7);
+	/** Benchmark callable node Lib019_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn049(const FVector& In0, const TArray< int32 >& In1, float In2);
+	/** Benchmark pure node Lib019_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn050(const FVector& In0, const FString& In1, float In2, bool In3);
+	/** Benchmark latent node Lib019_Fn051 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, const TArray< int32 >& In2, int32 In3, FString& Out4);
+	/** Benchmark callable node Lib019_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn052();
+	/** Benchmark callable node Lib019_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn053(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib019_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn054(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib019_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn055(bool In0, int32 In1);
+	/** Benchmark callable node Lib019_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn056(int32& Out0, int32& Out1, int32 In2, FName In3);
+	/** Benchmark callable node Lib019_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn057(int32 In0);
+	/** Benchmark pure node Lib019_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn058(int32& Out0, UObject* In1, int32& Out2, float In3, const FString& In4, FName In5, const FTransform& In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib019_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn059(FName In0, const TArray< int32 >& In1, const FVector& In2);
+	/** Benchmark callable node Lib019_Fn060 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn060(const FString& In0, const FTransform& In1, const FString& In2, UObject* In3, const TArray< int32 >& In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib019_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn061();
+	/** Benchmark callable node Lib019_Fn062 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn062(const FVector& In0, const TArray< int32 >& In1, FVector& Out2, UObject* In3, FName In4, UObject* In5, const FString& In6, FName In7);
+	/** Benchmark pure node Lib019_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn063(UObject* In0, bool In1, FName In2, UObject* In3);
+	/** Benchmark pure node Lib019_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn064(const FString& In0, FVector& Out1, const FTransform& In2, int32& Out3, const FString& In4, FString& Out5, FName In6);
+	/** Benchmark callable node Lib019_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn065(FName In0, const FString& In1, FName In2, float In3, const FString& In4, FVector& Out5, FString& Out6, const FTransform& In7);
+	/** Benchmark pure node Lib019_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn066();
+	/** Benchmark callable node Lib019_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn067(const FString& In0, const FString& In1, const FString& In2, UObject* In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib019_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn068(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib019_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn069(const TArray< int32 >& In0, float In1, const FString& In2, FName In3, const FVector& In4);
+	/** Benchmark pure node Lib019_Fn070 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn070(const FString& In0, FVector& Out1, int32& Out2, float In3, int32& Out4, int32 In5);
+	/** Benchmark pure node Lib019_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn071(FString& Out0);
+	/** Benchmark latent node Lib019_Fn072 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, FName In2, const TArray< int32 >& In3, float In4, float In5);
+	/** Benchmark callable node Lib019_Fn073 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn073();
+	/** Benchmark latent node Lib019_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, FString& Out2, const FString& In3, float In4, int32& Out5);
+	/** Benchmark pure node Lib019_Fn075 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn075(const FVector& In0, FString& Out1, const FString& In2, const FVector& In3, const FString& In4);
+	/** Benchmark pure node Lib019_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn076(FVector& Out0, float In1, int32& Out2, const FString& In3, int32& Out4);
+	/** Benchmark pure node Lib019_Fn077 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn077(const FString& In0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib019_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn078();
+	/** Benchmark callable node Lib019_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn079(bool In0);
+	/** Benchmark pure node Lib019_Fn080 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn080(int32 In0, FName In1, UObject* In2, UObject* In3, const FTransform& In4, UObject* In5, int32& Out6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib019_Fn081 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib019_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark pure node Lib019_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn082(const FVector& In0, UObject* In1, const TArray< int32 >& In2, bool In3, const FTransform& In4, int32 In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib019_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn083(int32& Out0, bool In1, FString& Out2, const TArray< int32 >& In3, int32& Out4);
+	/** Benchmark callable node Lib019_Fn084 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn084(FVector& Out0);
+	/** Benchmark callable node Lib019_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn085(const TArray< int32 >& In0, const TArray< int32 >& In1, const FTransform& In2, FName In3, float In4, bool In5, bool In6, FName In7);
+	/** Benchmark callable node Lib019_Fn086 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn086(FName In0);
+	/** Benchmark callable node Lib019_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn087(int32 In0, FString& Out1);
+	/** Benchmark callable node Lib019_Fn088 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static void Lib019_Fn088(FVector& Out0, int32 In1, int32 In2, UObject* In3, int32 In4);
+	/** Benchmark pure node Lib019_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn089(FName In0, UObject* In1, FVector& Out2);
+	/** Benchmark callable node Lib019_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static float Lib019_Fn090(float In0, int32& Out1);
+	/** Benchmark callable node Lib019_Fn091 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn091(const FTransform& In0, bool In1, const FTransform& In2, int32 In3, const FString& In4, FString& Out5, const FTransform& In6);
+	/** Benchmark pure node Lib019_Fn092 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn092(FName In0, int32 In1, UObject* In2, float In3, const FVector& In4);
+	/** Benchmark callable node Lib019_Fn093 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static bool Lib019_Fn093(const FVector& In0, float In1, UObject* In2, const FTransform& In3, int32& Out4, bool In5, int32 In6);
+	/** Benchmark callable node Lib019_Fn094 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn094(float In0, const FVector& In1, FVector& Out2, bool In3, FString& Out4, int32& Out5, FVector& Out6);
+	/** Benchmark pure node Lib019_Fn095 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static int32 Lib019_Fn095(const FString& In0);
+	/** Benchmark pure node Lib019_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn096(int32& Out0, const FVector& In1, int32 In2);
+	/** Benchmark callable node Lib019_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn097(const FTransform& In0, const FVector& In1, int32& Out2, FString& Out3, const FString& In4, const FString& In5, FName In6);
+	/** Benchmark callable node Lib019_Fn098 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FString Lib019_Fn098(FName In0, float In1, FName In2, int32& Out3);
+	/** Benchmark callable node Lib019_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib019")
+	static FVector Lib019_Fn099(FVector& Out0, UObject* In1, int32 In2, const FVector& In3, const FTransform& In4);
+};
+
@@ -0,0 +1,1020 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#include "KDGBenchLibraries_2.h"
+
+FVector UKDGBenchLib_020::Lib020_Fn000() { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn001(UObject* In0, const FVector& In1, bool In2, float In3, FString& Out4, const FTransform& In5) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn002(const FTransform& In0, float In1, bool In2, FVector& Out3, FString& Out4) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn003(FString& Out0, UObject* In1, int32& Out2, FString& Out3, int32& Out4, UObject* In5, const FString& In6) {}
+int32 UKDGBenchLib_020::Lib020_Fn004() { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn005(int32 In0, FVector& Out1, const FString& In2, FName In3, UObject* In4, UObject* In5, const FVector& In6, FString& Out7) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn006(FName In0, const TArray< int32 >& In1, const FTransform& In2, int32 In3, int32 In4) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn007(const TArray< int32 >& In0, FName In1, UObject* In2, int32 In3) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn008(UObject* In0, const FTransform& In1, bool In2, FName In3, int32& Out4, bool In5, int32 In6, FVector& Out7) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn009(const FTransform& In0, float In1, const TArray< int32 >& In2, FString& Out3, const FVector& In4, const FString& In5, const FTransform& In6, UObject* In7) {}
+FString UKDGBenchLib_020::Lib020_Fn010(int32& Out0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1, bool In2, UObject* In3, FString& Out4, FVector& Out5, UObject* In6) {}
+int32 UKDGBenchLib_020::Lib020_Fn012(FString& Out0, bool In1, const FVector& In2, const FString& In3, UObject* In4) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn013(int32& Out0, const FTransform& In1, UObject* In2, const FVector& In3, UObject* In4, const FVector& In5) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn014(UObject* In0, const FTransform& In1, const FTransform& In2, const FString& In3, FVector& Out4, const FString& In5, FName In6) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn015() { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn016(const TArray< int32 >& In0, const FVector& In1, UObject* In2, const FTransform& In3, int32 In4, const FString& In5, const FVector& In6, const FString& In7) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn017(FString& Out0, const FTransform& In1, int32& Out2, FString& Out3, const FVector& In4, FString& Out5, UObject* In6, const FVector& In7) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn018(UObject* In0) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn019(UObject* In0, FVector& Out1, FName In2) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn020(const FTransform& In0, FName In1, float In2, const TArray< int32 >& In3, int32& Out4, const FString& In5) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn021(const FTransform& In0, const FTransform& In1, const FVector& In2, bool In3, const TArray< int32 >& In4, UObject* In5, bool In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn022(UObject* In0, const TArray< int32 >& In1, float In2, FName In3, const TArray< int32 >& In4, const TArray< int32 >& In5, bool In6) {}
+float UKDGBenchLib_020::Lib020_Fn023(bool In0, const FVector& In1, const FTransform& In2) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn024(const FTransform& In0, const TArray< int32 >& In1, bool In2, FName In3) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, FString& Out2, FVector& Out3, FVector& Out4, FString& Out5) {}
+bool UKDGBenchLib_020::Lib020_Fn026(const FVector& In0, FVector& Out1) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn027() {}
+FVector UKDGBenchLib_020::Lib020_Fn028(const FVector& In0, bool In1, int32 In2, bool In3, FName In4, const FString& In5, bool In6) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn029(FString& Out0, UObject* In1, FName In2, const FVector& In3, int32 In4, FName In5) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn030(UObject* In0, FVector& Out1, FVector& Out2, float In3) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn031(const FVector& In0, int32 In1, const FVector& In2, UObject* In3, int32& Out4, UObject* In5, const TArray< int32 >& In6) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn032(FVector& Out0) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn033(int32& Out0, float In1, const FTransform& In2, bool In3, const FVector& In4, int32& Out5, int32 In6) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FString& In1, int32 In2, FString& Out3, const FVector& In4) {}
+float UKDGBenchLib_020::Lib020_Fn035(FString& Out0, FName In1, int32 In2) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn036(const FVector& In0, float In1, UObject* In2, const FTransform& In3, FName In4, FName In5) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FName In1, int32 In2, const FVector& In3, FVector& Out4, int32 In5, FVector& Out6) {}
+void UKDGBenchLib_020::Lib020_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FTransform& In1, int32& Out2, bool In3, const FTransform& In4) {}
+FString UKDGBenchLib_020::Lib020_Fn039(UObject* In0, FName In1, FString& Out2, bool In3, const TArray< int32 >& In4, bool In5) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn040(const TArray< int32 >& In0, int32& Out1, int32& Out2, const TArray< int32 >& In3, FVector& Out4, const FString& In5, const FString& In6) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn041(UObject* In0, int32 In1, int32& Out2, FString& Out3, float In4) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn042(FString& Out0, const TArray< int32 >& In1, FName In2, UObject* In3, int32 In4, FName In5, int32& Out6, FName In7) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn043(const FTransform& In0, FVector& Out1, bool In2, int32 In3, FName In4, FString& Out5) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn044() { return {}; }
+float UKDGBenchLib_020::Lib020_Fn045(const FTransform& In0, bool In1, float In2) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn046(FVector& Out0, float In1, bool In2, int32& Out3, const FString& In4) {}
+int32 UKDGBenchLib_020::Lib020_Fn047(int32 In0, FName In1) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn048(bool In0, FVector& Out1, const FVector& In2, FVector& Out3, FVector& Out4) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0) {}
+void UKDGBenchLib_020::Lib020_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FVector& In1) {}
+int32 UKDGBenchLib_020::Lib020_Fn051(const FTransform& In0, int32 In1) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn052(int32 In0, const TArray< int32 >& In1) {}
+int32 UKDGBenchLib_020::Lib020_Fn053(const TArray< int32 >& In0, const FVector& In1, int32 In2, int32& Out3, const FTransform& In4, FName In5, const FTransform& In6) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn054(const FVector& In0, FName In1, const TArray< int32 >& In2, float In3, const FVector& In4) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn055() {}
+int32 UKDGBenchLib_020::Lib020_Fn056(float In0, bool In1, FString& Out2) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn057(float In0, UObject* In1) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn058(int32& Out0, FName In1, const TArray< int32 >& In2, FVector& Out3, bool In4) {}
+bool UKDGBenchLib_020::Lib020_Fn059(const FTransform& In0, FName In1, const TArray< int32 >& In2, FString& Out3) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn060(int32 In0, FString& Out1, int32 In2, const TArray< int32 >& In3, int32 In4, FString& Out5) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn061(int32 In0, FVector& Out1, const FVector& In2, const FVector& In3, bool In4) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn062(int32 In0) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn063(float In0, const FString& In1, const FString& In2, float In3) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn064(const FTransform& In0, float In1, FString& Out2, FVector& Out3, UObject* In4, int32 In5) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn065() { return {}; }
+float UKDGBenchLib_020::Lib020_Fn066(FName In0, int32 In1, bool In2, int32& Out3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn067(float In0, FString& Out1, int32& Out2, const FVector& In3, const FString& In4, const FVector& In5) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn068(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn069(int32 In0, bool In1, bool In2, const FString& In3, const FVector& In4) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn070(FVector& Out0, int32& Out1, FString& Out2) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn071(int32& Out0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn072(int32 In0, int32& Out1, int32 In2, float In3, const FString& In4, bool In5, int32& Out6) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn073() { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn074(FString& Out0, FName In1, const FTransform& In2, bool In3, float In4, FName In5, int32 In6, int32 In7) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn075(FString& Out0, UObject* In1, const TArray< int32 >& In2, const FVector& In3, FVector& Out4, const TArray< int32 >& In5, bool In6, float In7) {}
+FVector UKDGBenchLib_020::Lib020_Fn076(const TArray< int32 >& In0, const FTransform& In1, const FVector& In2, float In3, int32 In4, FVector& Out5, FVector& Out6) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn077(FVector& Out0, float In1, const FVector& In2) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn078(const FTransform& In0, const TArray< int32 >& In1, const FString& In2, const FVector& In3, FString& Out4, const FVector& In5) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn079(bool In0, const TArray< int32 >& In1, int32& Out2, bool In3, int32& Out4, bool In5, FVector& Out6) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn080(int32 In0, FName In1, int32 In2) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn081(const FTransform& In0, const TArray< int32 >& In1, int32 In2) {}
+FString UKDGBenchLib_020::Lib020_Fn082(int32 In0) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn083(const TArray< int32 >& In0, float In1, FVector& Out2, const FTransform& In3, bool In4, const TArray< int32 >& In5, const FVector& In6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn084(FName In0, const FTransform& In1, int32 In2, int32& Out3, FVector& Out4, int32& Out5, const FString& In6) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn085(bool In0, FVector& Out1, bool In2, FString& Out3) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn086(const TArray< int32 >& In0, FString& Out1, bool In2, FString& Out3, FVector& Out4, UObject* In5, const TArray< int32 >& In6, int32 In7) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn087(FName In0, const FVector& In1, const FVector& In2, const FVector& In3, FString& Out4, bool In5) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn088(FName In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_020::Lib020_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FVector& In1, float In2, const TArray< int32 >& In3, const TArray< int32 >& In4) {}
+int32 UKDGBenchLib_020::Lib020_Fn090(const FVector& In0, bool In1, const FVector& In2, UObject* In3, FVector& Out4, const FVector& In5, const TArray< int32 >& In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn091(float In0, FVector& Out1, FName In2, bool In3, int32& Out4, FString& Out5, UObject* In6) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn092(const FVector& In0, const TArray< int32 >& In1, UObject* In2, int32& Out3, UObject* In4) { return {}; }
+float UKDGBenchLib_020::Lib020_Fn093(bool In0, int32& Out1, FVector& Out2, FVector& Out3) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn094(UObject* In0, const FVector& In1, FVector& Out2, int32& Out3, UObject* In4, FVector& Out5, UObject* In6) { return {}; }
+FVector UKDGBenchLib_020::Lib020_Fn095(float In0, FName In1, const FVector& In2, int32 In3, float In4, int32 In5, int32 In6) { return {}; }
+int32 UKDGBenchLib_020::Lib020_Fn096(const FVector& In0, FVector& Out1, FVector& Out2, FName In3, const TArray< int32 >& In4, const FString& In5, int32& Out6) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn097(const FVector& In0, const FTransform& In1, FString& Out2, UObject* In3, const FVector& In4, const TArray< int32 >& In5) { return {}; }
+bool UKDGBenchLib_020::Lib020_Fn098(FString& Out0, FVector& Out1, const FVector& In2, FName In3, int32 In4, int32 In5, const TArray< int32 >& In6) { return {}; }
+FString UKDGBenchLib_020::Lib020_Fn099(const TArray< int32 >& In0, UObject* In1, UObject* In2, const FTransform& In3, int32& Out4, const FVector& In5, const FString& In6, const FTransform& In7) { return {}; }
+
+bool UKDGBenchLib_021::Lib021_Fn000(FName In0, const FTransform& In1, const TArray< int32 >& In2, float In3, bool In4) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn001(int32 In0, int32 In1, const FString& In2, const FString& In3, FName In4, const FString& In5, int32& Out6, const FString& In7) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn002(int32& Out0, const FTransform& In1, int32& Out2, float In3, int32 In4, UObject* In5) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn003(bool In0, UObject* In1, FName In2, const FTransform& In3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn004(FString& Out0, int32& Out1, FVector& Out2, UObject* In3, int32 In4, int32& Out5, int32 In6) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn005(FVector& Out0, FVector& Out1, FString& Out2, int32& Out3, const FString& In4) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn006(int32& Out0, FName In1) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1) {}
+float UKDGBenchLib_021::Lib021_Fn008(const FTransform& In0, bool In1, const TArray< int32 >& In2) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn009(int32& Out0, FName In1, UObject* In2) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FVector& In1, const FString& In2) {}
+float UKDGBenchLib_021::Lib021_Fn011(FName In0, int32 In1) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FString& Out1, FVector& Out2) {}
+int32 UKDGBenchLib_021::Lib021_Fn013(const FVector& In0, const TArray< int32 >& In1, FVector& Out2, const TArray< int32 >& In3, const FString& In4, FVector& Out5) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn014(const TArray< int32 >& In0, FString& Out1, int32& Out2, int32 In3) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn015(int32& Out0, FName In1) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn016(FVector& Out0, UObject* In1, float In2, FVector& Out3, int32& Out4) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0) {}
+float UKDGBenchLib_021::Lib021_Fn018(UObject* In0, const FString& In1, const FVector& In2, bool In3, const TArray< int32 >& In4, bool In5, const FVector& In6) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn019(const FString& In0) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, const FVector& In2, const FVector& In3) {}
+float UKDGBenchLib_021::Lib021_Fn021() { return {}; }
+float UKDGBenchLib_021::Lib021_Fn022() { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn023(const FString& In0, const FTransform& In1, const TArray< int32 >& In2, int32 In3, float In4, const FTransform& In5, const TArray< int32 >& In6, const FVector& In7) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn024(bool In0, const FTransform& In1, int32 In2, UObject* In3, float In4, const TArray< int32 >& In5, FName In6, const FTransform& In7) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn025(const FVector& In0, const FString& In1, FVector& Out2, int32 In3, UObject* In4, const FVector& In5) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn026(const FVector& In0, FString& Out1, int32 In2) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FString UKDGBenchLib_021::Lib021_Fn028(const FVector& In0, int32& Out1, bool In2) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn029(UObject* In0) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32& Out1, int32 In2, const FVector& In3) {}
+FVector UKDGBenchLib_021::Lib021_Fn031(FName In0, FVector& Out1, int32 In2, const FTransform& In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn032(const FTransform& In0, UObject* In1) {}
+void UKDGBenchLib_021::Lib021_Fn033(const FVector& In0, bool In1) {}
+int32 UKDGBenchLib_021::Lib021_Fn034(const FString& In0, const FVector& In1) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn035(const TArray< int32 >& In0, FName In1, int32& Out2, UObject* In3, FVector& Out4, const FVector& In5) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn036(bool In0, bool In1) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn037(FName In0, bool In1) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn038(UObject* In0, FString& Out1, FVector& Out2, const FString& In3) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn039() { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn040(FVector& Out0, UObject* In1, FString& Out2, const TArray< int32 >& In3) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn041(const TArray< int32 >& In0, const TArray< int32 >& In1) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn042(FVector& Out0, FName In1, int32& Out2, FString& Out3, bool In4, const FTransform& In5, const FString& In6) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn043(float In0, FVector& Out1, FVector& Out2, float In3, FString& Out4, FName In5, FName In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn044(const FVector& In0, const TArray< int32 >& In1) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn045(const TArray< int32 >& In0, const TArray< int32 >& In1, FVector& Out2, bool In3, const FVector& In4, const TArray< int32 >& In5) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn046(const FString& In0, const FTransform& In1, UObject* In2, const FVector& In3, const FVector& In4, const FVector& In5, float In6) {}
+bool UKDGBenchLib_021::Lib021_Fn047(bool In0, int32 In1) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn048(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0) {}
+int32 UKDGBenchLib_021::Lib021_Fn049(const FVector& In0, const FString& In1, FName In2, int32 In3, FString& Out4, FString& Out5, UObject* In6, UObject* In7) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn050(const FVector& In0, FString& Out1, float In2, bool In3) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn051(const FString& In0, const FVector& In1, int32 In2, FVector& Out3, const FVector& In4, const TArray< int32 >& In5, float In6) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn052(const TArray< int32 >& In0, float In1, int32 In2, int32 In3, FVector& Out4, FVector& Out5) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn053(const FString& In0, float In1) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn054(const FString& In0, int32 In1, FVector& Out2, FVector& Out3, bool In4, const FTransform& In5, const FVector& In6, FVector& Out7) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn055(const FTransform& In0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn056(bool In0, bool In1, bool In2, const FVector& In3, int32 In4) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn057(FName In0, float In1, FName In2, int32 In3, const TArray< int32 >& In4) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn058(FVector& Out0, const FTransform& In1, UObject* In2, float In3, const FVector& In4, FString& Out5, const FVector& In6) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn059(bool In0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn060(bool In0, bool In1, int32 In2, UObject* In3, const FTransform& In4) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn061(const TArray< int32 >& In0, int32 In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4, FName In5) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FTransform& In1, FVector& Out2) {}
+FVector UKDGBenchLib_021::Lib021_Fn063() { return {}; }
+void UKDGBenchLib_021::Lib021_Fn064(const TArray< int32 >& In0, const FString& In1, const TArray< int32 >& In2, float In3) {}
+FVector UKDGBenchLib_021::Lib021_Fn065(int32 In0, int32 In1) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn066(FName In0, FString& Out1, const FTransform& In2, int32& Out3, int32 In4, float In5) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn067(int32 In0, const FTransform& In1, int32 In2, UObject* In3, float In4, const FTransform& In5, FString& Out6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn068(const TArray< int32 >& In0, FName In1, const TArray< int32 >& In2) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn069(FName In0, const FVector& In1, int32 In2, const FString& In3, FVector& Out4) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn070(const FTransform& In0, FVector& Out1, FVector& Out2, const FVector& In3, int32& Out4, FName In5, float In6) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn071(const FTransform& In0, const FString& In1, FString& Out2, FName In3, UObject* In4) {}
+FString UKDGBenchLib_021::Lib021_Fn072(bool In0, int32 In1, FVector& Out2, const FTransform& In3, FVector& Out4, const TArray< int32 >& In5, const FString& In6) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn073(float In0, FString& Out1, int32& Out2, FName In3, int32& Out4, const FString& In5) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn074(const FString& In0, FName In1, int32 In2) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn075(const TArray< int32 >& In0, const FVector& In1, int32 In2, const TArray< int32 >& In3, float In4, FName In5, bool In6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn076(UObject* In0) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn077(int32 In0, FName In1) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn078(FName In0, const FVector& In1) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn079(float In0, const FVector& In1) { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn080(FString& Out0, int32& Out1, const FString& In2, FVector& Out3, bool In4, float In5, FVector& Out6) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn081() { return {}; }
+FString UKDGBenchLib_021::Lib021_Fn082(const FVector& In0) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn083(const FString& In0) {}
+void UKDGBenchLib_021::Lib021_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FVector& Out1) {}
+void UKDGBenchLib_021::Lib021_Fn085(int32 In0, FName In1, FName In2, const FTransform& In3, bool In4, FVector& Out5) {}
+FVector UKDGBenchLib_021::Lib021_Fn086(const FVector& In0, const FVector& In1, UObject* In2, int32& Out3, const TArray< int32 >& In4, UObject* In5, const FTransform& In6) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn087(int32 In0) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn088(FVector& Out0, FString& Out1, UObject* In2, const FString& In3) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn089(const FTransform& In0, FVector& Out1, FVector& Out2, const FVector& In3, int32 In4, const TArray< int32 >& In5) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn090(const FTransform& In0, const FVector& In1, const TArray< int32 >& In2, float In3, const FVector& In4, UObject* In5, const FString& In6, const FVector& In7) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn091(const FVector& In0, float In1, const FString& In2, int32& Out3, int32& Out4, const FString& In5, int32 In6) { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn092(const TArray< int32 >& In0, const FTransform& In1, FString& Out2, FString& Out3) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn093(const TArray< int32 >& In0) { return {}; }
+FVector UKDGBenchLib_021::Lib021_Fn094(bool In0, bool In1, const FVector& In2, const FVector& In3, float In4, bool In5) { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn095() { return {}; }
+int32 UKDGBenchLib_021::Lib021_Fn096(const FTransform& In0, FString& Out1) { return {}; }
+float UKDGBenchLib_021::Lib021_Fn097() { return {}; }
+bool UKDGBenchLib_021::Lib021_Fn098(float In0, const FVector& In1, const FVector& In2, UObject* In3) { return {}; }
+void UKDGBenchLib_021::Lib021_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, UObject* In2) {}
+
+FString UKDGBenchLib_022::Lib022_Fn000() { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn001(float In0, FName In1, FName In2) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn002(FName In0) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn003(FName In0, int32 In1, int32 In2) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn004(float In0, UObject* In1, bool In2) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn005(UObject* In0, bool In1, const FTransform& In2, FVector& Out3, const FString& In4, const FString& In5, const FTransform& In6, const FString& In7) {}
+FString UKDGBenchLib_022::Lib022_Fn006(bool In0) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn007() { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn008(FVector& Out0, bool In1, int32& Out2, bool In3, int32 In4, const FTransform& In5, bool In6, const FVector& In7) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn009(const TArray< int32 >& In0) {}
+float UKDGBenchLib_022::Lib022_Fn010(UObject* In0, int32 In1) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn011(UObject* In0, const FTransform& In1, const FString& In2, const FVector& In3, int32& Out4, const FString& In5, const TArray< int32 >& In6) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn012(const FVector& In0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32& Out4) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn013(FVector& Out0, bool In1, const TArray< int32 >& In2, int32 In3, FString& Out4) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn014(UObject* In0, FString& Out1, const FString& In2, const TArray< int32 >& In3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn015(const FString& In0, bool In1, UObject* In2, const TArray< int32 >& In3) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn016(int32& Out0, int32 In1, float In2, bool In3, const FString& In4, const FTransform& In5, const FTransform& In6) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn017(int32& Out0, const TArray< int32 >& In1) {}
+float UKDGBenchLib_022::Lib022_Fn018(int32& Out0, FVector& Out1, const TArray< int32 >& In2, UObject* In3, const FVector& In4) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn019(UObject* In0, bool In1, const TArray< int32 >& In2, float In3) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn020(FName In0) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn021(FName In0, const FString& In1) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn022(float In0, const FString& In1, bool In2, bool In3, float In4, bool In5, const FVector& In6, FString& Out7) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn023(bool In0, FVector& Out1, const FString& In2, int32& Out3, FString& Out4, const FVector& In5, FString& Out6) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn024(int32& Out0, const FVector& In1, FString& Out2) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn025(int32& Out0, FString& Out1) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn026(const FTransform& In0, const FVector& In1) {}
+bool UKDGBenchLib_022::Lib022_Fn027(const FVector& In0, FName In1, float In2, const TArray< int32 >& In3) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn028(const FVector& In0, FVector& Out1, int32 In2, const FVector& In3, const FString& In4, const FString& In5, bool In6) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn029(bool In0) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn030(const FTransform& In0, const FTransform& In1, const FVector& In2, int32 In3) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0) {}
+void UKDGBenchLib_022::Lib022_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32& Out1, FName In2, FName In3, bool In4, float In5, int32 In6) {}
+void UKDGBenchLib_022::Lib022_Fn033(const FString& In0) {}
+int32 UKDGBenchLib_022::Lib022_Fn034(FString& Out0, const FTransform& In1, const FVector& In2) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn035() { return {}; }
+float UKDGBenchLib_022::Lib022_Fn036(int32& Out0, const FTransform& In1, UObject* In2, bool In3, const TArray< int32 >& In4, const FVector& In5, FName In6) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn037(const FString& In0, bool In1, int32& Out2, int32 In3, const TArray< int32 >& In4, int32 In5) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn038(FVector& Out0, FVector& Out1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn039(UObject* In0, int32 In1, bool In2, const FString& In3, const FVector& In4, const FTransform& In5, FString& Out6) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn040(const FString& In0, bool In1, int32& Out2, bool In3, int32 In4) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn041(float In0) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn042(const FVector& In0) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn043(FName In0, FVector& Out1, const FVector& In2) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn044(float In0, FVector& Out1, int32& Out2, FName In3) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn045(bool In0, FVector& Out1, float In2, int32& Out3, FString& Out4, const FString& In5) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn046(int32& Out0, FVector& Out1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4, FName In5) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn047(float In0) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn048(bool In0, UObject* In1, FString& Out2, FName In3, UObject* In4) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn049(bool In0, FVector& Out1, int32 In2, FName In3, const FTransform& In4, int32& Out5, float In6, bool In7) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn050(FVector& Out0, FString& Out1, FVector& Out2, int32& Out3, bool In4, FName In5, const TArray< int32 >& In6) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn051(int32 In0) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn052(const TArray< int32 >& In0, float In1, FVector& Out2, const FTransform& In3, const FString& In4, const FTransform& In5, const FVector& In6, bool In7) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn053(const FString& In0, int32& Out1) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn054(UObject* In0, bool In1, UObject* In2, const FTransform& In3, const FString& In4, const FString& In5) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn055(const TArray< int32 >& In0, FString& Out1, const FTransform& In2, int32& Out3, bool In4, const FTransform& In5, const FTransform& In6, float In7) {}
+void UKDGBenchLib_022::Lib022_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, bool In2, FName In3) {}
+FVector UKDGBenchLib_022::Lib022_Fn057(FName In0, const FVector& In1, bool In2, const FString& In3) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn058(const TArray< int32 >& In0, int32& Out1, FName In2) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn059(const FVector& In0, float In1, int32 In2, UObject* In3, FString& Out4, float In5) {}
+void UKDGBenchLib_022::Lib022_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32& Out1, FVector& Out2, UObject* In3, const FTransform& In4, bool In5, UObject* In6, int32& Out7) {}
+bool UKDGBenchLib_022::Lib022_Fn061(bool In0) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn062(const TArray< int32 >& In0, const FString& In1, const FString& In2, bool In3, FName In4) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn063(const FTransform& In0, const FVector& In1, const FVector& In2) {}
+float UKDGBenchLib_022::Lib022_Fn064(const FString& In0, const FVector& In1, FName In2) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn065(int32 In0, FVector& Out1, FVector& Out2, int32 In3, const FVector& In4, int32 In5) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn066(const TArray< int32 >& In0, const FVector& In1, bool In2, const FVector& In3) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn067(int32 In0, FVector& Out1, FName In2, const FVector& In3) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn068(const TArray< int32 >& In0, FName In1, const FString& In2, bool In3) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn069(FString& Out0, FString& Out1, FVector& Out2, FVector& Out3, FName In4, FString& Out5) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn070(const FTransform& In0, bool In1, const TArray< int32 >& In2, const FTransform& In3, float In4) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn071(UObject* In0, const FString& In1, UObject* In2) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn072(int32& Out0, FString& Out1, FString& Out2, const FTransform& In3, FString& Out4, FName In5) {}
+FVector UKDGBenchLib_022::Lib022_Fn073(int32 In0, FVector& Out1, FString& Out2, const FVector& In3, const FTransform& In4, bool In5) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn074(FName In0, int32 In1, const FVector& In2) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn075(FName In0, FName In1, const FVector& In2, int32 In3, const FTransform& In4, const TArray< int32 >& In5, FString& Out6, const FVector& In7) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn076(FString& Out0, bool In1, const FVector& In2, const FVector& In3) {}
+int32 UKDGBenchLib_022::Lib022_Fn077(const FString& In0, const TArray< int32 >& In1, const FTransform& In2, FVector& Out3) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn078(const FTransform& In0, UObject* In1, FName In2, UObject* In3, const TArray< int32 >& In4) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn079(bool In0, int32 In1, const FString& In2, float In3) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn080(int32 In0, bool In1, int32& Out2, FVector& Out3, const FString& In4, FString& Out5, const FString& In6) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn081(FString& Out0, UObject* In1) { return {}; }
+bool UKDGBenchLib_022::Lib022_Fn082(FName In0, UObject* In1, FName In2, const FString& In3, FString& Out4, UObject* In5, const FTransform& In6) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn083(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn084(const FTransform& In0, float In1) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn085(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+bool UKDGBenchLib_022::Lib022_Fn086(FName In0, int32 In1, FVector& Out2, FVector& Out3, UObject* In4) { return {}; }
+FString UKDGBenchLib_022::Lib022_Fn087(const FString& In0, int32& Out1) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn088(const FVector& In0, const FString& In1, bool In2, bool In3, bool In4, FString& Out5) { return {}; }
+int32 UKDGBenchLib_022::Lib022_Fn089(const FString& In0, int32& Out1, int32& Out2, FString& Out3, UObject* In4, const FVector& In5, float In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_022::Lib022_Fn091(const FVector& In0, const FString& In1, const FTransform& In2, UObject* In3, const FVector& In4, bool In5, FName In6) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn092(FString& Out0, int32& Out1, float In2, float In3, float In4) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn093(UObject* In0, float In1, UObject* In2, FName In3, FString& Out4, int32 In5, int32& Out6) {}
+void UKDGBenchLib_022::Lib022_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0) {}
+FVector UKDGBenchLib_022::Lib022_Fn095(UObject* In0) { return {}; }
+void UKDGBenchLib_022::Lib022_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, bool In1) {}
+FString UKDGBenchLib_022::Lib022_Fn097(FString& Out0, FString& Out1) { return {}; }
+float UKDGBenchLib_022::Lib022_Fn098(UObject* In0, float In1, int32 In2, const TArray< int32 >& In3, UObject* In4, const FString& In5, const TArray< int32 >& In6, FString& Out7) { return {}; }
+FVector UKDGBenchLib_022::Lib022_Fn099() { return {}; }
+
+FString UKDGBenchLib_023::Lib023_Fn000(int32& Out0, float In1, bool In2) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn001(float In0, const FVector& In1, int32& Out2, int32& Out3, const TArray< int32 >& In4) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn002() {}
+int32 UKDGBenchLib_023::Lib023_Fn003(bool In0, const FTransform& In1, int32& Out2, const TArray< int32 >& In3, FVector& Out4, UObject* In5, FName In6) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn004(const FVector& In0) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn005(float In0, const FString& In1, UObject* In2) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn006(const FString& In0, FString& Out1, const FString& In2, const TArray< int32 >& In3) {}
+float UKDGBenchLib_023::Lib023_Fn007(FString& Out0, int32& Out1) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn008(int32 In0, bool In1, const FVector& In2) { return {}; }
+int32 UKDGBenchLib_023::Lib023_Fn009(FString& Out0, const FTransform& In1, int32& Out2, float In3, const TArray< int32 >& In4, int32& Out5, float In6) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn010(const FString& In0, const TArray< int32 >& In1, FString& Out2) {}
+FVector UKDGBenchLib_023::Lib023_Fn011(const TArray< int32 >& In0, int32& Out1, bool In2, const FTransform& In3, UObject* In4) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32& Out1) {}
+FString UKDGBenchLib_023::Lib023_Fn013(int32 In0, FName In1, const TArray< int32 >& In2) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn014() { return {}; }
+void UKDGBenchLib_023::Lib023_Fn015(const FString& In0, UObject* In1, const TArray< int32 >& In2, int32& Out3, const FTransform& In4, int32 In5) {}
+FString UKDGBenchLib_023::Lib023_Fn016(int32 In0, int32 In1, FString& Out2, UObject* In3, FVector& Out4, int32 In5, int32& Out6, FName In7) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn017() {}
+void UKDGBenchLib_023::Lib023_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32 In1, const TArray< int32 >& In2, int32 In3, int32& Out4, float In5, FName In6, FString& Out7) {}
+int32 UKDGBenchLib_023::Lib023_Fn019(int32 In0, FString& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn020(const FString& In0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3, const FVector& In4, FVector& Out5, const FTransform& In6, int32& Out7) {}
+float UKDGBenchLib_023::Lib023_Fn021(int32 In0, const FVector& In1, int32& Out2, bool In3, int32 In4) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn022(const FString& In0, const FVector& In1, int32& Out2, const FTransform& In3, FString& Out4, const TArray< int32 >& In5) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn023() { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn024(bool In0, FVector& Out1, FName In2, FString& Out3, const FTransform& In4, FName In5, const FString& In6) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn025(FName In0, int32& Out1, const FTransform& In2, float In3, const TArray< int32 >& In4) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, FString& Out2) {}
+void UKDGBenchLib_023::Lib023_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FString& Out1, FString& Out2, const TArray< int32 >& In3) {}
+FVector UKDGBenchLib_023::Lib023_Fn028(int32 In0, FName In1, UObject* In2, const FVector& In3, FName In4, const FVector& In5, int32 In6) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn029(bool In0, bool In1, FString& Out2, const TArray< int32 >& In3, UObject* In4, float In5, UObject* In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn030(int32& Out0, const FString& In1, int32 In2) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn031(float In0, const TArray< int32 >& In1, float In2, bool In3) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1, int32& Out2, const FTransform& In3) {}
+void UKDGBenchLib_023::Lib023_Fn033() {}
+FVector UKDGBenchLib_023::Lib023_Fn034(FName In0, FVector& Out1, int32& Out2, const FVector& In3) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn035(bool In0) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn036(FName In0, const TArray< int32 >& In1, const FTransform& In2, float In3, UObject* In4, const TArray< int32 >& In5) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn037(const FVector& In0, int32 In1, int32 In2, const TArray< int32 >& In3, FVector& Out4) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn038(int32& Out0, int32& Out1, const FTransform& In2, FName In3, float In4, int32 In5) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn039(float In0, const FString& In1, const FString& In2, const FString& In3, const TArray< int32 >& In4, float In5) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FName In1, FName In2, FString& Out3, bool In4, const TArray< int32 >& In5) {}
+bool UKDGBenchLib_023::Lib023_Fn041(FName In0, const TArray< int32 >& In1, bool In2, const FVector& In3, const FTransform& In4, bool In5, FString& Out6, UObject* In7) { return {}; }
+int32 UKDGBenchLib_023::Lib023_Fn042(FName In0, const FVector& In1, const FVector& In2, const FTransform& In3) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, float In1, int32 In2, const TArray< int32 >& In3, bool In4, float In5, float In6) {}
+float UKDGBenchLib_023::Lib023_Fn044(float In0) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn045(UObject* In0, FString& Out1) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn046() { return {}; }
+void UKDGBenchLib_023::Lib023_Fn047() {}
+bool UKDGBenchLib_023::Lib023_Fn048(const FTransform& In0, FString& Out1, FVector& Out2, UObject* In3, FVector& Out4, FString& Out5) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn049() { return {}; }
+void UKDGBenchLib_023::Lib023_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, FString& Out2, const FTransform& In3, const FVector& In4, bool In5, const FString& In6) {}
+FVector UKDGBenchLib_023::Lib023_Fn051(FVector& Out0, FVector& Out1, UObject* In2, FString& Out3, bool In4, FVector& Out5) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn052(const FVector& In0, int32& Out1, FString& Out2) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn053(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, const FString& In2, FName In3) {}
+void UKDGBenchLib_023::Lib023_Fn054(const TArray< int32 >& In0, FName In1, int32& Out2, FVector& Out3, const TArray< int32 >& In4, UObject* In5) {}
+void UKDGBenchLib_023::Lib023_Fn055(int32 In0, const TArray< int32 >& In1, int32 In2, FString& Out3) {}
+FString UKDGBenchLib_023::Lib023_Fn056(int32& Out0, FString& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3) { return {}; }
+int32 UKDGBenchLib_023::Lib023_Fn057(int32 In0, FString& Out1, int32& Out2, FVector& Out3, int32 In4) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn058(const TArray< int32 >& In0, bool In1, float In2) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn059(FVector& Out0, UObject* In1, const FVector& In2, FString& Out3) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn060(UObject* In0, const FVector& In1) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn061(UObject* In0, int32& Out1, int32& Out2, const FTransform& In3) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn062(int32 In0) { return {}; }
+int32 UKDGBenchLib_023::Lib023_Fn063(const FTransform& In0, bool In1, int32 In2, FName In3, const FTransform& In4, const FString& In5, FVector& Out6) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn064(const TArray< int32 >& In0, const FVector& In1) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn065(FVector& Out0, FName In1, bool In2, int32 In3, const FTransform& In4, UObject* In5, const TArray< int32 >& In6, const FTransform& In7) {}
+void UKDGBenchLib_023::Lib023_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FVector& In1, const FTransform& In2, FVector& Out3) {}
+bool UKDGBenchLib_023::Lib023_Fn067(bool In0, const FVector& In1, UObject* In2, int32& Out3, UObject* In4) { return {}; }
+int32 UKDGBenchLib_023::Lib023_Fn068(UObject* In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, int32& Out4, bool In5) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn069(FName In0, FString& Out1, const TArray< int32 >& In2, float In3, FString& Out4, const TArray< int32 >& In5, FString& Out6) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn070(FName In0, int32& Out1, FName In2, UObject* In3, FName In4, const FString& In5, float In6) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn071(const TArray< int32 >& In0, float In1) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn072(float In0, const FVector& In1, UObject* In2, FName In3) {}
+FString UKDGBenchLib_023::Lib023_Fn073(UObject* In0, int32 In1, bool In2, FName In3, int32 In4) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32 In1, FString& Out2, const FTransform& In3, FName In4, int32& Out5, const FTransform& In6, int32 In7) {}
+float UKDGBenchLib_023::Lib023_Fn075(FString& Out0, float In1, float In2, const FVector& In3, int32 In4, UObject* In5, const FVector& In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn076(const FTransform& In0, const FString& In1, FVector& Out2, const FVector& In3, int32& Out4, int32 In5, UObject* In6) { return {}; }
+int32 UKDGBenchLib_023::Lib023_Fn077(const FTransform& In0) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn078(UObject* In0, const FVector& In1, FName In2, int32 In3) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn079(bool In0, float In1, FString& Out2, FVector& Out3, int32 In4, UObject* In5, const FTransform& In6) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn080(FName In0, int32 In1, int32 In2, float In3, const TArray< int32 >& In4) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn081(const FString& In0) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, int32 In1, const FString& In2, const TArray< int32 >& In3) {}
+void UKDGBenchLib_023::Lib023_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FString& Out1, FName In2) {}
+void UKDGBenchLib_023::Lib023_Fn084(int32& Out0, FString& Out1, const FTransform& In2) {}
+FString UKDGBenchLib_023::Lib023_Fn085(FName In0, UObject* In1, bool In2, const FTransform& In3) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn086(float In0, int32 In1) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn087(const TArray< int32 >& In0, int32 In1, const FString& In2, FString& Out3, FString& Out4, int32 In5, int32& Out6) { return {}; }
+FString UKDGBenchLib_023::Lib023_Fn088(int32 In0, const FTransform& In1, int32& Out2, const FString& In3) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn089(float In0, const FVector& In1, int32 In2) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn090(FString& Out0, int32& Out1, const TArray< int32 >& In2, float In3, FVector& Out4, const FString& In5) { return {}; }
+FVector UKDGBenchLib_023::Lib023_Fn091(int32& Out0, const FVector& In1, float In2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn092(FName In0) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn093(int32& Out0, int32 In1, const FTransform& In2) { return {}; }
+int32 UKDGBenchLib_023::Lib023_Fn094(bool In0, int32 In1, float In2, const FString& In3) { return {}; }
+bool UKDGBenchLib_023::Lib023_Fn095(FName In0, FName In1, FString& Out2, const FString& In3, float In4, const FTransform& In5) { return {}; }
+float UKDGBenchLib_023::Lib023_Fn096(const FVector& In0, UObject* In1, int32& Out2, FVector& Out3, UObject* In4, const FVector& In5, int32& Out6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn097(FVector& Out0, const TArray< int32 >& In1, float In2, bool In3, const FTransform& In4, FString& Out5, int32& Out6) {}
+float UKDGBenchLib_023::Lib023_Fn098(const FTransform& In0, FVector& Out1, FName In2, FName In3, int32& Out4, const FVector& In5, int32 In6, FName In7) { return {}; }
+void UKDGBenchLib_023::Lib023_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FName In1, const TArray< int32 >& In2, const FVector& In3) {}
+
+FVector UKDGBenchLib_024::Lib024_Fn000(FString& Out0, const FVector& In1, UObject* In2, int32& Out3) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn001(const TArray< int32 >& In0) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn002(int32& Out0, bool In1, FString& Out2) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn003(const FVector& In0, FString& Out1, const FTransform& In2, int32& Out3, float In4, int32& Out5, const FTransform& In6, const FVector& In7) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn004(const TArray< int32 >& In0, const FTransform& In1, float In2, const FString& In3, FString& Out4, int32& Out5) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn005(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, UObject* In2, FName In3, UObject* In4) {}
+FString UKDGBenchLib_024::Lib024_Fn006(FString& Out0, const FString& In1, const TArray< int32 >& In2, const FVector& In3) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn007(const FTransform& In0, const FString& In1, FString& Out2, int32 In3) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn008(FString& Out0, FVector& Out1, FString& Out2, const TArray< int32 >& In3, const FTransform& In4, UObject* In5, FString& Out6, FName In7) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn009(bool In0, UObject* In1) {}
+float UKDGBenchLib_024::Lib024_Fn010(const FTransform& In0, float In1) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1, const FVector& In2) {}
+FVector UKDGBenchLib_024::Lib024_Fn012(int32& Out0, float In1, float In2, int32 In3, FName In4, const FVector& In5, UObject* In6) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn013() { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn014(const TArray< int32 >& In0, UObject* In1, FString& Out2, int32& Out3, FVector& Out4, FVector& Out5, int32 In6) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn015(UObject* In0) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn016(const TArray< int32 >& In0, const FTransform& In1, int32 In2, float In3, float In4) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn017(const FString& In0, const FVector& In1, const FTransform& In2, bool In3, float In4) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn018(FVector& Out0, float In1, float In2) {}
+FString UKDGBenchLib_024::Lib024_Fn019(FName In0, bool In1, FName In2, int32& Out3, FString& Out4, FString& Out5, const TArray< int32 >& In6, int32 In7) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn020(float In0, UObject* In1, FString& Out2, UObject* In3, UObject* In4) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn021(const FVector& In0, const TArray< int32 >& In1, const FVector& In2, const FTransform& In3) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn022(int32 In0, FName In1, FString& Out2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn023(bool In0, const FVector& In1, FString& Out2, FVector& Out3, FString& Out4, const TArray< int32 >& In5) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0) {}
+FString UKDGBenchLib_024::Lib024_Fn025() { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn026(FVector& Out0, int32 In1, float In2, int32& Out3, bool In4, int32 In5, const FVector& In6) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn027(const TArray< int32 >& In0, FVector& Out1, const FVector& In2, const FString& In3, const FTransform& In4, float In5) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn028(const TArray< int32 >& In0, int32 In1) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn029(int32 In0, float In1, int32 In2, FName In3, const FTransform& In4, UObject* In5) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn030(const FTransform& In0, const FTransform& In1, FString& Out2) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn031(int32& Out0, const TArray< int32 >& In1, UObject* In2) {}
+bool UKDGBenchLib_024::Lib024_Fn032(bool In0, float In1, float In2, const FVector& In3) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn033(const FTransform& In0, const FString& In1, FVector& Out2, FName In3, const FString& In4, bool In5, int32& Out6) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn034(float In0, const TArray< int32 >& In1) {}
+FString UKDGBenchLib_024::Lib024_Fn035(const FVector& In0, const FTransform& In1) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn036(FVector& Out0, int32& Out1, UObject* In2) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn037(int32& Out0, float In1, const FTransform& In2, UObject* In3) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn038(const FTransform& In0, float In1, FName In2, int32& Out3, const FVector& In4, float In5) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn039(const TArray< int32 >& In0, int32 In1, UObject* In2, float In3, UObject* In4, bool In5, UObject* In6) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn040(const FVector& In0) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn041(const FString& In0, bool In1, const FTransform& In2, const FTransform& In3, int32& Out4, int32& Out5, float In6) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn042(FString& Out0, const TArray< int32 >& In1, const FVector& In2, const TArray< int32 >& In3) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn043() { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn044(bool In0, int32 In1) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn045(const TArray< int32 >& In0, const FTransform& In1, FName In2, const FTransform& In3, const FVector& In4, FName In5, bool In6, int32 In7) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn046(bool In0, const FString& In1, FString& Out2, FVector& Out3, const FTransform& In4) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn047(FVector& Out0) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn048() { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn049(float In0, FName In1) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn050(float In0, float In1, const FString& In2, FString& Out3, bool In4) {}
+int32 UKDGBenchLib_024::Lib024_Fn051(const FString& In0, const FVector& In1, const TArray< int32 >& In2, bool In3) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn052(int32& Out0, int32& Out1, int32 In2, int32 In3, UObject* In4, const FVector& In5, int32 In6, bool In7) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn053(const FString& In0, FString& Out1, FVector& Out2, FName In3, const FVector& In4, const TArray< int32 >& In5, UObject* In6) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn054(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn055() { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn056(const TArray< int32 >& In0, FString& Out1, UObject* In2, const FVector& In3) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn057(bool In0, const FVector& In1, int32 In2, const FTransform& In3, int32 In4, UObject* In5) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn058(const FString& In0, const FString& In1, int32& Out2, const FString& In3) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn059(FName In0, bool In1, int32 In2, FVector& Out3, const FVector& In4, float In5, FString& Out6, FString& Out7) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn060(FString& Out0, FString& Out1, const FVector& In2, int32& Out3, float In4) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn061(bool In0, int32& Out1, int32 In2, bool In3, FVector& Out4, int32& Out5, int32 In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0) {}
+float UKDGBenchLib_024::Lib024_Fn063(int32 In0, const FVector& In1, const FTransform& In2, int32& Out3, FString& Out4, FName In5, const FTransform& In6, const TArray< int32 >& In7) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn064() { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn065(FString& Out0, float In1, int32& Out2, bool In3, const FTransform& In4, const FString& In5, FString& Out6) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn066(FName In0, bool In1, int32 In2, int32& Out3) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn067(int32& Out0) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn068(UObject* In0, float In1, const FTransform& In2, FVector& Out3) {}
+int32 UKDGBenchLib_024::Lib024_Fn069(UObject* In0, int32 In1, FString& Out2, FString& Out3, UObject* In4) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn070(const TArray< int32 >& In0, const FString& In1, FString& Out2, bool In3, FString& Out4, FString& Out5, int32& Out6) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn071(FName In0, UObject* In1, UObject* In2) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn072(FString& Out0) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn073(int32& Out0, const FString& In1, const FString& In2, FString& Out3, FString& Out4, FName In5, int32 In6) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn074(bool In0) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn075(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0) {}
+float UKDGBenchLib_024::Lib024_Fn076(FVector& Out0, FString& Out1, const TArray< int32 >& In2, int32 In3, bool In4, const FTransform& In5) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn077(int32& Out0, const FTransform& In1) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn078() { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn079(int32 In0, FName In1, FString& Out2, FName In3) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn080(FName In0, int32 In1, const FString& In2, float In3, float In4, const FTransform& In5) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn081(float In0, float In1, const FTransform& In2, float In3, float In4, const FVector& In5) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn082(FName In0, const FVector& In1, float In2, int32 In3, bool In4) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn083(FName In0, FName In1, FName In2) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn084(const FVector& In0, int32& Out1, FName In2, const FVector& In3, const FTransform& In4, const TArray< int32 >& In5, int32 In6) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn085(const FTransform& In0, const FVector& In1) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn086(const TArray< int32 >& In0, float In1, int32 In2, int32& Out3) { return {}; }
+float UKDGBenchLib_024::Lib024_Fn087(bool In0, float In1, FString& Out2, FString& Out3, const FString& In4) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn088(int32& Out0, FVector& Out1, bool In2, float In3, int32 In4, float In5, UObject* In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn089(int32 In0, FString& Out1, const TArray< int32 >& In2, int32 In3, FName In4) {}
+bool UKDGBenchLib_024::Lib024_Fn090(float In0, float In1, const FTransform& In2, bool In3, const TArray< int32 >& In4, float In5, UObject* In6) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn091(const TArray< int32 >& In0, int32 In1, const FString& In2, FName In3, FString& Out4, const FString& In5) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn092(FVector& Out0, UObject* In1, const FString& In2) { return {}; }
+bool UKDGBenchLib_024::Lib024_Fn093(FVector& Out0, FName In1) { return {}; }
+void UKDGBenchLib_024::Lib024_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, UObject* In2) {}
+FVector UKDGBenchLib_024::Lib024_Fn095() { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn096(const FVector& In0, bool In1, FString& Out2, FName In3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_024::Lib024_Fn097(float In0, float In1) { return {}; }
+FVector UKDGBenchLib_024::Lib024_Fn098(const FString& In0, const FTransform& In1, const FTransform& In2, FVector& Out3, int32 In4, const FTransform& In5) { return {}; }
+FString UKDGBenchLib_024::Lib024_Fn099() { return {}; }
+
+void UKDGBenchLib_025::Lib025_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FVector& In1, UObject* In2, FVector& Out3, float In4, FVector& Out5, FName In6, float In7) {}
+void UKDGBenchLib_025::Lib025_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32 In1, const FString& In2, int32& Out3, FVector& Out4, bool In5) {}
+FString UKDGBenchLib_025::Lib025_Fn002(const FString& In0, FString& Out1, const FTransform& In2, bool In3, const FString& In4, const FTransform& In5, FVector& Out6) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn003(UObject* In0, FName In1) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, FName In1, int32& Out2, const FString& In3, int32& Out4, FVector& Out5, FName In6) {}
+float UKDGBenchLib_025::Lib025_Fn005(UObject* In0, int32 In1, FString& Out2, FName In3, const FVector& In4, int32 In5, int32& Out6) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn006(bool In0) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn007(UObject* In0, int32& Out1, FString& Out2, FString& Out3, bool In4, const TArray< int32 >& In5) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn008(const FTransform& In0, const FString& In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, FName In5, UObject* In6) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn009(const TArray< int32 >& In0, const FString& In1, float In2) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn010(int32& Out0, UObject* In1, FString& Out2, FString& Out3, int32& Out4) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn011(const FVector& In0, UObject* In1, FString& Out2, FString& Out3, const FVector& In4, UObject* In5, UObject* In6) {}
+int32 UKDGBenchLib_025::Lib025_Fn012(FName In0, const TArray< int32 >& In1, int32 In2) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn013(float In0) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn014(int32 In0, bool In1, const FVector& In2, bool In3, const FString& In4, int32 In5) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn015() {}
+FString UKDGBenchLib_025::Lib025_Fn016(UObject* In0, const FVector& In1, UObject* In2, const FVector& In3, FVector& Out4, const TArray< int32 >& In5, const FVector& In6) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FString& Out1, FVector& Out2, int32 In3, int32 In4) {}
+float UKDGBenchLib_025::Lib025_Fn018(UObject* In0, bool In1) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn019(float In0) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn020(FName In0, const FVector& In1, const FVector& In2, int32& Out3, FName In4, const FString& In5) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn021(int32 In0, float In1, const FTransform& In2, FVector& Out3, int32& Out4, int32& Out5, FName In6, FName In7) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn022(const TArray< int32 >& In0, FString& Out1, bool In2) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn023(float In0, const TArray< int32 >& In1, FString& Out2, int32 In3) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn024(FString& Out0, const TArray< int32 >& In1, const FTransform& In2, FVector& Out3, UObject* In4) {}
+void UKDGBenchLib_025::Lib025_Fn025(int32& Out0, const FTransform& In1, const TArray< int32 >& In2, const FTransform& In3, const FString& In4, FVector& Out5, FString& Out6, const FTransform& In7) {}
+void UKDGBenchLib_025::Lib025_Fn026(float In0) {}
+FVector UKDGBenchLib_025::Lib025_Fn027(FName In0, float In1, int32 In2, UObject* In3, int32 In4, const TArray< int32 >& In5, UObject* In6, int32& Out7) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, float In4, const FTransform& In5, int32& Out6, FName In7) {}
+void UKDGBenchLib_025::Lib025_Fn029(const FTransform& In0, const FTransform& In1, FVector& Out2, const FVector& In3, FName In4, int32& Out5, const TArray< int32 >& In6) {}
+float UKDGBenchLib_025::Lib025_Fn030(UObject* In0, FName In1, UObject* In2, bool In3) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn031(const FTransform& In0) {}
+FString UKDGBenchLib_025::Lib025_Fn032(const TArray< int32 >& In0, UObject* In1, const TArray< int32 >& In2, FName In3, UObject* In4, bool In5) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn033(FString& Out0, int32& Out1, const FVector& In2, const FString& In3, float In4, const TArray< int32 >& In5) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn034(int32& Out0, const FVector& In1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn035(const FVector& In0) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn036(FVector& Out0, FString& Out1) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn037() { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn038() { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn039(int32 In0, bool In1, const TArray< int32 >& In2) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn040(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn041(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn042(const TArray< int32 >& In0, int32 In1) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn043(FVector& Out0, FString& Out1, UObject* In2) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn044() { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn045(const FTransform& In0, FString& Out1) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn046(UObject* In0) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn047(float In0, UObject* In1, float In2) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn048(bool In0, int32 In1) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn049(FString& Out0, FVector& Out1, int32& Out2, FVector& Out3, int32& Out4, const FTransform& In5, FName In6, const FString& In7) {}
+bool UKDGBenchLib_025::Lib025_Fn050(UObject* In0, bool In1, FVector& Out2) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn051(float In0) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn052() { return {}; }
+void UKDGBenchLib_025::Lib025_Fn053(int32& Out0, bool In1, FName In2, FVector& Out3, FName In4, const FString& In5) {}
+void UKDGBenchLib_025::Lib025_Fn054(UObject* In0, int32& Out1, FString& Out2, UObject* In3, const FTransform& In4, int32 In5) {}
+int32 UKDGBenchLib_025::Lib025_Fn055(int32 In0, float In1, UObject* In2) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn056(int32 In0, const FTransform& In1, FName In2, const FString& In3, UObject* In4, UObject* In5, UObject* In6) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn057(FVector& Out0) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn058(const TArray< int32 >& In0, int32 In1) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn059(const TArray< int32 >& In0, FString& Out1, const TArray< int32 >& In2) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn060(float In0, FName In1, const FTransform& In2, bool In3) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn061(UObject* In0, UObject* In1) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn062(const FString& In0, float In1, UObject* In2, bool In3, FName In4, UObject* In5, const FString& In6, float In7) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn063(const TArray< int32 >& In0, const TArray< int32 >& In1, FName In2, FName In3, UObject* In4, FName In5) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn064(int32& Out0, FVector& Out1) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn065(int32& Out0, float In1, int32& Out2, bool In3, float In4, const FTransform& In5, FString& Out6) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_025::Lib025_Fn067() { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn068(const FString& In0) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn069(UObject* In0, const FVector& In1, const FTransform& In2, float In3) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn070(UObject* In0) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn071(int32& Out0, const FString& In1, FVector& Out2, int32 In3, float In4) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn072(FName In0, int32 In1, const FVector& In2, FName In3, UObject* In4, int32& Out5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn073(const FVector& In0, const FVector& In1, const FString& In2) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn074(const FTransform& In0, const FVector& In1) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn075(bool In0, FName In1, FVector& Out2) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn076(int32 In0, const FVector& In1) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn077(const FTransform& In0, int32 In1, const FString& In2, FName In3, const FString& In4) { return {}; }
+float UKDGBenchLib_025::Lib025_Fn078(const FVector& In0, bool In1, int32 In2, FVector& Out3) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn079(int32& Out0, bool In1, const FTransform& In2, const FString& In3, int32 In4) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn080(bool In0) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn081(FVector& Out0, const FVector& In1) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn082(FString& Out0) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn083(int32& Out0) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn084(UObject* In0, const FString& In1, UObject* In2, int32 In3, float In4, FName In5, const FString& In6) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn085(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_025::Lib025_Fn086(FName In0, UObject* In1) {}
+FString UKDGBenchLib_025::Lib025_Fn087(const TArray< int32 >& In0, UObject* In1, FString& Out2, int32 In3, float In4, float In5, FName In6) { return {}; }
+void UKDGBenchLib_025::Lib025_Fn088() {}
+FVector UKDGBenchLib_025::Lib025_Fn089(bool In0, const FString& In1, int32 In2, const FString& In3, UObject* In4, const FTransform& In5) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn090(FName In0, const FVector& In1, FName In2, FString& Out3, UObject* In4) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn091(float In0, const FString& In1, const FVector& In2, FVector& Out3) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn092() { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn093(const TArray< int32 >& In0, bool In1, int32 In2, UObject* In3, FString& Out4, const FTransform& In5, const FVector& In6) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn094(const FString& In0, FString& Out1, FName In2, FName In3, const FVector& In4, int32 In5, int32 In6, int32 In7) { return {}; }
+int32 UKDGBenchLib_025::Lib025_Fn095(const FVector& In0, const FTransform& In1, int32 In2, int32 In3, const FTransform& In4, float In5, FVector& Out6) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn096(const TArray< int32 >& In0, int32 In1, FString& Out2, UObject* In3, const FString& In4, bool In5, int32 In6) { return {}; }
+bool UKDGBenchLib_025::Lib025_Fn097(FString& Out0, FString& Out1, FName In2, const FString& In3, FName In4, float In5) { return {}; }
+FString UKDGBenchLib_025::Lib025_Fn098(UObject* In0, FName In1, float In2) { return {}; }
+FVector UKDGBenchLib_025::Lib025_Fn099(const FString& In0, FName In1) { return {}; }
+
+FVector UKDGBenchLib_026::Lib026_Fn000(int32& Out0) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn001(FName In0, const FVector& In1, const TArray< int32 >& In2) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, const FString& In2, const TArray< int32 >& In3, const TArray< int32 >& In4) {}
+void UKDGBenchLib_026::Lib026_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, int32& Out2, const FTransform& In3, float In4) {}
+int32 UKDGBenchLib_026::Lib026_Fn004(const FString& In0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3, const FString& In4) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn005(int32 In0, const FTransform& In1, FVector& Out2, const FString& In3, FString& Out4, UObject* In5, bool In6) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn006(UObject* In0, const FString& In1, const FString& In2, const FVector& In3, const FTransform& In4, const TArray< int32 >& In5, const FTransform& In6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn007(UObject* In0, const FString& In1) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn008(const FTransform& In0, float In1, const FString& In2, int32& Out3, const FString& In4, float In5, int32 In6, int32& Out7) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn009(int32 In0, const FTransform& In1, int32 In2, UObject* In3) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, bool In2, const FTransform& In3, float In4, bool In5, float In6, const TArray< int32 >& In7) {}
+int32 UKDGBenchLib_026::Lib026_Fn011(float In0, float In1, const FVector& In2, int32& Out3, int32& Out4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn012(UObject* In0) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn013(FName In0, float In1) {}
+int32 UKDGBenchLib_026::Lib026_Fn014(FName In0, const FVector& In1) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn015(const FTransform& In0, const FTransform& In1, FVector& Out2) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn016(float In0, float In1, int32& Out2, FName In3, FString& Out4, const FString& In5, FString& Out6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn017(int32 In0, const TArray< int32 >& In1, const FVector& In2, FName In3, FVector& Out4, FString& Out5) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn018(UObject* In0, FName In1, const FString& In2, UObject* In3, const TArray< int32 >& In4) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn019(FString& Out0, int32 In1) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn020(int32 In0, int32 In1, const TArray< int32 >& In2, float In3, const TArray< int32 >& In4, bool In5, const FVector& In6) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn021(const FString& In0, int32 In1, const TArray< int32 >& In2, FVector& Out3, UObject* In4, const FTransform& In5, const FVector& In6, bool In7) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn022(FString& Out0, FString& Out1, FName In2, int32 In3, FVector& Out4, const FTransform& In5) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn023(const TArray< int32 >& In0, const FVector& In1, int32 In2) {}
+bool UKDGBenchLib_026::Lib026_Fn024(UObject* In0, UObject* In1, const FVector& In2, const FTransform& In3, const FString& In4) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn025(FString& Out0) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn026(bool In0, const FVector& In1) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn027(const FVector& In0, float In1, const FString& In2, const FVector& In3, FName In4, const FTransform& In5) {}
+FString UKDGBenchLib_026::Lib026_Fn028(int32& Out0, FName In1, FName In2) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn029(FName In0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn030(int32& Out0, FName In1, const TArray< int32 >& In2, bool In3, UObject* In4) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn031(int32 In0) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn032(const FVector& In0) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const TArray< int32 >& In1) {}
+void UKDGBenchLib_026::Lib026_Fn034(UObject* In0, int32& Out1, int32 In2, int32& Out3, FName In4, const TArray< int32 >& In5) {}
+FString UKDGBenchLib_026::Lib026_Fn035() { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn036(FVector& Out0, const TArray< int32 >& In1, UObject* In2, const FTransform& In3, FName In4, const FTransform& In5) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn037(const FString& In0, const FVector& In1, int32& Out2) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FString& In1) {}
+bool UKDGBenchLib_026::Lib026_Fn039(const FString& In0, const FVector& In1, UObject* In2, const FString& In3) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn040(bool In0, FVector& Out1, int32& Out2, const FString& In3, int32& Out4, bool In5, FString& Out6) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn041(int32 In0, const FTransform& In1, const FTransform& In2, UObject* In3, bool In4) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn042(UObject* In0, float In1) {}
+void UKDGBenchLib_026::Lib026_Fn043(const FVector& In0, float In1, int32& Out2, float In3, const TArray< int32 >& In4) {}
+bool UKDGBenchLib_026::Lib026_Fn044(FString& Out0, const TArray< int32 >& In1) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn045(FName In0, const FString& In1, FString& Out2, UObject* In3, int32& Out4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn046(const FString& In0, FString& Out1, int32 In2, UObject* In3, float In4, int32& Out5, const TArray< int32 >& In6, int32& Out7) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn047() { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn048(FString& Out0, FString& Out1, int32 In2, bool In3) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn049(int32 In0, FVector& Out1, FVector& Out2, const TArray< int32 >& In3) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn050(int32 In0, const FString& In1, FName In2) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn051(FString& Out0, UObject* In1) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn052(int32 In0, const FVector& In1, const TArray< int32 >& In2, UObject* In3, const TArray< int32 >& In4, float In5) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn053(int32 In0, int32& Out1, FString& Out2, int32 In3, UObject* In4, const FVector& In5) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn054(bool In0, FName In1, int32& Out2, FName In3, const FTransform& In4, const FString& In5) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn055(float In0, FString& Out1) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn056(const FString& In0, const FTransform& In1, int32 In2) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn057(int32 In0, FName In1, FString& Out2, bool In3) {}
+FVector UKDGBenchLib_026::Lib026_Fn058(const FTransform& In0, bool In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn059(FVector& Out0, float In1, const FVector& In2, const FVector& In3, const FVector& In4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn060() { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn061(UObject* In0, FVector& Out1, FName In2, const TArray< int32 >& In3, const TArray< int32 >& In4) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn062(int32 In0, const TArray< int32 >& In1) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn063(bool In0, int32 In1, float In2, int32& Out3, const FVector& In4) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn064(UObject* In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn065() {}
+FString UKDGBenchLib_026::Lib026_Fn066(float In0, const FVector& In1, const TArray< int32 >& In2, FName In3, float In4, const FString& In5) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn067(int32& Out0) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn068(const TArray< int32 >& In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn069(bool In0, bool In1, float In2, int32 In3) {}
+float UKDGBenchLib_026::Lib026_Fn070(int32& Out0, const FVector& In1, FVector& Out2) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn071(float In0, int32 In1) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32 In1, const FTransform& In2, bool In3, FName In4, FVector& Out5, const FVector& In6, const FString& In7) {}
+FVector UKDGBenchLib_026::Lib026_Fn073(FVector& Out0, int32& Out1, int32& Out2) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn074(int32 In0, const FString& In1, FString& Out2, float In3) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn075(FName In0, FString& Out1, bool In2, float In3, FVector& Out4, const FTransform& In5, FName In6, UObject* In7) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn076(UObject* In0, UObject* In1, FName In2, const FTransform& In3) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn077(int32& Out0, float In1, const TArray< int32 >& In2, FName In3, const FString& In4, const FTransform& In5) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn078() { return {}; }
+float UKDGBenchLib_026::Lib026_Fn079(const FString& In0, FVector& Out1, bool In2, const TArray< int32 >& In3) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn080(int32& Out0, int32 In1, bool In2, FVector& Out3, int32& Out4, FName In5, FName In6, int32& Out7) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn081(bool In0, FName In1, const TArray< int32 >& In2, int32& Out3, const FVector& In4, int32& Out5, const TArray< int32 >& In6) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn082(const FVector& In0, float In1, int32& Out2, int32& Out3, FName In4, int32 In5) { return {}; }
+FString UKDGBenchLib_026::Lib026_Fn083(FString& Out0, const FTransform& In1, const FString& In2, float In3) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn084() { return {}; }
+float UKDGBenchLib_026::Lib026_Fn085(FName In0, int32 In1, UObject* In2, float In3) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn086() { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn087(int32& Out0, FVector& Out1, FName In2, const FString& In3, const FVector& In4, FName In5, UObject* In6, const TArray< int32 >& In7) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn088(int32& Out0, const TArray< int32 >& In1, float In2, float In3, UObject* In4, const FTransform& In5) { return {}; }
+float UKDGBenchLib_026::Lib026_Fn089(UObject* In0, const TArray< int32 >& In1, const FVector& In2, FVector& Out3, const FString& In4, int32 In5, int32 In6, FVector& Out7) { return {}; }
+void UKDGBenchLib_026::Lib026_Fn090(const TArray< int32 >& In0, UObject* In1, bool In2, UObject* In3, int32& Out4, UObject* In5, const FVector& In6, float In7) {}
+bool UKDGBenchLib_026::Lib026_Fn091(const FString& In0, FVector& Out1) { return {}; }
+bool UKDGBenchLib_026::Lib026_Fn092(FVector& Out0, const FString& In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn093(bool In0) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn094(const FVector& In0, const TArray< int32 >& In1, FName In2, FVector& Out3, FName In4, int32& Out5, const FTransform& In6) { return {}; }
+FVector UKDGBenchLib_026::Lib026_Fn095(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn096(FName In0, bool In1, UObject* In2, int32& Out3) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn097(const FString& In0, FString& Out1, const FTransform& In2) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn098(float In0, int32 In1, FName In2, FString& Out3, FName In4, FName In5, const TArray< int32 >& In6, const TArray< int32 >& In7) { return {}; }
+int32 UKDGBenchLib_026::Lib026_Fn099(float In0, FString& Out1, int32& Out2) { return {}; }
+
+FVector UKDGBenchLib_027::Lib027_Fn000(float In0) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn001(UObject* In0, const FVector& In1, const FVector& In2, FVector& Out3, const FTransform& In4, int32 In5) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn002(UObject* In0, float In1, const FString& In2, const TArray< int32 >& In3, int32& Out4, int32 In5) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn003(int32& Out0, int32& Out1, UObject* In2, const TArray< int32 >& In3, float In4, const FTransform& In5, bool In6) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn004(const FTransform& In0, int32 In1, const FVector& In2) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn005() {}
+FString UKDGBenchLib_027::Lib027_Fn006(int32 In0, bool In1, UObject* In2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn007(const FVector& In0, FVector& Out1, FString& Out2, int32& Out3) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn008(int32 In0) { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn009() { return {}; }
+void UKDGBenchLib_027::Lib027_Fn010(const TArray< int32 >& In0, UObject* In1, const TArray< int32 >& In2, FName In3, bool In4, const FVector& In5, const TArray< int32 >& In6, const FVector& In7) {}
+int32 UKDGBenchLib_027::Lib027_Fn011(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, UObject* In3) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn012(UObject* In0, const FString& In1, FVector& Out2, const FString& In3, float In4, const FString& In5, FVector& Out6) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn013(bool In0, int32& Out1, UObject* In2, int32& Out3, int32 In4, const FVector& In5) {}
+bool UKDGBenchLib_027::Lib027_Fn014(int32 In0, FVector& Out1, const FTransform& In2, const TArray< int32 >& In3, const FVector& In4) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn015(int32 In0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn016(const TArray< int32 >& In0, UObject* In1, const FTransform& In2, FString& Out3, bool In4, UObject* In5, int32& Out6) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn017(bool In0, FVector& Out1, int32& Out2, bool In3, const FString& In4, const TArray< int32 >& In5) { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn018(UObject* In0, int32 In1, const FTransform& In2) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn019(const FVector& In0, const FTransform& In1) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn020(int32 In0, FVector& Out1, int32& Out2, FName In3, const FTransform& In4, const FVector& In5) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn021(FString& Out0) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn022(FString& Out0, UObject* In1, FName In2) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn023(FVector& Out0, const FVector& In1, FName In2, FVector& Out3, const FString& In4, int32& Out5) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn024(const FVector& In0, const FVector& In1, FName In2, int32 In3, int32& Out4, FName In5) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn025() { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn026() { return {}; }
+float UKDGBenchLib_027::Lib027_Fn027(const TArray< int32 >& In0, FName In1, UObject* In2, float In3, int32& Out4) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0) {}
+float UKDGBenchLib_027::Lib027_Fn029(const TArray< int32 >& In0, FName In1, FString& Out2, int32& Out3, const FString& In4, UObject* In5, const FTransform& In6, bool In7) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn030(UObject* In0, UObject* In1, int32& Out2, FVector& Out3) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn031(const TArray< int32 >& In0, FString& Out1, FName In2) {}
+int32 UKDGBenchLib_027::Lib027_Fn032(const TArray< int32 >& In0, const TArray< int32 >& In1, bool In2, bool In3, const FTransform& In4) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn033(FString& Out0) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn034(int32& Out0, const FString& In1, FString& Out2, const TArray< int32 >& In3) { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn035() { return {}; }
+void UKDGBenchLib_027::Lib027_Fn036(UObject* In0, const FVector& In1, int32 In2, const TArray< int32 >& In3) {}
+FVector UKDGBenchLib_027::Lib027_Fn037(bool In0, FString& Out1, UObject* In2, const FTransform& In3, UObject* In4) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn038(int32& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn039(FVector& Out0, int32 In1, FName In2, const TArray< int32 >& In3, const TArray< int32 >& In4, float In5, const FString& In6) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn040(int32 In0, const FVector& In1, int32& Out2, const TArray< int32 >& In3, int32& Out4, float In5, FString& Out6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn041(const FTransform& In0, const FTransform& In1, FVector& Out2, bool In3, FName In4, const FVector& In5, const FTransform& In6, FVector& Out7) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, UObject* In1, FName In2, UObject* In3, FVector& Out4, FVector& Out5, const FVector& In6, FName In7) {}
+bool UKDGBenchLib_027::Lib027_Fn043(const FVector& In0, int32 In1, const TArray< int32 >& In2, FName In3, int32 In4, FString& Out5, bool In6) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn044(int32& Out0, FVector& Out1) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn045(const FTransform& In0, int32& Out1, const FTransform& In2, int32& Out3, FString& Out4) { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn046(const TArray< int32 >& In0, int32& Out1, const FTransform& In2, int32& Out3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn047() { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn048(UObject* In0, const FVector& In1, int32& Out2, int32 In3) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn049(FVector& Out0, FVector& Out1) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, FString& Out1, FString& Out2, const FString& In3) {}
+FString UKDGBenchLib_027::Lib027_Fn051(const FTransform& In0, bool In1, int32 In2) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn052(FString& Out0, float In1, const FString& In2) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn053() { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn054(FVector& Out0, const FVector& In1, int32 In2) { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn055(int32& Out0, UObject* In1, const TArray< int32 >& In2, UObject* In3, const TArray< int32 >& In4) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn056(const FString& In0, const FVector& In1, const FString& In2, FString& Out3, FName In4, const FTransform& In5, const FString& In6) {}
+bool UKDGBenchLib_027::Lib027_Fn057(int32& Out0) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, float In2, const FTransform& In3) {}
+void UKDGBenchLib_027::Lib027_Fn059(const TArray< int32 >& In0, FVector& Out1, const TArray< int32 >& In2, FVector& Out3) {}
+void UKDGBenchLib_027::Lib027_Fn060() {}
+bool UKDGBenchLib_027::Lib027_Fn061(FString& Out0, const FString& In1, const TArray< int32 >& In2) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn062(float In0, bool In1, const FString& In2, FVector& Out3, UObject* In4) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FString UKDGBenchLib_027::Lib027_Fn064(bool In0, FVector& Out1, FName In2, FVector& Out3, FVector& Out4, const TArray< int32 >& In5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn065(FName In0, int32 In1, const FTransform& In2, UObject* In3, const TArray< int32 >& In4, const FString& In5, FName In6, FName In7) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn066(const FTransform& In0, UObject* In1, FVector& Out2, UObject* In3, int32 In4, FVector& Out5, int32 In6, const FVector& In7) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn067(const TArray< int32 >& In0, const FTransform& In1, const FTransform& In2, FString& Out3, FVector& Out4, int32& Out5) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn068() {}
+FVector UKDGBenchLib_027::Lib027_Fn069(FVector& Out0, const FVector& In1) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn070(float In0, const FString& In1, FVector& Out2, const FVector& In3, int32 In4) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn071(UObject* In0, FName In1, const FString& In2) {}
+int32 UKDGBenchLib_027::Lib027_Fn072(FString& Out0, FName In1, const TArray< int32 >& In2, UObject* In3, UObject* In4, const FVector& In5, float In6) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn073(float In0) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn074(const FVector& In0, const TArray< int32 >& In1, int32& Out2, int32& Out3, const FVector& In4, const TArray< int32 >& In5, const TArray< int32 >& In6, FName In7) { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn075(bool In0, FVector& Out1, float In2, FString& Out3, const FVector& In4, const TArray< int32 >& In5) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn076(const FVector& In0, int32& Out1, bool In2, const FTransform& In3, float In4, const FVector& In5) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn077(int32& Out0) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn078(const FTransform& In0, const TArray< int32 >& In1, float In2, bool In3, UObject* In4) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn079(FVector& Out0, const FTransform& In1, bool In2, int32& Out3) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn080(FString& Out0, FString& Out1, UObject* In2) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn081() {}
+void UKDGBenchLib_027::Lib027_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const TArray< int32 >& In1, FVector& Out2, float In3) {}
+int32 UKDGBenchLib_027::Lib027_Fn083(int32& Out0) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn084(const FVector& In0, const FVector& In1, int32& Out2, bool In3) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn085(int32 In0, int32 In1, int32 In2, const FVector& In3, FVector& Out4, int32 In5, const FString& In6) { return {}; }
+bool UKDGBenchLib_027::Lib027_Fn086(int32& Out0, float In1, FName In2, const FTransform& In3, FName In4) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn087(const FString& In0, const TArray< int32 >& In1, FVector& Out2, int32 In3, bool In4, int32& Out5, const TArray< int32 >& In6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_027::Lib027_Fn088(float In0, FString& Out1, FString& Out2) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn089(const FVector& In0) {}
+bool UKDGBenchLib_027::Lib027_Fn090(int32& Out0, int32& Out1, FName In2, const FString& In3, bool In4) { return {}; }
+FVector UKDGBenchLib_027::Lib027_Fn091(const TArray< int32 >& In0, int32 In1, FString& Out2, FVector& Out3, const TArray< int32 >& In4) { return {}; }
+FString UKDGBenchLib_027::Lib027_Fn092() { return {}; }
+void UKDGBenchLib_027::Lib027_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, int32& Out2, float In3) {}
+FVector UKDGBenchLib_027::Lib027_Fn094(FVector& Out0, const TArray< int32 >& In1, const FTransform& In2, const FTransform& In3, const FTransform& In4, FName In5) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, UObject* In1) {}
+int32 UKDGBenchLib_027::Lib027_Fn096(bool In0, const TArray< int32 >& In1) { return {}; }
+void UKDGBenchLib_027::Lib027_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FVector& In1, const TArray< int32 >& In2, const FString& In3, float In4, UObject* In5, int32 In6) {}
+bool UKDGBenchLib_027::Lib027_Fn098(UObject* In0, const FString& In1, float In2, int32& Out3, const FVector& In4, FName In5) { return {}; }
+float UKDGBenchLib_027::Lib027_Fn099(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, FString& Out3) { return {}; }
+
+void UKDGBenchLib_028::Lib028_Fn000(float In0) {}
+int32 UKDGBenchLib_028::Lib028_Fn001() { return {}; }
+void UKDGBenchLib_028::Lib028_Fn002(FString& Out0, FString& Out1, const FTransform& In2, FName In3, int32& Out4, float In5, const FTransform& In6, FName In7) {}
+FString UKDGBenchLib_028::Lib028_Fn003(bool In0, bool In1, const FString& In2) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn004() { return {}; }
+float UKDGBenchLib_028::Lib028_Fn005(const FTransform& In0) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn006(FVector& Out0, const FVector& In1) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn007() { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn008(FString& Out0) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn009(const FTransform& In0, float In1, const FVector& In2, float In3, int32 In4, float In5, UObject* In6, const FString& In7) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn010(float In0) {}
+FVector UKDGBenchLib_028::Lib028_Fn011(bool In0, int32& Out1, FVector& Out2, int32& Out3, FName In4) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn012() { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn013(int32 In0, FName In1, FVector& Out2) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn014(const FTransform& In0, UObject* In1, int32& Out2, const FString& In3) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn015(FName In0) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32 In1, UObject* In2, const TArray< int32 >& In3) {}
+bool UKDGBenchLib_028::Lib028_Fn017(FName In0, int32 In1, int32 In2, FString& Out3, FVector& Out4, FString& Out5) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1, int32& Out2, int32& Out3, FVector& Out4, float In5, float In6) {}
+FString UKDGBenchLib_028::Lib028_Fn019(float In0, const FTransform& In1, FString& Out2) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0) {}
+void UKDGBenchLib_028::Lib028_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, FVector& Out2, FString& Out3, int32 In4, const FString& In5, FString& Out6, float In7) {}
+int32 UKDGBenchLib_028::Lib028_Fn022(float In0, int32& Out1, const TArray< int32 >& In2, const FTransform& In3, const TArray< int32 >& In4) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn023() { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn024() { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn025(FName In0) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn026(float In0, const FVector& In1, const FString& In2) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn027(FString& Out0, int32& Out1, float In2) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn028(UObject* In0, int32 In1, const TArray< int32 >& In2) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn029(bool In0, FVector& Out1, FString& Out2, const FTransform& In3, bool In4, int32& Out5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn030(const FString& In0, FString& Out1, FString& Out2, FVector& Out3, FVector& Out4, FString& Out5, const FVector& In6, const TArray< int32 >& In7) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn031(const FString& In0, int32 In1, const FTransform& In2, bool In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_028::Lib028_Fn033(UObject* In0, UObject* In1, bool In2, const FVector& In3, FVector& Out4, float In5, float In6, const FVector& In7) {}
+int32 UKDGBenchLib_028::Lib028_Fn034(const FString& In0) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn035(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, UObject* In1, const FVector& In2) {}
+bool UKDGBenchLib_028::Lib028_Fn036(UObject* In0, const FVector& In1, const FVector& In2, UObject* In3, const TArray< int32 >& In4) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn037() { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn038(int32 In0, const FString& In1, const FString& In2, FName In3, int32& Out4, FName In5, int32 In6, const FVector& In7) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn039(FString& Out0) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn040(float In0, const TArray< int32 >& In1, FVector& Out2, float In3, int32 In4) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn041(const FString& In0, UObject* In1) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn042(FString& Out0, const FVector& In1, bool In2, const FString& In3, int32& Out4, const FVector& In5) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn043(bool In0, FName In1, FVector& Out2, float In3, const FTransform& In4, UObject* In5) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn044() { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn045(const FTransform& In0, int32& Out1, UObject* In2, const FString& In3, const FTransform& In4) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn046(const FTransform& In0, int32 In1, float In2, const FString& In3, const FVector& In4, UObject* In5, FVector& Out6) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn047(const TArray< int32 >& In0, UObject* In1, int32& Out2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn048(const FString& In0, float In1, const TArray< int32 >& In2, bool In3, float In4, FName In5, bool In6) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn049(const FString& In0) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn050(const FVector& In0, FVector& Out1, const TArray< int32 >& In2, const FString& In3, UObject* In4, UObject* In5, bool In6) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FTransform& In1, float In2, int32& Out3, FVector& Out4) {}
+int32 UKDGBenchLib_028::Lib028_Fn052(const TArray< int32 >& In0, UObject* In1, FString& Out2, const FVector& In3, FName In4, int32& Out5, const FString& In6, const TArray< int32 >& In7) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn053(const TArray< int32 >& In0, const FTransform& In1, int32& Out2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn054(int32 In0, float In1, int32& Out2) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn055(FName In0, int32 In1, const FTransform& In2, const FVector& In3, const FTransform& In4, float In5, const FVector& In6, float In7) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn056(bool In0, int32& Out1, int32& Out2, const TArray< int32 >& In3) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn057(const TArray< int32 >& In0, FString& Out1, FString& Out2) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn058() { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn059(const FVector& In0, FName In1, const FString& In2, bool In3, FString& Out4, FName In5, const FVector& In6) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn060(int32 In0) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn061(FString& Out0, float In1, bool In2, bool In3, const FString& In4, FName In5, UObject* In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn062(const FString& In0, bool In1, const TArray< int32 >& In2) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const TArray< int32 >& In1, int32 In2, int32& Out3, const FTransform& In4, FString& Out5, int32& Out6) {}
+FVector UKDGBenchLib_028::Lib028_Fn064(FVector& Out0, FString& Out1, FName In2, const FString& In3, float In4, int32 In5, int32& Out6) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn065(const FString& In0, const FTransform& In1) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn066(bool In0, int32 In1, UObject* In2, FString& Out3, FVector& Out4, const FString& In5, float In6, FName In7) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn067(const FTransform& In0, FName In1, FString& Out2, FName In3, UObject* In4, UObject* In5) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn068(FVector& Out0, const FVector& In1, bool In2) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn069(const FVector& In0) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn070(const FString& In0, int32& Out1) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn071(FName In0, const FString& In1, FName In2, const FTransform& In3, const FTransform& In4) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn072(int32 In0, FString& Out1, FName In2, float In3, const TArray< int32 >& In4, const FVector& In5, const TArray< int32 >& In6, FVector& Out7) {}
+int32 UKDGBenchLib_028::Lib028_Fn073(const FString& In0, FVector& Out1, int32& Out2, const FVector& In3, UObject* In4, FName In5, const FString& In6) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn074(const FString& In0, const TArray< int32 >& In1) {}
+int32 UKDGBenchLib_028::Lib028_Fn075(const FVector& In0, const FString& In1) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn076() {}
+FString UKDGBenchLib_028::Lib028_Fn077(const TArray< int32 >& In0) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn078(const FString& In0, int32 In1, UObject* In2, const FTransform& In3, const TArray< int32 >& In4, FString& Out5, int32 In6) {}
+float UKDGBenchLib_028::Lib028_Fn079(const TArray< int32 >& In0, const FVector& In1, FString& Out2, bool In3) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn080(FName In0, bool In1, const TArray< int32 >& In2, UObject* In3, FString& Out4) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, int32& Out2) {}
+FString UKDGBenchLib_028::Lib028_Fn082(int32 In0) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn083(int32 In0, const FVector& In1, bool In2) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FVector& In1, const FTransform& In2, float In3, bool In4, float In5, const FVector& In6) {}
+int32 UKDGBenchLib_028::Lib028_Fn085(const FString& In0, bool In1, const FVector& In2, FName In3) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn086(const TArray< int32 >& In0, FString& Out1, const FString& In2, const FTransform& In3, const FVector& In4, int32& Out5) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn087(int32 In0, FVector& Out1, FName In2, int32 In3, UObject* In4, float In5, FString& Out6) {}
+FString UKDGBenchLib_028::Lib028_Fn088(const FString& In0, float In1, float In2, float In3, float In4, FName In5) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn089(UObject* In0, const FTransform& In1, const TArray< int32 >& In2, FVector& Out3) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn090(int32 In0, FString& Out1, FVector& Out2, const FTransform& In3) { return {}; }
+void UKDGBenchLib_028::Lib028_Fn091(bool In0) {}
+bool UKDGBenchLib_028::Lib028_Fn092(FName In0, float In1, FVector& Out2, FVector& Out3, UObject* In4, float In5) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn093(FVector& Out0, bool In1, FName In2, FVector& Out3, int32& Out4) { return {}; }
+bool UKDGBenchLib_028::Lib028_Fn094(UObject* In0, int32& Out1, const FString& In2, FString& Out3, float In4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_028::Lib028_Fn095() { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn096(const TArray< int32 >& In0, float In1, const FVector& In2, const FString& In3, const TArray< int32 >& In4, FName In5, const FTransform& In6) { return {}; }
+FString UKDGBenchLib_028::Lib028_Fn097(FString& Out0, FName In1, const FTransform& In2, int32 In3, int32 In4, const TArray< int32 >& In5, const FTransform& In6, bool In7) { return {}; }
+float UKDGBenchLib_028::Lib028_Fn098(FName In0, int32& Out1) { return {}; }
+FVector UKDGBenchLib_028::Lib028_Fn099(float In0, int32 In1, bool In2, UObject* In3, const FVector& In4) { return {}; }
+
+int32 UKDGBenchLib_029::Lib029_Fn000(const FString& In0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, FString& Out4) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_029::Lib029_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0) {}
+bool UKDGBenchLib_029::Lib029_Fn003(FString& Out0, const FTransform& In1, const FString& In2) { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn004(FName In0, UObject* In1, float In2) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn005(const FTransform& In0) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn006(const FVector& In0, bool In1, float In2, FVector& Out3, FName In4, const FString& In5, const FVector& In6) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FTransform& In1, const FVector& In2, const FVector& In3) {}
+FString UKDGBenchLib_029::Lib029_Fn008(const FString& In0, int32& Out1, FVector& Out2, int32 In3, int32& Out4, const TArray< int32 >& In5) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn009(UObject* In0, const FString& In1, int32& Out2, UObject* In3, const TArray< int32 >& In4, FName In5, FVector& Out6, FVector& Out7) { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn010(bool In0, int32 In1, const FVector& In2, int32 In3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn011(int32 In0, FString& Out1, const FTransform& In2, int32 In3, FString& Out4, const FTransform& In5, float In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn012(int32& Out0, int32 In1, UObject* In2, int32& Out3, FVector& Out4, float In5, bool In6, bool In7) {}
+bool UKDGBenchLib_029::Lib029_Fn013(int32 In0, FVector& Out1, int32 In2, const FVector& In3, const FTransform& In4, const FString& In5, UObject* In6) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn014(const FString& In0, int32 In1, int32& Out2) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn015(const FTransform& In0, int32 In1, UObject* In2, FString& Out3, FName In4, const FVector& In5, float In6) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32 In1, int32 In2, bool In3, UObject* In4, const FVector& In5) {}
+void UKDGBenchLib_029::Lib029_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, FVector& Out2, FName In3, FString& Out4, int32 In5, const FTransform& In6, int32 In7) {}
+void UKDGBenchLib_029::Lib029_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_029::Lib029_Fn019(float In0, float In1, const FTransform& In2, bool In3, int32& Out4, FVector& Out5, int32 In6) { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn020(int32& Out0) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn021(int32& Out0) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn022(FName In0, bool In1, const FVector& In2, const FTransform& In3, FVector& Out4, const TArray< int32 >& In5, FVector& Out6, FName In7) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn023(FString& Out0, UObject* In1, UObject* In2, int32 In3) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn024(const FVector& In0, const FTransform& In1, const FTransform& In2, int32& Out3, const TArray< int32 >& In4, const FTransform& In5, FName In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn025(const FString& In0, float In1, const TArray< int32 >& In2, const TArray< int32 >& In3) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn026(FVector& Out0, const FTransform& In1, float In2, const TArray< int32 >& In3) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn027(const FVector& In0) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0) {}
+FString UKDGBenchLib_029::Lib029_Fn029(const FVector& In0, UObject* In1, FString& Out2, int32& Out3, UObject* In4) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn030(FVector& Out0, const FTransform& In1, UObject* In2, FVector& Out3, const FVector& In4, FVector& Out5) { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn031() { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn032(FString& Out0, const FTransform& In1, bool In2, const FString& In3, FVector& Out4) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn033(bool In0, FName In1, bool In2, FString& Out3, FString& Out4) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn034(float In0, const FVector& In1, FVector& Out2, const FString& In3, bool In4, const FVector& In5, FName In6) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn035(int32& Out0, FString& Out1) {}
+FString UKDGBenchLib_029::Lib029_Fn036() { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn037(const FVector& In0, FVector& Out1, UObject* In2, const TArray< int32 >& In3, FName In4, const FVector& In5, int32 In6, bool In7) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn038(const FVector& In0, const TArray< int32 >& In1, bool In2, int32 In3, UObject* In4, int32& Out5, const TArray< int32 >& In6) {}
+float UKDGBenchLib_029::Lib029_Fn039() { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn040(FVector& Out0, const FString& In1, FString& Out2, UObject* In3, FVector& Out4, bool In5) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn041() { return {}; }
+float UKDGBenchLib_029::Lib029_Fn042(const FString& In0, const FString& In1, FString& Out2, FVector& Out3, const FString& In4, const TArray< int32 >& In5, const FTransform& In6) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn043(FString& Out0, const FVector& In1) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn044(float In0, FName In1, const TArray< int32 >& In2, FVector& Out3, FString& Out4, FString& Out5, float In6, const FVector& In7) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn045(FName In0) { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn046(const FTransform& In0, FString& Out1, int32 In2, const FVector& In3, const TArray< int32 >& In4, int32 In5, int32& Out6, float In7) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn047(const FTransform& In0, bool In1, const TArray< int32 >& In2) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn048(UObject* In0, bool In1, float In2, int32& Out3, int32 In4, FName In5) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn049(const FVector& In0, const TArray< int32 >& In1, const FVector& In2, float In3, float In4, const TArray< int32 >& In5, const FString& In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn050(bool In0, bool In1, bool In2, int32 In3, UObject* In4, FName In5) {}
+FVector UKDGBenchLib_029::Lib029_Fn051(FString& Out0) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn052() { return {}; }
+void UKDGBenchLib_029::Lib029_Fn053(bool In0, const TArray< int32 >& In1, const TArray< int32 >& In2, FVector& Out3, float In4) {}
+float UKDGBenchLib_029::Lib029_Fn054(FName In0, FString& Out1, const FVector& In2) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn055(int32 In0, FString& Out1) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn056(bool In0, FVector& Out1, const TArray< int32 >& In2, FName In3, const FVector& In4, const FTransform& In5) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn057(float In0) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn058(bool In0, FString& Out1, FVector& Out2, UObject* In3) {}
+float UKDGBenchLib_029::Lib029_Fn059(const FString& In0, FVector& Out1, bool In2, bool In3, const FVector& In4) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn060(const FVector& In0) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn061(bool In0, const TArray< int32 >& In1, FString& Out2) { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn062() { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn063(const FString& In0, int32& Out1, const TArray< int32 >& In2) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1, FVector& Out2, float In3, FName In4, FString& Out5, float In6, UObject* In7) {}
+float UKDGBenchLib_029::Lib029_Fn065() { return {}; }
+void UKDGBenchLib_029::Lib029_Fn066(const FString& In0, float In1, bool In2, int32 In3, const FTransform& In4, FVector& Out5) {}
+float UKDGBenchLib_029::Lib029_Fn067(const FTransform& In0, float In1, FString& Out2, const FVector& In3, bool In4, bool In5, const FString& In6) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn068(FString& Out0, bool In1) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn069(const FString& In0, const FString& In1, FVector& Out2, float In3, bool In4, int32& Out5, const FVector& In6, UObject* In7) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn070(FString& Out0, const FTransform& In1, int32& Out2, FName In3, const FVector& In4) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn071(FVector& Out0, const FTransform& In1, int32 In2, FName In3, const FTransform& In4) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn072(bool In0, int32 In1, UObject* In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn073(FVector& Out0, const FString& In1, const FString& In2) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn074(const FTransform& In0, UObject* In1, const FVector& In2, int32 In3, UObject* In4, float In5, const TArray< int32 >& In6) {}
+FString UKDGBenchLib_029::Lib029_Fn075(const FString& In0, UObject* In1, int32 In2, bool In3, const TArray< int32 >& In4, const TArray< int32 >& In5) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn076(UObject* In0, const FString& In1, int32& Out2) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn077(FName In0, int32 In1) {}
+float UKDGBenchLib_029::Lib029_Fn078(const FVector& In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, UObject* In1, const TArray< int32 >& In2, const FString& In3, UObject* In4, const FTransform& In5, const FString& In6) {}
+FString UKDGBenchLib_029::Lib029_Fn080(const FVector& In0, int32 In1, const FString& In2, bool In3, const FString& In4) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn081(FName In0, FString& Out1, const TArray< int32 >& In2, FString& Out3, int32 In4, bool In5, const FTransform& In6, bool In7) { return {}; }
+int32 UKDGBenchLib_029::Lib029_Fn082(FString& Out0) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FName In1, const FString& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, FString& Out5, bool In6) {}
+float UKDGBenchLib_029::Lib029_Fn084() { return {}; }
+float UKDGBenchLib_029::Lib029_Fn085(float In0, UObject* In1, bool In2, FName In3, float In4) { return {}; }
+float UKDGBenchLib_029::Lib029_Fn086(UObject* In0, int32 In1, int32& Out2, int32 In3, float In4, const FVector& In5, bool In6, FString& Out7) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn087(FVector& Out0) { return {}; }
+FVector UKDGBenchLib_029::Lib029_Fn088(const TArray< int32 >& In0, const TArray< int32 >& In1, FString& Out2) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn089(FString& Out0, bool In1, bool In2, const FString& In3, UObject* In4, FName In5) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn090(UObject* In0, float In1, const FVector& In2, FVector& Out3, const TArray< int32 >& In4) {}
+int32 UKDGBenchLib_029::Lib029_Fn091(FName In0, const FVector& In1, const TArray< int32 >& In2, UObject* In3, const FTransform& In4, FVector& Out5, const FVector& In6) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn092(int32& Out0) { return {}; }
+FString UKDGBenchLib_029::Lib029_Fn093(int32& Out0, const FString& In1, bool In2, FString& Out3, const FTransform& In4, float In5) { return {}; }
+bool UKDGBenchLib_029::Lib029_Fn094(FName In0, const TArray< int32 >& In1) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FString& Out1) {}
+int32 UKDGBenchLib_029::Lib029_Fn096() { return {}; }
+float UKDGBenchLib_029::Lib029_Fn097(const FVector& In0, const TArray< int32 >& In1, float In2, int32& Out3, float In4, float In5, FVector& Out6) { return {}; }
+void UKDGBenchLib_029::Lib029_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FVector& In1) {}
+FString UKDGBenchLib_029::Lib029_Fn099(UObject* In0, float In1, const FVector& In2, const FVector& In3) { return {}; }
+
@@ -0,0 +1,3105 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchLibraries_3.generated.h"
+
+
+UCLASS()
+class UKDGBenchLib_030 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib030_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn000(const TArray< int32 >& In0, bool In1, const FString& In2);
+	/** Benchmark latent node Lib030_Fn001 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FString& Out1, const FString& In2, FName In3, const FTransform& In4, FVector& Out5, const FString& In6, int32 In7);
+	/** Benchmark latent node Lib030_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0);
+	/** Benchmark callable node Lib030_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn003(FVector& Out0, float In1, int32 In2, FVector& Out3, FString& Out4);
+	/** Benchmark callable node Lib030_Fn004 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn004(const FTransform& In0, const FString& In1, FString& Out2, float In3, FString& Out4);
+	/** Benchmark callable node Lib030_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn005(const TArray< int32 >& In0, int32& Out1, FName In2, bool In3);
+	/** Benchmark pure node Lib030_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn006(FVector& Out0, float In1, FString& Out2, UObject* In3);
+	/** Benchmark callable node Lib030_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn007(UObject* In0, FString& Out1, const FVector& In2, const FString& In3);
+	/** Benchmark pure node Lib030_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn008(bool In0, float In1, const FVector& In2, const TArray< int32 >& In3, int32 In4, int32 In5);
+	/** Benchmark callable node Lib030_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn009(float In0, const FTransform& In1, FString& Out2, const FVector& In3, bool In4, bool In5, FVector& Out6, bool In7);
+	/** Benchmark callable node Lib030_Fn010 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn010(bool In0, FName In1, bool In2, UObject* In3, int32 In4, const FVector& In5);
+	/** Benchmark callable node Lib030_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn011(int32 In0, int32& Out1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib030_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn012(bool In0, const FVector& In1, const FTransform& In2, const FString& In3, int32& Out4, FName In5, UObject* In6);
+	/** Benchmark pure node Lib030_Fn013 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn013(FName In0, bool In1, FVector& Out2, float In3);
+	/** Benchmark callable node Lib030_Fn014 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn014(const TArray< int32 >& In0, float In1, const FTransform& In2, FVector& Out3, UObject* In4, const FTransform& In5);
+	/** Benchmark callable node Lib030_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn015(bool In0, FString& Out1, float In2, FVector& Out3, int32 In4, int32& Out5, int32& Out6);
+	/** Benchmark callable node Lib030_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn016();
+	/** Benchmark pure node Lib030_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn017(bool In0, FName In1, FVector& Out2, FString& Out3, const FVector& In4, int32 In5);
+	/** Benchmark pure node Lib030_Fn018 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn018(bool In0, FString& Out1, float In2);
+	/** Benchmark callable node Lib030_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn019(UObject* In0, float In1, FVector& Out2, const FTransform& In3, const FString& In4, const FTransform& In5, UObject* In6, FVector& Out7);
+	/** Benchmark callable node Lib030_Fn020 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn020(bool In0, const FVector& In1, const FTransform& In2, FVector& Out3, int32 In4);
+	/** Benchmark callable node Lib030_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn021(FVector& Out0, int32 In1, FString& Out2);
+	/** Benchmark callable node Lib030_Fn022 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn022(const FString& In0, UObject* In1, FName In2, const TArray< int32 >& In3, UObject* In4);
+	/** Benchmark callable node Lib030_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn023(int32& Out0, int32 In1, FVector& Out2);
+	/** Benchmark callable node Lib030_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn024(UObject* In0, UObject* In1, UObject* In2, float In3, const FVector& In4, const FVector& In5, FName In6);
+	/** Benchmark pure node Lib030_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn025(bool In0, int32 In1);
+	/** Benchmark callable node Lib030_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn026(int32& Out0, FString& Out1, const FVector& In2, const FTransform& In3);
+	/** Benchmark callable node Lib030_Fn027 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn027();
+	/** Benchmark callable node Lib030_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn028(FVector& Out0, int32 In1, bool In2, int32 In3, const FTransform& In4, int32& Out5);
+	/** Benchmark callable node Lib030_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn029();
+	/** Benchmark pure node Lib030_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn030(const FTransform& In0, FString& Out1, FVector& Out2, bool In3);
+	/** Benchmark callable node Lib030_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn031(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib030_Fn032 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static void Lib030_Fn032(bool In0);
+	/** Benchmark callable node Lib030_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn033(const FTransform& In0, FName In1, FString& Out2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib030_Fn034 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn034();
+	/** Benchmark callable node Lib030_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static void Lib030_Fn035(const FString& In0, UObject* In1, FVector& Out2);
+	/** Benchmark callable node Lib030_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static void Lib030_Fn036(bool In0, FVector& Out1, const FTransform& In2, int32& Out3, FName In4, FName In5);
+	/** Benchmark callable node Lib030_Fn037 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn037(FVector& Out0, const FVector& In1, const TArray< int32 >& In2, FString& Out3, FName In4, int32& Out5, const FString& In6, int32& Out7);
+	/** Benchmark callable node Lib030_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn038();
+	/** Benchmark pure node Lib030_Fn039 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn039(const FTransform& In0);
+	/** Benchmark callable node Lib030_Fn040 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn040(FName In0, const FVector& In1, UObject* In2);
+	/** Benchmark pure node Lib030_Fn041 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn041(float In0, float In1);
+	/** Benchmark callable node Lib030_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn042(int32 In0, FString& Out1);
+	/** Benchmark callable node Lib030_Fn043 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn043(const FString& In0, FVector& Out1, float In2, const FTransform& In3, int32& Out4, const FString& In5, UObject* In6, const FString& In7);
+	/** Benchmark latent node Lib030_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark pure node Lib030_Fn045 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn045(const FTransform& In0, int32& Out1, const FTransform& In2, bool In3, int32 In4, const TArray< int32 >& In5, const FVector& In6);
+	/** Benchmark pure node Lib030_Fn046 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn046(const TArray< int32 >& In0, const FVector& In1, bool In2, FString& Out3, FVector& Out4, bool In5);
+	/** Benchmark callable node Lib030_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn047(const FVector& In0, UObject* In1);
+	/** Benchmark callable node Lib030_Fn048 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn048(int32& Out0, bool In1);
+	/** Benchmark pure node Lib030_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn049(FVector& Out0, const FVector& In1, FString& Out2);
+	/** Benchmark pure node Lib030_Fn050 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn050(UObject* In0, FName In1, int32& Out2, const FString& In3, UObject* In4, const FVector& In5, UObject* In6);
+	/** Benchmark callable node Lib030_Fn051 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn051(int32& Out0, UObject* In1, UObject* In2, const TArray< int32 >& In3, FString& Out4, const TArray< int32 >& In5, FName In6, UObject* In7);
+	/** Benchmark callable node Lib030_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn052(float In0, const FString& In1, FName In2);
+	/** Benchmark pure node Lib030_Fn053 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn053(FName In0);
+	/** Benchmark callable node Lib030_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn054(const TArray< int32 >& In0, FName In1, FString& Out2, FString& Out3, const FString& In4, int32 In5);
+	/** Benchmark latent node Lib030_Fn055 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FString& In1, int32 In2, const FVector& In3, UObject* In4);
+	/** Benchmark callable node Lib030_Fn056 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn056(const FString& In0, const FTransform& In1, UObject* In2, FVector& Out3, const FString& In4);
+	/** Benchmark callable node Lib030_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn057(int32& Out0);
+	/** Benchmark callable node Lib030_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn058(const TArray< int32 >& In0, const FString& In1, const TArray< int32 >& In2, FVector& Out3, int32& Out4, FVector& Out5, bool In6, FString& Out7);
+	/** Benchmark callable node Lib030_Fn059 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn059(const FVector& In0, bool In1);
+	/** Benchmark pure node Lib030_Fn060 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn060(const FVector& In0, int32 In1, int32 In2);
+	/** Benchmark latent node Lib030_Fn061 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, bool In2, const FString& In3, UObject* In4, FName In5, FVector& Out6, UObject* In7);
+	/** Benchmark callable node Lib030_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static void Lib030_Fn062(const FString& In0, float In1, UObject* In2, FString& Out3);
+	/** Benchmark pure node Lib030_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn063(int32& Out0);
+	/** Benchmark callable node Lib030_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static void Lib030_Fn064(UObject* In0, bool In1);
+	/** Benchmark callable node Lib030_Fn065 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn065(const FVector& In0, FName In1, const FString& In2, bool In3, FName In4, UObject* In5, FVector& Out6);
+	/** Benchmark pure node Lib030_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn066(const TArray< int32 >& In0, const FString& In1, UObject* In2, FVector& Out3);
+	/** Benchmark callable node Lib030_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn067(const FTransform& In0, FVector& Out1, int32& Out2, const FString& In3, UObject* In4);
+	/** Benchmark callable node Lib030_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn068(FString& Out0, const FString& In1, bool In2);
+	/** Benchmark callable node Lib030_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static void Lib030_Fn069(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib030_Fn070 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn070(FString& Out0, const FVector& In1, const TArray< int32 >& In2, const FString& In3, bool In4, float In5, int32& Out6, UObject* In7);
+	/** Benchmark pure node Lib030_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn071();
+	/** Benchmark pure node Lib030_Fn072 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn072(int32 In0);
+	/** Benchmark callable node Lib030_Fn073 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn073();
+	/** Benchmark callable node Lib030_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn074(const FTransform& In0, const FString& In1);
+	/** Benchmark callable node Lib030_Fn075 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn075(const FVector& In0, int32 In1, bool In2, const FString& In3, const FVector& In4, bool In5);
+	/** Benchmark pure node Lib030_Fn076 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn076();
+	/** Benchmark callable node Lib030_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn077(bool In0, const FString& In1);
+	/** Benchmark latent node Lib030_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn078(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FString& Out1);
+	/** Benchmark pure node Lib030_Fn079 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn079(FString& Out0, FName In1, const FString& In2, const FString& In3, int32& Out4, FString& Out5, UObject* In6, const FString& In7);
+	/** Benchmark callable node Lib030_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn080(FString& Out0, const FVector& In1, const FVector& In2);
+	/** Benchmark callable node Lib030_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static float Lib030_Fn081();
+	/** Benchmark callable node Lib030_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn082(const FVector& In0, int32& Out1, FName In2, FName In3, FVector& Out4);
+	/** Benchmark latent node Lib030_Fn083 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FVector& Out1);
+	/** Benchmark latent node Lib030_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib030_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, const FVector& In2, const FTransform& In3);
+	/** Benchmark pure node Lib030_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn085(const FVector& In0, float In1, int32 In2, const FTransform& In3, FVector& Out4, const FVector& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib030_Fn086 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn086();
+	/** Benchmark callable node Lib030_Fn087 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FVector Lib030_Fn087(const FString& In0, int32 In1, const FString& In2, const FString& In3, int32& Out4);
+	/** Benchmark callable node Lib030_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn088(int32 In0, const FString& In1, const FTransform& In2, FName In3, const FTransform& In4, FVector& Out5, bool In6);
+	/** Benchmark pure node Lib030_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn089();
+	/** Benchmark callable node Lib030_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn090(const FTransform& In0);
+	/** Benchmark pure node Lib030_Fn091 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn091();
+	/** Benchmark callable node Lib030_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn092(int32& Out0, FVector& Out1, float In2, float In3);
+	/** Benchmark callable node Lib030_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn093(const FTransform& In0, int32 In1, float In2, FString& Out3, const FVector& In4, FString& Out5);
+	/** Benchmark callable node Lib030_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static int32 Lib030_Fn094(int32 In0, FName In1, UObject* In2);
+	/** Benchmark callable node Lib030_Fn095 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn095(const FString& In0, int32& Out1, const FString& In2, const FVector& In3, const TArray< int32 >& In4, int32 In5);
+	/** Benchmark callable node Lib030_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn096(int32& Out0, FString& Out1, int32& Out2, int32 In3, const FVector& In4);
+	/** Benchmark callable node Lib030_Fn097 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn097(FVector& Out0, FVector& Out1, int32& Out2, int32& Out3);
+	/** Benchmark callable node Lib030_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static FString Lib030_Fn098(const FString& In0, FName In1);
+	/** Benchmark callable node Lib030_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib030")
+	static bool Lib030_Fn099(const TArray< int32 >& In0, int32& Out1, UObject* In2, const FVector& In3);
+};
+
+
+UCLASS()
+class UKDGBenchLib_031 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib031_Fn000 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn000();
+	/** Benchmark pure node Lib031_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn001(const FTransform& In0, FString& Out1, FVector& Out2, UObject* In3);
+	/** Benchmark latent node Lib031_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib031_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib031_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn003(int32 In0, float In1);
+	/** Benchmark callable node Lib031_Fn004 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn004(FVector& Out0, bool In1, int32 In2, const FVector& In3);
+	/** Benchmark callable node Lib031_Fn005 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn005(const FTransform& In0, FString& Out1, const FTransform& In2, const TArray< int32 >& In3, float In4);
+	/** Benchmark callable node Lib031_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn006(UObject* In0, const TArray< int32 >& In1, bool In2, const FVector& In3, int32 In4);
+	/** Benchmark callable node Lib031_Fn007 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static void Lib031_Fn007(bool In0);
+	/** Benchmark callable node Lib031_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn008();
+	/** Benchmark pure node Lib031_Fn009 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn009(FVector& Out0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib031_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn010(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, const FTransform& In3, int32& Out4);
+	/** Benchmark callable node Lib031_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn011(UObject* In0, const TArray< int32 >& In1, bool In2, bool In3, float In4, const FTransform& In5, FString& Out6);
+	/** Benchmark pure node Lib031_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn012(const FString& In0);
+	/** Benchmark pure node Lib031_Fn013 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn013(int32& Out0);
+	/** Benchmark callable node Lib031_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static void Lib031_Fn014(bool In0, const TArray< int32 >& In1, const FVector& In2, const FString& In3, int32& Out4);
+	/** Benchmark latent node Lib031_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib031_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1, FString& Out2, bool In3, const FString& In4);
+	/** Benchmark latent node Lib031_Fn016 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib031_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib031_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn017(bool In0, FName In1, float In2, int32 In3);
+	/** Benchmark callable node Lib031_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn018(const FString& In0, int32 In1, const FVector& In2, FString& Out3);
+	/** Benchmark callable node Lib031_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static void Lib031_Fn019();
+	/** Benchmark pure node Lib031_Fn020 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn020(int32 In0, const FTransform& In1);
+	/** Benchmark pure node Lib031_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn021(UObject* In0, const FString& In1, bool In2, const FVector& In3, const TArray< int32 >& In4, FName In5, FString& Out6, FName In7);
+	/** Benchmark pure node Lib031_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn022(float In0, FString& Out1, const FString& In2, const FVector& In3, const FTransform& In4, const FVector& In5, FName In6);
+	/** Benchmark callable node Lib031_Fn023 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn023(float In0, const TArray< int32 >& In1, bool In2, const FTransform& In3);
+	/** Benchmark pure node Lib031_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn024(UObject* In0, const FTransform& In1, int32 In2, int32& Out3, bool In4, int32& Out5, const FVector& In6, bool In7);
+	/** Benchmark callable node Lib031_Fn025 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn025(bool In0, FVector& Out1, const TArray< int32 >& In2, UObject* In3, FVector& Out4, float In5, const FString& In6);
+	/** Benchmark pure node Lib031_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn026();
+	/** Benchmark callable node Lib031_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn027(int32& Out0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib031_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn028(int32 In0, int32 In1, FVector& Out2, FVector& Out3, const FTransform& In4, int32 In5, int32 In6);
+	/** Benchmark callable node Lib031_Fn029 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn029(FString& Out0, FName In1, int32& Out2, UObject* In3, float In4, float In5);
+	/** Benchmark pure node Lib031_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn030(const FTransform& In0, const FVector& In1, FString& Out2);
+	/** Benchmark pure node Lib031_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn031(int32& Out0);
+	/** Benchmark latent node Lib031_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib031_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FString& In1, int32 In2, FString& Out3, float In4, const FVector& In5);
+	/** Benchmark callable node Lib031_Fn033 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn033(UObject* In0, UObject* In1, const TArray< int32 >& In2, float In3, int32 In4, FName In5, float In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib031_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn034(const FTransform& In0, bool In1, float In2, const TArray< int32 >& In3, FName In4, int32 In5, FString& Out6);
+	/** Benchmark callable node Lib031_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn035(const FVector& In0, bool In1, const FTransform& In2);
+	/** Benchmark callable node Lib031_Fn036 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn036(bool In0, int32& Out1, const TArray< int32 >& In2, FVector& Out3, bool In4, FString& Out5, FVector& Out6);
+	/** Benchmark callable node Lib031_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn037(const TArray< int32 >& In0, FVector& Out1, const TArray< int32 >& In2, int32& Out3, FString& Out4);
+	/** Benchmark pure node Lib031_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn038();
+	/** Benchmark pure node Lib031_Fn039 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn039(const FTransform& In0, const FString& In1, const FString& In2);
+	/** Benchmark pure node Lib031_Fn040 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn040(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib031_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn041(const FString& In0, UObject* In1, const FVector& In2, FName In3, int32 In4, FVector& Out5);
+	/** Benchmark callable node Lib031_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn042(FString& Out0, const FString& In1, bool In2, const FVector& In3);
+	/** Benchmark callable node Lib031_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static void Lib031_Fn043(const FVector& In0, int32 In1, UObject* In2, bool In3, FString& Out4, FString& Out5);
+	/** Benchmark callable node Lib031_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn044(const FTransform& In0, int32& Out1, const FString& In2, int32& Out3, int32 In4);
+	/** Benchmark callable node Lib031_Fn045 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn045(const FString& In0, const FTransform& In1, int32 In2, int32& Out3, bool In4, bool In5);
+	/** Benchmark pure node Lib031_Fn046 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn046(int32 In0, const FString& In1, FVector& Out2, float In3);
+	/** Benchmark callable node Lib031_Fn047 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn047(bool In0, FString& Out1, int32 In2, bool In3, const FString& In4, const FVector& In5, UObject* In6, FName In7);
+	/** Benchmark pure node Lib031_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn048(bool In0, int32 In1, FString& Out2, const FString& In3, int32 In4, bool In5, FName In6);
+	/** Benchmark callable node Lib031_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn049(FName In0, UObject* In1);
+	/** Benchmark callable node Lib031_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn050(float In0);
+	/** Benchmark callable node Lib031_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn051(FString& Out0);
+	/** Benchmark callable node Lib031_Fn052 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn052(int32& Out0, FString& Out1, float In2, UObject* In3, UObject* In4, int32& Out5);
+	/** Benchmark callable node Lib031_Fn053 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn053(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib031_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static void Lib031_Fn054(FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib031_Fn055 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static void Lib031_Fn055(FString& Out0);
+	/** Benchmark callable node Lib031_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn056(bool In0, int32& Out1, UObject* In2, FVector& Out3);
+	/** Benchmark callable node Lib031_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn057(float In0, UObject* In1, UObject* In2);
+	/** Benchmark callable node Lib031_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn058(FName In0, FString& Out1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib031_Fn059 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn059(bool In0, float In1, const FVector& In2, const FTransform& In3, const FVector& In4);
+	/** Benchmark callable node Lib031_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn060(bool In0, const FTransform& In1);
+	/** Benchmark callable node Lib031_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn061();
+	/** Benchmark pure node Lib031_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn062(UObject* In0, FVector& Out1, int32 In2, const FString& In3);
+	/** Benchmark callable node Lib031_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn063(const FString& In0, const FVector& In1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib031_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn064(int32 In0, int32 In1);
+	/** Benchmark pure node Lib031_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn065(FName In0, FVector& Out1, int32 In2, int32 In3, const FVector& In4, float In5, const FString& In6, FString& Out7);
+	/** Benchmark callable node Lib031_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn066();
+	/** Benchmark callable node Lib031_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn067(const FVector& In0, float In1, bool In2, const TArray< int32 >& In3, float In4);
+	/** Benchmark pure node Lib031_Fn068 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn068();
+	/** Benchmark latent node Lib031_Fn069 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib031_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, FVector& Out2, int32& Out3, int32& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib031_Fn070 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn070(UObject* In0, const FString& In1, bool In2, FVector& Out3, FVector& Out4, FName In5, FString& Out6, const FTransform& In7);
+	/** Benchmark callable node Lib031_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn071();
+	/** Benchmark pure node Lib031_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn072(float In0, int32 In1, int32& Out2, int32 In3, const FTransform& In4);
+	/** Benchmark pure node Lib031_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn073(int32& Out0, FString& Out1, bool In2);
+	/** Benchmark pure node Lib031_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn074(int32& Out0, float In1);
+	/** Benchmark pure node Lib031_Fn075 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn075();
+	/** Benchmark latent node Lib031_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib031_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib031_Fn077 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn077(bool In0, UObject* In1, FVector& Out2);
+	/** Benchmark callable node Lib031_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static int32 Lib031_Fn078(int32 In0, UObject* In1, int32& Out2, const FString& In3);
+	/** Benchmark callable node Lib031_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn079(const FString& In0, bool In1);
+	/** Benchmark callable node Lib031_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn080(int32& Out0, bool In1, int32& Out2, const FString& In3);
+	/** Benchmark callable node Lib031_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn081();
+	/** Benchmark callable node Lib031_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn082(int32 In0, const FTransform& In1, const FTransform& In2, FString& Out3, const FString& In4);
+	/** Benchmark pure node Lib031_Fn083 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn083(FName In0, FVector& Out1, bool In2, FString& Out3, FString& Out4, const FString& In5);
+	/** Benchmark pure node Lib031_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn084(int32 In0, int32& Out1, UObject* In2, FString& Out3, FName In4);
+	/** Benchmark pure node Lib031_Fn085 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn085(const FString& In0, FString& Out1, const FVector& In2, bool In3, FName In4, int32 In5);
+	/** Benchmark callable node Lib031_Fn086 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn086(bool In0);
+	/** Benchmark callable node Lib031_Fn087 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn087(int32& Out0, const FString& In1, FName In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib031_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn088(float In0, int32& Out1, FName In2, int32 In3, const FVector& In4, UObject* In5);
+	/** Benchmark callable node Lib031_Fn089 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn089(bool In0, FName In1, const TArray< int32 >& In2, bool In3, int32 In4, float In5, FName In6, const FTransform& In7);
+	/** Benchmark callable node Lib031_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn090(const TArray< int32 >& In0, bool In1, FString& Out2, FString& Out3, int32 In4, FString& Out5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib031_Fn091 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn091(FName In0, int32& Out1);
+	/** Benchmark pure node Lib031_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn092(FName In0);
+	/** Benchmark pure node Lib031_Fn093 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn093(int32& Out0, float In1, const TArray< int32 >& In2, UObject* In3, UObject* In4);
+	/** Benchmark pure node Lib031_Fn094 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn094();
+	/** Benchmark callable node Lib031_Fn095 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static bool Lib031_Fn095(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib031_Fn096 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static FString Lib031_Fn096();
+	/** Benchmark pure node Lib031_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib031")
+	static float Lib031_Fn097(const TArray< int32 >& In0, int32& Out1, bool In2);
+	/** Benchmark callable node Lib031_Fn098 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static void Lib031_Fn098(FVector& Out0);
+	/** Benchmark callable node Lib031_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib031")
+	static FVector Lib031_Fn099(FString& Out0, FVector& Out1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_032 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib032_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn000(float In0, int32 In1, FName In2, const FVector& In3, const TArray< int32 >& In4, FVector& Out5, FVector& Out6);
+	/** Benchmark pure node Lib032_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn001(FVector& Out0, FName In1, UObject* In2, int32 In3, const FString& In4, UObject* In5);
+	/** Benchmark pure node Lib032_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn002(int32& Out0, const FString& In1, const FString& In2, FName In3, int32 In4, FVector& Out5, float In6);
+	/** Benchmark pure node Lib032_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn003(const FTransform& In0);
+	/** Benchmark callable node Lib032_Fn004 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn004(int32 In0, const FTransform& In1, const FTransform& In2, const TArray< int32 >& In3, const FTransform& In4, const FTransform& In5, const FTransform& In6);
+	/** Benchmark callable node Lib032_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn005();
+	/** Benchmark pure node Lib032_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn006(float In0, int32 In1);
+	/** Benchmark pure node Lib032_Fn007 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn007(int32 In0, bool In1, FString& Out2, FName In3, FString& Out4, int32 In5, FString& Out6, int32& Out7);
+	/** Benchmark callable node Lib032_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn008(const FVector& In0, const FString& In1, const FString& In2, const FTransform& In3, UObject* In4, FName In5);
+	/** Benchmark callable node Lib032_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn009(FString& Out0, bool In1, const TArray< int32 >& In2, bool In3, const FString& In4, FName In5);
+	/** Benchmark callable node Lib032_Fn010 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn010(float In0, const FVector& In1, int32 In2);
+	/** Benchmark pure node Lib032_Fn011 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn011();
+	/** Benchmark callable node Lib032_Fn012 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn012(int32& Out0, const FTransform& In1, const FTransform& In2, FString& Out3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark callable node Lib032_Fn013 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn013(FString& Out0, UObject* In1, const FVector& In2, const FString& In3, int32& Out4, UObject* In5, float In6, FName In7);
+	/** Benchmark callable node Lib032_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static void Lib032_Fn014(int32 In0, int32 In1, int32& Out2, bool In3);
+	/** Benchmark pure node Lib032_Fn015 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn015(const FVector& In0, UObject* In1);
+	/** Benchmark pure node Lib032_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn016(const FTransform& In0, bool In1, int32& Out2, const FTransform& In3, UObject* In4, const FVector& In5);
+	/** Benchmark callable node Lib032_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn017(float In0, FVector& Out1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib032_Fn018 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn018(const FTransform& In0, const FTransform& In1);
+	/** Benchmark pure node Lib032_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn019(const FString& In0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, const FString& In4);
+	/** Benchmark pure node Lib032_Fn020 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn020(FName In0, float In1);
+	/** Benchmark callable node Lib032_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn021(FName In0, const FVector& In1, int32 In2, const FTransform& In3, const TArray< int32 >& In4, const FVector& In5, const FVector& In6, const FTransform& In7);
+	/** Benchmark callable node Lib032_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn022(float In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark pure node Lib032_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn023();
+	/** Benchmark callable node Lib032_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn024(const FTransform& In0);
+	/** Benchmark callable node Lib032_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn025(const FVector& In0, UObject* In1, const FString& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib032_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn026(const FVector& In0, UObject* In1);
+	/** Benchmark callable node Lib032_Fn027 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn027();
+	/** Benchmark callable node Lib032_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn028(FName In0, FVector& Out1, FName In2, UObject* In3, UObject* In4, UObject* In5);
+	/** Benchmark callable node Lib032_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn029(FName In0, float In1, FName In2, const FString& In3, FVector& Out4);
+	/** Benchmark callable node Lib032_Fn030 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static void Lib032_Fn030(FName In0);
+	/** Benchmark pure node Lib032_Fn031 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn031(float In0, int32 In1, FName In2, FString& Out3, const TArray< int32 >& In4, const TArray< int32 >& In5, int32& Out6, FName In7);
+	/** Benchmark callable node Lib032_Fn032 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn032(const FString& In0, FVector& Out1, const FVector& In2, bool In3, int32 In4);
+	/** Benchmark callable node Lib032_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn033(int32& Out0, FVector& Out1, FName In2, bool In3, const FString& In4, FString& Out5);
+	/** Benchmark callable node Lib032_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn034(int32 In0, const FVector& In1, const FString& In2, int32& Out3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark latent node Lib032_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib032_Fn035(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1, FName In2, int32& Out3);
+	/** Benchmark pure node Lib032_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn036(const FString& In0, int32 In1);
+	/** Benchmark pure node Lib032_Fn037 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn037(float In0, UObject* In1, float In2, int32& Out3, const FTransform& In4, FName In5);
+	/** Benchmark callable node Lib032_Fn038 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn038(bool In0, FString& Out1, const TArray< int32 >& In2, const FTransform& In3, int32& Out4);
+	/** Benchmark callable node Lib032_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn039(UObject* In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib032_Fn040 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn040(FString& Out0, const FTransform& In1, UObject* In2, UObject* In3, float In4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib032_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn041(int32& Out0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark callable node Lib032_Fn042 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static void Lib032_Fn042(bool In0, const FString& In1, const FString& In2, FName In3, FString& Out4, const FVector& In5);
+	/** Benchmark callable node Lib032_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn043(int32& Out0, FVector& Out1, UObject* In2, const TArray< int32 >& In3, const FVector& In4, const FString& In5, FString& Out6);
+	/** Benchmark callable node Lib032_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn044(FString& Out0, UObject* In1, FString& Out2);
+	/** Benchmark latent node Lib032_Fn045 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib032_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1, float In2, FName In3, FString& Out4);
+	/** Benchmark pure node Lib032_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn046(FString& Out0);
+	/** Benchmark callable node Lib032_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn047(UObject* In0, FVector& Out1);
+	/** Benchmark pure node Lib032_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn048();
+	/** Benchmark callable node Lib032_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn049(FName In0, FString& Out1, FString& Out2, FVector& Out3, const FVector& In4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib032_Fn050 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn050(FVector& Out0, bool In1, const FTransform& In2, UObject* In3, FName In4, float In5, float In6, float In7);
+	/** Benchmark callable node Lib032_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn051(UObject* In0);
+	/** Benchmark callable node Lib032_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn052(int32 In0, const FString& In1, UObject* In2, const TArray< int32 >& In3, const TArray< int32 >& In4, FString& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib032_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn053();
+	/** Benchmark pure node Lib032_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn054(int32 In0, const FVector& In1, FString& Out2, int32& Out3, int32& Out4, const FVector& In5);
+	/** Benchmark callable node Lib032_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn055(FString& Out0, const FTransform& In1, int32& Out2);
+	/** Benchmark callable node Lib032_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn056(FVector& Out0, const FTransform& In1, float In2);
+	/** Benchmark callable node Lib032_Fn057 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static void Lib032_Fn057(float In0, FString& Out1, int32 In2, FVector& Out3);
+	/** Benchmark callable node Lib032_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn058(const FVector& In0, const FTransform& In1);
+	/** Benchmark pure node Lib032_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn059(const FVector& In0, const FString& In1, const FTransform& In2, int32& Out3);
+	/** Benchmark callable node Lib032_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static void Lib032_Fn060(const FString& In0, const FTransform& In1);
+	/** Benchmark pure node Lib032_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn061(bool In0, int32 In1, UObject* In2, const FString& In3);
+	/** Benchmark pure node Lib032_Fn062 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn062();
+	/** Benchmark latent node Lib032_Fn063 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib032_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FTransform& In1, float In2, float In3, FName In4, FVector& Out5);
+	/** Benchmark pure node Lib032_Fn064 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn064(FString& Out0, int32 In1, UObject* In2, const FTransform& In3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark pure node Lib032_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn065(FString& Out0, UObject* In1);
+	/** Benchmark callable node Lib032_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn066(const TArray< int32 >& In0, const FString& In1, float In2, FString& Out3, const FString& In4);
+	/** Benchmark pure node Lib032_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn067(FName In0, int32& Out1, UObject* In2, int32& Out3, float In4);
+	/** Benchmark latent node Lib032_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib032_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FTransform& In1, FVector& Out2);
+	/** Benchmark callable node Lib032_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn069(const FString& In0, int32& Out1);
+	/** Benchmark latent node Lib032_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib032_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0);
+	/** Benchmark callable node Lib032_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn071(const FString& In0, float In1, FName In2, UObject* In3, FName In4, const FVector& In5);
+	/** Benchmark pure node Lib032_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn072(UObject* In0, FName In1);
+	/** Benchmark latent node Lib032_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib032_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, UObject* In1, FString& Out2, int32 In3);
+	/** Benchmark pure node Lib032_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn074(const FTransform& In0, UObject* In1);
+	/** Benchmark callable node Lib032_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn075(UObject* In0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3, const TArray< int32 >& In4, int32& Out5, int32 In6);
+	/** Benchmark callable node Lib032_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn076(int32 In0, int32 In1, float In2, int32 In3, const FString& In4, int32& Out5, FString& Out6);
+	/** Benchmark latent node Lib032_Fn077 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib032_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0);
+	/** Benchmark callable node Lib032_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn078(FString& Out0, int32& Out1, const FVector& In2, int32 In3);
+	/** Benchmark pure node Lib032_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn079(bool In0, FString& Out1);
+	/** Benchmark pure node Lib032_Fn080 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn080(UObject* In0, UObject* In1, const FString& In2, const TArray< int32 >& In3, const FTransform& In4, UObject* In5, UObject* In6);
+	/** Benchmark pure node Lib032_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn081(FVector& Out0, bool In1, FVector& Out2, const FTransform& In3, int32& Out4, FString& Out5);
+	/** Benchmark callable node Lib032_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FString Lib032_Fn082(const FTransform& In0, UObject* In1, FString& Out2, float In3, const FVector& In4, const FVector& In5, int32& Out6, const FTransform& In7);
+	/** Benchmark callable node Lib032_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn083();
+	/** Benchmark callable node Lib032_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn084(FVector& Out0, float In1, const FString& In2, FName In3, FName In4);
+	/** Benchmark callable node Lib032_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn085(UObject* In0, const FVector& In1, const TArray< int32 >& In2, const FTransform& In3);
+	/** Benchmark callable node Lib032_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn086(FString& Out0, const FTransform& In1, FName In2, UObject* In3, UObject* In4);
+	/** Benchmark callable node Lib032_Fn087 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn087(const FString& In0, FString& Out1, const FVector& In2, int32& Out3, const TArray< int32 >& In4, int32 In5, const FVector& In6, FVector& Out7);
+	/** Benchmark callable node Lib032_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn088(const FTransform& In0, FString& Out1, UObject* In2, FVector& Out3, FString& Out4, FVector& Out5);
+	/** Benchmark callable node Lib032_Fn089 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static void Lib032_Fn089(UObject* In0, const FString& In1, UObject* In2, float In3, int32& Out4, FName In5, int32& Out6);
+	/** Benchmark callable node Lib032_Fn090 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn090(int32 In0, int32& Out1, const TArray< int32 >& In2, FName In3, int32& Out4, int32& Out5, int32& Out6, int32 In7);
+	/** Benchmark pure node Lib032_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn091(UObject* In0, int32 In1, UObject* In2, int32& Out3);
+	/** Benchmark callable node Lib032_Fn092 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn092(float In0, FName In1, int32 In2, const TArray< int32 >& In3, const FVector& In4);
+	/** Benchmark pure node Lib032_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static float Lib032_Fn093(float In0, FString& Out1);
+	/** Benchmark callable node Lib032_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn094(FName In0, FVector& Out1, FName In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib032_Fn095 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn095(FVector& Out0, int32& Out1);
+	/** Benchmark callable node Lib032_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn096(int32& Out0, FName In1);
+	/** Benchmark pure node Lib032_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib032")
+	static bool Lib032_Fn097(UObject* In0, FVector& Out1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib032_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static int32 Lib032_Fn098(const FTransform& In0, float In1, bool In2, float In3, UObject* In4, FVector& Out5);
+	/** Benchmark callable node Lib032_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib032")
+	static FVector Lib032_Fn099(const FVector& In0, const FString& In1, int32 In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_033 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib033_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1);
+	/** Benchmark latent node Lib033_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FString& In1);
+	/** Benchmark pure node Lib033_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn002(float In0, FString& Out1, const FVector& In2, FVector& Out3, int32 In4, const FString& In5, UObject* In6);
+	/** Benchmark callable node Lib033_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static void Lib033_Fn003(const FVector& In0, FString& Out1, const FVector& In2);
+	/** Benchmark pure node Lib033_Fn004 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn004(UObject* In0, FName In1, UObject* In2, float In3, int32& Out4, const TArray< int32 >& In5, FVector& Out6);
+	/** Benchmark pure node Lib033_Fn005 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn005(int32& Out0, const FString& In1, int32 In2);
+	/** Benchmark callable node Lib033_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn006(int32 In0, FName In1);
+	/** Benchmark callable node Lib033_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn007(const FTransform& In0, const FVector& In1, const TArray< int32 >& In2, const FTransform& In3);
+	/** Benchmark callable node Lib033_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn008(FName In0, bool In1);
+	/** Benchmark callable node Lib033_Fn009 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn009(bool In0, FString& Out1, int32& Out2, const TArray< int32 >& In3, float In4);
+	/** Benchmark callable node Lib033_Fn010 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn010(const TArray< int32 >& In0, bool In1, const TArray< int32 >& In2, int32& Out3);
+	/** Benchmark callable node Lib033_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn011(const FTransform& In0, int32 In1, int32 In2, const FVector& In3, FString& Out4, UObject* In5, UObject* In6);
+	/** Benchmark latent node Lib033_Fn012 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib033_Fn013 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn013();
+	/** Benchmark callable node Lib033_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn014(UObject* In0, float In1, int32 In2, float In3, int32& Out4);
+	/** Benchmark callable node Lib033_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn015(FString& Out0, const FTransform& In1, UObject* In2, FString& Out3, bool In4, int32 In5, int32& Out6, int32& Out7);
+	/** Benchmark callable node Lib033_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static void Lib033_Fn016(UObject* In0, UObject* In1, const FString& In2);
+	/** Benchmark callable node Lib033_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn017(const FTransform& In0);
+	/** Benchmark pure node Lib033_Fn018 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn018(int32 In0, FVector& Out1, const FTransform& In2);
+	/** Benchmark latent node Lib033_Fn019 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn019(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0);
+	/** Benchmark pure node Lib033_Fn020 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn020(FVector& Out0, int32 In1);
+	/** Benchmark pure node Lib033_Fn021 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn021(UObject* In0);
+	/** Benchmark callable node Lib033_Fn022 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn022(int32& Out0, float In1, const FString& In2, FVector& Out3, int32 In4, const FTransform& In5);
+	/** Benchmark callable node Lib033_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn023(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib033_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn024(FVector& Out0, bool In1, int32& Out2, int32& Out3, FVector& Out4, float In5, FName In6);
+	/** Benchmark callable node Lib033_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn025(const FVector& In0, FString& Out1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib033_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn026();
+	/** Benchmark pure node Lib033_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn027(int32& Out0, float In1, const FVector& In2, FVector& Out3, const FVector& In4, const TArray< int32 >& In5, const FString& In6);
+	/** Benchmark callable node Lib033_Fn028 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static void Lib033_Fn028(int32& Out0, bool In1, const FString& In2, const FString& In3, int32& Out4);
+	/** Benchmark callable node Lib033_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn029(FName In0, const FVector& In1, const FVector& In2, const FTransform& In3, int32& Out4);
+	/** Benchmark pure node Lib033_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn030(const FString& In0, int32& Out1, const FString& In2, int32& Out3);
+	/** Benchmark callable node Lib033_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn031(int32 In0, const FTransform& In1);
+	/** Benchmark callable node Lib033_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn032(FVector& Out0, float In1, FString& Out2, FName In3);
+	/** Benchmark callable node Lib033_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn033(const TArray< int32 >& In0, bool In1, int32& Out2, const FVector& In3, const FTransform& In4, const FTransform& In5);
+	/** Benchmark callable node Lib033_Fn034 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn034();
+	/** Benchmark pure node Lib033_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn035(int32& Out0, const FString& In1, FVector& Out2, const TArray< int32 >& In3, const FTransform& In4, const FVector& In5);
+	/** Benchmark callable node Lib033_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn036(UObject* In0, int32 In1, FName In2, const FString& In3, float In4, int32& Out5);
+	/** Benchmark callable node Lib033_Fn037 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn037(int32& Out0, int32& Out1, bool In2, const TArray< int32 >& In3, FVector& Out4, const FString& In5, const FTransform& In6, UObject* In7);
+	/** Benchmark callable node Lib033_Fn038 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn038(int32 In0, int32 In1, FName In2);
+	/** Benchmark callable node Lib033_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn039(FName In0, int32& Out1, bool In2, const FVector& In3, FVector& Out4, const FVector& In5, const FTransform& In6);
+	/** Benchmark callable node Lib033_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn040(const FString& In0, FString& Out1, float In2, const TArray< int32 >& In3, const FVector& In4, FString& Out5, bool In6, FVector& Out7);
+	/** Benchmark callable node Lib033_Fn041 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn041(bool In0, const FTransform& In1);
+	/** Benchmark callable node Lib033_Fn042 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn042(int32 In0, const FString& In1, float In2, const TArray< int32 >& In3, FVector& Out4, int32& Out5, const FTransform& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib033_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn043(int32 In0, bool In1, FName In2, FString& Out3, FVector& Out4);
+	/** Benchmark latent node Lib033_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0);
+	/** Benchmark pure node Lib033_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn045(FString& Out0, bool In1, FString& Out2, const FVector& In3, FString& Out4, float In5, FName In6, FVector& Out7);
+	/** Benchmark callable node Lib033_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static void Lib033_Fn046(const FVector& In0);
+	/** Benchmark callable node Lib033_Fn047 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn047(const FVector& In0, float In1, int32& Out2, const FVector& In3);
+	/** Benchmark callable node Lib033_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static void Lib033_Fn048(const FTransform& In0, const TArray< int32 >& In1, float In2, const FTransform& In3, const FString& In4, const FVector& In5, int32& Out6, FVector& Out7);
+	/** Benchmark callable node Lib033_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn049(const FString& In0, FVector& Out1, int32 In2, int32 In3, const FString& In4, const FVector& In5);
+	/** Benchmark callable node Lib033_Fn050 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn050(int32 In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark callable node Lib033_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn051(const FTransform& In0, float In1, FName In2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib033_Fn052 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn052(FVector& Out0, int32& Out1, FString& Out2, const TArray< int32 >& In3, const FVector& In4);
+	/** Benchmark callable node Lib033_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static void Lib033_Fn053(const TArray< int32 >& In0, FName In1, FString& Out2);
+	/** Benchmark callable node Lib033_Fn054 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static void Lib033_Fn054();
+	/** Benchmark pure node Lib033_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn055(int32 In0, const TArray< int32 >& In1, const FTransform& In2);
+	/** Benchmark pure node Lib033_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn056(float In0, bool In1, FVector& Out2);
+	/** Benchmark latent node Lib033_Fn057 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32 In1, int32& Out2, const FString& In3, const TArray< int32 >& In4, UObject* In5, const FString& In6, int32& Out7);
+	/** Benchmark pure node Lib033_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn058(const FVector& In0, bool In1, UObject* In2, const TArray< int32 >& In3, const TArray< int32 >& In4, const FString& In5);
+	/** Benchmark callable node Lib033_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn059(int32& Out0, const FVector& In1, FName In2, int32 In3, bool In4, const FVector& In5);
+	/** Benchmark callable node Lib033_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn060();
+	/** Benchmark pure node Lib033_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn061(float In0);
+	/** Benchmark latent node Lib033_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, int32& Out2, bool In3);
+	/** Benchmark pure node Lib033_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn063(const FTransform& In0);
+	/** Benchmark callable node Lib033_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn064();
+	/** Benchmark callable node Lib033_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn065(FString& Out0, FName In1, FString& Out2, int32& Out3, int32& Out4, int32& Out5);
+	/** Benchmark pure node Lib033_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn066(float In0, int32 In1, const FVector& In2, const FVector& In3, float In4, FName In5);
+	/** Benchmark callable node Lib033_Fn067 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn067(FVector& Out0, const TArray< int32 >& In1, int32& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib033_Fn068 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn068(const FTransform& In0, UObject* In1);
+	/** Benchmark latent node Lib033_Fn069 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib033_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0);
+	/** Benchmark pure node Lib033_Fn070 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn070(bool In0, const FVector& In1);
+	/** Benchmark pure node Lib033_Fn071 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn071(int32& Out0, FName In1, FName In2);
+	/** Benchmark callable node Lib033_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn072(bool In0, UObject* In1, int32 In2, FVector& Out3, int32 In4);
+	/** Benchmark pure node Lib033_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn073(int32& Out0, FString& Out1, FName In2, FVector& Out3, const FVector& In4);
+	/** Benchmark callable node Lib033_Fn074 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn074(bool In0, float In1, bool In2);
+	/** Benchmark callable node Lib033_Fn075 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn075(const FString& In0, UObject* In1, const FVector& In2);
+	/** Benchmark callable node Lib033_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn076(FVector& Out0, FName In1, FName In2, int32& Out3, const FVector& In4);
+	/** Benchmark pure node Lib033_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn077(int32 In0, int32 In1, FVector& Out2, FVector& Out3, bool In4, int32& Out5, const FString& In6);
+	/** Benchmark pure node Lib033_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn078(FString& Out0, float In1, const FString& In2, bool In3, FName In4, float In5, float In6);
+	/** Benchmark callable node Lib033_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn079(const FVector& In0, UObject* In1);
+	/** Benchmark pure node Lib033_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn080(int32 In0, UObject* In1, int32 In2, FVector& Out3, bool In4);
+	/** Benchmark callable node Lib033_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn081(const TArray< int32 >& In0, const FString& In1, FName In2, bool In3, int32 In4, const FString& In5, int32 In6);
+	/** Benchmark callable node Lib033_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn082(const FTransform& In0, FVector& Out1, const FString& In2);
+	/** Benchmark callable node Lib033_Fn083 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn083(int32 In0, int32& Out1, float In2);
+	/** Benchmark pure node Lib033_Fn084 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn084(const FString& In0);
+	/** Benchmark pure node Lib033_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn085(FName In0, const FVector& In1, const FVector& In2);
+	/** Benchmark pure node Lib033_Fn086 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn086(FVector& Out0, FVector& Out1, const FString& In2, FVector& Out3, FVector& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, FVector& Out7);
+	/** Benchmark callable node Lib033_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static int32 Lib033_Fn087(UObject* In0);
+	/** Benchmark pure node Lib033_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static float Lib033_Fn088();
+	/** Benchmark callable node Lib033_Fn089 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn089(const FVector& In0, const FTransform& In1, FName In2, int32& Out3, float In4);
+	/** Benchmark callable node Lib033_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn090(int32 In0, int32& Out1, int32 In2, float In3);
+	/** Benchmark pure node Lib033_Fn091 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn091(const FTransform& In0);
+	/** Benchmark callable node Lib033_Fn092 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn092(int32 In0, const TArray< int32 >& In1, UObject* In2);
+	/** Benchmark callable node Lib033_Fn093 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static bool Lib033_Fn093(const FTransform& In0, FString& Out1, float In2, float In3, UObject* In4);
+	/** Benchmark callable node Lib033_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn094(FVector& Out0, const FTransform& In1, FString& Out2);
+	/** Benchmark callable node Lib033_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn095(FString& Out0, int32& Out1, bool In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib033_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn096(const FVector& In0, int32 In1);
+	/** Benchmark callable node Lib033_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn097(bool In0, const FVector& In1, bool In2, FName In3, const FTransform& In4, const FString& In5, FVector& Out6);
+	/** Benchmark callable node Lib033_Fn098 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FVector Lib033_Fn098(FName In0, const FVector& In1, FVector& Out2, float In3);
+	/** Benchmark callable node Lib033_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib033")
+	static FString Lib033_Fn099(FVector& Out0, int32 In1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_034 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib034_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn000(const FVector& In0, int32 In1, const FVector& In2, FVector& Out3, const FVector& In4, int32 In5, FName In6);
+	/** Benchmark callable node Lib034_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn001(FName In0, FVector& Out1);
+	/** Benchmark callable node Lib034_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn002(FString& Out0, FString& Out1, int32& Out2);
+	/** Benchmark pure node Lib034_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn003(FName In0, const TArray< int32 >& In1, const FVector& In2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib034_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn004();
+	/** Benchmark callable node Lib034_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn005(bool In0);
+	/** Benchmark latent node Lib034_Fn006 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FVector& In1, int32& Out2, const FTransform& In3, int32 In4, UObject* In5, const FTransform& In6, FVector& Out7);
+	/** Benchmark callable node Lib034_Fn007 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn007();
+	/** Benchmark pure node Lib034_Fn008 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn008(const FTransform& In0, FString& Out1, const FTransform& In2);
+	/** Benchmark pure node Lib034_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn009(float In0, int32& Out1, FString& Out2, const FTransform& In3, const FVector& In4, float In5);
+	/** Benchmark pure node Lib034_Fn010 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn010(FVector& Out0, const FVector& In1, FName In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib034_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn011(bool In0, const FVector& In1, bool In2, int32& Out3, UObject* In4, FName In5, FName In6, FVector& Out7);
+	/** Benchmark pure node Lib034_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn012(const FString& In0, float In1, const FString& In2);
+	/** Benchmark callable node Lib034_Fn013 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn013(bool In0);
+	/** Benchmark callable node Lib034_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn014(UObject* In0, const FString& In1, const FTransform& In2, FString& Out3);
+	/** Benchmark pure node Lib034_Fn015 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn015();
+	/** Benchmark callable node Lib034_Fn016 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn016(int32 In0);
+	/** Benchmark pure node Lib034_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn017(const TArray< int32 >& In0, FName In1, FString& Out2, int32 In3, const FString& In4, FVector& Out5);
+	/** Benchmark latent node Lib034_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, bool In1, int32 In2);
+	/** Benchmark callable node Lib034_Fn019 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn019(FName In0, FVector& Out1, FString& Out2, const FVector& In3, UObject* In4, const FVector& In5, int32& Out6);
+	/** Benchmark latent node Lib034_Fn020 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, float In1, float In2, FVector& Out3, int32 In4, UObject* In5, const FVector& In6);
+	/** Benchmark pure node Lib034_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn021(UObject* In0, FString& Out1, FString& Out2);
+	/** Benchmark callable node Lib034_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn022(const FTransform& In0, int32& Out1, bool In2, const FString& In3);
+	/** Benchmark latent node Lib034_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn023(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib034_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn024(FName In0, float In1, FName In2, FString& Out3, const FTransform& In4, bool In5);
+	/** Benchmark callable node Lib034_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn025(const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib034_Fn026 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn026(FString& Out0, float In1, int32& Out2, UObject* In3, float In4, const FTransform& In5, bool In6);
+	/** Benchmark callable node Lib034_Fn027 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn027(int32& Out0, int32& Out1, UObject* In2, FName In3, int32 In4);
+	/** Benchmark pure node Lib034_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn028(int32& Out0);
+	/** Benchmark pure node Lib034_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn029(const FTransform& In0, int32& Out1, bool In2, const FTransform& In3, UObject* In4, const TArray< int32 >& In5, const TArray< int32 >& In6, const FTransform& In7);
+	/** Benchmark latent node Lib034_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark pure node Lib034_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn031(const FVector& In0, FName In1, const FVector& In2, const FString& In3, FVector& Out4, const FTransform& In5, int32& Out6);
+	/** Benchmark pure node Lib034_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn032(UObject* In0, FVector& Out1, FString& Out2, FString& Out3);
+	/** Benchmark callable node Lib034_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn033(const TArray< int32 >& In0, float In1, FVector& Out2, int32 In3, const FString& In4, const FString& In5);
+	/** Benchmark callable node Lib034_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn034(int32 In0, FString& Out1, FVector& Out2, const FVector& In3, const FTransform& In4, bool In5, FVector& Out6);
+	/** Benchmark callable node Lib034_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn035(bool In0);
+	/** Benchmark latent node Lib034_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FVector& In1, int32 In2, UObject* In3, float In4, int32& Out5);
+	/** Benchmark callable node Lib034_Fn037 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn037(bool In0, const TArray< int32 >& In1, float In2, bool In3, int32 In4, FString& Out5);
+	/** Benchmark callable node Lib034_Fn038 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn038(UObject* In0, FString& Out1, const FTransform& In2, int32 In3, int32 In4, const TArray< int32 >& In5, float In6, FVector& Out7);
+	/** Benchmark pure node Lib034_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn039(const FString& In0, FVector& Out1, const FString& In2, const FString& In3, UObject* In4, int32 In5, const FVector& In6, FVector& Out7);
+	/** Benchmark callable node Lib034_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn040(int32 In0, FName In1, UObject* In2, int32 In3, const FTransform& In4);
+	/** Benchmark callable node Lib034_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn041(FString& Out0, FVector& Out1, int32& Out2);
+	/** Benchmark pure node Lib034_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn042(const TArray< int32 >& In0, const FVector& In1, FVector& Out2, FVector& Out3, const FString& In4, int32& Out5, FVector& Out6);
+	/** Benchmark latent node Lib034_Fn043 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, const FString& In2, UObject* In3, const FString& In4, const FString& In5, const TArray< int32 >& In6, UObject* In7);
+	/** Benchmark callable node Lib034_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn044(bool In0, int32 In1, UObject* In2, FVector& Out3, int32& Out4, int32& Out5);
+	/** Benchmark callable node Lib034_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn045(UObject* In0);
+	/** Benchmark latent node Lib034_Fn046 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib034_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const TArray< int32 >& In1, FVector& Out2, FVector& Out3, const FTransform& In4, FString& Out5, float In6, const FString& In7);
+	/** Benchmark callable node Lib034_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn047(float In0, const FTransform& In1);
+	/** Benchmark pure node Lib034_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn048(int32 In0, int32 In1, const FVector& In2, const FString& In3);
+	/** Benchmark callable node Lib034_Fn049 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn049(const FTransform& In0);
+	/** Benchmark callable node Lib034_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn050(UObject* In0);
+	/** Benchmark pure node Lib034_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn051(float In0, FVector& Out1, int32& Out2, bool In3, const FTransform& In4);
+	/** Benchmark pure node Lib034_Fn052 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn052(FVector& Out0, FName In1, UObject* In2, FString& Out3, FName In4, const TArray< int32 >& In5, const FString& In6, FName In7);
+	/** Benchmark pure node Lib034_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn053();
+	/** Benchmark pure node Lib034_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn054(const FTransform& In0, const FTransform& In1, UObject* In2, UObject* In3, const FVector& In4, const FString& In5, const TArray< int32 >& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib034_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn055(int32 In0, int32& Out1, UObject* In2, int32 In3);
+	/** Benchmark callable node Lib034_Fn056 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn056(const FVector& In0, FString& Out1, FString& Out2, const FString& In3, FVector& Out4, const TArray< int32 >& In5, FName In6);
+	/** Benchmark callable node Lib034_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn057(FString& Out0);
+	/** Benchmark callable node Lib034_Fn058 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn058();
+	/** Benchmark callable node Lib034_Fn059 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn059(bool In0, FVector& Out1);
+	/** Benchmark callable node Lib034_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn060(int32& Out0, UObject* In1, int32& Out2, FName In3, UObject* In4, bool In5, int32& Out6, FString& Out7);
+	/** Benchmark callable node Lib034_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn061(FVector& Out0, FString& Out1, const FVector& In2, int32 In3, bool In4, const FVector& In5, const FString& In6);
+	/** Benchmark callable node Lib034_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn062(int32& Out0, float In1, FString& Out2, FVector& Out3, FName In4, FVector& Out5, bool In6);
+	/** Benchmark callable node Lib034_Fn063 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn063(int32& Out0, FString& Out1, const FTransform& In2, FName In3, FName In4, FName In5);
+	/** Benchmark pure node Lib034_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn064();
+	/** Benchmark callable node Lib034_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn065(FString& Out0, int32& Out1, const TArray< int32 >& In2, FName In3, FVector& Out4, FVector& Out5);
+	/** Benchmark callable node Lib034_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn066(int32 In0, FString& Out1, const FTransform& In2, const FVector& In3, const FTransform& In4, float In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib034_Fn067 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn067(const FString& In0, const FTransform& In1, const FTransform& In2, FVector& Out3);
+	/** Benchmark callable node Lib034_Fn068 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn068(UObject* In0, const FVector& In1, const FVector& In2, float In3, int32 In4, int32 In5, UObject* In6, const FTransform& In7);
+	/** Benchmark callable node Lib034_Fn069 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn069(FVector& Out0, float In1, const FString& In2, const FString& In3, FVector& Out4, const FTransform& In5, int32& Out6, const FVector& In7);
+	/** Benchmark callable node Lib034_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn070(const FVector& In0, const FTransform& In1, FString& Out2, const FVector& In3, FVector& Out4, bool In5, FVector& Out6);
+	/** Benchmark callable node Lib034_Fn071 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn071(bool In0, const FVector& In1, FString& Out2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib034_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn072(FString& Out0, FVector& Out1, UObject* In2, UObject* In3, const FString& In4);
+	/** Benchmark callable node Lib034_Fn073 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn073(int32 In0, const FTransform& In1);
+	/** Benchmark callable node Lib034_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn074(float In0, const TArray< int32 >& In1, UObject* In2, int32 In3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib034_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn075(int32 In0, const TArray< int32 >& In1, const FVector& In2, int32& Out3);
+	/** Benchmark callable node Lib034_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn076(FVector& Out0, int32 In1, FVector& Out2, const FVector& In3);
+	/** Benchmark callable node Lib034_Fn077 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn077(FVector& Out0, FString& Out1, int32 In2, int32& Out3, FName In4, const FString& In5, int32 In6, const FVector& In7);
+	/** Benchmark callable node Lib034_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn078(const FTransform& In0, FVector& Out1, const FString& In2, FName In3, int32& Out4, const TArray< int32 >& In5, bool In6);
+	/** Benchmark callable node Lib034_Fn079 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn079(const FVector& In0, FName In1, const TArray< int32 >& In2, const FVector& In3, const TArray< int32 >& In4, FName In5, float In6);
+	/** Benchmark callable node Lib034_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn080(int32& Out0, FVector& Out1, FString& Out2, FString& Out3);
+	/** Benchmark callable node Lib034_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn081(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FTransform& In3, const FVector& In4, UObject* In5);
+	/** Benchmark callable node Lib034_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn082(int32& Out0, FName In1, const FString& In2);
+	/** Benchmark callable node Lib034_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn083(const TArray< int32 >& In0, const FTransform& In1);
+	/** Benchmark pure node Lib034_Fn084 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn084();
+	/** Benchmark pure node Lib034_Fn085 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn085(const FString& In0, bool In1, FString& Out2, const TArray< int32 >& In3, FVector& Out4);
+	/** Benchmark callable node Lib034_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn086(float In0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3);
+	/** Benchmark pure node Lib034_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn087();
+	/** Benchmark callable node Lib034_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn088(int32 In0, int32 In1, float In2, FString& Out3, FName In4, const FVector& In5, FString& Out6, float In7);
+	/** Benchmark callable node Lib034_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn089(const TArray< int32 >& In0, const TArray< int32 >& In1, FVector& Out2, const FString& In3);
+	/** Benchmark callable node Lib034_Fn090 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn090(bool In0, bool In1, UObject* In2, const FVector& In3, float In4);
+	/** Benchmark callable node Lib034_Fn091 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static void Lib034_Fn091(FString& Out0, float In1, UObject* In2);
+	/** Benchmark pure node Lib034_Fn092 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static FString Lib034_Fn092(float In0, bool In1, const FTransform& In2, const FVector& In3, bool In4);
+	/** Benchmark callable node Lib034_Fn093 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn093(FString& Out0, FString& Out1, FVector& Out2, const FTransform& In3, const FString& In4, float In5, UObject* In6);
+	/** Benchmark callable node Lib034_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static bool Lib034_Fn094(const FTransform& In0);
+	/** Benchmark pure node Lib034_Fn095 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn095(const TArray< int32 >& In0, float In1, const FString& In2, FName In3, const FString& In4, const FVector& In5, int32& Out6);
+	/** Benchmark pure node Lib034_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn096(FVector& Out0);
+	/** Benchmark callable node Lib034_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static FVector Lib034_Fn097(FName In0, bool In1, const TArray< int32 >& In2, float In3, UObject* In4, FVector& Out5, FString& Out6);
+	/** Benchmark callable node Lib034_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static float Lib034_Fn098(FVector& Out0, FString& Out1);
+	/** Benchmark callable node Lib034_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib034")
+	static int32 Lib034_Fn099(float In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_035 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib035_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn000(float In0, FVector& Out1, FName In2, int32& Out3);
+	/** Benchmark callable node Lib035_Fn001 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn001(FVector& Out0);
+	/** Benchmark callable node Lib035_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn002(const TArray< int32 >& In0, const FTransform& In1, int32& Out2);
+	/** Benchmark callable node Lib035_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn003(FName In0, const TArray< int32 >& In1, const FTransform& In2, FVector& Out3, int32 In4, UObject* In5, FName In6);
+	/** Benchmark pure node Lib035_Fn004 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn004(bool In0, UObject* In1, float In2, bool In3, int32& Out4, int32& Out5, bool In6);
+	/** Benchmark pure node Lib035_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn005(FString& Out0, int32& Out1, bool In2, bool In3, int32 In4, const FString& In5, FName In6, FString& Out7);
+	/** Benchmark callable node Lib035_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static void Lib035_Fn006(int32 In0, int32 In1, int32 In2, bool In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib035_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn007(float In0, FName In1, const FString& In2, const FString& In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib035_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn008(FString& Out0, const TArray< int32 >& In1);
+	/** Benchmark latent node Lib035_Fn009 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FString& In1, const FTransform& In2);
+	/** Benchmark pure node Lib035_Fn010 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn010(const FVector& In0, bool In1);
+	/** Benchmark pure node Lib035_Fn011 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn011(int32 In0, const TArray< int32 >& In1, const FTransform& In2, const FString& In3, float In4);
+	/** Benchmark pure node Lib035_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn012(int32& Out0, FName In1, float In2, FVector& Out3, FName In4, FVector& Out5, int32& Out6);
+	/** Benchmark callable node Lib035_Fn013 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn013(FString& Out0, const TArray< int32 >& In1, bool In2, float In3);
+	/** Benchmark callable node Lib035_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn014(UObject* In0, const FVector& In1, float In2, FString& Out3);
+	/** Benchmark pure node Lib035_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn015(FName In0);
+	/** Benchmark callable node Lib035_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static void Lib035_Fn016(const FVector& In0, UObject* In1, bool In2, UObject* In3, FString& Out4);
+	/** Benchmark callable node Lib035_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn017(const TArray< int32 >& In0, float In1, const FVector& In2, bool In3, FString& Out4, int32 In5, FString& Out6, FString& Out7);
+	/** Benchmark callable node Lib035_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn018(FString& Out0, const FVector& In1, FVector& Out2, const TArray< int32 >& In3, const FVector& In4);
+	/** Benchmark pure node Lib035_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn019(FString& Out0, const FString& In1, const FString& In2, const FVector& In3, int32& Out4);
+	/** Benchmark pure node Lib035_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn020(UObject* In0);
+	/** Benchmark callable node Lib035_Fn021 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn021();
+	/** Benchmark pure node Lib035_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn022(const TArray< int32 >& In0, int32& Out1, FVector& Out2, FString& Out3, FVector& Out4, float In5, UObject* In6);
+	/** Benchmark pure node Lib035_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn023(const FTransform& In0, int32 In1, UObject* In2, UObject* In3, const FVector& In4);
+	/** Benchmark callable node Lib035_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn024(FString& Out0, const FTransform& In1, const FVector& In2, int32 In3, FName In4, int32& Out5, const FTransform& In6);
+	/** Benchmark pure node Lib035_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn025(int32& Out0, const TArray< int32 >& In1);
+	/** Benchmark latent node Lib035_Fn026 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, UObject* In2, FName In3, const FString& In4, bool In5, int32& Out6);
+	/** Benchmark callable node Lib035_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn027(UObject* In0, float In1, float In2);
+	/** Benchmark callable node Lib035_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn028(FString& Out0, float In1);
+	/** Benchmark pure node Lib035_Fn029 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn029(const FVector& In0, float In1);
+	/** Benchmark pure node Lib035_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn030(int32& Out0, const FVector& In1, UObject* In2, FName In3);
+	/** Benchmark callable node Lib035_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn031(bool In0, int32 In1);
+	/** Benchmark callable node Lib035_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn032(const FTransform& In0, int32& Out1, FName In2, const FTransform& In3);
+	/** Benchmark callable node Lib035_Fn033 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn033(const FTransform& In0, int32& Out1, const FTransform& In2, FString& Out3, bool In4, const FTransform& In5, const FString& In6);
+	/** Benchmark pure node Lib035_Fn034 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn034(FName In0, const FString& In1, FName In2, float In3, FString& Out4);
+	/** Benchmark callable node Lib035_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn035(const FString& In0, const FVector& In1, const FString& In2, FVector& Out3, const FString& In4, FVector& Out5);
+	/** Benchmark latent node Lib035_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib035_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn037(int32 In0, const FTransform& In1, bool In2, FVector& Out3, const TArray< int32 >& In4, bool In5, bool In6);
+	/** Benchmark callable node Lib035_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn038(FVector& Out0, FName In1, const FVector& In2, int32& Out3, float In4, const FString& In5);
+	/** Benchmark pure node Lib035_Fn039 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn039(const FVector& In0, FString& Out1, FString& Out2);
+	/** Benchmark pure node Lib035_Fn040 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn040();
+	/** Benchmark callable node Lib035_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn041(const FTransform& In0, const FString& In1, FVector& Out2);
+	/** Benchmark latent node Lib035_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, UObject* In2, const FString& In3, FVector& Out4);
+	/** Benchmark callable node Lib035_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn043(FVector& Out0, float In1, FVector& Out2);
+	/** Benchmark latent node Lib035_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0);
+	/** Benchmark callable node Lib035_Fn045 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn045();
+	/** Benchmark callable node Lib035_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static void Lib035_Fn046(const TArray< int32 >& In0, const FTransform& In1, bool In2, const FString& In3, int32& Out4, FString& Out5, const TArray< int32 >& In6, UObject* In7);
+	/** Benchmark callable node Lib035_Fn047 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn047(bool In0, int32& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib035_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn048(FVector& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, FString& Out3, int32& Out4, int32& Out5, float In6, FName In7);
+	/** Benchmark latent node Lib035_Fn049 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, int32 In2, FVector& Out3, const TArray< int32 >& In4, const FVector& In5, int32& Out6, const FTransform& In7);
+	/** Benchmark pure node Lib035_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn050(int32& Out0);
+	/** Benchmark callable node Lib035_Fn051 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn051(const FVector& In0, const FTransform& In1, const FString& In2, UObject* In3, const TArray< int32 >& In4, bool In5, const FVector& In6);
+	/** Benchmark callable node Lib035_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn052(const FString& In0, const FString& In1, int32& Out2, FName In3, FVector& Out4, const FVector& In5, FString& Out6);
+	/** Benchmark pure node Lib035_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn053(FName In0, const FVector& In1, float In2, FString& Out3, float In4, UObject* In5);
+	/** Benchmark callable node Lib035_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn054(const FString& In0, const FVector& In1);
+	/** Benchmark callable node Lib035_Fn055 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static void Lib035_Fn055(const TArray< int32 >& In0, FVector& Out1, bool In2, const FTransform& In3, const TArray< int32 >& In4, const FVector& In5, int32 In6);
+	/** Benchmark pure node Lib035_Fn056 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn056(FName In0, UObject* In1, const FString& In2, int32& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib035_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn057(const FTransform& In0, UObject* In1, FVector& Out2, int32& Out3, const FTransform& In4, FVector& Out5);
+	/** Benchmark callable node Lib035_Fn058 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn058(const FTransform& In0, FName In1, const FVector& In2, const TArray< int32 >& In3, const FString& In4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib035_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn059(float In0, const FString& In1, const FVector& In2, const FVector& In3, UObject* In4, const FVector& In5, FVector& Out6, int32 In7);
+	/** Benchmark callable node Lib035_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn060(const FString& In0, const FVector& In1, bool In2, int32& Out3, FName In4, const FString& In5, bool In6, UObject* In7);
+	/** Benchmark callable node Lib035_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static void Lib035_Fn061();
+	/** Benchmark pure node Lib035_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn062(const FTransform& In0, FName In1, const FString& In2, const TArray< int32 >& In3);
+	/** Benchmark latent node Lib035_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib035_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn064(const FString& In0, const FVector& In1, const FTransform& In2, UObject* In3, UObject* In4, const FTransform& In5, FName In6, FString& Out7);
+	/** Benchmark callable node Lib035_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn065();
+	/** Benchmark latent node Lib035_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, int32 In1, bool In2);
+	/** Benchmark latent node Lib035_Fn067 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, UObject* In1, UObject* In2, int32 In3, FVector& Out4, FVector& Out5, bool In6);
+	/** Benchmark callable node Lib035_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn068(FVector& Out0, const FVector& In1, const FTransform& In2, bool In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib035_Fn069 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn069();
+	/** Benchmark latent node Lib035_Fn070 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32& Out1, const FString& In2, float In3, bool In4, const TArray< int32 >& In5, float In6, int32& Out7);
+	/** Benchmark callable node Lib035_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn071();
+	/** Benchmark pure node Lib035_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn072(int32 In0, float In1, const TArray< int32 >& In2, float In3, const FVector& In4, FVector& Out5);
+	/** Benchmark latent node Lib035_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0);
+	/** Benchmark latent node Lib035_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, const FTransform& In2, const FTransform& In3, const FTransform& In4, int32& Out5);
+	/** Benchmark callable node Lib035_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn075(FString& Out0, int32 In1, int32& Out2, FName In3, FName In4, int32 In5, FName In6, int32 In7);
+	/** Benchmark callable node Lib035_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn076(FVector& Out0, int32 In1, const FTransform& In2, const FTransform& In3);
+	/** Benchmark pure node Lib035_Fn077 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn077(const TArray< int32 >& In0, const FVector& In1, FName In2, bool In3);
+	/** Benchmark callable node Lib035_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn078();
+	/** Benchmark callable node Lib035_Fn079 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn079(FString& Out0, int32& Out1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib035_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn080(FName In0, bool In1, UObject* In2, FString& Out3, float In4);
+	/** Benchmark callable node Lib035_Fn081 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn081(const FString& In0, bool In1, const FVector& In2, FName In3, const FVector& In4);
+	/** Benchmark callable node Lib035_Fn082 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn082(UObject* In0, UObject* In1, float In2, UObject* In3, FString& Out4, float In5);
+	/** Benchmark latent node Lib035_Fn083 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib035_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, float In1, const FString& In2, FVector& Out3);
+	/** Benchmark callable node Lib035_Fn084 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static void Lib035_Fn084();
+	/** Benchmark callable node Lib035_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn085();
+	/** Benchmark callable node Lib035_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn086(float In0, FName In1, FString& Out2, bool In3, const FTransform& In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark pure node Lib035_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn087(const TArray< int32 >& In0, FVector& Out1, FVector& Out2, const FVector& In3, bool In4, const FTransform& In5, const FString& In6);
+	/** Benchmark pure node Lib035_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn088(UObject* In0, int32& Out1, UObject* In2, const FTransform& In3, FVector& Out4, const FString& In5, int32& Out6);
+	/** Benchmark callable node Lib035_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn089(const TArray< int32 >& In0, FName In1, int32& Out2);
+	/** Benchmark callable node Lib035_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn090(const FString& In0);
+	/** Benchmark callable node Lib035_Fn091 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn091(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib035_Fn092 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn092(const FString& In0, const FString& In1, int32 In2, int32& Out3, const FString& In4, bool In5);
+	/** Benchmark callable node Lib035_Fn093 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn093(FVector& Out0);
+	/** Benchmark callable node Lib035_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static int32 Lib035_Fn094(UObject* In0, float In1, int32& Out2, UObject* In3);
+	/** Benchmark callable node Lib035_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static void Lib035_Fn095(FName In0, const FString& In1, float In2, UObject* In3);
+	/** Benchmark callable node Lib035_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static bool Lib035_Fn096(const FString& In0, FName In1);
+	/** Benchmark pure node Lib035_Fn097 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FVector Lib035_Fn097(int32 In0);
+	/** Benchmark callable node Lib035_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib035")
+	static float Lib035_Fn098();
+	/** Benchmark pure node Lib035_Fn099 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib035")
+	static FString Lib035_Fn099(const FVector& In0, const FTransform& In1, int32& Out2, UObject* In3, float In4, const FTransform& In5);
+};
+
+
+UCLASS()
+class UKDGBenchLib_036 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib036_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn000(const FTransform& In0, const FString& In1, FVector& Out2, FVector& Out3);
+	/** Benchmark pure node Lib036_Fn001 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn001(const FTransform& In0);
+	/** Benchmark latent node Lib036_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, const FTransform& In2, float In3);
+	/** Benchmark callable node Lib036_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn003(const FString& In0, const FVector& In1, bool In2, int32& Out3, bool In4);
+	/** Benchmark callable node Lib036_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn004(FName In0, const FVector& In1, int32& Out2, bool In3, const FVector& In4, const FString& In5, UObject* In6, UObject* In7);
+	/** Benchmark callable node Lib036_Fn005 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn005(FVector& Out0, const FVector& In1);
+	/** Benchmark pure node Lib036_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn006(int32 In0, bool In1);
+	/** Benchmark callable node Lib036_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn007(bool In0, const FString& In1, const FVector& In2, UObject* In3, bool In4, FString& Out5);
+	/** Benchmark callable node Lib036_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn008();
+	/** Benchmark pure node Lib036_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn009(float In0);
+	/** Benchmark callable node Lib036_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn010(const FVector& In0, FName In1, int32 In2, const FTransform& In3, UObject* In4);
+	/** Benchmark latent node Lib036_Fn011 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FString& In1, FName In2, const FString& In3, int32& Out4, const FString& In5, int32 In6, const FString& In7);
+	/** Benchmark callable node Lib036_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn012(float In0, FName In1, const FString& In2, FName In3, FVector& Out4, bool In5, int32& Out6);
+	/** Benchmark pure node Lib036_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn013(UObject* In0, FString& Out1);
+	/** Benchmark callable node Lib036_Fn014 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn014(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib036_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn015(int32 In0, int32 In1, const FVector& In2, const FString& In3, int32 In4, int32& Out5, int32& Out6);
+	/** Benchmark callable node Lib036_Fn016 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn016(int32& Out0, float In1);
+	/** Benchmark callable node Lib036_Fn017 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn017(int32& Out0, UObject* In1);
+	/** Benchmark callable node Lib036_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn018(int32 In0, FName In1, const FString& In2, const FVector& In3, const TArray< int32 >& In4, FVector& Out5, UObject* In6);
+	/** Benchmark callable node Lib036_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn019(UObject* In0, float In1, FName In2, FString& Out3, const TArray< int32 >& In4, float In5);
+	/** Benchmark callable node Lib036_Fn020 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn020(UObject* In0, FVector& Out1, FString& Out2, bool In3);
+	/** Benchmark callable node Lib036_Fn021 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn021(FName In0);
+	/** Benchmark callable node Lib036_Fn022 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn022(FString& Out0);
+	/** Benchmark pure node Lib036_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn023(bool In0);
+	/** Benchmark callable node Lib036_Fn024 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn024(const TArray< int32 >& In0, FVector& Out1);
+	/** Benchmark callable node Lib036_Fn025 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn025(const FVector& In0, const FString& In1, FString& Out2, FString& Out3, bool In4);
+	/** Benchmark pure node Lib036_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn026(bool In0, const FString& In1, int32 In2, FVector& Out3, FName In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib036_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn027(const TArray< int32 >& In0, const FString& In1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib036_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn028(int32 In0, const FString& In1, UObject* In2, int32& Out3, FVector& Out4, UObject* In5);
+	/** Benchmark pure node Lib036_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn029(const FVector& In0, const FTransform& In1, float In2, FName In3, FName In4, FString& Out5, FVector& Out6, UObject* In7);
+	/** Benchmark pure node Lib036_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn030(const FVector& In0, int32 In1);
+	/** Benchmark callable node Lib036_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn031(FVector& Out0, FString& Out1, bool In2, UObject* In3, float In4);
+	/** Benchmark pure node Lib036_Fn032 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn032(const TArray< int32 >& In0, const FString& In1);
+	/** Benchmark pure node Lib036_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn033(const FTransform& In0, float In1, int32& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib036_Fn034 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn034(float In0);
+	/** Benchmark pure node Lib036_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn035(const FString& In0, FVector& Out1, bool In2, FString& Out3, int32 In4, float In5);
+	/** Benchmark pure node Lib036_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn036(bool In0, UObject* In1);
+	/** Benchmark callable node Lib036_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn037(float In0, const TArray< int32 >& In1, FString& Out2, int32& Out3, float In4);
+	/** Benchmark callable node Lib036_Fn038 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn038(FVector& Out0, FName In1, int32 In2, FVector& Out3, FString& Out4, const FVector& In5, const TArray< int32 >& In6, FName In7);
+	/** Benchmark pure node Lib036_Fn039 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn039();
+	/** Benchmark pure node Lib036_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn040(const FVector& In0, FName In1, bool In2, FVector& Out3);
+	/** Benchmark callable node Lib036_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn041(FName In0, FString& Out1, const FTransform& In2, const TArray< int32 >& In3, bool In4, bool In5);
+	/** Benchmark callable node Lib036_Fn042 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn042(const TArray< int32 >& In0, bool In1, int32& Out2, const FTransform& In3, FVector& Out4, const TArray< int32 >& In5, UObject* In6, FVector& Out7);
+	/** Benchmark callable node Lib036_Fn043 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn043(FVector& Out0, const TArray< int32 >& In1, const FVector& In2, int32 In3);
+	/** Benchmark pure node Lib036_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn044();
+	/** Benchmark callable node Lib036_Fn045 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn045(const FTransform& In0, int32& Out1, const FString& In2, UObject* In3);
+	/** Benchmark callable node Lib036_Fn046 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn046(FString& Out0, int32& Out1, bool In2, int32& Out3);
+	/** Benchmark pure node Lib036_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn047(FName In0, int32 In1, const FString& In2, const FVector& In3, const FVector& In4);
+	/** Benchmark pure node Lib036_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn048(FString& Out0, const FString& In1, FString& Out2, float In3);
+	/** Benchmark pure node Lib036_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn049(FName In0, const FTransform& In1, FVector& Out2, int32& Out3, float In4, FName In5);
+	/** Benchmark pure node Lib036_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn050(const FTransform& In0, int32& Out1, bool In2, const FString& In3, int32 In4, FName In5);
+	/** Benchmark callable node Lib036_Fn051 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn051();
+	/** Benchmark callable node Lib036_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn052(FString& Out0, UObject* In1);
+	/** Benchmark pure node Lib036_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn053(FString& Out0, int32& Out1, bool In2, FName In3);
+	/** Benchmark callable node Lib036_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn054(float In0, const FString& In1, const TArray< int32 >& In2, int32 In3, const FVector& In4, FVector& Out5, bool In6, FName In7);
+	/** Benchmark callable node Lib036_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn055();
+	/** Benchmark pure node Lib036_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn056(float In0, const FString& In1, int32 In2, const TArray< int32 >& In3, float In4, const TArray< int32 >& In5, const FVector& In6, bool In7);
+	/** Benchmark pure node Lib036_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn057(float In0);
+	/** Benchmark callable node Lib036_Fn058 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn058(int32 In0);
+	/** Benchmark latent node Lib036_Fn059 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, const TArray< int32 >& In2, FString& Out3, int32& Out4, const FTransform& In5, FVector& Out6, int32& Out7);
+	/** Benchmark pure node Lib036_Fn060 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn060(FVector& Out0, FName In1, bool In2, const TArray< int32 >& In3, bool In4, const FVector& In5, int32 In6);
+	/** Benchmark pure node Lib036_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn061();
+	/** Benchmark latent node Lib036_Fn062 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const TArray< int32 >& In1, UObject* In2, const FTransform& In3, UObject* In4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark callable node Lib036_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn063(const FString& In0);
+	/** Benchmark callable node Lib036_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn064(const TArray< int32 >& In0, FString& Out1, int32& Out2, FName In3, bool In4, FString& Out5, const FString& In6);
+	/** Benchmark callable node Lib036_Fn065 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn065(float In0, UObject* In1, FName In2);
+	/** Benchmark callable node Lib036_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn066(float In0, int32& Out1, float In2, int32 In3, const FString& In4, int32& Out5, float In6);
+	/** Benchmark latent node Lib036_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32 In1, const TArray< int32 >& In2, FName In3, const FTransform& In4);
+	/** Benchmark callable node Lib036_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn068(FName In0, UObject* In1, FName In2, const FString& In3, const FTransform& In4);
+	/** Benchmark callable node Lib036_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn069(int32 In0, FVector& Out1);
+	/** Benchmark pure node Lib036_Fn070 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn070();
+	/** Benchmark callable node Lib036_Fn071 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn071(FVector& Out0, UObject* In1, FVector& Out2, int32& Out3);
+	/** Benchmark callable node Lib036_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn072(const TArray< int32 >& In0, bool In1, float In2, FVector& Out3, bool In4);
+	/** Benchmark callable node Lib036_Fn073 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn073();
+	/** Benchmark callable node Lib036_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn074(int32 In0, const TArray< int32 >& In1, float In2, FName In3, const FString& In4, const TArray< int32 >& In5, int32& Out6, UObject* In7);
+	/** Benchmark callable node Lib036_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn075(const FTransform& In0, int32 In1, FVector& Out2, FName In3, UObject* In4, const FTransform& In5, float In6);
+	/** Benchmark latent node Lib036_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib036_Fn077 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn077(const TArray< int32 >& In0, bool In1, FString& Out2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib036_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn078(const FString& In0, const FVector& In1, UObject* In2, FName In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib036_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn079(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib036_Fn080 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn080(const FTransform& In0, const FString& In1, const FTransform& In2, int32 In3, FName In4, const FVector& In5);
+	/** Benchmark callable node Lib036_Fn081 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn081(FName In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib036_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn082(FVector& Out0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, UObject* In4);
+	/** Benchmark callable node Lib036_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn083();
+	/** Benchmark pure node Lib036_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn084(float In0, FString& Out1, int32 In2, const FString& In3, const FVector& In4);
+	/** Benchmark callable node Lib036_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn085(FString& Out0, float In1, FString& Out2, int32& Out3, float In4, const FVector& In5, FString& Out6);
+	/** Benchmark pure node Lib036_Fn086 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static bool Lib036_Fn086(int32& Out0, const FVector& In1, float In2);
+	/** Benchmark callable node Lib036_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn087(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib036_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn088(FName In0, float In1, FVector& Out2, const FString& In3, const FVector& In4, int32& Out5);
+	/** Benchmark pure node Lib036_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FVector Lib036_Fn089(bool In0, const TArray< int32 >& In1, UObject* In2);
+	/** Benchmark pure node Lib036_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn090(FName In0, FString& Out1, const FVector& In2, const FVector& In3, FString& Out4, const FTransform& In5, const FVector& In6);
+	/** Benchmark latent node Lib036_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, bool In2);
+	/** Benchmark pure node Lib036_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn092(FString& Out0);
+	/** Benchmark latent node Lib036_Fn093 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib036_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, UObject* In1, UObject* In2, const FVector& In3, FName In4, FName In5, float In6, float In7);
+	/** Benchmark pure node Lib036_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn094(int32& Out0, bool In1, FString& Out2, const FVector& In3, const FVector& In4);
+	/** Benchmark callable node Lib036_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static float Lib036_Fn095(const FVector& In0, FName In1, bool In2, int32 In3, FName In4, const TArray< int32 >& In5, const FVector& In6, float In7);
+	/** Benchmark pure node Lib036_Fn096 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn096(int32 In0, FVector& Out1, bool In2, int32& Out3);
+	/** Benchmark callable node Lib036_Fn097 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static void Lib036_Fn097(const FTransform& In0);
+	/** Benchmark pure node Lib036_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib036")
+	static int32 Lib036_Fn098(FVector& Out0, int32 In1);
+	/** Benchmark callable node Lib036_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib036")
+	static FString Lib036_Fn099(float In0, int32 In1, float In2, UObject* In3, UObject* In4, const TArray< int32 >& In5, int32 In6);
+};
+
+
+UCLASS()
+class UKDGBenchLib_037 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib037_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn000(FName In0, UObject* In1);
+	/** Benchmark latent node Lib037_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, UObject* In1, FVector& Out2, FVector& Out3, int32 In4);
+	/** Benchmark callable node Lib037_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn002(FString& Out0, int32 In1, const FTransform& In2, const FString& In3, bool In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib037_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn003(UObject* In0);
+	/** Benchmark latent node Lib037_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FVector& In1, bool In2, const FTransform& In3, FString& Out4, UObject* In5);
+	/** Benchmark callable node Lib037_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn005(const TArray< int32 >& In0, FName In1, float In2, bool In3, FVector& Out4, const FString& In5, UObject* In6);
+	/** Benchmark pure node Lib037_Fn006 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn006(const TArray< int32 >& In0, FName In1, float In2, int32& Out3, int32& Out4, float In5, bool In6);
+	/** Benchmark callable node Lib037_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn007(int32 In0, UObject* In1, FName In2, const FTransform& In3, FVector& Out4, UObject* In5);
+	/** Benchmark callable node Lib037_Fn008 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn008(int32 In0, FVector& Out1, UObject* In2);
+	/** Benchmark latent node Lib037_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, bool In1, const FTransform& In2, UObject* In3);
+	/** Benchmark pure node Lib037_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn010();
+	/** Benchmark pure node Lib037_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn011(FString& Out0, const FTransform& In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib037_Fn012 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn012(int32 In0, const FString& In1, FVector& Out2, const FString& In3, const FVector& In4);
+	/** Benchmark callable node Lib037_Fn013 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn013(int32& Out0, const FTransform& In1, const FVector& In2, FVector& Out3, bool In4, UObject* In5, bool In6);
+	/** Benchmark latent node Lib037_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark callable node Lib037_Fn015 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn015();
+	/** Benchmark pure node Lib037_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn016();
+	/** Benchmark pure node Lib037_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn017(int32& Out0, const FString& In1, FName In2, FName In3);
+	/** Benchmark callable node Lib037_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn018(float In0, float In1, FString& Out2, FVector& Out3, const FString& In4);
+	/** Benchmark pure node Lib037_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn019(const FTransform& In0, UObject* In1, FName In2, const FString& In3, bool In4);
+	/** Benchmark pure node Lib037_Fn020 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn020(FString& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib037_Fn021 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn021();
+	/** Benchmark callable node Lib037_Fn022 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn022(const FString& In0, float In1, FString& Out2, int32& Out3, int32 In4, float In5, FVector& Out6, const FVector& In7);
+	/** Benchmark pure node Lib037_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn023(float In0, FVector& Out1, bool In2);
+	/** Benchmark pure node Lib037_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn024(float In0, const FString& In1, bool In2, const FString& In3, FVector& Out4, const FVector& In5, FName In6, UObject* In7);
+	/** Benchmark callable node Lib037_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn025(FString& Out0, const FTransform& In1, FString& Out2, int32& Out3, float In4, bool In5, FName In6, const FVector& In7);
+	/** Benchmark callable node Lib037_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn026(int32& Out0, int32& Out1, FString& Out2, FVector& Out3);
+	/** Benchmark pure node Lib037_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn027(const FString& In0, UObject* In1, const TArray< int32 >& In2, bool In3, FVector& Out4, int32 In5, FVector& Out6);
+	/** Benchmark pure node Lib037_Fn028 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn028();
+	/** Benchmark pure node Lib037_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn029(bool In0, FString& Out1, FVector& Out2, const FTransform& In3, int32& Out4, FString& Out5, int32& Out6, int32& Out7);
+	/** Benchmark callable node Lib037_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn030(FName In0, int32 In1, UObject* In2, UObject* In3, UObject* In4, int32 In5);
+	/** Benchmark callable node Lib037_Fn031 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn031(const FTransform& In0, FString& Out1, bool In2);
+	/** Benchmark callable node Lib037_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn032();
+	/** Benchmark callable node Lib037_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn033(const FVector& In0, const FTransform& In1, const FTransform& In2, float In3, int32 In4, bool In5);
+	/** Benchmark callable node Lib037_Fn034 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn034(const FTransform& In0, const TArray< int32 >& In1, float In2, const FString& In3, FVector& Out4, const FVector& In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib037_Fn035 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn035();
+	/** Benchmark latent node Lib037_Fn036 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1, FVector& Out2, const TArray< int32 >& In3, FString& Out4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib037_Fn037 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn037(FVector& Out0, FName In1, int32 In2);
+	/** Benchmark callable node Lib037_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn038(int32 In0, const FTransform& In1, const FVector& In2, bool In3, int32 In4, float In5, float In6);
+	/** Benchmark callable node Lib037_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn039(const FTransform& In0, FString& Out1, int32 In2, int32 In3, int32& Out4, FString& Out5, const FTransform& In6, const FString& In7);
+	/** Benchmark pure node Lib037_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn040(const FTransform& In0, FName In1, FString& Out2, const FVector& In3, const TArray< int32 >& In4, float In5);
+	/** Benchmark latent node Lib037_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FString& In1, const FTransform& In2, int32& Out3, int32& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib037_Fn042 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn042(float In0);
+	/** Benchmark pure node Lib037_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn043(const FVector& In0, bool In1, float In2, const FTransform& In3, const FString& In4, int32 In5, FName In6);
+	/** Benchmark callable node Lib037_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn044(const FVector& In0, FString& Out1, int32 In2);
+	/** Benchmark pure node Lib037_Fn045 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn045();
+	/** Benchmark latent node Lib037_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1, FName In2, const TArray< int32 >& In3, FString& Out4, FName In5);
+	/** Benchmark pure node Lib037_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn047(const TArray< int32 >& In0, UObject* In1, const FString& In2, UObject* In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib037_Fn048 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn048(FVector& Out0, const FString& In1, FString& Out2, const FVector& In3, int32 In4, FString& Out5);
+	/** Benchmark callable node Lib037_Fn049 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn049(FString& Out0, UObject* In1, int32 In2, int32& Out3);
+	/** Benchmark callable node Lib037_Fn050 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn050();
+	/** Benchmark latent node Lib037_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FVector& In1, const FString& In2, FVector& Out3);
+	/** Benchmark callable node Lib037_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn052(FName In0, UObject* In1);
+	/** Benchmark callable node Lib037_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn053();
+	/** Benchmark latent node Lib037_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FName In1, const FVector& In2, FName In3, const TArray< int32 >& In4, float In5);
+	/** Benchmark pure node Lib037_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn055(float In0, int32& Out1, int32 In2, const FTransform& In3);
+	/** Benchmark latent node Lib037_Fn056 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FTransform& In1, FVector& Out2);
+	/** Benchmark pure node Lib037_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn057(FName In0, int32 In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib037_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn058(int32& Out0, FString& Out1);
+	/** Benchmark callable node Lib037_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn059(UObject* In0, FName In1, bool In2, bool In3, FName In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib037_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn060(const FString& In0, float In1, FString& Out2, UObject* In3, int32& Out4, int32& Out5, int32 In6, int32 In7);
+	/** Benchmark callable node Lib037_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn061(float In0, const FTransform& In1, const FString& In2, int32 In3, FVector& Out4, bool In5, int32& Out6);
+	/** Benchmark callable node Lib037_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn062(FName In0, int32 In1, float In2, const FTransform& In3);
+	/** Benchmark callable node Lib037_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn063(const FTransform& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib037_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn064(const FVector& In0, int32& Out1, FVector& Out2);
+	/** Benchmark callable node Lib037_Fn065 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn065(int32 In0, const FVector& In1, float In2, const FTransform& In3, bool In4);
+	/** Benchmark pure node Lib037_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn066(int32 In0, int32 In1, FString& Out2, const FTransform& In3, const FTransform& In4, FName In5);
+	/** Benchmark pure node Lib037_Fn067 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn067(const FString& In0, FString& Out1, FName In2);
+	/** Benchmark pure node Lib037_Fn068 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn068(const FVector& In0, const FString& In1, const TArray< int32 >& In2, const FVector& In3, FVector& Out4, float In5, const FVector& In6);
+	/** Benchmark callable node Lib037_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn069(int32& Out0, FVector& Out1, const FString& In2, const FTransform& In3);
+	/** Benchmark callable node Lib037_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn070(int32& Out0, FName In1, bool In2, float In3, FVector& Out4, const FTransform& In5, UObject* In6);
+	/** Benchmark callable node Lib037_Fn071 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn071(const FVector& In0, const FString& In1, float In2);
+	/** Benchmark pure node Lib037_Fn072 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn072(float In0, float In1, FName In2);
+	/** Benchmark pure node Lib037_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn073(UObject* In0, const FString& In1, int32 In2, const FVector& In3, UObject* In4, FVector& Out5);
+	/** Benchmark latent node Lib037_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib037_Fn075 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn075(float In0, const FTransform& In1, const FTransform& In2, const TArray< int32 >& In3, FString& Out4);
+	/** Benchmark callable node Lib037_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn076(float In0, int32 In1, const FTransform& In2, UObject* In3);
+	/** Benchmark pure node Lib037_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn077();
+	/** Benchmark callable node Lib037_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn078(int32 In0, const FVector& In1, const FVector& In2, bool In3, const FVector& In4);
+	/** Benchmark pure node Lib037_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn079(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib037_Fn080 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn080(const FTransform& In0, FVector& Out1, bool In2, FString& Out3, const FString& In4, FVector& Out5);
+	/** Benchmark callable node Lib037_Fn081 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn081(const FVector& In0, int32 In1, const FString& In2, const TArray< int32 >& In3, const FString& In4, float In5, bool In6, const FVector& In7);
+	/** Benchmark callable node Lib037_Fn082 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn082(bool In0);
+	/** Benchmark callable node Lib037_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static void Lib037_Fn083(const FString& In0, const FTransform& In1);
+	/** Benchmark latent node Lib037_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1, bool In2, const FVector& In3, FVector& Out4);
+	/** Benchmark callable node Lib037_Fn085 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn085(FString& Out0, const FString& In1, FName In2, const FString& In3, UObject* In4);
+	/** Benchmark callable node Lib037_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn086(FVector& Out0, float In1);
+	/** Benchmark latent node Lib037_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn087(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark pure node Lib037_Fn088 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn088(FVector& Out0, FVector& Out1);
+	/** Benchmark pure node Lib037_Fn089 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn089(const FTransform& In0, UObject* In1, FString& Out2, FString& Out3, FVector& Out4);
+	/** Benchmark latent node Lib037_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FName In1);
+	/** Benchmark pure node Lib037_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn091(int32& Out0, int32 In1, int32& Out2, const TArray< int32 >& In3, const FString& In4, const FVector& In5);
+	/** Benchmark latent node Lib037_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib037_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1, const FVector& In2, FName In3, const FTransform& In4);
+	/** Benchmark pure node Lib037_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static float Lib037_Fn093(const FTransform& In0, UObject* In1, bool In2, int32& Out3, float In4, float In5);
+	/** Benchmark callable node Lib037_Fn094 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn094(float In0, const FVector& In1, int32& Out2, FString& Out3, FName In4, FName In5);
+	/** Benchmark pure node Lib037_Fn095 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn095(FVector& Out0, const TArray< int32 >& In1, FName In2, int32& Out3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib037_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FVector Lib037_Fn096(UObject* In0, int32 In1, bool In2, FVector& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib037_Fn097 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib037")
+	static int32 Lib037_Fn097(bool In0, int32 In1, FVector& Out2, FName In3);
+	/** Benchmark callable node Lib037_Fn098 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static FString Lib037_Fn098(FName In0);
+	/** Benchmark callable node Lib037_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib037")
+	static bool Lib037_Fn099(int32 In0, int32& Out1, int32& Out2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_038 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib038_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn000(float In0, int32 In1, FString& Out2);
+	/** Benchmark pure node Lib038_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn001(int32& Out0, FString& Out1);
+	/** Benchmark callable node Lib038_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn002(const FString& In0, const FTransform& In1, FVector& Out2, UObject* In3, const FTransform& In4, FVector& Out5);
+	/** Benchmark pure node Lib038_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn003(const FString& In0, int32& Out1, float In2, FString& Out3, int32 In4, UObject* In5, FName In6, FName In7);
+	/** Benchmark callable node Lib038_Fn004 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn004(FString& Out0, FName In1, const FString& In2);
+	/** Benchmark pure node Lib038_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn005(int32 In0, bool In1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib038_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn006(bool In0, FString& Out1, const FVector& In2, float In3, float In4);
+	/** Benchmark callable node Lib038_Fn007 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn007(FName In0, const FString& In1, UObject* In2, const FTransform& In3, const TArray< int32 >& In4, UObject* In5, const FTransform& In6, FName In7);
+	/** Benchmark callable node Lib038_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn008();
+	/** Benchmark callable node Lib038_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn009(bool In0);
+	/** Benchmark callable node Lib038_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn010();
+	/** Benchmark callable node Lib038_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn011(const FString& In0, const FString& In1, bool In2);
+	/** Benchmark pure node Lib038_Fn012 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static FString Lib038_Fn012(FString& Out0, bool In1, FName In2, FString& Out3, FName In4, FVector& Out5);
+	/** Benchmark latent node Lib038_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib038_Fn014 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn014();
+	/** Benchmark pure node Lib038_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn015(FString& Out0, float In1, bool In2, FVector& Out3);
+	/** Benchmark callable node Lib038_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn016(const TArray< int32 >& In0, UObject* In1, UObject* In2, const FString& In3, const TArray< int32 >& In4, const FString& In5, int32& Out6, const FString& In7);
+	/** Benchmark pure node Lib038_Fn017 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn017(FString& Out0, FString& Out1, const FVector& In2, FVector& Out3, float In4, const FVector& In5, float In6);
+	/** Benchmark pure node Lib038_Fn018 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn018();
+	/** Benchmark callable node Lib038_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn019(FVector& Out0, bool In1);
+	/** Benchmark pure node Lib038_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn020(const FString& In0, const FString& In1, FString& Out2, FString& Out3, const FVector& In4, int32& Out5, FVector& Out6, FName In7);
+	/** Benchmark callable node Lib038_Fn021 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn021(float In0, bool In1, int32 In2, UObject* In3, UObject* In4, FString& Out5, const FTransform& In6, const FVector& In7);
+	/** Benchmark callable node Lib038_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FString Lib038_Fn022(const TArray< int32 >& In0, const FString& In1, UObject* In2, FVector& Out3, const FTransform& In4, FString& Out5, const FVector& In6);
+	/** Benchmark pure node Lib038_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn023();
+	/** Benchmark callable node Lib038_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn024(bool In0, float In1, FName In2, const FTransform& In3, int32 In4, int32 In5, const FString& In6);
+	/** Benchmark callable node Lib038_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn025(FVector& Out0);
+	/** Benchmark callable node Lib038_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn026(int32& Out0, bool In1, FString& Out2, const TArray< int32 >& In3, UObject* In4, float In5, FVector& Out6, FVector& Out7);
+	/** Benchmark callable node Lib038_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn027(const FTransform& In0, const FTransform& In1);
+	/** Benchmark callable node Lib038_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FString Lib038_Fn028(UObject* In0, const FTransform& In1, const FString& In2, const FTransform& In3);
+	/** Benchmark callable node Lib038_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn029(FString& Out0, float In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib038_Fn030 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn030(FString& Out0, bool In1, FName In2, FString& Out3, int32& Out4);
+	/** Benchmark callable node Lib038_Fn031 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FString Lib038_Fn031();
+	/** Benchmark latent node Lib038_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, UObject* In1);
+	/** Benchmark callable node Lib038_Fn033 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn033(const TArray< int32 >& In0, bool In1);
+	/** Benchmark callable node Lib038_Fn034 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn034(bool In0, int32 In1, const TArray< int32 >& In2, int32& Out3, int32 In4, const FVector& In5, const FTransform& In6, int32& Out7);
+	/** Benchmark pure node Lib038_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn035(int32& Out0);
+	/** Benchmark callable node Lib038_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn036(FString& Out0, FName In1);
+	/** Benchmark callable node Lib038_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn037(const TArray< int32 >& In0, const FTransform& In1, FName In2, float In3);
+	/** Benchmark callable node Lib038_Fn038 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn038(float In0, FVector& Out1);
+	/** Benchmark callable node Lib038_Fn039 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn039(FName In0, const FVector& In1, float In2);
+	/** Benchmark callable node Lib038_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn040(const FTransform& In0, const FVector& In1, bool In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib038_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn041(UObject* In0, int32& Out1, const FVector& In2, FVector& Out3, int32 In4, int32 In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib038_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn042();
+	/** Benchmark callable node Lib038_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn043(float In0, UObject* In1, FVector& Out2, int32 In3, FString& Out4, float In5, UObject* In6);
+	/** Benchmark callable node Lib038_Fn044 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn044(int32& Out0, int32 In1);
+	/** Benchmark latent node Lib038_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0);
+	/** Benchmark pure node Lib038_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn046(const TArray< int32 >& In0, float In1);
+	/** Benchmark callable node Lib038_Fn047 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FString Lib038_Fn047(UObject* In0);
+	/** Benchmark callable node Lib038_Fn048 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn048(FString& Out0, FName In1, FString& Out2, float In3, const FVector& In4);
+	/** Benchmark callable node Lib038_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn049(FVector& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, bool In3, int32& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib038_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn050(float In0, FString& Out1, const FVector& In2, bool In3);
+	/** Benchmark callable node Lib038_Fn051 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn051();
+	/** Benchmark pure node Lib038_Fn052 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn052(bool In0, float In1, int32& Out2, FString& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib038_Fn053 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn053(UObject* In0, const FVector& In1, FString& Out2, FName In3, const FVector& In4, bool In5, FVector& Out6, const FVector& In7);
+	/** Benchmark callable node Lib038_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn054(float In0);
+	/** Benchmark latent node Lib038_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0);
+	/** Benchmark callable node Lib038_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn056();
+	/** Benchmark callable node Lib038_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn057();
+	/** Benchmark pure node Lib038_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn058(UObject* In0, bool In1, const TArray< int32 >& In2, FVector& Out3);
+	/** Benchmark pure node Lib038_Fn059 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn059(FName In0, const FString& In1, bool In2, const FString& In3, float In4, int32& Out5, int32 In6);
+	/** Benchmark pure node Lib038_Fn060 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn060(const FTransform& In0, const FString& In1, const FVector& In2, const FVector& In3, FString& Out4, int32 In5);
+	/** Benchmark callable node Lib038_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn061(int32 In0, int32 In1, const FString& In2, bool In3, FName In4, float In5, FName In6);
+	/** Benchmark pure node Lib038_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn062(UObject* In0, float In1, FString& Out2, const FVector& In3, int32 In4);
+	/** Benchmark latent node Lib038_Fn063 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FString& Out1, const FTransform& In2, FName In3, FVector& Out4, bool In5, int32 In6);
+	/** Benchmark callable node Lib038_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn064(bool In0, int32& Out1, FString& Out2, int32 In3, FString& Out4, FString& Out5, FName In6, int32 In7);
+	/** Benchmark pure node Lib038_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn065();
+	/** Benchmark callable node Lib038_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn066(FString& Out0, const TArray< int32 >& In1, const FString& In2, FName In3);
+	/** Benchmark latent node Lib038_Fn067 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, float In1, int32 In2, const FString& In3, FVector& Out4, const FString& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib038_Fn068 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn068();
+	/** Benchmark pure node Lib038_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn069(float In0, FVector& Out1, const FVector& In2, float In3, const TArray< int32 >& In4, float In5);
+	/** Benchmark callable node Lib038_Fn070 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn070(const FString& In0, FVector& Out1, FString& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib038_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn071(FString& Out0);
+	/** Benchmark latent node Lib038_Fn072 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, const FString& In2, bool In3, const TArray< int32 >& In4, bool In5, const FVector& In6, bool In7);
+	/** Benchmark callable node Lib038_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn073(FVector& Out0, FName In1, FName In2, UObject* In3, UObject* In4, FName In5);
+	/** Benchmark pure node Lib038_Fn074 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn074();
+	/** Benchmark callable node Lib038_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn075(int32 In0, const FVector& In1, const TArray< int32 >& In2, int32 In3, const FVector& In4, int32& Out5, const FVector& In6, const FString& In7);
+	/** Benchmark pure node Lib038_Fn076 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn076();
+	/** Benchmark callable node Lib038_Fn077 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn077(UObject* In0, UObject* In1, int32 In2, FString& Out3, const FTransform& In4);
+	/** Benchmark callable node Lib038_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FString Lib038_Fn078(const TArray< int32 >& In0, UObject* In1, int32& Out2, FName In3, bool In4);
+	/** Benchmark callable node Lib038_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn079(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib038_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static bool Lib038_Fn080(float In0, bool In1, const FString& In2, float In3, const FTransform& In4);
+	/** Benchmark latent node Lib038_Fn081 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, FString& Out2);
+	/** Benchmark callable node Lib038_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn082(FName In0, FName In1, float In2, int32& Out3, bool In4);
+	/** Benchmark callable node Lib038_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn083(const FVector& In0, UObject* In1, const TArray< int32 >& In2, FString& Out3, int32& Out4);
+	/** Benchmark pure node Lib038_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn084(FName In0, FVector& Out1, const FVector& In2, int32 In3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib038_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn085(FVector& Out0, FVector& Out1, FName In2);
+	/** Benchmark pure node Lib038_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn086(int32& Out0, int32 In1, UObject* In2, const FString& In3, int32 In4);
+	/** Benchmark callable node Lib038_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn087(const FTransform& In0);
+	/** Benchmark pure node Lib038_Fn088 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn088(bool In0, const TArray< int32 >& In1, const FTransform& In2, const TArray< int32 >& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib038_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn089(const FString& In0, int32& Out1);
+	/** Benchmark latent node Lib038_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib038_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib038_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn091(UObject* In0, FName In1, const FVector& In2, UObject* In3, UObject* In4);
+	/** Benchmark callable node Lib038_Fn092 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn092(FName In0, FVector& Out1);
+	/** Benchmark callable node Lib038_Fn093 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static void Lib038_Fn093(const FString& In0);
+	/** Benchmark callable node Lib038_Fn094 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn094(const TArray< int32 >& In0, FString& Out1, FString& Out2, const FString& In3, float In4, FName In5, bool In6);
+	/** Benchmark callable node Lib038_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn095();
+	/** Benchmark pure node Lib038_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static float Lib038_Fn096(bool In0, int32 In1);
+	/** Benchmark pure node Lib038_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static int32 Lib038_Fn097(const FTransform& In0, FString& Out1);
+	/** Benchmark pure node Lib038_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib038")
+	static FVector Lib038_Fn098();
+	/** Benchmark callable node Lib038_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib038")
+	static FString Lib038_Fn099(float In0, int32& Out1, int32 In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_039 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib039_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn000(int32 In0, const FTransform& In1, int32 In2, const FTransform& In3);
+	/** Benchmark pure node Lib039_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn001(float In0, FName In1, FString& Out2, FVector& Out3, float In4, const TArray< int32 >& In5, float In6);
+	/** Benchmark callable node Lib039_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn002(bool In0, FString& Out1, FVector& Out2, const TArray< int32 >& In3, FString& Out4, FVector& Out5, const FTransform& In6, FName In7);
+	/** Benchmark callable node Lib039_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn003(const TArray< int32 >& In0, float In1, UObject* In2);
+	/** Benchmark callable node Lib039_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn004(UObject* In0, FName In1);
+	/** Benchmark callable node Lib039_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn005(const FString& In0, const FVector& In1, UObject* In2, const FVector& In3, const FString& In4, FName In5, int32 In6, const FTransform& In7);
+	/** Benchmark callable node Lib039_Fn006 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn006();
+	/** Benchmark pure node Lib039_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn007(FString& Out0, const FTransform& In1, const FTransform& In2);
+	/** Benchmark pure node Lib039_Fn008 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn008(UObject* In0);
+	/** Benchmark callable node Lib039_Fn009 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn009(int32& Out0, const FString& In1, UObject* In2, FString& Out3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib039_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn010();
+	/** Benchmark pure node Lib039_Fn011 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn011(const FTransform& In0, FString& Out1, const FTransform& In2, int32& Out3, const FString& In4);
+	/** Benchmark callable node Lib039_Fn012 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn012(int32 In0, const FVector& In1, FString& Out2, const FString& In3, const FString& In4);
+	/** Benchmark callable node Lib039_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn013(const FString& In0, FString& Out1, UObject* In2, const FTransform& In3, bool In4);
+	/** Benchmark pure node Lib039_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn014(const FString& In0, FName In1, const TArray< int32 >& In2, FName In3, const TArray< int32 >& In4, FString& Out5, FVector& Out6);
+	/** Benchmark callable node Lib039_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn015(float In0, const FVector& In1, float In2, const FVector& In3, const FVector& In4, const TArray< int32 >& In5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark callable node Lib039_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn016(int32& Out0, const TArray< int32 >& In1, const FTransform& In2, const TArray< int32 >& In3, FVector& Out4, float In5, int32& Out6, int32& Out7);
+	/** Benchmark callable node Lib039_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn017(UObject* In0, FString& Out1, int32 In2, int32 In3, FString& Out4, UObject* In5);
+	/** Benchmark pure node Lib039_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn018(int32& Out0, UObject* In1, int32 In2, int32& Out3);
+	/** Benchmark callable node Lib039_Fn019 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn019(FVector& Out0, const TArray< int32 >& In1, FName In2, const FVector& In3, int32 In4, const TArray< int32 >& In5, float In6);
+	/** Benchmark callable node Lib039_Fn020 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn020(UObject* In0, int32 In1);
+	/** Benchmark callable node Lib039_Fn021 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn021();
+	/** Benchmark pure node Lib039_Fn022 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn022(float In0, int32& Out1, const TArray< int32 >& In2, const FString& In3, bool In4, const FTransform& In5, FString& Out6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib039_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn023(const TArray< int32 >& In0, FVector& Out1, int32 In2, float In3, const FString& In4);
+	/** Benchmark callable node Lib039_Fn024 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn024(bool In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib039_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn025(FName In0);
+	/** Benchmark pure node Lib039_Fn026 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn026(UObject* In0, FName In1, UObject* In2);
+	/** Benchmark callable node Lib039_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn027(int32 In0, FName In1, UObject* In2, int32& Out3);
+	/** Benchmark latent node Lib039_Fn028 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib039_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, FVector& Out1, bool In2);
+	/** Benchmark callable node Lib039_Fn029 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn029(float In0, const FVector& In1, UObject* In2, UObject* In3, const TArray< int32 >& In4, FString& Out5, bool In6);
+	/** Benchmark callable node Lib039_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn030(const TArray< int32 >& In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib039_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn031(int32 In0);
+	/** Benchmark callable node Lib039_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn032(float In0, FName In1, const FTransform& In2, int32 In3);
+	/** Benchmark callable node Lib039_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn033(FString& Out0, UObject* In1, int32& Out2, int32 In3, FString& Out4);
+	/** Benchmark callable node Lib039_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn034(FName In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib039_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn035(int32 In0, float In1, const FString& In2, FName In3, UObject* In4, UObject* In5);
+	/** Benchmark callable node Lib039_Fn036 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn036(FVector& Out0, bool In1, const FString& In2);
+	/** Benchmark callable node Lib039_Fn037 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn037(const FTransform& In0, float In1, UObject* In2);
+	/** Benchmark callable node Lib039_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn038(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib039_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn039(UObject* In0, const TArray< int32 >& In1, FName In2, int32& Out3, const FVector& In4, const FVector& In5, FVector& Out6);
+	/** Benchmark callable node Lib039_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn040(const FVector& In0, const FVector& In1, FName In2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib039_Fn041 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn041(FName In0, const TArray< int32 >& In1, const FVector& In2, bool In3, UObject* In4, bool In5, const FTransform& In6);
+	/** Benchmark pure node Lib039_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn042();
+	/** Benchmark callable node Lib039_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn043(float In0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, float In4);
+	/** Benchmark callable node Lib039_Fn044 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn044(const FVector& In0, FString& Out1, int32& Out2, int32 In3, FVector& Out4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib039_Fn045 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn045(FString& Out0, float In1, int32& Out2, float In3, FName In4, UObject* In5);
+	/** Benchmark callable node Lib039_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn046(UObject* In0, bool In1, const FString& In2, const FTransform& In3, UObject* In4, const FString& In5, FName In6, const FTransform& In7);
+	/** Benchmark callable node Lib039_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn047(bool In0, const FString& In1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4, int32& Out5);
+	/** Benchmark callable node Lib039_Fn048 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn048(const FTransform& In0, float In1);
+	/** Benchmark pure node Lib039_Fn049 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn049();
+	/** Benchmark callable node Lib039_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn050(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib039_Fn051 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn051(const TArray< int32 >& In0, FVector& Out1, int32& Out2, FName In3, int32 In4, FName In5, FName In6, const FVector& In7);
+	/** Benchmark latent node Lib039_Fn052 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib039_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, const FString& In2);
+	/** Benchmark callable node Lib039_Fn053 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn053(const FString& In0, float In1, const FTransform& In2, const FTransform& In3, int32 In4, FString& Out5, const FVector& In6, const FString& In7);
+	/** Benchmark callable node Lib039_Fn054 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn054(const FTransform& In0, UObject* In1, const FVector& In2, FVector& Out3, const FVector& In4);
+	/** Benchmark pure node Lib039_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn055(int32 In0, const FTransform& In1, float In2, FVector& Out3);
+	/** Benchmark callable node Lib039_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn056(const FVector& In0, int32& Out1, const FVector& In2, const FTransform& In3, int32& Out4, int32 In5);
+	/** Benchmark callable node Lib039_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn057(UObject* In0, FString& Out1, const FVector& In2, FName In3, int32 In4, const FVector& In5);
+	/** Benchmark pure node Lib039_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn058(FName In0, int32 In1, bool In2, FName In3, float In4);
+	/** Benchmark latent node Lib039_Fn059 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib039_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, float In2, int32 In3, const FVector& In4);
+	/** Benchmark callable node Lib039_Fn060 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn060(const FTransform& In0, const TArray< int32 >& In1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib039_Fn061 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn061(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib039_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn062(UObject* In0, FName In1, FString& Out2, int32 In3, UObject* In4, int32& Out5, FString& Out6);
+	/** Benchmark callable node Lib039_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn063(const FTransform& In0, const TArray< int32 >& In1, int32& Out2, float In3, float In4);
+	/** Benchmark callable node Lib039_Fn064 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn064(FVector& Out0, UObject* In1, bool In2, const FVector& In3, FVector& Out4, const FString& In5);
+	/** Benchmark latent node Lib039_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib039_Fn065(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib039_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn066();
+	/** Benchmark callable node Lib039_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn067(FString& Out0, FName In1, FName In2, float In3, FName In4, FString& Out5);
+	/** Benchmark callable node Lib039_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn068(int32 In0);
+	/** Benchmark pure node Lib039_Fn069 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn069(UObject* In0, const FVector& In1, FVector& Out2, int32& Out3, const FString& In4, const TArray< int32 >& In5, FVector& Out6, FName In7);
+	/** Benchmark callable node Lib039_Fn070 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn070(const FString& In0, const FString& In1);
+	/** Benchmark pure node Lib039_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn071(FName In0, bool In1, const FVector& In2, UObject* In3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark callable node Lib039_Fn072 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn072(float In0, float In1, int32 In2, const FTransform& In3, float In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark pure node Lib039_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn073(float In0, float In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib039_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn074(UObject* In0);
+	/** Benchmark callable node Lib039_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn075(const FVector& In0, int32& Out1, int32& Out2, float In3, const FString& In4, FName In5, const FTransform& In6);
+	/** Benchmark callable node Lib039_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn076(int32 In0, FVector& Out1, FVector& Out2);
+	/** Benchmark pure node Lib039_Fn077 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn077(FName In0, UObject* In1, const TArray< int32 >& In2, FName In3, float In4);
+	/** Benchmark pure node Lib039_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn078(UObject* In0, const TArray< int32 >& In1, bool In2, UObject* In3, int32& Out4, const TArray< int32 >& In5, FName In6, const FVector& In7);
+	/** Benchmark callable node Lib039_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn079();
+	/** Benchmark pure node Lib039_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn080(FVector& Out0, UObject* In1, FString& Out2);
+	/** Benchmark pure node Lib039_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn081(const TArray< int32 >& In0, FVector& Out1, UObject* In2, bool In3, bool In4, FVector& Out5);
+	/** Benchmark pure node Lib039_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn082(int32& Out0, const FTransform& In1, FVector& Out2, const FString& In3, bool In4, bool In5, FName In6, FName In7);
+	/** Benchmark pure node Lib039_Fn083 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn083(int32 In0, int32 In1, FString& Out2);
+	/** Benchmark callable node Lib039_Fn084 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn084(FName In0, int32 In1);
+	/** Benchmark pure node Lib039_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn085();
+	/** Benchmark pure node Lib039_Fn086 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn086(UObject* In0, const TArray< int32 >& In1, int32& Out2);
+	/** Benchmark pure node Lib039_Fn087 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn087(int32 In0, bool In1, bool In2, const FString& In3);
+	/** Benchmark callable node Lib039_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn088(int32& Out0, const FVector& In1, const FTransform& In2);
+	/** Benchmark callable node Lib039_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn089();
+	/** Benchmark callable node Lib039_Fn090 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static int32 Lib039_Fn090();
+	/** Benchmark callable node Lib039_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn091(const FVector& In0, const FVector& In1, int32& Out2, const FTransform& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib039_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FVector Lib039_Fn092();
+	/** Benchmark callable node Lib039_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn093(const FVector& In0, int32 In1, const TArray< int32 >& In2, float In3, FVector& Out4, int32& Out5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark callable node Lib039_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn094(const FString& In0, const FTransform& In1);
+	/** Benchmark callable node Lib039_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static float Lib039_Fn095();
+	/** Benchmark pure node Lib039_Fn096 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static FString Lib039_Fn096(const FVector& In0, UObject* In1, FVector& Out2, const FString& In3, FVector& Out4, int32& Out5, float In6);
+	/** Benchmark callable node Lib039_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn097(const TArray< int32 >& In0, bool In1, bool In2);
+	/** Benchmark callable node Lib039_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib039")
+	static void Lib039_Fn098(FName In0, UObject* In1, FName In2, float In3, const TArray< int32 >& In4, float In5, int32& Out6);
+	/** Benchmark pure node Lib039_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib039")
+	static bool Lib039_Fn099(const FTransform& In0, const FString& In1, FString& Out2, FVector& Out3);
+};
+
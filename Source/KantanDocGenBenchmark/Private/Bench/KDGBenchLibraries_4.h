@@ -0,0 +1,3105 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchLibraries_4.generated.h"
+
+
+UCLASS()
+class UKDGBenchLib_040 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib040_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn000(const TArray< int32 >& In0, FName In1, int32 In2, const FString& In3);
+	/** Benchmark callable node Lib040_Fn001 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn001(const FVector& In0);
+	/** Benchmark callable node Lib040_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn002(UObject* In0, float In1, float In2, float In3, const TArray< int32 >& In4, int32 In5, const TArray< int32 >& In6, const FString& In7);
+	/** Benchmark callable node Lib040_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn003(UObject* In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib040_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn004(FVector& Out0);
+	/** Benchmark pure node Lib040_Fn005 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn005(const TArray< int32 >& In0, float In1, const FVector& In2, FName In3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib040_Fn006 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn006(FName In0, int32 In1, int32& Out2, const FVector& In3, UObject* In4, FString& Out5, const FString& In6, FString& Out7);
+	/** Benchmark pure node Lib040_Fn007 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn007(FName In0);
+	/** Benchmark pure node Lib040_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn008(const TArray< int32 >& In0, const FTransform& In1, UObject* In2, bool In3, int32 In4, const FVector& In5, int32& Out6, FString& Out7);
+	/** Benchmark pure node Lib040_Fn009 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn009(const FTransform& In0, FVector& Out1, const TArray< int32 >& In2, FName In3, FVector& Out4);
+	/** Benchmark latent node Lib040_Fn010 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FVector& In1, FName In2, int32& Out3);
+	/** Benchmark callable node Lib040_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn011(UObject* In0);
+	/** Benchmark pure node Lib040_Fn012 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn012();
+	/** Benchmark pure node Lib040_Fn013 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn013(int32 In0);
+	/** Benchmark callable node Lib040_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn014(const FVector& In0, FString& Out1, int32& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib040_Fn015 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn015();
+	/** Benchmark latent node Lib040_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, const FVector& In2, FVector& Out3);
+	/** Benchmark callable node Lib040_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn017(const FTransform& In0);
+	/** Benchmark callable node Lib040_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn018(const FTransform& In0, float In1, int32& Out2, int32 In3, FString& Out4, bool In5, int32& Out6);
+	/** Benchmark latent node Lib040_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn019(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, FName In2, const FTransform& In3, const FString& In4, FName In5);
+	/** Benchmark callable node Lib040_Fn020 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn020(FName In0, const FString& In1, float In2, int32& Out3, const FVector& In4, const FTransform& In5, FString& Out6);
+	/** Benchmark latent node Lib040_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FTransform& In1);
+	/** Benchmark callable node Lib040_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn022(const FVector& In0, const TArray< int32 >& In1, FString& Out2, bool In3);
+	/** Benchmark latent node Lib040_Fn023 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn023(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FString& In1);
+	/** Benchmark callable node Lib040_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn024(int32& Out0, int32& Out1, const FTransform& In2, const TArray< int32 >& In3, const FVector& In4, UObject* In5, int32& Out6, const FString& In7);
+	/** Benchmark latent node Lib040_Fn025 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark pure node Lib040_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn026();
+	/** Benchmark callable node Lib040_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn027(FName In0, const FTransform& In1, int32 In2, bool In3);
+	/** Benchmark callable node Lib040_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn028(const FVector& In0);
+	/** Benchmark pure node Lib040_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn029(float In0, FName In1, UObject* In2, int32 In3, FVector& Out4, int32& Out5, UObject* In6, int32& Out7);
+	/** Benchmark pure node Lib040_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn030(FString& Out0, const FVector& In1);
+	/** Benchmark latent node Lib040_Fn031 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, const FTransform& In2, const TArray< int32 >& In3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib040_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn032();
+	/** Benchmark pure node Lib040_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn033(float In0, const FTransform& In1, FString& Out2, const FTransform& In3);
+	/** Benchmark pure node Lib040_Fn034 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn034();
+	/** Benchmark pure node Lib040_Fn035 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn035(FName In0, FName In1, float In2, FName In3, const FTransform& In4);
+	/** Benchmark pure node Lib040_Fn036 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn036(const FVector& In0, const FVector& In1, const FTransform& In2, int32 In3, int32 In4, int32 In5, int32& Out6);
+	/** Benchmark latent node Lib040_Fn037 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FVector& Out1, bool In2, FVector& Out3);
+	/** Benchmark callable node Lib040_Fn038 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn038(FVector& Out0, float In1, bool In2);
+	/** Benchmark pure node Lib040_Fn039 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn039(FName In0, int32& Out1, const FTransform& In2, const FTransform& In3, int32& Out4);
+	/** Benchmark callable node Lib040_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn040(const TArray< int32 >& In0, FString& Out1, int32 In2, float In3, UObject* In4);
+	/** Benchmark callable node Lib040_Fn041 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn041();
+	/** Benchmark callable node Lib040_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn042();
+	/** Benchmark callable node Lib040_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn043(bool In0, UObject* In1, int32& Out2, bool In3, FVector& Out4);
+	/** Benchmark callable node Lib040_Fn044 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn044(int32 In0, bool In1, int32& Out2, FName In3);
+	/** Benchmark latent node Lib040_Fn045 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FVector& Out1, const FTransform& In2, const TArray< int32 >& In3, int32 In4, FVector& Out5, float In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib040_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn046(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib040_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn047(FVector& Out0, float In1, UObject* In2, int32& Out3, FVector& Out4, const FVector& In5);
+	/** Benchmark callable node Lib040_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn048(FVector& Out0, FString& Out1, float In2, UObject* In3);
+	/** Benchmark callable node Lib040_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn049(float In0, FVector& Out1, FString& Out2, int32& Out3, FString& Out4, int32 In5, UObject* In6);
+	/** Benchmark pure node Lib040_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn050(FString& Out0, UObject* In1, const TArray< int32 >& In2, UObject* In3);
+	/** Benchmark callable node Lib040_Fn051 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn051();
+	/** Benchmark callable node Lib040_Fn052 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn052(const TArray< int32 >& In0, FVector& Out1, FName In2, int32 In3, const FVector& In4, FString& Out5);
+	/** Benchmark callable node Lib040_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn053(int32& Out0, const FString& In1, FName In2, int32 In3, FVector& Out4, float In5);
+	/** Benchmark pure node Lib040_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn054(int32& Out0);
+	/** Benchmark callable node Lib040_Fn055 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn055(FString& Out0, const FTransform& In1, FName In2, const TArray< int32 >& In3, const FTransform& In4, FString& Out5);
+	/** Benchmark pure node Lib040_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn056(FString& Out0, const FString& In1, FString& Out2, int32 In3, int32 In4, FName In5, FVector& Out6, const FTransform& In7);
+	/** Benchmark callable node Lib040_Fn057 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn057(FString& Out0, int32 In1, FString& Out2, int32 In3, FVector& Out4);
+	/** Benchmark pure node Lib040_Fn058 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn058(const FVector& In0);
+	/** Benchmark pure node Lib040_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn059(int32& Out0, bool In1, int32 In2, FString& Out3, FVector& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib040_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn060();
+	/** Benchmark callable node Lib040_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn061(float In0);
+	/** Benchmark callable node Lib040_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn062(const FVector& In0, const FVector& In1, bool In2, UObject* In3);
+	/** Benchmark callable node Lib040_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn063(const FTransform& In0);
+	/** Benchmark callable node Lib040_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn064(const TArray< int32 >& In0, const TArray< int32 >& In1, int32 In2, int32& Out3, const FVector& In4, FString& Out5, UObject* In6);
+	/** Benchmark pure node Lib040_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn065(const TArray< int32 >& In0, bool In1);
+	/** Benchmark callable node Lib040_Fn066 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn066(FString& Out0, int32 In1, FVector& Out2);
+	/** Benchmark callable node Lib040_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn067(UObject* In0, bool In1, bool In2, const TArray< int32 >& In3, FName In4, int32& Out5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib040_Fn068 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn068();
+	/** Benchmark callable node Lib040_Fn069 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn069(bool In0, UObject* In1, FVector& Out2, int32 In3, const FString& In4, FVector& Out5, FVector& Out6, int32 In7);
+	/** Benchmark pure node Lib040_Fn070 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn070(UObject* In0, const TArray< int32 >& In1, int32 In2, const FVector& In3, FName In4, const FVector& In5);
+	/** Benchmark callable node Lib040_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn071(bool In0, int32 In1, int32 In2, float In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib040_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn072(const TArray< int32 >& In0, bool In1, int32& Out2, int32 In3, const FString& In4, int32 In5);
+	/** Benchmark callable node Lib040_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn073(int32 In0);
+	/** Benchmark callable node Lib040_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn074(FVector& Out0, int32& Out1, float In2, FVector& Out3);
+	/** Benchmark callable node Lib040_Fn075 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn075(const FTransform& In0, FName In1, FString& Out2, int32 In3, FName In4, bool In5);
+	/** Benchmark callable node Lib040_Fn076 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn076(bool In0, int32& Out1, const FString& In2, UObject* In3, const FString& In4, const FTransform& In5, float In6, FVector& Out7);
+	/** Benchmark pure node Lib040_Fn077 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn077(const FVector& In0, const FTransform& In1, const FVector& In2);
+	/** Benchmark latent node Lib040_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib040_Fn078(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1, int32& Out2, const TArray< int32 >& In3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib040_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn079();
+	/** Benchmark callable node Lib040_Fn080 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn080(UObject* In0, int32 In1);
+	/** Benchmark callable node Lib040_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn081();
+	/** Benchmark callable node Lib040_Fn082 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn082(const FTransform& In0, int32 In1);
+	/** Benchmark pure node Lib040_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn083(FVector& Out0, FString& Out1, const TArray< int32 >& In2, int32& Out3, FName In4);
+	/** Benchmark callable node Lib040_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn084(UObject* In0, float In1, int32& Out2, const TArray< int32 >& In3, FString& Out4);
+	/** Benchmark callable node Lib040_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn085(UObject* In0, const TArray< int32 >& In1, bool In2, const FTransform& In3, FVector& Out4, int32 In5, bool In6);
+	/** Benchmark pure node Lib040_Fn086 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn086(FString& Out0, int32& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib040_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn087();
+	/** Benchmark callable node Lib040_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn088();
+	/** Benchmark callable node Lib040_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FString Lib040_Fn089(int32 In0, const FVector& In1, const FTransform& In2, int32 In3);
+	/** Benchmark callable node Lib040_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn090(FName In0);
+	/** Benchmark pure node Lib040_Fn091 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn091(int32& Out0, const FVector& In1);
+	/** Benchmark pure node Lib040_Fn092 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static bool Lib040_Fn092(float In0, UObject* In1, FString& Out2);
+	/** Benchmark pure node Lib040_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn093(int32 In0, int32 In1, UObject* In2, bool In3, int32& Out4, const FVector& In5, const FString& In6, FString& Out7);
+	/** Benchmark callable node Lib040_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn094(bool In0, int32 In1, int32 In2, FName In3, const FTransform& In4);
+	/** Benchmark pure node Lib040_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn095(const FTransform& In0, FName In1, bool In2, int32& Out3, const FString& In4, const FVector& In5, FVector& Out6, FName In7);
+	/** Benchmark callable node Lib040_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static void Lib040_Fn096(float In0, const FString& In1, FString& Out2, int32& Out3, FName In4, UObject* In5);
+	/** Benchmark callable node Lib040_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static int32 Lib040_Fn097(bool In0, FName In1, int32& Out2, const FVector& In3, const FString& In4, const FTransform& In5, UObject* In6);
+	/** Benchmark callable node Lib040_Fn098 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib040")
+	static FVector Lib040_Fn098(int32 In0, const FVector& In1, int32 In2, FName In3);
+	/** Benchmark pure node Lib040_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib040")
+	static float Lib040_Fn099(int32 In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_041 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib041_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn000(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib041_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn001(const TArray< int32 >& In0, FString& Out1, const FString& In2, const FString& In3, const FTransform& In4, FString& Out5);
+	/** Benchmark callable node Lib041_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn002(int32& Out0, int32 In1, FString& Out2, FString& Out3, UObject* In4, float In5, const TArray< int32 >& In6, const FVector& In7);
+	/** Benchmark callable node Lib041_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn003(const FVector& In0, FVector& Out1, int32& Out2, const TArray< int32 >& In3, UObject* In4, const FVector& In5, FVector& Out6);
+	/** Benchmark callable node Lib041_Fn004 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn004(bool In0, bool In1, const FVector& In2, int32 In3, int32& Out4, bool In5);
+	/** Benchmark callable node Lib041_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn005(UObject* In0, bool In1, const FTransform& In2, FName In3);
+	/** Benchmark callable node Lib041_Fn006 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn006();
+	/** Benchmark callable node Lib041_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn007(FName In0, FVector& Out1, FVector& Out2, UObject* In3, bool In4);
+	/** Benchmark callable node Lib041_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn008(const FVector& In0, FVector& Out1, const FTransform& In2, const FVector& In3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib041_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn009(FName In0, FName In1, FString& Out2);
+	/** Benchmark pure node Lib041_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn010();
+	/** Benchmark callable node Lib041_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn011(FVector& Out0);
+	/** Benchmark callable node Lib041_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn012(FString& Out0, UObject* In1, bool In2, int32 In3, bool In4, int32& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib041_Fn013 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn013(int32 In0);
+	/** Benchmark pure node Lib041_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn014(int32& Out0, FName In1, float In2, FVector& Out3, int32& Out4, FString& Out5, int32& Out6);
+	/** Benchmark callable node Lib041_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn015(int32& Out0, FName In1, FVector& Out2, FName In3, float In4, UObject* In5, int32 In6, int32& Out7);
+	/** Benchmark pure node Lib041_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn016(bool In0, bool In1, int32 In2, const FVector& In3, const FTransform& In4);
+	/** Benchmark callable node Lib041_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn017(const TArray< int32 >& In0, const FTransform& In1, int32& Out2);
+	/** Benchmark callable node Lib041_Fn018 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn018(FString& Out0, FString& Out1, FString& Out2);
+	/** Benchmark callable node Lib041_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn019();
+	/** Benchmark callable node Lib041_Fn020 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn020();
+	/** Benchmark callable node Lib041_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn021(float In0, int32& Out1);
+	/** Benchmark callable node Lib041_Fn022 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn022(int32& Out0, FName In1, FString& Out2, float In3, bool In4, FString& Out5);
+	/** Benchmark callable node Lib041_Fn023 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn023(const TArray< int32 >& In0, FName In1, int32 In2, bool In3, bool In4, int32& Out5);
+	/** Benchmark pure node Lib041_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn024(const FTransform& In0);
+	/** Benchmark callable node Lib041_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn025(int32& Out0, bool In1);
+	/** Benchmark callable node Lib041_Fn026 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn026(FName In0);
+	/** Benchmark pure node Lib041_Fn027 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn027(UObject* In0, const TArray< int32 >& In1, const FTransform& In2, FString& Out3, UObject* In4);
+	/** Benchmark callable node Lib041_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn028(const FVector& In0, UObject* In1, const TArray< int32 >& In2, FString& Out3, UObject* In4, UObject* In5, FString& Out6);
+	/** Benchmark callable node Lib041_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn029();
+	/** Benchmark latent node Lib041_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib041_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FVector& In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib041_Fn031 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn031(FString& Out0, float In1, bool In2, FString& Out3, const FVector& In4, const FTransform& In5, const FVector& In6, bool In7);
+	/** Benchmark pure node Lib041_Fn032 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn032(FString& Out0, const FTransform& In1);
+	/** Benchmark callable node Lib041_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn033(int32& Out0, FVector& Out1, const FVector& In2, float In3, FName In4);
+	/** Benchmark callable node Lib041_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn034(FString& Out0, float In1, const FTransform& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib041_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn035(int32 In0, FVector& Out1, int32 In2, UObject* In3, int32 In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib041_Fn036 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn036();
+	/** Benchmark pure node Lib041_Fn037 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn037(int32& Out0, float In1, FName In2, float In3, const FVector& In4, int32 In5);
+	/** Benchmark callable node Lib041_Fn038 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn038(FName In0, const FString& In1);
+	/** Benchmark callable node Lib041_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn039(int32& Out0, FString& Out1);
+	/** Benchmark callable node Lib041_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn040(int32 In0, const FString& In1, float In2, FName In3);
+	/** Benchmark pure node Lib041_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn041(float In0, const FString& In1, int32& Out2);
+	/** Benchmark callable node Lib041_Fn042 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn042(FVector& Out0);
+	/** Benchmark pure node Lib041_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn043(const FString& In0, UObject* In1, int32 In2, const FTransform& In3, const FTransform& In4, bool In5);
+	/** Benchmark pure node Lib041_Fn044 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn044(UObject* In0, const TArray< int32 >& In1, int32 In2, UObject* In3);
+	/** Benchmark callable node Lib041_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn045(const FString& In0, const FString& In1, FName In2, const FVector& In3, UObject* In4, int32 In5, float In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib041_Fn046 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn046(int32 In0, const FString& In1, const FVector& In2, FVector& Out3, UObject* In4);
+	/** Benchmark callable node Lib041_Fn047 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn047(int32 In0, const FString& In1, FVector& Out2, FName In3);
+	/** Benchmark pure node Lib041_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn048();
+	/** Benchmark pure node Lib041_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn049(const FString& In0, const FVector& In1, FVector& Out2, int32 In3, FName In4, float In5);
+	/** Benchmark pure node Lib041_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn050(const FVector& In0, bool In1, bool In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib041_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn051(float In0);
+	/** Benchmark callable node Lib041_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn052(FString& Out0, int32& Out1, const TArray< int32 >& In2, const FString& In3, const FString& In4, const TArray< int32 >& In5, UObject* In6);
+	/** Benchmark pure node Lib041_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn053();
+	/** Benchmark callable node Lib041_Fn054 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn054(bool In0, const FVector& In1, FName In2, const FVector& In3, FString& Out4);
+	/** Benchmark callable node Lib041_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn055();
+	/** Benchmark callable node Lib041_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn056(UObject* In0, const FTransform& In1, const FVector& In2, FName In3);
+	/** Benchmark callable node Lib041_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn057(const FString& In0, FName In1, float In2, const FVector& In3, const TArray< int32 >& In4, float In5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark pure node Lib041_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn058(int32& Out0, int32& Out1, int32& Out2, const TArray< int32 >& In3, FName In4, int32 In5);
+	/** Benchmark callable node Lib041_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn059(const FString& In0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib041_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn060();
+	/** Benchmark pure node Lib041_Fn061 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn061(int32& Out0, int32 In1, bool In2, FVector& Out3, const FString& In4);
+	/** Benchmark callable node Lib041_Fn062 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn062();
+	/** Benchmark pure node Lib041_Fn063 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn063();
+	/** Benchmark pure node Lib041_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn064();
+	/** Benchmark pure node Lib041_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn065(FVector& Out0, const FTransform& In1, FName In2, const FString& In3, const TArray< int32 >& In4, bool In5);
+	/** Benchmark callable node Lib041_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn066();
+	/** Benchmark pure node Lib041_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn067(const FTransform& In0, int32 In1);
+	/** Benchmark callable node Lib041_Fn068 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn068(float In0, FName In1, UObject* In2, FVector& Out3, FString& Out4, const FTransform& In5, UObject* In6);
+	/** Benchmark callable node Lib041_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn069(bool In0, const FVector& In1, const FTransform& In2, FVector& Out3);
+	/** Benchmark callable node Lib041_Fn070 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn070(FName In0, UObject* In1);
+	/** Benchmark callable node Lib041_Fn071 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn071(FName In0, const FString& In1);
+	/** Benchmark latent node Lib041_Fn072 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib041_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, UObject* In1);
+	/** Benchmark pure node Lib041_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn073(int32 In0, const TArray< int32 >& In1, const FVector& In2, const FTransform& In3, FName In4, UObject* In5, bool In6, const FVector& In7);
+	/** Benchmark callable node Lib041_Fn074 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn074(const FString& In0, UObject* In1, const TArray< int32 >& In2, const FTransform& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib041_Fn075 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn075(bool In0, const TArray< int32 >& In1, bool In2, UObject* In3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib041_Fn076 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn076();
+	/** Benchmark pure node Lib041_Fn077 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn077(float In0, const FString& In1, UObject* In2, int32& Out3);
+	/** Benchmark callable node Lib041_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn078(FString& Out0, int32 In1, bool In2, float In3, const FTransform& In4);
+	/** Benchmark pure node Lib041_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn079(FString& Out0, UObject* In1);
+	/** Benchmark pure node Lib041_Fn080 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn080(const FString& In0, const FTransform& In1, const FString& In2, FString& Out3, float In4, const FVector& In5);
+	/** Benchmark callable node Lib041_Fn081 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static float Lib041_Fn081(bool In0);
+	/** Benchmark callable node Lib041_Fn082 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn082();
+	/** Benchmark callable node Lib041_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn083(FName In0, UObject* In1, UObject* In2, int32& Out3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib041_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FVector Lib041_Fn084(FName In0, const TArray< int32 >& In1, FVector& Out2);
+	/** Benchmark callable node Lib041_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn085(const TArray< int32 >& In0, FString& Out1, int32& Out2, FVector& Out3, float In4, bool In5, FName In6, const FVector& In7);
+	/** Benchmark callable node Lib041_Fn086 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn086();
+	/** Benchmark callable node Lib041_Fn087 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn087(const TArray< int32 >& In0, FName In1, const TArray< int32 >& In2, FVector& Out3, FString& Out4);
+	/** Benchmark latent node Lib041_Fn088 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib041_Fn088(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib041_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn089(const FTransform& In0, int32 In1);
+	/** Benchmark callable node Lib041_Fn090 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static int32 Lib041_Fn090();
+	/** Benchmark callable node Lib041_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn091(const TArray< int32 >& In0, bool In1, FName In2, int32 In3, const FVector& In4, FVector& Out5);
+	/** Benchmark callable node Lib041_Fn092 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn092(bool In0, UObject* In1, UObject* In2, const FTransform& In3, const FString& In4, FString& Out5, UObject* In6, float In7);
+	/** Benchmark latent node Lib041_Fn093 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib041_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, const FString& In2, bool In3, int32& Out4, FString& Out5, bool In6);
+	/** Benchmark callable node Lib041_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn094(int32 In0, float In1, UObject* In2, FString& Out3, float In4, int32& Out5, bool In6, int32 In7);
+	/** Benchmark callable node Lib041_Fn095 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static void Lib041_Fn095(FName In0, FString& Out1, float In2, float In3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark callable node Lib041_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn096(int32 In0, const FString& In1, const FVector& In2, FVector& Out3, float In4);
+	/** Benchmark callable node Lib041_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn097(float In0, const FString& In1, float In2, FName In3, FString& Out4, bool In5, int32 In6);
+	/** Benchmark pure node Lib041_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static FString Lib041_Fn098(FVector& Out0, const FTransform& In1, FName In2, int32 In3, const TArray< int32 >& In4, int32& Out5, int32& Out6);
+	/** Benchmark pure node Lib041_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib041")
+	static bool Lib041_Fn099(int32 In0, const FString& In1, UObject* In2, UObject* In3);
+};
+
+
+UCLASS()
+class UKDGBenchLib_042 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib042_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn000(const FString& In0, UObject* In1);
+	/** Benchmark callable node Lib042_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn001(FVector& Out0, FVector& Out1, int32& Out2, FString& Out3, FName In4, float In5, float In6);
+	/** Benchmark callable node Lib042_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn002(FString& Out0, const TArray< int32 >& In1, const FTransform& In2);
+	/** Benchmark pure node Lib042_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn003(UObject* In0, FString& Out1, int32& Out2, bool In3, FVector& Out4);
+	/** Benchmark pure node Lib042_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn004(const FVector& In0);
+	/** Benchmark callable node Lib042_Fn005 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn005(const TArray< int32 >& In0, FString& Out1);
+	/** Benchmark callable node Lib042_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn006(int32 In0, UObject* In1, const FTransform& In2);
+	/** Benchmark pure node Lib042_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn007(UObject* In0, FName In1, FVector& Out2, FVector& Out3, UObject* In4);
+	/** Benchmark callable node Lib042_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn008(const FVector& In0, FString& Out1, bool In2, FName In3, FName In4, FString& Out5, int32& Out6, FName In7);
+	/** Benchmark callable node Lib042_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn009(float In0);
+	/** Benchmark callable node Lib042_Fn010 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn010(float In0, const FString& In1, bool In2);
+	/** Benchmark callable node Lib042_Fn011 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn011(bool In0, const FVector& In1, int32& Out2, FString& Out3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark callable node Lib042_Fn012 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn012();
+	/** Benchmark callable node Lib042_Fn013 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn013(float In0);
+	/** Benchmark pure node Lib042_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn014(float In0, const FTransform& In1, FName In2);
+	/** Benchmark callable node Lib042_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn015(FString& Out0, float In1, int32& Out2, int32 In3, FName In4, int32& Out5, int32& Out6, int32& Out7);
+	/** Benchmark callable node Lib042_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn016(const FString& In0, const TArray< int32 >& In1, UObject* In2);
+	/** Benchmark callable node Lib042_Fn017 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn017(const FVector& In0, const TArray< int32 >& In1, int32 In2, FName In3, const FString& In4, const TArray< int32 >& In5, UObject* In6);
+	/** Benchmark callable node Lib042_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn018(FName In0);
+	/** Benchmark pure node Lib042_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn019();
+	/** Benchmark pure node Lib042_Fn020 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn020();
+	/** Benchmark callable node Lib042_Fn021 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn021(const FTransform& In0, const TArray< int32 >& In1, const FVector& In2, bool In3, const FString& In4, FName In5, const FTransform& In6);
+	/** Benchmark callable node Lib042_Fn022 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn022(const FString& In0, float In1, float In2, UObject* In3, const FVector& In4);
+	/** Benchmark pure node Lib042_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn023();
+	/** Benchmark latent node Lib042_Fn024 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib042_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib042_Fn025 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn025();
+	/** Benchmark callable node Lib042_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn026(const TArray< int32 >& In0, UObject* In1, const TArray< int32 >& In2, int32 In3, const FString& In4);
+	/** Benchmark pure node Lib042_Fn027 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn027(FName In0, FName In1, int32 In2, const FVector& In3, const FVector& In4, const FString& In5, int32& Out6, float In7);
+	/** Benchmark callable node Lib042_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn028(UObject* In0, float In1);
+	/** Benchmark pure node Lib042_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn029(const FString& In0);
+	/** Benchmark pure node Lib042_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn030(FName In0, int32 In1, FString& Out2, UObject* In3, bool In4, bool In5, FVector& Out6, int32& Out7);
+	/** Benchmark callable node Lib042_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn031(int32& Out0, FString& Out1, int32& Out2, int32& Out3, UObject* In4, const FString& In5, UObject* In6);
+	/** Benchmark callable node Lib042_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn032(const FTransform& In0, const FVector& In1, const FVector& In2, FString& Out3, FVector& Out4, int32& Out5, int32 In6, int32 In7);
+	/** Benchmark pure node Lib042_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn033();
+	/** Benchmark callable node Lib042_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn034(bool In0, float In1, bool In2, bool In3, const FVector& In4, int32 In5, const FVector& In6);
+	/** Benchmark callable node Lib042_Fn035 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn035(FString& Out0, const FTransform& In1, const FVector& In2, int32& Out3, float In4, const FVector& In5, FString& Out6);
+	/** Benchmark pure node Lib042_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn036(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib042_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn037();
+	/** Benchmark callable node Lib042_Fn038 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn038(bool In0, int32& Out1, FVector& Out2, FString& Out3, const FTransform& In4);
+	/** Benchmark latent node Lib042_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib042_Fn039(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FVector& In1, float In2, int32& Out3, const FString& In4);
+	/** Benchmark callable node Lib042_Fn040 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn040(bool In0);
+	/** Benchmark pure node Lib042_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn041(const FVector& In0, float In1, float In2, bool In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib042_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn042(const FString& In0, const FString& In1, float In2);
+	/** Benchmark callable node Lib042_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn043();
+	/** Benchmark callable node Lib042_Fn044 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn044(int32 In0);
+	/** Benchmark pure node Lib042_Fn045 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn045(const FString& In0, UObject* In1, const TArray< int32 >& In2, bool In3, FString& Out4, int32 In5);
+	/** Benchmark callable node Lib042_Fn046 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn046(int32 In0, FVector& Out1, UObject* In2, UObject* In3);
+	/** Benchmark callable node Lib042_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn047(int32 In0, int32 In1, float In2, const FTransform& In3, const FTransform& In4, FString& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib042_Fn048 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn048(FVector& Out0, const FVector& In1, int32& Out2, bool In3, float In4, UObject* In5);
+	/** Benchmark callable node Lib042_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn049(const FVector& In0, int32 In1, FName In2, const TArray< int32 >& In3, float In4, FString& Out5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib042_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn050(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib042_Fn051 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn051(int32 In0, int32& Out1, int32 In2, const TArray< int32 >& In3, const TArray< int32 >& In4, FVector& Out5, FVector& Out6);
+	/** Benchmark callable node Lib042_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn052(UObject* In0, int32 In1);
+	/** Benchmark callable node Lib042_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn053(const FTransform& In0, UObject* In1);
+	/** Benchmark pure node Lib042_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn054(const FTransform& In0, const FString& In1, FName In2, UObject* In3, FVector& Out4, FName In5);
+	/** Benchmark callable node Lib042_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn055(const FString& In0, int32& Out1, FVector& Out2);
+	/** Benchmark pure node Lib042_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn056(const TArray< int32 >& In0, FName In1, bool In2);
+	/** Benchmark callable node Lib042_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn057(const FVector& In0);
+	/** Benchmark pure node Lib042_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn058(bool In0, const FVector& In1, int32& Out2, float In3, int32& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib042_Fn059 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn059(const FTransform& In0);
+	/** Benchmark latent node Lib042_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib042_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, float In1, float In2, FName In3, FString& Out4, FVector& Out5);
+	/** Benchmark callable node Lib042_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn061(const TArray< int32 >& In0, float In1, const FVector& In2, int32& Out3, const FTransform& In4, FName In5);
+	/** Benchmark pure node Lib042_Fn062 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn062(UObject* In0);
+	/** Benchmark callable node Lib042_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn063(bool In0);
+	/** Benchmark callable node Lib042_Fn064 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn064(const FTransform& In0);
+	/** Benchmark pure node Lib042_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn065(const FTransform& In0);
+	/** Benchmark callable node Lib042_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn066(const FString& In0, bool In1, int32 In2, const FTransform& In3, const FString& In4, FVector& Out5);
+	/** Benchmark pure node Lib042_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn067(FVector& Out0, const FString& In1, const FString& In2, UObject* In3, const FVector& In4);
+	/** Benchmark callable node Lib042_Fn068 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn068(int32& Out0, int32 In1, FString& Out2, FString& Out3);
+	/** Benchmark callable node Lib042_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn069(const FString& In0);
+	/** Benchmark callable node Lib042_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn070(int32 In0, FVector& Out1, const FVector& In2);
+	/** Benchmark callable node Lib042_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn071();
+	/** Benchmark pure node Lib042_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn072(const FTransform& In0, FVector& Out1);
+	/** Benchmark callable node Lib042_Fn073 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn073(const FString& In0, FString& Out1, FVector& Out2, float In3);
+	/** Benchmark callable node Lib042_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn074(UObject* In0);
+	/** Benchmark callable node Lib042_Fn075 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn075();
+	/** Benchmark callable node Lib042_Fn076 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn076(float In0, const TArray< int32 >& In1, const FString& In2, float In3, UObject* In4, const FString& In5);
+	/** Benchmark pure node Lib042_Fn077 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn077(const FString& In0, const FVector& In1, bool In2, const FVector& In3);
+	/** Benchmark callable node Lib042_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn078(float In0, int32& Out1, bool In2, UObject* In3, int32& Out4);
+	/** Benchmark callable node Lib042_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn079(int32& Out0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib042_Fn080 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn080(int32 In0, float In1);
+	/** Benchmark callable node Lib042_Fn081 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn081(UObject* In0);
+	/** Benchmark pure node Lib042_Fn082 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn082(const FVector& In0, FVector& Out1);
+	/** Benchmark callable node Lib042_Fn083 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn083(int32& Out0, int32& Out1, const FVector& In2, const FTransform& In3, int32& Out4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib042_Fn084 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib042_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1);
+	/** Benchmark callable node Lib042_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn085(FName In0, const FVector& In1, FString& Out2, int32 In3);
+	/** Benchmark callable node Lib042_Fn086 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn086(UObject* In0);
+	/** Benchmark pure node Lib042_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn087();
+	/** Benchmark callable node Lib042_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FString Lib042_Fn088(const FString& In0, float In1, const TArray< int32 >& In2, const FVector& In3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib042_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn089(FVector& Out0, const FVector& In1, float In2);
+	/** Benchmark callable node Lib042_Fn090 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn090();
+	/** Benchmark callable node Lib042_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static void Lib042_Fn091(const FVector& In0, const FVector& In1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib042_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static int32 Lib042_Fn092(const FString& In0, const FString& In1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib042_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn093(float In0, const FString& In1, bool In2, FVector& Out3);
+	/** Benchmark callable node Lib042_Fn094 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static float Lib042_Fn094(const FString& In0, UObject* In1, const FVector& In2, int32 In3, int32 In4, FName In5);
+	/** Benchmark callable node Lib042_Fn095 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static bool Lib042_Fn095(int32& Out0);
+	/** Benchmark callable node Lib042_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn096(const FVector& In0, FName In1);
+	/** Benchmark callable node Lib042_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042")
+	static FVector Lib042_Fn097(UObject* In0, FName In1, FVector& Out2, const TArray< int32 >& In3, float In4, UObject* In5);
+	/** Benchmark latent node Lib042_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib042_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib042_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib042", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib042_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_043 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib043_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn000(FString& Out0, FVector& Out1, int32 In2, bool In3, FVector& Out4, const TArray< int32 >& In5, UObject* In6, const FString& In7);
+	/** Benchmark pure node Lib043_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn001(int32& Out0, int32 In1, float In2, FName In3);
+	/** Benchmark callable node Lib043_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn002(const FTransform& In0, const FTransform& In1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark latent node Lib043_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1);
+	/** Benchmark callable node Lib043_Fn004 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn004(const FTransform& In0, const FVector& In1, FVector& Out2, const FString& In3, FVector& Out4, const FTransform& In5, FName In6);
+	/** Benchmark callable node Lib043_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn005(int32 In0, int32 In1, bool In2, const FVector& In3);
+	/** Benchmark callable node Lib043_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn006(const FVector& In0, UObject* In1);
+	/** Benchmark callable node Lib043_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn007(const TArray< int32 >& In0, bool In1, const FTransform& In2, int32& Out3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib043_Fn008 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn008(int32& Out0, int32& Out1, FVector& Out2);
+	/** Benchmark callable node Lib043_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn009(FString& Out0, const FString& In1, FString& Out2, FVector& Out3);
+	/** Benchmark callable node Lib043_Fn010 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn010(FString& Out0, const FVector& In1, float In2);
+	/** Benchmark pure node Lib043_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn011(int32& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FVector& In3, bool In4, UObject* In5, UObject* In6);
+	/** Benchmark callable node Lib043_Fn012 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn012(bool In0, FVector& Out1, FString& Out2, FVector& Out3, int32& Out4);
+	/** Benchmark pure node Lib043_Fn013 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn013(UObject* In0, bool In1, float In2, int32 In3, FName In4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib043_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn014(FVector& Out0, const FTransform& In1, const FVector& In2, FVector& Out3);
+	/** Benchmark callable node Lib043_Fn015 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn015(bool In0, int32& Out1, bool In2, const FVector& In3, const FTransform& In4);
+	/** Benchmark callable node Lib043_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn016(float In0, const FTransform& In1, bool In2, int32 In3, FVector& Out4);
+	/** Benchmark callable node Lib043_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn017(FVector& Out0, const FVector& In1, FVector& Out2, int32 In3, const FString& In4, FString& Out5);
+	/** Benchmark pure node Lib043_Fn018 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn018(const TArray< int32 >& In0, FString& Out1, UObject* In2, int32& Out3, UObject* In4, FName In5, const FTransform& In6, const FVector& In7);
+	/** Benchmark callable node Lib043_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn019(const FVector& In0, bool In1, FVector& Out2, int32 In3, const FTransform& In4, const FString& In5);
+	/** Benchmark latent node Lib043_Fn020 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FTransform& In1, UObject* In2, FVector& Out3, int32 In4, const TArray< int32 >& In5, const FVector& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib043_Fn021 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn021(const FTransform& In0, FString& Out1, float In2, const TArray< int32 >& In3, const FTransform& In4);
+	/** Benchmark pure node Lib043_Fn022 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn022(int32 In0);
+	/** Benchmark callable node Lib043_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn023(bool In0, FName In1, int32& Out2, FString& Out3, int32 In4);
+	/** Benchmark pure node Lib043_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn024(float In0, UObject* In1, FString& Out2, bool In3, int32 In4, float In5, int32 In6, bool In7);
+	/** Benchmark callable node Lib043_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn025(FString& Out0, FName In1, int32& Out2, bool In3, bool In4, const TArray< int32 >& In5, FString& Out6, float In7);
+	/** Benchmark callable node Lib043_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn026(bool In0, const FTransform& In1, int32 In2, int32& Out3, const FVector& In4, const FVector& In5, const FTransform& In6, FVector& Out7);
+	/** Benchmark latent node Lib043_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1);
+	/** Benchmark callable node Lib043_Fn028 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn028(bool In0, int32 In1, FName In2, int32 In3, FName In4, const FString& In5, const FString& In6, int32& Out7);
+	/** Benchmark callable node Lib043_Fn029 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn029(int32 In0, FString& Out1, FName In2, const TArray< int32 >& In3, UObject* In4, const FString& In5, FVector& Out6);
+	/** Benchmark callable node Lib043_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn030(UObject* In0, FVector& Out1);
+	/** Benchmark pure node Lib043_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn031(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib043_Fn032 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn032(float In0, int32& Out1, float In2, const FTransform& In3, int32& Out4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib043_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn033();
+	/** Benchmark callable node Lib043_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn034(UObject* In0, FString& Out1);
+	/** Benchmark pure node Lib043_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn035(UObject* In0, FString& Out1, FName In2, const FVector& In3, const FString& In4, FString& Out5, int32& Out6, const FVector& In7);
+	/** Benchmark callable node Lib043_Fn036 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn036(FString& Out0, int32 In1, const FTransform& In2, const FVector& In3, bool In4, bool In5, UObject* In6);
+	/** Benchmark pure node Lib043_Fn037 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn037(bool In0, FVector& Out1, UObject* In2, const FTransform& In3, FString& Out4, bool In5);
+	/** Benchmark callable node Lib043_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn038(const FTransform& In0);
+	/** Benchmark pure node Lib043_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn039(const FTransform& In0, const FTransform& In1, UObject* In2, UObject* In3, const TArray< int32 >& In4, const FVector& In5, FVector& Out6);
+	/** Benchmark pure node Lib043_Fn040 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn040(UObject* In0, int32& Out1, int32 In2);
+	/** Benchmark callable node Lib043_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn041(FString& Out0, FString& Out1, float In2, int32 In3, const FString& In4, float In5);
+	/** Benchmark callable node Lib043_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn042();
+	/** Benchmark callable node Lib043_Fn043 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn043(FString& Out0, float In1);
+	/** Benchmark callable node Lib043_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn044(FString& Out0, float In1, float In2, const FTransform& In3, float In4, int32 In5);
+	/** Benchmark latent node Lib043_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1, float In2, const FTransform& In3, int32 In4, int32 In5);
+	/** Benchmark pure node Lib043_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn046(float In0);
+	/** Benchmark callable node Lib043_Fn047 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn047(float In0, int32 In1, bool In2, float In3);
+	/** Benchmark callable node Lib043_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn048(FVector& Out0, UObject* In1, int32 In2, FString& Out3);
+	/** Benchmark latent node Lib043_Fn049 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, FString& Out1, const FVector& In2, bool In3, const TArray< int32 >& In4, int32& Out5, float In6, int32 In7);
+	/** Benchmark callable node Lib043_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn050(FString& Out0, const TArray< int32 >& In1, bool In2, UObject* In3, UObject* In4, const FString& In5);
+	/** Benchmark pure node Lib043_Fn051 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn051(FName In0, float In1, const FTransform& In2);
+	/** Benchmark latent node Lib043_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib043_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn053(const FVector& In0, int32& Out1, int32& Out2);
+	/** Benchmark callable node Lib043_Fn054 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn054(const FVector& In0, const FString& In1, int32& Out2, FString& Out3);
+	/** Benchmark callable node Lib043_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn055(const FVector& In0, int32& Out1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib043_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn056(const FVector& In0, FName In1, FVector& Out2, const TArray< int32 >& In3, FName In4, float In5, const FTransform& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib043_Fn057 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn057(UObject* In0, const FTransform& In1);
+	/** Benchmark callable node Lib043_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn058(int32 In0, bool In1, FString& Out2, FName In3, UObject* In4);
+	/** Benchmark callable node Lib043_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn059(const FVector& In0, const FTransform& In1, int32 In2, FVector& Out3, const TArray< int32 >& In4, float In5, FString& Out6, const FVector& In7);
+	/** Benchmark callable node Lib043_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn060(const TArray< int32 >& In0, const FString& In1);
+	/** Benchmark callable node Lib043_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn061(const FVector& In0, int32& Out1, bool In2, FVector& Out3);
+	/** Benchmark pure node Lib043_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn062(const FString& In0, const TArray< int32 >& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib043_Fn063 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn063(int32& Out0, const FString& In1, int32& Out2, float In3, FString& Out4, const FTransform& In5, FString& Out6);
+	/** Benchmark callable node Lib043_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn064(FString& Out0, const FString& In1, const FTransform& In2, UObject* In3, const FTransform& In4, const FString& In5, int32& Out6, UObject* In7);
+	/** Benchmark callable node Lib043_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn065(FString& Out0, FName In1);
+	/** Benchmark callable node Lib043_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn066(const FString& In0, const TArray< int32 >& In1, bool In2, const FString& In3);
+	/** Benchmark callable node Lib043_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn067(FName In0, FVector& Out1);
+	/** Benchmark callable node Lib043_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn068(const FString& In0, int32 In1, int32 In2);
+	/** Benchmark callable node Lib043_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn069(int32& Out0, int32 In1, const FTransform& In2, UObject* In3);
+	/** Benchmark callable node Lib043_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn070(const TArray< int32 >& In0, FName In1, FName In2);
+	/** Benchmark callable node Lib043_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn071(const FString& In0);
+	/** Benchmark callable node Lib043_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn072(FVector& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib043_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FVector Lib043_Fn073(const TArray< int32 >& In0);
+	/** Benchmark latent node Lib043_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, float In1, int32& Out2, FVector& Out3);
+	/** Benchmark callable node Lib043_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn075(int32& Out0, const FTransform& In1);
+	/** Benchmark pure node Lib043_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn076(FVector& Out0, const FTransform& In1);
+	/** Benchmark callable node Lib043_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn077(FString& Out0, FString& Out1, FName In2, int32& Out3, const TArray< int32 >& In4, FString& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib043_Fn078 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn078(FName In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark callable node Lib043_Fn079 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn079(const TArray< int32 >& In0, int32& Out1, float In2, UObject* In3, FVector& Out4, int32& Out5, const FTransform& In6, int32 In7);
+	/** Benchmark callable node Lib043_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn080(int32& Out0, FString& Out1, UObject* In2, bool In3, UObject* In4);
+	/** Benchmark callable node Lib043_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn081(int32 In0, FVector& Out1, FName In2, const FVector& In3, const FString& In4, FVector& Out5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib043_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn082(const FVector& In0, bool In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4, const FString& In5, float In6);
+	/** Benchmark callable node Lib043_Fn083 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn083(const FTransform& In0);
+	/** Benchmark callable node Lib043_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn084(UObject* In0, const FTransform& In1, FVector& Out2);
+	/** Benchmark callable node Lib043_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static float Lib043_Fn085(const FString& In0, const FVector& In1, UObject* In2, float In3);
+	/** Benchmark callable node Lib043_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn086(int32 In0, const TArray< int32 >& In1, const FString& In2, int32 In3, UObject* In4);
+	/** Benchmark latent node Lib043_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn087(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0);
+	/** Benchmark pure node Lib043_Fn088 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn088(UObject* In0, FString& Out1);
+	/** Benchmark callable node Lib043_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn089(int32& Out0, int32& Out1, const FString& In2);
+	/** Benchmark pure node Lib043_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn090(int32 In0, int32 In1);
+	/** Benchmark callable node Lib043_Fn091 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn091(float In0, FVector& Out1, bool In2, FString& Out3, const FVector& In4, const FTransform& In5, const TArray< int32 >& In6, FName In7);
+	/** Benchmark pure node Lib043_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn092(FString& Out0, bool In1, const FString& In2, FString& Out3);
+	/** Benchmark callable node Lib043_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn093(FString& Out0, float In1, UObject* In2, const FVector& In3, const FString& In4, const FVector& In5);
+	/** Benchmark pure node Lib043_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static FString Lib043_Fn094(const FTransform& In0, int32 In1);
+	/** Benchmark callable node Lib043_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static bool Lib043_Fn095(const FString& In0, const FVector& In1, int32& Out2, float In3, FString& Out4);
+	/** Benchmark pure node Lib043_Fn096 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn096(const FTransform& In0, float In1, int32& Out2, const FString& In3);
+	/** Benchmark pure node Lib043_Fn097 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib043")
+	static int32 Lib043_Fn097(FVector& Out0, FString& Out1, UObject* In2, const FVector& In3, FName In4);
+	/** Benchmark callable node Lib043_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043")
+	static void Lib043_Fn098(const FVector& In0, const TArray< int32 >& In1, float In2, const FVector& In3, const FString& In4);
+	/** Benchmark latent node Lib043_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib043", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib043_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+};
+
+
+UCLASS()
+class UKDGBenchLib_044 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib044_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn000(bool In0, int32& Out1, FName In2);
+	/** Benchmark pure node Lib044_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn001(FVector& Out0, FName In1, FName In2);
+	/** Benchmark callable node Lib044_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn002();
+	/** Benchmark callable node Lib044_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn003(FName In0, FString& Out1, const FString& In2, int32 In3, const FString& In4, int32& Out5);
+	/** Benchmark callable node Lib044_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn004(FVector& Out0, int32 In1);
+	/** Benchmark callable node Lib044_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn005(float In0);
+	/** Benchmark callable node Lib044_Fn006 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn006(FString& Out0, UObject* In1, const FVector& In2, const TArray< int32 >& In3, bool In4, int32& Out5, const FString& In6, int32& Out7);
+	/** Benchmark callable node Lib044_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn007(int32 In0, const FVector& In1, FString& Out2, float In3, FName In4, FVector& Out5, int32 In6);
+	/** Benchmark latent node Lib044_Fn008 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn008(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0);
+	/** Benchmark callable node Lib044_Fn009 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static void Lib044_Fn009();
+	/** Benchmark callable node Lib044_Fn010 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn010(int32 In0, FName In1, const FString& In2, bool In3, float In4, FVector& Out5, const FTransform& In6, int32& Out7);
+	/** Benchmark latent node Lib044_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FString& In1, const FTransform& In2, const FTransform& In3, FName In4, FName In5);
+	/** Benchmark pure node Lib044_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn012(FName In0, int32 In1, int32& Out2, int32& Out3, int32 In4, const FTransform& In5, FVector& Out6, const FVector& In7);
+	/** Benchmark callable node Lib044_Fn013 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn013();
+	/** Benchmark callable node Lib044_Fn014 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn014(const TArray< int32 >& In0, UObject* In1, const FString& In2, bool In3, int32 In4, const FString& In5, const FString& In6, bool In7);
+	/** Benchmark callable node Lib044_Fn015 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn015();
+	/** Benchmark callable node Lib044_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn016(FString& Out0, FString& Out1, const TArray< int32 >& In2, int32 In3, const TArray< int32 >& In4);
+	/** Benchmark latent node Lib044_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, bool In1);
+	/** Benchmark callable node Lib044_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn018(const FString& In0, int32& Out1, FVector& Out2, bool In3, bool In4, float In5, int32 In6);
+	/** Benchmark callable node Lib044_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn019(FVector& Out0, FName In1, const FTransform& In2, FVector& Out3);
+	/** Benchmark pure node Lib044_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn020(FVector& Out0, const FString& In1, const FTransform& In2, FString& Out3, UObject* In4, const FTransform& In5, const FString& In6, int32 In7);
+	/** Benchmark latent node Lib044_Fn021 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const TArray< int32 >& In1, FString& Out2, const FVector& In3, float In4, int32& Out5, int32& Out6, float In7);
+	/** Benchmark callable node Lib044_Fn022 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn022();
+	/** Benchmark callable node Lib044_Fn023 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn023(int32 In0, const FVector& In1, const FTransform& In2, int32& Out3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib044_Fn024 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn024(UObject* In0, const FString& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib044_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn025(FString& Out0, UObject* In1, bool In2, bool In3);
+	/** Benchmark callable node Lib044_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static void Lib044_Fn026(const TArray< int32 >& In0, int32 In1, FVector& Out2, FName In3);
+	/** Benchmark callable node Lib044_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn027(int32 In0);
+	/** Benchmark callable node Lib044_Fn028 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn028(const FTransform& In0, const FString& In1, float In2, int32& Out3, UObject* In4);
+	/** Benchmark callable node Lib044_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn029(const FString& In0, bool In1, const FTransform& In2, const FString& In3, float In4, bool In5, FVector& Out6, float In7);
+	/** Benchmark callable node Lib044_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn030(int32& Out0, float In1, FVector& Out2, int32& Out3, FString& Out4, int32 In5, FString& Out6);
+	/** Benchmark callable node Lib044_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static void Lib044_Fn031(int32 In0, UObject* In1);
+	/** Benchmark callable node Lib044_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static void Lib044_Fn032(const FString& In0, float In1, const FTransform& In2);
+	/** Benchmark callable node Lib044_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn033(float In0, bool In1, FString& Out2);
+	/** Benchmark latent node Lib044_Fn034 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FVector& In1, float In2, int32 In3, FName In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib044_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn035(const FString& In0);
+	/** Benchmark pure node Lib044_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn036(FName In0);
+	/** Benchmark latent node Lib044_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const TArray< int32 >& In1, int32 In2, int32 In3, float In4);
+	/** Benchmark callable node Lib044_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn038();
+	/** Benchmark callable node Lib044_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static void Lib044_Fn039(const TArray< int32 >& In0, float In1, float In2, int32 In3, const FString& In4, float In5, const FString& In6);
+	/** Benchmark pure node Lib044_Fn040 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn040(const FTransform& In0, bool In1);
+	/** Benchmark latent node Lib044_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib044_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn042(FName In0, const FTransform& In1, FName In2, FVector& Out3, int32 In4, bool In5, FVector& Out6);
+	/** Benchmark latent node Lib044_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0);
+	/** Benchmark callable node Lib044_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn044();
+	/** Benchmark callable node Lib044_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn045(const FTransform& In0, FString& Out1);
+	/** Benchmark callable node Lib044_Fn046 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn046();
+	/** Benchmark callable node Lib044_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn047(const FString& In0, const FVector& In1, int32 In2);
+	/** Benchmark callable node Lib044_Fn048 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn048(FName In0, FString& Out1, int32 In2, float In3, FName In4);
+	/** Benchmark callable node Lib044_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn049(FName In0, FVector& Out1, const FVector& In2);
+	/** Benchmark callable node Lib044_Fn050 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn050(int32 In0, FString& Out1, bool In2, int32& Out3, const TArray< int32 >& In4, int32& Out5, const TArray< int32 >& In6, float In7);
+	/** Benchmark callable node Lib044_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn051(FName In0);
+	/** Benchmark callable node Lib044_Fn052 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn052(FString& Out0);
+	/** Benchmark callable node Lib044_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn053(const TArray< int32 >& In0, int32 In1);
+	/** Benchmark pure node Lib044_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn054(FString& Out0, FString& Out1, const FVector& In2, const FTransform& In3, FVector& Out4, const FTransform& In5, const FString& In6);
+	/** Benchmark callable node Lib044_Fn055 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn055(int32& Out0, FString& Out1, UObject* In2, FVector& Out3, const FTransform& In4, bool In5);
+	/** Benchmark pure node Lib044_Fn056 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn056(int32 In0, float In1, int32& Out2, FVector& Out3, FName In4);
+	/** Benchmark callable node Lib044_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn057(UObject* In0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3, UObject* In4, int32& Out5, UObject* In6);
+	/** Benchmark callable node Lib044_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn058(const FVector& In0, const TArray< int32 >& In1, const FVector& In2, UObject* In3);
+	/** Benchmark callable node Lib044_Fn059 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn059();
+	/** Benchmark callable node Lib044_Fn060 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn060(float In0, bool In1, float In2, FString& Out3, UObject* In4, UObject* In5, FName In6);
+	/** Benchmark callable node Lib044_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn061(int32& Out0, const FVector& In1, const FVector& In2, const FTransform& In3);
+	/** Benchmark pure node Lib044_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn062(const FVector& In0, bool In1, float In2);
+	/** Benchmark pure node Lib044_Fn063 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn063(FString& Out0, const FTransform& In1, const TArray< int32 >& In2, FString& Out3, const FTransform& In4, int32 In5);
+	/** Benchmark callable node Lib044_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn064(const FTransform& In0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib044_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn065(FName In0, bool In1, int32& Out2, const FVector& In3, const FTransform& In4, int32& Out5);
+	/** Benchmark callable node Lib044_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn066(FString& Out0, const FString& In1, UObject* In2, FName In3, bool In4, float In5);
+	/** Benchmark callable node Lib044_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn067(const FTransform& In0, FName In1);
+	/** Benchmark latent node Lib044_Fn068 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1);
+	/** Benchmark latent node Lib044_Fn069 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, FString& Out1, float In2, const FString& In3, const FTransform& In4, int32& Out5);
+	/** Benchmark callable node Lib044_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn070(UObject* In0, FString& Out1, FString& Out2, FName In3, const TArray< int32 >& In4, FString& Out5, FString& Out6);
+	/** Benchmark callable node Lib044_Fn071 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn071(const FString& In0, float In1, int32 In2, const TArray< int32 >& In3, const FTransform& In4);
+	/** Benchmark latent node Lib044_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib044_Fn073 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn073(FString& Out0, UObject* In1);
+	/** Benchmark callable node Lib044_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn074(FName In0, const FVector& In1, int32 In2, float In3, const FVector& In4, const FTransform& In5, FVector& Out6, bool In7);
+	/** Benchmark callable node Lib044_Fn075 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn075(const TArray< int32 >& In0, bool In1, FVector& Out2, bool In3, bool In4);
+	/** Benchmark callable node Lib044_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn076(const FTransform& In0, float In1, const TArray< int32 >& In2, const FVector& In3, const FVector& In4);
+	/** Benchmark latent node Lib044_Fn077 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FString& Out1, const FString& In2);
+	/** Benchmark pure node Lib044_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn078(const FString& In0, const FTransform& In1, bool In2, int32 In3);
+	/** Benchmark callable node Lib044_Fn079 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn079(bool In0, bool In1, const TArray< int32 >& In2, int32 In3);
+	/** Benchmark pure node Lib044_Fn080 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn080(int32 In0, UObject* In1, float In2, const FTransform& In3, const FTransform& In4, int32 In5, const FVector& In6);
+	/** Benchmark callable node Lib044_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn081(UObject* In0, int32 In1, int32& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib044_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn082(int32 In0, UObject* In1, const FVector& In2, const FTransform& In3, float In4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark latent node Lib044_Fn083 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib044_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, float In1, int32& Out2, const FVector& In3, UObject* In4, FVector& Out5);
+	/** Benchmark pure node Lib044_Fn084 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn084();
+	/** Benchmark pure node Lib044_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn085(int32 In0, FString& Out1, const FTransform& In2, float In3, const FTransform& In4, const FTransform& In5, const FString& In6, const FVector& In7);
+	/** Benchmark callable node Lib044_Fn086 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn086(FVector& Out0, const FTransform& In1, FName In2, FString& Out3, FName In4, const FVector& In5);
+	/** Benchmark callable node Lib044_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static void Lib044_Fn087();
+	/** Benchmark callable node Lib044_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn088(FString& Out0, int32& Out1, const FVector& In2, const FVector& In3, int32& Out4, float In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib044_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static void Lib044_Fn089(int32 In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3, const FString& In4, const FString& In5);
+	/** Benchmark pure node Lib044_Fn090 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn090(bool In0, int32 In1, bool In2, float In3, int32 In4, bool In5);
+	/** Benchmark callable node Lib044_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn091(bool In0, FVector& Out1, const FTransform& In2, float In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib044_Fn092 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static float Lib044_Fn092(FString& Out0, FVector& Out1, int32& Out2, FString& Out3, FName In4);
+	/** Benchmark callable node Lib044_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn093(int32 In0, FName In1, int32 In2, const FString& In3);
+	/** Benchmark pure node Lib044_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn094(FName In0, float In1);
+	/** Benchmark callable node Lib044_Fn095 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static int32 Lib044_Fn095(const FVector& In0, FName In1);
+	/** Benchmark callable node Lib044_Fn096 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn096(int32 In0, UObject* In1, const FString& In2, float In3, const FTransform& In4, FName In5, int32 In6);
+	/** Benchmark pure node Lib044_Fn097 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib044")
+	static FString Lib044_Fn097(int32& Out0);
+	/** Benchmark callable node Lib044_Fn098 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static FVector Lib044_Fn098(bool In0, UObject* In1, const FVector& In2, float In3);
+	/** Benchmark callable node Lib044_Fn099 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib044")
+	static bool Lib044_Fn099();
+};
+
+
+UCLASS()
+class UKDGBenchLib_045 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib045_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn000(const FVector& In0, UObject* In1, UObject* In2, const TArray< int32 >& In3, const FTransform& In4, float In5);
+	/** Benchmark callable node Lib045_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn001(int32 In0, FVector& Out1, float In2, const TArray< int32 >& In3, FName In4, FName In5, int32& Out6);
+	/** Benchmark callable node Lib045_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn002(FString& Out0, FVector& Out1, float In2, const FString& In3, const TArray< int32 >& In4, UObject* In5, const FTransform& In6);
+	/** Benchmark callable node Lib045_Fn003 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn003();
+	/** Benchmark callable node Lib045_Fn004 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn004(const FVector& In0, const TArray< int32 >& In1, FVector& Out2, FString& Out3, FVector& Out4, float In5, const FString& In6);
+	/** Benchmark callable node Lib045_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn005(bool In0, FString& Out1, FVector& Out2, bool In3, FName In4, bool In5, UObject* In6);
+	/** Benchmark callable node Lib045_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn006(int32 In0, FString& Out1, bool In2, const FString& In3);
+	/** Benchmark callable node Lib045_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn007(const FVector& In0, FString& Out1, const FTransform& In2, const TArray< int32 >& In3, const FTransform& In4, const FTransform& In5, const FString& In6);
+	/** Benchmark callable node Lib045_Fn008 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn008(int32& Out0);
+	/** Benchmark callable node Lib045_Fn009 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn009(float In0, const FTransform& In1, float In2, FName In3, FString& Out4);
+	/** Benchmark latent node Lib045_Fn010 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib045_Fn011 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn011(const FVector& In0, FVector& Out1, FVector& Out2, FString& Out3, FName In4, bool In5);
+	/** Benchmark callable node Lib045_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn012(FName In0);
+	/** Benchmark pure node Lib045_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn013(FName In0, bool In1);
+	/** Benchmark callable node Lib045_Fn014 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn014(const TArray< int32 >& In0, FName In1, const FVector& In2, const FTransform& In3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib045_Fn015 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn015(FVector& Out0, int32 In1, FVector& Out2, float In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib045_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn016(UObject* In0, const FString& In1, const FTransform& In2, int32 In3, FName In4, bool In5, const FVector& In6, FVector& Out7);
+	/** Benchmark callable node Lib045_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn017(int32& Out0);
+	/** Benchmark callable node Lib045_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn018(int32& Out0, const FString& In1, const TArray< int32 >& In2, int32 In3, UObject* In4, float In5, const FString& In6);
+	/** Benchmark callable node Lib045_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn019(const FTransform& In0, FVector& Out1, FString& Out2, UObject* In3, FString& Out4, float In5, UObject* In6, int32& Out7);
+	/** Benchmark callable node Lib045_Fn020 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn020(int32& Out0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark pure node Lib045_Fn021 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn021(float In0);
+	/** Benchmark pure node Lib045_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn022(UObject* In0, FVector& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib045_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn023(const FTransform& In0, UObject* In1, float In2);
+	/** Benchmark latent node Lib045_Fn024 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark latent node Lib045_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1, FVector& Out2, FString& Out3);
+	/** Benchmark pure node Lib045_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn026(FVector& Out0, const FTransform& In1);
+	/** Benchmark pure node Lib045_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn027(const FString& In0, float In1, const FTransform& In2, int32& Out3);
+	/** Benchmark pure node Lib045_Fn028 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn028(FVector& Out0, FString& Out1, UObject* In2);
+	/** Benchmark callable node Lib045_Fn029 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn029(int32& Out0, const FString& In1, FName In2, float In3, int32& Out4, const FString& In5, UObject* In6);
+	/** Benchmark pure node Lib045_Fn030 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn030(FString& Out0);
+	/** Benchmark callable node Lib045_Fn031 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn031(bool In0, FVector& Out1, const FTransform& In2, int32& Out3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib045_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn032(float In0, bool In1, UObject* In2, FVector& Out3, const FVector& In4, const FVector& In5, FString& Out6, float In7);
+	/** Benchmark callable node Lib045_Fn033 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn033(int32& Out0, FName In1);
+	/** Benchmark callable node Lib045_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn034(const TArray< int32 >& In0, int32 In1);
+	/** Benchmark callable node Lib045_Fn035 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn035(FString& Out0, int32& Out1, int32 In2, UObject* In3, int32 In4, const FString& In5, bool In6);
+	/** Benchmark callable node Lib045_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn036(UObject* In0);
+	/** Benchmark pure node Lib045_Fn037 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn037(const FVector& In0, float In1, const FTransform& In2);
+	/** Benchmark latent node Lib045_Fn038 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1, const FString& In2);
+	/** Benchmark callable node Lib045_Fn039 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn039();
+	/** Benchmark latent node Lib045_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FVector& In1, const FVector& In2);
+	/** Benchmark callable node Lib045_Fn041 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn041(FString& Out0, FName In1);
+	/** Benchmark callable node Lib045_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn042(const FTransform& In0, const FTransform& In1);
+	/** Benchmark callable node Lib045_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn043(int32& Out0, const FVector& In1, const FTransform& In2, bool In3, const TArray< int32 >& In4, FString& Out5);
+	/** Benchmark pure node Lib045_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn044(UObject* In0, UObject* In1, const FVector& In2, FName In3, FString& Out4, int32 In5, FString& Out6, int32& Out7);
+	/** Benchmark pure node Lib045_Fn045 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn045();
+	/** Benchmark callable node Lib045_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn046(const FTransform& In0, const FTransform& In1, int32 In2, const FVector& In3, int32& Out4, FString& Out5, FString& Out6, UObject* In7);
+	/** Benchmark pure node Lib045_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn047(int32 In0, int32& Out1, float In2, const TArray< int32 >& In3, const FString& In4, const FString& In5, int32& Out6);
+	/** Benchmark pure node Lib045_Fn048 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn048(const FVector& In0, float In1);
+	/** Benchmark latent node Lib045_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark callable node Lib045_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn050(int32& Out0, FName In1, bool In2, FName In3, FString& Out4, float In5);
+	/** Benchmark pure node Lib045_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn051(FVector& Out0, UObject* In1);
+	/** Benchmark callable node Lib045_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn052();
+	/** Benchmark callable node Lib045_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn053(FVector& Out0, FVector& Out1);
+	/** Benchmark callable node Lib045_Fn054 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn054(FString& Out0, bool In1, int32& Out2);
+	/** Benchmark callable node Lib045_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn055(bool In0, const FVector& In1, const FTransform& In2, UObject* In3);
+	/** Benchmark callable node Lib045_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn056(FVector& Out0, FVector& Out1, const FString& In2, const FVector& In3, bool In4, const FVector& In5);
+	/** Benchmark callable node Lib045_Fn057 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn057(const FTransform& In0, FName In1, const FVector& In2, const FString& In3, int32& Out4);
+	/** Benchmark callable node Lib045_Fn058 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn058(UObject* In0, int32& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib045_Fn059 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn059(const FTransform& In0, const FTransform& In1, UObject* In2, bool In3, FString& Out4);
+	/** Benchmark pure node Lib045_Fn060 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn060(bool In0, const TArray< int32 >& In1, FName In2, bool In3, int32 In4, bool In5, int32 In6);
+	/** Benchmark callable node Lib045_Fn061 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn061(FVector& Out0, int32 In1, const FTransform& In2);
+	/** Benchmark callable node Lib045_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn062(int32 In0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib045_Fn063 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn063();
+	/** Benchmark pure node Lib045_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn064(const TArray< int32 >& In0, FName In1, UObject* In2, const FString& In3, UObject* In4, float In5, const FVector& In6);
+	/** Benchmark callable node Lib045_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn065(float In0, float In1, const FString& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, const FTransform& In5, const FVector& In6, FString& Out7);
+	/** Benchmark callable node Lib045_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn066(FVector& Out0, bool In1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib045_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn067(FVector& Out0, UObject* In1, float In2, UObject* In3, const TArray< int32 >& In4, float In5);
+	/** Benchmark callable node Lib045_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn068(FVector& Out0, const TArray< int32 >& In1, bool In2, bool In3, const FString& In4, int32& Out5);
+	/** Benchmark pure node Lib045_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn069(UObject* In0, int32 In1, int32 In2, FString& Out3, FName In4, int32 In5);
+	/** Benchmark callable node Lib045_Fn070 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn070();
+	/** Benchmark pure node Lib045_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn071(FString& Out0, const FString& In1, int32 In2, const FVector& In3, UObject* In4, FVector& Out5);
+	/** Benchmark callable node Lib045_Fn072 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn072(const TArray< int32 >& In0, UObject* In1, const TArray< int32 >& In2, FVector& Out3, int32& Out4, FVector& Out5, int32 In6);
+	/** Benchmark callable node Lib045_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn073(int32 In0, const TArray< int32 >& In1, UObject* In2, int32 In3, int32& Out4);
+	/** Benchmark pure node Lib045_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn074(const FTransform& In0, bool In1, const FVector& In2, const TArray< int32 >& In3, int32 In4, const FVector& In5, FVector& Out6);
+	/** Benchmark callable node Lib045_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn075(const FString& In0, const FString& In1, int32 In2, FString& Out3, UObject* In4, FName In5, float In6, int32& Out7);
+	/** Benchmark callable node Lib045_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn076(FVector& Out0, const FVector& In1, const FTransform& In2, const FTransform& In3);
+	/** Benchmark callable node Lib045_Fn077 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn077(int32 In0, float In1, const FTransform& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib045_Fn078 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn078(FName In0, FName In1);
+	/** Benchmark callable node Lib045_Fn079 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn079(const FVector& In0, float In1, int32& Out2, const FString& In3);
+	/** Benchmark callable node Lib045_Fn080 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn080();
+	/** Benchmark callable node Lib045_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn081();
+	/** Benchmark callable node Lib045_Fn082 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn082();
+	/** Benchmark pure node Lib045_Fn083 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn083(FName In0, FName In1, const FVector& In2, FVector& Out3, int32 In4, const FVector& In5);
+	/** Benchmark callable node Lib045_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn084(bool In0, int32 In1, bool In2, bool In3, int32 In4);
+	/** Benchmark callable node Lib045_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn085(int32& Out0, FVector& Out1, FString& Out2);
+	/** Benchmark callable node Lib045_Fn086 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static int32 Lib045_Fn086(const FString& In0, bool In1, FName In2, const FTransform& In3, FName In4, bool In5);
+	/** Benchmark callable node Lib045_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn087(const FVector& In0, FVector& Out1);
+	/** Benchmark pure node Lib045_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static bool Lib045_Fn088(const FTransform& In0, FString& Out1, bool In2, FString& Out3, const TArray< int32 >& In4, FName In5);
+	/** Benchmark callable node Lib045_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn089(FVector& Out0, const TArray< int32 >& In1, float In2, FName In3, float In4, FName In5);
+	/** Benchmark latent node Lib045_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FVector& In1, float In2, const FString& In3, FName In4);
+	/** Benchmark callable node Lib045_Fn091 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn091(const FTransform& In0);
+	/** Benchmark callable node Lib045_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn092(const FString& In0);
+	/** Benchmark callable node Lib045_Fn093 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn093(int32 In0);
+	/** Benchmark callable node Lib045_Fn094 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static void Lib045_Fn094(UObject* In0, FString& Out1, FString& Out2, const FVector& In3, const FVector& In4, float In5, float In6);
+	/** Benchmark pure node Lib045_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static float Lib045_Fn095();
+	/** Benchmark latent node Lib045_Fn096 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32 In1, FVector& Out2, int32 In3, FName In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib045_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045")
+	static FVector Lib045_Fn097(FString& Out0, int32 In1, bool In2);
+	/** Benchmark latent node Lib045_Fn098 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib045", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib045_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, const FTransform& In2, const FVector& In3, const FString& In4, FString& Out5, const FTransform& In6, bool In7);
+	/** Benchmark pure node Lib045_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib045")
+	static FString Lib045_Fn099(float In0, const TArray< int32 >& In1, FName In2, UObject* In3, const FString& In4);
+};
+
+
+UCLASS()
+class UKDGBenchLib_046 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib046_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn000(const FTransform& In0);
+	/** Benchmark pure node Lib046_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn001(const FVector& In0, FString& Out1, bool In2);
+	/** Benchmark callable node Lib046_Fn002 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn002(const FVector& In0);
+	/** Benchmark callable node Lib046_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn003(UObject* In0, int32& Out1);
+	/** Benchmark callable node Lib046_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn004();
+	/** Benchmark callable node Lib046_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn005(UObject* In0, const FTransform& In1, FName In2, int32 In3, const TArray< int32 >& In4, FVector& Out5, const FString& In6);
+	/** Benchmark pure node Lib046_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn006(const TArray< int32 >& In0, const FString& In1);
+	/** Benchmark pure node Lib046_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn007(const FString& In0, int32 In1, const FString& In2, const FString& In3);
+	/** Benchmark latent node Lib046_Fn008 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn008(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, const TArray< int32 >& In2, FName In3, FString& Out4, const FString& In5, float In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib046_Fn009 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn009(const FString& In0, bool In1);
+	/** Benchmark callable node Lib046_Fn010 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn010(const FTransform& In0, FName In1, const FString& In2, int32 In3, bool In4, const FTransform& In5, FVector& Out6, float In7);
+	/** Benchmark callable node Lib046_Fn011 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn011(FVector& Out0, float In1);
+	/** Benchmark pure node Lib046_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn012(float In0, FVector& Out1, UObject* In2, int32& Out3, const FString& In4, float In5, const FTransform& In6, const FString& In7);
+	/** Benchmark callable node Lib046_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn013(const FVector& In0, bool In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib046_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn014(int32 In0, FName In1, int32 In2, int32 In3, FString& Out4);
+	/** Benchmark callable node Lib046_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn015(const TArray< int32 >& In0, UObject* In1, int32 In2, int32& Out3, int32 In4, UObject* In5);
+	/** Benchmark callable node Lib046_Fn016 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn016(int32& Out0, int32& Out1);
+	/** Benchmark pure node Lib046_Fn017 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn017(const FTransform& In0, FString& Out1);
+	/** Benchmark callable node Lib046_Fn018 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn018(int32 In0, float In1, FVector& Out2, const FString& In3, const FString& In4, const FVector& In5, FName In6, int32 In7);
+	/** Benchmark callable node Lib046_Fn019 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn019(float In0, FString& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib046_Fn020 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn020();
+	/** Benchmark pure node Lib046_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn021(int32& Out0, int32& Out1, const FVector& In2);
+	/** Benchmark pure node Lib046_Fn022 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn022(bool In0, FString& Out1);
+	/** Benchmark latent node Lib046_Fn023 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn023(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FName In1, float In2, FString& Out3, const FVector& In4);
+	/** Benchmark callable node Lib046_Fn024 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn024(FName In0, int32& Out1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib046_Fn025 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn025(int32 In0, const FTransform& In1, bool In2, const TArray< int32 >& In3, bool In4, float In5, bool In6);
+	/** Benchmark pure node Lib046_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn026(bool In0, const FString& In1, const FTransform& In2, UObject* In3);
+	/** Benchmark pure node Lib046_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn027(bool In0, float In1);
+	/** Benchmark callable node Lib046_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn028(const FTransform& In0, float In1, FName In2, int32 In3, UObject* In4, const FVector& In5, FName In6);
+	/** Benchmark pure node Lib046_Fn029 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn029(int32 In0, int32& Out1, FName In2, int32 In3, const FVector& In4, const FVector& In5, const FString& In6);
+	/** Benchmark callable node Lib046_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn030(FVector& Out0, int32& Out1, FVector& Out2, bool In3, int32 In4, const FString& In5, UObject* In6);
+	/** Benchmark pure node Lib046_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn031(int32 In0);
+	/** Benchmark latent node Lib046_Fn032 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const TArray< int32 >& In1, float In2, int32 In3);
+	/** Benchmark callable node Lib046_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn033(int32 In0, bool In1, const FString& In2, const TArray< int32 >& In3, int32 In4);
+	/** Benchmark callable node Lib046_Fn034 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn034(const TArray< int32 >& In0, bool In1, float In2, const FVector& In3, FVector& Out4, int32& Out5, float In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib046_Fn035 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn035(int32 In0, FString& Out1, float In2, const FVector& In3, UObject* In4);
+	/** Benchmark callable node Lib046_Fn036 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn036(FName In0, const TArray< int32 >& In1, float In2, int32& Out3);
+	/** Benchmark callable node Lib046_Fn037 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn037(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib046_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn038();
+	/** Benchmark pure node Lib046_Fn039 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn039(const FString& In0, const FVector& In1, int32& Out2, float In3, UObject* In4);
+	/** Benchmark callable node Lib046_Fn040 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn040(FName In0, int32& Out1, FName In2);
+	/** Benchmark callable node Lib046_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn041(const FTransform& In0, const FTransform& In1, FName In2, int32 In3, FString& Out4);
+	/** Benchmark callable node Lib046_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn042(const TArray< int32 >& In0, const FTransform& In1, UObject* In2, float In3);
+	/** Benchmark callable node Lib046_Fn043 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn043(int32& Out0);
+	/** Benchmark pure node Lib046_Fn044 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn044(int32 In0, FString& Out1, FString& Out2, const FVector& In3, const FString& In4, FString& Out5, int32 In6);
+	/** Benchmark callable node Lib046_Fn045 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn045(const TArray< int32 >& In0, const FString& In1, const FTransform& In2, const TArray< int32 >& In3, FString& Out4, const TArray< int32 >& In5, int32& Out6);
+	/** Benchmark latent node Lib046_Fn046 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark callable node Lib046_Fn047 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn047(const FVector& In0);
+	/** Benchmark latent node Lib046_Fn048 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn048(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib046_Fn049 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn049(const FTransform& In0, UObject* In1, float In2, FName In3, bool In4);
+	/** Benchmark callable node Lib046_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn050(const TArray< int32 >& In0, int32 In1);
+	/** Benchmark callable node Lib046_Fn051 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn051(UObject* In0, FString& Out1, UObject* In2);
+	/** Benchmark callable node Lib046_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn052(FName In0, int32 In1, FName In2, const FTransform& In3);
+	/** Benchmark callable node Lib046_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn053(const TArray< int32 >& In0, const FVector& In1, bool In2);
+	/** Benchmark pure node Lib046_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn054(const FVector& In0);
+	/** Benchmark callable node Lib046_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn055();
+	/** Benchmark pure node Lib046_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn056(UObject* In0, const FString& In1, FString& Out2, int32& Out3);
+	/** Benchmark callable node Lib046_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn057(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib046_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn058(FVector& Out0, int32& Out1, UObject* In2, const FString& In3);
+	/** Benchmark pure node Lib046_Fn059 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn059(FString& Out0);
+	/** Benchmark callable node Lib046_Fn060 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn060(int32 In0, int32 In1, const FString& In2, const FString& In3, FString& Out4, FVector& Out5);
+	/** Benchmark pure node Lib046_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn061();
+	/** Benchmark pure node Lib046_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn062(const FVector& In0, const FTransform& In1);
+	/** Benchmark callable node Lib046_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn063(int32& Out0, bool In1, FName In2, UObject* In3);
+	/** Benchmark callable node Lib046_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn064(const FVector& In0, const FTransform& In1, FString& Out2, const FVector& In3, const TArray< int32 >& In4, int32 In5, bool In6);
+	/** Benchmark callable node Lib046_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn065(const FVector& In0);
+	/** Benchmark latent node Lib046_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32& Out1, bool In2, const FString& In3, int32 In4);
+	/** Benchmark pure node Lib046_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn067(FString& Out0, FName In1, FName In2, int32 In3, float In4);
+	/** Benchmark latent node Lib046_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, bool In1, float In2);
+	/** Benchmark callable node Lib046_Fn069 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn069(UObject* In0, int32 In1, const FString& In2);
+	/** Benchmark callable node Lib046_Fn070 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn070(FVector& Out0, int32 In1, FName In2, FString& Out3, UObject* In4, const FTransform& In5, bool In6, const FVector& In7);
+	/** Benchmark callable node Lib046_Fn071 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn071(UObject* In0, const FTransform& In1);
+	/** Benchmark pure node Lib046_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn072(UObject* In0, int32& Out1, const FVector& In2, const FTransform& In3, UObject* In4);
+	/** Benchmark pure node Lib046_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn073(const FString& In0);
+	/** Benchmark pure node Lib046_Fn074 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn074(UObject* In0, int32 In1, int32 In2);
+	/** Benchmark pure node Lib046_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn075(const FTransform& In0, const FVector& In1, bool In2, UObject* In3, bool In4, bool In5, UObject* In6);
+	/** Benchmark latent node Lib046_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark pure node Lib046_Fn077 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn077(const FVector& In0, UObject* In1, FVector& Out2, FName In3, const FVector& In4, bool In5);
+	/** Benchmark callable node Lib046_Fn078 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn078(FName In0, FName In1);
+	/** Benchmark callable node Lib046_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn079(FName In0);
+	/** Benchmark callable node Lib046_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn080(float In0, FName In1, int32& Out2);
+	/** Benchmark callable node Lib046_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn081();
+	/** Benchmark callable node Lib046_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn082(int32& Out0, bool In1, const TArray< int32 >& In2, FName In3, const FVector& In4, UObject* In5, const FVector& In6);
+	/** Benchmark callable node Lib046_Fn083 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn083(const TArray< int32 >& In0, const FVector& In1, const FVector& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, float In5, UObject* In6);
+	/** Benchmark pure node Lib046_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn084(const TArray< int32 >& In0, const FTransform& In1, float In2);
+	/** Benchmark latent node Lib046_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn085(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FVector& Out1, int32& Out2, int32& Out3, UObject* In4);
+	/** Benchmark callable node Lib046_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn086(int32 In0, const TArray< int32 >& In1, FName In2, UObject* In3);
+	/** Benchmark callable node Lib046_Fn087 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn087(const FVector& In0, float In1, const FVector& In2, float In3);
+	/** Benchmark callable node Lib046_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn088(const FVector& In0, FName In1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib046_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn089();
+	/** Benchmark latent node Lib046_Fn090 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0);
+	/** Benchmark latent node Lib046_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FName In1, FString& Out2, const FString& In3);
+	/** Benchmark callable node Lib046_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static bool Lib046_Fn092(const FVector& In0, const TArray< int32 >& In1, FString& Out2, int32& Out3, const TArray< int32 >& In4, FName In5, float In6);
+	/** Benchmark callable node Lib046_Fn093 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static int32 Lib046_Fn093();
+	/** Benchmark latent node Lib046_Fn094 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib046_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FString& Out1, int32& Out2, int32 In3);
+	/** Benchmark callable node Lib046_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn095(float In0, float In1, bool In2);
+	/** Benchmark callable node Lib046_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FVector Lib046_Fn096(bool In0);
+	/** Benchmark callable node Lib046_Fn097 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static FString Lib046_Fn097(FName In0);
+	/** Benchmark pure node Lib046_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib046")
+	static float Lib046_Fn098();
+	/** Benchmark callable node Lib046_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib046")
+	static void Lib046_Fn099(bool In0, const FVector& In1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_047 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib047_Fn000 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn000();
+	/** Benchmark callable node Lib047_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn001();
+	/** Benchmark pure node Lib047_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn002(const FString& In0, float In1, FString& Out2, FString& Out3, FString& Out4);
+	/** Benchmark callable node Lib047_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn003(const FVector& In0, float In1);
+	/** Benchmark callable node Lib047_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn004();
+	/** Benchmark callable node Lib047_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn005(FVector& Out0);
+	/** Benchmark pure node Lib047_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn006(int32& Out0, float In1, FName In2, const TArray< int32 >& In3, int32& Out4);
+	/** Benchmark pure node Lib047_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn007(const FVector& In0, const FString& In1, FName In2, FName In3, bool In4, int32 In5);
+	/** Benchmark callable node Lib047_Fn008 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn008(bool In0, const FTransform& In1, const FTransform& In2, const TArray< int32 >& In3, const FTransform& In4, int32 In5, FName In6);
+	/** Benchmark callable node Lib047_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn009(FString& Out0, float In1, int32 In2, FString& Out3, const FTransform& In4, FString& Out5, int32& Out6, FName In7);
+	/** Benchmark pure node Lib047_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn010();
+	/** Benchmark callable node Lib047_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn011(float In0);
+	/** Benchmark latent node Lib047_Fn012 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, const FString& In2, const FVector& In3, FString& Out4, FVector& Out5, const FString& In6);
+	/** Benchmark callable node Lib047_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn013(int32 In0, int32 In1, const TArray< int32 >& In2, UObject* In3, const FTransform& In4, const FString& In5);
+	/** Benchmark callable node Lib047_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn014(int32 In0, int32& Out1, const FTransform& In2);
+	/** Benchmark latent node Lib047_Fn015 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, const FVector& In2, FName In3, FVector& Out4, FVector& Out5, FName In6);
+	/** Benchmark pure node Lib047_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn016(const FVector& In0, FString& Out1, FName In2, float In3, FVector& Out4, const FTransform& In5);
+	/** Benchmark pure node Lib047_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn017(const FTransform& In0, float In1, int32 In2, FName In3, int32& Out4, bool In5, const FVector& In6, float In7);
+	/** Benchmark callable node Lib047_Fn018 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn018();
+	/** Benchmark callable node Lib047_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn019();
+	/** Benchmark pure node Lib047_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn020(const FTransform& In0);
+	/** Benchmark callable node Lib047_Fn021 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn021(int32& Out0, int32& Out1, const FTransform& In2, FVector& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib047_Fn022 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn022(const TArray< int32 >& In0, int32& Out1, const TArray< int32 >& In2, bool In3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib047_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn023(FName In0, int32 In1, const FString& In2, const FTransform& In3, int32 In4);
+	/** Benchmark callable node Lib047_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn024(FName In0, FName In1, const FVector& In2, const FTransform& In3, FName In4, const FTransform& In5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark pure node Lib047_Fn025 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn025(const FVector& In0, bool In1, FString& Out2);
+	/** Benchmark pure node Lib047_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn026(const FString& In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib047_Fn027 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn027(const FString& In0, float In1, FVector& Out2, const FTransform& In3, const FTransform& In4, FString& Out5, const FTransform& In6, const FString& In7);
+	/** Benchmark pure node Lib047_Fn028 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn028(FVector& Out0, FString& Out1, const TArray< int32 >& In2, FName In3, const FTransform& In4);
+	/** Benchmark callable node Lib047_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn029(float In0, const FTransform& In1, const FString& In2, float In3, bool In4);
+	/** Benchmark pure node Lib047_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn030(FString& Out0, FString& Out1, UObject* In2, FVector& Out3, int32& Out4, FName In5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark callable node Lib047_Fn031 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn031(bool In0, FVector& Out1, FName In2);
+	/** Benchmark callable node Lib047_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn032(FName In0, const FTransform& In1, UObject* In2);
+	/** Benchmark latent node Lib047_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark pure node Lib047_Fn034 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn034(float In0, int32 In1, FString& Out2, FString& Out3, int32 In4, FString& Out5, FVector& Out6, UObject* In7);
+	/** Benchmark pure node Lib047_Fn035 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn035(FName In0, bool In1, float In2, float In3);
+	/** Benchmark latent node Lib047_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32& Out1, int32 In2);
+	/** Benchmark pure node Lib047_Fn037 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn037(UObject* In0, UObject* In1, const TArray< int32 >& In2, FVector& Out3, bool In4, int32 In5, bool In6, bool In7);
+	/** Benchmark pure node Lib047_Fn038 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn038(UObject* In0, const TArray< int32 >& In1, UObject* In2, int32& Out3, FName In4);
+	/** Benchmark callable node Lib047_Fn039 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn039();
+	/** Benchmark callable node Lib047_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn040(bool In0, const FTransform& In1, const FString& In2, UObject* In3, FString& Out4, const FString& In5);
+	/** Benchmark latent node Lib047_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark callable node Lib047_Fn042 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn042(float In0, int32& Out1, const FString& In2, float In3, FName In4);
+	/** Benchmark pure node Lib047_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn043();
+	/** Benchmark callable node Lib047_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn044(int32 In0, float In1, FVector& Out2, const FString& In3, float In4, const FTransform& In5);
+	/** Benchmark pure node Lib047_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn045(float In0);
+	/** Benchmark pure node Lib047_Fn046 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn046(UObject* In0, UObject* In1, const FString& In2, bool In3);
+	/** Benchmark callable node Lib047_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn047(const FVector& In0, int32& Out1, const FString& In2);
+	/** Benchmark callable node Lib047_Fn048 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn048(const FString& In0, int32 In1, const FVector& In2, const FTransform& In3, UObject* In4);
+	/** Benchmark callable node Lib047_Fn049 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn049(FName In0, float In1, const FTransform& In2, UObject* In3);
+	/** Benchmark pure node Lib047_Fn050 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn050(const FVector& In0, FVector& Out1, FName In2);
+	/** Benchmark callable node Lib047_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn051(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib047_Fn052 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn052(const FString& In0, const FVector& In1, const FString& In2, FString& Out3, const FTransform& In4, const FString& In5);
+	/** Benchmark pure node Lib047_Fn053 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn053(float In0, const FVector& In1, bool In2, const FString& In3, const TArray< int32 >& In4, const FString& In5, FVector& Out6, float In7);
+	/** Benchmark pure node Lib047_Fn054 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn054(FName In0, bool In1, int32& Out2);
+	/** Benchmark callable node Lib047_Fn055 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn055(int32 In0, int32& Out1, const FTransform& In2, UObject* In3, const FTransform& In4, float In5, FName In6);
+	/** Benchmark callable node Lib047_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn056();
+	/** Benchmark pure node Lib047_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn057(FName In0, const TArray< int32 >& In1, const FVector& In2);
+	/** Benchmark latent node Lib047_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1);
+	/** Benchmark callable node Lib047_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn059(const FVector& In0, const FVector& In1, int32& Out2, int32 In3, float In4, FString& Out5, bool In6, FVector& Out7);
+	/** Benchmark callable node Lib047_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn060(FString& Out0, const FVector& In1, FString& Out2, FName In3, const FVector& In4, int32& Out5, int32& Out6, bool In7);
+	/** Benchmark pure node Lib047_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn061();
+	/** Benchmark callable node Lib047_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn062(bool In0, float In1, UObject* In2, FString& Out3, const TArray< int32 >& In4, FVector& Out5, const FVector& In6);
+	/** Benchmark pure node Lib047_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn063(int32& Out0, FString& Out1);
+	/** Benchmark pure node Lib047_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn064(const TArray< int32 >& In0, const FTransform& In1, int32 In2, const FVector& In3, float In4, FVector& Out5, float In6, const FVector& In7);
+	/** Benchmark callable node Lib047_Fn065 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn065(FVector& Out0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib047_Fn066 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static float Lib047_Fn066(const FString& In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib047_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn067(const FTransform& In0);
+	/** Benchmark pure node Lib047_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn068(UObject* In0, int32 In1, FName In2, float In3, const FVector& In4);
+	/** Benchmark callable node Lib047_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn069(float In0, const FVector& In1, int32& Out2, UObject* In3, bool In4, FString& Out5);
+	/** Benchmark latent node Lib047_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark pure node Lib047_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn071(int32& Out0, FVector& Out1, const FVector& In2, int32 In3, UObject* In4, int32 In5);
+	/** Benchmark pure node Lib047_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn072();
+	/** Benchmark callable node Lib047_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn073(int32& Out0);
+	/** Benchmark callable node Lib047_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn074(FString& Out0, FVector& Out1, FVector& Out2, FVector& Out3);
+	/** Benchmark callable node Lib047_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn075(float In0, FName In1, const TArray< int32 >& In2, int32& Out3);
+	/** Benchmark pure node Lib047_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn076(int32 In0, FName In1);
+	/** Benchmark latent node Lib047_Fn077 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, const FString& In2, const TArray< int32 >& In3, float In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib047_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn078();
+	/** Benchmark pure node Lib047_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn079();
+	/** Benchmark callable node Lib047_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn080(FVector& Out0, UObject* In1, FVector& Out2);
+	/** Benchmark latent node Lib047_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1, FVector& Out2, int32& Out3, int32 In4);
+	/** Benchmark callable node Lib047_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn082(int32 In0, int32& Out1, FString& Out2, bool In3, bool In4, const FTransform& In5, const FVector& In6, float In7);
+	/** Benchmark callable node Lib047_Fn083 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn083(FName In0, const FVector& In1, int32& Out2);
+	/** Benchmark callable node Lib047_Fn084 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn084(FVector& Out0);
+	/** Benchmark pure node Lib047_Fn085 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn085(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib047_Fn086 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn086();
+	/** Benchmark pure node Lib047_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn087(FName In0, UObject* In1, FString& Out2, bool In3, FString& Out4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib047_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn088(const TArray< int32 >& In0, FVector& Out1, int32 In2, const FString& In3, int32& Out4, UObject* In5, FName In6, int32& Out7);
+	/** Benchmark callable node Lib047_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn089(FName In0, FString& Out1, const FTransform& In2, int32 In3, float In4, const FVector& In5);
+	/** Benchmark callable node Lib047_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn090(const TArray< int32 >& In0, const FTransform& In1);
+	/** Benchmark pure node Lib047_Fn091 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static int32 Lib047_Fn091();
+	/** Benchmark pure node Lib047_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn092();
+	/** Benchmark latent node Lib047_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32 In1);
+	/** Benchmark callable node Lib047_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn094(int32 In0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib047_Fn095 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static FVector Lib047_Fn095(FName In0, float In1, const FVector& In2, FString& Out3, FVector& Out4, const FTransform& In5, float In6);
+	/** Benchmark callable node Lib047_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static bool Lib047_Fn096(UObject* In0, const TArray< int32 >& In1, float In2);
+	/** Benchmark latent node Lib047_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib047_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark callable node Lib047_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib047")
+	static void Lib047_Fn098(const TArray< int32 >& In0, const FString& In1, UObject* In2, const FVector& In3, const FTransform& In4, const FString& In5);
+	/** Benchmark pure node Lib047_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib047")
+	static FString Lib047_Fn099(int32 In0, float In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const TArray< int32 >& In4);
+};
+
+
+UCLASS()
+class UKDGBenchLib_048 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib048_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0);
+	/** Benchmark callable node Lib048_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn001(const TArray< int32 >& In0, FName In1, FVector& Out2, bool In3, UObject* In4);
+	/** Benchmark callable node Lib048_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn002(const FTransform& In0, const FString& In1, bool In2, const TArray< int32 >& In3, const FString& In4);
+	/** Benchmark pure node Lib048_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn003(FName In0, int32& Out1, const FTransform& In2, const FVector& In3, int32 In4, bool In5, FVector& Out6);
+	/** Benchmark callable node Lib048_Fn004 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn004(int32& Out0, const TArray< int32 >& In1, const FVector& In2, const FTransform& In3, const FString& In4, FVector& Out5);
+	/** Benchmark pure node Lib048_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn005(int32& Out0);
+	/** Benchmark pure node Lib048_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn006(FVector& Out0, int32& Out1, int32& Out2, FVector& Out3);
+	/** Benchmark pure node Lib048_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn007(bool In0, FName In1, int32& Out2, FName In3, FVector& Out4);
+	/** Benchmark pure node Lib048_Fn008 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn008(FVector& Out0);
+	/** Benchmark callable node Lib048_Fn009 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn009(int32 In0, const FTransform& In1, const TArray< int32 >& In2, float In3, const FVector& In4, int32 In5, FVector& Out6);
+	/** Benchmark pure node Lib048_Fn010 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn010(FString& Out0);
+	/** Benchmark pure node Lib048_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn011(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib048_Fn012 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn012();
+	/** Benchmark pure node Lib048_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn013(int32 In0, const FString& In1, const FVector& In2, int32& Out3, FString& Out4, FString& Out5);
+	/** Benchmark callable node Lib048_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn014(int32& Out0, FVector& Out1, const FTransform& In2, const FString& In3, FName In4, const FString& In5, int32& Out6);
+	/** Benchmark callable node Lib048_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn015(const FVector& In0, bool In1, UObject* In2, const TArray< int32 >& In3, FString& Out4, FString& Out5, float In6);
+	/** Benchmark pure node Lib048_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn016(float In0, float In1, FString& Out2, int32& Out3, FString& Out4, const FTransform& In5, FString& Out6, UObject* In7);
+	/** Benchmark pure node Lib048_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn017(int32& Out0, bool In1, const FTransform& In2, FName In3, FVector& Out4, const FString& In5);
+	/** Benchmark callable node Lib048_Fn018 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn018();
+	/** Benchmark pure node Lib048_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn019(const FTransform& In0, FString& Out1, UObject* In2, bool In3);
+	/** Benchmark callable node Lib048_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn020(int32& Out0, FName In1, FString& Out2, UObject* In3, int32 In4, FString& Out5, FVector& Out6, bool In7);
+	/** Benchmark callable node Lib048_Fn021 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn021(float In0, FName In1, int32 In2, const TArray< int32 >& In3, int32 In4);
+	/** Benchmark pure node Lib048_Fn022 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn022();
+	/** Benchmark callable node Lib048_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn023(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib048_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn024(FVector& Out0, const FString& In1, float In2, int32& Out3, int32& Out4, const FVector& In5, FName In6);
+	/** Benchmark pure node Lib048_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn025(bool In0, bool In1, int32 In2, bool In3, int32& Out4, const FVector& In5);
+	/** Benchmark callable node Lib048_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn026(const TArray< int32 >& In0, const FTransform& In1, int32& Out2, const FString& In3, const FString& In4, bool In5);
+	/** Benchmark callable node Lib048_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn027(const TArray< int32 >& In0, const FVector& In1);
+	/** Benchmark callable node Lib048_Fn028 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn028(const TArray< int32 >& In0, const FTransform& In1, UObject* In2, int32 In3, const FVector& In4, FString& Out5, FString& Out6, UObject* In7);
+	/** Benchmark latent node Lib048_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FVector& In1, UObject* In2);
+	/** Benchmark callable node Lib048_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn030(FVector& Out0, UObject* In1, const TArray< int32 >& In2, FString& Out3);
+	/** Benchmark callable node Lib048_Fn031 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn031();
+	/** Benchmark pure node Lib048_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn032(const FTransform& In0, const FVector& In1, FName In2, FVector& Out3);
+	/** Benchmark pure node Lib048_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn033(int32& Out0, const TArray< int32 >& In1, FString& Out2, int32& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib048_Fn034 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn034();
+	/** Benchmark pure node Lib048_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn035(FVector& Out0, FName In1, const FTransform& In2);
+	/** Benchmark callable node Lib048_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn036(FVector& Out0, const FTransform& In1, int32 In2, const TArray< int32 >& In3, float In4, FVector& Out5, UObject* In6, FString& Out7);
+	/** Benchmark callable node Lib048_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn037(const FTransform& In0, bool In1, const TArray< int32 >& In2, int32& Out3, int32 In4);
+	/** Benchmark callable node Lib048_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn038(int32 In0);
+	/** Benchmark pure node Lib048_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn039(const TArray< int32 >& In0, bool In1, FName In2, FVector& Out3, int32 In4, FName In5, FString& Out6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib048_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn040(FName In0, const FString& In1, int32& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib048_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn041(const FVector& In0, FString& Out1, FString& Out2, float In3, FName In4);
+	/** Benchmark callable node Lib048_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn042(int32& Out0, UObject* In1, FVector& Out2, const TArray< int32 >& In3, FVector& Out4, const TArray< int32 >& In5, int32 In6);
+	/** Benchmark callable node Lib048_Fn043 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn043(float In0, int32& Out1);
+	/** Benchmark callable node Lib048_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn044(const FVector& In0, FString& Out1, FString& Out2);
+	/** Benchmark callable node Lib048_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn045(const FTransform& In0, FName In1, const FTransform& In2);
+	/** Benchmark latent node Lib048_Fn046 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1, UObject* In2, const TArray< int32 >& In3, bool In4, int32 In5, int32& Out6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib048_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn047(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib048_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn048(int32 In0, int32& Out1, int32 In2, UObject* In3, int32 In4, FVector& Out5, FName In6);
+	/** Benchmark pure node Lib048_Fn049 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn049(const FVector& In0, bool In1, UObject* In2, int32 In3);
+	/** Benchmark callable node Lib048_Fn050 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn050(UObject* In0, int32 In1, UObject* In2, int32& Out3, FString& Out4, const FVector& In5, const FString& In6, const FString& In7);
+	/** Benchmark callable node Lib048_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn051(FName In0, FVector& Out1, const FTransform& In2, FName In3, FVector& Out4, FString& Out5);
+	/** Benchmark callable node Lib048_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn052();
+	/** Benchmark pure node Lib048_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn053(int32& Out0, const FString& In1);
+	/** Benchmark callable node Lib048_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn054(const FString& In0, const FString& In1, int32& Out2, const FString& In3, int32& Out4, const FVector& In5);
+	/** Benchmark pure node Lib048_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn055(bool In0, int32& Out1, const FVector& In2);
+	/** Benchmark callable node Lib048_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn056(bool In0, FString& Out1, const FVector& In2, UObject* In3, UObject* In4, const TArray< int32 >& In5, const FString& In6, const FTransform& In7);
+	/** Benchmark latent node Lib048_Fn057 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FString& In1, FName In2);
+	/** Benchmark latent node Lib048_Fn058 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FVector& In1, const FTransform& In2, FVector& Out3, float In4, float In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib048_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn059(const FTransform& In0, FVector& Out1, FString& Out2, FName In3, FString& Out4, const FTransform& In5);
+	/** Benchmark pure node Lib048_Fn060 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn060(int32& Out0, const TArray< int32 >& In1, const FString& In2, const FString& In3, const FString& In4);
+	/** Benchmark pure node Lib048_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn061(FVector& Out0, FString& Out1, int32 In2, const FVector& In3, const FVector& In4, UObject* In5, const FString& In6);
+	/** Benchmark pure node Lib048_Fn062 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn062(bool In0);
+	/** Benchmark callable node Lib048_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn063(int32 In0, bool In1, const TArray< int32 >& In2, int32 In3, FString& Out4);
+	/** Benchmark callable node Lib048_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn064(FString& Out0, const TArray< int32 >& In1, UObject* In2, bool In3, const FString& In4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib048_Fn065 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn065(float In0, float In1, FVector& Out2, FName In3, bool In4);
+	/** Benchmark pure node Lib048_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn066(FName In0, const TArray< int32 >& In1, const FString& In2, FName In3, bool In4, const TArray< int32 >& In5, const FString& In6);
+	/** Benchmark latent node Lib048_Fn067 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FVector& Out1);
+	/** Benchmark pure node Lib048_Fn068 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn068(UObject* In0, int32 In1, int32 In2, int32& Out3, const FTransform& In4, UObject* In5, float In6);
+	/** Benchmark callable node Lib048_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn069(FVector& Out0, FString& Out1, const FVector& In2, int32 In3, const FVector& In4);
+	/** Benchmark callable node Lib048_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn070(UObject* In0, const FVector& In1, float In2, const TArray< int32 >& In3, FVector& Out4, FVector& Out5, int32& Out6);
+	/** Benchmark callable node Lib048_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn071(FString& Out0);
+	/** Benchmark callable node Lib048_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn072(FString& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib048_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn073(FName In0, FVector& Out1, bool In2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark callable node Lib048_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn074(FName In0, float In1);
+	/** Benchmark latent node Lib048_Fn075 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn075(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FName In1, const FString& In2, const FTransform& In3, bool In4, bool In5, FName In6, int32 In7);
+	/** Benchmark callable node Lib048_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn076(FVector& Out0, UObject* In1, FVector& Out2);
+	/** Benchmark pure node Lib048_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn077(const FVector& In0, bool In1, const TArray< int32 >& In2, const TArray< int32 >& In3, float In4, const FTransform& In5, FString& Out6);
+	/** Benchmark callable node Lib048_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn078(const FVector& In0, const FString& In1, bool In2, const FVector& In3, int32& Out4, FName In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib048_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn079(const FTransform& In0, const FTransform& In1, int32 In2, UObject* In3, FVector& Out4);
+	/** Benchmark callable node Lib048_Fn080 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static float Lib048_Fn080();
+	/** Benchmark pure node Lib048_Fn081 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn081(int32& Out0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib048_Fn082 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static void Lib048_Fn082(FName In0);
+	/** Benchmark callable node Lib048_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn083(const FVector& In0, bool In1, int32 In2, FVector& Out3, const FString& In4);
+	/** Benchmark pure node Lib048_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn084(FName In0, float In1, float In2, const FVector& In3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib048_Fn085 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn085(FString& Out0, const FString& In1);
+	/** Benchmark pure node Lib048_Fn086 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn086();
+	/** Benchmark callable node Lib048_Fn087 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn087(const FVector& In0, const FString& In1, FVector& Out2, bool In3, FName In4, FString& Out5, UObject* In6, float In7);
+	/** Benchmark callable node Lib048_Fn088 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn088(const FString& In0);
+	/** Benchmark callable node Lib048_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn089();
+	/** Benchmark callable node Lib048_Fn090 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn090(bool In0, FString& Out1, FName In2, FVector& Out3, const FTransform& In4, const FVector& In5, FVector& Out6, bool In7);
+	/** Benchmark pure node Lib048_Fn091 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn091();
+	/** Benchmark latent node Lib048_Fn092 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib048_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FName In1, const FTransform& In2);
+	/** Benchmark pure node Lib048_Fn093 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static int32 Lib048_Fn093(int32 In0, const TArray< int32 >& In1, FVector& Out2, FString& Out3, const FVector& In4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib048_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn094(FVector& Out0, float In1, int32 In2, const FTransform& In3);
+	/** Benchmark callable node Lib048_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn095(FVector& Out0, UObject* In1, int32& Out2);
+	/** Benchmark pure node Lib048_Fn096 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static FString Lib048_Fn096(const FString& In0, const FString& In1, const FTransform& In2, const FString& In3, FName In4, FString& Out5, FString& Out6, FString& Out7);
+	/** Benchmark callable node Lib048_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn097(UObject* In0, FVector& Out1, const FTransform& In2, bool In3, float In4, const FString& In5);
+	/** Benchmark pure node Lib048_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib048")
+	static bool Lib048_Fn098();
+	/** Benchmark callable node Lib048_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib048")
+	static FVector Lib048_Fn099(FVector& Out0, int32 In1, FString& Out2, const TArray< int32 >& In3, FName In4, UObject* In5, const FTransform& In6);
+};
+
+
+UCLASS()
+class UKDGBenchLib_049 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib049_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, int32 In2, FVector& Out3);
+	/** Benchmark pure node Lib049_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn001(int32& Out0, FName In1, bool In2, float In3, bool In4, UObject* In5);
+	/** Benchmark callable node Lib049_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn002(FString& Out0, const TArray< int32 >& In1, UObject* In2, FVector& Out3, const FVector& In4, bool In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib049_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn003(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib049_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn004(int32& Out0, float In1, int32 In2, bool In3, const FVector& In4, const FVector& In5, FName In6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib049_Fn005 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn005(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, FVector& Out2, FVector& Out3, float In4, FString& Out5, bool In6);
+	/** Benchmark callable node Lib049_Fn006 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn006(int32& Out0, const TArray< int32 >& In1, FString& Out2, const FVector& In3, float In4, const TArray< int32 >& In5, const FString& In6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib049_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark pure node Lib049_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn008(const FVector& In0, int32 In1, const TArray< int32 >& In2, FString& Out3, const FTransform& In4, int32& Out5);
+	/** Benchmark pure node Lib049_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn009(FVector& Out0, FString& Out1, FName In2);
+	/** Benchmark callable node Lib049_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn010(FString& Out0, const FVector& In1, const FVector& In2, bool In3, const TArray< int32 >& In4, const FString& In5, FName In6);
+	/** Benchmark pure node Lib049_Fn011 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn011(int32& Out0, int32 In1, UObject* In2, FName In3);
+	/** Benchmark pure node Lib049_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn012(UObject* In0, float In1, bool In2, const TArray< int32 >& In3, const FVector& In4, bool In5, int32 In6);
+	/** Benchmark latent node Lib049_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FVector& In1, int32 In2, UObject* In3);
+	/** Benchmark pure node Lib049_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn014(int32 In0, FVector& Out1, const TArray< int32 >& In2, const FString& In3, int32& Out4);
+	/** Benchmark callable node Lib049_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn015(const TArray< int32 >& In0, const FVector& In1, bool In2, FVector& Out3);
+	/** Benchmark pure node Lib049_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn016();
+	/** Benchmark callable node Lib049_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn017(int32 In0, int32& Out1, FVector& Out2);
+	/** Benchmark pure node Lib049_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn018(int32& Out0, FVector& Out1, FName In2, const TArray< int32 >& In3, bool In4);
+	/** Benchmark callable node Lib049_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn019();
+	/** Benchmark callable node Lib049_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn020(FName In0, const FTransform& In1, const FString& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, FName In5, float In6, const FString& In7);
+	/** Benchmark callable node Lib049_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn021(const FTransform& In0, float In1, const FVector& In2, const FString& In3);
+	/** Benchmark callable node Lib049_Fn022 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn022(FName In0, FString& Out1, const FTransform& In2, float In3, FVector& Out4);
+	/** Benchmark callable node Lib049_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn023(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib049_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn024(FName In0);
+	/** Benchmark callable node Lib049_Fn025 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn025(UObject* In0, FVector& Out1, const FString& In2, bool In3, FVector& Out4);
+	/** Benchmark pure node Lib049_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn026(UObject* In0, const FTransform& In1, const FVector& In2, const FTransform& In3, FString& Out4);
+	/** Benchmark callable node Lib049_Fn027 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn027(const TArray< int32 >& In0, FString& Out1, const FVector& In2, UObject* In3, const FString& In4, UObject* In5);
+	/** Benchmark pure node Lib049_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn028(const FTransform& In0, FString& Out1, float In2, bool In3, const FVector& In4, int32 In5, int32& Out6);
+	/** Benchmark callable node Lib049_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn029();
+	/** Benchmark callable node Lib049_Fn030 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn030(const FTransform& In0, bool In1, FVector& Out2, bool In3, FVector& Out4);
+	/** Benchmark callable node Lib049_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn031(bool In0);
+	/** Benchmark callable node Lib049_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn032(bool In0, FName In1, FString& Out2, FName In3, float In4, FString& Out5, const FVector& In6, int32 In7);
+	/** Benchmark callable node Lib049_Fn033 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn033(const FString& In0, FName In1, int32& Out2, const FVector& In3, FVector& Out4, bool In5, const FString& In6);
+	/** Benchmark pure node Lib049_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn034(const TArray< int32 >& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib049_Fn035 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn035(const FString& In0, const TArray< int32 >& In1, const FTransform& In2, float In3, const TArray< int32 >& In4, int32 In5, FName In6);
+	/** Benchmark pure node Lib049_Fn036 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn036();
+	/** Benchmark pure node Lib049_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn037(const FString& In0, bool In1, const FVector& In2, int32& Out3);
+	/** Benchmark callable node Lib049_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn038(const FVector& In0, const FString& In1, FString& Out2, const FString& In3);
+	/** Benchmark callable node Lib049_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn039(const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib049_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn040(const FString& In0, float In1, FVector& Out2, int32 In3, FString& Out4, const TArray< int32 >& In5, int32& Out6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib049_Fn041 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn041(FName In0, bool In1, FName In2, FName In3, int32 In4, FVector& Out5, int32 In6);
+	/** Benchmark pure node Lib049_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn042(const FString& In0, int32 In1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib049_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn043(FString& Out0, bool In1, const FString& In2, FString& Out3, UObject* In4, const FString& In5, const FTransform& In6);
+	/** Benchmark pure node Lib049_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn044(const TArray< int32 >& In0, int32& Out1, FName In2, const FVector& In3, const FVector& In4);
+	/** Benchmark callable node Lib049_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn045(int32 In0, float In1, const FString& In2);
+	/** Benchmark callable node Lib049_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn046(FVector& Out0, float In1);
+	/** Benchmark callable node Lib049_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn047(int32& Out0, float In1, int32 In2, int32& Out3, UObject* In4);
+	/** Benchmark callable node Lib049_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn048(UObject* In0, FString& Out1, UObject* In2, bool In3, FName In4, const FTransform& In5, FString& Out6, FName In7);
+	/** Benchmark callable node Lib049_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn049(const FTransform& In0, bool In1, bool In2, FName In3, float In4, int32& Out5);
+	/** Benchmark pure node Lib049_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn050(const FVector& In0, const FString& In1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib049_Fn051 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn051(bool In0, UObject* In1, int32& Out2, int32 In3, const FVector& In4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib049_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn052(const TArray< int32 >& In0, const TArray< int32 >& In1, UObject* In2, const FTransform& In3);
+	/** Benchmark pure node Lib049_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn053(const FTransform& In0, FVector& Out1, float In2, FVector& Out3);
+	/** Benchmark callable node Lib049_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn054(FString& Out0, const TArray< int32 >& In1, UObject* In2, int32 In3, const TArray< int32 >& In4, const FTransform& In5, const TArray< int32 >& In6, float In7);
+	/** Benchmark pure node Lib049_Fn055 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn055(const FVector& In0);
+	/** Benchmark callable node Lib049_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn056(const TArray< int32 >& In0, const FString& In1, const FString& In2, int32& Out3, FString& Out4, float In5);
+	/** Benchmark pure node Lib049_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn057(const FTransform& In0, bool In1, const TArray< int32 >& In2, FVector& Out3, FString& Out4, FName In5);
+	/** Benchmark callable node Lib049_Fn058 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn058(const FVector& In0, const FTransform& In1, float In2);
+	/** Benchmark callable node Lib049_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn059(UObject* In0, UObject* In1, const FVector& In2);
+	/** Benchmark pure node Lib049_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn060();
+	/** Benchmark callable node Lib049_Fn061 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn061(int32 In0, const TArray< int32 >& In1, float In2);
+	/** Benchmark callable node Lib049_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn062(int32 In0, const FVector& In1);
+	/** Benchmark callable node Lib049_Fn063 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn063(FVector& Out0, UObject* In1, FString& Out2, FString& Out3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib049_Fn064 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn064(bool In0);
+	/** Benchmark callable node Lib049_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn065(const FTransform& In0, const TArray< int32 >& In1, bool In2, bool In3, int32& Out4, UObject* In5, const FTransform& In6, FName In7);
+	/** Benchmark callable node Lib049_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn066(int32 In0, UObject* In1, const FString& In2, const TArray< int32 >& In3, int32 In4, const FTransform& In5);
+	/** Benchmark latent node Lib049_Fn067 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FTransform& In1);
+	/** Benchmark callable node Lib049_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn068(bool In0, int32& Out1, FString& Out2, int32& Out3, int32& Out4);
+	/** Benchmark latent node Lib049_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib049_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn070(const FTransform& In0, const FString& In1, const FTransform& In2);
+	/** Benchmark pure node Lib049_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn071();
+	/** Benchmark pure node Lib049_Fn072 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn072(UObject* In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib049_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn073(FString& Out0, int32 In1, UObject* In2, int32& Out3, float In4);
+	/** Benchmark pure node Lib049_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn074(FString& Out0, FString& Out1, const FString& In2, FVector& Out3, const FVector& In4, float In5);
+	/** Benchmark callable node Lib049_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn075(bool In0, int32 In1, const FTransform& In2, const FVector& In3, FVector& Out4, FName In5, FString& Out6, FVector& Out7);
+	/** Benchmark callable node Lib049_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn076(int32 In0, float In1, const FTransform& In2, FVector& Out3);
+	/** Benchmark pure node Lib049_Fn077 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn077(const FString& In0, float In1, FString& Out2, const FTransform& In3, FName In4);
+	/** Benchmark pure node Lib049_Fn078 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn078(float In0, const FString& In1, float In2, float In3, FString& Out4, const FVector& In5);
+	/** Benchmark pure node Lib049_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FVector Lib049_Fn079(int32& Out0, bool In1, FString& Out2, bool In3, float In4);
+	/** Benchmark callable node Lib049_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn080(const TArray< int32 >& In0, int32& Out1, float In2, int32& Out3, UObject* In4);
+	/** Benchmark pure node Lib049_Fn081 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn081(FName In0, const FVector& In1, const FTransform& In2, UObject* In3, bool In4);
+	/** Benchmark pure node Lib049_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn082(int32 In0, const FTransform& In1, FString& Out2);
+	/** Benchmark callable node Lib049_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn083(bool In0, const FString& In1, FName In2, const FTransform& In3, const FTransform& In4);
+	/** Benchmark callable node Lib049_Fn084 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn084();
+	/** Benchmark pure node Lib049_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn085(const TArray< int32 >& In0, bool In1, const FVector& In2, FString& Out3);
+	/** Benchmark latent node Lib049_Fn086 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FString& Out1, FString& Out2, const FVector& In3);
+	/** Benchmark callable node Lib049_Fn087 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static bool Lib049_Fn087(int32 In0, const TArray< int32 >& In1, float In2, const FTransform& In3, bool In4, int32& Out5);
+	/** Benchmark callable node Lib049_Fn088 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn088(UObject* In0, FString& Out1);
+	/** Benchmark callable node Lib049_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn089(FName In0, const FString& In1, const FString& In2);
+	/** Benchmark latent node Lib049_Fn090 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib049_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, FVector& Out2, int32& Out3, const FTransform& In4, const FVector& In5, UObject* In6, const FString& In7);
+	/** Benchmark callable node Lib049_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn091(float In0, const TArray< int32 >& In1, bool In2, const FTransform& In3);
+	/** Benchmark pure node Lib049_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn092();
+	/** Benchmark pure node Lib049_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn093(int32 In0, int32& Out1, int32 In2, float In3, int32& Out4, const FString& In5);
+	/** Benchmark callable node Lib049_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static float Lib049_Fn094(bool In0, const FVector& In1, int32& Out2);
+	/** Benchmark callable node Lib049_Fn095 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static FString Lib049_Fn095(bool In0, FVector& Out1, const TArray< int32 >& In2, const FString& In3, bool In4, const FString& In5, int32& Out6);
+	/** Benchmark pure node Lib049_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn096(FName In0, FName In1, FName In2);
+	/** Benchmark pure node Lib049_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn097(FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib049_Fn098 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static void Lib049_Fn098(int32 In0, const FTransform& In1, const TArray< int32 >& In2, const TArray< int32 >& In3, UObject* In4, FName In5, const TArray< int32 >& In6, float In7);
+	/** Benchmark callable node Lib049_Fn099 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib049")
+	static int32 Lib049_Fn099(bool In0, float In1, int32& Out2, UObject* In3, FString& Out4, FString& Out5, const FString& In6, int32& Out7);
+};
+
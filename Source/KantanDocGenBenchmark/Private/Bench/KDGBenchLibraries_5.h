@@ -0,0 +1,3105 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchLibraries_5.generated.h"
+
+
+UCLASS()
+class UKDGBenchLib_050 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib050_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn000(int32& Out0, const FVector& In1);
+	/** Benchmark callable node Lib050_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn001();
+	/** Benchmark pure node Lib050_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn002();
+	/** Benchmark callable node Lib050_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn003(int32& Out0, const FVector& In1, int32 In2, const TArray< int32 >& In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib050_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn004(const FString& In0, const FVector& In1);
+	/** Benchmark callable node Lib050_Fn005 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn005(FVector& Out0, float In1, float In2, const FString& In3, FName In4);
+	/** Benchmark pure node Lib050_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn006(float In0, const FVector& In1, FVector& Out2, FString& Out3, UObject* In4);
+	/** Benchmark pure node Lib050_Fn007 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn007(FName In0, const FVector& In1);
+	/** Benchmark callable node Lib050_Fn008 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn008(const FString& In0, int32& Out1, int32 In2, UObject* In3, int32& Out4, int32& Out5, bool In6);
+	/** Benchmark latent node Lib050_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FVector& Out1, FName In2, UObject* In3, bool In4, FName In5);
+	/** Benchmark callable node Lib050_Fn010 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn010(FName In0, FName In1, FName In2, FName In3, const FTransform& In4, const FTransform& In5, FVector& Out6, UObject* In7);
+	/** Benchmark pure node Lib050_Fn011 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn011(FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib050_Fn012 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn012();
+	/** Benchmark callable node Lib050_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn013(const TArray< int32 >& In0, FString& Out1);
+	/** Benchmark callable node Lib050_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn014(int32& Out0, FVector& Out1, UObject* In2, const TArray< int32 >& In3, float In4, int32& Out5, UObject* In6);
+	/** Benchmark callable node Lib050_Fn015 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn015(FString& Out0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark callable node Lib050_Fn016 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn016(FName In0, int32 In1);
+	/** Benchmark callable node Lib050_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn017(FString& Out0, UObject* In1, float In2, FString& Out3);
+	/** Benchmark callable node Lib050_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn018(const FTransform& In0);
+	/** Benchmark latent node Lib050_Fn019 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn019(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FName In1, FVector& Out2, const TArray< int32 >& In3, UObject* In4);
+	/** Benchmark callable node Lib050_Fn020 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn020(float In0, FVector& Out1, FString& Out2, bool In3, int32 In4, FVector& Out5);
+	/** Benchmark callable node Lib050_Fn021 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn021(const TArray< int32 >& In0, const FTransform& In1, FString& Out2, const FString& In3, int32& Out4, const FString& In5, FString& Out6);
+	/** Benchmark pure node Lib050_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn022(FString& Out0, int32 In1, const FString& In2, FString& Out3);
+	/** Benchmark callable node Lib050_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn023(bool In0, FString& Out1, int32& Out2, const FVector& In3, float In4);
+	/** Benchmark callable node Lib050_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn024(int32 In0, FString& Out1, float In2, float In3, const FString& In4, FVector& Out5, FName In6);
+	/** Benchmark callable node Lib050_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn025(const FTransform& In0, const FVector& In1, FName In2, int32 In3);
+	/** Benchmark pure node Lib050_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn026(const FVector& In0, UObject* In1);
+	/** Benchmark pure node Lib050_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn027(int32& Out0, const FString& In1, int32 In2, FString& Out3);
+	/** Benchmark callable node Lib050_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn028(const FTransform& In0, UObject* In1);
+	/** Benchmark callable node Lib050_Fn029 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn029(FName In0, float In1);
+	/** Benchmark pure node Lib050_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn030(FString& Out0, FName In1, UObject* In2, const FVector& In3, UObject* In4, int32& Out5, const FString& In6, int32& Out7);
+	/** Benchmark latent node Lib050_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib050_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn032(FString& Out0, FVector& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib050_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn033(FVector& Out0, FVector& Out1, const FTransform& In2, const FVector& In3, float In4);
+	/** Benchmark callable node Lib050_Fn034 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn034(FString& Out0, FString& Out1, const FTransform& In2);
+	/** Benchmark pure node Lib050_Fn035 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn035(bool In0, float In1, int32& Out2, FString& Out3, int32 In4);
+	/** Benchmark callable node Lib050_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn036(float In0, const TArray< int32 >& In1, int32& Out2, float In3, const FTransform& In4);
+	/** Benchmark callable node Lib050_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn037(FString& Out0, const FString& In1, const FTransform& In2, int32& Out3, const FString& In4, FVector& Out5, FString& Out6);
+	/** Benchmark callable node Lib050_Fn038 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn038(float In0, FString& Out1, UObject* In2);
+	/** Benchmark callable node Lib050_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn039(const FString& In0, int32& Out1);
+	/** Benchmark callable node Lib050_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn040(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, bool In3, FVector& Out4);
+	/** Benchmark callable node Lib050_Fn041 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn041();
+	/** Benchmark callable node Lib050_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn042(float In0, const FString& In1, int32& Out2, const FVector& In3, int32& Out4, const FVector& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib050_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn043(const TArray< int32 >& In0, float In1, int32 In2);
+	/** Benchmark pure node Lib050_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn044(const TArray< int32 >& In0, const FString& In1, FVector& Out2, int32& Out3, float In4, UObject* In5, FString& Out6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib050_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn045(int32& Out0, bool In1);
+	/** Benchmark callable node Lib050_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn046(const TArray< int32 >& In0, float In1, int32 In2, UObject* In3, float In4, FVector& Out5, const FString& In6, float In7);
+	/** Benchmark pure node Lib050_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn047(const FVector& In0, int32 In1, FString& Out2, FVector& Out3, float In4, int32& Out5);
+	/** Benchmark pure node Lib050_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn048(int32 In0, const FVector& In1, FVector& Out2, FName In3, float In4, const TArray< int32 >& In5, int32& Out6);
+	/** Benchmark pure node Lib050_Fn049 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn049(int32& Out0, FString& Out1, const FString& In2, int32& Out3);
+	/** Benchmark pure node Lib050_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn050(int32& Out0, float In1, UObject* In2, UObject* In3, FName In4);
+	/** Benchmark callable node Lib050_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn051(const FVector& In0, FVector& Out1, int32 In2, FString& Out3);
+	/** Benchmark callable node Lib050_Fn052 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn052(float In0, FName In1, FVector& Out2, bool In3, bool In4, UObject* In5);
+	/** Benchmark callable node Lib050_Fn053 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn053(FName In0, FString& Out1, const FTransform& In2, FString& Out3, FName In4, const FTransform& In5, const FString& In6);
+	/** Benchmark callable node Lib050_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn054(UObject* In0, int32& Out1, FName In2, FVector& Out3, const FTransform& In4, float In5);
+	/** Benchmark callable node Lib050_Fn055 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn055(int32 In0, const FString& In1, float In2, FString& Out3, float In4);
+	/** Benchmark callable node Lib050_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn056(float In0, FName In1, bool In2);
+	/** Benchmark pure node Lib050_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn057(FVector& Out0, FVector& Out1, FString& Out2, FName In3, const FVector& In4, bool In5);
+	/** Benchmark latent node Lib050_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FString& Out1);
+	/** Benchmark pure node Lib050_Fn059 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn059(const FTransform& In0);
+	/** Benchmark pure node Lib050_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn060(bool In0, const FVector& In1, bool In2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5, const FString& In6, FName In7);
+	/** Benchmark latent node Lib050_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1);
+	/** Benchmark latent node Lib050_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0);
+	/** Benchmark pure node Lib050_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn063(FName In0, const FVector& In1, FVector& Out2, const FString& In3);
+	/** Benchmark latent node Lib050_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib050_Fn065 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn065(const FString& In0, float In1, bool In2);
+	/** Benchmark pure node Lib050_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn066(int32& Out0, FString& Out1, const FVector& In2, const FVector& In3, FString& Out4);
+	/** Benchmark callable node Lib050_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn067(const FTransform& In0, bool In1, FName In2, FString& Out3, UObject* In4, bool In5);
+	/** Benchmark latent node Lib050_Fn068 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, bool In2, FString& Out3, FVector& Out4);
+	/** Benchmark callable node Lib050_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn069(const FString& In0, const FString& In1, FName In2, const FVector& In3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib050_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn070(const FVector& In0, float In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib050_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn071();
+	/** Benchmark pure node Lib050_Fn072 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn072(UObject* In0, float In1, FVector& Out2, float In3, const FVector& In4, UObject* In5, int32& Out6);
+	/** Benchmark callable node Lib050_Fn073 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FVector Lib050_Fn073(int32& Out0, int32& Out1, float In2, float In3, FName In4, int32 In5, FName In6);
+	/** Benchmark callable node Lib050_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn074(UObject* In0);
+	/** Benchmark pure node Lib050_Fn075 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn075(int32& Out0);
+	/** Benchmark pure node Lib050_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn076(FVector& Out0, FString& Out1, FString& Out2);
+	/** Benchmark callable node Lib050_Fn077 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn077(int32 In0, bool In1, int32 In2, const FString& In3, const TArray< int32 >& In4, const TArray< int32 >& In5, FName In6, FVector& Out7);
+	/** Benchmark callable node Lib050_Fn078 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn078(bool In0);
+	/** Benchmark callable node Lib050_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn079(FVector& Out0);
+	/** Benchmark callable node Lib050_Fn080 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn080(const FString& In0);
+	/** Benchmark callable node Lib050_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn081(FVector& Out0, FVector& Out1, FString& Out2, const TArray< int32 >& In3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib050_Fn082 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn082(bool In0, const FTransform& In1, const FVector& In2, int32 In3, int32 In4, const FVector& In5);
+	/** Benchmark callable node Lib050_Fn083 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static void Lib050_Fn083(const TArray< int32 >& In0, FVector& Out1, const TArray< int32 >& In2, int32& Out3);
+	/** Benchmark callable node Lib050_Fn084 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn084(bool In0);
+	/** Benchmark pure node Lib050_Fn085 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn085(float In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib050_Fn086 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn086(float In0, bool In1, FString& Out2);
+	/** Benchmark callable node Lib050_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn087(int32 In0);
+	/** Benchmark callable node Lib050_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn088(int32 In0, bool In1, FVector& Out2, int32 In3);
+	/** Benchmark callable node Lib050_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn089();
+	/** Benchmark latent node Lib050_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FVector& In1, FVector& Out2, int32& Out3, UObject* In4);
+	/** Benchmark pure node Lib050_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static int32 Lib050_Fn091(UObject* In0, FString& Out1, bool In2, FVector& Out3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark latent node Lib050_Fn092 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, FString& Out2);
+	/** Benchmark callable node Lib050_Fn093 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn093();
+	/** Benchmark callable node Lib050_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn094(UObject* In0);
+	/** Benchmark pure node Lib050_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static float Lib050_Fn095(int32 In0, const FVector& In1, const TArray< int32 >& In2, FVector& Out3, const FString& In4);
+	/** Benchmark pure node Lib050_Fn096 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn096(bool In0, const FTransform& In1, FVector& Out2, const FTransform& In3, FString& Out4, UObject* In5, float In6);
+	/** Benchmark latent node Lib050_Fn097 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib050_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, UObject* In1, int32 In2, const TArray< int32 >& In3, UObject* In4, bool In5, float In6, const FString& In7);
+	/** Benchmark callable node Lib050_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib050")
+	static bool Lib050_Fn098(const TArray< int32 >& In0, FName In1, int32 In2, int32& Out3, FName In4);
+	/** Benchmark pure node Lib050_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib050")
+	static FString Lib050_Fn099(const FTransform& In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_051 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib051_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn000(const TArray< int32 >& In0, UObject* In1, FVector& Out2, FVector& Out3, const FVector& In4, UObject* In5, const TArray< int32 >& In6, FName In7);
+	/** Benchmark latent node Lib051_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark pure node Lib051_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn002(UObject* In0, const FString& In1, const FTransform& In2, const FTransform& In3, int32 In4, FName In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib051_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn003(float In0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark latent node Lib051_Fn004 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark callable node Lib051_Fn005 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn005(float In0, const TArray< int32 >& In1, bool In2);
+	/** Benchmark callable node Lib051_Fn006 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn006(FString& Out0, UObject* In1, const FString& In2, int32& Out3, int32 In4, int32& Out5);
+	/** Benchmark callable node Lib051_Fn007 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn007(const FString& In0, const FVector& In1);
+	/** Benchmark callable node Lib051_Fn008 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn008(int32 In0, FVector& Out1, const FString& In2, int32& Out3, const FTransform& In4, int32 In5, int32& Out6);
+	/** Benchmark pure node Lib051_Fn009 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn009(int32& Out0, const FVector& In1, const FVector& In2, FString& Out3, FName In4, bool In5, int32& Out6);
+	/** Benchmark latent node Lib051_Fn010 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark latent node Lib051_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, const FString& In2, FVector& Out3, float In4);
+	/** Benchmark callable node Lib051_Fn012 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn012(float In0, FName In1, FString& Out2, float In3, const FString& In4);
+	/** Benchmark callable node Lib051_Fn013 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn013(const FTransform& In0, const FString& In1, float In2, bool In3, FString& Out4, FVector& Out5, const FVector& In6);
+	/** Benchmark callable node Lib051_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static void Lib051_Fn014(FName In0, int32 In1, const TArray< int32 >& In2, FVector& Out3, float In4, int32& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib051_Fn015 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static void Lib051_Fn015(const FTransform& In0, const FString& In1, FName In2);
+	/** Benchmark callable node Lib051_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn016();
+	/** Benchmark pure node Lib051_Fn017 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn017();
+	/** Benchmark pure node Lib051_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn018(bool In0, const FString& In1, FName In2, const FString& In3);
+	/** Benchmark callable node Lib051_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn019(FName In0, FVector& Out1, const FString& In2, bool In3, FVector& Out4);
+	/** Benchmark pure node Lib051_Fn020 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn020(float In0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib051_Fn021 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn021(float In0, const FString& In1, const FVector& In2, FName In3, FVector& Out4);
+	/** Benchmark pure node Lib051_Fn022 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn022(FVector& Out0, const TArray< int32 >& In1, const FString& In2, const FString& In3, UObject* In4);
+	/** Benchmark latent node Lib051_Fn023 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn023(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, FString& Out2, FVector& Out3, UObject* In4, float In5, int32& Out6);
+	/** Benchmark pure node Lib051_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn024(FName In0);
+	/** Benchmark callable node Lib051_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static void Lib051_Fn025(const FString& In0, FVector& Out1, const TArray< int32 >& In2, FVector& Out3, const TArray< int32 >& In4, const FVector& In5);
+	/** Benchmark callable node Lib051_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn026(int32& Out0, int32 In1, int32 In2, const TArray< int32 >& In3, int32& Out4, const TArray< int32 >& In5, float In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib051_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn027(const FTransform& In0, const FTransform& In1, const FVector& In2, UObject* In3);
+	/** Benchmark pure node Lib051_Fn028 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn028(const FTransform& In0, FString& Out1, FString& Out2, float In3, const FVector& In4, int32& Out5, int32& Out6, int32& Out7);
+	/** Benchmark pure node Lib051_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn029(UObject* In0, const TArray< int32 >& In1, const TArray< int32 >& In2, int32 In3, const TArray< int32 >& In4);
+	/** Benchmark latent node Lib051_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, int32 In2, const FString& In3);
+	/** Benchmark pure node Lib051_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn031(FName In0, const FString& In1, int32 In2, FName In3, const FTransform& In4);
+	/** Benchmark callable node Lib051_Fn032 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn032(UObject* In0, FString& Out1, FVector& Out2, FVector& Out3, float In4, int32 In5, FString& Out6);
+	/** Benchmark pure node Lib051_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn033(float In0, const FVector& In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib051_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn034(FName In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, const FTransform& In4, float In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib051_Fn035 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn035(int32& Out0, FName In1, const FString& In2, int32 In3);
+	/** Benchmark callable node Lib051_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn036(bool In0);
+	/** Benchmark pure node Lib051_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn037(const FTransform& In0, const FVector& In1, int32& Out2, const FString& In3);
+	/** Benchmark callable node Lib051_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn038(const FVector& In0);
+	/** Benchmark callable node Lib051_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn039(UObject* In0, const FString& In1, int32 In2, FString& Out3, const TArray< int32 >& In4, UObject* In5, int32 In6, const FVector& In7);
+	/** Benchmark callable node Lib051_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static void Lib051_Fn040(float In0, int32 In1, UObject* In2, FString& Out3);
+	/** Benchmark callable node Lib051_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn041(const TArray< int32 >& In0, bool In1, const FVector& In2, int32& Out3, FString& Out4);
+	/** Benchmark callable node Lib051_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn042(float In0, const FVector& In1, int32 In2, bool In3);
+	/** Benchmark pure node Lib051_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn043();
+	/** Benchmark callable node Lib051_Fn044 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn044(FString& Out0, int32 In1, int32 In2, FName In3);
+	/** Benchmark callable node Lib051_Fn045 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn045();
+	/** Benchmark pure node Lib051_Fn046 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn046(const FString& In0, const FString& In1, FString& Out2, const FVector& In3, FString& Out4);
+	/** Benchmark callable node Lib051_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn047(UObject* In0, float In1, UObject* In2);
+	/** Benchmark pure node Lib051_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn048();
+	/** Benchmark pure node Lib051_Fn049 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn049(UObject* In0, const FVector& In1, int32& Out2, FString& Out3, int32& Out4, UObject* In5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark pure node Lib051_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn050(FString& Out0, FVector& Out1, const FVector& In2, const FVector& In3, float In4, const FVector& In5);
+	/** Benchmark callable node Lib051_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn051(int32& Out0, FVector& Out1);
+	/** Benchmark pure node Lib051_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn052(const FString& In0, const FString& In1, FString& Out2);
+	/** Benchmark callable node Lib051_Fn053 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn053(const FString& In0, int32 In1, FVector& Out2, bool In3, const FTransform& In4);
+	/** Benchmark callable node Lib051_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn054(float In0);
+	/** Benchmark pure node Lib051_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn055(FString& Out0, FName In1, float In2);
+	/** Benchmark pure node Lib051_Fn056 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn056(const FTransform& In0);
+	/** Benchmark latent node Lib051_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FVector& Out1, const FString& In2, UObject* In3);
+	/** Benchmark callable node Lib051_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn058(const FString& In0, const FString& In1);
+	/** Benchmark pure node Lib051_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn059(FString& Out0, bool In1, UObject* In2);
+	/** Benchmark pure node Lib051_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn060(const TArray< int32 >& In0, float In1);
+	/** Benchmark callable node Lib051_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn061(FString& Out0);
+	/** Benchmark callable node Lib051_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn062(int32& Out0, const FVector& In1, int32 In2);
+	/** Benchmark callable node Lib051_Fn063 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn063(const TArray< int32 >& In0, const FString& In1, int32& Out2, bool In3, int32 In4, const FVector& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib051_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn064(float In0, const FTransform& In1, int32& Out2, int32& Out3, const TArray< int32 >& In4, FString& Out5, FName In6);
+	/** Benchmark callable node Lib051_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn065(const FTransform& In0);
+	/** Benchmark callable node Lib051_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn066(FName In0, bool In1, FVector& Out2, const FString& In3, const FVector& In4);
+	/** Benchmark callable node Lib051_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn067(int32 In0);
+	/** Benchmark callable node Lib051_Fn068 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn068(UObject* In0, const FVector& In1, int32& Out2, const FTransform& In3, FName In4, const TArray< int32 >& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib051_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn069(FVector& Out0, int32& Out1);
+	/** Benchmark latent node Lib051_Fn070 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1, FVector& Out2, UObject* In3, const TArray< int32 >& In4, const FString& In5, bool In6);
+	/** Benchmark pure node Lib051_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn071();
+	/** Benchmark callable node Lib051_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn072(int32& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, int32 In3, FName In4, const FString& In5);
+	/** Benchmark callable node Lib051_Fn073 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn073(FName In0, FVector& Out1, UObject* In2, float In3, const FVector& In4, int32 In5, const FVector& In6);
+	/** Benchmark callable node Lib051_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn074(const FString& In0);
+	/** Benchmark pure node Lib051_Fn075 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn075(int32 In0, UObject* In1, int32& Out2);
+	/** Benchmark latent node Lib051_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0);
+	/** Benchmark latent node Lib051_Fn077 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, FVector& Out1, FVector& Out2, bool In3, bool In4, int32 In5, const FVector& In6, UObject* In7);
+	/** Benchmark pure node Lib051_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn078(FVector& Out0, FVector& Out1, UObject* In2, FVector& Out3);
+	/** Benchmark pure node Lib051_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn079(const FString& In0, FName In1, UObject* In2, int32 In3, FVector& Out4);
+	/** Benchmark pure node Lib051_Fn080 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static bool Lib051_Fn080(int32& Out0, UObject* In1, int32 In2, FName In3, FName In4, const TArray< int32 >& In5, bool In6);
+	/** Benchmark pure node Lib051_Fn081 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn081(UObject* In0, const TArray< int32 >& In1, const TArray< int32 >& In2);
+	/** Benchmark latent node Lib051_Fn082 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1);
+	/** Benchmark pure node Lib051_Fn083 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn083(FVector& Out0, const FString& In1, float In2, FVector& Out3, int32& Out4, UObject* In5, float In6);
+	/** Benchmark callable node Lib051_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static void Lib051_Fn084(const FString& In0, FVector& Out1, FName In2, bool In3, const FString& In4, UObject* In5, float In6);
+	/** Benchmark pure node Lib051_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn085(float In0, const FVector& In1, const TArray< int32 >& In2, FName In3, FVector& Out4, const FTransform& In5, const FString& In6, bool In7);
+	/** Benchmark callable node Lib051_Fn086 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn086(const FTransform& In0, const TArray< int32 >& In1, UObject* In2);
+	/** Benchmark callable node Lib051_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn087(float In0, FVector& Out1, float In2);
+	/** Benchmark pure node Lib051_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn088(int32 In0, FVector& Out1, const FVector& In2, int32& Out3, FVector& Out4, FString& Out5, FString& Out6);
+	/** Benchmark callable node Lib051_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn089(const TArray< int32 >& In0, FVector& Out1);
+	/** Benchmark callable node Lib051_Fn090 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn090(const FTransform& In0, const FTransform& In1, const FVector& In2);
+	/** Benchmark callable node Lib051_Fn091 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn091(UObject* In0, FVector& Out1, FVector& Out2, FVector& Out3, const TArray< int32 >& In4, int32& Out5, int32& Out6);
+	/** Benchmark callable node Lib051_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FVector Lib051_Fn092();
+	/** Benchmark callable node Lib051_Fn093 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn093();
+	/** Benchmark callable node Lib051_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn094(bool In0, const FTransform& In1, UObject* In2, int32& Out3, int32& Out4, FVector& Out5, FVector& Out6, bool In7);
+	/** Benchmark callable node Lib051_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn095(int32 In0, FName In1, UObject* In2, const FString& In3, const TArray< int32 >& In4, bool In5, int32 In6, UObject* In7);
+	/** Benchmark callable node Lib051_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static FString Lib051_Fn096(UObject* In0, int32& Out1, const FString& In2, const FString& In3, FName In4);
+	/** Benchmark callable node Lib051_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static int32 Lib051_Fn097(int32 In0, FString& Out1, int32 In2, const FVector& In3, float In4, const FTransform& In5);
+	/** Benchmark callable node Lib051_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051")
+	static float Lib051_Fn098(bool In0, FVector& Out1, bool In2, const FString& In3, const FTransform& In4, const TArray< int32 >& In5, FName In6);
+	/** Benchmark latent node Lib051_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib051", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib051_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FVector& In1, int32 In2, const FVector& In3, float In4);
+};
+
+
+UCLASS()
+class UKDGBenchLib_052 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib052_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn000(float In0, int32& Out1, int32& Out2, float In3);
+	/** Benchmark pure node Lib052_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn001(int32 In0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark callable node Lib052_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn002(float In0, FString& Out1, FVector& Out2, int32& Out3, float In4, float In5);
+	/** Benchmark callable node Lib052_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn003(FString& Out0, FString& Out1, const FVector& In2, const FTransform& In3);
+	/** Benchmark callable node Lib052_Fn004 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn004(bool In0, const FTransform& In1, float In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib052_Fn005 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn005(UObject* In0, const FString& In1);
+	/** Benchmark pure node Lib052_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn006(bool In0, const TArray< int32 >& In1, FVector& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib052_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn007(FName In0, const FTransform& In1, const FVector& In2, int32& Out3, const TArray< int32 >& In4, const FVector& In5, const FTransform& In6);
+	/** Benchmark callable node Lib052_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn008(bool In0, FString& Out1, const FVector& In2, UObject* In3, FVector& Out4, FVector& Out5, const TArray< int32 >& In6, float In7);
+	/** Benchmark pure node Lib052_Fn009 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn009(int32 In0, FVector& Out1, float In2, FString& Out3, const FVector& In4);
+	/** Benchmark callable node Lib052_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn010();
+	/** Benchmark callable node Lib052_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn011(FString& Out0, const TArray< int32 >& In1, const FString& In2, bool In3, const FString& In4, FName In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib052_Fn012 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn012(const TArray< int32 >& In0, FVector& Out1, int32& Out2, FVector& Out3);
+	/** Benchmark pure node Lib052_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn013(int32 In0, UObject* In1);
+	/** Benchmark pure node Lib052_Fn014 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn014(FVector& Out0);
+	/** Benchmark callable node Lib052_Fn015 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn015(const TArray< int32 >& In0, UObject* In1);
+	/** Benchmark pure node Lib052_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn016(const FVector& In0, int32& Out1, FString& Out2, const FString& In3, const FTransform& In4, FString& Out5);
+	/** Benchmark latent node Lib052_Fn017 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, const FString& In2, float In3, const FString& In4, FVector& Out5, FName In6);
+	/** Benchmark callable node Lib052_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn018(int32 In0);
+	/** Benchmark callable node Lib052_Fn019 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn019(float In0, FVector& Out1, float In2);
+	/** Benchmark pure node Lib052_Fn020 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn020(const FTransform& In0, const FTransform& In1, int32& Out2, int32 In3, bool In4, FName In5);
+	/** Benchmark callable node Lib052_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn021(const FString& In0, float In1);
+	/** Benchmark callable node Lib052_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn022(const FVector& In0, const FString& In1, UObject* In2, float In3, const FTransform& In4, FString& Out5, FName In6);
+	/** Benchmark pure node Lib052_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn023(float In0, const FTransform& In1);
+	/** Benchmark callable node Lib052_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn024(const FTransform& In0, const FVector& In1, UObject* In2, const TArray< int32 >& In3, FString& Out4, int32 In5);
+	/** Benchmark pure node Lib052_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn025(bool In0);
+	/** Benchmark latent node Lib052_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib052_Fn027 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn027();
+	/** Benchmark callable node Lib052_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn028(FString& Out0);
+	/** Benchmark latent node Lib052_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, UObject* In1, FVector& Out2);
+	/** Benchmark latent node Lib052_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FTransform& In1, FName In2, int32 In3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib052_Fn031 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn031(float In0, FName In1, const FVector& In2, const FTransform& In3, const FVector& In4, const TArray< int32 >& In5, FString& Out6, float In7);
+	/** Benchmark callable node Lib052_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn032(FString& Out0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib052_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn033();
+	/** Benchmark callable node Lib052_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn034(bool In0, float In1, UObject* In2, FName In3);
+	/** Benchmark callable node Lib052_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn035(int32& Out0);
+	/** Benchmark callable node Lib052_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn036(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib052_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn037(const FString& In0, const TArray< int32 >& In1, const FTransform& In2, const FTransform& In3, const FVector& In4, bool In5, bool In6);
+	/** Benchmark callable node Lib052_Fn038 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn038(const FVector& In0, bool In1, const FString& In2, UObject* In3, UObject* In4);
+	/** Benchmark pure node Lib052_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn039(const TArray< int32 >& In0, int32& Out1, int32& Out2, const FVector& In3, FVector& Out4, const FVector& In5, const FTransform& In6);
+	/** Benchmark pure node Lib052_Fn040 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn040(const FTransform& In0);
+	/** Benchmark pure node Lib052_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn041(const FTransform& In0, int32& Out1, int32& Out2, FName In3);
+	/** Benchmark pure node Lib052_Fn042 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn042(const FTransform& In0, FString& Out1, const TArray< int32 >& In2, FName In3, bool In4, FString& Out5);
+	/** Benchmark callable node Lib052_Fn043 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn043(const FVector& In0);
+	/** Benchmark latent node Lib052_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32 In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const FTransform& In4, int32& Out5);
+	/** Benchmark latent node Lib052_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib052_Fn046 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn046(UObject* In0, int32 In1, int32& Out2);
+	/** Benchmark pure node Lib052_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn047(const FTransform& In0, int32& Out1, bool In2, FName In3, float In4, bool In5, const FVector& In6);
+	/** Benchmark callable node Lib052_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn048(int32& Out0, int32 In1, const TArray< int32 >& In2, UObject* In3);
+	/** Benchmark pure node Lib052_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn049(const FVector& In0, float In1);
+	/** Benchmark latent node Lib052_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, bool In1);
+	/** Benchmark pure node Lib052_Fn051 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn051(const TArray< int32 >& In0, const FTransform& In1, FString& Out2, int32 In3, const FTransform& In4, const FString& In5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark pure node Lib052_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn052();
+	/** Benchmark pure node Lib052_Fn053 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn053(float In0, const FTransform& In1, int32& Out2, bool In3, FVector& Out4);
+	/** Benchmark pure node Lib052_Fn054 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn054(const FString& In0, bool In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib052_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn055();
+	/** Benchmark pure node Lib052_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn056(int32 In0, FName In1, FString& Out2, float In3, int32& Out4, const FVector& In5, const TArray< int32 >& In6, const FString& In7);
+	/** Benchmark callable node Lib052_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn057(FString& Out0, const TArray< int32 >& In1, const FTransform& In2, bool In3, bool In4, FName In5, int32& Out6, int32 In7);
+	/** Benchmark callable node Lib052_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn058(bool In0, int32 In1);
+	/** Benchmark pure node Lib052_Fn059 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn059(const FString& In0, const FVector& In1, FString& Out2, const FTransform& In3, UObject* In4, int32 In5, const FString& In6);
+	/** Benchmark pure node Lib052_Fn060 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn060(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib052_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn061(FName In0, const TArray< int32 >& In1, UObject* In2, const TArray< int32 >& In3, FVector& Out4, UObject* In5, const FString& In6);
+	/** Benchmark callable node Lib052_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn062(FVector& Out0, FString& Out1, const FString& In2, const FTransform& In3);
+	/** Benchmark callable node Lib052_Fn063 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn063(const FVector& In0, bool In1, FName In2, FVector& Out3, const TArray< int32 >& In4, bool In5);
+	/** Benchmark latent node Lib052_Fn064 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FVector& Out1, const FVector& In2, FVector& Out3, const FString& In4, FString& Out5, bool In6);
+	/** Benchmark pure node Lib052_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn065();
+	/** Benchmark callable node Lib052_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn066(bool In0, const FTransform& In1, bool In2, bool In3, const FVector& In4, const FTransform& In5, const FString& In6);
+	/** Benchmark pure node Lib052_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn067(const FTransform& In0);
+	/** Benchmark callable node Lib052_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn068(bool In0, float In1, float In2, UObject* In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib052_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn069(const FVector& In0, float In1, bool In2, bool In3, const FString& In4, const FString& In5);
+	/** Benchmark callable node Lib052_Fn070 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn070();
+	/** Benchmark callable node Lib052_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn071(int32& Out0, FVector& Out1, const TArray< int32 >& In2, float In3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib052_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn072(FString& Out0, int32& Out1);
+	/** Benchmark pure node Lib052_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn073(int32& Out0, FString& Out1, const FTransform& In2, FVector& Out3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib052_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn074(FName In0, const FString& In1);
+	/** Benchmark callable node Lib052_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn075(const TArray< int32 >& In0, const FTransform& In1, int32& Out2, const FTransform& In3);
+	/** Benchmark pure node Lib052_Fn076 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn076(int32& Out0, UObject* In1, const TArray< int32 >& In2, int32 In3, FString& Out4, FString& Out5);
+	/** Benchmark callable node Lib052_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn077(bool In0);
+	/** Benchmark callable node Lib052_Fn078 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn078(UObject* In0, const FString& In1);
+	/** Benchmark callable node Lib052_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn079(const TArray< int32 >& In0, UObject* In1, const FTransform& In2);
+	/** Benchmark callable node Lib052_Fn080 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn080();
+	/** Benchmark callable node Lib052_Fn081 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn081(UObject* In0, int32 In1);
+	/** Benchmark callable node Lib052_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn082(const FVector& In0, float In1, const TArray< int32 >& In2, FString& Out3, FString& Out4);
+	/** Benchmark pure node Lib052_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn083(FVector& Out0, FVector& Out1);
+	/** Benchmark callable node Lib052_Fn084 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn084(FVector& Out0);
+	/** Benchmark callable node Lib052_Fn085 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn085(const FString& In0, const FString& In1, bool In2, UObject* In3, UObject* In4);
+	/** Benchmark callable node Lib052_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static float Lib052_Fn086(float In0, int32& Out1, float In2, FVector& Out3, int32 In4);
+	/** Benchmark pure node Lib052_Fn087 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn087(int32 In0, float In1, FVector& Out2, FVector& Out3, FName In4, const FVector& In5, const FString& In6, UObject* In7);
+	/** Benchmark callable node Lib052_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn088(FString& Out0, const FString& In1, int32& Out2);
+	/** Benchmark callable node Lib052_Fn089 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn089(const FString& In0, float In1, const FString& In2, const FVector& In3, UObject* In4, FString& Out5, int32 In6);
+	/** Benchmark pure node Lib052_Fn090 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn090(bool In0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib052_Fn091 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static bool Lib052_Fn091(int32 In0, FName In1, bool In2);
+	/** Benchmark callable node Lib052_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FString Lib052_Fn092();
+	/** Benchmark callable node Lib052_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn093(int32& Out0, const TArray< int32 >& In1, bool In2, float In3, FString& Out4, int32 In5, UObject* In6, UObject* In7);
+	/** Benchmark callable node Lib052_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn094(const FTransform& In0, UObject* In1, UObject* In2, int32& Out3, FVector& Out4, const FTransform& In5, FVector& Out6, bool In7);
+	/** Benchmark pure node Lib052_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib052")
+	static int32 Lib052_Fn095(const FTransform& In0, bool In1, FName In2, UObject* In3, const FString& In4);
+	/** Benchmark callable node Lib052_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn096(int32& Out0);
+	/** Benchmark callable node Lib052_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static FVector Lib052_Fn097(const FString& In0, UObject* In1, FName In2, bool In3, const FVector& In4, const FTransform& In5);
+	/** Benchmark callable node Lib052_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052")
+	static void Lib052_Fn098(float In0, FName In1, const TArray< int32 >& In2, bool In3, const FTransform& In4);
+	/** Benchmark latent node Lib052_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib052", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib052_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FTransform& In1, const FVector& In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_053 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib053_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn000(const FVector& In0, int32& Out1, const TArray< int32 >& In2, const FString& In3, const TArray< int32 >& In4, const FString& In5, UObject* In6, const FTransform& In7);
+	/** Benchmark callable node Lib053_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn001(float In0, FName In1, const TArray< int32 >& In2, const FVector& In3, int32 In4, const TArray< int32 >& In5, const TArray< int32 >& In6, float In7);
+	/** Benchmark callable node Lib053_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn002(FName In0, FVector& Out1, int32& Out2, const FTransform& In3, bool In4, const FTransform& In5);
+	/** Benchmark callable node Lib053_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn003(bool In0, FName In1, FVector& Out2, FName In3, bool In4, UObject* In5, UObject* In6);
+	/** Benchmark pure node Lib053_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn004(bool In0, FString& Out1);
+	/** Benchmark callable node Lib053_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn005(float In0);
+	/** Benchmark callable node Lib053_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn006(int32& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib053_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn007(FVector& Out0, const FVector& In1, int32& Out2, const FString& In3);
+	/** Benchmark callable node Lib053_Fn008 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn008(const FTransform& In0, const FTransform& In1, FString& Out2);
+	/** Benchmark pure node Lib053_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn009(bool In0, int32 In1, const FVector& In2, int32& Out3);
+	/** Benchmark callable node Lib053_Fn010 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn010(FName In0, FVector& Out1, UObject* In2, const FVector& In3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib053_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn011(const FTransform& In0);
+	/** Benchmark callable node Lib053_Fn012 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn012(const FTransform& In0, const FTransform& In1, const FTransform& In2, const TArray< int32 >& In3, FString& Out4);
+	/** Benchmark latent node Lib053_Fn013 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib053_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, float In1);
+	/** Benchmark callable node Lib053_Fn014 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn014(FString& Out0);
+	/** Benchmark pure node Lib053_Fn015 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn015(FName In0, int32 In1, FString& Out2, bool In3, FVector& Out4);
+	/** Benchmark pure node Lib053_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn016();
+	/** Benchmark pure node Lib053_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn017(const TArray< int32 >& In0, float In1, FName In2, FVector& Out3, UObject* In4, bool In5, const TArray< int32 >& In6, FName In7);
+	/** Benchmark callable node Lib053_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn018(FString& Out0, int32& Out1, FName In2, int32 In3, int32& Out4, FString& Out5, float In6);
+	/** Benchmark callable node Lib053_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn019(FString& Out0, const FVector& In1, FVector& Out2, FName In3, bool In4, FName In5, int32 In6, FName In7);
+	/** Benchmark callable node Lib053_Fn020 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn020(const FTransform& In0, FVector& Out1, const FString& In2, FString& Out3);
+	/** Benchmark pure node Lib053_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn021(const FTransform& In0, float In1);
+	/** Benchmark callable node Lib053_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn022(int32& Out0, int32& Out1, int32 In2, const FTransform& In3);
+	/** Benchmark pure node Lib053_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn023(FVector& Out0, bool In1);
+	/** Benchmark callable node Lib053_Fn024 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn024(int32 In0, FVector& Out1, const FString& In2, const FTransform& In3);
+	/** Benchmark callable node Lib053_Fn025 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn025(const FString& In0, bool In1, const TArray< int32 >& In2, FName In3, const FVector& In4, float In5, const FString& In6);
+	/** Benchmark callable node Lib053_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn026(float In0, UObject* In1, FVector& Out2, const FVector& In3, bool In4);
+	/** Benchmark pure node Lib053_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn027(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib053_Fn028 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn028();
+	/** Benchmark callable node Lib053_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn029(int32& Out0);
+	/** Benchmark callable node Lib053_Fn030 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn030(const FString& In0, const FTransform& In1, const FVector& In2);
+	/** Benchmark callable node Lib053_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn031(int32 In0, const TArray< int32 >& In1, const FVector& In2, int32& Out3, FName In4, const FString& In5, const FTransform& In6);
+	/** Benchmark callable node Lib053_Fn032 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn032(float In0, FName In1, UObject* In2, FVector& Out3, bool In4, FVector& Out5);
+	/** Benchmark callable node Lib053_Fn033 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn033(float In0);
+	/** Benchmark pure node Lib053_Fn034 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn034(FVector& Out0, int32& Out1, const FVector& In2);
+	/** Benchmark callable node Lib053_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn035(UObject* In0, FString& Out1);
+	/** Benchmark callable node Lib053_Fn036 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn036();
+	/** Benchmark callable node Lib053_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn037(FName In0, int32& Out1, FString& Out2, const FString& In3);
+	/** Benchmark callable node Lib053_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn038(FVector& Out0, FString& Out1, const FString& In2, const FTransform& In3);
+	/** Benchmark callable node Lib053_Fn039 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn039(bool In0, FName In1, int32 In2, const FVector& In3, const FString& In4, FString& Out5);
+	/** Benchmark callable node Lib053_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn040(UObject* In0, bool In1, const FString& In2, float In3, FName In4, const FString& In5);
+	/** Benchmark callable node Lib053_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn041(int32 In0, const TArray< int32 >& In1, int32 In2, UObject* In3, const FTransform& In4);
+	/** Benchmark callable node Lib053_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn042(bool In0, const FTransform& In1, float In2, const FVector& In3, int32 In4, FVector& Out5, bool In6);
+	/** Benchmark callable node Lib053_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn043(int32 In0, const FString& In1, int32 In2, const FTransform& In3, const FVector& In4, int32 In5);
+	/** Benchmark latent node Lib053_Fn044 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib053_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib053_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn045(UObject* In0, float In1, bool In2);
+	/** Benchmark pure node Lib053_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn046(FString& Out0, int32 In1, FString& Out2, bool In3, UObject* In4, FString& Out5, const FVector& In6);
+	/** Benchmark callable node Lib053_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn047(FString& Out0, const FVector& In1, int32& Out2, FString& Out3, float In4, const FTransform& In5, int32 In6);
+	/** Benchmark callable node Lib053_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn048(FString& Out0, const FString& In1, FName In2, float In3, float In4, int32 In5, FName In6);
+	/** Benchmark pure node Lib053_Fn049 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn049(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib053_Fn050 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn050(const TArray< int32 >& In0, int32 In1, FVector& Out2);
+	/** Benchmark pure node Lib053_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn051(const TArray< int32 >& In0, int32 In1, int32& Out2, int32& Out3, const FString& In4);
+	/** Benchmark callable node Lib053_Fn052 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn052(int32 In0, int32 In1, FName In2, UObject* In3, const FString& In4);
+	/** Benchmark callable node Lib053_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn053();
+	/** Benchmark callable node Lib053_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn054(bool In0, const TArray< int32 >& In1, FVector& Out2, FName In3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib053_Fn055 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn055(int32 In0);
+	/** Benchmark pure node Lib053_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn056(const FVector& In0, int32& Out1, const FVector& In2, const FVector& In3, int32& Out4, int32 In5, float In6, FString& Out7);
+	/** Benchmark callable node Lib053_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn057(FVector& Out0, FString& Out1, bool In2, const FString& In3, const FVector& In4, float In5);
+	/** Benchmark pure node Lib053_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn058(const FTransform& In0, const FString& In1, int32 In2, FName In3, FString& Out4, float In5);
+	/** Benchmark callable node Lib053_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn059(FName In0, FVector& Out1, FString& Out2, int32 In3);
+	/** Benchmark callable node Lib053_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn060(int32& Out0, UObject* In1);
+	/** Benchmark latent node Lib053_Fn061 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib053_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib053_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn062(FVector& Out0, int32& Out1, UObject* In2, FVector& Out3, float In4);
+	/** Benchmark pure node Lib053_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn063(FName In0, const FString& In1);
+	/** Benchmark pure node Lib053_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn064(int32& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib053_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn065(const FString& In0, const FTransform& In1, FString& Out2, FVector& Out3, bool In4, UObject* In5, float In6, int32 In7);
+	/** Benchmark callable node Lib053_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn066(const FTransform& In0, FString& Out1, int32& Out2, FVector& Out3, const FVector& In4, const FString& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib053_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn067(const FVector& In0, UObject* In1, FString& Out2, int32& Out3, int32 In4);
+	/** Benchmark pure node Lib053_Fn068 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn068(int32 In0, float In1);
+	/** Benchmark callable node Lib053_Fn069 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn069(UObject* In0, int32 In1, const FTransform& In2, const FVector& In3, bool In4, UObject* In5, FVector& Out6);
+	/** Benchmark callable node Lib053_Fn070 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn070(bool In0, const FString& In1, FVector& Out2, const FString& In3, FVector& Out4);
+	/** Benchmark callable node Lib053_Fn071 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn071(bool In0, const FTransform& In1, int32& Out2, bool In3);
+	/** Benchmark callable node Lib053_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn072(UObject* In0, FName In1, const FTransform& In2, UObject* In3, const TArray< int32 >& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib053_Fn073 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn073();
+	/** Benchmark callable node Lib053_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn074(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib053_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn075(const FString& In0, int32& Out1, const TArray< int32 >& In2, const FString& In3, const FString& In4, const FTransform& In5, float In6, const FTransform& In7);
+	/** Benchmark callable node Lib053_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn076(bool In0, int32 In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib053_Fn077 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn077(const FTransform& In0, int32& Out1, FVector& Out2, FString& Out3, int32 In4, FVector& Out5, float In6, const FTransform& In7);
+	/** Benchmark callable node Lib053_Fn078 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn078(bool In0);
+	/** Benchmark callable node Lib053_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn079();
+	/** Benchmark callable node Lib053_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn080(const TArray< int32 >& In0, int32 In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib053_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn081(FName In0, UObject* In1, float In2, FVector& Out3, int32& Out4, const FString& In5);
+	/** Benchmark callable node Lib053_Fn082 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FString Lib053_Fn082();
+	/** Benchmark callable node Lib053_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn083(int32 In0, int32& Out1);
+	/** Benchmark callable node Lib053_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn084(FName In0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib053_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn085(FName In0, int32& Out1, const FTransform& In2, UObject* In3, FName In4, const FString& In5, const FString& In6);
+	/** Benchmark pure node Lib053_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn086(FVector& Out0, UObject* In1, const FTransform& In2, bool In3, const TArray< int32 >& In4, int32& Out5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib053_Fn087 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn087(FString& Out0, int32& Out1, FVector& Out2, FName In3);
+	/** Benchmark pure node Lib053_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn088();
+	/** Benchmark pure node Lib053_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn089(int32& Out0, int32& Out1, float In2);
+	/** Benchmark callable node Lib053_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static void Lib053_Fn090(float In0, const FTransform& In1, const FString& In2, FVector& Out3);
+	/** Benchmark pure node Lib053_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn091(int32& Out0, int32& Out1, const FString& In2, float In3, const FVector& In4);
+	/** Benchmark callable node Lib053_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn092();
+	/** Benchmark pure node Lib053_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static bool Lib053_Fn093(const FTransform& In0, float In1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib053_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn094(int32 In0);
+	/** Benchmark callable node Lib053_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static float Lib053_Fn095(FString& Out0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark pure node Lib053_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static FVector Lib053_Fn096(UObject* In0, FName In1, int32& Out2);
+	/** Benchmark latent node Lib053_Fn097 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib053_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FName In1, const TArray< int32 >& In2, FName In3, const FString& In4, UObject* In5, FVector& Out6, float In7);
+	/** Benchmark pure node Lib053_Fn098 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn098(const FTransform& In0, const FString& In1, bool In2, float In3, const FVector& In4, float In5, bool In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib053_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib053")
+	static int32 Lib053_Fn099(bool In0, const FVector& In1, const FString& In2, float In3);
+};
+
+
+UCLASS()
+class UKDGBenchLib_054 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib054_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn000(UObject* In0, bool In1, FVector& Out2, FVector& Out3, UObject* In4, int32 In5, FString& Out6);
+	/** Benchmark callable node Lib054_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn001(const FTransform& In0, float In1, FName In2, FString& Out3, const FString& In4, UObject* In5, float In6);
+	/** Benchmark callable node Lib054_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn002(const FVector& In0, const FVector& In1, FString& Out2, const FString& In3, FVector& Out4);
+	/** Benchmark pure node Lib054_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn003(int32& Out0, UObject* In1, bool In2);
+	/** Benchmark callable node Lib054_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn004(const FVector& In0);
+	/** Benchmark callable node Lib054_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn005(int32& Out0);
+	/** Benchmark pure node Lib054_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn006(UObject* In0, FString& Out1, const FString& In2, const FString& In3, int32& Out4);
+	/** Benchmark pure node Lib054_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn007(int32 In0, int32 In1, UObject* In2);
+	/** Benchmark callable node Lib054_Fn008 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn008(bool In0);
+	/** Benchmark callable node Lib054_Fn009 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn009();
+	/** Benchmark callable node Lib054_Fn010 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn010(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib054_Fn011 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn011(const TArray< int32 >& In0, int32 In1);
+	/** Benchmark pure node Lib054_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn012(FVector& Out0, FName In1, const FTransform& In2, const FTransform& In3, const FTransform& In4, const FString& In5, int32& Out6, FName In7);
+	/** Benchmark callable node Lib054_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn013(const FTransform& In0, int32& Out1, FString& Out2);
+	/** Benchmark pure node Lib054_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn014(int32& Out0, float In1, FVector& Out2);
+	/** Benchmark callable node Lib054_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn015(const FTransform& In0, bool In1, const FString& In2, const TArray< int32 >& In3, FString& Out4, const TArray< int32 >& In5, const FTransform& In6, UObject* In7);
+	/** Benchmark latent node Lib054_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib054_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FString& Out1, const FVector& In2, int32& Out3, int32 In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib054_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn017(UObject* In0, FName In1, const FTransform& In2, const FVector& In3, const FString& In4, const FString& In5, int32& Out6, bool In7);
+	/** Benchmark callable node Lib054_Fn018 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn018();
+	/** Benchmark callable node Lib054_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn019(const FTransform& In0, int32& Out1, UObject* In2, const FString& In3, int32 In4);
+	/** Benchmark callable node Lib054_Fn020 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn020(const FVector& In0, int32 In1, const FString& In2, const TArray< int32 >& In3, int32& Out4, UObject* In5);
+	/** Benchmark pure node Lib054_Fn021 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn021(bool In0, int32& Out1, FName In2, int32 In3, const FTransform& In4, bool In5, int32 In6);
+	/** Benchmark pure node Lib054_Fn022 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn022(int32& Out0, FName In1);
+	/** Benchmark pure node Lib054_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn023();
+	/** Benchmark callable node Lib054_Fn024 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn024(const FVector& In0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark latent node Lib054_Fn025 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib054_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FString& In1, int32 In2, const FTransform& In3, const TArray< int32 >& In4, int32 In5, FVector& Out6, FName In7);
+	/** Benchmark latent node Lib054_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib054_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib054_Fn027 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn027(FName In0, const FVector& In1, FString& Out2, const FVector& In3, const FString& In4);
+	/** Benchmark pure node Lib054_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn028(int32& Out0, FVector& Out1, const TArray< int32 >& In2, float In3, int32& Out4, float In5, float In6);
+	/** Benchmark callable node Lib054_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn029();
+	/** Benchmark callable node Lib054_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn030(UObject* In0, FName In1, float In2, FName In3, int32 In4, FVector& Out5);
+	/** Benchmark callable node Lib054_Fn031 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn031(const FVector& In0, FName In1, UObject* In2, float In3);
+	/** Benchmark callable node Lib054_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn032(const FVector& In0, FString& Out1, const TArray< int32 >& In2, int32& Out3, const FVector& In4, int32& Out5, const FString& In6, int32 In7);
+	/** Benchmark pure node Lib054_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn033(const FTransform& In0, const TArray< int32 >& In1, const FTransform& In2, float In3);
+	/** Benchmark pure node Lib054_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn034(FVector& Out0, UObject* In1, const FTransform& In2, bool In3);
+	/** Benchmark callable node Lib054_Fn035 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn035();
+	/** Benchmark callable node Lib054_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn036(const FVector& In0, FVector& Out1, int32 In2, FName In3, int32& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, FVector& Out7);
+	/** Benchmark latent node Lib054_Fn037 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib054_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark callable node Lib054_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn038(const FTransform& In0, UObject* In1, const TArray< int32 >& In2, const FString& In3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib054_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn039(FString& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, FVector& Out3, const FVector& In4, FName In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib054_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn040(float In0, UObject* In1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib054_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn041(bool In0, UObject* In1, bool In2, int32& Out3, const FVector& In4, const FVector& In5, FVector& Out6, const FVector& In7);
+	/** Benchmark pure node Lib054_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn042(FName In0, float In1, int32& Out2, UObject* In3);
+	/** Benchmark pure node Lib054_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn043();
+	/** Benchmark callable node Lib054_Fn044 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn044(const TArray< int32 >& In0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib054_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn045(UObject* In0, const FString& In1);
+	/** Benchmark callable node Lib054_Fn046 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn046(FVector& Out0, FName In1, int32 In2);
+	/** Benchmark latent node Lib054_Fn047 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib054_Fn047(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FString& In1, int32 In2, int32 In3, bool In4, FString& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib054_Fn048 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn048(float In0, int32& Out1, int32 In2);
+	/** Benchmark latent node Lib054_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib054_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1, FVector& Out2, FVector& Out3);
+	/** Benchmark pure node Lib054_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn050(int32 In0, float In1);
+	/** Benchmark callable node Lib054_Fn051 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn051(const FVector& In0, const FString& In1, const FString& In2);
+	/** Benchmark callable node Lib054_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn052(UObject* In0, float In1, FName In2);
+	/** Benchmark pure node Lib054_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn053();
+	/** Benchmark pure node Lib054_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn054(bool In0, int32 In1, const FTransform& In2, FName In3, FVector& Out4, float In5, int32& Out6);
+	/** Benchmark pure node Lib054_Fn055 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn055(bool In0, float In1, FString& Out2, FString& Out3, const FTransform& In4, const FVector& In5, FVector& Out6, FName In7);
+	/** Benchmark callable node Lib054_Fn056 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn056(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib054_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn057(const FVector& In0);
+	/** Benchmark callable node Lib054_Fn058 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn058(FString& Out0, FString& Out1);
+	/** Benchmark latent node Lib054_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib054_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FString& Out1, FName In2, float In3);
+	/** Benchmark pure node Lib054_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn060();
+	/** Benchmark callable node Lib054_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn061(int32 In0, const FVector& In1, int32& Out2, const FVector& In3);
+	/** Benchmark pure node Lib054_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn062(int32& Out0, FString& Out1, FString& Out2, bool In3, const FVector& In4, const FString& In5);
+	/** Benchmark callable node Lib054_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn063(FVector& Out0, const TArray< int32 >& In1, float In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib054_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn064(int32& Out0, const FVector& In1);
+	/** Benchmark callable node Lib054_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn065(const FVector& In0, FString& Out1, const FString& In2, FString& Out3, float In4, const FVector& In5);
+	/** Benchmark callable node Lib054_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn066(bool In0, UObject* In1, int32 In2, FName In3);
+	/** Benchmark callable node Lib054_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn067(const FString& In0, const FString& In1, const TArray< int32 >& In2, FVector& Out3, bool In4, const FString& In5, const FTransform& In6);
+	/** Benchmark callable node Lib054_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn068(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib054_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn069(float In0, const TArray< int32 >& In1, int32& Out2, FString& Out3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib054_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn070(const TArray< int32 >& In0, FString& Out1, FVector& Out2, FVector& Out3, const FVector& In4, float In5, float In6);
+	/** Benchmark callable node Lib054_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn071();
+	/** Benchmark callable node Lib054_Fn072 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn072(const FVector& In0);
+	/** Benchmark callable node Lib054_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn073(int32& Out0);
+	/** Benchmark callable node Lib054_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn074(FString& Out0, const FTransform& In1, const TArray< int32 >& In2, const FTransform& In3, int32 In4, const FTransform& In5);
+	/** Benchmark callable node Lib054_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn075(int32 In0, const FTransform& In1, int32 In2, bool In3, int32& Out4, FVector& Out5, FName In6);
+	/** Benchmark callable node Lib054_Fn076 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn076(UObject* In0, const FTransform& In1, int32& Out2, const FVector& In3, float In4, const FTransform& In5, int32 In6, bool In7);
+	/** Benchmark pure node Lib054_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn077();
+	/** Benchmark pure node Lib054_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn078();
+	/** Benchmark callable node Lib054_Fn079 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn079(FVector& Out0, const FString& In1, float In2, FVector& Out3, const FTransform& In4, bool In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib054_Fn080 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn080(const TArray< int32 >& In0, UObject* In1, UObject* In2, int32 In3, int32 In4, FVector& Out5);
+	/** Benchmark callable node Lib054_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn081(float In0, const FString& In1, UObject* In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib054_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn082(bool In0, FVector& Out1, const FTransform& In2, FString& Out3, const FString& In4, FString& Out5, const FString& In6, UObject* In7);
+	/** Benchmark pure node Lib054_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn083();
+	/** Benchmark callable node Lib054_Fn084 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn084(const TArray< int32 >& In0, bool In1, FVector& Out2, FName In3);
+	/** Benchmark pure node Lib054_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn085();
+	/** Benchmark callable node Lib054_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn086(bool In0, int32& Out1);
+	/** Benchmark callable node Lib054_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn087(const FTransform& In0);
+	/** Benchmark pure node Lib054_Fn088 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn088(int32& Out0, FName In1, FVector& Out2, const FTransform& In3, FName In4);
+	/** Benchmark callable node Lib054_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn089(const FTransform& In0, const FTransform& In1, int32 In2);
+	/** Benchmark callable node Lib054_Fn090 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn090(const TArray< int32 >& In0, const FTransform& In1, FString& Out2, int32 In3, FName In4);
+	/** Benchmark callable node Lib054_Fn091 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static float Lib054_Fn091(FString& Out0, bool In1, FVector& Out2);
+	/** Benchmark pure node Lib054_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn092();
+	/** Benchmark pure node Lib054_Fn093 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static FVector Lib054_Fn093(FName In0, FString& Out1, FName In2);
+	/** Benchmark callable node Lib054_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn094(FString& Out0, const TArray< int32 >& In1, int32& Out2, UObject* In3, FName In4, const FString& In5, FName In6, float In7);
+	/** Benchmark callable node Lib054_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static FString Lib054_Fn095(float In0, const TArray< int32 >& In1, const FTransform& In2, FName In3, FVector& Out4, const TArray< int32 >& In5, const FTransform& In6, bool In7);
+	/** Benchmark pure node Lib054_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static bool Lib054_Fn096(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib054_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib054")
+	static int32 Lib054_Fn097(bool In0, const FTransform& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib054_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn098(FVector& Out0, int32& Out1, float In2, FString& Out3, int32& Out4);
+	/** Benchmark callable node Lib054_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib054")
+	static void Lib054_Fn099(const FTransform& In0, const TArray< int32 >& In1, const FString& In2, const TArray< int32 >& In3, bool In4, int32& Out5, float In6);
+};
+
+
+UCLASS()
+class UKDGBenchLib_055 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib055_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn000(const FTransform& In0, int32& Out1, bool In2, int32 In3, const FString& In4, const FVector& In5, FVector& Out6);
+	/** Benchmark pure node Lib055_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn001(float In0, UObject* In1, float In2, FVector& Out3, int32& Out4, int32 In5, const FTransform& In6, UObject* In7);
+	/** Benchmark callable node Lib055_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn002();
+	/** Benchmark callable node Lib055_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn003(UObject* In0);
+	/** Benchmark callable node Lib055_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn004(FName In0);
+	/** Benchmark callable node Lib055_Fn005 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn005(const TArray< int32 >& In0, const FString& In1);
+	/** Benchmark callable node Lib055_Fn006 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn006(const FTransform& In0);
+	/** Benchmark callable node Lib055_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn007(UObject* In0, float In1, const FVector& In2, const FTransform& In3, const FTransform& In4);
+	/** Benchmark callable node Lib055_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn008(float In0, const TArray< int32 >& In1, FString& Out2, FName In3, FName In4, const TArray< int32 >& In5, const FVector& In6, UObject* In7);
+	/** Benchmark callable node Lib055_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn009(const TArray< int32 >& In0, UObject* In1, const TArray< int32 >& In2, bool In3);
+	/** Benchmark callable node Lib055_Fn010 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn010(int32 In0, bool In1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib055_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn011(const FString& In0);
+	/** Benchmark callable node Lib055_Fn012 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn012(int32& Out0, FName In1, FString& Out2, const TArray< int32 >& In3);
+	/** Benchmark latent node Lib055_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib055_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark pure node Lib055_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn014(const TArray< int32 >& In0, FString& Out1, FName In2);
+	/** Benchmark pure node Lib055_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn015(const TArray< int32 >& In0, int32 In1, UObject* In2, int32& Out3, const FVector& In4, const TArray< int32 >& In5, UObject* In6);
+	/** Benchmark callable node Lib055_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn016(FName In0, bool In1, const FString& In2);
+	/** Benchmark pure node Lib055_Fn017 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn017(const FVector& In0, bool In1, FVector& Out2, const FTransform& In3, FVector& Out4, int32 In5, FVector& Out6);
+	/** Benchmark callable node Lib055_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn018(FVector& Out0, float In1, int32 In2, UObject* In3, const FString& In4, int32& Out5);
+	/** Benchmark pure node Lib055_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn019(FVector& Out0, FVector& Out1, bool In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib055_Fn020 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn020(UObject* In0, FString& Out1, FName In2, FName In3);
+	/** Benchmark pure node Lib055_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn021(const FTransform& In0, const FString& In1, FVector& Out2, FName In3);
+	/** Benchmark callable node Lib055_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn022(const FTransform& In0, const TArray< int32 >& In1, FString& Out2, const FString& In3, FName In4, const TArray< int32 >& In5, int32 In6);
+	/** Benchmark callable node Lib055_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn023(int32 In0, const FString& In1, const FTransform& In2);
+	/** Benchmark callable node Lib055_Fn024 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn024(bool In0, int32& Out1, bool In2, int32 In3, int32 In4);
+	/** Benchmark callable node Lib055_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn025(FString& Out0, float In1);
+	/** Benchmark latent node Lib055_Fn026 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib055_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib055_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn027(FVector& Out0);
+	/** Benchmark pure node Lib055_Fn028 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn028(FString& Out0, int32 In1, FName In2);
+	/** Benchmark callable node Lib055_Fn029 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn029(const FString& In0, int32 In1, int32 In2, UObject* In3);
+	/** Benchmark callable node Lib055_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn030(FString& Out0, const FVector& In1, FString& Out2, int32& Out3, bool In4, FVector& Out5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib055_Fn031 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn031(const TArray< int32 >& In0, int32& Out1, int32 In2);
+	/** Benchmark pure node Lib055_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn032(int32& Out0, FName In1, FVector& Out2);
+	/** Benchmark pure node Lib055_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn033(FString& Out0, const FVector& In1, bool In2, const FVector& In3);
+	/** Benchmark callable node Lib055_Fn034 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn034(float In0, float In1, bool In2);
+	/** Benchmark callable node Lib055_Fn035 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn035(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, FName In3);
+	/** Benchmark callable node Lib055_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn036(float In0, const FTransform& In1, int32& Out2, bool In3, const TArray< int32 >& In4, FVector& Out5);
+	/** Benchmark callable node Lib055_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn037();
+	/** Benchmark callable node Lib055_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn038(FVector& Out0, FName In1, const TArray< int32 >& In2, int32& Out3, FString& Out4, FString& Out5);
+	/** Benchmark pure node Lib055_Fn039 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn039(FVector& Out0);
+	/** Benchmark callable node Lib055_Fn040 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn040(FName In0);
+	/** Benchmark callable node Lib055_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn041(FString& Out0);
+	/** Benchmark pure node Lib055_Fn042 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn042();
+	/** Benchmark callable node Lib055_Fn043 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn043(UObject* In0, FString& Out1, float In2, FString& Out3);
+	/** Benchmark pure node Lib055_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn044(int32& Out0, FString& Out1, UObject* In2, const FVector& In3, FName In4);
+	/** Benchmark callable node Lib055_Fn045 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn045(FVector& Out0, int32 In1, const FTransform& In2, FString& Out3, bool In4, const FTransform& In5, FString& Out6);
+	/** Benchmark callable node Lib055_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn046(int32& Out0);
+	/** Benchmark callable node Lib055_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn047(UObject* In0, const FVector& In1);
+	/** Benchmark latent node Lib055_Fn048 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib055_Fn048(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, FVector& Out2);
+	/** Benchmark pure node Lib055_Fn049 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn049(bool In0, FString& Out1, float In2, const FTransform& In3);
+	/** Benchmark callable node Lib055_Fn050 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn050(FString& Out0, const FTransform& In1, FName In2, bool In3, FName In4, float In5);
+	/** Benchmark callable node Lib055_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn051(FVector& Out0, int32& Out1);
+	/** Benchmark callable node Lib055_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn052(FVector& Out0, const FTransform& In1, FName In2);
+	/** Benchmark callable node Lib055_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn053(const FVector& In0, FVector& Out1, const TArray< int32 >& In2);
+	/** Benchmark latent node Lib055_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib055_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib055_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn055(const FString& In0, FVector& Out1);
+	/** Benchmark pure node Lib055_Fn056 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn056(const FTransform& In0, int32 In1);
+	/** Benchmark callable node Lib055_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn057(int32& Out0, FString& Out1, float In2, UObject* In3, FVector& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, int32& Out7);
+	/** Benchmark pure node Lib055_Fn058 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn058(float In0);
+	/** Benchmark callable node Lib055_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn059(const FTransform& In0, const FVector& In1, FVector& Out2, FString& Out3);
+	/** Benchmark callable node Lib055_Fn060 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn060(const TArray< int32 >& In0, int32& Out1, const FVector& In2, float In3, FString& Out4);
+	/** Benchmark pure node Lib055_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn061(const FString& In0);
+	/** Benchmark callable node Lib055_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn062(float In0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib055_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn063(bool In0, FName In1, UObject* In2);
+	/** Benchmark callable node Lib055_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn064();
+	/** Benchmark pure node Lib055_Fn065 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn065(FString& Out0, UObject* In1, int32& Out2, bool In3, UObject* In4, FString& Out5, const FString& In6);
+	/** Benchmark callable node Lib055_Fn066 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn066(UObject* In0);
+	/** Benchmark pure node Lib055_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn067(UObject* In0, const FVector& In1, FVector& Out2, int32& Out3, float In4);
+	/** Benchmark callable node Lib055_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn068(UObject* In0, const FTransform& In1, FName In2, const FString& In3, FVector& Out4, int32 In5);
+	/** Benchmark callable node Lib055_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn069(float In0, const FVector& In1);
+	/** Benchmark callable node Lib055_Fn070 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn070(const FTransform& In0, int32& Out1, FVector& Out2, FName In3, const FVector& In4);
+	/** Benchmark pure node Lib055_Fn071 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn071(const TArray< int32 >& In0, UObject* In1);
+	/** Benchmark callable node Lib055_Fn072 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn072(bool In0, int32& Out1, FVector& Out2);
+	/** Benchmark callable node Lib055_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn073(FVector& Out0);
+	/** Benchmark latent node Lib055_Fn074 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib055_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32 In1, bool In2, const FVector& In3, FVector& Out4, FName In5, const FTransform& In6);
+	/** Benchmark pure node Lib055_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn075(const FString& In0, const FVector& In1, const FVector& In2, UObject* In3);
+	/** Benchmark callable node Lib055_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn076(FVector& Out0, int32& Out1, FVector& Out2);
+	/** Benchmark callable node Lib055_Fn077 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn077(const FTransform& In0, FName In1, int32 In2, const FVector& In3, const TArray< int32 >& In4, int32 In5, const FVector& In6, FName In7);
+	/** Benchmark pure node Lib055_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static bool Lib055_Fn078(const FTransform& In0, FName In1, bool In2, float In3, UObject* In4, FString& Out5, FVector& Out6);
+	/** Benchmark callable node Lib055_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn079(float In0);
+	/** Benchmark pure node Lib055_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn080(int32 In0, int32& Out1, FName In2, const FVector& In3);
+	/** Benchmark callable node Lib055_Fn081 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn081(UObject* In0, bool In1, FName In2, const TArray< int32 >& In3, FName In4, const FString& In5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark callable node Lib055_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn082(const FVector& In0, int32& Out1, const FTransform& In2, int32 In3, UObject* In4, FName In5, FName In6);
+	/** Benchmark pure node Lib055_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn083(int32& Out0, int32& Out1, FVector& Out2, int32& Out3, int32 In4);
+	/** Benchmark pure node Lib055_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn084(bool In0, int32 In1, float In2, UObject* In3, FName In4);
+	/** Benchmark pure node Lib055_Fn085 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn085(bool In0, float In1, const FString& In2, const FTransform& In3, FString& Out4, int32& Out5);
+	/** Benchmark callable node Lib055_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn086(int32& Out0, FName In1, int32& Out2, const FString& In3, const FTransform& In4, bool In5, int32 In6);
+	/** Benchmark pure node Lib055_Fn087 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn087(FVector& Out0, FString& Out1, bool In2, int32& Out3, bool In4);
+	/** Benchmark latent node Lib055_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib055_Fn088(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark callable node Lib055_Fn089 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn089(int32 In0, const TArray< int32 >& In1, const FTransform& In2, float In3, UObject* In4, const FVector& In5, const FVector& In6);
+	/** Benchmark callable node Lib055_Fn090 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static void Lib055_Fn090(bool In0, int32 In1, UObject* In2);
+	/** Benchmark callable node Lib055_Fn091 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static float Lib055_Fn091(FVector& Out0, float In1);
+	/** Benchmark callable node Lib055_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn092(FVector& Out0, const FString& In1, const FString& In2, FName In3, FName In4, const FTransform& In5, UObject* In6);
+	/** Benchmark pure node Lib055_Fn093 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn093(const TArray< int32 >& In0, bool In1, bool In2, bool In3, const FTransform& In4, const FTransform& In5, FString& Out6);
+	/** Benchmark callable node Lib055_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn094(bool In0, const FVector& In1, const TArray< int32 >& In2, const FString& In3, const FTransform& In4, const FTransform& In5, const FTransform& In6, FName In7);
+	/** Benchmark callable node Lib055_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn095(FString& Out0, int32& Out1, FVector& Out2, const FString& In3, bool In4);
+	/** Benchmark callable node Lib055_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055")
+	static FString Lib055_Fn096(float In0);
+	/** Benchmark latent node Lib055_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib055", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib055_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1, int32& Out2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib055_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static FVector Lib055_Fn098(const FVector& In0, FName In1);
+	/** Benchmark pure node Lib055_Fn099 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib055")
+	static int32 Lib055_Fn099(const FString& In0, const FString& In1, float In2, UObject* In3, int32& Out4, UObject* In5, const FVector& In6, float In7);
+};
+
+
+UCLASS()
+class UKDGBenchLib_056 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib056_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn000(FVector& Out0, const FTransform& In1, const FString& In2, float In3, const TArray< int32 >& In4, const FTransform& In5, const FVector& In6);
+	/** Benchmark latent node Lib056_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark callable node Lib056_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn002();
+	/** Benchmark pure node Lib056_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn003(float In0, FName In1, FString& Out2, bool In3, float In4);
+	/** Benchmark callable node Lib056_Fn004 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn004(const FString& In0, const FTransform& In1, FName In2, FVector& Out3, const FString& In4, const FVector& In5, FName In6);
+	/** Benchmark callable node Lib056_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn005();
+	/** Benchmark callable node Lib056_Fn006 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn006(FVector& Out0, bool In1, bool In2, const FTransform& In3, const FVector& In4, int32& Out5, bool In6);
+	/** Benchmark callable node Lib056_Fn007 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn007(const FTransform& In0, float In1, int32 In2, const FString& In3, bool In4, bool In5, UObject* In6, bool In7);
+	/** Benchmark pure node Lib056_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn008(FName In0, int32& Out1, float In2, const FVector& In3, float In4, const FString& In5, UObject* In6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib056_Fn009 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FVector& In1, int32& Out2, const FTransform& In3, int32 In4, FString& Out5, int32& Out6);
+	/** Benchmark callable node Lib056_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn010();
+	/** Benchmark pure node Lib056_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn011(const TArray< int32 >& In0, FName In1, FString& Out2, FName In3, UObject* In4, int32& Out5, float In6, const FTransform& In7);
+	/** Benchmark callable node Lib056_Fn012 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn012(FName In0, UObject* In1);
+	/** Benchmark callable node Lib056_Fn013 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn013(UObject* In0, const TArray< int32 >& In1, bool In2, FVector& Out3);
+	/** Benchmark callable node Lib056_Fn014 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn014(const TArray< int32 >& In0, const FTransform& In1);
+	/** Benchmark callable node Lib056_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn015(int32& Out0);
+	/** Benchmark pure node Lib056_Fn016 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn016(UObject* In0);
+	/** Benchmark pure node Lib056_Fn017 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn017(FName In0, const FString& In1);
+	/** Benchmark pure node Lib056_Fn018 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn018(const FString& In0, const TArray< int32 >& In1, float In2, float In3, int32 In4, const FVector& In5, FString& Out6, const FVector& In7);
+	/** Benchmark callable node Lib056_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn019(FString& Out0, float In1, FString& Out2, int32& Out3, UObject* In4, FVector& Out5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark callable node Lib056_Fn020 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn020(FName In0, UObject* In1, const TArray< int32 >& In2, int32& Out3);
+	/** Benchmark pure node Lib056_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn021(float In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib056_Fn022 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn022(int32& Out0);
+	/** Benchmark callable node Lib056_Fn023 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn023(const FVector& In0, FVector& Out1, float In2, FVector& Out3, FName In4, float In5, float In6);
+	/** Benchmark pure node Lib056_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn024(const TArray< int32 >& In0, FString& Out1, FName In2, FString& Out3, const FString& In4, float In5, const FVector& In6, FName In7);
+	/** Benchmark latent node Lib056_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib056_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn026(int32 In0, float In1, const FString& In2, int32 In3);
+	/** Benchmark callable node Lib056_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn027(FString& Out0);
+	/** Benchmark latent node Lib056_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const TArray< int32 >& In1, FString& Out2, FString& Out3);
+	/** Benchmark pure node Lib056_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn029(const FString& In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib056_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn030(const FVector& In0, const FString& In1, FString& Out2, bool In3);
+	/** Benchmark callable node Lib056_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn031(int32& Out0, bool In1, const FString& In2, bool In3, const FTransform& In4, const FString& In5, int32 In6);
+	/** Benchmark callable node Lib056_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn032(const FTransform& In0, bool In1, const FString& In2, FString& Out3, UObject* In4, int32 In5, const TArray< int32 >& In6, FVector& Out7);
+	/** Benchmark callable node Lib056_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn033(int32 In0, float In1, FVector& Out2);
+	/** Benchmark callable node Lib056_Fn034 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn034(const FVector& In0, float In1, FVector& Out2);
+	/** Benchmark latent node Lib056_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn035(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib056_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn036(int32& Out0, const FTransform& In1, int32 In2, UObject* In3, int32 In4, int32 In5, FName In6, const FString& In7);
+	/** Benchmark callable node Lib056_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn037(const FString& In0, int32 In1, FString& Out2, int32 In3, bool In4);
+	/** Benchmark pure node Lib056_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn038();
+	/** Benchmark callable node Lib056_Fn039 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn039(FName In0, int32& Out1, FVector& Out2, bool In3);
+	/** Benchmark latent node Lib056_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FTransform& In1, int32 In2, const FString& In3, bool In4, float In5);
+	/** Benchmark callable node Lib056_Fn041 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn041(FString& Out0, const FVector& In1, float In2, UObject* In3, UObject* In4, const TArray< int32 >& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib056_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn042(FString& Out0, int32& Out1, int32 In2);
+	/** Benchmark callable node Lib056_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn043(FName In0, FVector& Out1, bool In2, UObject* In3, const FVector& In4);
+	/** Benchmark callable node Lib056_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn044(FVector& Out0, float In1, FString& Out2, const FVector& In3, int32 In4, int32& Out5, float In6, int32& Out7);
+	/** Benchmark callable node Lib056_Fn045 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn045(bool In0, const FVector& In1, const FVector& In2, int32& Out3);
+	/** Benchmark pure node Lib056_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn046(const FTransform& In0, int32 In1);
+	/** Benchmark callable node Lib056_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn047(FName In0, const TArray< int32 >& In1, int32& Out2);
+	/** Benchmark callable node Lib056_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn048(FVector& Out0, const FTransform& In1, int32 In2, const FTransform& In3, const FVector& In4, bool In5, FString& Out6, bool In7);
+	/** Benchmark callable node Lib056_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn049(const TArray< int32 >& In0, int32& Out1, FVector& Out2, bool In3, bool In4, bool In5);
+	/** Benchmark callable node Lib056_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn050(FVector& Out0, bool In1, UObject* In2, bool In3);
+	/** Benchmark callable node Lib056_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn051(FName In0, FString& Out1, const FVector& In2, FVector& Out3);
+	/** Benchmark callable node Lib056_Fn052 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn052(bool In0);
+	/** Benchmark pure node Lib056_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn053(const FString& In0, FString& Out1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib056_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn054(FString& Out0, FName In1, int32& Out2, FName In3, bool In4, int32 In5, int32 In6, const FTransform& In7);
+	/** Benchmark callable node Lib056_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn055(FName In0, const FVector& In1, FName In2, int32 In3);
+	/** Benchmark callable node Lib056_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn056(const FString& In0, FString& Out1, int32 In2, FString& Out3, const TArray< int32 >& In4, const FString& In5);
+	/** Benchmark callable node Lib056_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn057(const TArray< int32 >& In0, const TArray< int32 >& In1, int32& Out2, UObject* In3, float In4, int32& Out5, float In6);
+	/** Benchmark latent node Lib056_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1, bool In2, int32 In3, const FString& In4, FName In5);
+	/** Benchmark callable node Lib056_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn059(const FVector& In0, float In1, float In2, bool In3);
+	/** Benchmark latent node Lib056_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib056_Fn061 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn061(FName In0, FName In1, FVector& Out2, UObject* In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib056_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn062(const FString& In0, const TArray< int32 >& In1, UObject* In2, int32& Out3, FString& Out4, const FString& In5);
+	/** Benchmark pure node Lib056_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn063(int32& Out0, const FString& In1, float In2, int32& Out3, FString& Out4);
+	/** Benchmark callable node Lib056_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn064(bool In0, const FTransform& In1, const TArray< int32 >& In2, FName In3, const FVector& In4, FString& Out5, FVector& Out6, FString& Out7);
+	/** Benchmark callable node Lib056_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn065(UObject* In0, const FVector& In1);
+	/** Benchmark pure node Lib056_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn066(int32& Out0, float In1, int32& Out2, int32& Out3, const FString& In4);
+	/** Benchmark callable node Lib056_Fn067 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn067(int32 In0, FVector& Out1, FVector& Out2);
+	/** Benchmark callable node Lib056_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn068(const FTransform& In0, const FVector& In1, UObject* In2);
+	/** Benchmark callable node Lib056_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn069(FName In0, int32 In1, int32 In2, FString& Out3, int32& Out4, int32& Out5);
+	/** Benchmark latent node Lib056_Fn070 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, FString& Out2, float In3, const TArray< int32 >& In4, float In5, UObject* In6);
+	/** Benchmark callable node Lib056_Fn071 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn071(FVector& Out0, FName In1, int32& Out2, bool In3, const FVector& In4, bool In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib056_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn072(const FTransform& In0, const FVector& In1);
+	/** Benchmark latent node Lib056_Fn073 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, bool In1, const FString& In2, FName In3, FString& Out4);
+	/** Benchmark pure node Lib056_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn074(const FVector& In0, int32& Out1);
+	/** Benchmark callable node Lib056_Fn075 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn075(bool In0, const FTransform& In1, const FTransform& In2, FVector& Out3, FName In4);
+	/** Benchmark pure node Lib056_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn076(int32 In0, const FVector& In1, FVector& Out2, const FTransform& In3, const FTransform& In4);
+	/** Benchmark callable node Lib056_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn077();
+	/** Benchmark callable node Lib056_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn078(FString& Out0, FName In1, float In2, FString& Out3, FString& Out4, const FString& In5, int32& Out6);
+	/** Benchmark pure node Lib056_Fn079 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn079(int32& Out0, FName In1);
+	/** Benchmark callable node Lib056_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn080(FString& Out0, float In1, const FString& In2);
+	/** Benchmark latent node Lib056_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1);
+	/** Benchmark pure node Lib056_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn082(const FVector& In0, const FVector& In1, const FTransform& In2);
+	/** Benchmark callable node Lib056_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn083(const FVector& In0, const FString& In1, const FVector& In2, FString& Out3, bool In4);
+	/** Benchmark pure node Lib056_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FVector Lib056_Fn084(float In0, UObject* In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib056_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn085(UObject* In0, const FVector& In1, float In2, FVector& Out3, const FTransform& In4, bool In5, UObject* In6);
+	/** Benchmark latent node Lib056_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32& Out1, UObject* In2, int32& Out3, const FTransform& In4);
+	/** Benchmark callable node Lib056_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn087(const FVector& In0, int32& Out1);
+	/** Benchmark pure node Lib056_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn088(const FString& In0, const TArray< int32 >& In1, int32& Out2, FName In3, FName In4, FName In5, FString& Out6, int32& Out7);
+	/** Benchmark callable node Lib056_Fn089 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn089(UObject* In0);
+	/** Benchmark callable node Lib056_Fn090 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn090();
+	/** Benchmark latent node Lib056_Fn091 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib056_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FString& In1, UObject* In2, const TArray< int32 >& In3, UObject* In4, bool In5);
+	/** Benchmark callable node Lib056_Fn092 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn092(bool In0, int32 In1, FString& Out2);
+	/** Benchmark callable node Lib056_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn093(const FString& In0, const FString& In1, UObject* In2, const FString& In3, const FString& In4, FVector& Out5, float In6, bool In7);
+	/** Benchmark callable node Lib056_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static void Lib056_Fn094(const FVector& In0, const TArray< int32 >& In1, float In2, UObject* In3, const FVector& In4);
+	/** Benchmark callable node Lib056_Fn095 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static float Lib056_Fn095(UObject* In0, int32 In1, UObject* In2, FVector& Out3, int32 In4, const FTransform& In5, bool In6, FString& Out7);
+	/** Benchmark callable node Lib056_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static bool Lib056_Fn096(const FTransform& In0, float In1, FString& Out2, const FVector& In3, const FString& In4);
+	/** Benchmark callable node Lib056_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn097(UObject* In0, FName In1, FName In2, FName In3, FName In4, bool In5);
+	/** Benchmark callable node Lib056_Fn098 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static int32 Lib056_Fn098(const FString& In0, int32 In1, bool In2, FName In3, FVector& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6, UObject* In7);
+	/** Benchmark callable node Lib056_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib056")
+	static FString Lib056_Fn099(const FString& In0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, FString& Out5, const FVector& In6);
+};
+
+
+UCLASS()
+class UKDGBenchLib_057 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib057_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn000(const FTransform& In0, const FVector& In1, bool In2, bool In3, UObject* In4, const TArray< int32 >& In5, int32& Out6);
+	/** Benchmark pure node Lib057_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn001(const TArray< int32 >& In0, FString& Out1);
+	/** Benchmark callable node Lib057_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn002(FVector& Out0, FName In1, UObject* In2, const TArray< int32 >& In3, UObject* In4, int32& Out5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark latent node Lib057_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib057_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, const FTransform& In2, FString& Out3, int32& Out4);
+	/** Benchmark callable node Lib057_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn004(int32& Out0);
+	/** Benchmark callable node Lib057_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn005(int32 In0, UObject* In1, float In2, FString& Out3);
+	/** Benchmark pure node Lib057_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn006(const TArray< int32 >& In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark pure node Lib057_Fn007 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn007();
+	/** Benchmark callable node Lib057_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn008(int32 In0, int32 In1, FVector& Out2, UObject* In3, int32 In4, FName In5);
+	/** Benchmark pure node Lib057_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn009(float In0, bool In1, bool In2, FName In3);
+	/** Benchmark callable node Lib057_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn010(FString& Out0, const FString& In1, FString& Out2, UObject* In3, UObject* In4);
+	/** Benchmark callable node Lib057_Fn011 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn011(float In0, const FTransform& In1);
+	/** Benchmark callable node Lib057_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn012(FString& Out0, const FTransform& In1, FName In2);
+	/** Benchmark callable node Lib057_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn013(const FTransform& In0, UObject* In1, UObject* In2);
+	/** Benchmark callable node Lib057_Fn014 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn014(const TArray< int32 >& In0, FString& Out1, const FString& In2, FString& Out3, const FString& In4, float In5, int32 In6, int32 In7);
+	/** Benchmark callable node Lib057_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn015(FString& Out0);
+	/** Benchmark callable node Lib057_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn016(int32& Out0, UObject* In1, int32 In2, UObject* In3, const FTransform& In4);
+	/** Benchmark callable node Lib057_Fn017 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn017(const FVector& In0, FName In1);
+	/** Benchmark callable node Lib057_Fn018 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn018();
+	/** Benchmark pure node Lib057_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn019(int32 In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib057_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn020(float In0, UObject* In1, int32 In2, const FString& In3, FString& Out4, const FVector& In5, const FString& In6, const FVector& In7);
+	/** Benchmark pure node Lib057_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn021(const FVector& In0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib057_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn022(bool In0, const FString& In1, const TArray< int32 >& In2, bool In3, FName In4, const FTransform& In5, const FString& In6);
+	/** Benchmark callable node Lib057_Fn023 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn023(const TArray< int32 >& In0, int32& Out1, bool In2, FVector& Out3, int32& Out4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib057_Fn024 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn024(const FString& In0, float In1);
+	/** Benchmark callable node Lib057_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn025(int32& Out0, const FTransform& In1, FString& Out2, float In3, FVector& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib057_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn026(UObject* In0, const FVector& In1, const FVector& In2, UObject* In3);
+	/** Benchmark pure node Lib057_Fn027 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn027(bool In0, float In1, float In2, const TArray< int32 >& In3, int32 In4, FString& Out5);
+	/** Benchmark pure node Lib057_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn028(UObject* In0);
+	/** Benchmark pure node Lib057_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn029(float In0);
+	/** Benchmark pure node Lib057_Fn030 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn030(const FTransform& In0);
+	/** Benchmark callable node Lib057_Fn031 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn031(const FTransform& In0, FName In1, float In2, int32& Out3, int32 In4, const TArray< int32 >& In5, FName In6);
+	/** Benchmark pure node Lib057_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn032(FString& Out0, const FTransform& In1, const FVector& In2, bool In3);
+	/** Benchmark pure node Lib057_Fn033 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn033(FVector& Out0);
+	/** Benchmark pure node Lib057_Fn034 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn034(float In0, float In1, UObject* In2, FVector& Out3, FVector& Out4);
+	/** Benchmark pure node Lib057_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn035(UObject* In0, const FVector& In1, const TArray< int32 >& In2, bool In3, int32& Out4, FVector& Out5, const FTransform& In6, FName In7);
+	/** Benchmark callable node Lib057_Fn036 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn036();
+	/** Benchmark callable node Lib057_Fn037 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn037(float In0, const TArray< int32 >& In1, const FTransform& In2, const FVector& In3);
+	/** Benchmark callable node Lib057_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn038();
+	/** Benchmark pure node Lib057_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn039(int32 In0, FString& Out1, int32 In2, int32& Out3, FName In4, int32 In5, const FString& In6);
+	/** Benchmark callable node Lib057_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn040(FString& Out0, int32 In1, FString& Out2, int32 In3, bool In4, const FString& In5, bool In6, float In7);
+	/** Benchmark callable node Lib057_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn041(const FString& In0);
+	/** Benchmark callable node Lib057_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn042(FString& Out0, bool In1);
+	/** Benchmark callable node Lib057_Fn043 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn043(bool In0, FVector& Out1, const FTransform& In2, FName In3, FName In4, FVector& Out5, const FTransform& In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib057_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn044();
+	/** Benchmark callable node Lib057_Fn045 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn045(bool In0, FName In1, FVector& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib057_Fn046 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn046(const TArray< int32 >& In0, FString& Out1, FName In2, int32 In3, UObject* In4);
+	/** Benchmark pure node Lib057_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn047(const TArray< int32 >& In0, FString& Out1, float In2, FString& Out3, UObject* In4, FName In5, FVector& Out6);
+	/** Benchmark pure node Lib057_Fn048 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn048(FVector& Out0, int32 In1, const TArray< int32 >& In2, const FVector& In3, FVector& Out4);
+	/** Benchmark callable node Lib057_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn049(FName In0, const FVector& In1, float In2, FVector& Out3, FString& Out4, FString& Out5, const FString& In6);
+	/** Benchmark callable node Lib057_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn050(const FTransform& In0, const FVector& In1);
+	/** Benchmark pure node Lib057_Fn051 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn051();
+	/** Benchmark pure node Lib057_Fn052 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn052(int32& Out0, int32& Out1, FVector& Out2, const TArray< int32 >& In3, UObject* In4, int32& Out5, const FTransform& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib057_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn053(bool In0, const FVector& In1, const TArray< int32 >& In2, float In3, FVector& Out4, FString& Out5);
+	/** Benchmark pure node Lib057_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn054(const FString& In0, float In1);
+	/** Benchmark latent node Lib057_Fn055 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib057_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark callable node Lib057_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn056(FString& Out0, FString& Out1, UObject* In2, int32& Out3, UObject* In4, const FString& In5);
+	/** Benchmark pure node Lib057_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn057(FString& Out0, int32 In1, int32 In2, const FTransform& In3, float In4, int32& Out5);
+	/** Benchmark callable node Lib057_Fn058 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn058(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib057_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn059(int32& Out0, UObject* In1, FVector& Out2);
+	/** Benchmark callable node Lib057_Fn060 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn060(const FTransform& In0, FString& Out1, FString& Out2, const FVector& In3, FName In4, int32 In5);
+	/** Benchmark pure node Lib057_Fn061 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn061(const FVector& In0, UObject* In1, const FString& In2, const TArray< int32 >& In3, const FTransform& In4, float In5, int32 In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib057_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn062(UObject* In0, const TArray< int32 >& In1, int32 In2, FVector& Out3, const TArray< int32 >& In4, const FVector& In5, const FTransform& In6);
+	/** Benchmark callable node Lib057_Fn063 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn063(FName In0, const FTransform& In1, FString& Out2, const FVector& In3, const FVector& In4, int32 In5);
+	/** Benchmark callable node Lib057_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn064(const TArray< int32 >& In0, int32& Out1, const FString& In2);
+	/** Benchmark callable node Lib057_Fn065 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn065(const FVector& In0, UObject* In1, FVector& Out2);
+	/** Benchmark callable node Lib057_Fn066 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn066(FVector& Out0, const TArray< int32 >& In1, float In2, const FTransform& In3, const FVector& In4, FName In5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark pure node Lib057_Fn067 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn067(float In0, FVector& Out1, bool In2, UObject* In3, float In4, UObject* In5, const FTransform& In6, int32 In7);
+	/** Benchmark pure node Lib057_Fn068 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn068(FVector& Out0, FVector& Out1, int32 In2, UObject* In3, float In4, FString& Out5, const TArray< int32 >& In6, const FTransform& In7);
+	/** Benchmark callable node Lib057_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn069(float In0, bool In1, const FVector& In2, int32 In3, int32& Out4, float In5);
+	/** Benchmark callable node Lib057_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn070(UObject* In0, const FTransform& In1, const FTransform& In2, const TArray< int32 >& In3, const FVector& In4, const FString& In5, const FTransform& In6);
+	/** Benchmark callable node Lib057_Fn071 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn071(FString& Out0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark callable node Lib057_Fn072 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn072(const FTransform& In0, const TArray< int32 >& In1, int32& Out2, FString& Out3, FString& Out4, int32& Out5, FName In6);
+	/** Benchmark callable node Lib057_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn073(bool In0, FVector& Out1, bool In2);
+	/** Benchmark callable node Lib057_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn074(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib057_Fn075 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn075();
+	/** Benchmark callable node Lib057_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn076(FVector& Out0, const TArray< int32 >& In1, const FVector& In2);
+	/** Benchmark pure node Lib057_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn077(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib057_Fn078 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn078(const FVector& In0, const TArray< int32 >& In1, FName In2, UObject* In3, FVector& Out4, int32& Out5);
+	/** Benchmark pure node Lib057_Fn079 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn079(int32& Out0, const FTransform& In1, const FVector& In2, FName In3, FName In4, int32 In5);
+	/** Benchmark callable node Lib057_Fn080 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn080(const FTransform& In0, const FTransform& In1, FVector& Out2, FString& Out3, const FString& In4, FString& Out5, FString& Out6, FString& Out7);
+	/** Benchmark callable node Lib057_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn081(int32& Out0, float In1, const FString& In2, FString& Out3, const FVector& In4, FVector& Out5, const FVector& In6);
+	/** Benchmark pure node Lib057_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn082(FName In0, FName In1, UObject* In2);
+	/** Benchmark callable node Lib057_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn083(const FVector& In0, FVector& Out1, bool In2, FName In3, FString& Out4);
+	/** Benchmark callable node Lib057_Fn084 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn084();
+	/** Benchmark callable node Lib057_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn085(int32 In0, const TArray< int32 >& In1, int32 In2, FString& Out3);
+	/** Benchmark callable node Lib057_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn086(int32& Out0, FString& Out1);
+	/** Benchmark callable node Lib057_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static int32 Lib057_Fn087(int32& Out0);
+	/** Benchmark callable node Lib057_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn088(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FTransform& In3, FVector& Out4, float In5, FVector& Out6);
+	/** Benchmark latent node Lib057_Fn089 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib057_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FVector& Out1, const FString& In2, float In3, int32& Out4, FVector& Out5, float In6);
+	/** Benchmark callable node Lib057_Fn090 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn090(const FTransform& In0, FString& Out1, FVector& Out2, float In3, const FTransform& In4);
+	/** Benchmark callable node Lib057_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static FString Lib057_Fn091(const FVector& In0, const FString& In1, FVector& Out2, const FString& In3);
+	/** Benchmark pure node Lib057_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn092(const FString& In0, int32 In1, UObject* In2, const FString& In3, bool In4, const FString& In5, UObject* In6);
+	/** Benchmark pure node Lib057_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn093(FVector& Out0, FString& Out1, const FString& In2, const TArray< int32 >& In3, const FString& In4, const FTransform& In5, float In6, const FString& In7);
+	/** Benchmark callable node Lib057_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn094(FString& Out0);
+	/** Benchmark pure node Lib057_Fn095 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static FVector Lib057_Fn095(int32& Out0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3, const FString& In4, FString& Out5);
+	/** Benchmark pure node Lib057_Fn096 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn096(FVector& Out0, const FString& In1, float In2, bool In3);
+	/** Benchmark callable node Lib057_Fn097 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static void Lib057_Fn097();
+	/** Benchmark pure node Lib057_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib057")
+	static float Lib057_Fn098(int32 In0, const FString& In1, FString& Out2, UObject* In3, FVector& Out4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib057_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib057")
+	static bool Lib057_Fn099(bool In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_058 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib058_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn000(const FVector& In0);
+	/** Benchmark latent node Lib058_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib058_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn002(FVector& Out0, bool In1, UObject* In2, const FString& In3, int32& Out4, int32 In5);
+	/** Benchmark pure node Lib058_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn003(UObject* In0, const FTransform& In1, int32& Out2, bool In3, int32& Out4, FString& Out5);
+	/** Benchmark callable node Lib058_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn004(int32& Out0);
+	/** Benchmark callable node Lib058_Fn005 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn005(FString& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, float In3, UObject* In4);
+	/** Benchmark callable node Lib058_Fn006 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn006(FString& Out0, int32& Out1, FString& Out2, const TArray< int32 >& In3, bool In4, const FTransform& In5, const FTransform& In6, bool In7);
+	/** Benchmark pure node Lib058_Fn007 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn007(FName In0);
+	/** Benchmark callable node Lib058_Fn008 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn008(FVector& Out0, int32 In1, bool In2, bool In3);
+	/** Benchmark pure node Lib058_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn009(UObject* In0, float In1, FVector& Out2);
+	/** Benchmark callable node Lib058_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn010(const FTransform& In0, float In1, const FVector& In2, float In3, const FString& In4, int32 In5, FString& Out6);
+	/** Benchmark callable node Lib058_Fn011 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn011(FVector& Out0, int32& Out1, bool In2, const FTransform& In3, int32& Out4, bool In5);
+	/** Benchmark latent node Lib058_Fn012 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib058_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn013(int32 In0, int32& Out1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib058_Fn014 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn014(int32& Out0, const FTransform& In1, UObject* In2, const TArray< int32 >& In3, FString& Out4, bool In5, bool In6, FVector& Out7);
+	/** Benchmark callable node Lib058_Fn015 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn015(FName In0, FVector& Out1, float In2);
+	/** Benchmark callable node Lib058_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn016();
+	/** Benchmark callable node Lib058_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn017(bool In0);
+	/** Benchmark pure node Lib058_Fn018 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn018(const FTransform& In0, const FVector& In1);
+	/** Benchmark pure node Lib058_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn019(FName In0, FString& Out1, int32& Out2, int32 In3, FString& Out4, FName In5);
+	/** Benchmark latent node Lib058_Fn020 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, const TArray< int32 >& In2, UObject* In3, FName In4, bool In5, FString& Out6, bool In7);
+	/** Benchmark callable node Lib058_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn021(bool In0, UObject* In1, const FTransform& In2, int32& Out3, int32& Out4, UObject* In5);
+	/** Benchmark callable node Lib058_Fn022 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static void Lib058_Fn022(int32 In0, const FVector& In1, FVector& Out2, FName In3, int32 In4, FVector& Out5, const FVector& In6, const FString& In7);
+	/** Benchmark pure node Lib058_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn023(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FString& In3, float In4);
+	/** Benchmark callable node Lib058_Fn024 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn024();
+	/** Benchmark callable node Lib058_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn025(const FString& In0, const FString& In1, int32 In2, FVector& Out3, FName In4, const TArray< int32 >& In5, float In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib058_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn026(FVector& Out0, const TArray< int32 >& In1, bool In2, FName In3, int32& Out4, FName In5);
+	/** Benchmark callable node Lib058_Fn027 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn027();
+	/** Benchmark latent node Lib058_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib058_Fn029 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn029(FName In0, FName In1, const FString& In2, FVector& Out3);
+	/** Benchmark callable node Lib058_Fn030 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn030();
+	/** Benchmark callable node Lib058_Fn031 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn031(FName In0, bool In1, FVector& Out2, const FVector& In3);
+	/** Benchmark callable node Lib058_Fn032 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn032(int32& Out0, FVector& Out1, const FString& In2, FName In3, int32 In4, const FVector& In5, FVector& Out6);
+	/** Benchmark pure node Lib058_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn033();
+	/** Benchmark latent node Lib058_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32& Out1, const FTransform& In2, FString& Out3, FVector& Out4);
+	/** Benchmark callable node Lib058_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn035(FName In0, const FTransform& In1, UObject* In2, const TArray< int32 >& In3, int32& Out4, bool In5, int32& Out6, FName In7);
+	/** Benchmark pure node Lib058_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn036(const FVector& In0);
+	/** Benchmark latent node Lib058_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FVector& Out1, FVector& Out2, const FVector& In3, FString& Out4);
+	/** Benchmark callable node Lib058_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn038(FString& Out0, const FString& In1, const FString& In2, FString& Out3);
+	/** Benchmark callable node Lib058_Fn039 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn039(const FTransform& In0);
+	/** Benchmark pure node Lib058_Fn040 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn040(const TArray< int32 >& In0, const FTransform& In1);
+	/** Benchmark pure node Lib058_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn041(int32& Out0, const FString& In1, const TArray< int32 >& In2, int32& Out3);
+	/** Benchmark callable node Lib058_Fn042 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn042(const FString& In0, FName In1, float In2, FName In3, FName In4);
+	/** Benchmark callable node Lib058_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn043(bool In0, int32 In1, float In2, int32& Out3, FName In4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib058_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn044(float In0, FName In1, const FString& In2, UObject* In3, FVector& Out4, bool In5);
+	/** Benchmark callable node Lib058_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn045(FVector& Out0);
+	/** Benchmark callable node Lib058_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn046(const TArray< int32 >& In0, FName In1, int32& Out2, float In3, const FVector& In4, int32& Out5, FString& Out6);
+	/** Benchmark latent node Lib058_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn047(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib058_Fn048 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn048(FString& Out0);
+	/** Benchmark pure node Lib058_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn049(bool In0, FName In1, FString& Out2, int32 In3, int32 In4, int32& Out5, int32 In6);
+	/** Benchmark latent node Lib058_Fn050 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, const TArray< int32 >& In2, FString& Out3, int32& Out4, float In5, const FString& In6);
+	/** Benchmark callable node Lib058_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static void Lib058_Fn051(int32& Out0, FName In1);
+	/** Benchmark callable node Lib058_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn052();
+	/** Benchmark pure node Lib058_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn053(UObject* In0, FName In1, const FVector& In2, int32& Out3);
+	/** Benchmark pure node Lib058_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn054(const TArray< int32 >& In0, const FString& In1, bool In2, UObject* In3, int32 In4, int32& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib058_Fn055 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn055(float In0);
+	/** Benchmark callable node Lib058_Fn056 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static void Lib058_Fn056(FString& Out0, UObject* In1, const FString& In2);
+	/** Benchmark callable node Lib058_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn057(float In0, UObject* In1, FVector& Out2);
+	/** Benchmark callable node Lib058_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn058(const FVector& In0, const FString& In1, const TArray< int32 >& In2, FName In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib058_Fn059 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn059(FName In0);
+	/** Benchmark pure node Lib058_Fn060 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn060(const FString& In0, const FVector& In1, FVector& Out2, const TArray< int32 >& In3, FName In4, const FString& In5, float In6);
+	/** Benchmark callable node Lib058_Fn061 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn061(const FVector& In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3, float In4, float In5, FVector& Out6, UObject* In7);
+	/** Benchmark callable node Lib058_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn062(int32 In0, bool In1, const TArray< int32 >& In2, bool In3, UObject* In4, FString& Out5);
+	/** Benchmark callable node Lib058_Fn063 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static void Lib058_Fn063();
+	/** Benchmark callable node Lib058_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn064(int32 In0, int32 In1, int32& Out2, int32& Out3, const TArray< int32 >& In4, const FTransform& In5, FVector& Out6, bool In7);
+	/** Benchmark pure node Lib058_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn065(UObject* In0);
+	/** Benchmark pure node Lib058_Fn066 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn066(bool In0, bool In1);
+	/** Benchmark callable node Lib058_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn067(FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib058_Fn068 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn068(const FVector& In0, const FTransform& In1, int32& Out2, const FTransform& In3, FString& Out4, int32& Out5, int32 In6, FVector& Out7);
+	/** Benchmark callable node Lib058_Fn069 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn069(const TArray< int32 >& In0, int32& Out1, float In2);
+	/** Benchmark callable node Lib058_Fn070 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn070(int32 In0, const FString& In1, FVector& Out2, FString& Out3, UObject* In4, FString& Out5);
+	/** Benchmark callable node Lib058_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn071(UObject* In0);
+	/** Benchmark latent node Lib058_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib058_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn073(FString& Out0, int32& Out1, FName In2, const FVector& In3, float In4, bool In5, const FVector& In6, const FVector& In7);
+	/** Benchmark callable node Lib058_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn074(const FTransform& In0, const FVector& In1, const FTransform& In2, const FTransform& In3);
+	/** Benchmark latent node Lib058_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn075(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib058_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn076(const TArray< int32 >& In0, UObject* In1, const FTransform& In2);
+	/** Benchmark callable node Lib058_Fn077 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static void Lib058_Fn077(int32 In0, bool In1, int32 In2, const FString& In3, const FString& In4, const FString& In5, const FVector& In6, bool In7);
+	/** Benchmark latent node Lib058_Fn078 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn078(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib058_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn079(const FString& In0, FString& Out1, int32& Out2, FVector& Out3, UObject* In4);
+	/** Benchmark pure node Lib058_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn080(FVector& Out0, int32 In1, bool In2, const FVector& In3);
+	/** Benchmark callable node Lib058_Fn081 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn081(UObject* In0, int32 In1, FVector& Out2);
+	/** Benchmark callable node Lib058_Fn082 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static void Lib058_Fn082(FString& Out0);
+	/** Benchmark pure node Lib058_Fn083 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn083(bool In0, FString& Out1, const FVector& In2, UObject* In3, const FVector& In4, float In5, UObject* In6);
+	/** Benchmark callable node Lib058_Fn084 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn084(const FTransform& In0, const FString& In1);
+	/** Benchmark callable node Lib058_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn085(const FString& In0, int32& Out1, float In2, int32& Out3, const FTransform& In4, UObject* In5, FName In6, FName In7);
+	/** Benchmark callable node Lib058_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn086(const TArray< int32 >& In0, FName In1, int32& Out2, const FString& In3, float In4);
+	/** Benchmark callable node Lib058_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn087(FName In0, FVector& Out1);
+	/** Benchmark latent node Lib058_Fn088 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib058_Fn088(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, const FString& In2, FVector& Out3);
+	/** Benchmark callable node Lib058_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn089(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib058_Fn090 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn090(const FTransform& In0, float In1, int32& Out2);
+	/** Benchmark callable node Lib058_Fn091 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn091();
+	/** Benchmark callable node Lib058_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn092();
+	/** Benchmark callable node Lib058_Fn093 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FString Lib058_Fn093(float In0);
+	/** Benchmark callable node Lib058_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static int32 Lib058_Fn094(UObject* In0, int32 In1, FString& Out2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib058_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static void Lib058_Fn095();
+	/** Benchmark callable node Lib058_Fn096 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn096();
+	/** Benchmark callable node Lib058_Fn097 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static FVector Lib058_Fn097(FString& Out0, FName In1, FName In2, const FVector& In3, FName In4, const TArray< int32 >& In5, float In6, const FString& In7);
+	/** Benchmark callable node Lib058_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static float Lib058_Fn098(const FTransform& In0, int32& Out1, FVector& Out2, int32 In3, bool In4);
+	/** Benchmark callable node Lib058_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib058")
+	static bool Lib058_Fn099(float In0, const FTransform& In1, const FTransform& In2, FString& Out3);
+};
+
+
+UCLASS()
+class UKDGBenchLib_059 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib059_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn000(UObject* In0, int32& Out1, bool In2, UObject* In3, float In4);
+	/** Benchmark callable node Lib059_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn001();
+	/** Benchmark callable node Lib059_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn002(const FVector& In0, bool In1, const FTransform& In2, FName In3, int32& Out4);
+	/** Benchmark callable node Lib059_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn003(FName In0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, FName In4, const TArray< int32 >& In5, UObject* In6);
+	/** Benchmark callable node Lib059_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn004(UObject* In0, bool In1);
+	/** Benchmark callable node Lib059_Fn005 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn005(const FString& In0, const TArray< int32 >& In1, int32& Out2, FString& Out3, const FVector& In4, UObject* In5);
+	/** Benchmark callable node Lib059_Fn006 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn006(float In0, const TArray< int32 >& In1, UObject* In2, bool In3, float In4, const FTransform& In5, const FTransform& In6, int32 In7);
+	/** Benchmark pure node Lib059_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn007(FVector& Out0, int32 In1, FName In2, int32& Out3, bool In4);
+	/** Benchmark callable node Lib059_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn008(float In0, bool In1);
+	/** Benchmark latent node Lib059_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib059_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0);
+	/** Benchmark latent node Lib059_Fn010 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib059_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FTransform& In1, FName In2, FName In3);
+	/** Benchmark callable node Lib059_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn011(const TArray< int32 >& In0);
+	/** Benchmark latent node Lib059_Fn012 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib059_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1, FName In2, FVector& Out3, const FString& In4, const TArray< int32 >& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib059_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn013(const FVector& In0, FString& Out1, FVector& Out2, const FTransform& In3, float In4);
+	/** Benchmark pure node Lib059_Fn014 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn014(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib059_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn015(FVector& Out0, bool In1, const FVector& In2, float In3, const TArray< int32 >& In4, float In5, float In6);
+	/** Benchmark callable node Lib059_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn016(int32 In0, bool In1, FName In2, int32 In3, const TArray< int32 >& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib059_Fn017 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn017();
+	/** Benchmark pure node Lib059_Fn018 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn018(int32 In0, const FTransform& In1, FName In2);
+	/** Benchmark callable node Lib059_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn019(FName In0, FName In1, float In2, const TArray< int32 >& In3, int32& Out4, int32 In5, const FString& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib059_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn020(const FVector& In0);
+	/** Benchmark callable node Lib059_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn021(float In0, bool In1, const TArray< int32 >& In2, bool In3);
+	/** Benchmark pure node Lib059_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn022(bool In0, int32& Out1, float In2, FString& Out3);
+	/** Benchmark pure node Lib059_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn023(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib059_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn024(const FString& In0);
+	/** Benchmark pure node Lib059_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn025(float In0, const FVector& In1, UObject* In2, const TArray< int32 >& In3, const TArray< int32 >& In4, const TArray< int32 >& In5, FString& Out6, UObject* In7);
+	/** Benchmark callable node Lib059_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn026(int32& Out0, const FTransform& In1, FVector& Out2, bool In3, const FTransform& In4);
+	/** Benchmark callable node Lib059_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn027(UObject* In0, int32& Out1, bool In2, const FTransform& In3, FString& Out4, int32& Out5, float In6);
+	/** Benchmark callable node Lib059_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn028(const FVector& In0, int32& Out1);
+	/** Benchmark pure node Lib059_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn029(FString& Out0, int32& Out1, FName In2, const FTransform& In3, FString& Out4, FString& Out5, UObject* In6, bool In7);
+	/** Benchmark callable node Lib059_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn030(FString& Out0, float In1);
+	/** Benchmark callable node Lib059_Fn031 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn031(UObject* In0, UObject* In1, UObject* In2, FVector& Out3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark callable node Lib059_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn032(int32 In0, FVector& Out1, FName In2, int32& Out3, bool In4, UObject* In5, FName In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib059_Fn033 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn033(UObject* In0, float In1, bool In2, const FVector& In3, UObject* In4, float In5, FVector& Out6, bool In7);
+	/** Benchmark callable node Lib059_Fn034 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn034(FString& Out0);
+	/** Benchmark callable node Lib059_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn035(const FString& In0, const FTransform& In1);
+	/** Benchmark callable node Lib059_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn036(float In0);
+	/** Benchmark pure node Lib059_Fn037 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn037(bool In0);
+	/** Benchmark callable node Lib059_Fn038 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn038(FString& Out0, UObject* In1, int32& Out2, UObject* In3, const FString& In4, FString& Out5, float In6, FString& Out7);
+	/** Benchmark callable node Lib059_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn039(const TArray< int32 >& In0, int32 In1, FString& Out2, FVector& Out3, const FString& In4, bool In5, const FTransform& In6);
+	/** Benchmark callable node Lib059_Fn040 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn040();
+	/** Benchmark callable node Lib059_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn041(const FTransform& In0, float In1, float In2, int32& Out3);
+	/** Benchmark callable node Lib059_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn042(const TArray< int32 >& In0, int32& Out1, bool In2, UObject* In3);
+	/** Benchmark callable node Lib059_Fn043 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn043(UObject* In0, const FTransform& In1, const FString& In2, const FVector& In3);
+	/** Benchmark pure node Lib059_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn044(const FTransform& In0, UObject* In1, UObject* In2, const FVector& In3, float In4, UObject* In5, FVector& Out6, bool In7);
+	/** Benchmark pure node Lib059_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn045(const TArray< int32 >& In0, int32 In1, float In2, const FVector& In3, FString& Out4, const TArray< int32 >& In5, int32 In6, int32& Out7);
+	/** Benchmark callable node Lib059_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn046(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib059_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn047(float In0, bool In1, int32& Out2, const FVector& In3, UObject* In4);
+	/** Benchmark pure node Lib059_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn048();
+	/** Benchmark callable node Lib059_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn049(bool In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib059_Fn050 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn050();
+	/** Benchmark callable node Lib059_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn051(const FVector& In0, FVector& Out1, FName In2, UObject* In3);
+	/** Benchmark callable node Lib059_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn052(FName In0, int32& Out1, FString& Out2);
+	/** Benchmark pure node Lib059_Fn053 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn053(const FVector& In0, bool In1, FName In2, float In3, FString& Out4, const FString& In5, FName In6, FString& Out7);
+	/** Benchmark callable node Lib059_Fn054 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn054(FVector& Out0, FName In1, const FTransform& In2, int32& Out3, UObject* In4, FVector& Out5, const FString& In6);
+	/** Benchmark callable node Lib059_Fn055 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn055(const FString& In0, float In1, const FString& In2, UObject* In3, bool In4);
+	/** Benchmark callable node Lib059_Fn056 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn056(int32& Out0, float In1, int32 In2, FName In3, FString& Out4, int32 In5);
+	/** Benchmark callable node Lib059_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn057(FVector& Out0, float In1, FVector& Out2, const FTransform& In3, FVector& Out4, FString& Out5, int32& Out6, UObject* In7);
+	/** Benchmark callable node Lib059_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn058(const FTransform& In0, const FVector& In1, FName In2, FVector& Out3, UObject* In4, FVector& Out5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark callable node Lib059_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn059(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FVector& In3, int32 In4, FString& Out5);
+	/** Benchmark callable node Lib059_Fn060 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn060(UObject* In0, FVector& Out1, const FVector& In2);
+	/** Benchmark callable node Lib059_Fn061 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn061(bool In0, int32 In1, FName In2);
+	/** Benchmark callable node Lib059_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn062(int32& Out0, const FVector& In1, FName In2, bool In3, const FTransform& In4);
+	/** Benchmark callable node Lib059_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn063(bool In0, bool In1, const TArray< int32 >& In2, const FTransform& In3, FVector& Out4);
+	/** Benchmark pure node Lib059_Fn064 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn064(const FString& In0, FString& Out1, const FString& In2, int32 In3, UObject* In4);
+	/** Benchmark callable node Lib059_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn065(FName In0, bool In1);
+	/** Benchmark callable node Lib059_Fn066 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn066(float In0, const FString& In1);
+	/** Benchmark pure node Lib059_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn067(const TArray< int32 >& In0, FName In1, int32& Out2, FVector& Out3, UObject* In4, int32& Out5);
+	/** Benchmark callable node Lib059_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn068(FName In0, bool In1, FVector& Out2, FString& Out3, const FString& In4);
+	/** Benchmark callable node Lib059_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn069(int32 In0, int32& Out1, const TArray< int32 >& In2, FName In3, const FVector& In4);
+	/** Benchmark pure node Lib059_Fn070 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn070(UObject* In0);
+	/** Benchmark callable node Lib059_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn071(const FVector& In0, const FString& In1, FVector& Out2, const FVector& In3, FName In4, float In5);
+	/** Benchmark pure node Lib059_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn072(const FTransform& In0, FString& Out1, float In2, int32 In3, FVector& Out4);
+	/** Benchmark callable node Lib059_Fn073 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn073(const TArray< int32 >& In0, const FTransform& In1, UObject* In2, const FString& In3, const FTransform& In4, UObject* In5);
+	/** Benchmark callable node Lib059_Fn074 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn074(int32& Out0, bool In1, float In2, int32& Out3, float In4, const FVector& In5, FVector& Out6, int32 In7);
+	/** Benchmark callable node Lib059_Fn075 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn075(int32& Out0);
+	/** Benchmark callable node Lib059_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn076(const FTransform& In0, int32& Out1);
+	/** Benchmark callable node Lib059_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn077(const FString& In0, int32 In1);
+	/** Benchmark callable node Lib059_Fn078 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn078(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib059_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn079(const FVector& In0, FName In1, const FString& In2, int32 In3, float In4);
+	/** Benchmark callable node Lib059_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn080(int32& Out0, const FTransform& In1, const FString& In2, const FVector& In3, int32& Out4);
+	/** Benchmark pure node Lib059_Fn081 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn081(bool In0, FVector& Out1, const FVector& In2, int32& Out3, FVector& Out4, const TArray< int32 >& In5, FVector& Out6, FVector& Out7);
+	/** Benchmark callable node Lib059_Fn082 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn082();
+	/** Benchmark callable node Lib059_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn083();
+	/** Benchmark callable node Lib059_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn084(bool In0, bool In1, int32 In2, float In3, int32& Out4, const FVector& In5, UObject* In6);
+	/** Benchmark pure node Lib059_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn085(FName In0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib059_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static void Lib059_Fn086(bool In0, const FString& In1, const FString& In2, FString& Out3, const FVector& In4);
+	/** Benchmark pure node Lib059_Fn087 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn087(const TArray< int32 >& In0, int32 In1, FName In2, const TArray< int32 >& In3, bool In4, const FTransform& In5, FVector& Out6, FString& Out7);
+	/** Benchmark callable node Lib059_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn088(const TArray< int32 >& In0, const FTransform& In1, int32& Out2, const FString& In3);
+	/** Benchmark pure node Lib059_Fn089 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn089(int32& Out0, UObject* In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib059_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn090(int32 In0);
+	/** Benchmark callable node Lib059_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static bool Lib059_Fn091(FString& Out0, const FVector& In1, const FVector& In2, UObject* In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib059_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn092(int32 In0);
+	/** Benchmark pure node Lib059_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn093(const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib059_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn094(const FVector& In0, const FString& In1, bool In2, FString& Out3);
+	/** Benchmark callable node Lib059_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn095();
+	/** Benchmark callable node Lib059_Fn096 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FString Lib059_Fn096(FString& Out0, const FVector& In1, const FTransform& In2, float In3, FString& Out4, int32 In5, UObject* In6, bool In7);
+	/** Benchmark callable node Lib059_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static float Lib059_Fn097(float In0, const FTransform& In1, FName In2);
+	/** Benchmark callable node Lib059_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static FVector Lib059_Fn098(FString& Out0, FString& Out1, FName In2);
+	/** Benchmark callable node Lib059_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib059")
+	static int32 Lib059_Fn099(int32 In0, FName In1);
+};
+
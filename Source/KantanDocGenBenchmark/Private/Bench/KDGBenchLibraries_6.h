@@ -0,0 +1,3105 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchLibraries_6.generated.h"
+
+
+UCLASS()
+class UKDGBenchLib_060 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark pure node Lib060_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn000(FString& Out0, bool In1, const FTransform& In2, int32& Out3, const FVector& In4);
+	/** Benchmark callable node Lib060_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn001(FName In0, int32& Out1, FVector& Out2, int32& Out3, int32& Out4, FVector& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib060_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static void Lib060_Fn002(bool In0, FName In1, int32& Out2, const FTransform& In3, bool In4, const FVector& In5);
+	/** Benchmark pure node Lib060_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn003(FVector& Out0, UObject* In1, const TArray< int32 >& In2, bool In3);
+	/** Benchmark callable node Lib060_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn004(const TArray< int32 >& In0, const FTransform& In1);
+	/** Benchmark callable node Lib060_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn005();
+	/** Benchmark pure node Lib060_Fn006 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn006(const FString& In0, FString& Out1, int32& Out2, FName In3, UObject* In4, bool In5);
+	/** Benchmark pure node Lib060_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn007(FName In0, const TArray< int32 >& In1, const FTransform& In2);
+	/** Benchmark callable node Lib060_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn008();
+	/** Benchmark callable node Lib060_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn009(FVector& Out0, const FVector& In1, const FVector& In2, const FString& In3, float In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib060_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn010(float In0, int32& Out1, const FTransform& In2, const FString& In3, FVector& Out4, UObject* In5, FName In6);
+	/** Benchmark callable node Lib060_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn011(int32 In0, float In1, bool In2, FString& Out3, const FTransform& In4, int32 In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib060_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn012(const FTransform& In0, FName In1, UObject* In2, const FVector& In3, int32& Out4, FVector& Out5, int32 In6);
+	/** Benchmark callable node Lib060_Fn013 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static void Lib060_Fn013(FString& Out0);
+	/** Benchmark pure node Lib060_Fn014 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn014(const TArray< int32 >& In0, bool In1);
+	/** Benchmark pure node Lib060_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn015(float In0, UObject* In1, int32& Out2, const FTransform& In3, int32 In4, const FVector& In5);
+	/** Benchmark callable node Lib060_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn016(float In0, const FString& In1, int32& Out2);
+	/** Benchmark callable node Lib060_Fn017 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static void Lib060_Fn017(float In0, const FTransform& In1, UObject* In2, const FString& In3, int32& Out4, bool In5, int32 In6, int32& Out7);
+	/** Benchmark pure node Lib060_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn018(bool In0, float In1, FString& Out2, int32& Out3);
+	/** Benchmark callable node Lib060_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn019(FVector& Out0, FString& Out1, UObject* In2, FVector& Out3);
+	/** Benchmark callable node Lib060_Fn020 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn020(FString& Out0, FVector& Out1);
+	/** Benchmark callable node Lib060_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn021(const FTransform& In0, int32 In1, const FString& In2, int32 In3);
+	/** Benchmark callable node Lib060_Fn022 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn022(bool In0);
+	/** Benchmark pure node Lib060_Fn023 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn023(const FVector& In0, int32& Out1, int32 In2, FString& Out3, FVector& Out4);
+	/** Benchmark latent node Lib060_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib060_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, int32 In2, FName In3, float In4, bool In5);
+	/** Benchmark callable node Lib060_Fn025 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn025(int32 In0, bool In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib060_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn026(int32 In0, UObject* In1, FString& Out2, const FTransform& In3);
+	/** Benchmark callable node Lib060_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn027(FName In0, FName In1, FVector& Out2, const FVector& In3, FName In4, float In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib060_Fn028 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn028(const TArray< int32 >& In0, int32 In1, const FTransform& In2, FVector& Out3, const FTransform& In4);
+	/** Benchmark callable node Lib060_Fn029 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn029(int32 In0, FName In1, FVector& Out2, const FVector& In3);
+	/** Benchmark callable node Lib060_Fn030 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn030(const FString& In0);
+	/** Benchmark callable node Lib060_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn031(FString& Out0);
+	/** Benchmark pure node Lib060_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn032(FString& Out0, int32 In1, FName In2, const TArray< int32 >& In3, FVector& Out4, int32& Out5, float In6, int32 In7);
+	/** Benchmark callable node Lib060_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn033(const FString& In0, FString& Out1, int32 In2, const TArray< int32 >& In3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib060_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn034(const FString& In0, const FVector& In1, UObject* In2, FName In3, FName In4, int32 In5);
+	/** Benchmark pure node Lib060_Fn035 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn035();
+	/** Benchmark pure node Lib060_Fn036 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn036(float In0, int32 In1, bool In2);
+	/** Benchmark pure node Lib060_Fn037 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn037(UObject* In0, const FString& In1, const FVector& In2, FString& Out3, UObject* In4, FVector& Out5, const TArray< int32 >& In6, const FVector& In7);
+	/** Benchmark pure node Lib060_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn038(FName In0, int32 In1, const TArray< int32 >& In2, UObject* In3);
+	/** Benchmark pure node Lib060_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn039(bool In0, const FTransform& In1, FString& Out2, bool In3, bool In4, FString& Out5, float In6);
+	/** Benchmark latent node Lib060_Fn040 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib060_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, const FTransform& In2, int32 In3, const FVector& In4);
+	/** Benchmark callable node Lib060_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn041(bool In0);
+	/** Benchmark callable node Lib060_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn042(bool In0, FString& Out1);
+	/** Benchmark pure node Lib060_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn043(float In0, const TArray< int32 >& In1, UObject* In2);
+	/** Benchmark callable node Lib060_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn044(bool In0, int32 In1, FName In2, bool In3, UObject* In4);
+	/** Benchmark callable node Lib060_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn045(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib060_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn046(const FTransform& In0);
+	/** Benchmark pure node Lib060_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn047(float In0, FName In1, FString& Out2, const TArray< int32 >& In3, int32& Out4, const FTransform& In5, const FString& In6);
+	/** Benchmark callable node Lib060_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn048();
+	/** Benchmark latent node Lib060_Fn049 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib060_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, bool In1, bool In2, bool In3, int32 In4, int32 In5, int32 In6, int32 In7);
+	/** Benchmark pure node Lib060_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn050(FString& Out0, const FString& In1, FName In2, int32& Out3, int32& Out4);
+	/** Benchmark callable node Lib060_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn051(const FVector& In0, float In1, float In2, FName In3);
+	/** Benchmark pure node Lib060_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn052();
+	/** Benchmark callable node Lib060_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn053(int32 In0, float In1, float In2, FName In3, int32 In4, bool In5);
+	/** Benchmark pure node Lib060_Fn054 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn054(bool In0, int32& Out1, UObject* In2);
+	/** Benchmark callable node Lib060_Fn055 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn055(int32& Out0, FVector& Out1, UObject* In2, int32& Out3, const FVector& In4, float In5, const FVector& In6, float In7);
+	/** Benchmark callable node Lib060_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static void Lib060_Fn056(const FTransform& In0, UObject* In1, bool In2, const FTransform& In3, FVector& Out4, const FTransform& In5, UObject* In6, UObject* In7);
+	/** Benchmark latent node Lib060_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib060_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0);
+	/** Benchmark pure node Lib060_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn058(int32& Out0, float In1, int32& Out2, const FTransform& In3, const FTransform& In4, UObject* In5);
+	/** Benchmark callable node Lib060_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn059(bool In0, FVector& Out1, FString& Out2, int32 In3);
+	/** Benchmark latent node Lib060_Fn060 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib060_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32& Out1, bool In2, const TArray< int32 >& In3, UObject* In4, const FTransform& In5, FName In6, const FTransform& In7);
+	/** Benchmark callable node Lib060_Fn061 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn061(FVector& Out0, const FTransform& In1, int32 In2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5, int32& Out6, int32 In7);
+	/** Benchmark callable node Lib060_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn062(FString& Out0, FString& Out1, const FVector& In2, FString& Out3, const FVector& In4);
+	/** Benchmark pure node Lib060_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn063(int32 In0, const FTransform& In1, FName In2, const FTransform& In3);
+	/** Benchmark callable node Lib060_Fn064 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn064(FString& Out0, UObject* In1, const FString& In2, FName In3, int32& Out4, int32& Out5);
+	/** Benchmark callable node Lib060_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn065(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib060_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static void Lib060_Fn066(int32 In0, FName In1, const TArray< int32 >& In2, int32 In3, FName In4);
+	/** Benchmark callable node Lib060_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn067(FVector& Out0, int32 In1, bool In2, const FTransform& In3, int32 In4, int32 In5, float In6);
+	/** Benchmark callable node Lib060_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn068(int32 In0, const FString& In1, int32 In2);
+	/** Benchmark pure node Lib060_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn069(FString& Out0, FString& Out1, FName In2, int32 In3, const FVector& In4);
+	/** Benchmark pure node Lib060_Fn070 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn070(int32 In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib060_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn071(int32 In0, const FTransform& In1, const FString& In2, int32 In3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark callable node Lib060_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn072(bool In0, int32 In1, float In2, FName In3, const FTransform& In4, FVector& Out5);
+	/** Benchmark callable node Lib060_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn073(UObject* In0, int32 In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib060_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn074(const TArray< int32 >& In0, FName In1, int32& Out2, FVector& Out3, const FTransform& In4, const FVector& In5, const FString& In6);
+	/** Benchmark callable node Lib060_Fn075 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn075(UObject* In0, FString& Out1, FString& Out2, const FString& In3, FString& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib060_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn076(FName In0, FString& Out1, UObject* In2, const FVector& In3);
+	/** Benchmark callable node Lib060_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn077();
+	/** Benchmark callable node Lib060_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn078();
+	/** Benchmark pure node Lib060_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn079(int32 In0, const FVector& In1, FVector& Out2);
+	/** Benchmark pure node Lib060_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn080(FVector& Out0, float In1, int32& Out2);
+	/** Benchmark callable node Lib060_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn081(const FTransform& In0, FString& Out1, const FVector& In2, bool In3, FName In4, const FString& In5, FName In6);
+	/** Benchmark callable node Lib060_Fn082 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn082(FString& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib060_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn083();
+	/** Benchmark latent node Lib060_Fn084 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib060_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib060_Fn085 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn085(FName In0);
+	/** Benchmark latent node Lib060_Fn086 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib060_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, const FString& In2, FString& Out3, const FTransform& In4, FString& Out5, const FVector& In6, int32 In7);
+	/** Benchmark callable node Lib060_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn087(bool In0, int32 In1, int32 In2);
+	/** Benchmark callable node Lib060_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn088();
+	/** Benchmark pure node Lib060_Fn089 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn089(UObject* In0);
+	/** Benchmark callable node Lib060_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FVector Lib060_Fn090(FVector& Out0, const FVector& In1);
+	/** Benchmark callable node Lib060_Fn091 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn091(const TArray< int32 >& In0, FVector& Out1);
+	/** Benchmark callable node Lib060_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static void Lib060_Fn092(bool In0, UObject* In1, UObject* In2, int32& Out3, int32& Out4, FString& Out5, int32& Out6);
+	/** Benchmark callable node Lib060_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static int32 Lib060_Fn093(const FTransform& In0, float In1);
+	/** Benchmark pure node Lib060_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn094(UObject* In0, const FString& In1, float In2);
+	/** Benchmark pure node Lib060_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn095(const FTransform& In0, UObject* In1, const FTransform& In2);
+	/** Benchmark callable node Lib060_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn096(FName In0, const FString& In1, float In2);
+	/** Benchmark pure node Lib060_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static bool Lib060_Fn097(int32& Out0, int32& Out1, FString& Out2, int32& Out3, bool In4, FString& Out5);
+	/** Benchmark pure node Lib060_Fn098 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib060")
+	static float Lib060_Fn098(const FTransform& In0, const FTransform& In1, const TArray< int32 >& In2, int32& Out3);
+	/** Benchmark callable node Lib060_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib060")
+	static FString Lib060_Fn099(const FVector& In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_061 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib061_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn000(const TArray< int32 >& In0, bool In1, FString& Out2, int32 In3, const FTransform& In4);
+	/** Benchmark pure node Lib061_Fn001 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn001(const FString& In0, float In1, FString& Out2);
+	/** Benchmark callable node Lib061_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn002(const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib061_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn003(int32 In0, FName In1, FName In2, bool In3);
+	/** Benchmark callable node Lib061_Fn004 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn004(int32 In0, const FString& In1);
+	/** Benchmark pure node Lib061_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn005(FVector& Out0);
+	/** Benchmark callable node Lib061_Fn006 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn006();
+	/** Benchmark callable node Lib061_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn007(float In0, FString& Out1, UObject* In2, int32 In3, int32& Out4, UObject* In5);
+	/** Benchmark pure node Lib061_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn008(int32& Out0, FVector& Out1, const FTransform& In2, int32& Out3, int32 In4, const FVector& In5);
+	/** Benchmark callable node Lib061_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn009(float In0, FString& Out1, const FVector& In2);
+	/** Benchmark pure node Lib061_Fn010 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn010(const FTransform& In0);
+	/** Benchmark callable node Lib061_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn011(const FString& In0, float In1, const FString& In2, float In3, FName In4, const FTransform& In5, FName In6);
+	/** Benchmark callable node Lib061_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn012(bool In0);
+	/** Benchmark callable node Lib061_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn013(bool In0, bool In1, FString& Out2);
+	/** Benchmark callable node Lib061_Fn014 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn014(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib061_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn015(int32& Out0, FString& Out1, int32& Out2, int32 In3, FVector& Out4, UObject* In5);
+	/** Benchmark latent node Lib061_Fn016 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FTransform& In1, int32 In2);
+	/** Benchmark pure node Lib061_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn017(const FVector& In0, float In1, bool In2);
+	/** Benchmark pure node Lib061_Fn018 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn018(const FTransform& In0, FString& Out1, int32 In2, int32& Out3, bool In4, FName In5, FName In6);
+	/** Benchmark pure node Lib061_Fn019 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn019();
+	/** Benchmark callable node Lib061_Fn020 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn020(UObject* In0, const FVector& In1, FString& Out2, bool In3, FString& Out4, const FVector& In5, const FTransform& In6, float In7);
+	/** Benchmark pure node Lib061_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn021(FVector& Out0, int32& Out1, UObject* In2, bool In3, const FString& In4, FName In5);
+	/** Benchmark callable node Lib061_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn022(const TArray< int32 >& In0, float In1, UObject* In2);
+	/** Benchmark pure node Lib061_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn023(const FString& In0, const TArray< int32 >& In1, bool In2);
+	/** Benchmark pure node Lib061_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn024(const FString& In0, const FVector& In1, const TArray< int32 >& In2, bool In3, const FString& In4, UObject* In5, FName In6, float In7);
+	/** Benchmark callable node Lib061_Fn025 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn025();
+	/** Benchmark pure node Lib061_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn026(int32& Out0, const FVector& In1, const FString& In2, float In3, const FString& In4, UObject* In5, FString& Out6, UObject* In7);
+	/** Benchmark pure node Lib061_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn027(const FTransform& In0, int32& Out1, UObject* In2, const FString& In3, const FVector& In4, FName In5, const FTransform& In6);
+	/** Benchmark callable node Lib061_Fn028 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn028();
+	/** Benchmark callable node Lib061_Fn029 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn029(int32 In0, int32 In1, FName In2, UObject* In3, int32 In4);
+	/** Benchmark pure node Lib061_Fn030 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn030();
+	/** Benchmark pure node Lib061_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn031(bool In0, bool In1, const FString& In2, const FVector& In3, int32& Out4);
+	/** Benchmark callable node Lib061_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn032();
+	/** Benchmark callable node Lib061_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn033(const FTransform& In0, const FVector& In1, const FTransform& In2, const FTransform& In3, const FVector& In4, const FTransform& In5);
+	/** Benchmark pure node Lib061_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn034(const FString& In0, bool In1, bool In2, float In3, int32 In4, const TArray< int32 >& In5, const FString& In6);
+	/** Benchmark callable node Lib061_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn035(FString& Out0, UObject* In1, FName In2, FVector& Out3, FVector& Out4, bool In5, bool In6, const FTransform& In7);
+	/** Benchmark callable node Lib061_Fn036 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn036(const TArray< int32 >& In0, int32 In1, const FString& In2, FName In3, FName In4, const TArray< int32 >& In5, FVector& Out6);
+	/** Benchmark callable node Lib061_Fn037 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn037(const TArray< int32 >& In0);
+	/** Benchmark latent node Lib061_Fn038 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FVector& In1, FString& Out2, const TArray< int32 >& In3, const FString& In4, FVector& Out5, const FString& In6, const FTransform& In7);
+	/** Benchmark callable node Lib061_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn039(const FVector& In0, const FVector& In1, int32 In2, float In3, const FTransform& In4, float In5, FString& Out6, int32& Out7);
+	/** Benchmark latent node Lib061_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, bool In1, const FTransform& In2, FString& Out3);
+	/** Benchmark pure node Lib061_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn041(const FTransform& In0, const FTransform& In1, float In2, int32 In3);
+	/** Benchmark pure node Lib061_Fn042 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn042(const FString& In0);
+	/** Benchmark pure node Lib061_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn043();
+	/** Benchmark pure node Lib061_Fn044 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn044(bool In0, const FTransform& In1, const TArray< int32 >& In2, const TArray< int32 >& In3, bool In4, UObject* In5, bool In6);
+	/** Benchmark callable node Lib061_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn045(UObject* In0);
+	/** Benchmark pure node Lib061_Fn046 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn046(const FVector& In0, FString& Out1, int32& Out2, const FVector& In3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib061_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn047(UObject* In0, const TArray< int32 >& In1, FVector& Out2, int32& Out3, FString& Out4, FString& Out5);
+	/** Benchmark pure node Lib061_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn048(int32& Out0, const FTransform& In1, int32& Out2, float In3, float In4, const TArray< int32 >& In5, const FVector& In6, int32 In7);
+	/** Benchmark pure node Lib061_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn049(UObject* In0, bool In1, const FVector& In2, const FVector& In3, const FVector& In4, FString& Out5, const FString& In6);
+	/** Benchmark callable node Lib061_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn050(UObject* In0, bool In1);
+	/** Benchmark callable node Lib061_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn051(bool In0, const FTransform& In1, FVector& Out2, const FTransform& In3, float In4, int32 In5);
+	/** Benchmark callable node Lib061_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn052(int32& Out0, bool In1, const FTransform& In2, bool In3);
+	/** Benchmark callable node Lib061_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn053(int32& Out0, const TArray< int32 >& In1, int32& Out2, FName In3);
+	/** Benchmark latent node Lib061_Fn054 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FTransform& In1, int32 In2, FString& Out3, FString& Out4, const FTransform& In5, FName In6);
+	/** Benchmark pure node Lib061_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn055(const TArray< int32 >& In0, const FVector& In1, int32 In2);
+	/** Benchmark pure node Lib061_Fn056 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn056(UObject* In0, FString& Out1);
+	/** Benchmark pure node Lib061_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn057(FName In0, int32 In1, bool In2);
+	/** Benchmark pure node Lib061_Fn058 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn058(bool In0, UObject* In1, const FString& In2);
+	/** Benchmark latent node Lib061_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FString& Out1, FName In2, int32 In3);
+	/** Benchmark pure node Lib061_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn060();
+	/** Benchmark callable node Lib061_Fn061 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn061(const FVector& In0, float In1, int32 In2, FString& Out3, int32& Out4, FVector& Out5, UObject* In6, const FString& In7);
+	/** Benchmark latent node Lib061_Fn062 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const TArray< int32 >& In1, bool In2);
+	/** Benchmark callable node Lib061_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn063(UObject* In0, int32 In1, int32& Out2);
+	/** Benchmark callable node Lib061_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn064(UObject* In0, int32& Out1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib061_Fn065 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn065(const FString& In0, bool In1, const FTransform& In2, const TArray< int32 >& In3, const FTransform& In4);
+	/** Benchmark callable node Lib061_Fn066 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn066(const FVector& In0, float In1, FString& Out2, const TArray< int32 >& In3, const FVector& In4);
+	/** Benchmark callable node Lib061_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn067(const FString& In0);
+	/** Benchmark pure node Lib061_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn068(UObject* In0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, const FString& In4, const FString& In5);
+	/** Benchmark callable node Lib061_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn069(int32& Out0, bool In1);
+	/** Benchmark pure node Lib061_Fn070 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn070(int32& Out0, FString& Out1);
+	/** Benchmark callable node Lib061_Fn071 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn071(const FTransform& In0, FName In1, const FTransform& In2, FVector& Out3, UObject* In4, int32& Out5, const FTransform& In6, const FTransform& In7);
+	/** Benchmark pure node Lib061_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn072(const TArray< int32 >& In0, FVector& Out1, int32 In2, const FString& In3, float In4, bool In5);
+	/** Benchmark pure node Lib061_Fn073 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn073(FString& Out0);
+	/** Benchmark callable node Lib061_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn074(float In0, float In1, FName In2, const FString& In3);
+	/** Benchmark callable node Lib061_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn075(float In0, UObject* In1);
+	/** Benchmark callable node Lib061_Fn076 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn076(const FVector& In0, FVector& Out1, bool In2, FVector& Out3, int32 In4, FName In5);
+	/** Benchmark pure node Lib061_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn077(int32 In0, const FTransform& In1, bool In2, float In3, FString& Out4, int32 In5, const FVector& In6);
+	/** Benchmark pure node Lib061_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn078();
+	/** Benchmark pure node Lib061_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn079(int32& Out0, const FString& In1, int32& Out2, const FVector& In3, UObject* In4);
+	/** Benchmark pure node Lib061_Fn080 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn080(bool In0);
+	/** Benchmark pure node Lib061_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn081(const FString& In0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib061_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn082(FName In0, FName In1, const FString& In2, float In3, const FTransform& In4);
+	/** Benchmark callable node Lib061_Fn083 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn083(const FTransform& In0, bool In1, int32 In2);
+	/** Benchmark pure node Lib061_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn084(int32& Out0, int32 In1, bool In2, const FString& In3, const FTransform& In4);
+	/** Benchmark callable node Lib061_Fn085 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn085(FString& Out0, int32& Out1);
+	/** Benchmark callable node Lib061_Fn086 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static void Lib061_Fn086(const FString& In0, float In1, const TArray< int32 >& In2, int32& Out3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark callable node Lib061_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn087(const TArray< int32 >& In0, UObject* In1);
+	/** Benchmark callable node Lib061_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn088(FString& Out0, const TArray< int32 >& In1, FName In2, int32& Out3);
+	/** Benchmark callable node Lib061_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn089(UObject* In0, UObject* In1, FName In2, FVector& Out3);
+	/** Benchmark callable node Lib061_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn090(const FVector& In0, bool In1, const FString& In2, FString& Out3);
+	/** Benchmark latent node Lib061_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, int32& Out1, const FString& In2);
+	/** Benchmark callable node Lib061_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static int32 Lib061_Fn092();
+	/** Benchmark latent node Lib061_Fn093 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib061_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark pure node Lib061_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn094(FVector& Out0, int32& Out1, FName In2);
+	/** Benchmark pure node Lib061_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static float Lib061_Fn095(const FString& In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib061_Fn096 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn096(FName In0, float In1, int32& Out2, FVector& Out3, const FString& In4, const FTransform& In5, int32& Out6);
+	/** Benchmark callable node Lib061_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FString Lib061_Fn097(const FTransform& In0, FName In1, bool In2, bool In3, int32 In4, float In5, const FVector& In6);
+	/** Benchmark callable node Lib061_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static FVector Lib061_Fn098(const FTransform& In0, bool In1, UObject* In2, int32 In3, int32& Out4);
+	/** Benchmark callable node Lib061_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib061")
+	static bool Lib061_Fn099(FName In0, float In1, const TArray< int32 >& In2, FName In3, const FVector& In4, float In5, const FString& In6);
+};
+
+
+UCLASS()
+class UKDGBenchLib_062 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib062_Fn000 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn000(bool In0, int32& Out1, const FVector& In2, const FVector& In3, int32& Out4);
+	/** Benchmark callable node Lib062_Fn001 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn001(FVector& Out0);
+	/** Benchmark callable node Lib062_Fn002 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn002(const FString& In0, FName In1, int32 In2, FName In3, int32 In4, int32& Out5, FString& Out6, float In7);
+	/** Benchmark callable node Lib062_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn003(const FVector& In0, const FVector& In1, float In2);
+	/** Benchmark callable node Lib062_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn004();
+	/** Benchmark pure node Lib062_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn005(FVector& Out0, const TArray< int32 >& In1, const FTransform& In2, FString& Out3);
+	/** Benchmark callable node Lib062_Fn006 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn006(bool In0, FVector& Out1, const FString& In2, FString& Out3, bool In4, const FVector& In5);
+	/** Benchmark callable node Lib062_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn007(int32 In0, bool In1, const TArray< int32 >& In2, const FVector& In3);
+	/** Benchmark pure node Lib062_Fn008 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn008(FName In0, int32& Out1, const FVector& In2, UObject* In3, bool In4, bool In5, const FString& In6);
+	/** Benchmark latent node Lib062_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, UObject* In2, const FVector& In3);
+	/** Benchmark pure node Lib062_Fn010 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn010(bool In0, int32& Out1, UObject* In2, const FString& In3, int32 In4, const FString& In5);
+	/** Benchmark callable node Lib062_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn011(FName In0, FVector& Out1, FString& Out2);
+	/** Benchmark callable node Lib062_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn012(int32& Out0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark latent node Lib062_Fn013 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FVector& In1);
+	/** Benchmark latent node Lib062_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FTransform& In1, float In2, int32& Out3, FString& Out4);
+	/** Benchmark callable node Lib062_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn015(FName In0, const FTransform& In1, int32 In2, int32& Out3, FString& Out4, const FString& In5);
+	/** Benchmark pure node Lib062_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn016();
+	/** Benchmark callable node Lib062_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn017(const FString& In0, const TArray< int32 >& In1, int32& Out2);
+	/** Benchmark callable node Lib062_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn018(float In0, bool In1, int32& Out2, const TArray< int32 >& In3, const FString& In4, const FString& In5);
+	/** Benchmark pure node Lib062_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn019(FString& Out0, const FVector& In1);
+	/** Benchmark pure node Lib062_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn020(const FString& In0);
+	/** Benchmark latent node Lib062_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0);
+	/** Benchmark callable node Lib062_Fn022 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn022(const FString& In0, const FVector& In1, int32 In2, FVector& Out3, int32& Out4, UObject* In5);
+	/** Benchmark pure node Lib062_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn023(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib062_Fn024 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn024();
+	/** Benchmark callable node Lib062_Fn025 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn025(const FString& In0, FString& Out1);
+	/** Benchmark pure node Lib062_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn026(FName In0, FVector& Out1, int32 In2, const FTransform& In3, float In4, UObject* In5, UObject* In6, bool In7);
+	/** Benchmark callable node Lib062_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn027(float In0, const FString& In1, float In2, const FTransform& In3, FVector& Out4, int32 In5, const FTransform& In6);
+	/** Benchmark callable node Lib062_Fn028 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn028();
+	/** Benchmark callable node Lib062_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn029();
+	/** Benchmark callable node Lib062_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn030(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, bool In3, FString& Out4, UObject* In5);
+	/** Benchmark latent node Lib062_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FVector& Out1, FVector& Out2);
+	/** Benchmark callable node Lib062_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn032();
+	/** Benchmark latent node Lib062_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FName In1);
+	/** Benchmark callable node Lib062_Fn034 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn034(float In0, const FString& In1, const FVector& In2, UObject* In3, FName In4, const TArray< int32 >& In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib062_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn035(bool In0);
+	/** Benchmark latent node Lib062_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FTransform& In1, const FString& In2);
+	/** Benchmark callable node Lib062_Fn037 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn037(const FTransform& In0, FVector& Out1);
+	/** Benchmark callable node Lib062_Fn038 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn038(int32 In0, int32& Out1, const FVector& In2);
+	/** Benchmark pure node Lib062_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn039(bool In0, const FString& In1, const FVector& In2, const FString& In3, FVector& Out4, const FVector& In5, int32& Out6, FString& Out7);
+	/** Benchmark pure node Lib062_Fn040 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn040(UObject* In0, const FString& In1, const FString& In2, float In3, const FVector& In4, const FVector& In5, bool In6);
+	/** Benchmark pure node Lib062_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn041(const TArray< int32 >& In0, float In1, int32 In2, FVector& Out3, bool In4, UObject* In5);
+	/** Benchmark callable node Lib062_Fn042 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn042(UObject* In0, int32 In1, const FString& In2, FName In3, const FVector& In4);
+	/** Benchmark pure node Lib062_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn043(const FTransform& In0, UObject* In1, bool In2);
+	/** Benchmark callable node Lib062_Fn044 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn044(UObject* In0);
+	/** Benchmark callable node Lib062_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn045(bool In0, int32 In1);
+	/** Benchmark callable node Lib062_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn046(FVector& Out0, int32 In1, int32 In2, const FTransform& In3, const FTransform& In4, FVector& Out5, FString& Out6);
+	/** Benchmark callable node Lib062_Fn047 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn047(int32& Out0, UObject* In1, UObject* In2, FVector& Out3, bool In4, int32 In5, int32 In6, FVector& Out7);
+	/** Benchmark pure node Lib062_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn048(const TArray< int32 >& In0, bool In1, float In2, const FTransform& In3, FVector& Out4, const FString& In5, const TArray< int32 >& In6, UObject* In7);
+	/** Benchmark callable node Lib062_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn049(float In0, FVector& Out1, UObject* In2, FString& Out3, const TArray< int32 >& In4, const FTransform& In5, const FVector& In6);
+	/** Benchmark callable node Lib062_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn050(const FTransform& In0, FName In1, UObject* In2, FName In3, bool In4);
+	/** Benchmark pure node Lib062_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn051(const FTransform& In0, int32 In1, FVector& Out2, float In3);
+	/** Benchmark callable node Lib062_Fn052 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static void Lib062_Fn052(const FTransform& In0, int32& Out1, bool In2, int32 In3, FString& Out4, FName In5, int32& Out6, int32& Out7);
+	/** Benchmark callable node Lib062_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn053(UObject* In0, FString& Out1, const FVector& In2, float In3, UObject* In4, FString& Out5);
+	/** Benchmark callable node Lib062_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn054(const FTransform& In0, FName In1);
+	/** Benchmark callable node Lib062_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn055(FString& Out0, bool In1);
+	/** Benchmark callable node Lib062_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn056(FVector& Out0, UObject* In1, bool In2, const FString& In3, FVector& Out4, int32 In5, const FTransform& In6, int32 In7);
+	/** Benchmark callable node Lib062_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn057();
+	/** Benchmark callable node Lib062_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn058(FName In0, bool In1, bool In2, FName In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib062_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn059(UObject* In0, const FTransform& In1, UObject* In2);
+	/** Benchmark callable node Lib062_Fn060 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn060(FName In0);
+	/** Benchmark callable node Lib062_Fn061 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn061(int32& Out0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib062_Fn062 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn062(const FVector& In0, bool In1, int32& Out2, const TArray< int32 >& In3, float In4, int32 In5, float In6, float In7);
+	/** Benchmark pure node Lib062_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn063(FName In0, FString& Out1);
+	/** Benchmark pure node Lib062_Fn064 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn064();
+	/** Benchmark pure node Lib062_Fn065 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn065(const FString& In0, const FVector& In1, const FVector& In2, FName In3);
+	/** Benchmark callable node Lib062_Fn066 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn066(float In0);
+	/** Benchmark callable node Lib062_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn067(const FVector& In0);
+	/** Benchmark callable node Lib062_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn068(FName In0, UObject* In1, const FTransform& In2, FName In3, const FTransform& In4, const FVector& In5);
+	/** Benchmark pure node Lib062_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn069(FName In0, const FString& In1, float In2, int32& Out3, int32& Out4);
+	/** Benchmark callable node Lib062_Fn070 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn070(const FVector& In0, FVector& Out1, UObject* In2, const TArray< int32 >& In3, bool In4);
+	/** Benchmark callable node Lib062_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn071();
+	/** Benchmark callable node Lib062_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn072(FName In0, FString& Out1);
+	/** Benchmark pure node Lib062_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn073(float In0, const FString& In1, FName In2, float In3, const FTransform& In4);
+	/** Benchmark callable node Lib062_Fn074 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn074(const TArray< int32 >& In0, bool In1, FString& Out2);
+	/** Benchmark callable node Lib062_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn075(bool In0, const TArray< int32 >& In1, int32& Out2, int32 In3);
+	/** Benchmark callable node Lib062_Fn076 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn076(FString& Out0, const TArray< int32 >& In1, FString& Out2, const FVector& In3, const FString& In4, bool In5, UObject* In6, FString& Out7);
+	/** Benchmark callable node Lib062_Fn077 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn077(const FTransform& In0, bool In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib062_Fn078 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn078(bool In0, const FTransform& In1);
+	/** Benchmark callable node Lib062_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn079(int32& Out0, int32& Out1, bool In2);
+	/** Benchmark callable node Lib062_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn080(const FString& In0, const FTransform& In1, float In2, FString& Out3, FName In4);
+	/** Benchmark pure node Lib062_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn081();
+	/** Benchmark callable node Lib062_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn082(bool In0, int32 In1, const FString& In2, bool In3, FName In4);
+	/** Benchmark callable node Lib062_Fn083 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn083(const FVector& In0);
+	/** Benchmark latent node Lib062_Fn084 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FVector& In1, bool In2, FVector& Out3, FString& Out4, int32& Out5, int32 In6, int32 In7);
+	/** Benchmark pure node Lib062_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn085(const FVector& In0, const FTransform& In1, FVector& Out2);
+	/** Benchmark pure node Lib062_Fn086 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn086(FVector& Out0);
+	/** Benchmark callable node Lib062_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn087(const FString& In0, int32& Out1, FVector& Out2);
+	/** Benchmark callable node Lib062_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn088(UObject* In0, const FVector& In1, UObject* In2, const FVector& In3, const FString& In4, int32 In5, const FString& In6, const FVector& In7);
+	/** Benchmark callable node Lib062_Fn089 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn089(const FVector& In0, const FVector& In1, int32 In2, const FString& In3, const FString& In4, FVector& Out5, int32& Out6);
+	/** Benchmark callable node Lib062_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn090(const FVector& In0, const FVector& In1, FVector& Out2, int32& Out3);
+	/** Benchmark pure node Lib062_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn091(const TArray< int32 >& In0, const FString& In1, bool In2, int32& Out3);
+	/** Benchmark callable node Lib062_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static bool Lib062_Fn092(FVector& Out0, const FVector& In1, const FString& In2, const FString& In3, bool In4, float In5, float In6);
+	/** Benchmark pure node Lib062_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static FVector Lib062_Fn093(int32& Out0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, const FString& In4, FString& Out5, bool In6, FString& Out7);
+	/** Benchmark pure node Lib062_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn094(FName In0, int32 In1, FName In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib062_Fn095 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static FString Lib062_Fn095(const FTransform& In0, FName In1, int32& Out2, UObject* In3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib062_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0);
+	/** Benchmark callable node Lib062_Fn097 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static float Lib062_Fn097();
+	/** Benchmark latent node Lib062_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib062_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib062_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib062")
+	static int32 Lib062_Fn099(int32& Out0, float In1, UObject* In2, bool In3, UObject* In4, int32& Out5, const FTransform& In6);
+};
+
+
+UCLASS()
+class UKDGBenchLib_063 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib063_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn000(int32& Out0, FName In1, const FVector& In2, float In3);
+	/** Benchmark callable node Lib063_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn001();
+	/** Benchmark callable node Lib063_Fn002 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn002();
+	/** Benchmark callable node Lib063_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn003(int32 In0, const FString& In1, bool In2, bool In3, FVector& Out4, float In5, float In6, int32 In7);
+	/** Benchmark callable node Lib063_Fn004 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn004(bool In0, FVector& Out1, FVector& Out2, const FString& In3);
+	/** Benchmark callable node Lib063_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn005(const FVector& In0);
+	/** Benchmark callable node Lib063_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn006(FName In0, float In1, const TArray< int32 >& In2);
+	/** Benchmark latent node Lib063_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark latent node Lib063_Fn008 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn008(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FVector& In1, const FString& In2, const FVector& In3, const FVector& In4, UObject* In5, const FVector& In6);
+	/** Benchmark pure node Lib063_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn009(float In0);
+	/** Benchmark pure node Lib063_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn010(const TArray< int32 >& In0, float In1, float In2, const TArray< int32 >& In3, int32& Out4);
+	/** Benchmark pure node Lib063_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn011(FString& Out0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib063_Fn012 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn012(float In0, FVector& Out1, FVector& Out2, const FVector& In3);
+	/** Benchmark pure node Lib063_Fn013 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn013(bool In0, const TArray< int32 >& In1, float In2, int32 In3);
+	/** Benchmark pure node Lib063_Fn014 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn014(UObject* In0, const FVector& In1);
+	/** Benchmark callable node Lib063_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn015(float In0, float In1, int32& Out2, FVector& Out3, const FString& In4, int32& Out5, float In6, FString& Out7);
+	/** Benchmark pure node Lib063_Fn016 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn016(FString& Out0, const TArray< int32 >& In1, const FVector& In2, FVector& Out3, FVector& Out4, bool In5, const FTransform& In6);
+	/** Benchmark pure node Lib063_Fn017 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn017(const TArray< int32 >& In0, const FTransform& In1, float In2, UObject* In3, int32 In4);
+	/** Benchmark callable node Lib063_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn018(FVector& Out0, FName In1, int32 In2, const FTransform& In3);
+	/** Benchmark callable node Lib063_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn019(int32& Out0, int32 In1, FVector& Out2, bool In3, bool In4, const FTransform& In5, bool In6, FName In7);
+	/** Benchmark callable node Lib063_Fn020 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn020(const TArray< int32 >& In0, FString& Out1, FName In2);
+	/** Benchmark callable node Lib063_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn021(bool In0, float In1, UObject* In2, int32 In3);
+	/** Benchmark callable node Lib063_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn022(const FTransform& In0, int32& Out1, FName In2, int32& Out3, const TArray< int32 >& In4, FName In5, FString& Out6);
+	/** Benchmark callable node Lib063_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn023(bool In0, const TArray< int32 >& In1, const FString& In2);
+	/** Benchmark callable node Lib063_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn024(FString& Out0, FName In1, FString& Out2, const FTransform& In3, const TArray< int32 >& In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark callable node Lib063_Fn025 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn025(int32& Out0, FString& Out1, const FVector& In2, bool In3, float In4);
+	/** Benchmark callable node Lib063_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn026();
+	/** Benchmark callable node Lib063_Fn027 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn027(int32& Out0, int32 In1, const FTransform& In2, int32& Out3, bool In4);
+	/** Benchmark callable node Lib063_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn028(const FTransform& In0, float In1, float In2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib063_Fn029 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn029(const FTransform& In0, bool In1, bool In2, bool In3, FVector& Out4, FVector& Out5);
+	/** Benchmark callable node Lib063_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn030(UObject* In0, FName In1);
+	/** Benchmark callable node Lib063_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn031(const FVector& In0, int32 In1, FString& Out2, const FTransform& In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib063_Fn032 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn032(float In0);
+	/** Benchmark pure node Lib063_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn033();
+	/** Benchmark callable node Lib063_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn034(const FVector& In0, float In1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib063_Fn035 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn035(const FTransform& In0, int32& Out1, FString& Out2, bool In3);
+	/** Benchmark callable node Lib063_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn036(const FString& In0, const FTransform& In1);
+	/** Benchmark callable node Lib063_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn037(int32& Out0, int32& Out1, const TArray< int32 >& In2, float In3, const FTransform& In4, FVector& Out5, FName In6);
+	/** Benchmark callable node Lib063_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn038(FName In0);
+	/** Benchmark callable node Lib063_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn039(FName In0, const FVector& In1, FVector& Out2, FName In3, const FVector& In4, FVector& Out5, const FVector& In6);
+	/** Benchmark pure node Lib063_Fn040 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn040(bool In0, const FVector& In1, int32 In2, float In3, FVector& Out4, UObject* In5, int32& Out6);
+	/** Benchmark callable node Lib063_Fn041 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn041(bool In0, int32 In1, const FTransform& In2, const FString& In3, float In4, FString& Out5, int32 In6);
+	/** Benchmark latent node Lib063_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, UObject* In2, float In3, FName In4);
+	/** Benchmark pure node Lib063_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn043(const FVector& In0, FVector& Out1, FVector& Out2);
+	/** Benchmark callable node Lib063_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn044(UObject* In0, UObject* In1, const TArray< int32 >& In2, UObject* In3, FString& Out4, FString& Out5, float In6, const FString& In7);
+	/** Benchmark latent node Lib063_Fn045 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, bool In2);
+	/** Benchmark callable node Lib063_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn046(FName In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib063_Fn047 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn047(const FString& In0);
+	/** Benchmark callable node Lib063_Fn048 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn048(FName In0, UObject* In1, FString& Out2);
+	/** Benchmark callable node Lib063_Fn049 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn049(float In0);
+	/** Benchmark latent node Lib063_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib063_Fn051 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn051();
+	/** Benchmark pure node Lib063_Fn052 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn052(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib063_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn053();
+	/** Benchmark callable node Lib063_Fn054 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn054(const FVector& In0, const FVector& In1, const FString& In2, float In3, const FVector& In4, int32& Out5, FString& Out6, const FVector& In7);
+	/** Benchmark latent node Lib063_Fn055 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, const FVector& In2, FString& Out3, const FVector& In4);
+	/** Benchmark latent node Lib063_Fn056 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, float In1, int32 In2, const FTransform& In3, int32 In4, const TArray< int32 >& In5, float In6, const FTransform& In7);
+	/** Benchmark callable node Lib063_Fn057 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn057(int32 In0, FName In1, const TArray< int32 >& In2, const FString& In3, FName In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib063_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn058(int32 In0, bool In1, FName In2, int32& Out3, FName In4);
+	/** Benchmark pure node Lib063_Fn059 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn059(bool In0, FString& Out1, const FVector& In2, const FVector& In3, int32 In4, float In5);
+	/** Benchmark callable node Lib063_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn060(const FTransform& In0, float In1, const FTransform& In2, const FString& In3, const TArray< int32 >& In4, FString& Out5, FName In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib063_Fn061 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn061(const FVector& In0);
+	/** Benchmark callable node Lib063_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn062(int32& Out0, FVector& Out1, int32 In2, int32& Out3, float In4, int32 In5, FName In6);
+	/** Benchmark pure node Lib063_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn063(float In0, int32 In1);
+	/** Benchmark callable node Lib063_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn064(int32& Out0, const FString& In1);
+	/** Benchmark callable node Lib063_Fn065 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn065(bool In0, float In1, UObject* In2, float In3);
+	/** Benchmark pure node Lib063_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn066(UObject* In0, const TArray< int32 >& In1, const TArray< int32 >& In2, bool In3, FName In4, UObject* In5, FString& Out6);
+	/** Benchmark callable node Lib063_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn067(int32 In0, FName In1, const TArray< int32 >& In2, UObject* In3, const TArray< int32 >& In4, bool In5, FName In6);
+	/** Benchmark callable node Lib063_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn068(int32& Out0);
+	/** Benchmark pure node Lib063_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn069(float In0, const TArray< int32 >& In1, int32& Out2, FString& Out3);
+	/** Benchmark latent node Lib063_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib063_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn071();
+	/** Benchmark callable node Lib063_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn072(UObject* In0, FVector& Out1, FName In2, int32& Out3, const FString& In4);
+	/** Benchmark pure node Lib063_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn073(int32 In0, const FTransform& In1, int32 In2, FVector& Out3, float In4, int32& Out5, UObject* In6, FString& Out7);
+	/** Benchmark callable node Lib063_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn074(FString& Out0, bool In1, FName In2, int32 In3, FName In4, float In5, int32& Out6);
+	/** Benchmark latent node Lib063_Fn075 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn075(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32 In1, FVector& Out2, int32 In3, FName In4, FString& Out5, const FTransform& In6, int32 In7);
+	/** Benchmark callable node Lib063_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn076(float In0, UObject* In1, bool In2, int32& Out3);
+	/** Benchmark callable node Lib063_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn077(UObject* In0);
+	/** Benchmark callable node Lib063_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn078(int32& Out0, int32& Out1, FName In2, FName In3, const FVector& In4, float In5, int32& Out6, const FString& In7);
+	/** Benchmark callable node Lib063_Fn079 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn079(UObject* In0, const FVector& In1, bool In2, const FVector& In3);
+	/** Benchmark pure node Lib063_Fn080 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn080();
+	/** Benchmark pure node Lib063_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn081();
+	/** Benchmark latent node Lib063_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark pure node Lib063_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn083(const FString& In0, bool In1);
+	/** Benchmark callable node Lib063_Fn084 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FVector Lib063_Fn084(int32& Out0, FName In1, int32 In2, const FTransform& In3, int32 In4, int32& Out5, const FVector& In6, int32 In7);
+	/** Benchmark callable node Lib063_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn085(const FTransform& In0, FString& Out1, const FString& In2, const FTransform& In3, const TArray< int32 >& In4, int32 In5, int32 In6, int32& Out7);
+	/** Benchmark callable node Lib063_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn086(bool In0, FString& Out1);
+	/** Benchmark pure node Lib063_Fn087 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn087(FName In0, int32 In1, UObject* In2, float In3, FName In4, int32& Out5, int32& Out6, const FString& In7);
+	/** Benchmark pure node Lib063_Fn088 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn088(FString& Out0, FString& Out1);
+	/** Benchmark callable node Lib063_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn089(FName In0, float In1);
+	/** Benchmark callable node Lib063_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static int32 Lib063_Fn090(float In0, UObject* In1);
+	/** Benchmark latent node Lib063_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FVector& In1, const TArray< int32 >& In2, FString& Out3);
+	/** Benchmark callable node Lib063_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn092(FName In0, const TArray< int32 >& In1, const FString& In2, FString& Out3, const FString& In4, bool In5, const FVector& In6);
+	/** Benchmark callable node Lib063_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static void Lib063_Fn093(int32& Out0, int32 In1, FName In2, UObject* In3);
+	/** Benchmark callable node Lib063_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn094(float In0, FName In1, float In2);
+	/** Benchmark latent node Lib063_Fn095 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1, const FTransform& In2, const FTransform& In3, FVector& Out4);
+	/** Benchmark callable node Lib063_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static float Lib063_Fn096(const FString& In0, const FVector& In1, UObject* In2, const FVector& In3, FVector& Out4, UObject* In5);
+	/** Benchmark latent node Lib063_Fn097 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib063_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FString& In1, float In2);
+	/** Benchmark callable node Lib063_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static bool Lib063_Fn098(FName In0, FString& Out1, int32 In2, FString& Out3, bool In4, int32 In5, UObject* In6);
+	/** Benchmark callable node Lib063_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib063")
+	static FString Lib063_Fn099(FVector& Out0, int32 In1, float In2, int32 In3);
+};
+
+
+UCLASS()
+class UKDGBenchLib_064 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib064_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn000(int32& Out0, UObject* In1, int32& Out2, const FTransform& In3, FVector& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib064_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn001(bool In0, FName In1, const FTransform& In2, const FTransform& In3, UObject* In4, const FTransform& In5, FString& Out6, FName In7);
+	/** Benchmark pure node Lib064_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn002(FVector& Out0, float In1, bool In2, const FTransform& In3, const FString& In4);
+	/** Benchmark callable node Lib064_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn003(FName In0, FString& Out1, const FTransform& In2, int32 In3, FVector& Out4, int32& Out5, const TArray< int32 >& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib064_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn004(bool In0, const FString& In1, int32& Out2, FName In3, UObject* In4, FName In5, bool In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib064_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn005(UObject* In0);
+	/** Benchmark callable node Lib064_Fn006 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn006();
+	/** Benchmark callable node Lib064_Fn007 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn007(FName In0, const FVector& In1, FString& Out2, bool In3, const TArray< int32 >& In4, const FTransform& In5, float In6, FName In7);
+	/** Benchmark callable node Lib064_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn008();
+	/** Benchmark callable node Lib064_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn009(FVector& Out0, float In1, float In2);
+	/** Benchmark callable node Lib064_Fn010 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn010(float In0, FVector& Out1, FName In2, FName In3);
+	/** Benchmark callable node Lib064_Fn011 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn011(const TArray< int32 >& In0, FString& Out1, int32 In2, FString& Out3, int32 In4, const FVector& In5);
+	/** Benchmark callable node Lib064_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn012(float In0, const FString& In1, const FTransform& In2);
+	/** Benchmark latent node Lib064_Fn013 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FTransform& In1, int32& Out2, FVector& Out3, FName In4, int32& Out5, FVector& Out6);
+	/** Benchmark callable node Lib064_Fn014 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn014(const FString& In0, int32& Out1, int32 In2, const FString& In3, const TArray< int32 >& In4, bool In5, FVector& Out6, FName In7);
+	/** Benchmark callable node Lib064_Fn015 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn015(int32& Out0, FName In1, int32 In2);
+	/** Benchmark callable node Lib064_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn016(bool In0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark callable node Lib064_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn017(UObject* In0, FString& Out1, UObject* In2);
+	/** Benchmark latent node Lib064_Fn018 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FVector& Out1, UObject* In2, UObject* In3, FName In4, const FVector& In5, const FTransform& In6);
+	/** Benchmark callable node Lib064_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn019(const FString& In0, const FString& In1);
+	/** Benchmark pure node Lib064_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn020(bool In0);
+	/** Benchmark callable node Lib064_Fn021 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn021();
+	/** Benchmark callable node Lib064_Fn022 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn022(FName In0, bool In1);
+	/** Benchmark callable node Lib064_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn023(bool In0, FVector& Out1);
+	/** Benchmark latent node Lib064_Fn024 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FVector& In1, int32 In2, const FString& In3, FName In4, FString& Out5, float In6, const FVector& In7);
+	/** Benchmark pure node Lib064_Fn025 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn025(const TArray< int32 >& In0, FVector& Out1, UObject* In2, const FTransform& In3, UObject* In4);
+	/** Benchmark callable node Lib064_Fn026 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn026();
+	/** Benchmark callable node Lib064_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn027(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib064_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn028(int32 In0);
+	/** Benchmark latent node Lib064_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, bool In1, int32 In2, FName In3, const FTransform& In4, int32& Out5);
+	/** Benchmark pure node Lib064_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn030(FString& Out0, const FTransform& In1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark latent node Lib064_Fn031 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FString& In1, bool In2, bool In3);
+	/** Benchmark latent node Lib064_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0);
+	/** Benchmark callable node Lib064_Fn033 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn033(FVector& Out0, bool In1, bool In2, const FTransform& In3, int32& Out4, float In5, FString& Out6);
+	/** Benchmark pure node Lib064_Fn034 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn034(const FString& In0, FString& Out1, UObject* In2, const FString& In3, const FString& In4);
+	/** Benchmark callable node Lib064_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn035(const FTransform& In0, const FTransform& In1, FString& Out2, int32& Out3, const FTransform& In4, FName In5);
+	/** Benchmark callable node Lib064_Fn036 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn036(float In0, bool In1, float In2, FName In3, bool In4, const FVector& In5);
+	/** Benchmark callable node Lib064_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn037(bool In0, const FString& In1, int32& Out2, FVector& Out3, int32& Out4);
+	/** Benchmark callable node Lib064_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn038(const FTransform& In0, const FString& In1, const FString& In2, bool In3, bool In4, FString& Out5, int32 In6);
+	/** Benchmark callable node Lib064_Fn039 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn039(FName In0, bool In1, FName In2, const FString& In3);
+	/** Benchmark callable node Lib064_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn040(const FTransform& In0, const FVector& In1, bool In2, int32 In3, int32& Out4, float In5);
+	/** Benchmark latent node Lib064_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, FVector& Out2, float In3, float In4, FString& Out5);
+	/** Benchmark callable node Lib064_Fn042 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn042(int32 In0, FString& Out1, bool In2, int32 In3, FVector& Out4, bool In5, const TArray< int32 >& In6, FVector& Out7);
+	/** Benchmark callable node Lib064_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn043(const TArray< int32 >& In0, FVector& Out1, const TArray< int32 >& In2, UObject* In3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib064_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn044(int32& Out0, bool In1, const FString& In2, UObject* In3, int32 In4, const FTransform& In5);
+	/** Benchmark callable node Lib064_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn045(bool In0);
+	/** Benchmark callable node Lib064_Fn046 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn046();
+	/** Benchmark pure node Lib064_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn047(int32& Out0, const FString& In1, FName In2);
+	/** Benchmark callable node Lib064_Fn048 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn048(FVector& Out0, FVector& Out1, int32 In2, const FTransform& In3, bool In4, const FString& In5);
+	/** Benchmark callable node Lib064_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn049(int32 In0, UObject* In1, FName In2);
+	/** Benchmark callable node Lib064_Fn050 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn050(FVector& Out0, float In1, const FString& In2);
+	/** Benchmark callable node Lib064_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn051(FVector& Out0, const FTransform& In1);
+	/** Benchmark latent node Lib064_Fn052 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, UObject* In1, int32& Out2, FString& Out3);
+	/** Benchmark callable node Lib064_Fn053 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn053(float In0, const TArray< int32 >& In1, float In2);
+	/** Benchmark latent node Lib064_Fn054 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, int32 In1, float In2, int32& Out3, const FString& In4, FString& Out5, FVector& Out6);
+	/** Benchmark callable node Lib064_Fn055 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn055(bool In0, bool In1, FVector& Out2, float In3, FVector& Out4, const FTransform& In5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark pure node Lib064_Fn056 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn056(FVector& Out0, const FVector& In1);
+	/** Benchmark callable node Lib064_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn057(FName In0, int32 In1, const FTransform& In2, bool In3, FName In4, const FString& In5, const FVector& In6, FVector& Out7);
+	/** Benchmark pure node Lib064_Fn058 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn058(FName In0, FName In1, FVector& Out2, const TArray< int32 >& In3, const FTransform& In4, int32& Out5, FString& Out6);
+	/** Benchmark pure node Lib064_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn059(const TArray< int32 >& In0, const FVector& In1, FName In2, UObject* In3, int32& Out4, float In5, const FTransform& In6, FVector& Out7);
+	/** Benchmark callable node Lib064_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn060();
+	/** Benchmark callable node Lib064_Fn061 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn061(FName In0, int32& Out1, float In2, UObject* In3, const FString& In4, int32& Out5, float In6, FVector& Out7);
+	/** Benchmark callable node Lib064_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn062(bool In0, FString& Out1);
+	/** Benchmark callable node Lib064_Fn063 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn063();
+	/** Benchmark callable node Lib064_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn064(const TArray< int32 >& In0, FName In1, int32 In2, bool In3);
+	/** Benchmark callable node Lib064_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn065(const FString& In0, int32& Out1, bool In2, bool In3, bool In4, UObject* In5, int32& Out6, int32 In7);
+	/** Benchmark callable node Lib064_Fn066 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn066(int32& Out0, int32& Out1, const FString& In2, float In3, FName In4, FName In5);
+	/** Benchmark callable node Lib064_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn067(const FTransform& In0);
+	/** Benchmark callable node Lib064_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static void Lib064_Fn068(int32& Out0, const FTransform& In1, int32& Out2, FVector& Out3, UObject* In4, bool In5);
+	/** Benchmark callable node Lib064_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn069(int32& Out0, FString& Out1, int32 In2, const FVector& In3, FString& Out4, const FVector& In5);
+	/** Benchmark callable node Lib064_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn070(const FVector& In0, const FString& In1, const FVector& In2, FName In3, int32& Out4, int32& Out5, FVector& Out6);
+	/** Benchmark callable node Lib064_Fn071 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn071(const FTransform& In0, bool In1, FName In2, FName In3, float In4, FName In5, int32 In6, FString& Out7);
+	/** Benchmark callable node Lib064_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn072(const FVector& In0, int32 In1);
+	/** Benchmark callable node Lib064_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn073(FString& Out0, const FVector& In1, const FVector& In2);
+	/** Benchmark callable node Lib064_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static float Lib064_Fn074(int32& Out0, const FString& In1);
+	/** Benchmark pure node Lib064_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn075(bool In0, int32& Out1);
+	/** Benchmark pure node Lib064_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn076(const FTransform& In0, const FVector& In1, const FTransform& In2);
+	/** Benchmark latent node Lib064_Fn077 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, UObject* In1, const FVector& In2, FVector& Out3, int32 In4, int32& Out5, bool In6, const FTransform& In7);
+	/** Benchmark callable node Lib064_Fn078 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn078(UObject* In0, bool In1, int32& Out2);
+	/** Benchmark callable node Lib064_Fn079 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn079(bool In0, UObject* In1, const FVector& In2, int32& Out3);
+	/** Benchmark pure node Lib064_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn080(UObject* In0, const FVector& In1, bool In2);
+	/** Benchmark latent node Lib064_Fn081 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32& Out1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, FName In5, const FVector& In6, bool In7);
+	/** Benchmark pure node Lib064_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn082(float In0, FString& Out1, int32& Out2, const FVector& In3, UObject* In4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark callable node Lib064_Fn083 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn083(const FString& In0, const FVector& In1, int32& Out2, const TArray< int32 >& In3, FName In4, float In5, const FVector& In6, FName In7);
+	/** Benchmark pure node Lib064_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn084(int32& Out0, bool In1, int32& Out2);
+	/** Benchmark callable node Lib064_Fn085 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn085(int32& Out0);
+	/** Benchmark callable node Lib064_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn086(float In0, FString& Out1, bool In2, FName In3, int32& Out4, const FVector& In5, const FTransform& In6);
+	/** Benchmark pure node Lib064_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn087(bool In0, int32& Out1, UObject* In2, const FTransform& In3, UObject* In4, FName In5, float In6);
+	/** Benchmark callable node Lib064_Fn088 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn088(UObject* In0);
+	/** Benchmark callable node Lib064_Fn089 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn089(const FString& In0, const FTransform& In1, FVector& Out2, UObject* In3, const FVector& In4);
+	/** Benchmark callable node Lib064_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn090(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib064_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn091(float In0, float In1, const FTransform& In2, int32& Out3, bool In4);
+	/** Benchmark callable node Lib064_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FString Lib064_Fn092(int32 In0, bool In1, const FTransform& In2, FString& Out3, int32& Out4, int32 In5, FString& Out6);
+	/** Benchmark pure node Lib064_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn093(FString& Out0, FName In1);
+	/** Benchmark pure node Lib064_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn094(FVector& Out0, FVector& Out1, const TArray< int32 >& In2, int32& Out3, int32& Out4, FVector& Out5, int32 In6, const FTransform& In7);
+	/** Benchmark callable node Lib064_Fn095 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn095(float In0, FName In1);
+	/** Benchmark latent node Lib064_Fn096 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib064_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0);
+	/** Benchmark pure node Lib064_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static FVector Lib064_Fn097(bool In0, UObject* In1, FName In2, FString& Out3, UObject* In4, const FTransform& In5);
+	/** Benchmark pure node Lib064_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib064")
+	static bool Lib064_Fn098(const FTransform& In0, const FTransform& In1);
+	/** Benchmark callable node Lib064_Fn099 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib064")
+	static int32 Lib064_Fn099(int32& Out0, int32 In1, FString& Out2, const FString& In3, int32 In4, float In5, int32 In6);
+};
+
+
+UCLASS()
+class UKDGBenchLib_065 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib065_Fn000 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn000();
+	/** Benchmark callable node Lib065_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn001(FName In0, const FString& In1, FString& Out2, const FTransform& In3, int32& Out4);
+	/** Benchmark callable node Lib065_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn002(int32& Out0, int32 In1, float In2);
+	/** Benchmark callable node Lib065_Fn003 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn003(int32& Out0, UObject* In1, FName In2);
+	/** Benchmark callable node Lib065_Fn004 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn004(bool In0, FName In1, const FVector& In2, const TArray< int32 >& In3, int32& Out4, int32 In5);
+	/** Benchmark pure node Lib065_Fn005 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn005(float In0, const FVector& In1, const FTransform& In2, FName In3, int32 In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib065_Fn006 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn006(int32& Out0);
+	/** Benchmark latent node Lib065_Fn007 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib065_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn008(FVector& Out0, int32& Out1, FVector& Out2, FName In3, FString& Out4, const FString& In5, float In6, bool In7);
+	/** Benchmark callable node Lib065_Fn009 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn009();
+	/** Benchmark pure node Lib065_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn010(const FVector& In0, float In1, bool In2, FString& Out3, int32 In4, int32& Out5, const FString& In6);
+	/** Benchmark pure node Lib065_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn011(bool In0, const TArray< int32 >& In1, int32 In2);
+	/** Benchmark callable node Lib065_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn012(FVector& Out0, UObject* In1, FName In2, const FVector& In3, FName In4, const FTransform& In5, FName In6, UObject* In7);
+	/** Benchmark callable node Lib065_Fn013 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn013(FName In0, const FVector& In1, UObject* In2, float In3, const FVector& In4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib065_Fn014 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn014(float In0, const FString& In1, int32 In2, int32 In3, float In4, const FString& In5, const FString& In6);
+	/** Benchmark pure node Lib065_Fn015 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn015(FName In0, bool In1);
+	/** Benchmark pure node Lib065_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn016(FVector& Out0, float In1, float In2, bool In3, const FVector& In4, FVector& Out5, const TArray< int32 >& In6, const FVector& In7);
+	/** Benchmark callable node Lib065_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn017(FVector& Out0, const FString& In1, FName In2, int32 In3);
+	/** Benchmark callable node Lib065_Fn018 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn018(int32& Out0, int32 In1, bool In2, float In3, const TArray< int32 >& In4, float In5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark pure node Lib065_Fn019 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn019(int32 In0);
+	/** Benchmark pure node Lib065_Fn020 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn020(FString& Out0, float In1, const FTransform& In2, const TArray< int32 >& In3, const FString& In4, int32 In5, int32& Out6);
+	/** Benchmark pure node Lib065_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn021(UObject* In0, const FTransform& In1, FString& Out2);
+	/** Benchmark pure node Lib065_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn022(int32& Out0, int32& Out1, const FVector& In2, FString& Out3);
+	/** Benchmark callable node Lib065_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn023(bool In0, const FVector& In1, const FVector& In2);
+	/** Benchmark callable node Lib065_Fn024 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn024();
+	/** Benchmark callable node Lib065_Fn025 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn025(const FVector& In0, const FVector& In1, const FTransform& In2, const TArray< int32 >& In3, FVector& Out4, FName In5, bool In6);
+	/** Benchmark callable node Lib065_Fn026 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn026(bool In0, const FTransform& In1, UObject* In2, bool In3);
+	/** Benchmark callable node Lib065_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn027(int32& Out0, float In1, UObject* In2);
+	/** Benchmark pure node Lib065_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn028(int32& Out0, float In1);
+	/** Benchmark pure node Lib065_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn029(int32 In0);
+	/** Benchmark callable node Lib065_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn030(bool In0, const TArray< int32 >& In1, FName In2, FName In3, float In4, const TArray< int32 >& In5, int32& Out6);
+	/** Benchmark latent node Lib065_Fn031 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, int32 In1, FVector& Out2, float In3, FString& Out4, int32& Out5, FVector& Out6);
+	/** Benchmark pure node Lib065_Fn032 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn032(FString& Out0, float In1, UObject* In2, int32& Out3);
+	/** Benchmark callable node Lib065_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn033();
+	/** Benchmark pure node Lib065_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn034(int32 In0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib065_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn035(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib065_Fn036 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn036();
+	/** Benchmark callable node Lib065_Fn037 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn037(int32 In0);
+	/** Benchmark latent node Lib065_Fn038 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0);
+	/** Benchmark callable node Lib065_Fn039 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn039(FVector& Out0, int32& Out1, float In2);
+	/** Benchmark pure node Lib065_Fn040 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn040(bool In0, const FVector& In1);
+	/** Benchmark latent node Lib065_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, int32& Out1, const FTransform& In2, FString& Out3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib065_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn042(int32& Out0, FVector& Out1, const TArray< int32 >& In2);
+	/** Benchmark latent node Lib065_Fn043 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FTransform& In1, const FTransform& In2, int32& Out3, FVector& Out4, bool In5, const FString& In6);
+	/** Benchmark callable node Lib065_Fn044 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn044(UObject* In0);
+	/** Benchmark callable node Lib065_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn045(FString& Out0);
+	/** Benchmark pure node Lib065_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn046(FString& Out0, FName In1, const FTransform& In2, UObject* In3, const FString& In4, UObject* In5, float In6);
+	/** Benchmark pure node Lib065_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn047(int32 In0, FString& Out1, int32 In2);
+	/** Benchmark pure node Lib065_Fn048 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn048(const FString& In0, int32& Out1, const FTransform& In2);
+	/** Benchmark latent node Lib065_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0);
+	/** Benchmark callable node Lib065_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn050(float In0, int32& Out1, const FVector& In2, float In3, const FTransform& In4);
+	/** Benchmark callable node Lib065_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn051(int32 In0, int32& Out1, const FTransform& In2, FString& Out3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib065_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn052(FName In0, bool In1);
+	/** Benchmark pure node Lib065_Fn053 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn053(int32 In0, FString& Out1, const TArray< int32 >& In2, const FTransform& In3, const FTransform& In4, FVector& Out5, const TArray< int32 >& In6, const FString& In7);
+	/** Benchmark pure node Lib065_Fn054 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn054(FName In0, UObject* In1, int32& Out2, int32 In3);
+	/** Benchmark pure node Lib065_Fn055 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn055(int32 In0, int32& Out1, int32 In2, FString& Out3, UObject* In4);
+	/** Benchmark callable node Lib065_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn056();
+	/** Benchmark callable node Lib065_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn057(float In0);
+	/** Benchmark pure node Lib065_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn058(UObject* In0, const FString& In1, bool In2, UObject* In3, const FTransform& In4, bool In5);
+	/** Benchmark pure node Lib065_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn059(UObject* In0, FVector& Out1, const FVector& In2);
+	/** Benchmark pure node Lib065_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn060();
+	/** Benchmark latent node Lib065_Fn061 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, UObject* In1, float In2, bool In3, FString& Out4, const TArray< int32 >& In5, const FString& In6, FString& Out7);
+	/** Benchmark callable node Lib065_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn062(bool In0, FString& Out1, FString& Out2, FString& Out3, FString& Out4, UObject* In5);
+	/** Benchmark pure node Lib065_Fn063 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn063();
+	/** Benchmark pure node Lib065_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn064(const FVector& In0, FVector& Out1, int32& Out2, float In3, FVector& Out4, FName In5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib065_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn065();
+	/** Benchmark callable node Lib065_Fn066 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn066(const FVector& In0, FName In1, FVector& Out2);
+	/** Benchmark callable node Lib065_Fn067 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn067(FString& Out0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib065_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn068(int32& Out0, UObject* In1, FString& Out2, const FVector& In3, bool In4);
+	/** Benchmark callable node Lib065_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn069(const FVector& In0, UObject* In1, int32& Out2, const FVector& In3, int32& Out4);
+	/** Benchmark callable node Lib065_Fn070 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn070(bool In0, int32& Out1);
+	/** Benchmark latent node Lib065_Fn071 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32 In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, const FVector& In5, const FTransform& In6, bool In7);
+	/** Benchmark pure node Lib065_Fn072 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn072(FString& Out0);
+	/** Benchmark callable node Lib065_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn073(bool In0, float In1, const TArray< int32 >& In2, const FString& In3, const FTransform& In4, int32 In5, UObject* In6, int32 In7);
+	/** Benchmark callable node Lib065_Fn074 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn074(bool In0, bool In1);
+	/** Benchmark pure node Lib065_Fn075 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn075(const FVector& In0);
+	/** Benchmark callable node Lib065_Fn076 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn076();
+	/** Benchmark callable node Lib065_Fn077 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn077(FName In0, UObject* In1, bool In2, int32& Out3, const FTransform& In4);
+	/** Benchmark pure node Lib065_Fn078 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn078(int32 In0, int32& Out1, FString& Out2, FString& Out3, const TArray< int32 >& In4, FString& Out5);
+	/** Benchmark pure node Lib065_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn079(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib065_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn080(bool In0, const FVector& In1, const FTransform& In2, float In3, bool In4);
+	/** Benchmark pure node Lib065_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn081(float In0, const FTransform& In1, FName In2, float In3);
+	/** Benchmark latent node Lib065_Fn082 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib065_Fn083 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn083(bool In0);
+	/** Benchmark callable node Lib065_Fn084 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn084(const FVector& In0, bool In1);
+	/** Benchmark pure node Lib065_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static FVector Lib065_Fn085(const FVector& In0, FVector& Out1, FString& Out2, const FString& In3, FVector& Out4, int32 In5, int32 In6);
+	/** Benchmark callable node Lib065_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn086(const FString& In0, FName In1, float In2, const FTransform& In3, const FTransform& In4, const TArray< int32 >& In5, const FString& In6);
+	/** Benchmark pure node Lib065_Fn087 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn087(int32 In0, const FString& In1);
+	/** Benchmark pure node Lib065_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static float Lib065_Fn088(const FTransform& In0, const FString& In1, FName In2, const FTransform& In3, float In4, const FVector& In5, int32& Out6, const FString& In7);
+	/** Benchmark callable node Lib065_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn089();
+	/** Benchmark pure node Lib065_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn090(const TArray< int32 >& In0, int32 In1, const TArray< int32 >& In2, const TArray< int32 >& In3, FString& Out4, const FTransform& In5, const FVector& In6);
+	/** Benchmark latent node Lib065_Fn091 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1, float In2, UObject* In3, FVector& Out4, const FString& In5);
+	/** Benchmark latent node Lib065_Fn092 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, UObject* In1, bool In2, int32 In3, FString& Out4, const FTransform& In5, const FString& In6, FString& Out7);
+	/** Benchmark callable node Lib065_Fn093 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn093(bool In0, const FString& In1, FString& Out2, FVector& Out3, FString& Out4, int32 In5, UObject* In6);
+	/** Benchmark pure node Lib065_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static bool Lib065_Fn094(float In0, const FString& In1, UObject* In2, FName In3, FVector& Out4);
+	/** Benchmark latent node Lib065_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FVector& Out1, int32& Out2);
+	/** Benchmark latent node Lib065_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib065_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, bool In1, const FTransform& In2, const FVector& In3);
+	/** Benchmark callable node Lib065_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static void Lib065_Fn097(UObject* In0, const FVector& In1, const TArray< int32 >& In2, int32 In3, bool In4, const FTransform& In5, const FTransform& In6);
+	/** Benchmark pure node Lib065_Fn098 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib065")
+	static int32 Lib065_Fn098(int32 In0, const FTransform& In1, const FTransform& In2, const FVector& In3, FString& Out4);
+	/** Benchmark callable node Lib065_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib065")
+	static FString Lib065_Fn099(const FTransform& In0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_066 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib066_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn000(FName In0, FVector& Out1, const TArray< int32 >& In2, float In3);
+	/** Benchmark callable node Lib066_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn001(const TArray< int32 >& In0, FName In1, FString& Out2, UObject* In3, FName In4);
+	/** Benchmark callable node Lib066_Fn002 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn002(const FVector& In0, FVector& Out1, const FVector& In2, UObject* In3, const FVector& In4, FString& Out5, FVector& Out6);
+	/** Benchmark callable node Lib066_Fn003 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn003(float In0, int32& Out1, FVector& Out2, const FTransform& In3, FString& Out4);
+	/** Benchmark latent node Lib066_Fn004 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1, const FVector& In2, UObject* In3, FName In4, const FString& In5, FVector& Out6);
+	/** Benchmark callable node Lib066_Fn005 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn005();
+	/** Benchmark pure node Lib066_Fn006 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn006(const FString& In0, int32 In1, const TArray< int32 >& In2, FVector& Out3, UObject* In4, const FTransform& In5, float In6, FName In7);
+	/** Benchmark pure node Lib066_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn007(float In0, UObject* In1, int32 In2, int32 In3, int32& Out4, int32& Out5, const FVector& In6);
+	/** Benchmark callable node Lib066_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn008();
+	/** Benchmark pure node Lib066_Fn009 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn009(int32 In0, FName In1, const FTransform& In2);
+	/** Benchmark pure node Lib066_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn010();
+	/** Benchmark pure node Lib066_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn011(int32& Out0, int32& Out1, FName In2, FName In3, FName In4, FString& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib066_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn012(UObject* In0, bool In1, bool In2, int32& Out3, const TArray< int32 >& In4, FString& Out5, UObject* In6, const FVector& In7);
+	/** Benchmark callable node Lib066_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn013(const TArray< int32 >& In0, FString& Out1, const FString& In2, float In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib066_Fn014 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn014(const FTransform& In0, int32 In1);
+	/** Benchmark pure node Lib066_Fn015 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn015(const FTransform& In0);
+	/** Benchmark callable node Lib066_Fn016 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn016(const FTransform& In0, const FString& In1, FString& Out2, FVector& Out3);
+	/** Benchmark callable node Lib066_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn017(FString& Out0, FName In1, int32& Out2);
+	/** Benchmark callable node Lib066_Fn018 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn018(bool In0, int32& Out1);
+	/** Benchmark pure node Lib066_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn019(bool In0, int32& Out1);
+	/** Benchmark latent node Lib066_Fn020 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, const FString& In4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark callable node Lib066_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn021(bool In0, int32 In1, FName In2, const FTransform& In3, int32 In4, UObject* In5);
+	/** Benchmark callable node Lib066_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn022(const FVector& In0, bool In1, FString& Out2);
+	/** Benchmark callable node Lib066_Fn023 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn023(float In0, int32& Out1, int32& Out2);
+	/** Benchmark pure node Lib066_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn024(const FTransform& In0, FName In1, int32 In2, FString& Out3, FVector& Out4, FVector& Out5, const FString& In6, bool In7);
+	/** Benchmark callable node Lib066_Fn025 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn025(FVector& Out0, bool In1, FString& Out2, FString& Out3, int32 In4);
+	/** Benchmark pure node Lib066_Fn026 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn026(FString& Out0, bool In1, FVector& Out2, const FString& In3, int32& Out4, FVector& Out5, const FString& In6, FString& Out7);
+	/** Benchmark callable node Lib066_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn027(float In0, FString& Out1, float In2);
+	/** Benchmark callable node Lib066_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn028(int32& Out0, int32 In1);
+	/** Benchmark callable node Lib066_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn029();
+	/** Benchmark callable node Lib066_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn030(float In0, UObject* In1);
+	/** Benchmark callable node Lib066_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn031(const FTransform& In0, bool In1, UObject* In2, const FString& In3, int32& Out4);
+	/** Benchmark callable node Lib066_Fn032 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn032(const FString& In0, FName In1, const FTransform& In2, const FTransform& In3, bool In4);
+	/** Benchmark callable node Lib066_Fn033 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn033(const FString& In0, int32 In1, FVector& Out2, UObject* In3, bool In4, FVector& Out5);
+	/** Benchmark latent node Lib066_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, float In1);
+	/** Benchmark latent node Lib066_Fn035 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn035(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, bool In1, bool In2, const FString& In3, const FTransform& In4, UObject* In5, FName In6);
+	/** Benchmark callable node Lib066_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn036(const TArray< int32 >& In0, FVector& Out1);
+	/** Benchmark callable node Lib066_Fn037 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn037(FString& Out0, float In1, int32& Out2, FString& Out3, UObject* In4, FString& Out5);
+	/** Benchmark callable node Lib066_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn038(int32 In0, const FVector& In1, FVector& Out2, FName In3, const FTransform& In4, UObject* In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib066_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn039(int32 In0, bool In1, float In2, UObject* In3, UObject* In4, FString& Out5, UObject* In6);
+	/** Benchmark pure node Lib066_Fn040 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn040(float In0, FString& Out1, int32 In2);
+	/** Benchmark callable node Lib066_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn041(int32 In0, const FTransform& In1, int32 In2, const FVector& In3, const FVector& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib066_Fn042 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn042(int32& Out0, const FString& In1, const FString& In2, FString& Out3);
+	/** Benchmark callable node Lib066_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn043(float In0, int32 In1, int32& Out2);
+	/** Benchmark pure node Lib066_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn044();
+	/** Benchmark latent node Lib066_Fn045 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, UObject* In1, float In2);
+	/** Benchmark pure node Lib066_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn046(const FTransform& In0, FName In1, const FTransform& In2, bool In3, FVector& Out4, const TArray< int32 >& In5, const FTransform& In6, const FVector& In7);
+	/** Benchmark callable node Lib066_Fn047 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn047(const FString& In0, const FString& In1, FString& Out2, float In3);
+	/** Benchmark pure node Lib066_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn048(FVector& Out0, FVector& Out1, int32 In2, FName In3, float In4, const FString& In5, float In6);
+	/** Benchmark callable node Lib066_Fn049 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn049(FName In0, int32 In1, bool In2, FString& Out3, FString& Out4, const TArray< int32 >& In5, int32 In6, float In7);
+	/** Benchmark callable node Lib066_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn050(float In0, const FString& In1, int32& Out2, UObject* In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib066_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn051(FString& Out0);
+	/** Benchmark callable node Lib066_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn052(FName In0, const FTransform& In1, int32 In2, UObject* In3);
+	/** Benchmark pure node Lib066_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn053(FName In0, const FVector& In1);
+	/** Benchmark callable node Lib066_Fn054 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn054(bool In0, const FString& In1, int32 In2);
+	/** Benchmark latent node Lib066_Fn055 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FTransform& In1);
+	/** Benchmark callable node Lib066_Fn056 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn056(int32 In0, const FVector& In1);
+	/** Benchmark callable node Lib066_Fn057 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn057(int32 In0, FVector& Out1, const FVector& In2, int32& Out3);
+	/** Benchmark pure node Lib066_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn058(const FVector& In0, const TArray< int32 >& In1, float In2, const FVector& In3, float In4);
+	/** Benchmark callable node Lib066_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn059(bool In0, float In1, FString& Out2, const FTransform& In3, const FString& In4, bool In5, FName In6, float In7);
+	/** Benchmark callable node Lib066_Fn060 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn060(UObject* In0, FName In1, FString& Out2);
+	/** Benchmark callable node Lib066_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn061(FName In0, int32 In1, UObject* In2, FName In3);
+	/** Benchmark callable node Lib066_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn062(float In0, bool In1, const FString& In2, const FVector& In3, UObject* In4, bool In5, FVector& Out6);
+	/** Benchmark pure node Lib066_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn063(const FVector& In0, const FVector& In1);
+	/** Benchmark pure node Lib066_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn064(float In0, const TArray< int32 >& In1, FName In2, bool In3);
+	/** Benchmark callable node Lib066_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn065();
+	/** Benchmark callable node Lib066_Fn066 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn066(bool In0, FString& Out1);
+	/** Benchmark callable node Lib066_Fn067 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn067(const FString& In0, const TArray< int32 >& In1, const FTransform& In2);
+	/** Benchmark callable node Lib066_Fn068 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn068(bool In0);
+	/** Benchmark callable node Lib066_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn069(float In0, FVector& Out1, int32& Out2, int32 In3, FVector& Out4, int32 In5);
+	/** Benchmark callable node Lib066_Fn070 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn070();
+	/** Benchmark pure node Lib066_Fn071 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn071(const FVector& In0, FName In1, const FTransform& In2, const FString& In3);
+	/** Benchmark callable node Lib066_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn072(FString& Out0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, const FVector& In4, const FTransform& In5);
+	/** Benchmark pure node Lib066_Fn073 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn073(int32& Out0, float In1, const FVector& In2, FString& Out3);
+	/** Benchmark callable node Lib066_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn074(int32 In0, const FTransform& In1, UObject* In2, const FVector& In3, FString& Out4, const FTransform& In5, const FTransform& In6);
+	/** Benchmark latent node Lib066_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn075(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, int32 In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib066_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn076(int32& Out0, FString& Out1, const FTransform& In2, const FTransform& In3, float In4);
+	/** Benchmark pure node Lib066_Fn077 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn077(FName In0, FName In1, const FTransform& In2, const FTransform& In3);
+	/** Benchmark callable node Lib066_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static void Lib066_Fn078();
+	/** Benchmark callable node Lib066_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn079(FName In0, bool In1, float In2);
+	/** Benchmark callable node Lib066_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn080(FVector& Out0, int32& Out1, int32 In2, FVector& Out3);
+	/** Benchmark pure node Lib066_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn081(const FTransform& In0, FString& Out1, FVector& Out2, const FVector& In3);
+	/** Benchmark callable node Lib066_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn082(bool In0, bool In1, const TArray< int32 >& In2, UObject* In3, UObject* In4);
+	/** Benchmark callable node Lib066_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn083();
+	/** Benchmark pure node Lib066_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn084(float In0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3, int32 In4, const FString& In5);
+	/** Benchmark callable node Lib066_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn085();
+	/** Benchmark pure node Lib066_Fn086 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn086();
+	/** Benchmark callable node Lib066_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn087();
+	/** Benchmark pure node Lib066_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn088(FName In0, UObject* In1, int32& Out2, FString& Out3, FString& Out4, int32& Out5, int32 In6);
+	/** Benchmark callable node Lib066_Fn089 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn089(const FString& In0);
+	/** Benchmark callable node Lib066_Fn090 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn090();
+	/** Benchmark callable node Lib066_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn091(FVector& Out0, bool In1, const FTransform& In2, const FString& In3, const TArray< int32 >& In4, FVector& Out5);
+	/** Benchmark callable node Lib066_Fn092 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn092(float In0, bool In1, int32 In2, const FTransform& In3, const FString& In4, const FTransform& In5, FVector& Out6);
+	/** Benchmark pure node Lib066_Fn093 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static bool Lib066_Fn093(int32& Out0, float In1, FName In2, float In3, UObject* In4, bool In5, UObject* In6);
+	/** Benchmark callable node Lib066_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static float Lib066_Fn094(int32& Out0, bool In1, int32 In2, const FString& In3);
+	/** Benchmark callable node Lib066_Fn095 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FVector Lib066_Fn095(float In0, int32 In1);
+	/** Benchmark latent node Lib066_Fn096 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib066_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FName In1, FVector& Out2, UObject* In3, UObject* In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark pure node Lib066_Fn097 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn097(int32 In0, FName In1, const FVector& In2);
+	/** Benchmark callable node Lib066_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static int32 Lib066_Fn098(int32& Out0, const TArray< int32 >& In1, const FTransform& In2);
+	/** Benchmark callable node Lib066_Fn099 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib066")
+	static FString Lib066_Fn099(const FVector& In0, FVector& Out1, FVector& Out2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_067 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib067_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn000(const TArray< int32 >& In0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib067_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn001(const FString& In0, UObject* In1, bool In2, bool In3, FString& Out4);
+	/** Benchmark callable node Lib067_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn002(FName In0, int32& Out1, const FString& In2, const FTransform& In3, FVector& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib067_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn003(FVector& Out0, float In1, int32& Out2, const TArray< int32 >& In3, int32 In4, int32 In5);
+	/** Benchmark pure node Lib067_Fn004 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn004(int32& Out0, const FVector& In1, float In2, const FTransform& In3);
+	/** Benchmark pure node Lib067_Fn005 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn005(FString& Out0, const FString& In1);
+	/** Benchmark callable node Lib067_Fn006 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static void Lib067_Fn006(bool In0, const FTransform& In1, FVector& Out2, int32 In3, int32 In4);
+	/** Benchmark callable node Lib067_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static void Lib067_Fn007(int32& Out0, FName In1, FVector& Out2, FName In3);
+	/** Benchmark pure node Lib067_Fn008 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn008(int32 In0);
+	/** Benchmark latent node Lib067_Fn009 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, bool In1);
+	/** Benchmark pure node Lib067_Fn010 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn010(FName In0);
+	/** Benchmark callable node Lib067_Fn011 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn011(const FTransform& In0);
+	/** Benchmark pure node Lib067_Fn012 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn012();
+	/** Benchmark pure node Lib067_Fn013 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn013(bool In0);
+	/** Benchmark callable node Lib067_Fn014 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn014(bool In0, FString& Out1, const FVector& In2, UObject* In3, const FTransform& In4, float In5, const FTransform& In6, bool In7);
+	/** Benchmark pure node Lib067_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn015(const FTransform& In0, UObject* In1, int32 In2, FName In3);
+	/** Benchmark callable node Lib067_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn016(FString& Out0, bool In1, const TArray< int32 >& In2, float In3, const FTransform& In4, float In5, const FVector& In6, FName In7);
+	/** Benchmark callable node Lib067_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn017(const FVector& In0, bool In1, const FVector& In2, int32& Out3);
+	/** Benchmark callable node Lib067_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn018(const TArray< int32 >& In0, float In1, UObject* In2, FString& Out3, FName In4, bool In5);
+	/** Benchmark latent node Lib067_Fn019 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn019(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, bool In1, FVector& Out2, const FString& In3, UObject* In4, FName In5, int32& Out6);
+	/** Benchmark pure node Lib067_Fn020 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn020(FString& Out0, float In1, FVector& Out2, FString& Out3, bool In4, FString& Out5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib067_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn021(UObject* In0, float In1, FName In2);
+	/** Benchmark callable node Lib067_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static void Lib067_Fn022(const FTransform& In0, FString& Out1, const FString& In2);
+	/** Benchmark pure node Lib067_Fn023 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn023(FString& Out0, float In1, int32 In2, int32& Out3, bool In4, FVector& Out5, UObject* In6);
+	/** Benchmark pure node Lib067_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn024(const FVector& In0, UObject* In1, int32& Out2, const FVector& In3, bool In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark pure node Lib067_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn025(const FTransform& In0);
+	/** Benchmark pure node Lib067_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn026(bool In0, bool In1, float In2, FVector& Out3, float In4);
+	/** Benchmark callable node Lib067_Fn027 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn027();
+	/** Benchmark callable node Lib067_Fn028 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn028();
+	/** Benchmark callable node Lib067_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn029(FString& Out0, int32 In1, UObject* In2, const FVector& In3, const TArray< int32 >& In4, int32 In5, float In6, int32 In7);
+	/** Benchmark callable node Lib067_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static void Lib067_Fn030(const FString& In0, int32& Out1, FName In2, const TArray< int32 >& In3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib067_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn031(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib067_Fn032 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn032(UObject* In0, int32 In1, UObject* In2, FName In3, bool In4, FString& Out5, UObject* In6);
+	/** Benchmark callable node Lib067_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn033(FName In0, FName In1, UObject* In2);
+	/** Benchmark latent node Lib067_Fn034 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1, float In2, const FTransform& In3, const FString& In4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib067_Fn035 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn035(const FVector& In0, float In1, int32 In2, const FTransform& In3, const FTransform& In4, FString& Out5, const FVector& In6);
+	/** Benchmark latent node Lib067_Fn036 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib067_Fn037 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib067_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn038();
+	/** Benchmark callable node Lib067_Fn039 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn039();
+	/** Benchmark callable node Lib067_Fn040 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn040(UObject* In0, const FVector& In1, const FVector& In2, int32& Out3, const TArray< int32 >& In4, float In5);
+	/** Benchmark callable node Lib067_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn041(FName In0, const FString& In1, FString& Out2, float In3, int32 In4, int32 In5);
+	/** Benchmark pure node Lib067_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn042(UObject* In0, float In1, FName In2, bool In3, int32& Out4, UObject* In5, float In6);
+	/** Benchmark callable node Lib067_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn043(UObject* In0, int32& Out1, const FTransform& In2, const FTransform& In3, const FTransform& In4, FName In5);
+	/** Benchmark callable node Lib067_Fn044 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn044(bool In0, const FTransform& In1, const FVector& In2, UObject* In3, const FTransform& In4, int32& Out5, FVector& Out6);
+	/** Benchmark callable node Lib067_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn045(UObject* In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib067_Fn046 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn046(FVector& Out0, const FString& In1, const TArray< int32 >& In2, int32& Out3, int32& Out4, FName In5);
+	/** Benchmark callable node Lib067_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn047(const FTransform& In0, const FString& In1, int32& Out2, FString& Out3, UObject* In4, int32 In5, FName In6);
+	/** Benchmark callable node Lib067_Fn048 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn048();
+	/** Benchmark latent node Lib067_Fn049 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, float In1, const FTransform& In2, const FTransform& In3, const TArray< int32 >& In4, FString& Out5, bool In6, int32 In7);
+	/** Benchmark callable node Lib067_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn050(const FVector& In0, float In1, const FString& In2, int32& Out3);
+	/** Benchmark callable node Lib067_Fn051 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn051(FName In0, UObject* In1, int32 In2, float In3, bool In4);
+	/** Benchmark callable node Lib067_Fn052 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn052(const TArray< int32 >& In0, const FTransform& In1, const FVector& In2, UObject* In3, const FVector& In4, const FTransform& In5, float In6);
+	/** Benchmark pure node Lib067_Fn053 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn053(FName In0, UObject* In1, float In2, FString& Out3, const FString& In4, int32 In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib067_Fn054 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn054();
+	/** Benchmark pure node Lib067_Fn055 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn055(FString& Out0, const FString& In1, int32& Out2, const FString& In3, FVector& Out4, int32& Out5);
+	/** Benchmark pure node Lib067_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn056();
+	/** Benchmark callable node Lib067_Fn057 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn057(UObject* In0, FVector& Out1, const FTransform& In2);
+	/** Benchmark pure node Lib067_Fn058 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn058(const FString& In0, int32 In1, UObject* In2);
+	/** Benchmark pure node Lib067_Fn059 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn059(bool In0, int32& Out1, float In2);
+	/** Benchmark callable node Lib067_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn060(const FVector& In0, FString& Out1);
+	/** Benchmark latent node Lib067_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, FName In2, const FTransform& In3, float In4);
+	/** Benchmark callable node Lib067_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn062(FName In0, FVector& Out1);
+	/** Benchmark latent node Lib067_Fn063 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, FVector& Out2, const FVector& In3, bool In4, float In5, int32& Out6);
+	/** Benchmark callable node Lib067_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn064(FName In0, const FTransform& In1, const FString& In2, FVector& Out3);
+	/** Benchmark callable node Lib067_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static void Lib067_Fn065(const FString& In0, FName In1);
+	/** Benchmark callable node Lib067_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static void Lib067_Fn066();
+	/** Benchmark callable node Lib067_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn067(const FString& In0, FName In1);
+	/** Benchmark pure node Lib067_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn068(int32 In0, bool In1, bool In2);
+	/** Benchmark pure node Lib067_Fn069 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn069(FVector& Out0, const FVector& In1, FName In2, const FTransform& In3, FName In4);
+	/** Benchmark callable node Lib067_Fn070 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static void Lib067_Fn070(const FTransform& In0, int32& Out1, int32 In2, const FString& In3, const FVector& In4, FName In5);
+	/** Benchmark pure node Lib067_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn071(const FString& In0);
+	/** Benchmark callable node Lib067_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn072(const FString& In0, const FString& In1, UObject* In2, FString& Out3, FName In4, FVector& Out5);
+	/** Benchmark pure node Lib067_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn073(FName In0, FString& Out1, float In2);
+	/** Benchmark pure node Lib067_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn074(const FVector& In0, const FVector& In1, const FTransform& In2, const FString& In3, const TArray< int32 >& In4, float In5, const FTransform& In6);
+	/** Benchmark callable node Lib067_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn075(const FVector& In0, bool In1, int32& Out2, int32 In3, const TArray< int32 >& In4, int32& Out5, bool In6);
+	/** Benchmark pure node Lib067_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn076(FVector& Out0, const FVector& In1);
+	/** Benchmark callable node Lib067_Fn077 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn077(const FTransform& In0);
+	/** Benchmark callable node Lib067_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn078(FString& Out0, int32& Out1, int32 In2, int32 In3, float In4, float In5, const TArray< int32 >& In6);
+	/** Benchmark latent node Lib067_Fn079 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, int32 In2, const FString& In3, const FVector& In4, FString& Out5, int32 In6, const FString& In7);
+	/** Benchmark callable node Lib067_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn080(const TArray< int32 >& In0, const FVector& In1, FVector& Out2, FName In3, UObject* In4);
+	/** Benchmark callable node Lib067_Fn081 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn081(int32& Out0, const FVector& In1, FName In2, const FTransform& In3, FName In4, UObject* In5, const TArray< int32 >& In6, UObject* In7);
+	/** Benchmark latent node Lib067_Fn082 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib067_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FTransform& In1, const FString& In2);
+	/** Benchmark callable node Lib067_Fn083 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn083(FString& Out0, const FString& In1, float In2, FName In3, const FString& In4);
+	/** Benchmark callable node Lib067_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn084(UObject* In0, const FString& In1, FVector& Out2, const FTransform& In3, FName In4, int32 In5);
+	/** Benchmark callable node Lib067_Fn085 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn085(int32 In0, FName In1, FVector& Out2, const FVector& In3, FString& Out4, FName In5, bool In6, const FString& In7);
+	/** Benchmark callable node Lib067_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn086(int32& Out0, float In1, FVector& Out2, int32& Out3, const FString& In4);
+	/** Benchmark pure node Lib067_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn087(const FVector& In0, const FTransform& In1, UObject* In2, const FString& In3, FVector& Out4, bool In5, const FVector& In6);
+	/** Benchmark callable node Lib067_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static float Lib067_Fn088(int32& Out0, const FTransform& In1, FString& Out2, const FVector& In3);
+	/** Benchmark callable node Lib067_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn089(int32 In0, UObject* In1, const FString& In2, int32& Out3);
+	/** Benchmark callable node Lib067_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn090(FName In0);
+	/** Benchmark callable node Lib067_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn091(const TArray< int32 >& In0, const FTransform& In1, FString& Out2, FName In3, FString& Out4);
+	/** Benchmark callable node Lib067_Fn092 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn092(FString& Out0, bool In1, FString& Out2, const FTransform& In3, bool In4, const FString& In5);
+	/** Benchmark pure node Lib067_Fn093 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static bool Lib067_Fn093();
+	/** Benchmark pure node Lib067_Fn094 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn094(FName In0, float In1, int32& Out2);
+	/** Benchmark callable node Lib067_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FString Lib067_Fn095(int32 In0, const TArray< int32 >& In1, FVector& Out2);
+	/** Benchmark pure node Lib067_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn096(int32 In0);
+	/** Benchmark callable node Lib067_Fn097 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static FVector Lib067_Fn097(const FTransform& In0, FString& Out1, const FVector& In2, FString& Out3, const FTransform& In4, FString& Out5, const FVector& In6, float In7);
+	/** Benchmark pure node Lib067_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn098(const FTransform& In0, FString& Out1);
+	/** Benchmark callable node Lib067_Fn099 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib067")
+	static int32 Lib067_Fn099(const TArray< int32 >& In0, FVector& Out1, int32& Out2, float In3, const FTransform& In4, FVector& Out5, UObject* In6, FVector& Out7);
+};
+
+
+UCLASS()
+class UKDGBenchLib_068 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib068_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn000(const FTransform& In0);
+	/** Benchmark pure node Lib068_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn001();
+	/** Benchmark callable node Lib068_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn002(UObject* In0, FVector& Out1, int32 In2, const FTransform& In3);
+	/** Benchmark pure node Lib068_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn003(const FString& In0, UObject* In1, bool In2, int32& Out3);
+	/** Benchmark pure node Lib068_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn004(FVector& Out0, int32& Out1, UObject* In2, int32& Out3, const FString& In4, UObject* In5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark latent node Lib068_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn005(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, int32 In1, FVector& Out2, float In3, bool In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib068_Fn006 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn006();
+	/** Benchmark callable node Lib068_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn007(int32 In0, int32& Out1, FString& Out2, const FVector& In3, const FVector& In4);
+	/** Benchmark callable node Lib068_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn008(bool In0, float In1, float In2, const TArray< int32 >& In3, const FVector& In4, UObject* In5);
+	/** Benchmark pure node Lib068_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn009(FName In0);
+	/** Benchmark callable node Lib068_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn010(const FString& In0, FVector& Out1, FString& Out2, const FTransform& In3, int32 In4);
+	/** Benchmark pure node Lib068_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn011(int32 In0, bool In1, int32& Out2);
+	/** Benchmark latent node Lib068_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FTransform& In1, int32& Out2, const FString& In3, FString& Out4);
+	/** Benchmark latent node Lib068_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib068_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn014(FString& Out0, bool In1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark pure node Lib068_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn015(FString& Out0, UObject* In1, const FTransform& In2, FVector& Out3, FVector& Out4, const FString& In5);
+	/** Benchmark callable node Lib068_Fn016 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn016(FName In0, bool In1);
+	/** Benchmark pure node Lib068_Fn017 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn017();
+	/** Benchmark callable node Lib068_Fn018 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn018(const FVector& In0, const FString& In1, UObject* In2, int32 In3);
+	/** Benchmark callable node Lib068_Fn019 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn019(FVector& Out0, FName In1, int32 In2, FString& Out3, const TArray< int32 >& In4, int32& Out5, FName In6, bool In7);
+	/** Benchmark pure node Lib068_Fn020 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn020(const TArray< int32 >& In0, float In1, FName In2, FString& Out3, float In4, int32 In5, FName In6);
+	/** Benchmark callable node Lib068_Fn021 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn021(const TArray< int32 >& In0, const FString& In1, const FVector& In2, FName In3);
+	/** Benchmark pure node Lib068_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn022(int32& Out0, int32& Out1, FString& Out2, FName In3, const TArray< int32 >& In4, const TArray< int32 >& In5, FName In6);
+	/** Benchmark pure node Lib068_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn023(int32& Out0);
+	/** Benchmark pure node Lib068_Fn024 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn024(int32& Out0, FString& Out1, FString& Out2, const TArray< int32 >& In3, const FTransform& In4, float In5, const FVector& In6);
+	/** Benchmark callable node Lib068_Fn025 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn025(int32 In0, const FVector& In1, FVector& Out2);
+	/** Benchmark callable node Lib068_Fn026 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn026(const TArray< int32 >& In0, UObject* In1);
+	/** Benchmark callable node Lib068_Fn027 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn027(int32 In0, const TArray< int32 >& In1, const FTransform& In2, float In3, const FVector& In4, float In5, const FVector& In6);
+	/** Benchmark pure node Lib068_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn028(FName In0, const TArray< int32 >& In1, const FTransform& In2, int32& Out3, FVector& Out4, FVector& Out5);
+	/** Benchmark callable node Lib068_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn029(const TArray< int32 >& In0, FVector& Out1, float In2, FName In3, bool In4, const FString& In5, UObject* In6, const FTransform& In7);
+	/** Benchmark latent node Lib068_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FString& In1, const FString& In2, FString& Out3, const FVector& In4, const FString& In5);
+	/** Benchmark pure node Lib068_Fn031 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn031(bool In0, const TArray< int32 >& In1, int32& Out2, bool In3);
+	/** Benchmark callable node Lib068_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static void Lib068_Fn032(int32& Out0, FString& Out1, UObject* In2, const FVector& In3, FVector& Out4, bool In5, int32& Out6, int32& Out7);
+	/** Benchmark callable node Lib068_Fn033 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn033();
+	/** Benchmark callable node Lib068_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn034(int32 In0, float In1, FString& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib068_Fn035 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn035(const FTransform& In0);
+	/** Benchmark latent node Lib068_Fn036 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FVector& Out1, bool In2, bool In3, FName In4);
+	/** Benchmark pure node Lib068_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn037();
+	/** Benchmark callable node Lib068_Fn038 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn038(float In0);
+	/** Benchmark pure node Lib068_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn039(int32 In0, FString& Out1);
+	/** Benchmark callable node Lib068_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn040(UObject* In0, FName In1, const FVector& In2, FName In3, const FString& In4, const FString& In5, const FVector& In6, FVector& Out7);
+	/** Benchmark callable node Lib068_Fn041 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn041(FVector& Out0, FString& Out1, int32& Out2, const FTransform& In3, UObject* In4);
+	/** Benchmark callable node Lib068_Fn042 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static void Lib068_Fn042(bool In0, FVector& Out1, float In2, const FTransform& In3, const FString& In4, const FTransform& In5, UObject* In6);
+	/** Benchmark callable node Lib068_Fn043 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn043();
+	/** Benchmark pure node Lib068_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn044(UObject* In0, const FVector& In1, FString& Out2, int32 In3, FVector& Out4);
+	/** Benchmark pure node Lib068_Fn045 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn045(bool In0, int32& Out1);
+	/** Benchmark pure node Lib068_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn046(FName In0);
+	/** Benchmark callable node Lib068_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn047(FString& Out0, FName In1, const FTransform& In2, float In3, bool In4, FVector& Out5, const FString& In6);
+	/** Benchmark callable node Lib068_Fn048 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn048(FVector& Out0, float In1, UObject* In2);
+	/** Benchmark callable node Lib068_Fn049 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn049();
+	/** Benchmark callable node Lib068_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn050(float In0);
+	/** Benchmark pure node Lib068_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn051(FName In0, FString& Out1);
+	/** Benchmark pure node Lib068_Fn052 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn052(int32 In0, FVector& Out1, int32 In2, const FString& In3, int32 In4, const FString& In5, FString& Out6, int32 In7);
+	/** Benchmark callable node Lib068_Fn053 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn053(UObject* In0, const FString& In1, FVector& Out2, bool In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib068_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn054(FString& Out0, FString& Out1);
+	/** Benchmark callable node Lib068_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn055(FVector& Out0, const FTransform& In1, FVector& Out2);
+	/** Benchmark callable node Lib068_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn056();
+	/** Benchmark latent node Lib068_Fn057 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1, int32& Out2);
+	/** Benchmark callable node Lib068_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn058(FName In0, const FString& In1, const FString& In2, FVector& Out3, bool In4);
+	/** Benchmark callable node Lib068_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn059(const FTransform& In0, FVector& Out1, int32 In2, FVector& Out3);
+	/** Benchmark callable node Lib068_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn060();
+	/** Benchmark callable node Lib068_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn061(FVector& Out0, float In1, const FString& In2, FName In3, FName In4, int32 In5);
+	/** Benchmark pure node Lib068_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn062(FVector& Out0, int32& Out1, bool In2, const FVector& In3);
+	/** Benchmark callable node Lib068_Fn063 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn063(FVector& Out0, const FTransform& In1, const FTransform& In2, const TArray< int32 >& In3, FName In4, const FTransform& In5, const FTransform& In6);
+	/** Benchmark latent node Lib068_Fn064 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, float In1);
+	/** Benchmark callable node Lib068_Fn065 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn065();
+	/** Benchmark callable node Lib068_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static void Lib068_Fn066();
+	/** Benchmark callable node Lib068_Fn067 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn067();
+	/** Benchmark pure node Lib068_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn068(const TArray< int32 >& In0, float In1, const FVector& In2);
+	/** Benchmark callable node Lib068_Fn069 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn069(float In0, FName In1, FString& Out2, const TArray< int32 >& In3, const TArray< int32 >& In4, FVector& Out5, FVector& Out6);
+	/** Benchmark callable node Lib068_Fn070 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn070(const FString& In0, const FVector& In1, float In2, float In3, float In4, FName In5);
+	/** Benchmark callable node Lib068_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn071(const FString& In0);
+	/** Benchmark pure node Lib068_Fn072 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn072(FVector& Out0, UObject* In1, FName In2, bool In3, const TArray< int32 >& In4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib068_Fn073 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn073(bool In0, const TArray< int32 >& In1, FVector& Out2, FVector& Out3);
+	/** Benchmark callable node Lib068_Fn074 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn074(FVector& Out0, float In1, FName In2);
+	/** Benchmark latent node Lib068_Fn075 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn075(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FName In1);
+	/** Benchmark pure node Lib068_Fn076 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn076(float In0, int32& Out1, UObject* In2, const FTransform& In3, float In4, const FVector& In5);
+	/** Benchmark latent node Lib068_Fn077 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark pure node Lib068_Fn078 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn078(bool In0, FName In1, FVector& Out2);
+	/** Benchmark callable node Lib068_Fn079 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn079(UObject* In0, const FTransform& In1, const FTransform& In2, const TArray< int32 >& In3, const FTransform& In4, int32 In5, const FVector& In6, FName In7);
+	/** Benchmark latent node Lib068_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FString& In1, float In2);
+	/** Benchmark callable node Lib068_Fn081 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn081(const TArray< int32 >& In0, UObject* In1);
+	/** Benchmark pure node Lib068_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static float Lib068_Fn082(int32 In0, float In1, const FVector& In2, FVector& Out3, const FVector& In4, FVector& Out5, const TArray< int32 >& In6);
+	/** Benchmark pure node Lib068_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn083();
+	/** Benchmark pure node Lib068_Fn084 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn084(const FString& In0, const FString& In1, const FString& In2, float In3, bool In4, const FTransform& In5);
+	/** Benchmark latent node Lib068_Fn085 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib068_Fn085(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib068_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn086(int32 In0, bool In1, const FVector& In2, const FVector& In3);
+	/** Benchmark callable node Lib068_Fn087 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn087(float In0, FString& Out1, const FVector& In2, const FString& In3, int32 In4);
+	/** Benchmark callable node Lib068_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FString Lib068_Fn088();
+	/** Benchmark pure node Lib068_Fn089 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn089(FString& Out0, UObject* In1, int32& Out2, bool In3, bool In4, bool In5, const FVector& In6, UObject* In7);
+	/** Benchmark callable node Lib068_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static void Lib068_Fn090(FVector& Out0, float In1);
+	/** Benchmark pure node Lib068_Fn091 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn091(const FTransform& In0, UObject* In1, float In2);
+	/** Benchmark pure node Lib068_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn092();
+	/** Benchmark callable node Lib068_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static void Lib068_Fn093(float In0, bool In1, const TArray< int32 >& In2, FString& Out3, float In4, const FTransform& In5, const TArray< int32 >& In6, float In7);
+	/** Benchmark callable node Lib068_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static FVector Lib068_Fn094(FVector& Out0, FName In1, FString& Out2, float In3, UObject* In4);
+	/** Benchmark callable node Lib068_Fn095 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn095(int32 In0, bool In1);
+	/** Benchmark callable node Lib068_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static int32 Lib068_Fn096(FString& Out0, FString& Out1, FString& Out2, const FVector& In3, FVector& Out4);
+	/** Benchmark pure node Lib068_Fn097 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn097(int32& Out0);
+	/** Benchmark callable node Lib068_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static void Lib068_Fn098(const FString& In0, const TArray< int32 >& In1, FVector& Out2, FVector& Out3, const FVector& In4, const FTransform& In5);
+	/** Benchmark callable node Lib068_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib068")
+	static bool Lib068_Fn099(const FVector& In0, int32 In1, int32& Out2, int32& Out3);
+};
+
+
+UCLASS()
+class UKDGBenchLib_069 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib069_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static void Lib069_Fn000(bool In0, FVector& Out1, const FVector& In2, const FVector& In3, const FTransform& In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark pure node Lib069_Fn001 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn001(const FString& In0);
+	/** Benchmark callable node Lib069_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static void Lib069_Fn002(int32 In0, const FVector& In1, FString& Out2, int32& Out3);
+	/** Benchmark callable node Lib069_Fn003 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn003(int32& Out0, FVector& Out1);
+	/** Benchmark latent node Lib069_Fn004 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0);
+	/** Benchmark callable node Lib069_Fn005 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn005(UObject* In0, const FTransform& In1, float In2);
+	/** Benchmark callable node Lib069_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn006(float In0, UObject* In1, int32& Out2);
+	/** Benchmark pure node Lib069_Fn007 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn007();
+	/** Benchmark callable node Lib069_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static void Lib069_Fn008(const FString& In0, int32& Out1, const FTransform& In2, FVector& Out3, const FVector& In4, bool In5);
+	/** Benchmark callable node Lib069_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn009(FVector& Out0, bool In1, int32 In2, int32 In3, float In4, bool In5);
+	/** Benchmark callable node Lib069_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn010(const FVector& In0, FName In1, FString& Out2, FString& Out3, FVector& Out4, const FString& In5, const FTransform& In6);
+	/** Benchmark callable node Lib069_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn011(const FString& In0, bool In1, const FVector& In2);
+	/** Benchmark latent node Lib069_Fn012 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FString& Out1, FName In2, FVector& Out3, const FVector& In4, FName In5, const FVector& In6);
+	/** Benchmark callable node Lib069_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn013(const FString& In0, int32 In1);
+	/** Benchmark callable node Lib069_Fn014 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn014(const FTransform& In0, bool In1, FString& Out2, const FString& In3, UObject* In4, UObject* In5);
+	/** Benchmark pure node Lib069_Fn015 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn015(float In0, int32 In1, const FString& In2, const FTransform& In3, bool In4, int32 In5, int32& Out6, FString& Out7);
+	/** Benchmark callable node Lib069_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn016();
+	/** Benchmark callable node Lib069_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn017(FString& Out0, const FString& In1, FString& Out2);
+	/** Benchmark pure node Lib069_Fn018 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn018(const TArray< int32 >& In0, const FString& In1);
+	/** Benchmark callable node Lib069_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static void Lib069_Fn019(FName In0, UObject* In1);
+	/** Benchmark callable node Lib069_Fn020 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn020(int32 In0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, int32& Out4, FName In5, float In6);
+	/** Benchmark callable node Lib069_Fn021 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn021(UObject* In0, bool In1, int32 In2, UObject* In3, const FString& In4, FString& Out5, FName In6);
+	/** Benchmark callable node Lib069_Fn022 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn022(const TArray< int32 >& In0, FVector& Out1, bool In2);
+	/** Benchmark callable node Lib069_Fn023 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn023(bool In0, FVector& Out1, UObject* In2, FVector& Out3, int32& Out4, int32 In5, float In6);
+	/** Benchmark callable node Lib069_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn024(const FVector& In0);
+	/** Benchmark pure node Lib069_Fn025 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn025(UObject* In0, bool In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4, bool In5, int32& Out6, int32& Out7);
+	/** Benchmark callable node Lib069_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static void Lib069_Fn026(int32 In0, const FVector& In1, FName In2, const FTransform& In3, const FVector& In4);
+	/** Benchmark callable node Lib069_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn027(int32 In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3);
+	/** Benchmark callable node Lib069_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn028(bool In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib069_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn029(int32 In0, const TArray< int32 >& In1, const FVector& In2);
+	/** Benchmark callable node Lib069_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn030(FName In0, float In1, UObject* In2, FVector& Out3, FString& Out4, FString& Out5);
+	/** Benchmark callable node Lib069_Fn031 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn031(FVector& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib069_Fn032 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn032(FName In0, int32& Out1, const FVector& In2, FString& Out3, FVector& Out4);
+	/** Benchmark latent node Lib069_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark pure node Lib069_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn034(FVector& Out0, int32 In1, const TArray< int32 >& In2, FString& Out3);
+	/** Benchmark pure node Lib069_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn035(float In0, int32& Out1);
+	/** Benchmark pure node Lib069_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn036(FVector& Out0, const FString& In1, bool In2, const FVector& In3, UObject* In4);
+	/** Benchmark callable node Lib069_Fn037 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn037(FVector& Out0, float In1, bool In2);
+	/** Benchmark pure node Lib069_Fn038 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn038(float In0, const FVector& In1, const FVector& In2, float In3, const FString& In4, const FVector& In5, int32 In6, const FTransform& In7);
+	/** Benchmark pure node Lib069_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn039(UObject* In0, FString& Out1, const FString& In2, int32 In3, const TArray< int32 >& In4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark latent node Lib069_Fn040 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1, FString& Out2, const FVector& In3, const FString& In4);
+	/** Benchmark callable node Lib069_Fn041 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn041(bool In0);
+	/** Benchmark callable node Lib069_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn042(bool In0, UObject* In1, const FVector& In2);
+	/** Benchmark pure node Lib069_Fn043 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn043(FVector& Out0, bool In1, FVector& Out2, const TArray< int32 >& In3, int32 In4, int32& Out5, int32& Out6, FString& Out7);
+	/** Benchmark callable node Lib069_Fn044 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn044(const FString& In0);
+	/** Benchmark pure node Lib069_Fn045 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn045(const FTransform& In0, FVector& Out1, const TArray< int32 >& In2, float In3);
+	/** Benchmark callable node Lib069_Fn046 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn046(const FVector& In0);
+	/** Benchmark callable node Lib069_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn047(bool In0, FName In1, const FVector& In2, FVector& Out3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib069_Fn048 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn048(int32& Out0, FName In1);
+	/** Benchmark pure node Lib069_Fn049 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn049(bool In0, float In1);
+	/** Benchmark pure node Lib069_Fn050 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn050(int32& Out0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib069_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static void Lib069_Fn051(bool In0);
+	/** Benchmark callable node Lib069_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn052(FVector& Out0, const FTransform& In1);
+	/** Benchmark callable node Lib069_Fn053 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn053(FName In0);
+	/** Benchmark callable node Lib069_Fn054 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static void Lib069_Fn054(FVector& Out0);
+	/** Benchmark callable node Lib069_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn055();
+	/** Benchmark pure node Lib069_Fn056 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn056(const FTransform& In0, bool In1, int32 In2, FVector& Out3, FVector& Out4, float In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib069_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn057();
+	/** Benchmark callable node Lib069_Fn058 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn058(FString& Out0, FVector& Out1, bool In2);
+	/** Benchmark latent node Lib069_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib069_Fn060 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn060();
+	/** Benchmark pure node Lib069_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn061(const FVector& In0, FName In1, int32& Out2, int32& Out3, float In4, FVector& Out5);
+	/** Benchmark latent node Lib069_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0);
+	/** Benchmark callable node Lib069_Fn063 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn063(FName In0, const FTransform& In1);
+	/** Benchmark callable node Lib069_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn064(int32& Out0, bool In1);
+	/** Benchmark callable node Lib069_Fn065 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn065(const FTransform& In0, const FString& In1, const FTransform& In2, const FTransform& In3, const FTransform& In4, const FString& In5, bool In6);
+	/** Benchmark pure node Lib069_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn066();
+	/** Benchmark callable node Lib069_Fn067 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn067(UObject* In0, FVector& Out1, const FVector& In2, FVector& Out3, int32 In4, const FTransform& In5, UObject* In6);
+	/** Benchmark pure node Lib069_Fn068 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn068(const FTransform& In0, const FString& In1, FName In2, UObject* In3, int32& Out4, int32& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib069_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn069(FName In0, const FString& In1);
+	/** Benchmark callable node Lib069_Fn070 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn070(FName In0, float In1, const FTransform& In2, const TArray< int32 >& In3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib069_Fn071 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn071();
+	/** Benchmark pure node Lib069_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn072();
+	/** Benchmark callable node Lib069_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn073(float In0, FVector& Out1, FVector& Out2);
+	/** Benchmark callable node Lib069_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn074(const FVector& In0, float In1, int32 In2, float In3, FString& Out4, const FTransform& In5, FName In6);
+	/** Benchmark callable node Lib069_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn075(int32 In0, UObject* In1, const FVector& In2, const FVector& In3, FName In4, int32& Out5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark callable node Lib069_Fn076 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn076(int32 In0, const FString& In1, bool In2);
+	/** Benchmark pure node Lib069_Fn077 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn077();
+	/** Benchmark pure node Lib069_Fn078 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn078(FName In0, FName In1, int32 In2);
+	/** Benchmark pure node Lib069_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn079(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib069_Fn080 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn080(const FTransform& In0, float In1, bool In2, int32& Out3, const FVector& In4);
+	/** Benchmark callable node Lib069_Fn081 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn081(const FVector& In0, int32& Out1, FString& Out2, const FString& In3);
+	/** Benchmark pure node Lib069_Fn082 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FVector Lib069_Fn082(int32& Out0, const FString& In1, UObject* In2, int32 In3, const FTransform& In4, float In5);
+	/** Benchmark callable node Lib069_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn083(FName In0, int32 In1);
+	/** Benchmark pure node Lib069_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn084(const FVector& In0, FName In1, float In2);
+	/** Benchmark callable node Lib069_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn085(const FString& In0, const FVector& In1, int32 In2, int32 In3);
+	/** Benchmark callable node Lib069_Fn086 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn086(float In0, int32& Out1, FVector& Out2, FVector& Out3, const TArray< int32 >& In4, bool In5, int32& Out6);
+	/** Benchmark callable node Lib069_Fn087 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn087();
+	/** Benchmark callable node Lib069_Fn088 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn088(int32& Out0, int32& Out1, const FString& In2, bool In3);
+	/** Benchmark callable node Lib069_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn089(const FTransform& In0, bool In1);
+	/** Benchmark callable node Lib069_Fn090 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn090(FString& Out0, FString& Out1, int32 In2, FVector& Out3, bool In4, const FString& In5, bool In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib069_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn091(FVector& Out0, int32 In1, int32 In2, const FString& In3);
+	/** Benchmark callable node Lib069_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static FString Lib069_Fn092(float In0, const FString& In1, const FString& In2, UObject* In3);
+	/** Benchmark callable node Lib069_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn093(int32& Out0, const FVector& In1, FName In2, FString& Out3, bool In4, const FString& In5);
+	/** Benchmark pure node Lib069_Fn094 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static int32 Lib069_Fn094(FName In0);
+	/** Benchmark pure node Lib069_Fn095 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib069")
+	static float Lib069_Fn095(FName In0, FVector& Out1);
+	/** Benchmark callable node Lib069_Fn096 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069")
+	static bool Lib069_Fn096(float In0, int32& Out1, UObject* In2, const FTransform& In3, bool In4, int32& Out5);
+	/** Benchmark latent node Lib069_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib069_Fn098 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FString& Out1);
+	/** Benchmark latent node Lib069_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib069", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib069_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FTransform& In1, bool In2);
+};
+
@@ -0,0 +1,1020 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#include "KDGBenchLibraries_7.h"
+
+int32 UKDGBenchLib_070::Lib070_Fn000(UObject* In0, int32& Out1, const FTransform& In2, bool In3) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn001(FName In0, const TArray< int32 >& In1, const FVector& In2, const FVector& In3, FVector& Out4) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn002(int32& Out0, FName In1, FVector& Out2, const FVector& In3) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn003(float In0, const TArray< int32 >& In1, float In2) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn004(FName In0, const TArray< int32 >& In1, int32& Out2, int32& Out3) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn005(const TArray< int32 >& In0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3, FString& Out4, const FString& In5) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn006(FString& Out0, const FVector& In1, FName In2) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn007(FString& Out0) {}
+bool UKDGBenchLib_070::Lib070_Fn008() { return {}; }
+FString UKDGBenchLib_070::Lib070_Fn009(const TArray< int32 >& In0, int32 In1, const FString& In2) { return {}; }
+FString UKDGBenchLib_070::Lib070_Fn010(int32& Out0, UObject* In1, const FVector& In2, bool In3, int32 In4, const FString& In5, const FString& In6) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0) {}
+void UKDGBenchLib_070::Lib070_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3) {}
+bool UKDGBenchLib_070::Lib070_Fn013(UObject* In0, FVector& Out1, const FString& In2) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn014(UObject* In0, const FString& In1, const FString& In2) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn015(FString& Out0, bool In1, int32 In2, FVector& Out3, const FTransform& In4, UObject* In5, int32 In6, const FString& In7) {}
+void UKDGBenchLib_070::Lib070_Fn016(const FTransform& In0, float In1, UObject* In2, FString& Out3, bool In4) {}
+void UKDGBenchLib_070::Lib070_Fn017(FVector& Out0, FVector& Out1, FVector& Out2, const FVector& In3) {}
+FString UKDGBenchLib_070::Lib070_Fn018(const FVector& In0, const FTransform& In1, const TArray< int32 >& In2, UObject* In3) { return {}; }
+FString UKDGBenchLib_070::Lib070_Fn019(const FTransform& In0, UObject* In1, FVector& Out2, FVector& Out3, const FString& In4) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, float In1, const FString& In2) {}
+int32 UKDGBenchLib_070::Lib070_Fn021(const FTransform& In0) { return {}; }
+FString UKDGBenchLib_070::Lib070_Fn022(const TArray< int32 >& In0, FVector& Out1, FName In2, float In3, const FString& In4, FVector& Out5, bool In6) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn023(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1, FVector& Out2, int32 In3) {}
+void UKDGBenchLib_070::Lib070_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, const FTransform& In2, const FString& In3) {}
+void UKDGBenchLib_070::Lib070_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, const FString& In2, const FVector& In3, float In4, float In5) {}
+void UKDGBenchLib_070::Lib070_Fn026(float In0, FVector& Out1, const FTransform& In2) {}
+bool UKDGBenchLib_070::Lib070_Fn027(FName In0, int32 In1, UObject* In2) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn028(const TArray< int32 >& In0, int32& Out1, const FTransform& In2) { return {}; }
+FString UKDGBenchLib_070::Lib070_Fn029(int32 In0, const TArray< int32 >& In1, UObject* In2, const FTransform& In3, bool In4, FName In5, int32 In6, UObject* In7) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn030() { return {}; }
+float UKDGBenchLib_070::Lib070_Fn031(int32& Out0, FVector& Out1, int32& Out2, FString& Out3, const FVector& In4) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn032(FVector& Out0) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn033(FName In0, const FString& In1, int32& Out2, UObject* In3) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn034(const FVector& In0, const TArray< int32 >& In1, FName In2) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn035(FName In0, const TArray< int32 >& In1, bool In2, const TArray< int32 >& In3, int32 In4, UObject* In5, FName In6) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn036() { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn037() { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn038(UObject* In0, const FVector& In1, int32& Out2, const TArray< int32 >& In3, const FTransform& In4, UObject* In5, const FVector& In6, const FTransform& In7) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn039(const FVector& In0, FVector& Out1, const FVector& In2, FVector& Out3) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn040(UObject* In0) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_070::Lib070_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32 In1, const FString& In2) {}
+float UKDGBenchLib_070::Lib070_Fn043(int32& Out0, UObject* In1, float In2) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1, UObject* In2, float In3, const FTransform& In4, const FTransform& In5, float In6, UObject* In7) {}
+FVector UKDGBenchLib_070::Lib070_Fn045(const FTransform& In0, int32 In1, UObject* In2, const FTransform& In3) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, FString& Out2, bool In3, const FVector& In4, UObject* In5, FVector& Out6) {}
+int32 UKDGBenchLib_070::Lib070_Fn047() { return {}; }
+float UKDGBenchLib_070::Lib070_Fn048(const TArray< int32 >& In0, float In1, const FString& In2, UObject* In3, const FTransform& In4, const TArray< int32 >& In5) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn049(bool In0) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn050(FVector& Out0, const FVector& In1, float In2, FVector& Out3, const FVector& In4) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1) {}
+bool UKDGBenchLib_070::Lib070_Fn052(float In0) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn053(FString& Out0, FString& Out1, const TArray< int32 >& In2, bool In3, const FTransform& In4, int32 In5, int32& Out6, UObject* In7) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn054() {}
+bool UKDGBenchLib_070::Lib070_Fn055(UObject* In0, const FVector& In1, float In2, int32& Out3, FString& Out4, const TArray< int32 >& In5) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn056(const FString& In0, const FVector& In1, FVector& Out2, int32 In3, int32 In4) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn057(const TArray< int32 >& In0, FVector& Out1) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn058(const FString& In0, int32 In1, bool In2, const FString& In3, bool In4, UObject* In5, const FTransform& In6, FString& Out7) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+float UKDGBenchLib_070::Lib070_Fn060() { return {}; }
+void UKDGBenchLib_070::Lib070_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, const FTransform& In2, float In3) {}
+FString UKDGBenchLib_070::Lib070_Fn062(const FTransform& In0) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn063(const FTransform& In0, FName In1, UObject* In2, float In3, int32& Out4) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn064(FVector& Out0, FString& Out1, const FVector& In2, const FString& In3) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn065(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_070::Lib070_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0) {}
+float UKDGBenchLib_070::Lib070_Fn067(const FString& In0, FString& Out1, FVector& Out2, const TArray< int32 >& In3, bool In4, FName In5, const FTransform& In6) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn068(FName In0, const FVector& In1, int32& Out2, int32 In3, int32& Out4, FName In5, int32 In6) {}
+FVector UKDGBenchLib_070::Lib070_Fn069() { return {}; }
+void UKDGBenchLib_070::Lib070_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1, UObject* In2, FName In3, UObject* In4) {}
+FString UKDGBenchLib_070::Lib070_Fn071(FString& Out0, FString& Out1, FVector& Out2, FVector& Out3) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn072(float In0, int32& Out1, const FTransform& In2) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn073(FString& Out0) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn074(float In0, const FTransform& In1, const FString& In2, float In3, const FVector& In4, const TArray< int32 >& In5) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn075(UObject* In0, const TArray< int32 >& In1, FVector& Out2) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn076(float In0) {}
+float UKDGBenchLib_070::Lib070_Fn077(const FVector& In0, const TArray< int32 >& In1, const FVector& In2, const FString& In3) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn078(UObject* In0, const FTransform& In1, FVector& Out2) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn079(const FString& In0, float In1) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn080(const FVector& In0, float In1) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn081(FVector& Out0, const TArray< int32 >& In1, const FString& In2, FString& Out3, UObject* In4) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, const FString& In2, const FVector& In3, bool In4, FString& Out5) {}
+void UKDGBenchLib_070::Lib070_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FString& Out1, FString& Out2, const FVector& In3, FVector& Out4) {}
+FVector UKDGBenchLib_070::Lib070_Fn084(UObject* In0, UObject* In1, int32 In2, UObject* In3, const FVector& In4, const TArray< int32 >& In5) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn085(bool In0) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn086(const FVector& In0, const FString& In1, const TArray< int32 >& In2, int32 In3, bool In4) { return {}; }
+bool UKDGBenchLib_070::Lib070_Fn087(const TArray< int32 >& In0, int32& Out1, FName In2, const FString& In3, const TArray< int32 >& In4, UObject* In5, FString& Out6, FVector& Out7) { return {}; }
+void UKDGBenchLib_070::Lib070_Fn088(FString& Out0, const TArray< int32 >& In1, const FVector& In2, int32 In3, int32 In4) {}
+void UKDGBenchLib_070::Lib070_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0) {}
+void UKDGBenchLib_070::Lib070_Fn090(int32 In0, const FVector& In1, const FVector& In2, const FVector& In3, const FVector& In4) {}
+FVector UKDGBenchLib_070::Lib070_Fn091(float In0) { return {}; }
+FString UKDGBenchLib_070::Lib070_Fn092(float In0, FName In1, FName In2, const FString& In3, FName In4, int32& Out5) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn093(const FString& In0, FString& Out1, const FVector& In2, FString& Out3, int32& Out4, FVector& Out5) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn094(const TArray< int32 >& In0, const FString& In1) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn095(FVector& Out0, float In1, FName In2, const FVector& In3, const FString& In4, FName In5) { return {}; }
+int32 UKDGBenchLib_070::Lib070_Fn096(UObject* In0, FName In1, FString& Out2, FVector& Out3, FString& Out4, int32 In5, UObject* In6) { return {}; }
+FVector UKDGBenchLib_070::Lib070_Fn097(const TArray< int32 >& In0, bool In1, FString& Out2, FString& Out3) { return {}; }
+float UKDGBenchLib_070::Lib070_Fn098(const TArray< int32 >& In0, FVector& Out1, int32 In2, int32 In3, FVector& Out4, const TArray< int32 >& In5) { return {}; }
+FString UKDGBenchLib_070::Lib070_Fn099(FString& Out0, const FVector& In1, const FTransform& In2, FVector& Out3, int32& Out4, float In5, const FString& In6, const FString& In7) { return {}; }
+
+FVector UKDGBenchLib_071::Lib071_Fn000(const FTransform& In0, UObject* In1, float In2, FVector& Out3, const FVector& In4, FName In5, FVector& Out6) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn001(const FString& In0, const FString& In1, float In2, float In3) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn002(FName In0, int32 In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, FString& Out5) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn003() {}
+bool UKDGBenchLib_071::Lib071_Fn004() { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn005(UObject* In0, FString& Out1, FString& Out2, const FTransform& In3, const FVector& In4, float In5, int32 In6) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn006(const FTransform& In0, FVector& Out1, FVector& Out2, FVector& Out3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn007(int32& Out0, UObject* In1, bool In2, UObject* In3, const FTransform& In4, const FString& In5) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn008() { return {}; }
+float UKDGBenchLib_071::Lib071_Fn009(UObject* In0, bool In1, const FTransform& In2, FString& Out3) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn010(const FTransform& In0, FName In1, FVector& Out2, const FTransform& In3, const FString& In4) {}
+FVector UKDGBenchLib_071::Lib071_Fn011(FVector& Out0, const FTransform& In1, const FTransform& In2, FName In3) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn012(int32 In0) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn013(int32 In0, FVector& Out1, FString& Out2, int32 In3, FVector& Out4, FString& Out5, FString& Out6, int32 In7) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn014(UObject* In0, bool In1, float In2, const FVector& In3, int32& Out4, FVector& Out5, FName In6) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn015(const TArray< int32 >& In0, int32& Out1, const FTransform& In2, const TArray< int32 >& In3) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn016(const FVector& In0, const FString& In1, int32& Out2, UObject* In3) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn017() { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn018(int32& Out0) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn019(bool In0, FVector& Out1, int32& Out2, const FTransform& In3, int32 In4, FName In5, const FVector& In6, UObject* In7) {}
+int32 UKDGBenchLib_071::Lib071_Fn020(const FVector& In0, int32 In1, const FString& In2) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn021(int32& Out0, const TArray< int32 >& In1, const FVector& In2) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn022(const TArray< int32 >& In0, int32 In1, int32 In2, const TArray< int32 >& In3, FVector& Out4, const TArray< int32 >& In5, float In6) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn023(FVector& Out0, FVector& Out1, const FVector& In2, bool In3) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn024(const FString& In0, const FVector& In1, const TArray< int32 >& In2) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn025(const FVector& In0, float In1, const FString& In2, const FTransform& In3, FVector& Out4, bool In5, bool In6, const FVector& In7) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn026(FVector& Out0, int32& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn027(const FString& In0, int32& Out1, FVector& Out2, const FTransform& In3, bool In4, float In5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn028(FVector& Out0, bool In1, const FTransform& In2, const FVector& In3, int32& Out4, FName In5) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn029() { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn030(FVector& Out0) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn031(FVector& Out0, const FVector& In1, const FTransform& In2, FVector& Out3, int32 In4, int32 In5) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn032(const FString& In0, const FString& In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn033() { return {}; }
+void UKDGBenchLib_071::Lib071_Fn034(const FTransform& In0, UObject* In1, FVector& Out2, const FVector& In3, FString& Out4, FVector& Out5) {}
+FString UKDGBenchLib_071::Lib071_Fn035(const FTransform& In0, UObject* In1, const FTransform& In2, FName In3, FName In4, int32& Out5, FName In6) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn036(const FString& In0, const FTransform& In1, float In2) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn037(int32 In0, FName In1, const FVector& In2) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn038(FString& Out0, float In1) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn039(int32& Out0) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn040(FName In0, UObject* In1, float In2, bool In3, FString& Out4, int32& Out5) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn041(const FTransform& In0, const FString& In1, const FString& In2, const TArray< int32 >& In3, int32 In4, bool In5) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn042(int32& Out0, int32 In1, UObject* In2, const FVector& In3, int32 In4, const TArray< int32 >& In5, FName In6) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn043(int32 In0, bool In1, FVector& Out2, int32 In3, FVector& Out4, const FString& In5) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn044(FName In0, UObject* In1, FString& Out2, const FTransform& In3, FName In4, const FTransform& In5) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn045(const FString& In0, float In1, const TArray< int32 >& In2, float In3, UObject* In4, int32 In5, const FString& In6, int32 In7) {}
+bool UKDGBenchLib_071::Lib071_Fn046(const FVector& In0, bool In1, int32& Out2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn047() { return {}; }
+void UKDGBenchLib_071::Lib071_Fn048(int32 In0) {}
+FString UKDGBenchLib_071::Lib071_Fn049(const FVector& In0, int32 In1, FVector& Out2, const FString& In3) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn050(FName In0, int32& Out1, const FString& In2, int32 In3, UObject* In4, int32 In5, UObject* In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn051(const TArray< int32 >& In0, const FString& In1, const TArray< int32 >& In2, float In3, const FTransform& In4, const FVector& In5) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn052(const FString& In0, UObject* In1) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn053(FString& Out0, FString& Out1) {}
+FString UKDGBenchLib_071::Lib071_Fn054(FString& Out0) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn055(FString& Out0, FName In1, float In2, FName In3) {}
+FString UKDGBenchLib_071::Lib071_Fn056(int32& Out0) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn057(const TArray< int32 >& In0, bool In1, const FString& In2, const FVector& In3, bool In4, int32& Out5, bool In6) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn058(FName In0, bool In1, const FVector& In2, int32& Out3) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn059(int32 In0, const FVector& In1, FString& Out2, FString& Out3, int32 In4, int32& Out5) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn060(const FVector& In0, bool In1, UObject* In2, int32& Out3) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn061(UObject* In0, int32& Out1, FString& Out2, const FString& In3, const FString& In4, FName In5, int32 In6) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn062(UObject* In0, const FString& In1, FString& Out2, FName In3) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn063(const TArray< int32 >& In0, FString& Out1, FVector& Out2, FString& Out3, const FString& In4, bool In5, UObject* In6) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn064(const FVector& In0, bool In1) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn065(FString& Out0, const FString& In1, FVector& Out2, const TArray< int32 >& In3, bool In4, int32 In5, const FVector& In6, const FString& In7) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn066(bool In0, bool In1, float In2, bool In3, FString& Out4, const FString& In5, bool In6) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, float In1, const FVector& In2, FString& Out3) {}
+void UKDGBenchLib_071::Lib071_Fn068(FVector& Out0, int32 In1, int32& Out2, const FTransform& In3, UObject* In4, bool In5, const FTransform& In6, const TArray< int32 >& In7) {}
+void UKDGBenchLib_071::Lib071_Fn069(const TArray< int32 >& In0, FString& Out1, UObject* In2, FString& Out3, bool In4, const TArray< int32 >& In5, const FString& In6) {}
+float UKDGBenchLib_071::Lib071_Fn070() { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn071(const FVector& In0, const FTransform& In1, const TArray< int32 >& In2) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn072(const TArray< int32 >& In0, const TArray< int32 >& In1, float In2, const FTransform& In3, UObject* In4, const FString& In5, float In6) {}
+void UKDGBenchLib_071::Lib071_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FName In1, FString& Out2) {}
+FString UKDGBenchLib_071::Lib071_Fn074(int32 In0, const FTransform& In1, int32& Out2, FVector& Out3, int32 In4, const TArray< int32 >& In5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn075(const FTransform& In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn076(FVector& Out0, FName In1, FName In2, float In3, const FString& In4) {}
+float UKDGBenchLib_071::Lib071_Fn077(int32 In0, UObject* In1, int32& Out2, const TArray< int32 >& In3, const FTransform& In4, const FString& In5, FVector& Out6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn078(FString& Out0, const FVector& In1) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn079(bool In0) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn080(float In0, bool In1, const TArray< int32 >& In2) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn081() { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn082(const TArray< int32 >& In0, FVector& Out1) { return {}; }
+int32 UKDGBenchLib_071::Lib071_Fn083(const FString& In0, int32& Out1) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn084(int32& Out0, const TArray< int32 >& In1, int32& Out2, FString& Out3, FName In4) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn085(float In0, const FTransform& In1, float In2, float In3) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn086(const FVector& In0, bool In1, float In2, int32& Out3, int32& Out4, int32 In5, bool In6, const FString& In7) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn087(int32& Out0, int32& Out1, FVector& Out2, const FVector& In3, FName In4, FString& Out5, int32& Out6, FString& Out7) {}
+void UKDGBenchLib_071::Lib071_Fn088(FName In0, const FString& In1, const FTransform& In2, FVector& Out3) {}
+float UKDGBenchLib_071::Lib071_Fn089(FVector& Out0, FName In1) { return {}; }
+bool UKDGBenchLib_071::Lib071_Fn090(const FTransform& In0, const FString& In1) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn091(const TArray< int32 >& In0, const FString& In1, int32 In2) { return {}; }
+FString UKDGBenchLib_071::Lib071_Fn092(float In0) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FName In1, float In2, const FVector& In3, int32& Out4, FVector& Out5) {}
+void UKDGBenchLib_071::Lib071_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FTransform& In1, const FTransform& In2, const FTransform& In3, bool In4, UObject* In5) {}
+FVector UKDGBenchLib_071::Lib071_Fn095(FVector& Out0, bool In1, bool In2, FVector& Out3, const FTransform& In4, const FVector& In5) { return {}; }
+void UKDGBenchLib_071::Lib071_Fn096(float In0, const FString& In1, FName In2, const FString& In3) {}
+int32 UKDGBenchLib_071::Lib071_Fn097(float In0, bool In1, FName In2, const FVector& In3, const FString& In4, float In5, const FVector& In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_071::Lib071_Fn098(float In0, int32& Out1, int32& Out2, UObject* In3) { return {}; }
+float UKDGBenchLib_071::Lib071_Fn099(UObject* In0, const FString& In1, const FString& In2, const FVector& In3) { return {}; }
+
+float UKDGBenchLib_072::Lib072_Fn000(UObject* In0, const FString& In1) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn001(FVector& Out0, int32 In1, const FVector& In2, FName In3) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn002(int32 In0, FString& Out1, FVector& Out2, UObject* In3, const FString& In4, bool In5, int32 In6, FVector& Out7) {}
+void UKDGBenchLib_072::Lib072_Fn003() {}
+bool UKDGBenchLib_072::Lib072_Fn004(const TArray< int32 >& In0, int32 In1, float In2, const FString& In3) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn005(const TArray< int32 >& In0, FString& Out1, const FString& In2, const FTransform& In3, bool In4, FString& Out5, const FString& In6, const TArray< int32 >& In7) {}
+int32 UKDGBenchLib_072::Lib072_Fn006(int32& Out0, bool In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const FVector& In4, const FString& In5, const TArray< int32 >& In6) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FVector& In1, UObject* In2, const FVector& In3, FString& Out4) {}
+FVector UKDGBenchLib_072::Lib072_Fn008(int32& Out0, int32 In1, FName In2, int32& Out3) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, float In1, int32 In2, FVector& Out3, const TArray< int32 >& In4, bool In5, UObject* In6, FVector& Out7) {}
+float UKDGBenchLib_072::Lib072_Fn010(const FString& In0, FName In1, const FTransform& In2) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn011(FName In0, const FVector& In1, int32& Out2, const TArray< int32 >& In3, const FString& In4, const FString& In5, float In6, FName In7) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const TArray< int32 >& In1, float In2, bool In3, const FVector& In4) {}
+int32 UKDGBenchLib_072::Lib072_Fn013(float In0, bool In1, const FTransform& In2, const FVector& In3, const FVector& In4, FName In5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn014(int32 In0, int32 In1, const TArray< int32 >& In2, UObject* In3, FName In4, int32 In5, const FString& In6) { return {}; }
+float UKDGBenchLib_072::Lib072_Fn015(UObject* In0, bool In1) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn016(FName In0, const FString& In1) {}
+void UKDGBenchLib_072::Lib072_Fn017(int32 In0, const FTransform& In1, const TArray< int32 >& In2, int32 In3, const FString& In4, FVector& Out5, const FVector& In6, int32& Out7) {}
+void UKDGBenchLib_072::Lib072_Fn018(FVector& Out0, UObject* In1, int32 In2, int32 In3, const FVector& In4, FVector& Out5, FName In6, const FString& In7) {}
+void UKDGBenchLib_072::Lib072_Fn019(const FTransform& In0, const TArray< int32 >& In1, float In2, bool In3, FName In4, float In5) {}
+float UKDGBenchLib_072::Lib072_Fn020(bool In0, const TArray< int32 >& In1, float In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn021(float In0, const FString& In1, float In2, FName In3, const TArray< int32 >& In4, FName In5, int32 In6, FName In7) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn022(UObject* In0, FString& Out1, FString& Out2, FString& Out3, int32& Out4, bool In5, FVector& Out6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn023(const FVector& In0, UObject* In1, float In2, const TArray< int32 >& In3, bool In4) {}
+int32 UKDGBenchLib_072::Lib072_Fn024(float In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn025(bool In0, FVector& Out1, const FTransform& In2, float In3, int32& Out4, const FTransform& In5, int32& Out6, const FString& In7) {}
+FVector UKDGBenchLib_072::Lib072_Fn026(int32 In0, int32 In1, FString& Out2, FString& Out3, int32 In4) { return {}; }
+float UKDGBenchLib_072::Lib072_Fn027(const FString& In0, FString& Out1, bool In2, const FString& In3, const FString& In4, const FVector& In5, const FVector& In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn028(FName In0, UObject* In1, int32& Out2, UObject* In3, int32& Out4, float In5, bool In6, float In7) { return {}; }
+FVector UKDGBenchLib_072::Lib072_Fn029(FName In0, bool In1, FName In2, const FVector& In3) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn030(FString& Out0, FVector& Out1, int32& Out2, int32& Out3, UObject* In4, int32 In5) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn031(bool In0, float In1, FName In2, const FString& In3, int32 In4, bool In5, FName In6) { return {}; }
+FVector UKDGBenchLib_072::Lib072_Fn032(bool In0, float In1, float In2, FName In3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn033(const FTransform& In0, float In1, float In2, bool In3, const TArray< int32 >& In4) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn034(const FString& In0, int32& Out1, const FVector& In2, FVector& Out3, FName In4) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn035(UObject* In0, float In1, int32 In2, FVector& Out3, int32& Out4, float In5, const FTransform& In6, FVector& Out7) { return {}; }
+float UKDGBenchLib_072::Lib072_Fn036(int32 In0) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn037(const FVector& In0, int32& Out1, const TArray< int32 >& In2, FName In3, const FString& In4, bool In5) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn038(FName In0, FVector& Out1, int32& Out2) {}
+int32 UKDGBenchLib_072::Lib072_Fn039(const FString& In0, const TArray< int32 >& In1, FVector& Out2, int32 In3, FString& Out4, int32& Out5, FName In6, const FTransform& In7) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn040(UObject* In0, FString& Out1, float In2, bool In3, FName In4, const FTransform& In5, const FString& In6, bool In7) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn041() {}
+float UKDGBenchLib_072::Lib072_Fn042() { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn043(FString& Out0, const FString& In1, int32& Out2, FVector& Out3, const FString& In4) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn044(UObject* In0, FVector& Out1, FString& Out2, FName In3, const FTransform& In4, int32& Out5, UObject* In6, const FVector& In7) {}
+int32 UKDGBenchLib_072::Lib072_Fn045(const TArray< int32 >& In0, FName In1) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn046(const FString& In0) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn047(int32& Out0, float In1, int32 In2, const FString& In3, FVector& Out4, const TArray< int32 >& In5, FVector& Out6, const FTransform& In7) {}
+bool UKDGBenchLib_072::Lib072_Fn048(const FString& In0, const FVector& In1, FString& Out2, float In3, const FString& In4, int32& Out5) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn049(UObject* In0, FString& Out1, FString& Out2, FVector& Out3, FString& Out4, FVector& Out5, int32& Out6) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn050() {}
+int32 UKDGBenchLib_072::Lib072_Fn051(FString& Out0, FString& Out1, int32 In2, FString& Out3, float In4) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn052(UObject* In0, const FString& In1) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn053(FName In0, float In1, const FString& In2, int32 In3) { return {}; }
+float UKDGBenchLib_072::Lib072_Fn054(FName In0, int32 In1, UObject* In2, int32 In3, const TArray< int32 >& In4, int32& Out5, FString& Out6) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn055(int32 In0, int32& Out1) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0) {}
+void UKDGBenchLib_072::Lib072_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const TArray< int32 >& In1, const FVector& In2, FName In3, UObject* In4, const FVector& In5, const FVector& In6, const FString& In7) {}
+FString UKDGBenchLib_072::Lib072_Fn058(FString& Out0) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn059(const TArray< int32 >& In0, bool In1, UObject* In2, bool In3, const FTransform& In4) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn060(const TArray< int32 >& In0, const FTransform& In1, const TArray< int32 >& In2, float In3) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, FString& Out2, UObject* In3, const FTransform& In4, int32& Out5, const FString& In6) {}
+int32 UKDGBenchLib_072::Lib072_Fn062(FVector& Out0, FName In1, const FVector& In2) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn063(bool In0, int32& Out1, int32& Out2, FString& Out3, float In4, int32 In5, FString& Out6) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn064(const FVector& In0, int32 In1, const FTransform& In2, FVector& Out3, float In4, const FString& In5, FVector& Out6, const FVector& In7) { return {}; }
+FVector UKDGBenchLib_072::Lib072_Fn065(int32& Out0, bool In1, const FString& In2, const FString& In3, FString& Out4, FName In5) { return {}; }
+float UKDGBenchLib_072::Lib072_Fn066(const TArray< int32 >& In0, int32& Out1, const FString& In2, UObject* In3, const TArray< int32 >& In4, int32 In5, int32& Out6) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn067(FString& Out0, FVector& Out1, FVector& Out2, UObject* In3, const FVector& In4, const FVector& In5, UObject* In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn068(const TArray< int32 >& In0, float In1, UObject* In2, FVector& Out3, UObject* In4, float In5) {}
+FVector UKDGBenchLib_072::Lib072_Fn069(const TArray< int32 >& In0, int32& Out1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn070(int32 In0, const FTransform& In1, float In2, const TArray< int32 >& In3, const FString& In4, UObject* In5, FString& Out6) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn071(FVector& Out0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn072(const FString& In0, const FTransform& In1, int32& Out2, const FVector& In3, UObject* In4, bool In5, int32 In6) { return {}; }
+FVector UKDGBenchLib_072::Lib072_Fn073(float In0) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn074() { return {}; }
+FVector UKDGBenchLib_072::Lib072_Fn075(const FTransform& In0, FString& Out1, const FVector& In2, const FString& In3, int32& Out4, const TArray< int32 >& In5, const FTransform& In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+float UKDGBenchLib_072::Lib072_Fn077(UObject* In0, const FString& In1, UObject* In2, int32 In3, bool In4, int32& Out5, FName In6) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn078(FString& Out0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, FName In4) { return {}; }
+FVector UKDGBenchLib_072::Lib072_Fn079(UObject* In0, const TArray< int32 >& In1, float In2, float In3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn080(FString& Out0, const FVector& In1, bool In2, int32 In3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn081(FName In0, const FString& In1) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FVector& Out1, int32& Out2, const FTransform& In3) {}
+float UKDGBenchLib_072::Lib072_Fn083(int32 In0, bool In1, FString& Out2, FString& Out3) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn084(FVector& Out0, const FTransform& In1, const FVector& In2, const FVector& In3, int32& Out4) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn085() { return {}; }
+FVector UKDGBenchLib_072::Lib072_Fn086(float In0) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn087(FVector& Out0, int32& Out1, float In2, int32& Out3) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn088(bool In0, const TArray< int32 >& In1, bool In2, UObject* In3, UObject* In4) { return {}; }
+bool UKDGBenchLib_072::Lib072_Fn089(const FVector& In0, int32& Out1) { return {}; }
+void UKDGBenchLib_072::Lib072_Fn090(const FVector& In0, int32 In1, float In2, const FString& In3) {}
+bool UKDGBenchLib_072::Lib072_Fn091(int32& Out0, int32 In1, const FVector& In2, const FString& In3, UObject* In4) { return {}; }
+float UKDGBenchLib_072::Lib072_Fn092() { return {}; }
+void UKDGBenchLib_072::Lib072_Fn093(FString& Out0, float In1, const FVector& In2, bool In3, FName In4) {}
+void UKDGBenchLib_072::Lib072_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, bool In1, int32 In2) {}
+void UKDGBenchLib_072::Lib072_Fn095(const FVector& In0, FName In1, int32 In2, int32 In3) {}
+void UKDGBenchLib_072::Lib072_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FVector UKDGBenchLib_072::Lib072_Fn097(FVector& Out0, FString& Out1, const FVector& In2, bool In3, const FTransform& In4) { return {}; }
+FString UKDGBenchLib_072::Lib072_Fn098(int32 In0, const FTransform& In1, const FTransform& In2, const FTransform& In3, FVector& Out4, const FTransform& In5, const FString& In6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_072::Lib072_Fn099(UObject* In0, FVector& Out1, float In2, int32 In3, const TArray< int32 >& In4) { return {}; }
+
+int32 UKDGBenchLib_073::Lib073_Fn000(FVector& Out0, FString& Out1, float In2, bool In3) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn001(int32& Out0, const TArray< int32 >& In1, FString& Out2, UObject* In3, const FTransform& In4) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FString UKDGBenchLib_073::Lib073_Fn003(FVector& Out0, const FString& In1, FVector& Out2, UObject* In3, int32& Out4, bool In5, int32 In6) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn004() { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn005(int32& Out0, FString& Out1, bool In2, float In3) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn006(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn007(FVector& Out0, FVector& Out1) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn008(const FString& In0, const FVector& In1, FString& Out2) {}
+bool UKDGBenchLib_073::Lib073_Fn009(const TArray< int32 >& In0, FString& Out1, const FVector& In2) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn010(int32& Out0, const FTransform& In1, UObject* In2, int32& Out3, const TArray< int32 >& In4, bool In5, bool In6) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, const FTransform& In2, const FTransform& In3, FName In4, FName In5) {}
+FVector UKDGBenchLib_073::Lib073_Fn012() { return {}; }
+float UKDGBenchLib_073::Lib073_Fn013(const FString& In0) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn014(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn015(const FTransform& In0, FString& Out1, UObject* In2) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn016(const FVector& In0, int32& Out1, FName In2, const FString& In3, FString& Out4, const FString& In5, FName In6) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FVector& Out1, int32 In2, float In3) {}
+FString UKDGBenchLib_073::Lib073_Fn018(const FTransform& In0, UObject* In1, const FString& In2, FVector& Out3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn019(UObject* In0, const FVector& In1, float In2, UObject* In3, const TArray< int32 >& In4, bool In5) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn020(FVector& Out0, FVector& Out1, UObject* In2) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, bool In1, FVector& Out2, int32& Out3, const FTransform& In4, const FString& In5, int32 In6, int32& Out7) {}
+bool UKDGBenchLib_073::Lib073_Fn022(FString& Out0, const FVector& In1, int32& Out2, int32 In3) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn023(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_073::Lib073_Fn024(UObject* In0, const FString& In1, const FTransform& In2, int32& Out3, const FTransform& In4, UObject* In5, FName In6) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn025(int32& Out0) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn026(float In0, FString& Out1, FName In2, float In3, const FString& In4, int32& Out5, FVector& Out6, FVector& Out7) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn027(UObject* In0, FName In1, const FTransform& In2, const FVector& In3, float In4) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn028() { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn029(UObject* In0) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn030(int32 In0, const FTransform& In1, float In2, bool In3, bool In4, const TArray< int32 >& In5, const FString& In6) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, int32 In1, int32 In2, const TArray< int32 >& In3, const FString& In4, float In5) {}
+float UKDGBenchLib_073::Lib073_Fn032(bool In0, const TArray< int32 >& In1, int32 In2, const TArray< int32 >& In3, FString& Out4, int32 In5) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn033(const FVector& In0) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn034(const TArray< int32 >& In0, float In1, const FVector& In2, UObject* In3, FVector& Out4, const FTransform& In5) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn035(int32& Out0, UObject* In1, FVector& Out2) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn036(UObject* In0, int32 In1) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn037(const TArray< int32 >& In0, const FString& In1, UObject* In2, UObject* In3, const TArray< int32 >& In4, int32& Out5, int32& Out6, bool In7) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn038(float In0, const FVector& In1, int32& Out2, FString& Out3, UObject* In4) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn039(const FVector& In0, const FTransform& In1, const FVector& In2, bool In3, const FTransform& In4) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn040(const TArray< int32 >& In0) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn041(int32& Out0, FString& Out1, bool In2, float In3) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0) {}
+void UKDGBenchLib_073::Lib073_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, UObject* In1, FString& Out2) {}
+FString UKDGBenchLib_073::Lib073_Fn044(FString& Out0, const FTransform& In1, const TArray< int32 >& In2, const TArray< int32 >& In3, UObject* In4, FVector& Out5, int32& Out6) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn045(FString& Out0, int32 In1, const FString& In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn046(bool In0, int32 In1) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn047(int32& Out0, int32 In1, float In2, const FString& In3, FString& Out4, float In5, const TArray< int32 >& In6) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn048(UObject* In0, FVector& Out1, UObject* In2, int32& Out3, FName In4, const FString& In5) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn049(const FTransform& In0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn050(FName In0) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn051(int32& Out0, float In1, FName In2) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn052(int32& Out0, const FVector& In1) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn053(FVector& Out0, UObject* In1, const FTransform& In2, const FTransform& In3, FName In4) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn054(const FVector& In0, int32& Out1, const FString& In2, FVector& Out3, const FTransform& In4, FVector& Out5, const TArray< int32 >& In6, const FTransform& In7) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn055(const TArray< int32 >& In0, const FVector& In1, FString& Out2, FVector& Out3, const FTransform& In4, const FVector& In5, int32 In6, const FTransform& In7) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn056(int32& Out0, float In1, FVector& Out2, const FTransform& In3, const FTransform& In4, FName In5) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn057(FVector& Out0, const FTransform& In1, int32& Out2, int32& Out3) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn058(int32& Out0) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn059(const FVector& In0) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn060() {}
+float UKDGBenchLib_073::Lib073_Fn061(UObject* In0, const FString& In1, FString& Out2, const FVector& In3) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn062(float In0, FString& Out1, FString& Out2, const FTransform& In3, const FTransform& In4, const FTransform& In5, FName In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn063(const FVector& In0, const FVector& In1, FVector& Out2, const FString& In3, int32& Out4, const FString& In5, int32 In6) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn064(FName In0, const FString& In1, UObject* In2, int32 In3, const FTransform& In4, float In5, const FTransform& In6) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn065(float In0, FVector& Out1, const FTransform& In2) {}
+float UKDGBenchLib_073::Lib073_Fn066(bool In0, int32& Out1, int32& Out2) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn067() { return {}; }
+float UKDGBenchLib_073::Lib073_Fn068(FString& Out0, int32& Out1, int32 In2, const FString& In3, int32& Out4, FVector& Out5) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn069(int32& Out0, const FVector& In1, const FVector& In2, float In3) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn070(UObject* In0, int32& Out1) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn071(int32 In0, UObject* In1, const FString& In2, const FString& In3, int32 In4, bool In5, FName In6, UObject* In7) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FString& Out1, UObject* In2, const FTransform& In3, const TArray< int32 >& In4, const FTransform& In5, const FString& In6, FVector& Out7) {}
+FVector UKDGBenchLib_073::Lib073_Fn073(FString& Out0, const FVector& In1, const FTransform& In2, FName In3) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn074(const TArray< int32 >& In0) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn075(FVector& Out0) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn076(FString& Out0, int32 In1, const FVector& In2, FString& Out3, const FString& In4, FName In5) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn077(UObject* In0, UObject* In1, const FTransform& In2, const FTransform& In3, const FVector& In4, UObject* In5, const TArray< int32 >& In6, const FTransform& In7) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn078(float In0, bool In1, FName In2, int32& Out3) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FVector& In1, FString& Out2, FString& Out3) {}
+void UKDGBenchLib_073::Lib073_Fn080(int32 In0, FString& Out1) {}
+void UKDGBenchLib_073::Lib073_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0) {}
+bool UKDGBenchLib_073::Lib073_Fn082(bool In0, UObject* In1, const TArray< int32 >& In2, const FString& In3, bool In4, bool In5, int32 In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn083(FVector& Out0, bool In1, const FVector& In2, FName In3, float In4, int32 In5, const FTransform& In6) {}
+void UKDGBenchLib_073::Lib073_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, const FVector& In2) {}
+int32 UKDGBenchLib_073::Lib073_Fn085(FVector& Out0, UObject* In1, FName In2, const FVector& In3, const FTransform& In4) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn086(int32& Out0) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn087(const TArray< int32 >& In0, FVector& Out1, FString& Out2, float In3, const FTransform& In4, bool In5, FVector& Out6) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn088(int32& Out0, const FTransform& In1, int32 In2, int32& Out3, const FTransform& In4, UObject* In5, bool In6, int32 In7) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn089() { return {}; }
+void UKDGBenchLib_073::Lib073_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FTransform& In1, const FTransform& In2, float In3, int32 In4) {}
+int32 UKDGBenchLib_073::Lib073_Fn091(FName In0, const FString& In1) { return {}; }
+FString UKDGBenchLib_073::Lib073_Fn092(float In0, bool In1, float In2, int32& Out3, const FString& In4, const FTransform& In5) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn093(FString& Out0, UObject* In1, const FString& In2, float In3, int32 In4) {}
+FString UKDGBenchLib_073::Lib073_Fn094(int32& Out0, float In1, const FString& In2, int32 In3) { return {}; }
+bool UKDGBenchLib_073::Lib073_Fn095(int32& Out0, int32 In1) { return {}; }
+float UKDGBenchLib_073::Lib073_Fn096(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_073::Lib073_Fn097(const FString& In0, const TArray< int32 >& In1) { return {}; }
+FVector UKDGBenchLib_073::Lib073_Fn098(const FTransform& In0, const FVector& In1, bool In2, int32 In3, int32& Out4) { return {}; }
+void UKDGBenchLib_073::Lib073_Fn099(float In0) {}
+
+float UKDGBenchLib_074::Lib074_Fn000(UObject* In0) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0) {}
+FVector UKDGBenchLib_074::Lib074_Fn002(float In0, int32 In1, const FTransform& In2, const FVector& In3, bool In4, const FString& In5, UObject* In6) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn003() { return {}; }
+void UKDGBenchLib_074::Lib074_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1) {}
+int32 UKDGBenchLib_074::Lib074_Fn005(int32& Out0, bool In1, int32 In2, int32 In3, FString& Out4, int32 In5, const FTransform& In6, bool In7) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn006(int32 In0, const FTransform& In1, const FTransform& In2, float In3) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn007() { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn008(FName In0, FVector& Out1, FString& Out2, FName In3) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn009(const FVector& In0, const FString& In1, const FTransform& In2, int32 In3, const TArray< int32 >& In4, float In5, const FString& In6) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn010() { return {}; }
+float UKDGBenchLib_074::Lib074_Fn011(const FVector& In0, const FTransform& In1, FString& Out2, const TArray< int32 >& In3, float In4) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn012(float In0, int32 In1, FVector& Out2) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn013() { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn014(FVector& Out0, UObject* In1, const FString& In2) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn015(FString& Out0, FString& Out1) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn016() { return {}; }
+void UKDGBenchLib_074::Lib074_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, int32 In1) {}
+FVector UKDGBenchLib_074::Lib074_Fn018(FString& Out0, FName In1, FString& Out2, FString& Out3, float In4, const TArray< int32 >& In5) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn019(const FTransform& In0, const TArray< int32 >& In1, UObject* In2, UObject* In3, const TArray< int32 >& In4, const TArray< int32 >& In5, FVector& Out6, FString& Out7) {}
+void UKDGBenchLib_074::Lib074_Fn020(const FTransform& In0, const FString& In1) {}
+bool UKDGBenchLib_074::Lib074_Fn021(FString& Out0, float In1, int32& Out2, FName In3, UObject* In4, const FTransform& In5, const FTransform& In6) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn022(int32& Out0, const FTransform& In1, FString& Out2, FName In3, UObject* In4) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn023() { return {}; }
+void UKDGBenchLib_074::Lib074_Fn024() {}
+float UKDGBenchLib_074::Lib074_Fn025(FName In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3, float In4) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn026() { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn027(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn028() { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn029(FVector& Out0, const FString& In1) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn030(const FVector& In0, const FVector& In1, const FString& In2, int32 In3, FName In4, FName In5) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn031(const FVector& In0, const FString& In1, int32& Out2) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn032(const FTransform& In0) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn033(float In0, bool In1, UObject* In2, UObject* In3, FName In4) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn034(bool In0, FName In1, FName In2, bool In3) {}
+FString UKDGBenchLib_074::Lib074_Fn035(FName In0, FString& Out1, const TArray< int32 >& In2, bool In3, int32 In4, FString& Out5) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn036(UObject* In0, const FString& In1, FString& Out2, bool In3, const FTransform& In4, FVector& Out5, const FVector& In6) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn037(bool In0, FName In1, float In2, int32 In3, const TArray< int32 >& In4, FName In5, float In6, const FVector& In7) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn038(const TArray< int32 >& In0, int32 In1, int32& Out2, UObject* In3, FString& Out4, FName In5, bool In6, const FString& In7) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn039(int32& Out0, const TArray< int32 >& In1, const FTransform& In2) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0) {}
+void UKDGBenchLib_074::Lib074_Fn041(const FVector& In0, FName In1, UObject* In2, const TArray< int32 >& In3, float In4, int32& Out5) {}
+bool UKDGBenchLib_074::Lib074_Fn042() { return {}; }
+void UKDGBenchLib_074::Lib074_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FTransform& In1, FName In2, FString& Out3) {}
+FVector UKDGBenchLib_074::Lib074_Fn044() { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn045(const FTransform& In0, FVector& Out1, FVector& Out2, FString& Out3, FName In4) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn046(FVector& Out0, UObject* In1) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn047(const FVector& In0, UObject* In1, FName In2) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn048(UObject* In0, float In1) {}
+bool UKDGBenchLib_074::Lib074_Fn049() { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn050(int32 In0, const FVector& In1, int32 In2) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn051(FString& Out0, int32& Out1) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn052(int32 In0) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn053(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn054() { return {}; }
+float UKDGBenchLib_074::Lib074_Fn055(float In0, float In1, float In2, FName In3, int32& Out4) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn056(FVector& Out0, bool In1, int32& Out2, bool In3) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn057(FString& Out0, const FTransform& In1, FName In2, UObject* In3) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn058(bool In0, UObject* In1) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn059(UObject* In0, FVector& Out1, UObject* In2, int32 In3, int32& Out4) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn060(const FVector& In0, const TArray< int32 >& In1, int32& Out2) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FString& Out1, const FString& In2, int32 In3) {}
+float UKDGBenchLib_074::Lib074_Fn062(const FTransform& In0, float In1) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn063(int32& Out0, bool In1) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn064(bool In0, int32 In1, int32 In2) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn065(bool In0, FVector& Out1, const FVector& In2) { return {}; }
+bool UKDGBenchLib_074::Lib074_Fn066(FVector& Out0, const FVector& In1, FName In2) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn067(const FVector& In0, const TArray< int32 >& In1, bool In2, const FString& In3, float In4) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn068(FVector& Out0, FString& Out1, FString& Out2, float In3, const FVector& In4, FName In5) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn069(int32& Out0, const FString& In1, FName In2, const FVector& In3, int32 In4, FName In5, FString& Out6) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn070(float In0, int32& Out1, const FString& In2, FVector& Out3, float In4, FName In5) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn071(bool In0) {}
+float UKDGBenchLib_074::Lib074_Fn072(UObject* In0, int32 In1, bool In2, FName In3, int32 In4, int32& Out5) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn073() { return {}; }
+void UKDGBenchLib_074::Lib074_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, float In1, FName In2, bool In3) {}
+FString UKDGBenchLib_074::Lib074_Fn075(float In0, FVector& Out1, int32& Out2, FString& Out3, float In4, bool In5, const FVector& In6, int32& Out7) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn076(UObject* In0, FName In1, UObject* In2, float In3, FVector& Out4, FVector& Out5) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, float In2, bool In3, const FVector& In4) {}
+FString UKDGBenchLib_074::Lib074_Fn078() { return {}; }
+float UKDGBenchLib_074::Lib074_Fn079(const FVector& In0, bool In1, UObject* In2, const FVector& In3, bool In4, int32 In5, int32& Out6) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn080() { return {}; }
+void UKDGBenchLib_074::Lib074_Fn081() {}
+int32 UKDGBenchLib_074::Lib074_Fn082(int32 In0, FVector& Out1, bool In2, const FTransform& In3, bool In4, const FString& In5, FName In6) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn083(UObject* In0, bool In1, FVector& Out2) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1, int32& Out2, UObject* In3) {}
+float UKDGBenchLib_074::Lib074_Fn085(bool In0, const FVector& In1, int32& Out2, const TArray< int32 >& In3, float In4, int32& Out5, const FString& In6) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn086(const FVector& In0, int32 In1, float In2, const FString& In3, FVector& Out4, const FTransform& In5, float In6, const FString& In7) {}
+FVector UKDGBenchLib_074::Lib074_Fn087(FString& Out0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn088(const FTransform& In0, float In1, const FVector& In2) {}
+int32 UKDGBenchLib_074::Lib074_Fn089(const FVector& In0, const FVector& In1, float In2, FName In3, int32 In4) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn090(UObject* In0, int32& Out1, int32& Out2) { return {}; }
+FString UKDGBenchLib_074::Lib074_Fn091(FName In0, FString& Out1) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FVector& In1, const FTransform& In2, const FTransform& In3, const FString& In4) {}
+FVector UKDGBenchLib_074::Lib074_Fn093(FName In0, const FVector& In1) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn094(float In0, const FString& In1, int32 In2, FName In3, const FVector& In4, FString& Out5, const FVector& In6) { return {}; }
+float UKDGBenchLib_074::Lib074_Fn095(float In0, FString& Out1, int32 In2, const FVector& In3, float In4, const FVector& In5, float In6) { return {}; }
+int32 UKDGBenchLib_074::Lib074_Fn096(const FTransform& In0) { return {}; }
+FVector UKDGBenchLib_074::Lib074_Fn097(const TArray< int32 >& In0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3) { return {}; }
+void UKDGBenchLib_074::Lib074_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, FVector& Out2, const TArray< int32 >& In3, int32& Out4, UObject* In5, const FVector& In6, const FTransform& In7) {}
+int32 UKDGBenchLib_074::Lib074_Fn099(const TArray< int32 >& In0) { return {}; }
+
+void UKDGBenchLib_075::Lib075_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FVector& In1, FName In2, bool In3, FVector& Out4, FVector& Out5, UObject* In6) {}
+float UKDGBenchLib_075::Lib075_Fn001(const TArray< int32 >& In0, int32& Out1, float In2, FString& Out3, int32& Out4, const FTransform& In5, float In6) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn002(FName In0, const FVector& In1, const TArray< int32 >& In2, UObject* In3, const FTransform& In4, UObject* In5) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn003(const FString& In0, const FVector& In1, FString& Out2, const TArray< int32 >& In3, float In4, FVector& Out5, const FTransform& In6, const FVector& In7) {}
+void UKDGBenchLib_075::Lib075_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FString UKDGBenchLib_075::Lib075_Fn005(float In0, int32 In1) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn006(UObject* In0) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn007(UObject* In0, const FString& In1, FVector& Out2, FString& Out3) {}
+FVector UKDGBenchLib_075::Lib075_Fn008(FVector& Out0, UObject* In1, int32& Out2, const FString& In3, FName In4, int32& Out5, const FVector& In6) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn009(float In0, UObject* In1, float In2, int32& Out3, const FVector& In4, FString& Out5) {}
+void UKDGBenchLib_075::Lib075_Fn010(const FTransform& In0, FName In1, FName In2, const TArray< int32 >& In3, int32& Out4, FName In5, FName In6) {}
+void UKDGBenchLib_075::Lib075_Fn011(int32& Out0, int32& Out1, FName In2) {}
+FVector UKDGBenchLib_075::Lib075_Fn012(FVector& Out0, float In1, int32& Out2, const FString& In3) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn013(const FVector& In0, const TArray< int32 >& In1, float In2) {}
+bool UKDGBenchLib_075::Lib075_Fn014() { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn015(int32 In0, UObject* In1, FString& Out2, FString& Out3, float In4) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn016() { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn017(float In0, FName In1, const FTransform& In2, const FTransform& In3, const FString& In4, const FTransform& In5) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn018(float In0, FString& Out1) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn019(bool In0) { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn020(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn021(const FTransform& In0, int32& Out1, FVector& Out2, float In3, int32 In4, int32 In5, float In6, const FVector& In7) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn022(const FTransform& In0, FVector& Out1, const TArray< int32 >& In2, UObject* In3, UObject* In4, const TArray< int32 >& In5, FName In6, FVector& Out7) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn023(const FString& In0, FName In1) {}
+FVector UKDGBenchLib_075::Lib075_Fn024(FString& Out0, UObject* In1, FString& Out2) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn025(int32 In0) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn026() { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn027(FVector& Out0, UObject* In1, int32& Out2) { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn028(const TArray< int32 >& In0) { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn029(float In0, float In1, int32 In2, int32& Out3, const FTransform& In4, FName In5) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn030() {}
+int32 UKDGBenchLib_075::Lib075_Fn031(UObject* In0, int32 In1, int32 In2, int32 In3, const FString& In4) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn032(int32 In0, const FVector& In1, FName In2, bool In3) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn033(float In0) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, bool In1, const TArray< int32 >& In2, const FTransform& In3, int32& Out4, FVector& Out5, bool In6, UObject* In7) {}
+FVector UKDGBenchLib_075::Lib075_Fn035(UObject* In0, int32& Out1, float In2) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FVector& In1, const FString& In2, const FVector& In3) {}
+float UKDGBenchLib_075::Lib075_Fn037(bool In0, float In1, const FString& In2, const FVector& In3, const FTransform& In4, UObject* In5, FVector& Out6) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn038(FVector& Out0, FVector& Out1, int32 In2, const FTransform& In3, const FTransform& In4, const FString& In5) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn039(FVector& Out0, FVector& Out1, UObject* In2, FString& Out3, int32 In4) { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn040() { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn041(FVector& Out0, const TArray< int32 >& In1, bool In2, const FVector& In3, int32 In4, bool In5, const FTransform& In6, FString& Out7) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn042(int32& Out0, const TArray< int32 >& In1, FName In2, bool In3, UObject* In4) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn043(FName In0, const FString& In1, const FString& In2, float In3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn044(const FTransform& In0) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn045(bool In0, const FTransform& In1, const FTransform& In2, const FTransform& In3, float In4, UObject* In5) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn046(FString& Out0, FName In1, const FVector& In2, const FString& In3, bool In4, FName In5) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn047(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FVector& Out1) {}
+FString UKDGBenchLib_075::Lib075_Fn048(int32& Out0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn049(const FVector& In0, FName In1, const FVector& In2, FName In3) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn050(const TArray< int32 >& In0, int32 In1, FName In2, const FVector& In3, int32& Out4) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn051(FString& Out0) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn052(const FString& In0, FString& Out1, bool In2, const FVector& In3, int32& Out4, const TArray< int32 >& In5, FVector& Out6) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn053(const FTransform& In0, const FVector& In1, const FVector& In2, FName In3, FString& Out4) { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn054(bool In0, const FString& In1, FName In2, FString& Out3) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn055(UObject* In0, const FString& In1, UObject* In2, UObject* In3, const FVector& In4, bool In5, const FString& In6) {}
+int32 UKDGBenchLib_075::Lib075_Fn056(FString& Out0, FName In1, UObject* In2, const FVector& In3, const FString& In4, int32& Out5, FName In6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn057(UObject* In0, int32& Out1, FVector& Out2, const FString& In3, UObject* In4, int32 In5, float In6, int32 In7) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn058(FName In0, UObject* In1, float In2, FName In3, bool In4, int32 In5, FVector& Out6) {}
+FString UKDGBenchLib_075::Lib075_Fn059(const FString& In0, FString& Out1, const FString& In2, FString& Out3) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn060(FVector& Out0, const FTransform& In1) { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn061(bool In0, bool In1, const FVector& In2, int32& Out3, int32& Out4, int32 In5) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn062(const FVector& In0, bool In1, FString& Out2, FVector& Out3) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn063(FName In0, float In1, int32& Out2, FName In3, bool In4, float In5) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn064(const FString& In0, float In1, const FVector& In2, const FVector& In3, const TArray< int32 >& In4, const FVector& In5, bool In6) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn065(float In0, const FString& In1, FVector& Out2, const FTransform& In3, float In4) {}
+int32 UKDGBenchLib_075::Lib075_Fn066(const TArray< int32 >& In0, int32 In1, FVector& Out2, bool In3, const FVector& In4, FString& Out5, FName In6) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn067(const FVector& In0, const TArray< int32 >& In1, bool In2, FString& Out3, int32 In4) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn068(const FVector& In0) {}
+int32 UKDGBenchLib_075::Lib075_Fn069() { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn070(float In0, float In1, FString& Out2) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn071(FName In0, FVector& Out1) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn072(FString& Out0, float In1, bool In2) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn073(float In0, const FString& In1, int32& Out2, const FTransform& In3, FString& Out4) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn074(float In0, const FTransform& In1, const TArray< int32 >& In2, FString& Out3) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn075(FName In0, FVector& Out1, const FString& In2) {}
+bool UKDGBenchLib_075::Lib075_Fn076(FVector& Out0, float In1, bool In2, int32& Out3) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn077(const FVector& In0, const FTransform& In1, const FString& In2, int32 In3, const FTransform& In4) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn078(const FTransform& In0, bool In1, bool In2, float In3, bool In4, int32 In5, UObject* In6) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FTransform& In1, const FString& In2, int32& Out3, const FTransform& In4) {}
+FString UKDGBenchLib_075::Lib075_Fn080() { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn081(bool In0, const FString& In1, FVector& Out2) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn082(bool In0, const TArray< int32 >& In1, const FTransform& In2, int32& Out3, const TArray< int32 >& In4, FName In5) {}
+int32 UKDGBenchLib_075::Lib075_Fn083(const FTransform& In0, const FTransform& In1, float In2, int32& Out3, UObject* In4, FString& Out5) { return {}; }
+FString UKDGBenchLib_075::Lib075_Fn084(FVector& Out0, FName In1, const TArray< int32 >& In2, bool In3, const FVector& In4, int32 In5, int32& Out6, FString& Out7) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn085() { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn086(FString& Out0, const FTransform& In1, int32& Out2, const FString& In3, bool In4, float In5) { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn087(UObject* In0, bool In1, const FVector& In2) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn088(UObject* In0) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn089(const FTransform& In0, UObject* In1, const TArray< int32 >& In2) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn090(const FTransform& In0, UObject* In1, bool In2, FVector& Out3, int32& Out4, int32 In5) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn091(FString& Out0, const FTransform& In1, int32& Out2, const FVector& In3) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn092(int32 In0) { return {}; }
+void UKDGBenchLib_075::Lib075_Fn093() {}
+bool UKDGBenchLib_075::Lib075_Fn094(int32& Out0, UObject* In1, const TArray< int32 >& In2, float In3, FVector& Out4, const FString& In5, const FString& In6, FString& Out7) { return {}; }
+bool UKDGBenchLib_075::Lib075_Fn095(const TArray< int32 >& In0, const FVector& In1, int32 In2, FVector& Out3, const FString& In4) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn096() { return {}; }
+FVector UKDGBenchLib_075::Lib075_Fn097(const FTransform& In0) { return {}; }
+float UKDGBenchLib_075::Lib075_Fn098(const TArray< int32 >& In0, UObject* In1, const FString& In2, const FVector& In3, int32 In4) { return {}; }
+int32 UKDGBenchLib_075::Lib075_Fn099(FString& Out0, const FVector& In1, const FVector& In2) { return {}; }
+
+bool UKDGBenchLib_076::Lib076_Fn000(UObject* In0, FString& Out1, const FString& In2) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn001(UObject* In0, FString& Out1, const FVector& In2, FName In3, FString& Out4, bool In5, int32& Out6, FString& Out7) {}
+int32 UKDGBenchLib_076::Lib076_Fn002(FName In0, int32& Out1, int32& Out2, FString& Out3, const TArray< int32 >& In4, FString& Out5, const TArray< int32 >& In6) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn003(FName In0, const FTransform& In1) {}
+FString UKDGBenchLib_076::Lib076_Fn004(bool In0) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn005(const FTransform& In0, const TArray< int32 >& In1, const FVector& In2, int32& Out3, const TArray< int32 >& In4, const TArray< int32 >& In5) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn006() { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn007(const FVector& In0, FVector& Out1, FName In2, const FTransform& In3) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn008(int32 In0, int32& Out1, FString& Out2, UObject* In3, int32& Out4, FName In5) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn009(FName In0, FVector& Out1, const TArray< int32 >& In2, int32 In3, FVector& Out4, const TArray< int32 >& In5, int32 In6) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn010(const TArray< int32 >& In0, UObject* In1, const FString& In2, int32 In3, const TArray< int32 >& In4, FVector& Out5, const FVector& In6, UObject* In7) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FString UKDGBenchLib_076::Lib076_Fn012(int32& Out0, float In1, int32& Out2, FName In3, const FString& In4, FString& Out5, bool In6) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn013(const TArray< int32 >& In0, FVector& Out1, int32& Out2, int32 In3, const TArray< int32 >& In4, FName In5, FName In6, bool In7) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn014(UObject* In0) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_076::Lib076_Fn016(float In0, bool In1) {}
+FString UKDGBenchLib_076::Lib076_Fn017(bool In0, const FTransform& In1, FName In2, FName In3, const TArray< int32 >& In4) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn018(const FTransform& In0, int32 In1, const FTransform& In2, FName In3) {}
+int32 UKDGBenchLib_076::Lib076_Fn019(bool In0, FVector& Out1, const FVector& In2, UObject* In3, const FString& In4, float In5, UObject* In6, int32 In7) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn020(bool In0, UObject* In1, FName In2) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn021(FName In0, UObject* In1, float In2, FName In3, bool In4, const FString& In5, FString& Out6, bool In7) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn022(int32 In0, FName In1, UObject* In2, const FVector& In3, bool In4, int32 In5, int32 In6, FVector& Out7) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn023(int32& Out0, int32 In1) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn024(const FString& In0, bool In1, FName In2, const FTransform& In3, int32 In4) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn025() { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn026(bool In0) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn027(int32& Out0, const TArray< int32 >& In1, bool In2, const FVector& In3, FString& Out4, const FTransform& In5, UObject* In6, FName In7) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn028(const FTransform& In0, UObject* In1) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn029(int32& Out0, const TArray< int32 >& In1, UObject* In2, const FTransform& In3, float In4, FVector& Out5, FName In6) {}
+FString UKDGBenchLib_076::Lib076_Fn030(UObject* In0, int32 In1, const FString& In2) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn031(bool In0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, FVector& Out4, FName In5, FName In6, FName In7) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn032(const FString& In0) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn033(FString& Out0, FString& Out1, const FTransform& In2, int32 In3, FVector& Out4) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn034(const TArray< int32 >& In0, const TArray< int32 >& In1, FVector& Out2, bool In3, const FVector& In4, bool In5, FVector& Out6) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn035() { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn036(FVector& Out0, const TArray< int32 >& In1, FName In2, int32& Out3, FString& Out4, const FTransform& In5, FString& Out6, int32 In7) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn037(FString& Out0, FVector& Out1, const FVector& In2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn038(const TArray< int32 >& In0) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn039(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FVector& Out1, float In2, int32& Out3, const FTransform& In4, FVector& Out5) {}
+bool UKDGBenchLib_076::Lib076_Fn040(int32 In0, const FTransform& In1) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn041(FVector& Out0, FName In1, int32 In2, const FString& In3, FVector& Out4, bool In5, FString& Out6) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn042(float In0) { return {}; }
+float UKDGBenchLib_076::Lib076_Fn043(FVector& Out0, FName In1, FName In2, const FVector& In3, FName In4) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn044(FString& Out0, bool In1, int32 In2) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn045(int32& Out0, bool In1, const FTransform& In2, bool In3, FString& Out4, FString& Out5) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn046(float In0, FVector& Out1, const TArray< int32 >& In2, float In3, bool In4, int32 In5) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn047(const FVector& In0, const TArray< int32 >& In1, int32 In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn048(int32& Out0, UObject* In1) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn049(FVector& Out0, FVector& Out1, UObject* In2, FString& Out3, FString& Out4, float In5, FString& Out6) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn050(UObject* In0, bool In1, const TArray< int32 >& In2, bool In3) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn051(FVector& Out0, const FString& In1, const TArray< int32 >& In2) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn052(int32 In0, FString& Out1, FName In2, const FString& In3, const FString& In4, const FString& In5, UObject* In6) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn053(UObject* In0, float In1, UObject* In2, float In3) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn054(const FVector& In0, FVector& Out1, int32& Out2, float In3, const FVector& In4) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn055(const FString& In0, const FVector& In1, const TArray< int32 >& In2, FString& Out3, float In4) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn056(int32 In0, FString& Out1, bool In2, const FVector& In3, UObject* In4) {}
+FString UKDGBenchLib_076::Lib076_Fn057(UObject* In0, FName In1, int32 In2, int32& Out3, float In4, int32& Out5) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn058(UObject* In0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn059(const TArray< int32 >& In0, UObject* In1) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn060(float In0, FVector& Out1) {}
+float UKDGBenchLib_076::Lib076_Fn061(const FTransform& In0, int32& Out1, FVector& Out2, float In3, FName In4) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn062(int32& Out0, const FString& In1) { return {}; }
+float UKDGBenchLib_076::Lib076_Fn063(int32 In0, const FTransform& In1, int32 In2, FVector& Out3, const TArray< int32 >& In4, int32 In5, const FTransform& In6) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn064(const FVector& In0, float In1, FString& Out2, int32 In3, const FVector& In4) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn065(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, int32 In1, int32 In2, FName In3, int32& Out4, int32& Out5, const FTransform& In6, FVector& Out7) {}
+void UKDGBenchLib_076::Lib076_Fn066(float In0, const FVector& In1, float In2, int32& Out3, FString& Out4) {}
+FVector UKDGBenchLib_076::Lib076_Fn067(float In0) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn068(bool In0, const FTransform& In1, const FTransform& In2, UObject* In3, const FVector& In4) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, int32 In5, FVector& Out6) {}
+bool UKDGBenchLib_076::Lib076_Fn070(float In0, const TArray< int32 >& In1, bool In2, bool In3, float In4, const FVector& In5, const TArray< int32 >& In6) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn071() { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn072(const FString& In0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn073(float In0, FVector& Out1, bool In2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn074(UObject* In0, int32& Out1, FName In2, const FTransform& In3, int32 In4, FVector& Out5, const FVector& In6) { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn075(float In0, int32& Out1, FName In2, FName In3, FString& Out4) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn076(FVector& Out0) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn077(const FVector& In0, const FString& In1) { return {}; }
+float UKDGBenchLib_076::Lib076_Fn078(const TArray< int32 >& In0, const FTransform& In1, int32& Out2) { return {}; }
+float UKDGBenchLib_076::Lib076_Fn079(int32 In0, FString& Out1, const FTransform& In2) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn080(FString& Out0, UObject* In1, const FVector& In2) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn081(float In0, const FTransform& In1, int32 In2) { return {}; }
+float UKDGBenchLib_076::Lib076_Fn082(const TArray< int32 >& In0, int32& Out1, bool In2, int32 In3, const FString& In4, float In5, int32 In6) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn083(float In0, FVector& Out1, const TArray< int32 >& In2, FVector& Out3, int32& Out4, const TArray< int32 >& In5) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn084(const FString& In0, FVector& Out1, const FTransform& In2, FString& Out3, bool In4, const FTransform& In5, FVector& Out6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn085(FVector& Out0) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn086(UObject* In0, const FString& In1) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn087(const FTransform& In0, UObject* In1, int32& Out2, UObject* In3, const TArray< int32 >& In4) { return {}; }
+FVector UKDGBenchLib_076::Lib076_Fn088(float In0, const FVector& In1, float In2, FVector& Out3, int32& Out4, const TArray< int32 >& In5) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn089(UObject* In0, const FTransform& In1, const FTransform& In2, float In3, int32 In4, FString& Out5, const FTransform& In6, int32& Out7) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn090() { return {}; }
+FString UKDGBenchLib_076::Lib076_Fn091(float In0, int32& Out1, FVector& Out2, bool In3) { return {}; }
+bool UKDGBenchLib_076::Lib076_Fn092(int32& Out0, const FVector& In1, FString& Out2, int32 In3, FName In4) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1, FString& Out2, bool In3, UObject* In4) {}
+void UKDGBenchLib_076::Lib076_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0) {}
+float UKDGBenchLib_076::Lib076_Fn095(int32 In0, FString& Out1, const FTransform& In2, FName In3, const FString& In4, const TArray< int32 >& In5) { return {}; }
+float UKDGBenchLib_076::Lib076_Fn096(const FString& In0, FVector& Out1, FString& Out2, FString& Out3, FString& Out4, UObject* In5, bool In6, FString& Out7) { return {}; }
+void UKDGBenchLib_076::Lib076_Fn097(FVector& Out0, bool In1, FVector& Out2, float In3, const FString& In4, FString& Out5, float In6) {}
+float UKDGBenchLib_076::Lib076_Fn098(float In0, FVector& Out1, UObject* In2, bool In3, const FTransform& In4, float In5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_076::Lib076_Fn099(const FVector& In0) { return {}; }
+
+int32 UKDGBenchLib_077::Lib077_Fn000(const FTransform& In0, FVector& Out1, FString& Out2, int32& Out3, bool In4, FString& Out5) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn001(const TArray< int32 >& In0, bool In1, float In2) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn002(FVector& Out0, const FVector& In1, const FString& In2, const FVector& In3, FString& Out4) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn003(bool In0) {}
+void UKDGBenchLib_077::Lib077_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32& Out1, const FTransform& In2) {}
+bool UKDGBenchLib_077::Lib077_Fn005(FVector& Out0, float In1, const FTransform& In2, FString& Out3, const TArray< int32 >& In4, float In5, int32 In6) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn006(const FVector& In0, UObject* In1, int32 In2, int32& Out3, FVector& Out4) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn007(UObject* In0) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn008(int32 In0, FVector& Out1, int32& Out2) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn009(const TArray< int32 >& In0, const FVector& In1, const FVector& In2, FString& Out3, const FVector& In4) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn010(FName In0) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn011(FString& Out0, int32& Out1, const TArray< int32 >& In2, UObject* In3, int32& Out4) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn012(const FVector& In0, int32& Out1, const FString& In2, int32 In3, int32& Out4) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn013(int32& Out0, const FTransform& In1, const FTransform& In2, const FTransform& In3, FName In4) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn014(float In0, float In1, float In2, UObject* In3, UObject* In4, FName In5, const FVector& In6, UObject* In7) { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn015(float In0, const FTransform& In1, FString& Out2) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn016(UObject* In0, const FTransform& In1, FName In2, const TArray< int32 >& In3, FString& Out4, FString& Out5, float In6, UObject* In7) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn017() { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn018() { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn019(FString& Out0, FVector& Out1, int32 In2, const FVector& In3, UObject* In4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn020(bool In0, bool In1, UObject* In2, UObject* In3, UObject* In4, UObject* In5) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn021(const TArray< int32 >& In0, float In1, int32 In2) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn022(const FTransform& In0, int32 In1, int32& Out2, FVector& Out3, UObject* In4, int32 In5, const FVector& In6, int32& Out7) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn023(const FVector& In0, const FString& In1, FVector& Out2, int32& Out3, int32& Out4) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn024(const FString& In0, const TArray< int32 >& In1, int32& Out2) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn025(int32 In0, const FTransform& In1) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn026(FVector& Out0, int32& Out1, UObject* In2, FString& Out3) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn027() {}
+int32 UKDGBenchLib_077::Lib077_Fn028() { return {}; }
+void UKDGBenchLib_077::Lib077_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FVector& In1, const TArray< int32 >& In2, FString& Out3, FString& Out4) {}
+void UKDGBenchLib_077::Lib077_Fn030(int32 In0, const FString& In1, int32 In2, FName In3, const FString& In4, float In5, bool In6) {}
+bool UKDGBenchLib_077::Lib077_Fn031(int32 In0, int32& Out1, int32 In2, const TArray< int32 >& In3, const FTransform& In4) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn032() { return {}; }
+void UKDGBenchLib_077::Lib077_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0) {}
+FString UKDGBenchLib_077::Lib077_Fn034(const FVector& In0, FName In1) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn035(FName In0, const FTransform& In1, const FString& In2, FString& Out3, FVector& Out4, UObject* In5) {}
+int32 UKDGBenchLib_077::Lib077_Fn036(int32 In0) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn037(UObject* In0, FName In1, const FVector& In2, UObject* In3, FString& Out4) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn038(const TArray< int32 >& In0, bool In1, const FString& In2, const FVector& In3, FString& Out4) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn039() { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn040(const FString& In0, const FString& In1, const FTransform& In2, const FString& In3) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn041(const FVector& In0, const FString& In1, const FTransform& In2, float In3, const TArray< int32 >& In4, const FVector& In5) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn042(float In0) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn043(FString& Out0, UObject* In1, FString& Out2, int32& Out3, const FVector& In4, float In5, int32& Out6, const FVector& In7) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn044(int32 In0, FName In1, bool In2) { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn045(float In0, FName In1) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn046(float In0, int32 In1) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn047() {}
+FString UKDGBenchLib_077::Lib077_Fn048(FName In0, FVector& Out1, int32& Out2, const FString& In3) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn049(UObject* In0) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn050(float In0) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn051(const FString& In0, const FString& In1, const TArray< int32 >& In2, int32 In3) { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn052(int32 In0, FString& Out1, int32& Out2, bool In3, int32 In4, float In5) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn053(FVector& Out0, FVector& Out1) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn054(int32 In0, UObject* In1, const FString& In2, FVector& Out3, const FString& In4, const FVector& In5) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn055(FVector& Out0, bool In1, FString& Out2, FName In3, float In4, FVector& Out5) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn056(const TArray< int32 >& In0) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn057() {}
+bool UKDGBenchLib_077::Lib077_Fn058() { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn059(UObject* In0, const FVector& In1, float In2) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn060(const FString& In0, FVector& Out1, int32& Out2, FName In3, float In4, const FTransform& In5) { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn061(bool In0, const FString& In1, FVector& Out2, FVector& Out3, FVector& Out4, int32& Out5, int32& Out6, int32 In7) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn062(const FVector& In0, UObject* In1, bool In2, int32 In3, const TArray< int32 >& In4, UObject* In5, bool In6, int32 In7) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn063() { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn064(int32& Out0, FString& Out1, const FTransform& In2) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn065(int32 In0, const TArray< int32 >& In1, FName In2, int32& Out3, const FTransform& In4, const FTransform& In5) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn066(const FVector& In0) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn067(int32& Out0, int32 In1, const FString& In2, const FString& In3) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn068(FName In0, const FString& In1, FVector& Out2, float In3, FString& Out4) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn069(int32 In0, const FTransform& In1, const FString& In2, const FTransform& In3, float In4, FVector& Out5, const FString& In6) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, const FString& In2, FString& Out3, int32& Out4, bool In5, bool In6) {}
+int32 UKDGBenchLib_077::Lib077_Fn071(FVector& Out0, int32 In1, float In2, bool In3, const TArray< int32 >& In4, int32 In5) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, const FVector& In2, const TArray< int32 >& In3) {}
+float UKDGBenchLib_077::Lib077_Fn073(const FVector& In0, int32 In1, int32& Out2, const FString& In3) { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn074(bool In0, const FString& In1, int32 In2, const FTransform& In3, FVector& Out4, FName In5) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn075(int32 In0, FVector& Out1, const FVector& In2) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn076(int32& Out0, UObject* In1, int32& Out2, UObject* In3, FString& Out4, const FVector& In5, bool In6) { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn077(int32& Out0, FVector& Out1, const TArray< int32 >& In2, FVector& Out3, float In4, bool In5) { return {}; }
+FVector UKDGBenchLib_077::Lib077_Fn078(const TArray< int32 >& In0, int32& Out1, float In2, FName In3, int32& Out4) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn079(const TArray< int32 >& In0, int32 In1, FVector& Out2, const FTransform& In3, int32 In4, int32 In5) { return {}; }
+FString UKDGBenchLib_077::Lib077_Fn080(FVector& Out0, FVector& Out1, float In2, const FString& In3, FVector& Out4, const FVector& In5, int32 In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn081(int32 In0, const FString& In1) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn082(const FString& In0, float In1, FName In2, int32 In3, const FTransform& In4) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32& Out1, FName In2, const TArray< int32 >& In3, FString& Out4, const FTransform& In5, float In6, const FTransform& In7) {}
+void UKDGBenchLib_077::Lib077_Fn084(const FString& In0, const FString& In1, FString& Out2, const FVector& In3, bool In4, int32& Out5, int32 In6) {}
+FVector UKDGBenchLib_077::Lib077_Fn085(const FTransform& In0, int32& Out1, const TArray< int32 >& In2, FString& Out3, float In4) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn086(const TArray< int32 >& In0) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn087() { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn088(bool In0, const FString& In1, FVector& Out2, const FVector& In3, bool In4, const FTransform& In5) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn089(const TArray< int32 >& In0, int32& Out1, bool In2) { return {}; }
+bool UKDGBenchLib_077::Lib077_Fn090(UObject* In0) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn091(const FTransform& In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn092(FString& Out0) { return {}; }
+float UKDGBenchLib_077::Lib077_Fn093(const TArray< int32 >& In0, float In1, UObject* In2, UObject* In3, const FTransform& In4, int32 In5, UObject* In6, const FString& In7) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn094() {}
+FString UKDGBenchLib_077::Lib077_Fn095(bool In0, FString& Out1, const FVector& In2, UObject* In3) { return {}; }
+void UKDGBenchLib_077::Lib077_Fn096(FName In0, float In1, bool In2) {}
+FVector UKDGBenchLib_077::Lib077_Fn097(int32& Out0, int32& Out1, FString& Out2, const FVector& In3, FName In4, FString& Out5, const FString& In6) { return {}; }
+int32 UKDGBenchLib_077::Lib077_Fn098() { return {}; }
+void UKDGBenchLib_077::Lib077_Fn099(const TArray< int32 >& In0, FString& Out1, float In2, int32& Out3, float In4, FString& Out5) {}
+
+bool UKDGBenchLib_078::Lib078_Fn000() { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn001(FString& Out0, float In1, FName In2, const FString& In3, FName In4, FName In5, FVector& Out6) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn002() { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn003(const TArray< int32 >& In0) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn004() { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn005(float In0, const FTransform& In1, const FString& In2, FName In3, FString& Out4, FString& Out5, const TArray< int32 >& In6) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn006(const TArray< int32 >& In0, int32& Out1, UObject* In2, const FString& In3, FString& Out4, FString& Out5, UObject* In6, FString& Out7) { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn007(const TArray< int32 >& In0, const FVector& In1, bool In2, UObject* In3, FName In4, const FString& In5, FVector& Out6, float In7) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn008(const TArray< int32 >& In0, UObject* In1, float In2, FName In3, UObject* In4) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn009(FString& Out0) { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn010(const FString& In0, int32& Out1, const FVector& In2, float In3) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn011(int32& Out0, const TArray< int32 >& In1) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn012(const TArray< int32 >& In0, float In1, UObject* In2, FVector& Out3, const FTransform& In4, float In5) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn013(int32 In0) { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn014(const FTransform& In0) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn015(bool In0, const TArray< int32 >& In1, const FString& In2, bool In3, bool In4) { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn016(FString& Out0, const FVector& In1, const TArray< int32 >& In2, int32 In3, bool In4, float In5, FName In6) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn017(const FVector& In0, FName In1, float In2) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn018(int32 In0, const FString& In1) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn019(FString& Out0) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn020(const FTransform& In0, const FVector& In1, FName In2) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, bool In1, FName In2, int32 In3, float In4) {}
+FVector UKDGBenchLib_078::Lib078_Fn022(int32& Out0, const FVector& In1, const TArray< int32 >& In2, FName In3, int32& Out4, FName In5, const FVector& In6, float In7) { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn023(const FTransform& In0, const TArray< int32 >& In1, float In2) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn024(int32& Out0, UObject* In1, FString& Out2) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn025(bool In0, const FTransform& In1, float In2, float In3, const TArray< int32 >& In4, FVector& Out5, const FVector& In6) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn026(const FVector& In0, FVector& Out1, FVector& Out2, int32 In3, const FString& In4, const FVector& In5, FName In6) {}
+int32 UKDGBenchLib_078::Lib078_Fn027(const FString& In0, const FString& In1, FVector& Out2) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn028() {}
+FString UKDGBenchLib_078::Lib078_Fn029(FName In0) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, float In1, int32& Out2, FName In3, const FVector& In4, const TArray< int32 >& In5, int32& Out6) {}
+FString UKDGBenchLib_078::Lib078_Fn031(const FVector& In0, const FVector& In1) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn032(const FVector& In0, const FString& In1, const FTransform& In2, const TArray< int32 >& In3, FName In4, int32 In5) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn033(const FString& In0, const FTransform& In1) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn034() { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn035() { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn036() { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn037(const TArray< int32 >& In0, UObject* In1, bool In2, FVector& Out3, FName In4, FName In5) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn038(FString& Out0, const FString& In1, FString& Out2) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn039(FVector& Out0, bool In1) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn040(bool In0, int32 In1) {}
+float UKDGBenchLib_078::Lib078_Fn041(const FVector& In0, bool In1, bool In2, const FString& In3, FVector& Out4, FString& Out5, const FVector& In6, float In7) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn042(int32 In0, float In1, FString& Out2, bool In3) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn043(const FVector& In0, const TArray< int32 >& In1) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn044(UObject* In0, FName In1, const FVector& In2, float In3, FString& Out4, const FTransform& In5, FString& Out6, FName In7) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn045() { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn046(FVector& Out0, FVector& Out1, const FVector& In2, float In3, FName In4) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn047(float In0) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn048(int32& Out0) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0) {}
+int32 UKDGBenchLib_078::Lib078_Fn050(const FTransform& In0, const FTransform& In1, FVector& Out2, int32 In3) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn051(int32& Out0, FVector& Out1, const FString& In2, const FTransform& In3, const FString& In4, FName In5, const TArray< int32 >& In6, int32& Out7) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn052(const FTransform& In0, FName In1, int32 In2, int32& Out3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn053(float In0, const FVector& In1, const TArray< int32 >& In2, FVector& Out3, FName In4, float In5) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn054(UObject* In0, const FVector& In1, const TArray< int32 >& In2, FVector& Out3, const FString& In4, const FTransform& In5, const FTransform& In6, const FVector& In7) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn055(float In0, FName In1, bool In2) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn056(const FVector& In0, const FVector& In1, const TArray< int32 >& In2, int32 In3, UObject* In4, int32 In5) { return {}; }
+bool UKDGBenchLib_078::Lib078_Fn057(int32 In0, int32 In1, const FTransform& In2, int32 In3, const FTransform& In4) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn058(const TArray< int32 >& In0, float In1, float In2, int32 In3, UObject* In4, bool In5, const FString& In6) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn059(FVector& Out0, const FVector& In1, float In2, FVector& Out3, const FVector& In4) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn060(FVector& Out0, const FVector& In1, FName In2, FString& Out3, int32& Out4) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn061(int32 In0, bool In1, FString& Out2) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn062(FName In0, UObject* In1, const FVector& In2, FVector& Out3, const FTransform& In4, FString& Out5, FString& Out6, const FTransform& In7) {}
+FVector UKDGBenchLib_078::Lib078_Fn063(const FString& In0, const FTransform& In1, const TArray< int32 >& In2, FName In3, FVector& Out4, FString& Out5, int32 In6, FName In7) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn064(FString& Out0, bool In1, FName In2) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn065(FString& Out0, const TArray< int32 >& In1, FVector& Out2, const FTransform& In3, FName In4, FString& Out5, float In6) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn066(const TArray< int32 >& In0, FVector& Out1, bool In2, FName In3, FString& Out4) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn067(int32 In0, bool In1, float In2, int32& Out3, FName In4) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn068(float In0, const FString& In1, FString& Out2, FString& Out3) {}
+int32 UKDGBenchLib_078::Lib078_Fn069(bool In0, FName In1, FString& Out2, FVector& Out3) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn070(const FTransform& In0, const FVector& In1, int32& Out2, bool In3, const FTransform& In4, int32 In5, const FString& In6, FName In7) {}
+void UKDGBenchLib_078::Lib078_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, const FVector& In2, const FString& In3, FVector& Out4, int32 In5, FName In6, int32 In7) {}
+int32 UKDGBenchLib_078::Lib078_Fn072(int32& Out0, const FVector& In1, FString& Out2) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FTransform& In1, int32 In2, const FVector& In3, const FVector& In4, int32& Out5) {}
+float UKDGBenchLib_078::Lib078_Fn074() { return {}; }
+float UKDGBenchLib_078::Lib078_Fn075(const FTransform& In0, const FVector& In1, FName In2, FName In3, float In4, int32& Out5, FVector& Out6, FName In7) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn076(const FTransform& In0, const FString& In1) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn077(int32& Out0, FString& Out1, FVector& Out2, bool In3, int32& Out4, FString& Out5) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn078() { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn079(FName In0, FVector& Out1, FName In2, int32& Out3, FName In4, int32& Out5, float In6, const TArray< int32 >& In7) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn080(int32& Out0, const FTransform& In1, bool In2, const FTransform& In3) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn081(bool In0) {}
+FString UKDGBenchLib_078::Lib078_Fn082(bool In0, FString& Out1, int32& Out2) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn083(int32& Out0, const TArray< int32 >& In1, const FString& In2) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const FVector& In1, const FString& In2) {}
+FString UKDGBenchLib_078::Lib078_Fn085(FName In0, const TArray< int32 >& In1, const FString& In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchLib_078::Lib078_Fn086(bool In0) { return {}; }
+float UKDGBenchLib_078::Lib078_Fn087(const FVector& In0, const FVector& In1, const TArray< int32 >& In2, FString& Out3, const FTransform& In4, FVector& Out5) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn088(FVector& Out0, const TArray< int32 >& In1, const FVector& In2, const FVector& In3, const FString& In4, bool In5, const FString& In6) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn089(UObject* In0, int32& Out1, const FString& In2, int32 In3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn090() { return {}; }
+FString UKDGBenchLib_078::Lib078_Fn091(const FVector& In0, const TArray< int32 >& In1) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FTransform& In1, int32 In2, FString& Out3, FName In4) {}
+void UKDGBenchLib_078::Lib078_Fn093(float In0, const TArray< int32 >& In1, const FVector& In2, const FTransform& In3, FVector& Out4, FVector& Out5) {}
+int32 UKDGBenchLib_078::Lib078_Fn094(int32 In0) { return {}; }
+FVector UKDGBenchLib_078::Lib078_Fn095(const FVector& In0, UObject* In1, const FString& In2, const FVector& In3, FString& Out4, int32 In5) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FString& In1, const FString& In2, const TArray< int32 >& In3, const FString& In4, FString& Out5) {}
+FString UKDGBenchLib_078::Lib078_Fn097(const FVector& In0, FString& Out1, FName In2, const FString& In3, int32 In4) { return {}; }
+void UKDGBenchLib_078::Lib078_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, const FTransform& In2) {}
+int32 UKDGBenchLib_078::Lib078_Fn099(const FVector& In0, FName In1, float In2, FString& Out3, bool In4) { return {}; }
+
+FVector UKDGBenchLib_079::Lib079_Fn000() { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn001(const FString& In0, const FVector& In1) { return {}; }
+float UKDGBenchLib_079::Lib079_Fn002(int32 In0, const FVector& In1, const FString& In2, FString& Out3, FVector& Out4, const FTransform& In5, const FVector& In6) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FVector& Out1, int32 In2, const TArray< int32 >& In3, const FTransform& In4, const FString& In5, const TArray< int32 >& In6) {}
+FString UKDGBenchLib_079::Lib079_Fn004(FVector& Out0, int32& Out1, FString& Out2, FVector& Out3, const TArray< int32 >& In4, int32& Out5, float In6, FName In7) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn005(int32& Out0, float In1, int32& Out2, const FTransform& In3, const TArray< int32 >& In4, float In5) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn006(FString& Out0, float In1, const FTransform& In2, const FTransform& In3, int32& Out4, FName In5, UObject* In6, FName In7) {}
+bool UKDGBenchLib_079::Lib079_Fn007(FVector& Out0, const TArray< int32 >& In1, const FString& In2) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn008(FVector& Out0, const FString& In1) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn009(const FTransform& In0, FString& Out1) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn010(FVector& Out0, UObject* In1, const FTransform& In2, FString& Out3, bool In4, const FTransform& In5, int32& Out6, FVector& Out7) {}
+FVector UKDGBenchLib_079::Lib079_Fn011(UObject* In0, FString& Out1, int32 In2) { return {}; }
+float UKDGBenchLib_079::Lib079_Fn012(const FTransform& In0, float In1, FName In2, float In3, int32& Out4, FString& Out5, FVector& Out6) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, FString& Out2, const FString& In3, const TArray< int32 >& In4, UObject* In5, const FString& In6, FName In7) {}
+FString UKDGBenchLib_079::Lib079_Fn014(FString& Out0, int32& Out1, const TArray< int32 >& In2, const FString& In3, const TArray< int32 >& In4, const FVector& In5, int32 In6) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn015() { return {}; }
+void UKDGBenchLib_079::Lib079_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FVector UKDGBenchLib_079::Lib079_Fn017(FString& Out0, const FString& In1, FName In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn018(const TArray< int32 >& In0, UObject* In1, UObject* In2, const FTransform& In3, const FTransform& In4, FName In5, FString& Out6) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn019(bool In0, UObject* In1) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn020(FVector& Out0, bool In1, int32& Out2, int32 In3) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn021(float In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn022(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FVector& Out1, int32 In2, UObject* In3, float In4, UObject* In5, FVector& Out6, int32 In7) {}
+float UKDGBenchLib_079::Lib079_Fn023(const FVector& In0, FVector& Out1, float In2, const FVector& In3, bool In4, const FString& In5, int32 In6) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn024(FName In0, const FVector& In1, const FVector& In2) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn025(bool In0, int32 In1) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn026() { return {}; }
+float UKDGBenchLib_079::Lib079_Fn027(float In0, UObject* In1, const FString& In2, FVector& Out3, const TArray< int32 >& In4, int32 In5, UObject* In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn028(bool In0) {}
+int32 UKDGBenchLib_079::Lib079_Fn029(int32& Out0, const TArray< int32 >& In1, const FTransform& In2, bool In3, int32 In4, FVector& Out5, int32& Out6, int32 In7) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn030(bool In0, FString& Out1, const TArray< int32 >& In2, int32 In3, float In4, const FVector& In5) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn031(const FVector& In0, int32 In1, const TArray< int32 >& In2, FVector& Out3) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn032(FVector& Out0, float In1, const FTransform& In2, const TArray< int32 >& In3, float In4, const FTransform& In5) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn033(bool In0, UObject* In1, const TArray< int32 >& In2, FName In3) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn034(const FString& In0, UObject* In1, UObject* In2, const FString& In3) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn035(const FVector& In0, int32 In1) {}
+float UKDGBenchLib_079::Lib079_Fn036(bool In0, int32& Out1, const FString& In2, FVector& Out3, bool In4, float In5) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn037(FVector& Out0, const FTransform& In1, int32& Out2) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn038(int32 In0, FString& Out1, bool In2) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn039(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0) {}
+bool UKDGBenchLib_079::Lib079_Fn040(UObject* In0, int32& Out1, const FVector& In2) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn041(const TArray< int32 >& In0, FString& Out1, FString& Out2, int32 In3, UObject* In4, float In5, UObject* In6, float In7) {}
+float UKDGBenchLib_079::Lib079_Fn042(FVector& Out0, const FVector& In1) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn043(int32 In0, const FString& In1, int32 In2, const TArray< int32 >& In3, int32 In4, bool In5, int32& Out6, bool In7) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn044(FName In0, const FTransform& In1, float In2, UObject* In3, bool In4, int32 In5, const FTransform& In6) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn045(FName In0, FString& Out1, const TArray< int32 >& In2) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FVector UKDGBenchLib_079::Lib079_Fn047(FName In0, const TArray< int32 >& In1, const FTransform& In2, int32& Out3) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn048(UObject* In0) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FName In1, bool In2, const FTransform& In3, float In4, const FString& In5, float In6, FString& Out7) {}
+void UKDGBenchLib_079::Lib079_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, const FString& In1, bool In2, float In3, const FString& In4, const FVector& In5) {}
+float UKDGBenchLib_079::Lib079_Fn051(int32 In0) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn052(const TArray< int32 >& In0, const TArray< int32 >& In1, FVector& Out2, FVector& Out3) { return {}; }
+float UKDGBenchLib_079::Lib079_Fn053(FString& Out0, int32& Out1, UObject* In2, FName In3) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn054(const FString& In0, const TArray< int32 >& In1, bool In2, const FString& In3, int32 In4, const FString& In5, int32 In6, UObject* In7) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn055(FString& Out0, int32 In1, UObject* In2) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn056(int32& Out0, UObject* In1) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn057(FVector& Out0, float In1, const FTransform& In2, const FString& In3) {}
+FString UKDGBenchLib_079::Lib079_Fn058(FString& Out0, bool In1) { return {}; }
+float UKDGBenchLib_079::Lib079_Fn059() { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn060(const FString& In0, const TArray< int32 >& In1, const FString& In2) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_079::Lib079_Fn062(UObject* In0) {}
+int32 UKDGBenchLib_079::Lib079_Fn063(int32 In0, const TArray< int32 >& In1, FName In2, int32 In3, int32 In4) { return {}; }
+float UKDGBenchLib_079::Lib079_Fn064(const FVector& In0, const FTransform& In1, int32 In2) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn065(const FString& In0, FName In1, int32 In2) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, int32& Out2, int32 In3, int32 In4, float In5, float In6) {}
+bool UKDGBenchLib_079::Lib079_Fn067(float In0, const FVector& In1, bool In2, int32 In3, FVector& Out4, const FTransform& In5, FVector& Out6, FString& Out7) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn068(int32& Out0, int32 In1, const FTransform& In2, FName In3, FName In4) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn069(bool In0, bool In1, FName In2, UObject* In3, const TArray< int32 >& In4, FName In5) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn070() { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn071(bool In0, float In1, const TArray< int32 >& In2, const FString& In3, int32& Out4, const FVector& In5) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn072(int32& Out0, FName In1, const FTransform& In2, const FString& In3, const FString& In4, const TArray< int32 >& In5, const FVector& In6) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn073(FVector& Out0) { return {}; }
+float UKDGBenchLib_079::Lib079_Fn074(int32& Out0, FVector& Out1, FString& Out2, bool In3, const FString& In4, int32 In5) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn075(FVector& Out0, int32& Out1) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn076() { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn077(int32 In0, UObject* In1, FVector& Out2, float In3, FString& Out4, FString& Out5, bool In6) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn078(int32& Out0, const FString& In1, FName In2, const FString& In3, float In4) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn079(float In0, float In1, int32 In2, const FTransform& In3) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const FVector& In1, const FString& In2, const TArray< int32 >& In3, const FVector& In4, const TArray< int32 >& In5, FName In6) {}
+void UKDGBenchLib_079::Lib079_Fn081(FName In0, const TArray< int32 >& In1, FString& Out2) {}
+void UKDGBenchLib_079::Lib079_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, FVector& Out2, const FTransform& In3, float In4, UObject* In5, FString& Out6) {}
+bool UKDGBenchLib_079::Lib079_Fn083(FString& Out0, const FVector& In1, FVector& Out2, FVector& Out3) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn084(const TArray< int32 >& In0) { return {}; }
+float UKDGBenchLib_079::Lib079_Fn085() { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn086(int32 In0, FString& Out1, int32& Out2, bool In3, FString& Out4) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn087() { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn088(FName In0) { return {}; }
+bool UKDGBenchLib_079::Lib079_Fn089(FString& Out0, const TArray< int32 >& In1, int32& Out2, const FTransform& In3, FString& Out4, float In5, const FTransform& In6) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn090(FName In0) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn091(const FTransform& In0) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, FString& Out2) {}
+void UKDGBenchLib_079::Lib079_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, float In1, float In2, const FTransform& In3, int32& Out4, FName In5, const FString& In6, UObject* In7) {}
+float UKDGBenchLib_079::Lib079_Fn094(int32& Out0, UObject* In1, const FVector& In2, const FVector& In3, FName In4) { return {}; }
+FVector UKDGBenchLib_079::Lib079_Fn095(const TArray< int32 >& In0, UObject* In1, float In2, FString& Out3, const TArray< int32 >& In4, float In5, const FTransform& In6, const FVector& In7) { return {}; }
+FString UKDGBenchLib_079::Lib079_Fn096(UObject* In0, int32& Out1, const FTransform& In2, const FString& In3, bool In4) { return {}; }
+int32 UKDGBenchLib_079::Lib079_Fn097(int32 In0, FName In1, bool In2) { return {}; }
+void UKDGBenchLib_079::Lib079_Fn098(int32& Out0, const FTransform& In1) {}
+FVector UKDGBenchLib_079::Lib079_Fn099(FName In0) { return {}; }
+
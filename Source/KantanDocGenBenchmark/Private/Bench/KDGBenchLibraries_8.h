@@ -0,0 +1,3105 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Engine/LatentActionManager.h"
+#include "KDGBenchLibraries_8.generated.h"
+
+
+UCLASS()
+class UKDGBenchLib_080 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib080_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn000(const FVector& In0, int32& Out1, const FVector& In2, bool In3, const FTransform& In4, UObject* In5);
+	/** Benchmark callable node Lib080_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn001();
+	/** Benchmark pure node Lib080_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn002(const TArray< int32 >& In0, FName In1, int32 In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib080_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn003(FVector& Out0, const FString& In1, UObject* In2, const FString& In3, bool In4, float In5);
+	/** Benchmark callable node Lib080_Fn004 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn004(const FVector& In0, float In1, int32& Out2, bool In3, FVector& Out4);
+	/** Benchmark callable node Lib080_Fn005 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn005(int32& Out0, float In1, const FString& In2, const FString& In3, int32& Out4);
+	/** Benchmark callable node Lib080_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn006(const FVector& In0, FName In1, const FString& In2, const FTransform& In3);
+	/** Benchmark latent node Lib080_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, int32& Out1, const FTransform& In2, FVector& Out3);
+	/** Benchmark callable node Lib080_Fn008 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn008(FString& Out0, float In1);
+	/** Benchmark pure node Lib080_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn009(bool In0, FName In1, FVector& Out2, int32 In3, const TArray< int32 >& In4, const FString& In5, const FString& In6, FString& Out7);
+	/** Benchmark latent node Lib080_Fn010 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib080_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn011(const FString& In0, FName In1, FString& Out2, const FTransform& In3, const FString& In4, bool In5, UObject* In6);
+	/** Benchmark callable node Lib080_Fn012 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn012(const FVector& In0, const FTransform& In1, FVector& Out2, FName In3, const FTransform& In4, float In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib080_Fn013 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn013(int32& Out0, int32 In1, const FVector& In2);
+	/** Benchmark callable node Lib080_Fn014 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn014(const FTransform& In0, bool In1, const FString& In2, float In3, int32& Out4, int32& Out5);
+	/** Benchmark pure node Lib080_Fn015 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn015(const FTransform& In0, int32& Out1);
+	/** Benchmark pure node Lib080_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn016(float In0, UObject* In1, int32& Out2, int32& Out3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib080_Fn017 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn017();
+	/** Benchmark callable node Lib080_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn018(const FTransform& In0, FString& Out1, const FVector& In2, const FString& In3, int32 In4);
+	/** Benchmark pure node Lib080_Fn019 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn019(const TArray< int32 >& In0, UObject* In1, int32& Out2, int32 In3, const FVector& In4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib080_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn020(const FVector& In0);
+	/** Benchmark callable node Lib080_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn021(FName In0, const FTransform& In1, const FString& In2);
+	/** Benchmark callable node Lib080_Fn022 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn022();
+	/** Benchmark callable node Lib080_Fn023 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn023(float In0, const TArray< int32 >& In1, FVector& Out2, float In3, const FString& In4, FVector& Out5, const FVector& In6, const FTransform& In7);
+	/** Benchmark callable node Lib080_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn024(int32 In0);
+	/** Benchmark pure node Lib080_Fn025 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn025();
+	/** Benchmark callable node Lib080_Fn026 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn026(FVector& Out0, float In1, const TArray< int32 >& In2, UObject* In3, const FVector& In4, const FString& In5, FString& Out6);
+	/** Benchmark callable node Lib080_Fn027 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn027();
+	/** Benchmark callable node Lib080_Fn028 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn028(bool In0, FName In1, const FVector& In2, const FTransform& In3, FVector& Out4, FString& Out5, const FVector& In6);
+	/** Benchmark callable node Lib080_Fn029 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn029();
+	/** Benchmark pure node Lib080_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn030(FVector& Out0, float In1, FString& Out2, const TArray< int32 >& In3, FVector& Out4, bool In5);
+	/** Benchmark callable node Lib080_Fn031 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn031();
+	/** Benchmark pure node Lib080_Fn032 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn032(int32& Out0, int32 In1, UObject* In2, const FString& In3, UObject* In4);
+	/** Benchmark callable node Lib080_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn033(int32& Out0, float In1, FVector& Out2, const FVector& In3);
+	/** Benchmark callable node Lib080_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn034(FName In0, FName In1, const FVector& In2, const FString& In3, FName In4, const FTransform& In5);
+	/** Benchmark pure node Lib080_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn035(bool In0, FVector& Out1, FString& Out2, FName In3, UObject* In4, const FTransform& In5, UObject* In6, FName In7);
+	/** Benchmark pure node Lib080_Fn036 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn036();
+	/** Benchmark callable node Lib080_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn037(int32& Out0, const FString& In1, FName In2, const TArray< int32 >& In3, const FString& In4);
+	/** Benchmark latent node Lib080_Fn038 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, float In1, bool In2, const FString& In3, FVector& Out4, int32& Out5);
+	/** Benchmark callable node Lib080_Fn039 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn039();
+	/** Benchmark callable node Lib080_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn040(FVector& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, bool In3, int32 In4, const TArray< int32 >& In5, UObject* In6, FString& Out7);
+	/** Benchmark pure node Lib080_Fn041 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn041(const TArray< int32 >& In0, FName In1);
+	/** Benchmark callable node Lib080_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn042(bool In0, UObject* In1);
+	/** Benchmark pure node Lib080_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn043(FString& Out0, const FVector& In1, FName In2, bool In3, const TArray< int32 >& In4, int32 In5);
+	/** Benchmark pure node Lib080_Fn044 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn044();
+	/** Benchmark pure node Lib080_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn045(const TArray< int32 >& In0, bool In1, FVector& Out2, FString& Out3, int32 In4, UObject* In5, float In6, int32& Out7);
+	/** Benchmark pure node Lib080_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn046(UObject* In0, float In1, FString& Out2, bool In3, UObject* In4, UObject* In5, int32 In6, int32 In7);
+	/** Benchmark pure node Lib080_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn047(bool In0, FString& Out1, int32& Out2, FName In3, UObject* In4, UObject* In5, FString& Out6);
+	/** Benchmark pure node Lib080_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn048(int32 In0, const TArray< int32 >& In1, int32 In2, const FVector& In3, const TArray< int32 >& In4, int32 In5, FVector& Out6);
+	/** Benchmark callable node Lib080_Fn049 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn049();
+	/** Benchmark latent node Lib080_Fn050 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, UObject* In2, FName In3, FName In4, int32& Out5, FVector& Out6);
+	/** Benchmark pure node Lib080_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn051(const FTransform& In0, bool In1, FString& Out2, const TArray< int32 >& In3);
+	/** Benchmark pure node Lib080_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn052(float In0, int32 In1, FVector& Out2);
+	/** Benchmark callable node Lib080_Fn053 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn053(const FVector& In0, const TArray< int32 >& In1, int32& Out2, float In3, const FString& In4);
+	/** Benchmark pure node Lib080_Fn054 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn054(const TArray< int32 >& In0, const FTransform& In1, const FVector& In2, float In3, FVector& Out4);
+	/** Benchmark callable node Lib080_Fn055 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn055(int32& Out0, bool In1, float In2, FString& Out3, UObject* In4, int32 In5, const FTransform& In6, const FString& In7);
+	/** Benchmark callable node Lib080_Fn056 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn056(bool In0, FName In1, bool In2, FVector& Out3);
+	/** Benchmark pure node Lib080_Fn057 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn057(float In0);
+	/** Benchmark pure node Lib080_Fn058 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn058(float In0);
+	/** Benchmark latent node Lib080_Fn059 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, const TArray< int32 >& In2, const FString& In3, FString& Out4, const FString& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib080_Fn060 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn060(float In0, FVector& Out1, UObject* In2, const FVector& In3, bool In4);
+	/** Benchmark latent node Lib080_Fn061 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const FTransform& In1, FVector& Out2, int32& Out3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib080_Fn062 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn062(const FVector& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, float In3, FVector& Out4, const FString& In5, const FTransform& In6, FVector& Out7);
+	/** Benchmark callable node Lib080_Fn063 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn063(const FVector& In0, FString& Out1, const TArray< int32 >& In2, int32 In3, const TArray< int32 >& In4);
+	/** Benchmark latent node Lib080_Fn064 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, float In2, int32& Out3);
+	/** Benchmark callable node Lib080_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn065(int32 In0, FName In1, int32& Out2, const TArray< int32 >& In3, int32& Out4, FVector& Out5, float In6, int32& Out7);
+	/** Benchmark callable node Lib080_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn066();
+	/** Benchmark callable node Lib080_Fn067 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn067(FVector& Out0, int32& Out1, const FVector& In2, FVector& Out3, FVector& Out4);
+	/** Benchmark callable node Lib080_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn068(const TArray< int32 >& In0, const FTransform& In1, UObject* In2, const FVector& In3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib080_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn069(float In0, UObject* In1);
+	/** Benchmark callable node Lib080_Fn070 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn070(bool In0, int32 In1, FString& Out2, const FString& In3);
+	/** Benchmark callable node Lib080_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn071(FName In0, int32& Out1, FName In2, FVector& Out3, FVector& Out4, float In5);
+	/** Benchmark pure node Lib080_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn072(UObject* In0, UObject* In1);
+	/** Benchmark pure node Lib080_Fn073 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn073(const FString& In0, bool In1, float In2, const FString& In3);
+	/** Benchmark pure node Lib080_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn074(UObject* In0);
+	/** Benchmark pure node Lib080_Fn075 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn075(FString& Out0, float In1, FVector& Out2);
+	/** Benchmark callable node Lib080_Fn076 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn076(const FVector& In0, FVector& Out1, FVector& Out2, FName In3, FName In4);
+	/** Benchmark pure node Lib080_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn077(FString& Out0, FString& Out1, FVector& Out2, const FString& In3, float In4, UObject* In5, int32& Out6);
+	/** Benchmark callable node Lib080_Fn078 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn078(int32& Out0, UObject* In1, int32& Out2, UObject* In3, int32 In4, const TArray< int32 >& In5, const FVector& In6, const FVector& In7);
+	/** Benchmark callable node Lib080_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn079();
+	/** Benchmark callable node Lib080_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn080(const TArray< int32 >& In0, float In1, UObject* In2, FName In3);
+	/** Benchmark callable node Lib080_Fn081 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn081(const FVector& In0, UObject* In1);
+	/** Benchmark callable node Lib080_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn082(const FString& In0, int32& Out1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib080_Fn083 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FVector Lib080_Fn083(bool In0, FVector& Out1, FString& Out2, FVector& Out3, UObject* In4, FString& Out5, const FVector& In6, const FTransform& In7);
+	/** Benchmark callable node Lib080_Fn084 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn084(FString& Out0, FName In1, const FString& In2, int32& Out3);
+	/** Benchmark callable node Lib080_Fn085 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn085(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib080_Fn086 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn086(float In0);
+	/** Benchmark callable node Lib080_Fn087 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn087(int32& Out0, FName In1, const FVector& In2, FString& Out3);
+	/** Benchmark pure node Lib080_Fn088 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn088(int32 In0);
+	/** Benchmark latent node Lib080_Fn089 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib080_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FVector& Out1, int32& Out2);
+	/** Benchmark callable node Lib080_Fn090 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static void Lib080_Fn090(const TArray< int32 >& In0, FString& Out1);
+	/** Benchmark callable node Lib080_Fn091 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn091();
+	/** Benchmark pure node Lib080_Fn092 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn092(const FVector& In0, UObject* In1);
+	/** Benchmark callable node Lib080_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn093(const FVector& In0, const FString& In1, FString& Out2, FVector& Out3, FVector& Out4, FString& Out5);
+	/** Benchmark pure node Lib080_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn094(bool In0, const TArray< int32 >& In1, bool In2, bool In3, UObject* In4);
+	/** Benchmark pure node Lib080_Fn095 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static int32 Lib080_Fn095(float In0, const TArray< int32 >& In1, FVector& Out2, const FTransform& In3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib080_Fn096 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn096(float In0, FString& Out1, const FVector& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib080_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static FString Lib080_Fn097(FVector& Out0, bool In1, int32 In2, const TArray< int32 >& In3, const FTransform& In4, float In5);
+	/** Benchmark pure node Lib080_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib080")
+	static float Lib080_Fn098(FString& Out0, const FTransform& In1, FString& Out2, FString& Out3, FVector& Out4, bool In5);
+	/** Benchmark callable node Lib080_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib080")
+	static bool Lib080_Fn099(const FTransform& In0, float In1, const FVector& In2, FVector& Out3, FString& Out4);
+};
+
+
+UCLASS()
+class UKDGBenchLib_081 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib081_Fn000 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn000(const TArray< int32 >& In0, FName In1);
+	/** Benchmark pure node Lib081_Fn001 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn001(FVector& Out0, const TArray< int32 >& In1, const FTransform& In2, FVector& Out3, int32 In4);
+	/** Benchmark callable node Lib081_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn002(bool In0, float In1);
+	/** Benchmark latent node Lib081_Fn003 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, int32 In1, int32 In2, const FString& In3, const FTransform& In4, const TArray< int32 >& In5, const FVector& In6, FString& Out7);
+	/** Benchmark callable node Lib081_Fn004 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn004(bool In0, const FTransform& In1, float In2, const TArray< int32 >& In3, int32& Out4, int32 In5);
+	/** Benchmark callable node Lib081_Fn005 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn005(const FTransform& In0);
+	/** Benchmark callable node Lib081_Fn006 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn006(const FTransform& In0);
+	/** Benchmark latent node Lib081_Fn007 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib081_Fn008 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn008();
+	/** Benchmark latent node Lib081_Fn009 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32 In1, const FTransform& In2, float In3, const FString& In4, const FTransform& In5);
+	/** Benchmark callable node Lib081_Fn010 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn010(int32 In0, int32& Out1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib081_Fn011 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn011(const FTransform& In0, const FTransform& In1, const FTransform& In2, UObject* In3, FVector& Out4, const FTransform& In5);
+	/** Benchmark latent node Lib081_Fn012 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, UObject* In1, int32 In2, const TArray< int32 >& In3, const FVector& In4, FVector& Out5, const FString& In6);
+	/** Benchmark callable node Lib081_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn013(int32 In0, FName In1, const TArray< int32 >& In2, FName In3, int32& Out4);
+	/** Benchmark callable node Lib081_Fn014 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn014(int32& Out0, FVector& Out1, const TArray< int32 >& In2, FString& Out3, FName In4, const TArray< int32 >& In5, float In6, UObject* In7);
+	/** Benchmark latent node Lib081_Fn015 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, UObject* In1, float In2, const FVector& In3, float In4, const TArray< int32 >& In5, const FString& In6, UObject* In7);
+	/** Benchmark callable node Lib081_Fn016 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn016(const TArray< int32 >& In0, float In1, const FTransform& In2, int32 In3, int32& Out4, const TArray< int32 >& In5, bool In6, const FTransform& In7);
+	/** Benchmark callable node Lib081_Fn017 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn017(float In0, int32 In1, UObject* In2, const FTransform& In3, int32& Out4, FName In5, FVector& Out6);
+	/** Benchmark pure node Lib081_Fn018 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn018(const FTransform& In0, const TArray< int32 >& In1, FVector& Out2);
+	/** Benchmark latent node Lib081_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn019(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1);
+	/** Benchmark callable node Lib081_Fn020 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn020(int32 In0, float In1, const FVector& In2, int32 In3);
+	/** Benchmark pure node Lib081_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn021(float In0, const FVector& In1, const FString& In2, const FVector& In3, bool In4, int32& Out5);
+	/** Benchmark callable node Lib081_Fn022 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn022(int32 In0, int32& Out1, FString& Out2, const FString& In3);
+	/** Benchmark callable node Lib081_Fn023 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn023(float In0, FVector& Out1, const FTransform& In2, const FVector& In3);
+	/** Benchmark pure node Lib081_Fn024 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn024(FName In0, const FTransform& In1, float In2, const FString& In3, FName In4);
+	/** Benchmark callable node Lib081_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn025(int32& Out0, const TArray< int32 >& In1, FString& Out2, int32& Out3, const FString& In4, const FTransform& In5);
+	/** Benchmark callable node Lib081_Fn026 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn026(FVector& Out0, int32 In1, FName In2, bool In3, const FVector& In4);
+	/** Benchmark callable node Lib081_Fn027 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn027(const TArray< int32 >& In0, FVector& Out1, UObject* In2, int32 In3, const FString& In4);
+	/** Benchmark callable node Lib081_Fn028 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn028(bool In0, UObject* In1, FName In2, FName In3, int32 In4, bool In5);
+	/** Benchmark callable node Lib081_Fn029 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn029(const FString& In0, const FVector& In1, const TArray< int32 >& In2, const TArray< int32 >& In3, FVector& Out4, UObject* In5, FName In6, UObject* In7);
+	/** Benchmark latent node Lib081_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const TArray< int32 >& In1, FName In2, int32& Out3);
+	/** Benchmark latent node Lib081_Fn031 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, UObject* In2, bool In3, UObject* In4, const FVector& In5, FVector& Out6);
+	/** Benchmark pure node Lib081_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn032();
+	/** Benchmark callable node Lib081_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn033(const FTransform& In0, const FTransform& In1, int32 In2);
+	/** Benchmark callable node Lib081_Fn034 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn034(const FString& In0);
+	/** Benchmark callable node Lib081_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn035(UObject* In0, UObject* In1, FName In2, UObject* In3, FString& Out4, FName In5, bool In6, float In7);
+	/** Benchmark callable node Lib081_Fn036 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn036(bool In0, const FString& In1, FVector& Out2, const FTransform& In3, FVector& Out4, int32& Out5, int32& Out6);
+	/** Benchmark pure node Lib081_Fn037 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn037(const FTransform& In0, const FString& In1, FName In2, int32& Out3, int32 In4, FName In5, UObject* In6, bool In7);
+	/** Benchmark callable node Lib081_Fn038 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn038(float In0, const TArray< int32 >& In1, FString& Out2, FString& Out3, const FString& In4, int32& Out5, int32 In6);
+	/** Benchmark callable node Lib081_Fn039 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn039(const FVector& In0);
+	/** Benchmark callable node Lib081_Fn040 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn040(float In0, const FVector& In1);
+	/** Benchmark callable node Lib081_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn041(int32 In0, FName In1, FString& Out2, const FString& In3);
+	/** Benchmark callable node Lib081_Fn042 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn042(FString& Out0, int32 In1, FName In2, int32 In3, const FTransform& In4, const FString& In5);
+	/** Benchmark callable node Lib081_Fn043 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn043(bool In0, int32& Out1, float In2, float In3, const FVector& In4, const FVector& In5, const FTransform& In6);
+	/** Benchmark callable node Lib081_Fn044 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn044(int32& Out0, const FTransform& In1, UObject* In2, UObject* In3);
+	/** Benchmark callable node Lib081_Fn045 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn045(const FString& In0, int32 In1, FVector& Out2, FName In3, float In4, const FVector& In5, const TArray< int32 >& In6, float In7);
+	/** Benchmark pure node Lib081_Fn046 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn046();
+	/** Benchmark callable node Lib081_Fn047 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn047(const FString& In0, float In1, bool In2);
+	/** Benchmark callable node Lib081_Fn048 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn048(UObject* In0, const FString& In1, FVector& Out2, const FString& In3, const FString& In4, FString& Out5, const TArray< int32 >& In6, bool In7);
+	/** Benchmark latent node Lib081_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, const FTransform& In2, FString& Out3, float In4);
+	/** Benchmark latent node Lib081_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib081_Fn051 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0);
+	/** Benchmark callable node Lib081_Fn052 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn052(const FString& In0, UObject* In1, int32& Out2, const FVector& In3, float In4);
+	/** Benchmark callable node Lib081_Fn053 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn053(const FString& In0, FName In1);
+	/** Benchmark pure node Lib081_Fn054 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn054(const TArray< int32 >& In0, FName In1, FString& Out2, FString& Out3);
+	/** Benchmark pure node Lib081_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn055();
+	/** Benchmark callable node Lib081_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn056();
+	/** Benchmark callable node Lib081_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn057();
+	/** Benchmark pure node Lib081_Fn058 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn058(bool In0, FName In1, const FString& In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib081_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn059(int32 In0, bool In1, UObject* In2, bool In3, const TArray< int32 >& In4, int32 In5, int32& Out6, FString& Out7);
+	/** Benchmark pure node Lib081_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn060(int32& Out0, FName In1, bool In2, FVector& Out3, FVector& Out4, const FString& In5, FVector& Out6, const FTransform& In7);
+	/** Benchmark pure node Lib081_Fn061 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn061(int32 In0, int32& Out1, int32 In2, int32 In3, const FString& In4);
+	/** Benchmark callable node Lib081_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn062(FName In0, FName In1, FVector& Out2, UObject* In3, const FVector& In4, const FString& In5);
+	/** Benchmark callable node Lib081_Fn063 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn063();
+	/** Benchmark pure node Lib081_Fn064 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn064(bool In0, float In1, const FString& In2);
+	/** Benchmark callable node Lib081_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn065(const FVector& In0, const FVector& In1, const FVector& In2, const TArray< int32 >& In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib081_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, bool In3, const FString& In4);
+	/** Benchmark callable node Lib081_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn067(int32 In0);
+	/** Benchmark latent node Lib081_Fn068 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32 In1, const FTransform& In2, int32& Out3, const FString& In4, int32& Out5, bool In6);
+	/** Benchmark callable node Lib081_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn069(UObject* In0, const FTransform& In1);
+	/** Benchmark callable node Lib081_Fn070 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn070(const TArray< int32 >& In0, float In1);
+	/** Benchmark callable node Lib081_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn071(bool In0, UObject* In1, const FVector& In2, FString& Out3, float In4, FName In5);
+	/** Benchmark callable node Lib081_Fn072 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn072(const FVector& In0, UObject* In1, bool In2, const FTransform& In3);
+	/** Benchmark pure node Lib081_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn073(const FString& In0, FString& Out1, int32 In2);
+	/** Benchmark pure node Lib081_Fn074 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn074();
+	/** Benchmark pure node Lib081_Fn075 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn075(int32 In0, int32& Out1);
+	/** Benchmark callable node Lib081_Fn076 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn076();
+	/** Benchmark pure node Lib081_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static FString Lib081_Fn077(bool In0, bool In1);
+	/** Benchmark callable node Lib081_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static float Lib081_Fn078(float In0, FString& Out1, const FVector& In2, const FString& In3, FName In4);
+	/** Benchmark callable node Lib081_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn079(FName In0, const FString& In1, const FTransform& In2);
+	/** Benchmark latent node Lib081_Fn080 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FString& Out1, UObject* In2, const FVector& In3, FString& Out4, int32 In5);
+	/** Benchmark callable node Lib081_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn081(FName In0, const FVector& In1, const FTransform& In2, int32& Out3, const FVector& In4, int32 In5, int32& Out6);
+	/** Benchmark callable node Lib081_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn082(FString& Out0, FName In1, const FVector& In2, const FTransform& In3, UObject* In4, UObject* In5, const FTransform& In6, FVector& Out7);
+	/** Benchmark callable node Lib081_Fn083 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn083(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib081_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn084(int32 In0, const FVector& In1, int32 In2);
+	/** Benchmark callable node Lib081_Fn085 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn085(const FString& In0, FName In1, const FVector& In2, FString& Out3);
+	/** Benchmark callable node Lib081_Fn086 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn086(UObject* In0, const FTransform& In1, int32& Out2, UObject* In3, const FTransform& In4, UObject* In5, FName In6, UObject* In7);
+	/** Benchmark callable node Lib081_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn087(float In0);
+	/** Benchmark pure node Lib081_Fn088 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn088(float In0, FVector& Out1, UObject* In2, int32 In3, float In4, UObject* In5, FString& Out6);
+	/** Benchmark callable node Lib081_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn089(bool In0, UObject* In1, const FVector& In2, float In3, const FTransform& In4, FVector& Out5);
+	/** Benchmark pure node Lib081_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn090(int32 In0, int32& Out1, int32 In2, const TArray< int32 >& In3, UObject* In4, FString& Out5, FString& Out6);
+	/** Benchmark latent node Lib081_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib081_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1, float In2, const FTransform& In3);
+	/** Benchmark callable node Lib081_Fn092 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static void Lib081_Fn092(const FString& In0, int32 In1, bool In2, const FString& In3);
+	/** Benchmark callable node Lib081_Fn093 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn093(int32 In0, const TArray< int32 >& In1, const TArray< int32 >& In2, int32 In3, const FTransform& In4, bool In5);
+	/** Benchmark callable node Lib081_Fn094 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static FVector Lib081_Fn094(FName In0, const FVector& In1, UObject* In2, const FTransform& In3, float In4);
+	/** Benchmark pure node Lib081_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn095(const TArray< int32 >& In0, int32 In1, const FString& In2, const FVector& In3);
+	/** Benchmark callable node Lib081_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn096(const FString& In0, const FTransform& In1, int32 In2, const FString& In3, const FTransform& In4);
+	/** Benchmark pure node Lib081_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn097(int32& Out0, FVector& Out1);
+	/** Benchmark callable node Lib081_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static bool Lib081_Fn098();
+	/** Benchmark callable node Lib081_Fn099 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib081")
+	static int32 Lib081_Fn099(int32& Out0);
+};
+
+
+UCLASS()
+class UKDGBenchLib_082 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib082_Fn000 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn000(float In0, UObject* In1, FVector& Out2, float In3, FVector& Out4, const FTransform& In5, const FVector& In6, const FVector& In7);
+	/** Benchmark callable node Lib082_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn001(float In0, FName In1, FString& Out2, const FTransform& In3, const FString& In4, const FTransform& In5, const FString& In6);
+	/** Benchmark callable node Lib082_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn002(const TArray< int32 >& In0, int32& Out1);
+	/** Benchmark pure node Lib082_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn003(int32& Out0, bool In1, int32& Out2, const TArray< int32 >& In3, int32& Out4, FName In5);
+	/** Benchmark pure node Lib082_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn004();
+	/** Benchmark pure node Lib082_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn005(int32& Out0, const FString& In1, int32 In2, FString& Out3, const FVector& In4, bool In5, const TArray< int32 >& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib082_Fn006 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn006();
+	/** Benchmark callable node Lib082_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn007(int32& Out0, const TArray< int32 >& In1, FVector& Out2);
+	/** Benchmark pure node Lib082_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn008(const FTransform& In0, bool In1, UObject* In2, FString& Out3, UObject* In4, FVector& Out5);
+	/** Benchmark pure node Lib082_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn009(const FTransform& In0);
+	/** Benchmark callable node Lib082_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn010();
+	/** Benchmark callable node Lib082_Fn011 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn011(const FTransform& In0, UObject* In1, bool In2, bool In3);
+	/** Benchmark callable node Lib082_Fn012 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn012(UObject* In0, const FVector& In1);
+	/** Benchmark callable node Lib082_Fn013 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn013();
+	/** Benchmark pure node Lib082_Fn014 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn014();
+	/** Benchmark callable node Lib082_Fn015 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn015(FString& Out0, FName In1, const FVector& In2, const FTransform& In3);
+	/** Benchmark pure node Lib082_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn016(FString& Out0, float In1, const FVector& In2);
+	/** Benchmark callable node Lib082_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn017(const FString& In0, FVector& Out1, float In2, bool In3);
+	/** Benchmark pure node Lib082_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn018(const FVector& In0, FVector& Out1, FVector& Out2, const FString& In3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark pure node Lib082_Fn019 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn019(int32& Out0);
+	/** Benchmark callable node Lib082_Fn020 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn020(const FTransform& In0, const FVector& In1, const TArray< int32 >& In2, bool In3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib082_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn021(const FString& In0, float In1, const FTransform& In2);
+	/** Benchmark pure node Lib082_Fn022 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn022(bool In0, int32& Out1, int32 In2, const TArray< int32 >& In3, UObject* In4, const FTransform& In5, const FString& In6, int32& Out7);
+	/** Benchmark pure node Lib082_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn023(const FVector& In0);
+	/** Benchmark pure node Lib082_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn024(FName In0, FName In1, const TArray< int32 >& In2, FName In3, const FVector& In4, FString& Out5);
+	/** Benchmark callable node Lib082_Fn025 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn025(int32 In0, const FString& In1, float In2);
+	/** Benchmark callable node Lib082_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn026(int32 In0, int32& Out1, int32& Out2, UObject* In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib082_Fn027 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn027(FVector& Out0, int32& Out1);
+	/** Benchmark callable node Lib082_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn028(FVector& Out0);
+	/** Benchmark callable node Lib082_Fn029 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn029(UObject* In0, FString& Out1);
+	/** Benchmark callable node Lib082_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn030(const FString& In0, const FTransform& In1, int32& Out2, int32 In3, FVector& Out4, FVector& Out5, const FString& In6);
+	/** Benchmark callable node Lib082_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn031(const FTransform& In0, float In1, const FString& In2, int32 In3, const FString& In4);
+	/** Benchmark pure node Lib082_Fn032 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn032(int32 In0, FName In1, int32 In2, int32& Out3, float In4);
+	/** Benchmark callable node Lib082_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn033(FVector& Out0, const FVector& In1, FString& Out2);
+	/** Benchmark callable node Lib082_Fn034 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn034(const FVector& In0, float In1, const FString& In2);
+	/** Benchmark pure node Lib082_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn035(float In0, bool In1, FName In2);
+	/** Benchmark pure node Lib082_Fn036 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn036(int32 In0, FVector& Out1, const FVector& In2, FString& Out3);
+	/** Benchmark pure node Lib082_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn037();
+	/** Benchmark pure node Lib082_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn038(int32 In0, FVector& Out1, const TArray< int32 >& In2, float In3, float In4, const FTransform& In5);
+	/** Benchmark callable node Lib082_Fn039 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn039(const TArray< int32 >& In0, FString& Out1, const FVector& In2, FName In3, FString& Out4, FString& Out5, float In6);
+	/** Benchmark callable node Lib082_Fn040 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn040(const TArray< int32 >& In0, UObject* In1, FName In2, const FTransform& In3, bool In4, const FString& In5, float In6);
+	/** Benchmark pure node Lib082_Fn041 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn041(FVector& Out0, UObject* In1);
+	/** Benchmark latent node Lib082_Fn042 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib082_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark latent node Lib082_Fn043 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib082_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, UObject* In1);
+	/** Benchmark callable node Lib082_Fn044 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn044(UObject* In0, int32& Out1, FName In2, int32 In3);
+	/** Benchmark callable node Lib082_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn045(bool In0);
+	/** Benchmark callable node Lib082_Fn046 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn046(bool In0, FVector& Out1);
+	/** Benchmark callable node Lib082_Fn047 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn047(FVector& Out0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib082_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn048(const TArray< int32 >& In0, const FString& In1, const TArray< int32 >& In2, UObject* In3);
+	/** Benchmark callable node Lib082_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn049(int32 In0, int32& Out1, int32 In2);
+	/** Benchmark pure node Lib082_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn050(UObject* In0, FName In1, const FTransform& In2, const FString& In3, FString& Out4);
+	/** Benchmark callable node Lib082_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn051(int32& Out0, const FVector& In1);
+	/** Benchmark pure node Lib082_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn052(UObject* In0, int32& Out1);
+	/** Benchmark callable node Lib082_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn053(FVector& Out0, FName In1, bool In2, int32 In3);
+	/** Benchmark callable node Lib082_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn054(UObject* In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib082_Fn055 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn055(const TArray< int32 >& In0, float In1, const FString& In2, const FString& In3, int32& Out4, FString& Out5, const FVector& In6);
+	/** Benchmark callable node Lib082_Fn056 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn056(float In0, UObject* In1, const FTransform& In2, int32 In3, const TArray< int32 >& In4);
+	/** Benchmark latent node Lib082_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib082_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FTransform& In1, FVector& Out2, const FVector& In3, FString& Out4, float In5);
+	/** Benchmark callable node Lib082_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn058(const TArray< int32 >& In0, int32 In1, UObject* In2, const TArray< int32 >& In3, const FString& In4, const FTransform& In5);
+	/** Benchmark callable node Lib082_Fn059 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn059(int32 In0, FName In1, const FVector& In2, const TArray< int32 >& In3, FString& Out4);
+	/** Benchmark callable node Lib082_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn060(const FString& In0, int32& Out1, FVector& Out2, const FTransform& In3, FString& Out4, int32& Out5, FVector& Out6, FVector& Out7);
+	/** Benchmark pure node Lib082_Fn061 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn061(FString& Out0, FName In1, const TArray< int32 >& In2, int32& Out3, UObject* In4, const FTransform& In5, const FString& In6, bool In7);
+	/** Benchmark callable node Lib082_Fn062 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn062(FVector& Out0, FName In1, FString& Out2, const FTransform& In3);
+	/** Benchmark latent node Lib082_Fn063 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib082_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1, int32 In2, const FString& In3, const FVector& In4, FVector& Out5);
+	/** Benchmark callable node Lib082_Fn064 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn064(float In0);
+	/** Benchmark pure node Lib082_Fn065 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn065(const TArray< int32 >& In0, const FTransform& In1, const FVector& In2);
+	/** Benchmark callable node Lib082_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn066(float In0, FVector& Out1, const FString& In2, const TArray< int32 >& In3, const FString& In4, FString& Out5, int32 In6);
+	/** Benchmark pure node Lib082_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn067(int32& Out0, const FTransform& In1);
+	/** Benchmark pure node Lib082_Fn068 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn068(const FVector& In0, int32 In1, bool In2, FString& Out3, int32 In4, FVector& Out5, float In6, bool In7);
+	/** Benchmark callable node Lib082_Fn069 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn069(const FTransform& In0, bool In1, float In2, UObject* In3, int32 In4, const FVector& In5, float In6, float In7);
+	/** Benchmark callable node Lib082_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn070(FVector& Out0, const FVector& In1, const FString& In2, int32& Out3, const FString& In4, float In5, int32& Out6);
+	/** Benchmark pure node Lib082_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn071(bool In0, UObject* In1, const FString& In2, FString& Out3, const FVector& In4, FVector& Out5);
+	/** Benchmark pure node Lib082_Fn072 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn072(float In0, FString& Out1, FVector& Out2, float In3, const FString& In4, UObject* In5, const FString& In6, const FVector& In7);
+	/** Benchmark pure node Lib082_Fn073 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn073(FName In0, const FTransform& In1, UObject* In2, const FTransform& In3);
+	/** Benchmark callable node Lib082_Fn074 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn074(const FString& In0, const FString& In1, float In2, bool In3, FString& Out4, const TArray< int32 >& In5, int32& Out6);
+	/** Benchmark callable node Lib082_Fn075 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static bool Lib082_Fn075(const FString& In0, const FVector& In1, const FString& In2);
+	/** Benchmark callable node Lib082_Fn076 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn076(const FTransform& In0, int32 In1, const FTransform& In2, const FTransform& In3, float In4, bool In5, int32 In6, const FVector& In7);
+	/** Benchmark pure node Lib082_Fn077 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn077(const FTransform& In0, float In1);
+	/** Benchmark callable node Lib082_Fn078 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn078(const FTransform& In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib082_Fn079 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn079(const FString& In0, bool In1, const FTransform& In2, int32 In3, int32& Out4, FString& Out5);
+	/** Benchmark pure node Lib082_Fn080 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn080(FName In0, FString& Out1, float In2);
+	/** Benchmark callable node Lib082_Fn081 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn081(bool In0, bool In1, bool In2, UObject* In3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark callable node Lib082_Fn082 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn082(const TArray< int32 >& In0, int32 In1, const FVector& In2, float In3, FName In4, float In5, bool In6, const FVector& In7);
+	/** Benchmark callable node Lib082_Fn083 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn083(const FTransform& In0, int32& Out1, FString& Out2, bool In3, int32& Out4, bool In5, UObject* In6);
+	/** Benchmark callable node Lib082_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn084(const TArray< int32 >& In0, int32 In1, float In2, float In3, int32 In4, const FString& In5, FName In6);
+	/** Benchmark pure node Lib082_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn085();
+	/** Benchmark callable node Lib082_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn086(int32& Out0, const FString& In1, const FString& In2, FName In3, FString& Out4);
+	/** Benchmark callable node Lib082_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn087(FString& Out0);
+	/** Benchmark pure node Lib082_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn088();
+	/** Benchmark callable node Lib082_Fn089 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static void Lib082_Fn089();
+	/** Benchmark callable node Lib082_Fn090 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn090(const FVector& In0, FVector& Out1, float In2, FString& Out3);
+	/** Benchmark pure node Lib082_Fn091 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn091(const FVector& In0);
+	/** Benchmark callable node Lib082_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn092();
+	/** Benchmark callable node Lib082_Fn093 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn093(const TArray< int32 >& In0, FName In1);
+	/** Benchmark callable node Lib082_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static float Lib082_Fn094(const TArray< int32 >& In0, const FTransform& In1);
+	/** Benchmark pure node Lib082_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn095();
+	/** Benchmark pure node Lib082_Fn096 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn096();
+	/** Benchmark callable node Lib082_Fn097 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static FVector Lib082_Fn097(const FVector& In0, bool In1);
+	/** Benchmark pure node Lib082_Fn098 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib082")
+	static FString Lib082_Fn098(bool In0, FString& Out1, float In2);
+	/** Benchmark callable node Lib082_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib082")
+	static int32 Lib082_Fn099(bool In0, FVector& Out1, FString& Out2, const FVector& In3, const TArray< int32 >& In4);
+};
+
+
+UCLASS()
+class UKDGBenchLib_083 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib083_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn000(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib083_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn001(const TArray< int32 >& In0, FName In1, UObject* In2, int32 In3, FString& Out4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib083_Fn002 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn002(float In0);
+	/** Benchmark latent node Lib083_Fn003 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1, FName In2, bool In3, int32& Out4, const FVector& In5, const FString& In6);
+	/** Benchmark callable node Lib083_Fn004 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn004(FString& Out0, const FVector& In1, FVector& Out2, FString& Out3, FString& Out4, UObject* In5, int32 In6, const FString& In7);
+	/** Benchmark callable node Lib083_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn005(const FString& In0, UObject* In1, const FString& In2, FName In3);
+	/** Benchmark latent node Lib083_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib083_Fn007 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn007(const TArray< int32 >& In0, FString& Out1, FString& Out2, FString& Out3, int32& Out4, UObject* In5, int32 In6, bool In7);
+	/** Benchmark callable node Lib083_Fn008 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FVector Lib083_Fn008(const FVector& In0, UObject* In1, FName In2, FString& Out3, const FVector& In4, FString& Out5, int32& Out6);
+	/** Benchmark callable node Lib083_Fn009 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn009();
+	/** Benchmark pure node Lib083_Fn010 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn010();
+	/** Benchmark callable node Lib083_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn011(FName In0, FString& Out1, float In2, UObject* In3, int32 In4, FVector& Out5, bool In6);
+	/** Benchmark pure node Lib083_Fn012 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn012(float In0);
+	/** Benchmark pure node Lib083_Fn013 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn013(bool In0, const FString& In1);
+	/** Benchmark callable node Lib083_Fn014 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn014(const FTransform& In0, FString& Out1, const FVector& In2, bool In3);
+	/** Benchmark callable node Lib083_Fn015 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn015();
+	/** Benchmark callable node Lib083_Fn016 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn016();
+	/** Benchmark callable node Lib083_Fn017 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn017(const TArray< int32 >& In0, const FTransform& In1, FVector& Out2, FString& Out3, const FTransform& In4, UObject* In5);
+	/** Benchmark callable node Lib083_Fn018 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn018(FName In0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3, int32& Out4);
+	/** Benchmark pure node Lib083_Fn019 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn019(const FTransform& In0, UObject* In1, FVector& Out2, const TArray< int32 >& In3, int32 In4, FVector& Out5);
+	/** Benchmark callable node Lib083_Fn020 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn020(int32 In0, const FVector& In1, FString& Out2);
+	/** Benchmark callable node Lib083_Fn021 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FVector Lib083_Fn021(FString& Out0, const FTransform& In1, bool In2);
+	/** Benchmark callable node Lib083_Fn022 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static void Lib083_Fn022(UObject* In0, const FVector& In1, float In2, const FVector& In3, const FTransform& In4, bool In5, const FVector& In6, const FString& In7);
+	/** Benchmark callable node Lib083_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FVector Lib083_Fn023(const FTransform& In0, int32& Out1);
+	/** Benchmark pure node Lib083_Fn024 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn024(const TArray< int32 >& In0, float In1, int32 In2, FString& Out3, FName In4);
+	/** Benchmark callable node Lib083_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn025(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib083_Fn026 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn026(int32 In0);
+	/** Benchmark callable node Lib083_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static void Lib083_Fn027(float In0);
+	/** Benchmark latent node Lib083_Fn028 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib083_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn029(const TArray< int32 >& In0, const FString& In1, FString& Out2);
+	/** Benchmark callable node Lib083_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn030(const FTransform& In0, const FVector& In1, FVector& Out2, UObject* In3, FString& Out4, const TArray< int32 >& In5, const FVector& In6);
+	/** Benchmark latent node Lib083_Fn031 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1, float In2, const FVector& In3, FVector& Out4, int32 In5, bool In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib083_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn032(int32 In0, const FTransform& In1, FName In2);
+	/** Benchmark latent node Lib083_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib083_Fn034 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn034(const TArray< int32 >& In0, float In1, bool In2, float In3, float In4, const TArray< int32 >& In5, float In6, UObject* In7);
+	/** Benchmark pure node Lib083_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn035(FVector& Out0, FVector& Out1, FString& Out2, const FVector& In3, int32& Out4, int32& Out5);
+	/** Benchmark latent node Lib083_Fn036 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FString& Out1, const FVector& In2, const FVector& In3, int32& Out4, FString& Out5, int32& Out6);
+	/** Benchmark callable node Lib083_Fn037 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn037(FString& Out0);
+	/** Benchmark callable node Lib083_Fn038 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FVector Lib083_Fn038(const FTransform& In0, const FVector& In1);
+	/** Benchmark callable node Lib083_Fn039 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn039(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib083_Fn040 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn040(UObject* In0);
+	/** Benchmark callable node Lib083_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static void Lib083_Fn041(const FTransform& In0, const FVector& In1, int32& Out2, const FVector& In3);
+	/** Benchmark pure node Lib083_Fn042 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn042(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib083_Fn043 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn043(UObject* In0, FVector& Out1, bool In2);
+	/** Benchmark latent node Lib083_Fn044 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32 In1, FVector& Out2, FVector& Out3);
+	/** Benchmark latent node Lib083_Fn045 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, const TArray< int32 >& In2, bool In3, int32& Out4, float In5, int32 In6);
+	/** Benchmark callable node Lib083_Fn046 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn046(const FTransform& In0, bool In1, int32 In2, int32& Out3, const FString& In4);
+	/** Benchmark pure node Lib083_Fn047 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn047(FString& Out0, float In1, UObject* In2, FString& Out3, FString& Out4, const FString& In5);
+	/** Benchmark pure node Lib083_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn048(const FString& In0, FString& Out1, float In2, FName In3, const FString& In4, const FVector& In5, const FString& In6);
+	/** Benchmark callable node Lib083_Fn049 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn049(FName In0, float In1, FString& Out2, int32& Out3, const TArray< int32 >& In4, bool In5, FVector& Out6);
+	/** Benchmark pure node Lib083_Fn050 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static FVector Lib083_Fn050(FName In0, int32 In1);
+	/** Benchmark callable node Lib083_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn051(FString& Out0);
+	/** Benchmark callable node Lib083_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn052(float In0, float In1, FVector& Out2);
+	/** Benchmark callable node Lib083_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn053(const FString& In0, FName In1, int32& Out2, FName In3);
+	/** Benchmark callable node Lib083_Fn054 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn054(float In0, FName In1, bool In2, float In3, const TArray< int32 >& In4, UObject* In5);
+	/** Benchmark pure node Lib083_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn055(const TArray< int32 >& In0, const FTransform& In1);
+	/** Benchmark callable node Lib083_Fn056 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn056(float In0);
+	/** Benchmark pure node Lib083_Fn057 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn057(FVector& Out0, UObject* In1, UObject* In2, const FVector& In3, float In4, bool In5, int32& Out6, const FString& In7);
+	/** Benchmark callable node Lib083_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static void Lib083_Fn058(float In0, int32& Out1, const FString& In2, const FVector& In3, int32 In4);
+	/** Benchmark pure node Lib083_Fn059 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn059(int32& Out0, FVector& Out1, const FString& In2, bool In3, UObject* In4);
+	/** Benchmark latent node Lib083_Fn060 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn060(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, FVector& Out2, FName In3, FString& Out4, UObject* In5, float In6, float In7);
+	/** Benchmark callable node Lib083_Fn061 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn061();
+	/** Benchmark callable node Lib083_Fn062 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn062(FVector& Out0);
+	/** Benchmark callable node Lib083_Fn063 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn063(FString& Out0, bool In1, const FString& In2);
+	/** Benchmark pure node Lib083_Fn064 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn064(float In0, UObject* In1, bool In2, FString& Out3, FVector& Out4);
+	/** Benchmark callable node Lib083_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static void Lib083_Fn065(float In0, FVector& Out1);
+	/** Benchmark pure node Lib083_Fn066 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn066(const FTransform& In0, const FTransform& In1, float In2, const FVector& In3);
+	/** Benchmark callable node Lib083_Fn067 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn067(float In0, UObject* In1, int32& Out2, const FTransform& In3, const FVector& In4, const FVector& In5, int32& Out6, const FVector& In7);
+	/** Benchmark callable node Lib083_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn068(const FVector& In0, const TArray< int32 >& In1, int32& Out2, const TArray< int32 >& In3, FName In4);
+	/** Benchmark pure node Lib083_Fn069 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static FVector Lib083_Fn069(const FString& In0);
+	/** Benchmark callable node Lib083_Fn070 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn070(const FTransform& In0, UObject* In1, int32 In2);
+	/** Benchmark callable node Lib083_Fn071 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn071(FVector& Out0, UObject* In1, const FTransform& In2, FString& Out3, FVector& Out4, const FString& In5, UObject* In6, const FTransform& In7);
+	/** Benchmark callable node Lib083_Fn072 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn072(int32& Out0, int32& Out1, int32 In2);
+	/** Benchmark pure node Lib083_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn073(const FTransform& In0, FName In1, float In2);
+	/** Benchmark callable node Lib083_Fn074 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn074(float In0);
+	/** Benchmark callable node Lib083_Fn075 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn075(FString& Out0);
+	/** Benchmark callable node Lib083_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn076(int32 In0, float In1, FVector& Out2, FName In3);
+	/** Benchmark callable node Lib083_Fn077 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn077(int32& Out0, FString& Out1, FName In2, const FString& In3, FVector& Out4, const FVector& In5, FString& Out6, FVector& Out7);
+	/** Benchmark callable node Lib083_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn078(int32& Out0, FString& Out1, UObject* In2, int32& Out3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib083_Fn079 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn079(bool In0, const FTransform& In1, const FVector& In2, FVector& Out3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib083_Fn080 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn080(int32& Out0);
+	/** Benchmark callable node Lib083_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn081();
+	/** Benchmark latent node Lib083_Fn082 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn082(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, float In1);
+	/** Benchmark callable node Lib083_Fn083 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn083();
+	/** Benchmark pure node Lib083_Fn084 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn084(const FTransform& In0, UObject* In1, const FTransform& In2);
+	/** Benchmark callable node Lib083_Fn085 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static FVector Lib083_Fn085(FName In0, FName In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib083_Fn086 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn086(FVector& Out0, bool In1, const FVector& In2, const FString& In3);
+	/** Benchmark callable node Lib083_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn087(const FString& In0, const TArray< int32 >& In1, UObject* In2, FName In3, bool In4, const FString& In5, const FVector& In6);
+	/** Benchmark callable node Lib083_Fn088 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static void Lib083_Fn088();
+	/** Benchmark callable node Lib083_Fn089 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn089(FString& Out0, const FTransform& In1);
+	/** Benchmark callable node Lib083_Fn090 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn090();
+	/** Benchmark pure node Lib083_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn091(const TArray< int32 >& In0, FString& Out1, int32 In2, FString& Out3, const FString& In4);
+	/** Benchmark callable node Lib083_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static void Lib083_Fn092(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib083_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn093(float In0, int32& Out1, const FTransform& In2, UObject* In3);
+	/** Benchmark pure node Lib083_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static FString Lib083_Fn094(FName In0, UObject* In1, const FString& In2, FName In3);
+	/** Benchmark callable node Lib083_Fn095 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static bool Lib083_Fn095(const FVector& In0);
+	/** Benchmark pure node Lib083_Fn096 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib083")
+	static int32 Lib083_Fn096();
+	/** Benchmark callable node Lib083_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn097(FString& Out0, int32& Out1, const FVector& In2, FString& Out3, float In4, FVector& Out5, bool In6);
+	/** Benchmark callable node Lib083_Fn098 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083")
+	static float Lib083_Fn098(FString& Out0, const TArray< int32 >& In1, int32& Out2, int32 In3, FName In4, const FString& In5);
+	/** Benchmark latent node Lib083_Fn099 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib083", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib083_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32 In1, bool In2);
+};
+
+
+UCLASS()
+class UKDGBenchLib_084 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib084_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn000(const TArray< int32 >& In0, FVector& Out1, int32& Out2);
+	/** Benchmark latent node Lib084_Fn001 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, float In1, FVector& Out2, bool In3);
+	/** Benchmark callable node Lib084_Fn002 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn002(const FString& In0, int32 In1);
+	/** Benchmark pure node Lib084_Fn003 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn003(FString& Out0, const FString& In1, float In2, const FTransform& In3, FName In4, const FString& In5);
+	/** Benchmark callable node Lib084_Fn004 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn004(float In0, int32& Out1, int32& Out2);
+	/** Benchmark callable node Lib084_Fn005 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn005(const TArray< int32 >& In0, const FVector& In1, float In2, FString& Out3, FName In4, const FVector& In5);
+	/** Benchmark latent node Lib084_Fn006 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32& Out1, int32 In2, int32 In3, const FString& In4, int32& Out5);
+	/** Benchmark latent node Lib084_Fn007 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib084_Fn008 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn008(FVector& Out0, FVector& Out1, int32& Out2, FString& Out3, UObject* In4, FString& Out5, float In6, FName In7);
+	/** Benchmark pure node Lib084_Fn009 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn009(bool In0, FName In1, const FVector& In2, UObject* In3, int32& Out4, float In5);
+	/** Benchmark pure node Lib084_Fn010 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn010(UObject* In0, const FString& In1, bool In2);
+	/** Benchmark callable node Lib084_Fn011 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn011(float In0, const FVector& In1, const FVector& In2, UObject* In3, const FString& In4, const FTransform& In5);
+	/** Benchmark callable node Lib084_Fn012 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn012(const FString& In0, const FVector& In1, const FVector& In2, FString& Out3, FString& Out4, const FTransform& In5);
+	/** Benchmark pure node Lib084_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn013(FVector& Out0, float In1, int32& Out2, UObject* In3, FVector& Out4);
+	/** Benchmark callable node Lib084_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn014(int32 In0, const FVector& In1, bool In2, const TArray< int32 >& In3, bool In4);
+	/** Benchmark pure node Lib084_Fn015 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn015(const FString& In0, const FString& In1);
+	/** Benchmark callable node Lib084_Fn016 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn016(UObject* In0, const TArray< int32 >& In1, float In2, const TArray< int32 >& In3);
+	/** Benchmark latent node Lib084_Fn017 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn017(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FString& Out1, const FString& In2, FVector& Out3, FName In4, FName In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib084_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn018(const FString& In0, float In1, const FTransform& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, float In5);
+	/** Benchmark callable node Lib084_Fn019 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn019(FVector& Out0);
+	/** Benchmark pure node Lib084_Fn020 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn020(bool In0, const TArray< int32 >& In1, const FString& In2, FVector& Out3, UObject* In4);
+	/** Benchmark pure node Lib084_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn021(FVector& Out0, const FVector& In1, FString& Out2, UObject* In3, const TArray< int32 >& In4, int32& Out5);
+	/** Benchmark pure node Lib084_Fn022 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn022(const FTransform& In0, const FTransform& In1, const FVector& In2, const FVector& In3, FVector& Out4, FVector& Out5);
+	/** Benchmark pure node Lib084_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn023(const FString& In0);
+	/** Benchmark pure node Lib084_Fn024 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn024(FName In0, FString& Out1, bool In2, int32& Out3, int32& Out4);
+	/** Benchmark callable node Lib084_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn025(FName In0);
+	/** Benchmark callable node Lib084_Fn026 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn026(const FVector& In0, FString& Out1, const FString& In2);
+	/** Benchmark callable node Lib084_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn027(UObject* In0, bool In1, UObject* In2);
+	/** Benchmark pure node Lib084_Fn028 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn028(FString& Out0, FString& Out1, const TArray< int32 >& In2, FString& Out3, const FString& In4, const FString& In5, int32 In6, float In7);
+	/** Benchmark callable node Lib084_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn029(UObject* In0, const FTransform& In1, const FTransform& In2);
+	/** Benchmark pure node Lib084_Fn030 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn030(const TArray< int32 >& In0, float In1, const TArray< int32 >& In2, FName In3, const FString& In4, FName In5);
+	/** Benchmark pure node Lib084_Fn031 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn031();
+	/** Benchmark callable node Lib084_Fn032 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn032(FName In0, int32 In1, FVector& Out2, FName In3, const FTransform& In4, const FString& In5, UObject* In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib084_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn033(float In0, int32 In1, int32& Out2);
+	/** Benchmark callable node Lib084_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn034(UObject* In0, FString& Out1, bool In2, const FTransform& In3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib084_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn035(const FVector& In0, bool In1, FVector& Out2);
+	/** Benchmark callable node Lib084_Fn036 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn036(FVector& Out0);
+	/** Benchmark callable node Lib084_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn037(const FTransform& In0, FString& Out1, const FString& In2, const FString& In3, FString& Out4, bool In5, FString& Out6);
+	/** Benchmark callable node Lib084_Fn038 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn038(const FVector& In0, const TArray< int32 >& In1, const FVector& In2, int32& Out3, const FTransform& In4, int32 In5);
+	/** Benchmark pure node Lib084_Fn039 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn039();
+	/** Benchmark callable node Lib084_Fn040 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn040(bool In0, FVector& Out1, float In2, int32 In3, int32 In4, const FString& In5, UObject* In6);
+	/** Benchmark callable node Lib084_Fn041 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn041(const FVector& In0, const FString& In1, const FString& In2, UObject* In3, float In4, float In5, int32 In6, int32 In7);
+	/** Benchmark callable node Lib084_Fn042 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn042(FString& Out0, int32 In1, const FVector& In2, bool In3, float In4, FVector& Out5, FString& Out6, const FString& In7);
+	/** Benchmark callable node Lib084_Fn043 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn043(const FTransform& In0, bool In1, FVector& Out2, const FVector& In3, const FString& In4, FVector& Out5);
+	/** Benchmark callable node Lib084_Fn044 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn044(const FTransform& In0, bool In1, float In2, FName In3);
+	/** Benchmark latent node Lib084_Fn045 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark latent node Lib084_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn046(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, const TArray< int32 >& In2, UObject* In3, FVector& Out4, FName In5);
+	/** Benchmark callable node Lib084_Fn047 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn047(const FTransform& In0, FString& Out1, const FString& In2, FName In3, const FString& In4);
+	/** Benchmark latent node Lib084_Fn048 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn048(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib084_Fn049 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn049(const FString& In0, const TArray< int32 >& In1, const FTransform& In2, FName In3, const TArray< int32 >& In4, int32 In5, FVector& Out6, bool In7);
+	/** Benchmark callable node Lib084_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn050(FName In0, int32& Out1, const TArray< int32 >& In2, int32& Out3, float In4);
+	/** Benchmark pure node Lib084_Fn051 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn051(const FString& In0);
+	/** Benchmark callable node Lib084_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn052(FName In0, FName In1);
+	/** Benchmark callable node Lib084_Fn053 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn053(const FString& In0, FVector& Out1, const FTransform& In2, FString& Out3);
+	/** Benchmark pure node Lib084_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn054(const FTransform& In0, const FTransform& In1);
+	/** Benchmark callable node Lib084_Fn055 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn055(const TArray< int32 >& In0, int32& Out1, FString& Out2, int32& Out3, FVector& Out4);
+	/** Benchmark callable node Lib084_Fn056 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn056(const FString& In0);
+	/** Benchmark callable node Lib084_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn057();
+	/** Benchmark callable node Lib084_Fn058 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn058(const FVector& In0, int32 In1, bool In2, const FString& In3, float In4, FVector& Out5);
+	/** Benchmark callable node Lib084_Fn059 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn059(int32 In0, const FString& In1, bool In2, const FVector& In3, UObject* In4, int32& Out5, FVector& Out6, UObject* In7);
+	/** Benchmark callable node Lib084_Fn060 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn060(int32& Out0);
+	/** Benchmark callable node Lib084_Fn061 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn061(float In0, float In1, const TArray< int32 >& In2, int32 In3, const FTransform& In4);
+	/** Benchmark callable node Lib084_Fn062 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn062(float In0, bool In1);
+	/** Benchmark callable node Lib084_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn063(FVector& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, int32 In3);
+	/** Benchmark callable node Lib084_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn064(const FVector& In0, float In1, FName In2, UObject* In3, FName In4, FName In5, float In6);
+	/** Benchmark callable node Lib084_Fn065 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn065(FVector& Out0, const FTransform& In1);
+	/** Benchmark callable node Lib084_Fn066 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn066();
+	/** Benchmark pure node Lib084_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn067(int32& Out0);
+	/** Benchmark latent node Lib084_Fn068 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FString& Out1, FVector& Out2, FName In3, FName In4, float In5, FVector& Out6);
+	/** Benchmark callable node Lib084_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn069(FName In0, const FVector& In1);
+	/** Benchmark pure node Lib084_Fn070 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn070(bool In0, bool In1, const TArray< int32 >& In2, const FTransform& In3, FString& Out4, FString& Out5, int32& Out6);
+	/** Benchmark pure node Lib084_Fn071 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn071(float In0, FName In1, UObject* In2);
+	/** Benchmark callable node Lib084_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn072();
+	/** Benchmark pure node Lib084_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn073(FVector& Out0, FString& Out1, int32 In2, float In3, const TArray< int32 >& In4);
+	/** Benchmark callable node Lib084_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn074(int32 In0, const FVector& In1, FVector& Out2, FVector& Out3, int32& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib084_Fn075 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn075(const FTransform& In0, const TArray< int32 >& In1, int32& Out2, bool In3, FName In4, float In5);
+	/** Benchmark pure node Lib084_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn076(FVector& Out0, const TArray< int32 >& In1, UObject* In2, FName In3);
+	/** Benchmark pure node Lib084_Fn077 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn077(float In0, FString& Out1, const FTransform& In2, const FString& In3, FString& Out4, int32& Out5);
+	/** Benchmark callable node Lib084_Fn078 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn078();
+	/** Benchmark callable node Lib084_Fn079 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn079(float In0, const FVector& In1, FVector& Out2, FString& Out3, const FString& In4);
+	/** Benchmark callable node Lib084_Fn080 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn080(FString& Out0);
+	/** Benchmark callable node Lib084_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FString Lib084_Fn081();
+	/** Benchmark callable node Lib084_Fn082 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn082();
+	/** Benchmark pure node Lib084_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn083(const FTransform& In0, const FVector& In1);
+	/** Benchmark pure node Lib084_Fn084 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn084(const FVector& In0, const FTransform& In1, const TArray< int32 >& In2, int32& Out3, int32 In4);
+	/** Benchmark pure node Lib084_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn085(float In0, const TArray< int32 >& In1, bool In2, int32 In3, FVector& Out4, const FTransform& In5, int32& Out6);
+	/** Benchmark callable node Lib084_Fn086 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn086(FString& Out0);
+	/** Benchmark callable node Lib084_Fn087 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn087(int32 In0, const FString& In1, const FVector& In2, const FTransform& In3, FVector& Out4, float In5, float In6);
+	/** Benchmark callable node Lib084_Fn088 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static bool Lib084_Fn088(const FString& In0, const FTransform& In1, UObject* In2, const FTransform& In3, FVector& Out4, FName In5, const FVector& In6, int32 In7);
+	/** Benchmark callable node Lib084_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn089(bool In0, int32 In1, const FVector& In2, UObject* In3);
+	/** Benchmark callable node Lib084_Fn090 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn090(int32 In0, const FTransform& In1, int32& Out2, FString& Out3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib084_Fn091 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn091(UObject* In0, int32& Out1);
+	/** Benchmark callable node Lib084_Fn092 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static int32 Lib084_Fn092(FString& Out0, bool In1, int32 In2);
+	/** Benchmark callable node Lib084_Fn093 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn093(const FTransform& In0, FString& Out1, int32 In2, FName In3);
+	/** Benchmark callable node Lib084_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static float Lib084_Fn094(const FTransform& In0, bool In1, const FTransform& In2, FVector& Out3, const FString& In4, const TArray< int32 >& In5, UObject* In6, const FTransform& In7);
+	/** Benchmark callable node Lib084_Fn095 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn095();
+	/** Benchmark callable node Lib084_Fn096 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static void Lib084_Fn096();
+	/** Benchmark latent node Lib084_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, FString& Out2, UObject* In3, FVector& Out4);
+	/** Benchmark callable node Lib084_Fn098 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084")
+	static FVector Lib084_Fn098(int32 In0, const FString& In1, int32& Out2, const FTransform& In3);
+	/** Benchmark latent node Lib084_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib084", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib084_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_085 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib085_Fn000 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn000(const FVector& In0, const TArray< int32 >& In1, const FVector& In2);
+	/** Benchmark callable node Lib085_Fn001 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn001(FName In0, const FVector& In1);
+	/** Benchmark callable node Lib085_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn002(int32 In0, const FVector& In1, int32& Out2, const FVector& In3, const FTransform& In4);
+	/** Benchmark callable node Lib085_Fn003 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn003(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib085_Fn004 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn004(const FTransform& In0, const FVector& In1, UObject* In2, int32& Out3);
+	/** Benchmark pure node Lib085_Fn005 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn005(bool In0, const TArray< int32 >& In1, const FVector& In2, float In3, UObject* In4, float In5, const FString& In6, int32& Out7);
+	/** Benchmark callable node Lib085_Fn006 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn006(const FVector& In0, const FVector& In1);
+	/** Benchmark latent node Lib085_Fn007 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FString& In1);
+	/** Benchmark callable node Lib085_Fn008 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn008(const FVector& In0, const FString& In1, FVector& Out2);
+	/** Benchmark callable node Lib085_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn009(UObject* In0);
+	/** Benchmark callable node Lib085_Fn010 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn010(int32 In0, FVector& Out1);
+	/** Benchmark pure node Lib085_Fn011 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn011(float In0, FVector& Out1, const FString& In2, const FTransform& In3, const FString& In4, const FTransform& In5, int32& Out6);
+	/** Benchmark pure node Lib085_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn012(int32 In0, const FString& In1, FString& Out2, int32& Out3, const FString& In4, int32 In5, FName In6, float In7);
+	/** Benchmark pure node Lib085_Fn013 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn013(const FString& In0, const TArray< int32 >& In1, FString& Out2, FString& Out3, int32 In4);
+	/** Benchmark callable node Lib085_Fn014 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn014(int32& Out0, const FString& In1, FVector& Out2, int32& Out3, UObject* In4);
+	/** Benchmark callable node Lib085_Fn015 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn015();
+	/** Benchmark callable node Lib085_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn016(int32& Out0, float In1, FVector& Out2, FVector& Out3, const FString& In4, UObject* In5);
+	/** Benchmark callable node Lib085_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn017(bool In0);
+	/** Benchmark latent node Lib085_Fn018 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn018(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FString& Out1, const FTransform& In2, const FTransform& In3, float In4, FName In5);
+	/** Benchmark callable node Lib085_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn019(UObject* In0, const FVector& In1, const FString& In2, FVector& Out3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib085_Fn020 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn020(const TArray< int32 >& In0, const FString& In1, const FString& In2, FVector& Out3, int32 In4, FName In5, const FVector& In6);
+	/** Benchmark callable node Lib085_Fn021 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn021(float In0, UObject* In1, const TArray< int32 >& In2, UObject* In3, const FTransform& In4);
+	/** Benchmark pure node Lib085_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn022(const TArray< int32 >& In0, UObject* In1, FVector& Out2, const FTransform& In3, float In4, UObject* In5, const FString& In6);
+	/** Benchmark callable node Lib085_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn023(const TArray< int32 >& In0, bool In1);
+	/** Benchmark callable node Lib085_Fn024 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn024(const FVector& In0, FName In1);
+	/** Benchmark pure node Lib085_Fn025 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn025(float In0, int32& Out1, float In2, UObject* In3);
+	/** Benchmark callable node Lib085_Fn026 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn026(int32& Out0);
+	/** Benchmark callable node Lib085_Fn027 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn027(bool In0);
+	/** Benchmark callable node Lib085_Fn028 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn028(const FString& In0, bool In1, FName In2, UObject* In3, const FVector& In4, const FString& In5, const TArray< int32 >& In6, int32 In7);
+	/** Benchmark pure node Lib085_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn029(UObject* In0);
+	/** Benchmark latent node Lib085_Fn030 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib085_Fn031 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn031(const FTransform& In0, FName In1);
+	/** Benchmark callable node Lib085_Fn032 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn032();
+	/** Benchmark callable node Lib085_Fn033 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn033(bool In0, int32& Out1, int32& Out2, float In3);
+	/** Benchmark pure node Lib085_Fn034 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn034(FVector& Out0, const FVector& In1, const FTransform& In2, int32 In3);
+	/** Benchmark callable node Lib085_Fn035 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn035(const FVector& In0, FString& Out1);
+	/** Benchmark callable node Lib085_Fn036 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn036(const TArray< int32 >& In0, bool In1, bool In2, float In3, const FVector& In4);
+	/** Benchmark callable node Lib085_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn037(const FVector& In0, FString& Out1, FName In2, UObject* In3, bool In4, const TArray< int32 >& In5, FName In6);
+	/** Benchmark callable node Lib085_Fn038 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn038();
+	/** Benchmark callable node Lib085_Fn039 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn039(FName In0, const FTransform& In1, int32& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib085_Fn040 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn040(bool In0, float In1, int32 In2, FName In3);
+	/** Benchmark callable node Lib085_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn041(bool In0, int32& Out1, const TArray< int32 >& In2, const FVector& In3);
+	/** Benchmark latent node Lib085_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib085_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn043(int32 In0, const FString& In1, float In2, int32 In3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib085_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn044(FName In0, const FVector& In1, int32 In2, bool In3, FVector& Out4, const FVector& In5, FString& Out6, float In7);
+	/** Benchmark callable node Lib085_Fn045 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn045(const FTransform& In0, FVector& Out1, int32& Out2, FString& Out3, FString& Out4, float In5, UObject* In6);
+	/** Benchmark callable node Lib085_Fn046 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn046(const FTransform& In0, int32& Out1, FVector& Out2, const FString& In3, UObject* In4);
+	/** Benchmark pure node Lib085_Fn047 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn047();
+	/** Benchmark pure node Lib085_Fn048 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn048(int32& Out0, FString& Out1);
+	/** Benchmark pure node Lib085_Fn049 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn049(UObject* In0, UObject* In1, FName In2, FVector& Out3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib085_Fn050 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn050(FString& Out0, FString& Out1, const FVector& In2, const FTransform& In3);
+	/** Benchmark callable node Lib085_Fn051 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn051(const TArray< int32 >& In0, FString& Out1, const FVector& In2, int32& Out3, const FString& In4, const FString& In5, int32 In6, int32& Out7);
+	/** Benchmark callable node Lib085_Fn052 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn052(bool In0, int32 In1, UObject* In2, float In3);
+	/** Benchmark callable node Lib085_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn053(bool In0, const TArray< int32 >& In1, const FVector& In2, float In3, int32& Out4, FName In5);
+	/** Benchmark callable node Lib085_Fn054 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn054();
+	/** Benchmark callable node Lib085_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn055();
+	/** Benchmark pure node Lib085_Fn056 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn056(const FVector& In0, int32 In1);
+	/** Benchmark pure node Lib085_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn057(bool In0, int32 In1, const FString& In2, FString& Out3, FVector& Out4, const FVector& In5, UObject* In6);
+	/** Benchmark callable node Lib085_Fn058 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn058(float In0, const FVector& In1, int32 In2, int32& Out3, const FTransform& In4);
+	/** Benchmark latent node Lib085_Fn059 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, float In1, const FString& In2, const FVector& In3, int32 In4);
+	/** Benchmark callable node Lib085_Fn060 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn060(FVector& Out0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib085_Fn061 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn061(const FString& In0, bool In1, int32& Out2, const TArray< int32 >& In3, FVector& Out4, const FString& In5);
+	/** Benchmark pure node Lib085_Fn062 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn062(const TArray< int32 >& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, FVector& Out3, FVector& Out4, int32 In5);
+	/** Benchmark callable node Lib085_Fn063 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn063(const TArray< int32 >& In0, const FTransform& In1, bool In2, const FTransform& In3, bool In4, UObject* In5);
+	/** Benchmark pure node Lib085_Fn064 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn064(const FVector& In0, FString& Out1, float In2, FString& Out3, FName In4, FString& Out5, const FString& In6);
+	/** Benchmark callable node Lib085_Fn065 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn065(UObject* In0, FName In1, FName In2);
+	/** Benchmark pure node Lib085_Fn066 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn066(const TArray< int32 >& In0, int32 In1);
+	/** Benchmark pure node Lib085_Fn067 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn067(FName In0);
+	/** Benchmark latent node Lib085_Fn068 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, const FTransform& In2, bool In3, UObject* In4, UObject* In5, const FVector& In6, bool In7);
+	/** Benchmark pure node Lib085_Fn069 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FVector Lib085_Fn069(const FString& In0, FVector& Out1, const TArray< int32 >& In2, FString& Out3, FString& Out4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib085_Fn070 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn070(float In0, const FVector& In1, const FTransform& In2, FName In3);
+	/** Benchmark callable node Lib085_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn071(float In0, FVector& Out1, int32 In2, bool In3, const FString& In4, bool In5);
+	/** Benchmark callable node Lib085_Fn072 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn072(const FTransform& In0, const FTransform& In1, int32& Out2);
+	/** Benchmark pure node Lib085_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn073(const FVector& In0, int32& Out1, FName In2, UObject* In3, UObject* In4, int32& Out5, FName In6, int32& Out7);
+	/** Benchmark callable node Lib085_Fn074 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn074(const FTransform& In0, int32& Out1, FVector& Out2, const FTransform& In3, float In4);
+	/** Benchmark pure node Lib085_Fn075 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn075(int32& Out0);
+	/** Benchmark callable node Lib085_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn076(int32 In0, bool In1, bool In2, FName In3);
+	/** Benchmark callable node Lib085_Fn077 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn077(FVector& Out0, FVector& Out1, int32& Out2, int32& Out3, FString& Out4, int32& Out5);
+	/** Benchmark callable node Lib085_Fn078 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn078(FString& Out0, FName In1, bool In2, const FString& In3, int32 In4);
+	/** Benchmark pure node Lib085_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn079();
+	/** Benchmark pure node Lib085_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static FString Lib085_Fn080(const FVector& In0, const FVector& In1, FName In2, const FTransform& In3);
+	/** Benchmark callable node Lib085_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn081();
+	/** Benchmark pure node Lib085_Fn082 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn082(const TArray< int32 >& In0, int32& Out1);
+	/** Benchmark callable node Lib085_Fn083 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static void Lib085_Fn083(UObject* In0, int32 In1);
+	/** Benchmark pure node Lib085_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn084(FVector& Out0, int32 In1, int32 In2, FVector& Out3, const FVector& In4, int32 In5, bool In6);
+	/** Benchmark latent node Lib085_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn085(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, float In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32 In4);
+	/** Benchmark pure node Lib085_Fn086 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn086(const FTransform& In0, const FVector& In1);
+	/** Benchmark callable node Lib085_Fn087 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn087(FString& Out0, FString& Out1, int32& Out2, UObject* In3, int32& Out4);
+	/** Benchmark pure node Lib085_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static int32 Lib085_Fn088(FName In0, const FString& In1, const FVector& In2);
+	/** Benchmark callable node Lib085_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn089(const FTransform& In0, FString& Out1, const FString& In2, UObject* In3, FVector& Out4, UObject* In5);
+	/** Benchmark callable node Lib085_Fn090 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn090(const FVector& In0, FName In1, FName In2, int32& Out3, const FString& In4, FString& Out5, bool In6, float In7);
+	/** Benchmark pure node Lib085_Fn091 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn091(FVector& Out0, const FTransform& In1, int32& Out2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib085_Fn092 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn092(const TArray< int32 >& In0, FName In1, const FVector& In2, const FString& In3, const TArray< int32 >& In4, int32& Out5);
+	/** Benchmark callable node Lib085_Fn093 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn093();
+	/** Benchmark callable node Lib085_Fn094 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn094(bool In0, int32 In1);
+	/** Benchmark callable node Lib085_Fn095 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn095(FVector& Out0, FVector& Out1, float In2, const FVector& In3);
+	/** Benchmark pure node Lib085_Fn096 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib085")
+	static float Lib085_Fn096(FName In0, const FString& In1, const TArray< int32 >& In2, FVector& Out3);
+	/** Benchmark callable node Lib085_Fn097 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn097(float In0, FName In1, int32& Out2, float In3, const FString& In4);
+	/** Benchmark latent node Lib085_Fn098 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib085_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FString& Out1, const FVector& In2, const TArray< int32 >& In3, FName In4, const FTransform& In5, const FTransform& In6);
+	/** Benchmark callable node Lib085_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib085")
+	static bool Lib085_Fn099(FName In0, const FTransform& In1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_086 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib086_Fn000 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn000(const FTransform& In0);
+	/** Benchmark pure node Lib086_Fn001 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn001();
+	/** Benchmark callable node Lib086_Fn002 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn002(int32 In0, int32 In1, int32 In2, FName In3);
+	/** Benchmark callable node Lib086_Fn003 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn003(FVector& Out0, float In1, float In2, bool In3);
+	/** Benchmark pure node Lib086_Fn004 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn004(const FVector& In0);
+	/** Benchmark callable node Lib086_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn005(FName In0, int32& Out1, const FVector& In2, bool In3);
+	/** Benchmark pure node Lib086_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn006(const FVector& In0, UObject* In1, int32 In2, const FString& In3);
+	/** Benchmark callable node Lib086_Fn007 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn007(int32& Out0, const FTransform& In1, float In2, const TArray< int32 >& In3, float In4, const FString& In5, FName In6);
+	/** Benchmark pure node Lib086_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn008(UObject* In0, const TArray< int32 >& In1, int32 In2, const FTransform& In3, int32& Out4, float In5);
+	/** Benchmark callable node Lib086_Fn009 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn009(UObject* In0, int32 In1);
+	/** Benchmark callable node Lib086_Fn010 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn010(const FTransform& In0, int32 In1, float In2, const FString& In3, float In4, FName In5, bool In6);
+	/** Benchmark latent node Lib086_Fn011 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib086_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1, FVector& Out2);
+	/** Benchmark callable node Lib086_Fn012 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn012(const FVector& In0, const FTransform& In1, const FVector& In2);
+	/** Benchmark callable node Lib086_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn013(const FTransform& In0, bool In1, bool In2, float In3, const FTransform& In4, const FTransform& In5);
+	/** Benchmark callable node Lib086_Fn014 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn014(bool In0, FString& Out1, FString& Out2);
+	/** Benchmark callable node Lib086_Fn015 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn015(FString& Out0, int32 In1, UObject* In2, bool In3, float In4, FName In5, const TArray< int32 >& In6);
+	/** Benchmark latent node Lib086_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib086_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark callable node Lib086_Fn017 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn017(int32 In0);
+	/** Benchmark pure node Lib086_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn018(const FTransform& In0);
+	/** Benchmark callable node Lib086_Fn019 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn019(FString& Out0, int32 In1);
+	/** Benchmark callable node Lib086_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn020(int32 In0);
+	/** Benchmark pure node Lib086_Fn021 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn021();
+	/** Benchmark callable node Lib086_Fn022 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn022(float In0, float In1);
+	/** Benchmark latent node Lib086_Fn023 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib086_Fn023(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, UObject* In2, bool In3, bool In4, UObject* In5, const FTransform& In6);
+	/** Benchmark pure node Lib086_Fn024 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn024(const FVector& In0, int32& Out1, UObject* In2, FName In3, FName In4, UObject* In5, UObject* In6, const FString& In7);
+	/** Benchmark pure node Lib086_Fn025 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn025(FName In0, const TArray< int32 >& In1, FString& Out2, const FTransform& In3, const TArray< int32 >& In4, const FString& In5);
+	/** Benchmark pure node Lib086_Fn026 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn026(const FTransform& In0, const FString& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib086_Fn027 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn027(int32 In0, int32& Out1, int32& Out2, FVector& Out3, FVector& Out4);
+	/** Benchmark latent node Lib086_Fn028 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib086_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, FVector& Out1);
+	/** Benchmark callable node Lib086_Fn029 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn029(UObject* In0);
+	/** Benchmark callable node Lib086_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn030(const FString& In0, FVector& Out1, bool In2, FString& Out3, const FTransform& In4, FVector& Out5, UObject* In6, int32& Out7);
+	/** Benchmark callable node Lib086_Fn031 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn031(bool In0, FVector& Out1, const FVector& In2, const TArray< int32 >& In3, FVector& Out4);
+	/** Benchmark callable node Lib086_Fn032 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn032(const FString& In0, float In1, int32 In2);
+	/** Benchmark latent node Lib086_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib086_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, int32& Out2);
+	/** Benchmark pure node Lib086_Fn034 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn034(int32& Out0);
+	/** Benchmark pure node Lib086_Fn035 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn035(FVector& Out0, UObject* In1, FVector& Out2, float In3, FName In4, const FString& In5);
+	/** Benchmark pure node Lib086_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn036(FString& Out0, FVector& Out1, bool In2, bool In3, const FString& In4, const FTransform& In5, const FString& In6, const FString& In7);
+	/** Benchmark callable node Lib086_Fn037 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn037(FVector& Out0, const FVector& In1, const FString& In2, const FVector& In3, UObject* In4, const TArray< int32 >& In5, const FVector& In6);
+	/** Benchmark callable node Lib086_Fn038 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn038(const FString& In0, int32& Out1, const TArray< int32 >& In2, const FString& In3);
+	/** Benchmark callable node Lib086_Fn039 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn039(FName In0, UObject* In1);
+	/** Benchmark callable node Lib086_Fn040 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn040(FString& Out0, FName In1, FString& Out2, int32 In3, const TArray< int32 >& In4, FVector& Out5, const TArray< int32 >& In6, const FString& In7);
+	/** Benchmark callable node Lib086_Fn041 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn041(float In0, const FString& In1, const TArray< int32 >& In2);
+	/** Benchmark callable node Lib086_Fn042 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn042(const FVector& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib086_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn043(FString& Out0, bool In1, bool In2, const TArray< int32 >& In3, bool In4);
+	/** Benchmark callable node Lib086_Fn044 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn044(float In0, const FVector& In1);
+	/** Benchmark pure node Lib086_Fn045 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn045(FString& Out0, const FTransform& In1, FString& Out2, float In3, const FString& In4);
+	/** Benchmark pure node Lib086_Fn046 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn046(int32& Out0, FString& Out1, int32 In2, FString& Out3, FVector& Out4, FString& Out5);
+	/** Benchmark callable node Lib086_Fn047 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn047(int32 In0, FVector& Out1, bool In2, int32 In3);
+	/** Benchmark pure node Lib086_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn048(int32 In0, float In1, FName In2, const FVector& In3, const FTransform& In4, const TArray< int32 >& In5, const FVector& In6);
+	/** Benchmark callable node Lib086_Fn049 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn049(FVector& Out0);
+	/** Benchmark callable node Lib086_Fn050 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn050(bool In0);
+	/** Benchmark callable node Lib086_Fn051 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn051(FVector& Out0, int32 In1, FVector& Out2, UObject* In3);
+	/** Benchmark latent node Lib086_Fn052 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib086_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const TArray< int32 >& In1, FName In2);
+	/** Benchmark pure node Lib086_Fn053 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn053(const FString& In0, const FVector& In1, int32& Out2, int32& Out3, const FTransform& In4, UObject* In5);
+	/** Benchmark pure node Lib086_Fn054 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn054(FString& Out0, UObject* In1, float In2, float In3);
+	/** Benchmark callable node Lib086_Fn055 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn055(const FVector& In0, int32 In1, int32 In2, int32& Out3, FName In4, const FTransform& In5, const FTransform& In6, float In7);
+	/** Benchmark callable node Lib086_Fn056 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn056();
+	/** Benchmark callable node Lib086_Fn057 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn057(FString& Out0, bool In1, FName In2, bool In3, const FString& In4, const FString& In5, FVector& Out6);
+	/** Benchmark callable node Lib086_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn058(const FVector& In0, int32& Out1, const FVector& In2, const TArray< int32 >& In3, const FTransform& In4, FString& Out5, int32& Out6, const FString& In7);
+	/** Benchmark callable node Lib086_Fn059 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn059();
+	/** Benchmark callable node Lib086_Fn060 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn060(FName In0, FName In1, int32 In2, UObject* In3, FName In4, int32 In5);
+	/** Benchmark callable node Lib086_Fn061 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn061(FString& Out0, FName In1, float In2, bool In3);
+	/** Benchmark callable node Lib086_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn062(const FString& In0, const FTransform& In1, const TArray< int32 >& In2, FVector& Out3, FName In4, float In5, FString& Out6);
+	/** Benchmark pure node Lib086_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn063(bool In0, FName In1, FString& Out2, const FString& In3);
+	/** Benchmark callable node Lib086_Fn064 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn064(bool In0, FVector& Out1);
+	/** Benchmark pure node Lib086_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn065(float In0, FString& Out1, int32 In2, int32 In3, FVector& Out4, const FString& In5, bool In6, float In7);
+	/** Benchmark pure node Lib086_Fn066 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn066(const FTransform& In0, const FTransform& In1, FName In2, const FString& In3, int32 In4, bool In5, const FVector& In6, const FTransform& In7);
+	/** Benchmark latent node Lib086_Fn067 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib086_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib086_Fn068 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn068(UObject* In0, int32& Out1, int32& Out2, FString& Out3, FName In4);
+	/** Benchmark pure node Lib086_Fn069 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn069(const FTransform& In0, const FTransform& In1, FVector& Out2, FVector& Out3);
+	/** Benchmark pure node Lib086_Fn070 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn070(const FVector& In0, FVector& Out1, const FVector& In2, UObject* In3);
+	/** Benchmark callable node Lib086_Fn071 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn071(const TArray< int32 >& In0, int32& Out1, const FVector& In2, FVector& Out3);
+	/** Benchmark pure node Lib086_Fn072 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn072();
+	/** Benchmark callable node Lib086_Fn073 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn073(int32& Out0, int32 In1, const FVector& In2, FName In3, FName In4);
+	/** Benchmark pure node Lib086_Fn074 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn074(const FString& In0, int32& Out1, const FTransform& In2, const FVector& In3, FString& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib086_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn075(const TArray< int32 >& In0, const TArray< int32 >& In1, int32 In2, int32 In3, UObject* In4, const FString& In5, UObject* In6, int32& Out7);
+	/** Benchmark pure node Lib086_Fn076 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn076(int32& Out0, FString& Out1, float In2, int32& Out3, FName In4, const FTransform& In5);
+	/** Benchmark callable node Lib086_Fn077 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn077(FString& Out0, UObject* In1, float In2, const FString& In3, const FString& In4);
+	/** Benchmark callable node Lib086_Fn078 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn078(FName In0, const TArray< int32 >& In1, const TArray< int32 >& In2, FName In3);
+	/** Benchmark callable node Lib086_Fn079 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn079(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib086_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn080(const FVector& In0, int32 In1, const FTransform& In2, const FString& In3);
+	/** Benchmark callable node Lib086_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn081();
+	/** Benchmark callable node Lib086_Fn082 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn082(int32 In0, float In1, FVector& Out2, int32& Out3, FName In4, const FTransform& In5);
+	/** Benchmark callable node Lib086_Fn083 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn083(const TArray< int32 >& In0, int32& Out1, FName In2, int32& Out3);
+	/** Benchmark callable node Lib086_Fn084 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static void Lib086_Fn084(const FVector& In0, UObject* In1, float In2, FString& Out3);
+	/** Benchmark callable node Lib086_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn085(const TArray< int32 >& In0, float In1, const FString& In2, FVector& Out3, FVector& Out4, int32 In5, FVector& Out6);
+	/** Benchmark callable node Lib086_Fn086 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn086(bool In0, int32 In1, int32 In2, int32 In3, FString& Out4, bool In5, const FVector& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib086_Fn087 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn087(const TArray< int32 >& In0);
+	/** Benchmark callable node Lib086_Fn088 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FVector Lib086_Fn088(FString& Out0);
+	/** Benchmark pure node Lib086_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn089(const TArray< int32 >& In0, int32 In1, int32 In2, const TArray< int32 >& In3, FString& Out4, const FString& In5);
+	/** Benchmark callable node Lib086_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn090(const FString& In0);
+	/** Benchmark pure node Lib086_Fn091 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn091(const FTransform& In0, int32& Out1, FVector& Out2, const FVector& In3, int32 In4, const FTransform& In5, const FString& In6, UObject* In7);
+	/** Benchmark pure node Lib086_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn092(const FVector& In0);
+	/** Benchmark pure node Lib086_Fn093 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn093(int32& Out0, float In1, const TArray< int32 >& In2, FName In3, UObject* In4);
+	/** Benchmark pure node Lib086_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn094(const FString& In0, float In1, const FString& In2, const FVector& In3, int32 In4, int32& Out5, int32 In6, FName In7);
+	/** Benchmark pure node Lib086_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static int32 Lib086_Fn095(FVector& Out0, const FVector& In1, const FTransform& In2);
+	/** Benchmark callable node Lib086_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn096(bool In0);
+	/** Benchmark callable node Lib086_Fn097 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static float Lib086_Fn097();
+	/** Benchmark pure node Lib086_Fn098 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib086")
+	static FString Lib086_Fn098(float In0, const FVector& In1);
+	/** Benchmark callable node Lib086_Fn099 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib086")
+	static bool Lib086_Fn099();
+};
+
+
+UCLASS()
+class UKDGBenchLib_087 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib087_Fn000 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1, UObject* In2, FString& Out3);
+	/** Benchmark pure node Lib087_Fn001 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn001(const FTransform& In0, bool In1, float In2, FName In3, const FVector& In4, int32 In5, const TArray< int32 >& In6, const FVector& In7);
+	/** Benchmark pure node Lib087_Fn002 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn002(float In0, bool In1, const FString& In2);
+	/** Benchmark callable node Lib087_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn003(const FVector& In0, const FString& In1, FName In2, const TArray< int32 >& In3, const FTransform& In4, const FVector& In5, int32 In6);
+	/** Benchmark callable node Lib087_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn004();
+	/** Benchmark callable node Lib087_Fn005 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn005(const FString& In0, float In1, UObject* In2, FString& Out3, bool In4, const FTransform& In5, const TArray< int32 >& In6);
+	/** Benchmark latent node Lib087_Fn006 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const TArray< int32 >& In1);
+	/** Benchmark pure node Lib087_Fn007 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn007(int32 In0, int32& Out1, const FTransform& In2, const FString& In3, UObject* In4);
+	/** Benchmark callable node Lib087_Fn008 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn008(FVector& Out0, FName In1, const TArray< int32 >& In2);
+	/** Benchmark pure node Lib087_Fn009 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn009();
+	/** Benchmark callable node Lib087_Fn010 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn010(const TArray< int32 >& In0);
+	/** Benchmark pure node Lib087_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn011(const FString& In0, const TArray< int32 >& In1, FString& Out2);
+	/** Benchmark pure node Lib087_Fn012 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn012();
+	/** Benchmark callable node Lib087_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn013(const FTransform& In0, int32& Out1, const TArray< int32 >& In2, bool In3, FVector& Out4, bool In5);
+	/** Benchmark pure node Lib087_Fn014 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn014();
+	/** Benchmark latent node Lib087_Fn015 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FVector& In1, UObject* In2, const FTransform& In3, const TArray< int32 >& In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark latent node Lib087_Fn016 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, const TArray< int32 >& In2, FName In3, UObject* In4, const FString& In5, FName In6);
+	/** Benchmark callable node Lib087_Fn017 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn017(UObject* In0, float In1, const FVector& In2, int32& Out3);
+	/** Benchmark callable node Lib087_Fn018 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn018(FVector& Out0, UObject* In1, const TArray< int32 >& In2, bool In3, int32 In4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib087_Fn019 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn019(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0);
+	/** Benchmark pure node Lib087_Fn020 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn020(FString& Out0, const FString& In1, const FString& In2);
+	/** Benchmark latent node Lib087_Fn021 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FName In1, UObject* In2);
+	/** Benchmark callable node Lib087_Fn022 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn022(const TArray< int32 >& In0, const FString& In1, FVector& Out2, const TArray< int32 >& In3, const FTransform& In4, const FTransform& In5, const FTransform& In6, FName In7);
+	/** Benchmark pure node Lib087_Fn023 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn023(int32 In0);
+	/** Benchmark callable node Lib087_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn024(const TArray< int32 >& In0, const FString& In1, const FVector& In2, int32& Out3, UObject* In4, FString& Out5);
+	/** Benchmark latent node Lib087_Fn025 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FString& Out1, const TArray< int32 >& In2, bool In3, FString& Out4, UObject* In5, const FVector& In6);
+	/** Benchmark callable node Lib087_Fn026 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn026(const FString& In0, UObject* In1, const FString& In2, const FString& In3, float In4, const TArray< int32 >& In5, FString& Out6);
+	/** Benchmark callable node Lib087_Fn027 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn027(const FString& In0, FVector& Out1, const FString& In2, const FString& In3, UObject* In4, const FTransform& In5);
+	/** Benchmark pure node Lib087_Fn028 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn028(FVector& Out0, int32 In1, FName In2, FVector& Out3, const TArray< int32 >& In4);
+	/** Benchmark latent node Lib087_Fn029 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, bool In1, FVector& Out2, FName In3, const FTransform& In4);
+	/** Benchmark pure node Lib087_Fn030 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn030(FString& Out0, const FString& In1, const FString& In2, const FVector& In3, int32& Out4, const FTransform& In5, int32 In6);
+	/** Benchmark pure node Lib087_Fn031 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn031(const FTransform& In0, FName In1, const TArray< int32 >& In2, const FString& In3, const FString& In4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib087_Fn032 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, UObject* In1, const FString& In2, FName In3);
+	/** Benchmark callable node Lib087_Fn033 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn033(int32& Out0, const TArray< int32 >& In1, int32 In2, float In3, bool In4);
+	/** Benchmark callable node Lib087_Fn034 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn034(FVector& Out0, int32& Out1, bool In2, int32 In3, const TArray< int32 >& In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib087_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn035(const FTransform& In0, FVector& Out1, int32 In2);
+	/** Benchmark callable node Lib087_Fn036 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn036(FVector& Out0, FVector& Out1, const FString& In2);
+	/** Benchmark callable node Lib087_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn037(bool In0, bool In1, int32& Out2, int32 In3, FString& Out4);
+	/** Benchmark callable node Lib087_Fn038 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn038(int32 In0, FVector& Out1, UObject* In2);
+	/** Benchmark pure node Lib087_Fn039 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn039(float In0, bool In1, int32& Out2, const FTransform& In3, const FString& In4, int32& Out5, bool In6, int32& Out7);
+	/** Benchmark callable node Lib087_Fn040 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn040(const FVector& In0);
+	/** Benchmark latent node Lib087_Fn041 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib087_Fn042 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn042(const FString& In0, int32& Out1, FVector& Out2, const FString& In3, const TArray< int32 >& In4, float In5, FVector& Out6, const FVector& In7);
+	/** Benchmark callable node Lib087_Fn043 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn043(FName In0);
+	/** Benchmark callable node Lib087_Fn044 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn044(int32 In0, int32 In1);
+	/** Benchmark callable node Lib087_Fn045 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn045(FString& Out0, FString& Out1, int32& Out2, const FString& In3, int32 In4);
+	/** Benchmark pure node Lib087_Fn046 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn046(int32& Out0, const TArray< int32 >& In1, FVector& Out2, FString& Out3, int32 In4, const FTransform& In5, int32& Out6, FVector& Out7);
+	/** Benchmark callable node Lib087_Fn047 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn047(float In0);
+	/** Benchmark pure node Lib087_Fn048 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn048(const TArray< int32 >& In0, int32 In1, int32 In2, FName In3);
+	/** Benchmark pure node Lib087_Fn049 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn049(UObject* In0);
+	/** Benchmark latent node Lib087_Fn050 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, const FTransform& In2);
+	/** Benchmark pure node Lib087_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn051(FString& Out0, bool In1, const FTransform& In2, float In3, bool In4, FString& Out5);
+	/** Benchmark callable node Lib087_Fn052 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn052(UObject* In0, const FTransform& In1);
+	/** Benchmark pure node Lib087_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn053();
+	/** Benchmark callable node Lib087_Fn054 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn054(FVector& Out0, int32 In1);
+	/** Benchmark pure node Lib087_Fn055 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn055();
+	/** Benchmark callable node Lib087_Fn056 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn056(int32 In0, const FString& In1);
+	/** Benchmark callable node Lib087_Fn057 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn057(const FTransform& In0, FString& Out1, bool In2, const FVector& In3);
+	/** Benchmark pure node Lib087_Fn058 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn058(UObject* In0, bool In1, bool In2, const FVector& In3, FVector& Out4, int32& Out5, FVector& Out6, const FVector& In7);
+	/** Benchmark pure node Lib087_Fn059 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn059();
+	/** Benchmark callable node Lib087_Fn060 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn060(FName In0, bool In1, const FString& In2);
+	/** Benchmark latent node Lib087_Fn061 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn061(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib087_Fn062 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn062(FName In0, float In1, float In2, UObject* In3, FName In4, FString& Out5, const FString& In6, FVector& Out7);
+	/** Benchmark callable node Lib087_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn063(float In0);
+	/** Benchmark callable node Lib087_Fn064 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn064(const FString& In0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, const FVector& In4, float In5);
+	/** Benchmark callable node Lib087_Fn065 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn065(UObject* In0);
+	/** Benchmark callable node Lib087_Fn066 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn066(const FVector& In0);
+	/** Benchmark callable node Lib087_Fn067 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn067();
+	/** Benchmark callable node Lib087_Fn068 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn068(bool In0, float In1, const TArray< int32 >& In2, const FTransform& In3, int32 In4, const FString& In5, const FVector& In6);
+	/** Benchmark latent node Lib087_Fn069 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0);
+	/** Benchmark callable node Lib087_Fn070 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn070(int32& Out0, const FVector& In1, const FString& In2, const FString& In3, bool In4, UObject* In5, bool In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib087_Fn071 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn071(bool In0);
+	/** Benchmark pure node Lib087_Fn072 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn072(const TArray< int32 >& In0, const FTransform& In1, FString& Out2, const FTransform& In3, bool In4, const FTransform& In5);
+	/** Benchmark callable node Lib087_Fn073 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn073(const FVector& In0, int32& Out1, FName In2);
+	/** Benchmark pure node Lib087_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn074(const FTransform& In0, FVector& Out1, FString& Out2, float In3);
+	/** Benchmark callable node Lib087_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static float Lib087_Fn075(int32 In0, int32 In1, FVector& Out2, const FString& In3, const FString& In4, FName In5, FName In6);
+	/** Benchmark pure node Lib087_Fn076 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn076(int32 In0, const TArray< int32 >& In1, FVector& Out2, FName In3, bool In4, float In5, UObject* In6);
+	/** Benchmark callable node Lib087_Fn077 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn077(FVector& Out0, const FVector& In1, int32 In2, float In3, const FTransform& In4, FName In5, FVector& Out6);
+	/** Benchmark callable node Lib087_Fn078 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn078(bool In0, const FVector& In1, int32 In2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5, FName In6);
+	/** Benchmark pure node Lib087_Fn079 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn079(const TArray< int32 >& In0, int32 In1, FName In2);
+	/** Benchmark latent node Lib087_Fn080 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, bool In1, int32& Out2, int32& Out3, bool In4, FString& Out5, const FTransform& In6, const FVector& In7);
+	/** Benchmark callable node Lib087_Fn081 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn081(bool In0, bool In1, float In2, int32& Out3, FName In4, const FVector& In5, const FTransform& In6);
+	/** Benchmark pure node Lib087_Fn082 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn082();
+	/** Benchmark callable node Lib087_Fn083 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn083(const FTransform& In0, FVector& Out1, int32& Out2);
+	/** Benchmark callable node Lib087_Fn084 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn084(bool In0, const FVector& In1, FString& Out2, UObject* In3, int32& Out4, UObject* In5, FName In6, FString& Out7);
+	/** Benchmark callable node Lib087_Fn085 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn085(const FString& In0, FString& Out1, bool In2, const FVector& In3, UObject* In4, int32& Out5);
+	/** Benchmark callable node Lib087_Fn086 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn086(const FVector& In0, UObject* In1, const TArray< int32 >& In2, const TArray< int32 >& In3, int32& Out4, const FTransform& In5);
+	/** Benchmark callable node Lib087_Fn087 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn087(float In0, int32& Out1, int32& Out2, const FVector& In3, float In4, int32& Out5);
+	/** Benchmark pure node Lib087_Fn088 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn088(bool In0);
+	/** Benchmark callable node Lib087_Fn089 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static FString Lib087_Fn089(float In0, const FString& In1, bool In2, const FTransform& In3);
+	/** Benchmark callable node Lib087_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn090(int32 In0, float In1, int32& Out2, int32 In3, bool In4, FString& Out5, const FVector& In6);
+	/** Benchmark callable node Lib087_Fn091 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static void Lib087_Fn091(int32 In0, int32& Out1, UObject* In2, float In3, float In4, int32 In5);
+	/** Benchmark callable node Lib087_Fn092 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn092();
+	/** Benchmark pure node Lib087_Fn093 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static int32 Lib087_Fn093(bool In0, FString& Out1, float In2, int32& Out3, float In4);
+	/** Benchmark latent node Lib087_Fn094 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib087_Fn094(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, FName In1, FVector& Out2, FString& Out3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib087_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn095(UObject* In0, UObject* In1, int32 In2);
+	/** Benchmark pure node Lib087_Fn096 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn096(int32& Out0, const FVector& In1);
+	/** Benchmark pure node Lib087_Fn097 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn097(FVector& Out0, const FVector& In1, FVector& Out2, UObject* In3, const TArray< int32 >& In4, FString& Out5);
+	/** Benchmark pure node Lib087_Fn098 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static FVector Lib087_Fn098();
+	/** Benchmark pure node Lib087_Fn099 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib087")
+	static bool Lib087_Fn099(int32& Out0, const FVector& In1);
+};
+
+
+UCLASS()
+class UKDGBenchLib_088 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark latent node Lib088_Fn000 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FVector& Out1, FVector& Out2, int32 In3, int32& Out4);
+	/** Benchmark pure node Lib088_Fn001 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn001(const FVector& In0, float In1, const FVector& In2, const FString& In3, const TArray< int32 >& In4, int32 In5, FName In6);
+	/** Benchmark pure node Lib088_Fn002 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn002(const TArray< int32 >& In0, const FTransform& In1, FVector& Out2, FString& Out3, int32 In4);
+	/** Benchmark pure node Lib088_Fn003 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn003(const FString& In0, const TArray< int32 >& In1, int32 In2, const TArray< int32 >& In3, const TArray< int32 >& In4, int32 In5, float In6, FName In7);
+	/** Benchmark pure node Lib088_Fn004 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn004();
+	/** Benchmark callable node Lib088_Fn005 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn005(int32& Out0, UObject* In1, float In2, const FString& In3, FString& Out4, float In5);
+	/** Benchmark callable node Lib088_Fn006 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn006(int32& Out0, const FTransform& In1, FVector& Out2, int32& Out3, const FString& In4, FVector& Out5);
+	/** Benchmark callable node Lib088_Fn007 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn007(int32 In0, const FTransform& In1, bool In2, const FTransform& In3, const FString& In4, const FString& In5);
+	/** Benchmark callable node Lib088_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn008(float In0, FName In1, FVector& Out2, bool In3, const TArray< int32 >& In4, const FTransform& In5);
+	/** Benchmark pure node Lib088_Fn009 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn009(int32 In0, float In1);
+	/** Benchmark callable node Lib088_Fn010 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn010(int32 In0);
+	/** Benchmark callable node Lib088_Fn011 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn011(FVector& Out0, int32& Out1, float In2);
+	/** Benchmark pure node Lib088_Fn012 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn012(const TArray< int32 >& In0, int32& Out1, FString& Out2, int32 In3, UObject* In4, const FVector& In5, const TArray< int32 >& In6, UObject* In7);
+	/** Benchmark latent node Lib088_Fn013 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn013(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FVector& Out1, int32 In2, const FVector& In3, UObject* In4, const TArray< int32 >& In5);
+	/** Benchmark pure node Lib088_Fn014 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn014(float In0, const TArray< int32 >& In1, UObject* In2, const FString& In3, int32 In4, int32& Out5);
+	/** Benchmark pure node Lib088_Fn015 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn015(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, FString& Out3, const FTransform& In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib088_Fn016 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn016(FName In0, int32& Out1, const FTransform& In2);
+	/** Benchmark callable node Lib088_Fn017 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn017(float In0, FVector& Out1, const TArray< int32 >& In2, int32 In3, FName In4, const FString& In5, int32& Out6);
+	/** Benchmark callable node Lib088_Fn018 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn018(FVector& Out0);
+	/** Benchmark pure node Lib088_Fn019 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn019(float In0, float In1, float In2, FVector& Out3, const TArray< int32 >& In4);
+	/** Benchmark pure node Lib088_Fn020 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn020(float In0, int32& Out1, const TArray< int32 >& In2, UObject* In3, int32& Out4, const TArray< int32 >& In5, const TArray< int32 >& In6);
+	/** Benchmark callable node Lib088_Fn021 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn021(FVector& Out0, UObject* In1);
+	/** Benchmark callable node Lib088_Fn022 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn022(FName In0);
+	/** Benchmark callable node Lib088_Fn023 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn023(const FTransform& In0, const FString& In1);
+	/** Benchmark callable node Lib088_Fn024 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn024(const FVector& In0, int32& Out1, int32 In2, UObject* In3, int32 In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib088_Fn025 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn025(float In0);
+	/** Benchmark latent node Lib088_Fn026 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0);
+	/** Benchmark pure node Lib088_Fn027 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn027(float In0, const FVector& In1, FString& Out2, const FVector& In3);
+	/** Benchmark callable node Lib088_Fn028 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn028(FName In0);
+	/** Benchmark pure node Lib088_Fn029 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn029(float In0, bool In1, const FString& In2);
+	/** Benchmark pure node Lib088_Fn030 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn030(UObject* In0, float In1, FString& Out2, const FVector& In3, int32& Out4, int32& Out5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark latent node Lib088_Fn031 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0);
+	/** Benchmark callable node Lib088_Fn032 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn032(int32& Out0, const FVector& In1, float In2, int32 In3, UObject* In4, const FVector& In5);
+	/** Benchmark callable node Lib088_Fn033 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn033(FVector& Out0, FString& Out1);
+	/** Benchmark callable node Lib088_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn034(const FVector& In0, bool In1);
+	/** Benchmark pure node Lib088_Fn035 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn035(int32& Out0, float In1, FVector& Out2);
+	/** Benchmark callable node Lib088_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn036(int32& Out0, const FTransform& In1, const FString& In2, const FString& In3, const FVector& In4, float In5, const TArray< int32 >& In6, FString& Out7);
+	/** Benchmark callable node Lib088_Fn037 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn037(UObject* In0, FVector& Out1, FString& Out2, UObject* In3, const FVector& In4);
+	/** Benchmark callable node Lib088_Fn038 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn038(bool In0, bool In1);
+	/** Benchmark callable node Lib088_Fn039 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn039(FVector& Out0, FString& Out1, const FString& In2, FVector& Out3, FVector& Out4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib088_Fn040 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn040();
+	/** Benchmark callable node Lib088_Fn041 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn041(int32 In0, FName In1, const FVector& In2, UObject* In3);
+	/** Benchmark callable node Lib088_Fn042 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn042(UObject* In0, const TArray< int32 >& In1, const FVector& In2, const FTransform& In3, FName In4);
+	/** Benchmark callable node Lib088_Fn043 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn043(const FVector& In0, const TArray< int32 >& In1, FName In2, FName In3, float In4, bool In5, int32& Out6, FString& Out7);
+	/** Benchmark pure node Lib088_Fn044 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn044(const FVector& In0, const FTransform& In1, UObject* In2, float In3, float In4);
+	/** Benchmark callable node Lib088_Fn045 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn045(FName In0);
+	/** Benchmark pure node Lib088_Fn046 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn046(const FString& In0, float In1, UObject* In2);
+	/** Benchmark pure node Lib088_Fn047 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn047(const FString& In0, FString& Out1, FVector& Out2, const FTransform& In3, int32& Out4, const TArray< int32 >& In5, const FTransform& In6);
+	/** Benchmark callable node Lib088_Fn048 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn048(float In0, const FVector& In1, const FVector& In2);
+	/** Benchmark latent node Lib088_Fn049 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark callable node Lib088_Fn050 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn050(float In0, UObject* In1, FString& Out2, const TArray< int32 >& In3, FVector& Out4, FName In5, FVector& Out6);
+	/** Benchmark callable node Lib088_Fn051 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn051(int32 In0, const FString& In1, FVector& Out2, bool In3, int32 In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib088_Fn052 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn052();
+	/** Benchmark pure node Lib088_Fn053 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn053();
+	/** Benchmark callable node Lib088_Fn054 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn054(FName In0, float In1, bool In2);
+	/** Benchmark pure node Lib088_Fn055 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn055(const FVector& In0, bool In1, FVector& Out2);
+	/** Benchmark callable node Lib088_Fn056 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn056(const FVector& In0, int32 In1, int32& Out2, bool In3, float In4, int32& Out5, FString& Out6, const FVector& In7);
+	/** Benchmark callable node Lib088_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn057();
+	/** Benchmark callable node Lib088_Fn058 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn058(const FString& In0, const TArray< int32 >& In1, FName In2, const FTransform& In3, const FVector& In4, FName In5, const FVector& In6);
+	/** Benchmark callable node Lib088_Fn059 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn059(FString& Out0, float In1, int32& Out2, float In3);
+	/** Benchmark pure node Lib088_Fn060 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn060(const FVector& In0, FVector& Out1, FVector& Out2, const FString& In3);
+	/** Benchmark callable node Lib088_Fn061 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn061(int32& Out0, FName In1);
+	/** Benchmark latent node Lib088_Fn062 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0);
+	/** Benchmark callable node Lib088_Fn063 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn063(const TArray< int32 >& In0, FName In1, const FVector& In2, FName In3);
+	/** Benchmark latent node Lib088_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, UObject* In1, float In2, const FVector& In3, FString& Out4, const FVector& In5);
+	/** Benchmark callable node Lib088_Fn065 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn065(const FString& In0, FVector& Out1, FName In2, const FVector& In3, float In4, UObject* In5);
+	/** Benchmark callable node Lib088_Fn066 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn066(bool In0, FString& Out1, const FString& In2, FVector& Out3, FString& Out4, FName In5, float In6);
+	/** Benchmark callable node Lib088_Fn067 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn067(bool In0, const FTransform& In1, int32 In2, int32 In3, FString& Out4, FVector& Out5);
+	/** Benchmark latent node Lib088_Fn068 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1, const FString& In2, const FVector& In3);
+	/** Benchmark pure node Lib088_Fn069 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn069(const FString& In0, FVector& Out1);
+	/** Benchmark callable node Lib088_Fn070 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn070(int32& Out0, FString& Out1, UObject* In2, int32 In3, int32& Out4, int32 In5, const TArray< int32 >& In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib088_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn071(FString& Out0, int32 In1, float In2, const FTransform& In3, const TArray< int32 >& In4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib088_Fn072 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, float In1, const FTransform& In2);
+	/** Benchmark callable node Lib088_Fn073 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn073(const FString& In0, const FString& In1);
+	/** Benchmark pure node Lib088_Fn074 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn074(UObject* In0, int32 In1, UObject* In2, const FTransform& In3, int32 In4);
+	/** Benchmark callable node Lib088_Fn075 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn075(const FVector& In0, UObject* In1, bool In2, int32& Out3, UObject* In4, UObject* In5, const FString& In6);
+	/** Benchmark latent node Lib088_Fn076 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, bool In1);
+	/** Benchmark pure node Lib088_Fn077 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn077(bool In0, const FVector& In1, int32 In2, const TArray< int32 >& In3, const TArray< int32 >& In4, bool In5);
+	/** Benchmark callable node Lib088_Fn078 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn078(int32& Out0, const TArray< int32 >& In1, float In2);
+	/** Benchmark pure node Lib088_Fn079 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn079(const TArray< int32 >& In0, const TArray< int32 >& In1, FVector& Out2, const FVector& In3, bool In4, bool In5, FVector& Out6);
+	/** Benchmark pure node Lib088_Fn080 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn080(FString& Out0, UObject* In1, const FTransform& In2, const FTransform& In3);
+	/** Benchmark callable node Lib088_Fn081 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn081();
+	/** Benchmark callable node Lib088_Fn082 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn082(const TArray< int32 >& In0, bool In1, UObject* In2);
+	/** Benchmark latent node Lib088_Fn083 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn083(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, UObject* In1, FVector& Out2, int32 In3, FName In4, bool In5, int32 In6, const FVector& In7);
+	/** Benchmark pure node Lib088_Fn084 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn084(int32 In0, float In1, const FString& In2, const FVector& In3, int32 In4, float In5, const FTransform& In6);
+	/** Benchmark pure node Lib088_Fn085 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn085();
+	/** Benchmark pure node Lib088_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static FString Lib088_Fn086(float In0, int32& Out1, int32& Out2, const FVector& In3, int32& Out4);
+	/** Benchmark pure node Lib088_Fn087 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn087(int32& Out0, float In1, float In2, bool In3, const FVector& In4, const FVector& In5, const FVector& In6, bool In7);
+	/** Benchmark callable node Lib088_Fn088 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn088(bool In0);
+	/** Benchmark pure node Lib088_Fn089 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn089(FVector& Out0, const TArray< int32 >& In1, FName In2, const FTransform& In3, const FString& In4, const FString& In5);
+	/** Benchmark pure node Lib088_Fn090 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn090(FName In0);
+	/** Benchmark latent node Lib088_Fn091 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib088_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, FName In2);
+	/** Benchmark callable node Lib088_Fn092 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn092(const FVector& In0);
+	/** Benchmark callable node Lib088_Fn093 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static void Lib088_Fn093();
+	/** Benchmark pure node Lib088_Fn094 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn094(const FTransform& In0, bool In1, float In2, FVector& Out3, bool In4, int32 In5, UObject* In6);
+	/** Benchmark pure node Lib088_Fn095 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static float Lib088_Fn095(FName In0, FVector& Out1, bool In2);
+	/** Benchmark callable node Lib088_Fn096 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static FVector Lib088_Fn096(int32 In0);
+	/** Benchmark callable node Lib088_Fn097 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn097(FString& Out0, FVector& Out1, const FTransform& In2, bool In3, const FVector& In4, int32& Out5, UObject* In6);
+	/** Benchmark callable node Lib088_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib088")
+	static bool Lib088_Fn098(const FVector& In0, UObject* In1, float In2, float In3, const FVector& In4, const FVector& In5, FVector& Out6);
+	/** Benchmark pure node Lib088_Fn099 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib088")
+	static int32 Lib088_Fn099(FName In0, float In1, int32& Out2, bool In3, const TArray< int32 >& In4, FVector& Out5, const FVector& In6, int32& Out7);
+};
+
+
+UCLASS()
+class UKDGBenchLib_089 : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Benchmark callable node Lib089_Fn000 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn000(int32 In0, float In1, FVector& Out2, int32& Out3);
+	/** Benchmark pure node Lib089_Fn001 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn001(FVector& Out0, float In1, const FString& In2, FString& Out3);
+	/** Benchmark callable node Lib089_Fn002 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn002(float In0, UObject* In1, const FTransform& In2, int32& Out3, bool In4, float In5);
+	/** Benchmark callable node Lib089_Fn003 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn003(int32 In0, float In1, UObject* In2, FName In3, const FVector& In4, float In5, FName In6);
+	/** Benchmark pure node Lib089_Fn004 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn004(const TArray< int32 >& In0, const FVector& In1, FName In2, int32 In3, UObject* In4, const TArray< int32 >& In5, UObject* In6);
+	/** Benchmark callable node Lib089_Fn005 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn005(const FTransform& In0, FName In1, const FString& In2, const FVector& In3);
+	/** Benchmark pure node Lib089_Fn006 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn006(FVector& Out0, UObject* In1, int32 In2);
+	/** Benchmark latent node Lib089_Fn007 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, const FString& In1, FString& Out2, UObject* In3, float In4, bool In5, FVector& Out6);
+	/** Benchmark callable node Lib089_Fn008 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn008(int32 In0, FVector& Out1, const FTransform& In2, FVector& Out3, FName In4, int32 In5);
+	/** Benchmark callable node Lib089_Fn009 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn009(const FString& In0);
+	/** Benchmark callable node Lib089_Fn010 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn010(float In0, const FVector& In1, FString& Out2, bool In3, int32 In4);
+	/** Benchmark callable node Lib089_Fn011 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn011(int32 In0, int32 In1, const FString& In2, int32 In3, int32 In4, FString& Out5, FString& Out6, const FTransform& In7);
+	/** Benchmark callable node Lib089_Fn012 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn012(FVector& Out0, bool In1, int32 In2, int32& Out3);
+	/** Benchmark callable node Lib089_Fn013 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn013(FName In0, FVector& Out1, FString& Out2, UObject* In3, const FTransform& In4, const FTransform& In5);
+	/** Benchmark pure node Lib089_Fn014 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn014(const FVector& In0);
+	/** Benchmark latent node Lib089_Fn015 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn015(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FVector& In1, FString& Out2, bool In3, UObject* In4, const TArray< int32 >& In5, UObject* In6, int32 In7);
+	/** Benchmark callable node Lib089_Fn016 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn016(int32 In0, int32& Out1, const FTransform& In2, int32 In3, float In4, const TArray< int32 >& In5);
+	/** Benchmark callable node Lib089_Fn017 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn017(FName In0, FString& Out1, FVector& Out2);
+	/** Benchmark callable node Lib089_Fn018 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn018();
+	/** Benchmark callable node Lib089_Fn019 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn019(FVector& Out0, const TArray< int32 >& In1, float In2, const FTransform& In3);
+	/** Benchmark pure node Lib089_Fn020 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn020(float In0);
+	/** Benchmark callable node Lib089_Fn021 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn021(const FTransform& In0, const FString& In1, FName In2, const FVector& In3, FVector& Out4, const FTransform& In5);
+	/** Benchmark pure node Lib089_Fn022 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn022(FVector& Out0, float In1, const FString& In2, bool In3, FVector& Out4, int32& Out5, int32 In6);
+	/** Benchmark callable node Lib089_Fn023 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn023();
+	/** Benchmark callable node Lib089_Fn024 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn024(int32 In0);
+	/** Benchmark callable node Lib089_Fn025 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn025(const FVector& In0, FName In1, bool In2);
+	/** Benchmark callable node Lib089_Fn026 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn026(FVector& Out0, const TArray< int32 >& In1, bool In2, const FString& In3, UObject* In4, int32 In5);
+	/** Benchmark callable node Lib089_Fn027 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn027(const FTransform& In0, FName In1, FVector& Out2);
+	/** Benchmark pure node Lib089_Fn028 with 3 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn028(const FVector& In0, bool In1, int32 In2);
+	/** Benchmark callable node Lib089_Fn029 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn029(int32 In0, FVector& Out1, UObject* In2, FName In3, int32 In4, UObject* In5, const FVector& In6);
+	/** Benchmark callable node Lib089_Fn030 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn030(int32& Out0, const FVector& In1, bool In2, const TArray< int32 >& In3);
+	/** Benchmark callable node Lib089_Fn031 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn031(float In0);
+	/** Benchmark callable node Lib089_Fn032 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn032(bool In0, const FVector& In1, int32 In2, const FString& In3, bool In4);
+	/** Benchmark callable node Lib089_Fn033 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn033(const FString& In0, int32 In1, UObject* In2);
+	/** Benchmark callable node Lib089_Fn034 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn034(float In0, const FTransform& In1);
+	/** Benchmark pure node Lib089_Fn035 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn035(UObject* In0, UObject* In1, const FString& In2, int32 In3, int32& Out4, int32& Out5, UObject* In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib089_Fn036 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn036(int32 In0, const FVector& In1, const FVector& In2, const FVector& In3, const FTransform& In4, FName In5, const FTransform& In6, const TArray< int32 >& In7);
+	/** Benchmark pure node Lib089_Fn037 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn037();
+	/** Benchmark callable node Lib089_Fn038 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn038(const FString& In0, bool In1, const FVector& In2);
+	/** Benchmark latent node Lib089_Fn039 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn039(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0);
+	/** Benchmark pure node Lib089_Fn040 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn040(UObject* In0, const FTransform& In1, const FTransform& In2, bool In3, bool In4);
+	/** Benchmark latent node Lib089_Fn041 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, bool In1, const FTransform& In2, const FVector& In3);
+	/** Benchmark callable node Lib089_Fn042 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn042(bool In0, const FString& In1, const FTransform& In2, const FVector& In3, int32 In4, UObject* In5);
+	/** Benchmark callable node Lib089_Fn043 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn043(FName In0, int32& Out1, bool In2, int32& Out3, const FString& In4);
+	/** Benchmark pure node Lib089_Fn044 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn044(const FVector& In0, const FString& In1, int32& Out2, int32& Out3, bool In4, FString& Out5, int32& Out6, const FVector& In7);
+	/** Benchmark latent node Lib089_Fn045 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FName In1, bool In2);
+	/** Benchmark callable node Lib089_Fn046 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn046(const FTransform& In0, FName In1, bool In2, const FVector& In3, int32& Out4, const FVector& In5, const FVector& In6);
+	/** Benchmark pure node Lib089_Fn047 with 1 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn047(const FTransform& In0);
+	/** Benchmark callable node Lib089_Fn048 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn048(const FTransform& In0, float In1, const FString& In2, float In3, const FTransform& In4, FVector& Out5, float In6);
+	/** Benchmark callable node Lib089_Fn049 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn049(FVector& Out0, int32 In1, const FString& In2, int32& Out3, int32& Out4, FVector& Out5);
+	/** Benchmark callable node Lib089_Fn050 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn050(const FTransform& In0, const FVector& In1, const FString& In2, const FTransform& In3, const TArray< int32 >& In4, const FTransform& In5, const TArray< int32 >& In6, const TArray< int32 >& In7);
+	/** Benchmark callable node Lib089_Fn051 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn051(const FTransform& In0, const TArray< int32 >& In1);
+	/** Benchmark callable node Lib089_Fn052 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn052(float In0, FVector& Out1, int32 In2);
+	/** Benchmark callable node Lib089_Fn053 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn053(bool In0, const FTransform& In1, FVector& Out2, const FString& In3, int32& Out4, const FTransform& In5, int32& Out6);
+	/** Benchmark latent node Lib089_Fn054 with 9 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FVector& Out1, int32 In2, FName In3, const FTransform& In4, int32 In5, FName In6);
+	/** Benchmark latent node Lib089_Fn055 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn055(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark latent node Lib089_Fn056 with 10 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn056(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const FVector& In4, const FTransform& In5, int32& Out6, UObject* In7);
+	/** Benchmark callable node Lib089_Fn057 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn057();
+	/** Benchmark callable node Lib089_Fn058 with 0 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn058();
+	/** Benchmark callable node Lib089_Fn059 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn059(FName In0);
+	/** Benchmark callable node Lib089_Fn060 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn060(UObject* In0, FName In1, int32 In2, const FTransform& In3, float In4, float In5, bool In6, FString& Out7);
+	/** Benchmark pure node Lib089_Fn061 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn061(FVector& Out0, FName In1, const TArray< int32 >& In2, int32 In3, int32 In4);
+	/** Benchmark latent node Lib089_Fn062 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, UObject* In1, const FString& In2, bool In3, FString& Out4);
+	/** Benchmark callable node Lib089_Fn063 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn063(const FString& In0);
+	/** Benchmark callable node Lib089_Fn064 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn064(FVector& Out0, const FVector& In1, const FString& In2, float In3, const FVector& In4, const FTransform& In5, FName In6, float In7);
+	/** Benchmark pure node Lib089_Fn065 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn065(FString& Out0, FString& Out1, const FTransform& In2, FVector& Out3, FName In4, FString& Out5, FName In6, int32 In7);
+	/** Benchmark callable node Lib089_Fn066 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn066(int32 In0, const FTransform& In1);
+	/** Benchmark pure node Lib089_Fn067 with 2 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn067(int32 In0, int32& Out1);
+	/** Benchmark callable node Lib089_Fn068 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn068(bool In0, UObject* In1, bool In2);
+	/** Benchmark callable node Lib089_Fn069 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn069(FString& Out0, int32& Out1, int32& Out2, float In3, const FVector& In4, const FTransform& In5);
+	/** Benchmark callable node Lib089_Fn070 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn070(int32& Out0);
+	/** Benchmark pure node Lib089_Fn071 with 6 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn071(FVector& Out0, FString& Out1, int32& Out2, int32& Out3, float In4, const TArray< int32 >& In5);
+	/** Benchmark latent node Lib089_Fn072 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark pure node Lib089_Fn073 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn073(const FVector& In0, int32 In1, const FTransform& In2, const FVector& In3, const TArray< int32 >& In4, FVector& Out5, float In6, const FTransform& In7);
+	/** Benchmark callable node Lib089_Fn074 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn074(int32 In0, const TArray< int32 >& In1, FName In2, bool In3);
+	/** Benchmark pure node Lib089_Fn075 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn075(FString& Out0, const TArray< int32 >& In1, bool In2, bool In3, UObject* In4, int32 In5, const FString& In6, int32& Out7);
+	/** Benchmark latent node Lib089_Fn076 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn076(UObject* WorldContextObject, FLatentActionInfo LatentInfo);
+	/** Benchmark callable node Lib089_Fn077 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn077(const FTransform& In0, UObject* In1, const TArray< int32 >& In2, const FString& In3, UObject* In4, const FString& In5);
+	/** Benchmark callable node Lib089_Fn078 with 1 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn078(const FTransform& In0);
+	/** Benchmark pure node Lib089_Fn079 with 0 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn079();
+	/** Benchmark callable node Lib089_Fn080 with 2 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn080(bool In0, FString& Out1);
+	/** Benchmark callable node Lib089_Fn081 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn081(const FTransform& In0, const FString& In1, FName In2, const FTransform& In3, int32& Out4);
+	/** Benchmark callable node Lib089_Fn082 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn082(const FTransform& In0, FVector& Out1, int32 In2, const FString& In3, const FString& In4, bool In5, float In6);
+	/** Benchmark callable node Lib089_Fn083 with 6 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn083(const FString& In0, FString& Out1, bool In2, const TArray< int32 >& In3, const FString& In4, const FVector& In5);
+	/** Benchmark pure node Lib089_Fn084 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static FString Lib089_Fn084(FName In0, const FVector& In1, FName In2, FVector& Out3);
+	/** Benchmark callable node Lib089_Fn085 with 7 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn085(UObject* In0, const FTransform& In1, FName In2, int32& Out3, const FTransform& In4, const TArray< int32 >& In5, int32& Out6);
+	/** Benchmark latent node Lib089_Fn086 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32 In1, float In2);
+	/** Benchmark latent node Lib089_Fn087 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn087(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0);
+	/** Benchmark callable node Lib089_Fn088 with 3 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn088(int32 In0, FString& Out1, float In2);
+	/** Benchmark pure node Lib089_Fn089 with 5 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn089(FString& Out0, const TArray< int32 >& In1, const FTransform& In2, const FTransform& In3, FName In4);
+	/** Benchmark pure node Lib089_Fn090 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static int32 Lib089_Fn090(FVector& Out0, FVector& Out1, float In2, bool In3, int32& Out4, FString& Out5, const FString& In6);
+	/** Benchmark callable node Lib089_Fn091 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn091(const FTransform& In0, const FVector& In1, FName In2, FVector& Out3, const FTransform& In4, const FVector& In5, float In6, int32 In7);
+	/** Benchmark callable node Lib089_Fn092 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn092(const TArray< int32 >& In0, const FTransform& In1, int32& Out2, UObject* In3, const FVector& In4);
+	/** Benchmark pure node Lib089_Fn093 with 8 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static bool Lib089_Fn093(const FVector& In0, const TArray< int32 >& In1, bool In2, const FVector& In3, FString& Out4, const FString& In5, float In6, int32 In7);
+	/** Benchmark pure node Lib089_Fn094 with 4 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn094(int32 In0, FString& Out1, bool In2, UObject* In3);
+	/** Benchmark callable node Lib089_Fn095 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static FVector Lib089_Fn095(FString& Out0, UObject* In1, FString& Out2, float In3, int32 In4);
+	/** Benchmark callable node Lib089_Fn096 with 5 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn096(float In0, const FString& In1, int32& Out2, int32 In3, FVector& Out4);
+	/** Benchmark latent node Lib089_Fn097 with 8 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void Lib089_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, float In1, const FString& In2, int32 In3, FName In4, int32& Out5);
+	/** Benchmark pure node Lib089_Fn098 with 7 parameters. */
+	UFUNCTION(BlueprintPure, Category = "KDG Bench|Lib089")
+	static float Lib089_Fn098(const TArray< int32 >& In0, int32& Out1, FString& Out2, FVector& Out3, float In4, int32& Out5, const FTransform& In6);
+	/** Benchmark callable node Lib089_Fn099 with 4 parameters. */
+	UFUNCTION(BlueprintCallable, Category = "KDG Bench|Lib089")
+	static void Lib089_Fn099(FName In0, FName In1, FString& Out2, const FVector& In3);
+};
+
@@ -0,0 +1,1020 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2016-2017 Cameron Angus. All Rights Reserved.
+
+// Generated by GenerateBenchmarkClasses.py, do not edit.
+
+#include "KDGBenchLibraries_9.h"
+
+FString UKDGBenchLib_090::Lib090_Fn000(FVector& Out0, const FTransform& In1, const FString& In2) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn001(const FString& In0) { return {}; }
+FVector UKDGBenchLib_090::Lib090_Fn002(FVector& Out0, const FString& In1, FName In2, FName In3, bool In4, FName In5) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn003(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0) {}
+float UKDGBenchLib_090::Lib090_Fn004(const TArray< int32 >& In0, float In1, FName In2, const FString& In3, float In4, const FString& In5, float In6, bool In7) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn005() { return {}; }
+float UKDGBenchLib_090::Lib090_Fn006(int32& Out0, const TArray< int32 >& In1, int32& Out2, FName In3) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, UObject* In1) {}
+int32 UKDGBenchLib_090::Lib090_Fn008(int32 In0, const FVector& In1, const TArray< int32 >& In2, FString& Out3, int32 In4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn009(const FString& In0, int32 In1, FName In2) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn010(bool In0, FVector& Out1, FVector& Out2, float In3, const TArray< int32 >& In4, const TArray< int32 >& In5) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn011(const FTransform& In0, FName In1) {}
+bool UKDGBenchLib_090::Lib090_Fn012(const FString& In0, const FTransform& In1, UObject* In2, const TArray< int32 >& In3, const FTransform& In4, FVector& Out5) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn013(float In0, FString& Out1, const FString& In2, bool In3, UObject* In4) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn014(FName In0, FVector& Out1, const TArray< int32 >& In2) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn015(int32 In0, const FString& In1, FString& Out2, const FVector& In3, UObject* In4, FName In5) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn016(int32 In0, FName In1, const FTransform& In2, const FVector& In3, bool In4) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn017(bool In0, int32 In1, FName In2, bool In3, int32 In4, FName In5) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn018(UObject* In0, const TArray< int32 >& In1, const FTransform& In2) {}
+bool UKDGBenchLib_090::Lib090_Fn019(FVector& Out0, int32 In1, FVector& Out2) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn020(int32& Out0, const FVector& In1, float In2, bool In3, FName In4, const TArray< int32 >& In5, UObject* In6, const FVector& In7) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn021(const TArray< int32 >& In0) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn022(FString& Out0, FString& Out1, const FString& In2, FVector& Out3, const FString& In4, bool In5, FVector& Out6) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn023(FString& Out0, FVector& Out1, FVector& Out2, int32 In3, FVector& Out4, int32& Out5, const FTransform& In6) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn024(FName In0, FString& Out1) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn025(const FVector& In0, FString& Out1, float In2, const FTransform& In3, FString& Out4, const FTransform& In5, UObject* In6, int32& Out7) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn026(bool In0, UObject* In1, const FTransform& In2, FName In3, bool In4) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn027(const FTransform& In0, FString& Out1, UObject* In2, bool In3) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn028(bool In0, int32& Out1, UObject* In2) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn029(int32& Out0, int32 In1, const FTransform& In2, FString& Out3, FName In4, const FVector& In5) {}
+int32 UKDGBenchLib_090::Lib090_Fn030(FVector& Out0, float In1, FString& Out2, const TArray< int32 >& In3, const FVector& In4) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FTransform& In1, int32 In2, int32 In3, FVector& Out4, const TArray< int32 >& In5, const FVector& In6, const TArray< int32 >& In7) {}
+bool UKDGBenchLib_090::Lib090_Fn032(FVector& Out0, FVector& Out1, int32& Out2, FVector& Out3) { return {}; }
+FVector UKDGBenchLib_090::Lib090_Fn033(int32& Out0, const FVector& In1, FString& Out2, const FVector& In3, UObject* In4) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn034(FString& Out0, UObject* In1, bool In2, const FVector& In3, FString& Out4, int32& Out5) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn035(FVector& Out0, const FString& In1, FName In2, const FTransform& In3, int32& Out4, FString& Out5, float In6) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FTransform& In1) {}
+int32 UKDGBenchLib_090::Lib090_Fn037(int32& Out0, bool In1, UObject* In2, float In3) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn038(float In0) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn039(bool In0, int32 In1, int32 In2, int32& Out3, FString& Out4, const FString& In5, int32& Out6) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn040(float In0, const FVector& In1, FName In2, const FVector& In3, float In4, FName In5, UObject* In6, FString& Out7) { return {}; }
+FVector UKDGBenchLib_090::Lib090_Fn041(UObject* In0, FName In1) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn042(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_090::Lib090_Fn043(FString& Out0, int32 In1, const TArray< int32 >& In2, FName In3, UObject* In4, const FString& In5) { return {}; }
+FVector UKDGBenchLib_090::Lib090_Fn044(FVector& Out0) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn045(float In0, UObject* In1, int32& Out2, UObject* In3, FVector& Out4, const FTransform& In5, FString& Out6) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn046(int32 In0, bool In1, int32& Out2) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn047(bool In0, UObject* In1, int32& Out2) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn048(bool In0, UObject* In1, const FTransform& In2, FString& Out3, UObject* In4, FString& Out5, int32& Out6) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn049(int32 In0, int32& Out1, const FString& In2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn050(UObject* In0) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn051(const FTransform& In0) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, UObject* In1) {}
+float UKDGBenchLib_090::Lib090_Fn053(bool In0, FName In1, const FVector& In2, float In3, bool In4, FString& Out5, FName In6, const FString& In7) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn054(float In0, const FString& In1, const FString& In2, UObject* In3, const FTransform& In4, FName In5, const FVector& In6) {}
+void UKDGBenchLib_090::Lib090_Fn055(const FTransform& In0) {}
+FString UKDGBenchLib_090::Lib090_Fn056(bool In0) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn057(const FString& In0, FString& Out1, const FString& In2) { return {}; }
+FVector UKDGBenchLib_090::Lib090_Fn058(FName In0, FString& Out1, int32 In2, const FTransform& In3) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn059(float In0, float In1, const TArray< int32 >& In2, float In3, FVector& Out4) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn060(bool In0, const FString& In1, FName In2, const FTransform& In3, FString& Out4) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn061() { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn062(FVector& Out0, FName In1, FString& Out2, FVector& Out3, float In4) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn063(FName In0, int32 In1, const FString& In2) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn064(const TArray< int32 >& In0, const FString& In1, const FVector& In2, FVector& Out3, int32 In4, int32& Out5, const FString& In6, FName In7) {}
+FVector UKDGBenchLib_090::Lib090_Fn065(FString& Out0, int32 In1) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FString& In1, UObject* In2, bool In3, UObject* In4) {}
+int32 UKDGBenchLib_090::Lib090_Fn067(const FTransform& In0, FString& Out1, const FTransform& In2, bool In3, FName In4, UObject* In5) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn068(UObject* In0, bool In1, const FString& In2) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn069(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, int32& Out1, FVector& Out2, const FString& In3, bool In4) {}
+FString UKDGBenchLib_090::Lib090_Fn070(FString& Out0, const TArray< int32 >& In1, const FTransform& In2, int32 In3, FString& Out4, bool In5) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn071(const FTransform& In0, FName In1, const FTransform& In2) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn072(UObject* In0, UObject* In1, const FVector& In2) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn073(const TArray< int32 >& In0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3, UObject* In4, FString& Out5, const FString& In6) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn074(float In0, const FVector& In1, const FString& In2, FVector& Out3) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn075(const FString& In0, const FTransform& In1, const FTransform& In2, UObject* In3) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn076(UObject* In0, FVector& Out1, const FString& In2, float In3, int32 In4) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn077(int32 In0, bool In1, int32 In2, const FTransform& In3, FVector& Out4, const FVector& In5, const FTransform& In6) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn078(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, bool In1) {}
+FVector UKDGBenchLib_090::Lib090_Fn079(const FTransform& In0, FVector& Out1, FString& Out2, const FVector& In3, FString& Out4, FVector& Out5) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn080(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1, bool In2, const FVector& In3, FName In4) {}
+FString UKDGBenchLib_090::Lib090_Fn081(int32 In0, const FTransform& In1, int32 In2, float In3, bool In4) { return {}; }
+FVector UKDGBenchLib_090::Lib090_Fn082(int32& Out0, int32 In1) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn083(int32 In0, FString& Out1, int32 In2) {}
+int32 UKDGBenchLib_090::Lib090_Fn084(const FString& In0, const FString& In1, UObject* In2, const FVector& In3, const FString& In4) { return {}; }
+FVector UKDGBenchLib_090::Lib090_Fn085(const FString& In0, const TArray< int32 >& In1, FString& Out2, FVector& Out3, const FString& In4, const TArray< int32 >& In5) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn086(int32& Out0, bool In1) { return {}; }
+void UKDGBenchLib_090::Lib090_Fn087(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0) {}
+bool UKDGBenchLib_090::Lib090_Fn088(UObject* In0) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn089(int32 In0, bool In1) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn090(const FVector& In0, UObject* In1, const FTransform& In2) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn091() { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn092(const FTransform& In0, const FString& In1, const FString& In2, int32& Out3, const FVector& In4, FVector& Out5) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn093(bool In0) { return {}; }
+int32 UKDGBenchLib_090::Lib090_Fn094() { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn095(float In0, int32& Out1, int32& Out2, UObject* In3, FString& Out4) { return {}; }
+float UKDGBenchLib_090::Lib090_Fn096() { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn097(float In0, const TArray< int32 >& In1, float In2, FVector& Out3) { return {}; }
+bool UKDGBenchLib_090::Lib090_Fn098(int32 In0, FName In1, int32& Out2, const FTransform& In3, int32& Out4, const FVector& In5, bool In6, int32 In7) { return {}; }
+FString UKDGBenchLib_090::Lib090_Fn099() { return {}; }
+
+FVector UKDGBenchLib_091::Lib091_Fn000(int32 In0, const TArray< int32 >& In1) { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn001(FName In0, FString& Out1, float In2, FVector& Out3) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn002(bool In0, const FVector& In1, const FString& In2, int32 In3, const TArray< int32 >& In4, const FVector& In5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn003(bool In0, const FVector& In1, const FString& In2, FString& Out3, int32& Out4) { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn004(FName In0) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn005() {}
+int32 UKDGBenchLib_091::Lib091_Fn006(bool In0, FString& Out1, const FVector& In2) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn007(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FVector& Out1, int32 In2, const FString& In3, const TArray< int32 >& In4, const FTransform& In5, bool In6, UObject* In7) {}
+bool UKDGBenchLib_091::Lib091_Fn008(const FString& In0, float In1, FVector& Out2, int32& Out3, FName In4, FString& Out5, UObject* In6) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FString& Out1, const TArray< int32 >& In2, UObject* In3, int32 In4, const FString& In5, float In6) {}
+bool UKDGBenchLib_091::Lib091_Fn010(const TArray< int32 >& In0, UObject* In1) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn011(FName In0, const FTransform& In1, const FVector& In2, FVector& Out3, bool In4) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn012(float In0, UObject* In1, int32 In2, bool In3, const TArray< int32 >& In4, int32& Out5, const FVector& In6) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn013(UObject* In0, FName In1, FString& Out2, const FVector& In3, bool In4, bool In5, int32& Out6, float In7) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn014(const FTransform& In0, const TArray< int32 >& In1, int32& Out2, FString& Out3, const FTransform& In4, FString& Out5) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn015(FVector& Out0) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn016(bool In0, FString& Out1, const FVector& In2, const FString& In3, FName In4) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn017() { return {}; }
+float UKDGBenchLib_091::Lib091_Fn018(bool In0, const FVector& In1, const FTransform& In2) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn019(int32& Out0, float In1, bool In2, const FVector& In3, const TArray< int32 >& In4, const FTransform& In5) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn020(FName In0, float In1, FString& Out2, UObject* In3, FString& Out4, FString& Out5) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn021() { return {}; }
+float UKDGBenchLib_091::Lib091_Fn022(FName In0, UObject* In1, const FString& In2, UObject* In3, FVector& Out4) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn023(const FTransform& In0, int32 In1, bool In2) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn024() { return {}; }
+void UKDGBenchLib_091::Lib091_Fn025(FVector& Out0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3) {}
+FString UKDGBenchLib_091::Lib091_Fn026(float In0, FVector& Out1, int32& Out2, float In3, float In4, const FTransform& In5) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn027(const TArray< int32 >& In0, const FVector& In1, int32& Out2, UObject* In3, FString& Out4) {}
+int32 UKDGBenchLib_091::Lib091_Fn028(float In0, const TArray< int32 >& In1, float In2, const FString& In3, bool In4) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn029(bool In0) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn030(const FVector& In0, const FVector& In1) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn031(FVector& Out0, UObject* In1, FString& Out2, const FString& In3) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn032(const FVector& In0, const FVector& In1, UObject* In2) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn033() { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn034(const FVector& In0, const FString& In1, FString& Out2, UObject* In3, const TArray< int32 >& In4, const FVector& In5) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn035(float In0, float In1, const TArray< int32 >& In2, FName In3, const FVector& In4, const FTransform& In5, bool In6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn036() { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn037() { return {}; }
+float UKDGBenchLib_091::Lib091_Fn038(const FVector& In0, bool In1) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn039(const TArray< int32 >& In0, int32 In1) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn040(FString& Out0, const FVector& In1, FString& Out2, float In3, int32& Out4, bool In5, FString& Out6, const FVector& In7) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn041(FString& Out0, FName In1, const TArray< int32 >& In2, const FVector& In3, FString& Out4, int32& Out5, float In6) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn042(const FTransform& In0, UObject* In1, const FVector& In2, const FVector& In3, UObject* In4, float In5) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn043(const FVector& In0, const FTransform& In1, int32 In2, int32 In3, FString& Out4) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn044(FString& Out0, int32 In1, const TArray< int32 >& In2, const FString& In3, FName In4, FVector& Out5) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn045(const FString& In0, FString& Out1, FVector& Out2) { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn046(float In0, bool In1, float In2, const FVector& In3) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn047(int32& Out0, int32& Out1, const FString& In2, int32 In3, int32 In4, float In5, const TArray< int32 >& In6) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn048() { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn049(bool In0, const FVector& In1, const TArray< int32 >& In2, const FVector& In3) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn050(FVector& Out0, UObject* In1, int32 In2, const FTransform& In3, int32& Out4) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn051(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_091::Lib091_Fn052(const FString& In0, int32 In1) {}
+void UKDGBenchLib_091::Lib091_Fn053(float In0, float In1, const FString& In2, const FTransform& In3, FName In4, FString& Out5, const FVector& In6) {}
+int32 UKDGBenchLib_091::Lib091_Fn054(FString& Out0, int32 In1, UObject* In2, bool In3, FString& Out4, int32& Out5) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn055(FName In0, const FVector& In1, const FString& In2, const FString& In3, const FVector& In4, const FVector& In5) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn056(const FString& In0, float In1, const TArray< int32 >& In2, const FString& In3, FName In4, FVector& Out5, bool In6) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn057(const FVector& In0, const FTransform& In1, FName In2, UObject* In3, FVector& Out4, bool In5, const FVector& In6) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32 In1, const FTransform& In2, const TArray< int32 >& In3) {}
+void UKDGBenchLib_091::Lib091_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FVector& In1, const TArray< int32 >& In2, const FTransform& In3, FVector& Out4, FName In5, const FVector& In6) {}
+FVector UKDGBenchLib_091::Lib091_Fn060(const FString& In0, const FTransform& In1, float In2, UObject* In3, const FString& In4, const FString& In5) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn061(const FString& In0, int32& Out1, float In2, const TArray< int32 >& In3, const FTransform& In4, int32& Out5) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0) {}
+int32 UKDGBenchLib_091::Lib091_Fn063(const FString& In0, UObject* In1, bool In2) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn064(FString& Out0, int32& Out1, const FTransform& In2, const FString& In3, FName In4, UObject* In5, const FVector& In6, FName In7) {}
+float UKDGBenchLib_091::Lib091_Fn065(const FVector& In0, UObject* In1, const FString& In2, FName In3, FName In4, UObject* In5, bool In6, int32& Out7) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn066(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0) {}
+FVector UKDGBenchLib_091::Lib091_Fn067(FString& Out0, int32& Out1, bool In2, UObject* In3, int32 In4, UObject* In5, int32 In6, FString& Out7) { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn068(const FString& In0, float In1, UObject* In2, FString& Out3, const TArray< int32 >& In4, const TArray< int32 >& In5, float In6) { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn069(UObject* In0, bool In1, const TArray< int32 >& In2, FVector& Out3, const FString& In4, FString& Out5, const FString& In6, FVector& Out7) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn070(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FName In1, int32& Out2, const FString& In3, const FString& In4, float In5, const TArray< int32 >& In6) {}
+void UKDGBenchLib_091::Lib091_Fn071(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, int32& Out1, int32& Out2, FVector& Out3, const TArray< int32 >& In4, const TArray< int32 >& In5, float In6, FName In7) {}
+void UKDGBenchLib_091::Lib091_Fn072(FName In0, float In1, const FVector& In2, UObject* In3) {}
+bool UKDGBenchLib_091::Lib091_Fn073(const FVector& In0, UObject* In1, float In2, int32& Out3, FName In4, FName In5, UObject* In6, int32& Out7) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn074(const FVector& In0, int32 In1) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn075() { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn076(float In0, const FVector& In1, bool In2, FName In3, int32 In4, FName In5) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn077(FName In0, const FVector& In1, const FString& In2, float In3, FName In4, bool In5, FVector& Out6, const FVector& In7) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn078(const FVector& In0) { return {}; }
+float UKDGBenchLib_091::Lib091_Fn079(FVector& Out0, int32 In1, FVector& Out2, int32& Out3, FVector& Out4, const FTransform& In5, float In6) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn080(FString& Out0, FString& Out1) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn081(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3, const FTransform& In4, FString& Out5, float In6) {}
+float UKDGBenchLib_091::Lib091_Fn082(FVector& Out0, float In1) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn083(const FTransform& In0, const FString& In1, bool In2, const FVector& In3, FName In4) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn084(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FVector UKDGBenchLib_091::Lib091_Fn085(FString& Out0, const FTransform& In1, FString& Out2, int32& Out3, int32 In4, bool In5, UObject* In6, bool In7) { return {}; }
+void UKDGBenchLib_091::Lib091_Fn086(const FVector& In0, int32& Out1, UObject* In2, bool In3) {}
+void UKDGBenchLib_091::Lib091_Fn087(float In0, FName In1, const TArray< int32 >& In2, const FTransform& In3, FVector& Out4, const FVector& In5) {}
+int32 UKDGBenchLib_091::Lib091_Fn088(int32& Out0, bool In1, int32& Out2, const FTransform& In3, int32 In4, FString& Out5, FName In6) { return {}; }
+int32 UKDGBenchLib_091::Lib091_Fn089() { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn090() { return {}; }
+void UKDGBenchLib_091::Lib091_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FString& Out1, const FVector& In2, int32 In3, FName In4) {}
+int32 UKDGBenchLib_091::Lib091_Fn092(UObject* In0, int32 In1, const FVector& In2) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn093() { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn094(const FString& In0, float In1, const FVector& In2, const FVector& In3, FVector& Out4) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn095(FString& Out0) { return {}; }
+FVector UKDGBenchLib_091::Lib091_Fn096(UObject* In0, bool In1, bool In2, const FVector& In3, const FVector& In4) { return {}; }
+bool UKDGBenchLib_091::Lib091_Fn097(int32 In0, int32 In1, int32 In2) { return {}; }
+FString UKDGBenchLib_091::Lib091_Fn098() { return {}; }
+void UKDGBenchLib_091::Lib091_Fn099(const FTransform& In0, const FString& In1) {}
+
+void UKDGBenchLib_092::Lib092_Fn000(const TArray< int32 >& In0, const TArray< int32 >& In1, UObject* In2, int32 In3, FVector& Out4, int32 In5, FVector& Out6, bool In7) {}
+FVector UKDGBenchLib_092::Lib092_Fn001(const FVector& In0, const FVector& In1, FString& Out2, const FTransform& In3, const FString& In4, int32& Out5) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn002(const TArray< int32 >& In0, UObject* In1, bool In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn003(const FString& In0) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn004(int32& Out0) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn005(const FString& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, const TArray< int32 >& In3, const FVector& In4, int32 In5, const FVector& In6, const FString& In7) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn006(const FString& In0, FName In1, bool In2, int32 In3) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn007(UObject* In0, int32 In1) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn008(int32 In0, bool In1, float In2, bool In3) {}
+void UKDGBenchLib_092::Lib092_Fn009(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_092::Lib092_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+void UKDGBenchLib_092::Lib092_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FString& In1, int32& Out2, const TArray< int32 >& In3, FString& Out4, FVector& Out5, const FTransform& In6) {}
+void UKDGBenchLib_092::Lib092_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, float In3, FName In4, const TArray< int32 >& In5) {}
+bool UKDGBenchLib_092::Lib092_Fn013(const FVector& In0, UObject* In1, int32 In2, FVector& Out3, FVector& Out4, FVector& Out5) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, float In1, const FVector& In2, UObject* In3, const FVector& In4, FString& Out5, const TArray< int32 >& In6) {}
+int32 UKDGBenchLib_092::Lib092_Fn015(int32& Out0, bool In1, float In2, FName In3, FString& Out4, FString& Out5) { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn016(bool In0, int32& Out1, const FVector& In2, float In3) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn017(int32 In0, FString& Out1, UObject* In2) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn018(float In0, FVector& Out1, int32& Out2, float In3, const FString& In4, FVector& Out5, const FVector& In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn019(const FString& In0, float In1, FString& Out2) { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn020(bool In0, UObject* In1, FVector& Out2, bool In3, const FVector& In4) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, UObject* In2, const FString& In3, int32 In4) {}
+bool UKDGBenchLib_092::Lib092_Fn022() { return {}; }
+float UKDGBenchLib_092::Lib092_Fn023(int32& Out0, const FString& In1, FVector& Out2, int32 In3, FVector& Out4, FName In5, bool In6) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn024(float In0) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn025(const FTransform& In0, FVector& Out1, bool In2, FVector& Out3, int32 In4, UObject* In5, FString& Out6) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn026(bool In0, int32 In1, const TArray< int32 >& In2, const FVector& In3, FString& Out4, int32& Out5, bool In6) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn027(int32 In0, const FString& In1, float In2, const FTransform& In3, float In4, const FTransform& In5, const FString& In6, int32& Out7) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn028(const FTransform& In0, bool In1, const FVector& In2, UObject* In3, int32& Out4, const FString& In5, const FTransform& In6) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn029(int32 In0, FName In1, int32 In2, const TArray< int32 >& In3, FString& Out4, const FVector& In5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn030(int32 In0, FVector& Out1, const FString& In2, FName In3, const FString& In4, FString& Out5) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, bool In2, const FVector& In3, int32& Out4, const FTransform& In5, const FVector& In6, int32& Out7) {}
+int32 UKDGBenchLib_092::Lib092_Fn032(bool In0) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn033(FName In0, FName In1, FName In2, FString& Out3, int32& Out4, FString& Out5) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn034(const FTransform& In0, FVector& Out1) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn035(FName In0, FName In1, FString& Out2, FName In3) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn036(FName In0, bool In1, FName In2, float In3, UObject* In4) {}
+void UKDGBenchLib_092::Lib092_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, bool In1, const FVector& In2, FString& Out3) {}
+float UKDGBenchLib_092::Lib092_Fn038(int32& Out0, const FTransform& In1, int32 In2, const FVector& In3, const FVector& In4, const FString& In5, const FTransform& In6) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn039(const FVector& In0, const FString& In1, const FVector& In2, int32 In3, const TArray< int32 >& In4) { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn040(const FTransform& In0, FString& Out1, float In2, bool In3, int32 In4, FVector& Out5) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn041(FString& Out0, const TArray< int32 >& In1, FVector& Out2, FString& Out3, const FVector& In4, FName In5, const TArray< int32 >& In6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn042(const FString& In0, const FVector& In1, FVector& Out2, float In3, int32& Out4, int32 In5, FString& Out6, int32& Out7) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn043(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_092::Lib092_Fn044(FVector& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2, const FString& In3, float In4, const TArray< int32 >& In5) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn045(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FVector& Out1, UObject* In2) {}
+float UKDGBenchLib_092::Lib092_Fn046() { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn047(int32 In0, FString& Out1, bool In2, const FVector& In3) { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn048(FName In0, int32& Out1, int32 In2, FName In3, const FString& In4, float In5, FString& Out6, float In7) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn049(FName In0, FVector& Out1) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn050(FString& Out0, const FVector& In1, const FVector& In2, FString& Out3) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn051(bool In0, const TArray< int32 >& In1) {}
+FVector UKDGBenchLib_092::Lib092_Fn052(UObject* In0, const TArray< int32 >& In1, const FTransform& In2, float In3, int32& Out4) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn053(UObject* In0, FVector& Out1, int32& Out2) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn054(const FTransform& In0, FName In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn055(FVector& Out0, const FVector& In1) { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn056(const FTransform& In0, const FTransform& In1, float In2, const TArray< int32 >& In3, const FString& In4, FVector& Out5, FString& Out6, UObject* In7) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn057(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const TArray< int32 >& In1, const TArray< int32 >& In2) {}
+FVector UKDGBenchLib_092::Lib092_Fn058() { return {}; }
+void UKDGBenchLib_092::Lib092_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+int32 UKDGBenchLib_092::Lib092_Fn060(const FString& In0) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn061(FName In0, float In1, UObject* In2, bool In3, FString& Out4, FVector& Out5, FVector& Out6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn062(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1, int32& Out2, const FTransform& In3, const FVector& In4, FName In5, const FVector& In6) {}
+void UKDGBenchLib_092::Lib092_Fn063(const FTransform& In0, UObject* In1, int32& Out2, const FTransform& In3, const FTransform& In4, FVector& Out5, const FTransform& In6, const TArray< int32 >& In7) {}
+void UKDGBenchLib_092::Lib092_Fn064(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, FVector& Out2) {}
+bool UKDGBenchLib_092::Lib092_Fn065() { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn066(FString& Out0, const FVector& In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn067(const FVector& In0, FString& Out1, int32& Out2, const TArray< int32 >& In3, const FVector& In4, const TArray< int32 >& In5, int32& Out6, FVector& Out7) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn068(bool In0, FVector& Out1, int32 In2, FName In3, int32 In4) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn069(FString& Out0) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn070(const FTransform& In0, bool In1, const FString& In2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5, const FString& In6) { return {}; }
+float UKDGBenchLib_092::Lib092_Fn071(int32 In0) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn072(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FString& In1, bool In2, FString& Out3, int32& Out4, FString& Out5) {}
+float UKDGBenchLib_092::Lib092_Fn073() { return {}; }
+void UKDGBenchLib_092::Lib092_Fn074(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, int32& Out1, float In2) {}
+FVector UKDGBenchLib_092::Lib092_Fn075(int32 In0, FVector& Out1, const FVector& In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn076(FString& Out0, FVector& Out1, FVector& Out2, const FString& In3, float In4, const FString& In5) { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn077(FString& Out0) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn078(const FVector& In0) { return {}; }
+bool UKDGBenchLib_092::Lib092_Fn079(FVector& Out0, const TArray< int32 >& In1, FVector& Out2) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn080(bool In0, const FTransform& In1, int32 In2) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn081(const FVector& In0, const TArray< int32 >& In1) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn082() { return {}; }
+float UKDGBenchLib_092::Lib092_Fn083() { return {}; }
+void UKDGBenchLib_092::Lib092_Fn084() {}
+FVector UKDGBenchLib_092::Lib092_Fn085(const FString& In0, FString& Out1, const FTransform& In2, bool In3, FName In4, UObject* In5, bool In6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn086(FVector& Out0, int32& Out1, FString& Out2, const FTransform& In3, const FVector& In4, FVector& Out5) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn087(bool In0, UObject* In1, FVector& Out2, FVector& Out3, const FString& In4, bool In5, UObject* In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn088(int32& Out0, bool In1, const FString& In2, bool In3) {}
+void UKDGBenchLib_092::Lib092_Fn089(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, float In2, FName In3) {}
+int32 UKDGBenchLib_092::Lib092_Fn090(FName In0, FString& Out1, FVector& Out2, int32 In3, const TArray< int32 >& In4, FName In5, UObject* In6) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn091(int32& Out0) { return {}; }
+FVector UKDGBenchLib_092::Lib092_Fn092(const FString& In0, const FString& In1, const FTransform& In2, bool In3, const TArray< int32 >& In4, int32 In5, FString& Out6, const TArray< int32 >& In7) { return {}; }
+int32 UKDGBenchLib_092::Lib092_Fn093(int32 In0, int32 In1, FString& Out2, bool In3) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn094(const FTransform& In0, UObject* In1, int32& Out2, float In3, UObject* In4, const FTransform& In5, int32 In6) {}
+void UKDGBenchLib_092::Lib092_Fn095(const FString& In0) {}
+FString UKDGBenchLib_092::Lib092_Fn096(bool In0, const FString& In1, const TArray< int32 >& In2, int32 In3) { return {}; }
+void UKDGBenchLib_092::Lib092_Fn097(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0) {}
+FVector UKDGBenchLib_092::Lib092_Fn098(UObject* In0, UObject* In1, const FVector& In2, FName In3) { return {}; }
+FString UKDGBenchLib_092::Lib092_Fn099(const TArray< int32 >& In0, bool In1, int32 In2, const FString& In3, UObject* In4, const FVector& In5, const FTransform& In6, const FString& In7) { return {}; }
+
+void UKDGBenchLib_093::Lib093_Fn000(float In0, int32 In1, FName In2, UObject* In3) {}
+FString UKDGBenchLib_093::Lib093_Fn001(float In0, const TArray< int32 >& In1, bool In2, const FString& In3, int32 In4, UObject* In5, const FTransform& In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn002() { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn003(UObject* In0, const TArray< int32 >& In1, int32 In2, FName In3) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn004(const TArray< int32 >& In0, const TArray< int32 >& In1, bool In2) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn005(int32 In0, const FTransform& In1) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn006() { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn007(const FVector& In0, float In1, int32 In2, FVector& Out3) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn008(FString& Out0, bool In1, int32 In2) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn009(const FVector& In0, FString& Out1, int32& Out2) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn010(int32 In0, int32& Out1, float In2, UObject* In3, FString& Out4, float In5, FVector& Out6) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn011(FVector& Out0, const FString& In1, FString& Out2, const FString& In3) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FVector& Out1, const FVector& In2, const FString& In3, int32& Out4, float In5, int32& Out6) {}
+int32 UKDGBenchLib_093::Lib093_Fn013(FString& Out0, const FVector& In1, const TArray< int32 >& In2, const FString& In3) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn014(FString& Out0, const FVector& In1, float In2) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn015() { return {}; }
+void UKDGBenchLib_093::Lib093_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, bool In1, FVector& Out2, bool In3, float In4) {}
+FString UKDGBenchLib_093::Lib093_Fn017(float In0, bool In1) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn018(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn019(const TArray< int32 >& In0, FVector& Out1, bool In2, int32& Out3, int32& Out4, UObject* In5, const FString& In6) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn020(FString& Out0, int32& Out1, UObject* In2, FVector& Out3, FName In4, FString& Out5, const TArray< int32 >& In6) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn021(FName In0, UObject* In1, const FVector& In2, bool In3, bool In4, float In5, bool In6, FString& Out7) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn022(const TArray< int32 >& In0, float In1, const FString& In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn023(UObject* In0, const FVector& In1, const FVector& In2) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn024(FName In0, UObject* In1, int32& Out2) {}
+void UKDGBenchLib_093::Lib093_Fn025(float In0, const FTransform& In1, FVector& Out2, const FString& In3, int32& Out4, const TArray< int32 >& In5) {}
+int32 UKDGBenchLib_093::Lib093_Fn026(UObject* In0, float In1, const FString& In2, int32& Out3, bool In4, const FVector& In5, float In6, bool In7) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FString& In1, float In2) {}
+void UKDGBenchLib_093::Lib093_Fn028(FVector& Out0, int32 In1, const FString& In2, bool In3, int32& Out4) {}
+void UKDGBenchLib_093::Lib093_Fn029(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FVector& In1) {}
+FVector UKDGBenchLib_093::Lib093_Fn030(FVector& Out0, FName In1, int32& Out2, int32& Out3, UObject* In4, int32& Out5) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, FName In2, const FVector& In3) {}
+int32 UKDGBenchLib_093::Lib093_Fn032(FVector& Out0, int32 In1) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn033(FName In0, const FTransform& In1, FName In2, const FVector& In3, const FTransform& In4, const FString& In5) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn034(int32 In0, FName In1, bool In2, int32 In3, int32& Out4, const FString& In5, const FString& In6, bool In7) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn035(int32& Out0, const TArray< int32 >& In1, const FVector& In2, FVector& Out3, int32& Out4, const FTransform& In5, UObject* In6) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn036(bool In0, bool In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn037(FVector& Out0) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn038(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0) {}
+int32 UKDGBenchLib_093::Lib093_Fn039(UObject* In0, const FString& In1, FName In2, bool In3, FName In4, bool In5, float In6, const FString& In7) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn040(int32 In0, int32 In1, const TArray< int32 >& In2, const FString& In3) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn041(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn042(FString& Out0, FVector& Out1, int32& Out2, const FVector& In3, FVector& Out4) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn043(const FString& In0, bool In1, FString& Out2, const FTransform& In3, const FTransform& In4, UObject* In5, const FTransform& In6, int32 In7) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, bool In1, FName In2, const FTransform& In3) {}
+FVector UKDGBenchLib_093::Lib093_Fn045() { return {}; }
+void UKDGBenchLib_093::Lib093_Fn046(FVector& Out0, const FVector& In1, UObject* In2, int32 In3, bool In4) {}
+int32 UKDGBenchLib_093::Lib093_Fn047() { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn048(FName In0, const FVector& In1, FString& Out2) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn049(int32 In0, float In1, FVector& Out2) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn050(FName In0, int32 In1, const FString& In2, FName In3) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn051(const FTransform& In0, UObject* In1, int32& Out2, const FVector& In3) {}
+int32 UKDGBenchLib_093::Lib093_Fn052(const FTransform& In0) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn053(bool In0, float In1, const FTransform& In2, UObject* In3, UObject* In4, const FString& In5, int32 In6) {}
+FString UKDGBenchLib_093::Lib093_Fn054(const TArray< int32 >& In0, FString& Out1, int32& Out2, FString& Out3, FVector& Out4) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn055(UObject* In0) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn056() { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn057(int32& Out0, UObject* In1, const FTransform& In2, FName In3, UObject* In4) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn058(int32& Out0, int32 In1, FString& Out2, const FVector& In3, const FString& In4, FName In5) {}
+int32 UKDGBenchLib_093::Lib093_Fn059(const FVector& In0, FString& Out1, const TArray< int32 >& In2, float In3, const TArray< int32 >& In4, const FString& In5, UObject* In6, FVector& Out7) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn060(const FVector& In0, float In1) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn061() { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn062(int32 In0, const FVector& In1, const FTransform& In2, const FTransform& In3, int32& Out4, FName In5) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn063(int32& Out0, int32& Out1, FName In2, int32 In3, FName In4, FString& Out5, const TArray< int32 >& In6, const FTransform& In7) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn064(FName In0, FString& Out1, int32& Out2, const FString& In3, int32& Out4) {}
+void UKDGBenchLib_093::Lib093_Fn065(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FName In1, float In2, const TArray< int32 >& In3, float In4) {}
+int32 UKDGBenchLib_093::Lib093_Fn066(const FVector& In0, const FVector& In1, FString& Out2, float In3, float In4, float In5, float In6) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn067() { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn068() { return {}; }
+float UKDGBenchLib_093::Lib093_Fn069(const FVector& In0, float In1, bool In2, float In3, FString& Out4) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn070(float In0, UObject* In1, int32 In2, float In3, int32& Out4, const FTransform& In5, const FString& In6, int32& Out7) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn071(const FTransform& In0, FString& Out1, bool In2, FName In3, int32& Out4) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn072(int32& Out0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, int32 In1, bool In2, const FVector& In3) {}
+float UKDGBenchLib_093::Lib093_Fn074(FString& Out0) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn075(int32& Out0) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn076(const TArray< int32 >& In0, FVector& Out1, FName In2, FName In3, UObject* In4, UObject* In5, const TArray< int32 >& In6, float In7) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn077(const FVector& In0, float In1, UObject* In2) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn078(FVector& Out0) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn079(int32& Out0, UObject* In1) { return {}; }
+float UKDGBenchLib_093::Lib093_Fn080(const FTransform& In0, bool In1, const FString& In2, float In3) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn081(UObject* In0) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn082(UObject* In0, const FVector& In1, const TArray< int32 >& In2, const FTransform& In3, bool In4, FString& Out5) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn083(float In0, const FString& In1, FName In2, const TArray< int32 >& In3, FName In4, FName In5, FName In6, const FTransform& In7) {}
+bool UKDGBenchLib_093::Lib093_Fn084(bool In0, const TArray< int32 >& In1, bool In2, const FVector& In3, const TArray< int32 >& In4, const FString& In5, int32 In6) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn085(float In0, const TArray< int32 >& In1, FString& Out2, const FVector& In3, bool In4, FString& Out5) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn086() { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn087(const TArray< int32 >& In0, const TArray< int32 >& In1, int32& Out2, float In3) { return {}; }
+int32 UKDGBenchLib_093::Lib093_Fn088(float In0, FVector& Out1, const TArray< int32 >& In2, const TArray< int32 >& In3, const FVector& In4, FString& Out5, int32& Out6, int32& Out7) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn089() { return {}; }
+void UKDGBenchLib_093::Lib093_Fn090() {}
+FString UKDGBenchLib_093::Lib093_Fn091(const TArray< int32 >& In0, const FTransform& In1) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn092(const FVector& In0, UObject* In1, const FTransform& In2) {}
+int32 UKDGBenchLib_093::Lib093_Fn093(const FString& In0, const TArray< int32 >& In1, FString& Out2) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn094(const FString& In0, FString& Out1, FName In2, FVector& Out3, bool In4, UObject* In5, const FVector& In6) { return {}; }
+FVector UKDGBenchLib_093::Lib093_Fn095(const TArray< int32 >& In0, const TArray< int32 >& In1, int32 In2, const FTransform& In3, FName In4) { return {}; }
+FString UKDGBenchLib_093::Lib093_Fn096(FName In0, int32& Out1, const TArray< int32 >& In2, int32 In3, int32 In4, const FVector& In5, UObject* In6, const FVector& In7) { return {}; }
+bool UKDGBenchLib_093::Lib093_Fn097(FString& Out0, FVector& Out1, FName In2, const TArray< int32 >& In3) { return {}; }
+void UKDGBenchLib_093::Lib093_Fn098(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, bool In1, float In2) {}
+float UKDGBenchLib_093::Lib093_Fn099(const FVector& In0) { return {}; }
+
+FString UKDGBenchLib_094::Lib094_Fn000(float In0, const FVector& In1, int32& Out2, int32& Out3, FString& Out4, const FVector& In5, bool In6, UObject* In7) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+FVector UKDGBenchLib_094::Lib094_Fn002(const FVector& In0, float In1, FName In2, const TArray< int32 >& In3, bool In4) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn003(bool In0) {}
+bool UKDGBenchLib_094::Lib094_Fn004(const FVector& In0, const FVector& In1, bool In2, FName In3, bool In4, bool In5) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn005() { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn006(int32 In0, float In1, int32& Out2) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn007(UObject* In0, UObject* In1, FString& Out2, FString& Out3, const TArray< int32 >& In4, const FVector& In5, const FTransform& In6) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn008(bool In0, int32& Out1, float In2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn009(UObject* In0, float In1, const FTransform& In2) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn010(const FTransform& In0, const TArray< int32 >& In1, const FTransform& In2, UObject* In3) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FString& Out1, UObject* In2) {}
+void UKDGBenchLib_094::Lib094_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1) {}
+float UKDGBenchLib_094::Lib094_Fn013(float In0, UObject* In1) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn014(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0) {}
+FVector UKDGBenchLib_094::Lib094_Fn015(UObject* In0, const FTransform& In1, FVector& Out2, const TArray< int32 >& In3, const FString& In4, bool In5, int32& Out6) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn016(const FVector& In0, const TArray< int32 >& In1, float In2, int32 In3, FVector& Out4, const FString& In5, const FString& In6, float In7) {}
+FVector UKDGBenchLib_094::Lib094_Fn017(FVector& Out0) { return {}; }
+float UKDGBenchLib_094::Lib094_Fn018(int32& Out0) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn019(int32 In0, UObject* In1, const FString& In2) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn020(FString& Out0, const FTransform& In1, const FString& In2, const FTransform& In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, const FString& In1, int32 In2, int32& Out3, const FTransform& In4) {}
+bool UKDGBenchLib_094::Lib094_Fn022(float In0, FVector& Out1, FName In2, bool In3, bool In4, int32& Out5, int32 In6) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn023() { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn024(int32& Out0, float In1) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn025(const TArray< int32 >& In0, float In1, bool In2, bool In3, FVector& Out4, const FVector& In5, int32 In6, FString& Out7) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn026(FName In0) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn027(const FVector& In0, float In1) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn028(float In0, FVector& Out1, FVector& Out2, const FVector& In3, FName In4, float In5) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn029(float In0, float In1, const FString& In2, const FString& In3, int32& Out4) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn030(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, float In1, const FVector& In2, const FVector& In3, FString& Out4, int32& Out5, FString& Out6) {}
+int32 UKDGBenchLib_094::Lib094_Fn031(const FVector& In0, FVector& Out1, bool In2, int32& Out3, int32& Out4, const FString& In5, bool In6, int32& Out7) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn032(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FString& In1, const TArray< int32 >& In2, const FVector& In3, bool In4) {}
+void UKDGBenchLib_094::Lib094_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, float In1, float In2, const TArray< int32 >& In3, FString& Out4, FName In5) {}
+int32 UKDGBenchLib_094::Lib094_Fn034(bool In0, float In1, const FTransform& In2, int32& Out3, bool In4, UObject* In5) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn035(bool In0, const FVector& In1, float In2, const FString& In3) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn036(FName In0, bool In1, FName In2, bool In3) {}
+void UKDGBenchLib_094::Lib094_Fn037(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FString& In1, FName In2, const FString& In3, bool In4, int32& Out5) {}
+bool UKDGBenchLib_094::Lib094_Fn038(const TArray< int32 >& In0, FVector& Out1, int32& Out2, const TArray< int32 >& In3) { return {}; }
+float UKDGBenchLib_094::Lib094_Fn039(int32 In0, UObject* In1, int32 In2, const FVector& In3, const FString& In4, const FTransform& In5) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn040(const FVector& In0, const TArray< int32 >& In1, UObject* In2, int32& Out3) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn041(const FString& In0, FString& Out1, FName In2, int32 In3, int32 In4, FName In5) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn042(FVector& Out0, FString& Out1, float In2, FVector& Out3, UObject* In4, const FVector& In5) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn043(const FTransform& In0, UObject* In1, float In2, FName In3, const FString& In4, int32 In5) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn044(UObject* In0, int32& Out1, FVector& Out2, const TArray< int32 >& In3, int32& Out4, const FString& In5) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn045(FVector& Out0) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn046() { return {}; }
+float UKDGBenchLib_094::Lib094_Fn047(const FVector& In0, const FString& In1) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn048(const FString& In0, const TArray< int32 >& In1, float In2) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn049(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1, int32& Out2) {}
+void UKDGBenchLib_094::Lib094_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1, bool In2, FName In3, FVector& Out4, UObject* In5, int32& Out6, FVector& Out7) {}
+float UKDGBenchLib_094::Lib094_Fn051(FVector& Out0, UObject* In1, int32& Out2, const FString& In3, UObject* In4, FVector& Out5, FString& Out6) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn052(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, const FString& In2, FString& Out3, const FVector& In4, const FString& In5) {}
+int32 UKDGBenchLib_094::Lib094_Fn053() { return {}; }
+float UKDGBenchLib_094::Lib094_Fn054(bool In0, float In1, int32& Out2, const FString& In3, const TArray< int32 >& In4, float In5) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn055() { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn056(const FTransform& In0, const FTransform& In1, FString& Out2, int32& Out3, float In4, const TArray< int32 >& In5) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn057(bool In0) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn058(FVector& Out0) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn059(UObject* In0, int32 In1) { return {}; }
+float UKDGBenchLib_094::Lib094_Fn060(FName In0, FName In1, UObject* In2, FString& Out3, UObject* In4, int32& Out5, FName In6) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn061(const FTransform& In0, FVector& Out1, UObject* In2, const FTransform& In3, const TArray< int32 >& In4, int32& Out5) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn062(bool In0, float In1, const FTransform& In2, const FString& In3, UObject* In4, int32& Out5) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn063(const FString& In0, FName In1, UObject* In2, const FTransform& In3) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn064(const FTransform& In0, FVector& Out1, FName In2, UObject* In3, FName In4, bool In5, FString& Out6) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn065(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, int32 In2, FName In3) {}
+float UKDGBenchLib_094::Lib094_Fn066() { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn067(FVector& Out0, bool In1, const FTransform& In2, FVector& Out3, float In4, const FVector& In5, const TArray< int32 >& In6) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn068(int32& Out0, int32 In1) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn069(UObject* In0, FString& Out1, const FVector& In2, FString& Out3, int32& Out4) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn070(bool In0) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn071(bool In0, bool In1, FString& Out2) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn072() { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn073(FString& Out0, const FTransform& In1, const TArray< int32 >& In2, FName In3, const FVector& In4, const FString& In5, const FVector& In6, UObject* In7) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn074(UObject* In0, float In1, UObject* In2, float In3) {}
+FVector UKDGBenchLib_094::Lib094_Fn075(const TArray< int32 >& In0, int32 In1, UObject* In2, const FTransform& In3, const TArray< int32 >& In4, const TArray< int32 >& In5) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn076(const TArray< int32 >& In0, int32 In1, float In2, UObject* In3, FName In4, float In5, float In6, FString& Out7) { return {}; }
+float UKDGBenchLib_094::Lib094_Fn077(int32& Out0, FName In1, FVector& Out2, const FString& In3) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn078(const FVector& In0, int32& Out1) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn079(int32& Out0, const TArray< int32 >& In1, float In2, float In3, float In4, bool In5) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn080(float In0, FString& Out1, UObject* In2, const TArray< int32 >& In3, bool In4) { return {}; }
+FString UKDGBenchLib_094::Lib094_Fn081(FString& Out0, FString& Out1, float In2, FString& Out3, UObject* In4, FName In5, FString& Out6) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn082(const FTransform& In0, const FVector& In1, const FTransform& In2, const FString& In3) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn083(FString& Out0, float In1, FName In2, UObject* In3, bool In4, const FVector& In5) { return {}; }
+FVector UKDGBenchLib_094::Lib094_Fn084(const FVector& In0, const TArray< int32 >& In1, const FTransform& In2, const TArray< int32 >& In3, int32 In4, FName In5, const FString& In6, bool In7) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn085(int32& Out0, const FTransform& In1, int32& Out2, FVector& Out3) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn086(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, const FTransform& In1, const TArray< int32 >& In2, const FString& In3, const TArray< int32 >& In4, FString& Out5, int32& Out6) {}
+FString UKDGBenchLib_094::Lib094_Fn087(UObject* In0, int32 In1, const FString& In2, const FVector& In3, int32 In4, float In5) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn088(FVector& Out0, bool In1) {}
+bool UKDGBenchLib_094::Lib094_Fn089(FVector& Out0, const FString& In1, bool In2, UObject* In3, const TArray< int32 >& In4) { return {}; }
+int32 UKDGBenchLib_094::Lib094_Fn090(const FTransform& In0, const TArray< int32 >& In1, const TArray< int32 >& In2, bool In3, const FVector& In4, const FVector& In5, const FVector& In6, const FString& In7) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn091(const FVector& In0) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn092(bool In0) {}
+void UKDGBenchLib_094::Lib094_Fn093(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, float In1, UObject* In2, int32& Out3, const FVector& In4, const FVector& In5, int32 In6) {}
+FString UKDGBenchLib_094::Lib094_Fn094(const FVector& In0, float In1, float In2, const FString& In3, const FTransform& In4, FString& Out5, float In6, UObject* In7) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn095(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32 In1, const FString& In2) {}
+int32 UKDGBenchLib_094::Lib094_Fn096(FVector& Out0, UObject* In1, FVector& Out2) { return {}; }
+bool UKDGBenchLib_094::Lib094_Fn097(float In0) { return {}; }
+void UKDGBenchLib_094::Lib094_Fn098(int32 In0, float In1, FVector& Out2, bool In3, int32& Out4, const FString& In5) {}
+FVector UKDGBenchLib_094::Lib094_Fn099(int32 In0, UObject* In1, FVector& Out2) { return {}; }
+
+float UKDGBenchLib_095::Lib095_Fn000() { return {}; }
+void UKDGBenchLib_095::Lib095_Fn001(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, bool In1, int32 In2, bool In3, const FTransform& In4, FName In5, int32& Out6, bool In7) {}
+FVector UKDGBenchLib_095::Lib095_Fn002() { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn003(FVector& Out0) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, FString& Out1) {}
+int32 UKDGBenchLib_095::Lib095_Fn005(UObject* In0, FString& Out1, int32 In2, const FString& In3, const FVector& In4) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, FName In1, int32 In2, const TArray< int32 >& In3) {}
+void UKDGBenchLib_095::Lib095_Fn007(const FVector& In0, int32& Out1, const FString& In2, bool In3, float In4, FName In5, UObject* In6) {}
+FString UKDGBenchLib_095::Lib095_Fn008(UObject* In0, UObject* In1, const FTransform& In2, const TArray< int32 >& In3, FVector& Out4, float In5, bool In6) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn009(const FTransform& In0) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn010(int32& Out0, FString& Out1, FString& Out2, FString& Out3, UObject* In4, const TArray< int32 >& In5) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn011() { return {}; }
+float UKDGBenchLib_095::Lib095_Fn012(FString& Out0, const FVector& In1, float In2, FName In3, FString& Out4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn013(FVector& Out0, float In1, int32& Out2, FString& Out3) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn014(UObject* In0) { return {}; }
+bool UKDGBenchLib_095::Lib095_Fn015(FName In0, FVector& Out1, FName In2, UObject* In3, int32 In4, FName In5, float In6, const TArray< int32 >& In7) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn016(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, UObject* In1, FString& Out2, FString& Out3, UObject* In4, FName In5, const FVector& In6) {}
+FString UKDGBenchLib_095::Lib095_Fn017(FString& Out0, FName In1, int32 In2, const FString& In3, const TArray< int32 >& In4, const FVector& In5, const TArray< int32 >& In6, int32& Out7) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn018(bool In0, int32 In1, int32& Out2) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn019(const FTransform& In0) {}
+int32 UKDGBenchLib_095::Lib095_Fn020(UObject* In0, const FVector& In1, int32 In2, FVector& Out3, bool In4, FName In5, const FVector& In6) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn021(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const TArray< int32 >& In1, FName In2, const TArray< int32 >& In3) {}
+FString UKDGBenchLib_095::Lib095_Fn022(FVector& Out0, UObject* In1, float In2) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn023(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn024(UObject* In0, const FString& In1, const TArray< int32 >& In2, int32 In3, const FVector& In4) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn025(int32& Out0) {}
+void UKDGBenchLib_095::Lib095_Fn026(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FTransform& In1, bool In2, const FTransform& In3, const FVector& In4, int32 In5) {}
+void UKDGBenchLib_095::Lib095_Fn027(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0) {}
+float UKDGBenchLib_095::Lib095_Fn028(int32& Out0, float In1, bool In2, bool In3, FName In4, const FVector& In5, int32& Out6) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn029(int32 In0, bool In1, UObject* In2) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn030() { return {}; }
+void UKDGBenchLib_095::Lib095_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, FVector& Out1, FVector& Out2, FName In3) {}
+FString UKDGBenchLib_095::Lib095_Fn032(FName In0, FVector& Out1) { return {}; }
+bool UKDGBenchLib_095::Lib095_Fn033(int32& Out0, int32& Out1, int32 In2, FVector& Out3) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FVector& In1, const FString& In2, FString& Out3, bool In4, bool In5) {}
+FVector UKDGBenchLib_095::Lib095_Fn035(const TArray< int32 >& In0, UObject* In1, const FString& In2, UObject* In3, float In4, const FTransform& In5, const FTransform& In6, FString& Out7) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn036(UObject* In0) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn037(const FTransform& In0, const FTransform& In1, FName In2, FVector& Out3) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn038(const FString& In0, FName In1, int32 In2, FVector& Out3, bool In4, int32 In5, FVector& Out6) {}
+bool UKDGBenchLib_095::Lib095_Fn039(FName In0, UObject* In1, UObject* In2, FString& Out3, FString& Out4, FString& Out5) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn040(const FString& In0, const FString& In1, UObject* In2, const FString& In3, int32 In4, FString& Out5, FString& Out6, FVector& Out7) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn041(const TArray< int32 >& In0, int32 In1, int32 In2, int32& Out3, bool In4, float In5, int32 In6, FString& Out7) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn042(const FTransform& In0, int32 In1, const FVector& In2, const TArray< int32 >& In3) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn043(const FTransform& In0, const FString& In1, FVector& Out2, bool In3, FVector& Out4, FString& Out5) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn044(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, bool In1, bool In2, const FVector& In3) {}
+FVector UKDGBenchLib_095::Lib095_Fn045() { return {}; }
+float UKDGBenchLib_095::Lib095_Fn046(UObject* In0, FString& Out1, float In2, const FVector& In3, FVector& Out4, const FVector& In5) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn047(int32 In0, const FTransform& In1, const FString& In2, float In3, FName In4, const FTransform& In5, FName In6) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn048(bool In0, const FString& In1, float In2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn049(const FString& In0, FVector& Out1, const FTransform& In2, const FVector& In3, bool In4, int32& Out5) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn050(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1, int32& Out2, int32 In3, FName In4, bool In5, float In6) {}
+int32 UKDGBenchLib_095::Lib095_Fn051(UObject* In0, FString& Out1, int32 In2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn052(int32 In0, FString& Out1, UObject* In2, UObject* In3, FVector& Out4) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn053() { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn054(int32& Out0) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn055(FString& Out0, const FString& In1, FName In2, int32 In3, int32& Out4, int32& Out5, int32 In6, bool In7) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn056(const TArray< int32 >& In0, bool In1, int32 In2) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn057(const TArray< int32 >& In0, UObject* In1, const FString& In2, const FTransform& In3) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn058(FString& Out0, FVector& Out1) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn059(int32 In0, FString& Out1) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn060(const TArray< int32 >& In0, bool In1, UObject* In2, UObject* In3) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn061(FVector& Out0, FName In1, UObject* In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn062(int32& Out0, bool In1, const FTransform& In2, float In3) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn063(FString& Out0, UObject* In1, float In2, int32 In3, const FString& In4, float In5, bool In6) {}
+int32 UKDGBenchLib_095::Lib095_Fn064(const FVector& In0, FName In1, bool In2, int32& Out3) { return {}; }
+bool UKDGBenchLib_095::Lib095_Fn065(FString& Out0, FName In1) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn066(int32 In0, const FTransform& In1, bool In2, bool In3) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn067(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const FTransform& In1, bool In2, const TArray< int32 >& In3, const FVector& In4, const FTransform& In5, UObject* In6, const FTransform& In7) {}
+float UKDGBenchLib_095::Lib095_Fn068(int32 In0, FName In1, int32& Out2, FName In3, UObject* In4, FName In5) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn069(const TArray< int32 >& In0, float In1, bool In2, float In3, int32& Out4, FString& Out5, FString& Out6) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn070(FVector& Out0) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn071(FVector& Out0, UObject* In1, float In2, FName In3) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn072(bool In0, bool In1) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn073() { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn074(const TArray< int32 >& In0, UObject* In1) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn075(const FString& In0, const FTransform& In1, int32& Out2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn076(FName In0, FVector& Out1, int32 In2, int32& Out3, const FVector& In4, FString& Out5, FName In6) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn077(const FString& In0, bool In1, UObject* In2, const FTransform& In3, const FTransform& In4) { return {}; }
+bool UKDGBenchLib_095::Lib095_Fn078(const FString& In0, FVector& Out1, const FVector& In2) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn079(float In0, FName In1, const FString& In2, const FString& In3) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn080(FString& Out0, const TArray< int32 >& In1, FName In2) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn081(FName In0, bool In1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn082(UObject* In0, int32& Out1, const TArray< int32 >& In2, UObject* In3, FName In4, int32& Out5, bool In6, FName In7) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn083(int32& Out0, const FTransform& In1, bool In2) { return {}; }
+float UKDGBenchLib_095::Lib095_Fn084(int32& Out0, UObject* In1, bool In2, FVector& Out3, const FTransform& In4) { return {}; }
+FString UKDGBenchLib_095::Lib095_Fn085() { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn086() { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn087(float In0, FVector& Out1, FString& Out2, UObject* In3, UObject* In4, FName In5, const TArray< int32 >& In6, FName In7) { return {}; }
+bool UKDGBenchLib_095::Lib095_Fn088(const FVector& In0, float In1) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn089(FVector& Out0, int32& Out1, const FVector& In2, float In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn090() {}
+FVector UKDGBenchLib_095::Lib095_Fn091(const FVector& In0, const FVector& In1, FVector& Out2) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn092(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, FVector& Out1) {}
+float UKDGBenchLib_095::Lib095_Fn093(const FTransform& In0, const FVector& In1, const FString& In2, bool In3, FName In4, FString& Out5, FVector& Out6, float In7) { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn094(FVector& Out0, UObject* In1) { return {}; }
+int32 UKDGBenchLib_095::Lib095_Fn095(int32 In0) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn096(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FTransform& In1, float In2) {}
+bool UKDGBenchLib_095::Lib095_Fn097() { return {}; }
+FVector UKDGBenchLib_095::Lib095_Fn098(UObject* In0, float In1, bool In2, const FString& In3) { return {}; }
+void UKDGBenchLib_095::Lib095_Fn099(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& In0, FVector& Out1, int32& Out2, bool In3, const FTransform& In4, int32 In5) {}
+
+int32 UKDGBenchLib_096::Lib096_Fn000(const FString& In0) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn001(const FVector& In0, bool In1, bool In2, bool In3, int32 In4, int32 In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn002() { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn003() { return {}; }
+int32 UKDGBenchLib_096::Lib096_Fn004(FString& Out0, FVector& Out1, float In2, const FTransform& In3, FVector& Out4, const FString& In5) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn005(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, const FVector& In1, FVector& Out2, FString& Out3, UObject* In4, bool In5) {}
+void UKDGBenchLib_096::Lib096_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, const FTransform& In1, bool In2, int32& Out3, bool In4, FVector& Out5) {}
+bool UKDGBenchLib_096::Lib096_Fn007(bool In0, const FTransform& In1, const FString& In2, const FVector& In3, const FString& In4, UObject* In5, FVector& Out6) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn008(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, const TArray< int32 >& In1) {}
+float UKDGBenchLib_096::Lib096_Fn009(FString& Out0, int32& Out1, const FVector& In2, int32& Out3) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn010(UObject* In0, const TArray< int32 >& In1, UObject* In2, const FString& In3) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn011(FVector& Out0, int32 In1, bool In2, FVector& Out3, FString& Out4, UObject* In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn012(const FString& In0, FString& Out1, UObject* In2, const FString& In3, int32 In4, const TArray< int32 >& In5, int32& Out6, int32& Out7) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn013(const FVector& In0, float In1) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn014(const FTransform& In0, float In1, const FString& In2, float In3, bool In4, int32 In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn015(int32& Out0, FVector& Out1, bool In2, FName In3) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn016(FName In0, int32 In1, int32 In2, const FTransform& In3) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn017(const TArray< int32 >& In0, FName In1, const TArray< int32 >& In2, const FString& In3, int32& Out4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_096::Lib096_Fn018(UObject* In0, int32& Out1, const FString& In2, float In3, const TArray< int32 >& In4, FName In5, FName In6, const FString& In7) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn019() { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn020(bool In0, int32 In1, bool In2, int32& Out3, FName In4) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn021(FVector& Out0, FString& Out1, const TArray< int32 >& In2, const FString& In3, const FTransform& In4, const TArray< int32 >& In5) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn022(const TArray< int32 >& In0, FVector& Out1, float In2, int32 In3, const FVector& In4, int32 In5) {}
+bool UKDGBenchLib_096::Lib096_Fn023(UObject* In0, int32 In1, FName In2, FVector& Out3, const TArray< int32 >& In4, const TArray< int32 >& In5, const FVector& In6) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn024(int32& Out0, const FTransform& In1, FName In2, FName In3, FVector& Out4, int32& Out5, int32 In6) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn025(int32& Out0, const FVector& In1, int32 In2) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn026(FVector& Out0, FString& Out1, int32& Out2, const FVector& In3, UObject* In4) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn027(bool In0, int32& Out1, int32& Out2) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn028(FString& Out0, int32 In1) {}
+void UKDGBenchLib_096::Lib096_Fn029(int32 In0, int32 In1, bool In2, int32 In3, int32 In4, int32 In5, float In6, bool In7) {}
+float UKDGBenchLib_096::Lib096_Fn030() { return {}; }
+void UKDGBenchLib_096::Lib096_Fn031(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32& Out1, int32 In2) {}
+float UKDGBenchLib_096::Lib096_Fn032(FName In0, const FString& In1) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn033(int32& Out0, float In1, bool In2) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn034(const FString& In0, const FString& In1, FVector& Out2, FString& Out3, UObject* In4, float In5, FString& Out6) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn035(const TArray< int32 >& In0, const FVector& In1, const FString& In2, const TArray< int32 >& In3, const FVector& In4, UObject* In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn036(int32 In0, FString& Out1, FName In2, int32 In3, FVector& Out4, float In5, int32& Out6) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn037(FString& Out0, const FString& In1, bool In2, FName In3, int32& Out4, const FTransform& In5, const TArray< int32 >& In6, int32 In7) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn038() { return {}; }
+int32 UKDGBenchLib_096::Lib096_Fn039(const FTransform& In0) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn040() { return {}; }
+void UKDGBenchLib_096::Lib096_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, int32& Out1, bool In2, const FString& In3, UObject* In4) {}
+void UKDGBenchLib_096::Lib096_Fn042(FVector& Out0, bool In1, bool In2) {}
+void UKDGBenchLib_096::Lib096_Fn043(const FString& In0, const FTransform& In1, const FVector& In2, FVector& Out3, int32& Out4, const FString& In5, UObject* In6) {}
+void UKDGBenchLib_096::Lib096_Fn044(FString& Out0, const FVector& In1, const TArray< int32 >& In2, FName In3, FVector& Out4) {}
+FVector UKDGBenchLib_096::Lib096_Fn045(FVector& Out0, FVector& Out1, int32& Out2) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn046() { return {}; }
+float UKDGBenchLib_096::Lib096_Fn047(FString& Out0, const FTransform& In1, float In2) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn048(UObject* In0, UObject* In1, const FVector& In2, const FString& In3, FVector& Out4, float In5) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn049(FName In0) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn050() { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn051(const TArray< int32 >& In0, bool In1, const FString& In2, bool In3, UObject* In4) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn052(const FString& In0, float In1, int32& Out2, const FTransform& In3, const FString& In4, UObject* In5, const FString& In6, FVector& Out7) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn053(const FString& In0, FString& Out1, UObject* In2, bool In3) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn054(bool In0, int32 In1, FName In2) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn055(int32& Out0, int32& Out1, FString& Out2, bool In3, const FVector& In4, UObject* In5, FString& Out6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_096::Lib096_Fn056(float In0, const FString& In1, UObject* In2, FName In3) { return {}; }
+FVector UKDGBenchLib_096::Lib096_Fn057(const TArray< int32 >& In0, const FString& In1) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn058(const FString& In0, FVector& Out1, bool In2, bool In3, const FTransform& In4, float In5, UObject* In6) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn059() { return {}; }
+int32 UKDGBenchLib_096::Lib096_Fn060(FVector& Out0, float In1, const TArray< int32 >& In2, int32& Out3, int32 In4, FName In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn061(const TArray< int32 >& In0, int32 In1, FString& Out2) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn062(int32& Out0, const TArray< int32 >& In1, const FVector& In2, bool In3, float In4, float In5, const TArray< int32 >& In6) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn063(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, int32& Out1, const FString& In2) {}
+float UKDGBenchLib_096::Lib096_Fn064(int32& Out0, UObject* In1, const FString& In2, const FString& In3, bool In4, FString& Out5) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn065(FVector& Out0, float In1, FString& Out2, const TArray< int32 >& In3) {}
+void UKDGBenchLib_096::Lib096_Fn066(const FVector& In0, UObject* In1) {}
+FString UKDGBenchLib_096::Lib096_Fn067(int32& Out0, FVector& Out1, bool In2, int32& Out3, FString& Out4, const FTransform& In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn068(const FTransform& In0, bool In1, float In2) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn069(const TArray< int32 >& In0, int32& Out1, float In2) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn070(const FVector& In0, FVector& Out1, const FString& In2) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn071(const FVector& In0, UObject* In1, const FString& In2, const TArray< int32 >& In3, float In4, float In5, UObject* In6, UObject* In7) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn072() { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn073(int32 In0, int32& Out1, FName In2, FVector& Out3, FVector& Out4, const FString& In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn074(int32& Out0, int32 In1, FName In2) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn075(FString& Out0, bool In1, FString& Out2, bool In3) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn076(bool In0, const FString& In1, UObject* In2) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn077(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FVector& In1) {}
+float UKDGBenchLib_096::Lib096_Fn078(const FVector& In0, bool In1, UObject* In2, bool In3, int32& Out4, int32& Out5) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn079(bool In0, int32& Out1, const TArray< int32 >& In2, FName In3, const FTransform& In4, const FVector& In5, int32 In6) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn080(FString& Out0, FVector& Out1, bool In2, bool In3, FString& Out4, int32 In5, bool In6, int32& Out7) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn081(const FTransform& In0, float In1, const FString& In2, FVector& Out3, const FVector& In4) { return {}; }
+int32 UKDGBenchLib_096::Lib096_Fn082(FName In0) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn083(FName In0, UObject* In1, UObject* In2, float In3) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn084(FVector& Out0, bool In1, const FVector& In2, const FTransform& In3) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn085(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0, UObject* In1, FVector& Out2, const FString& In3) {}
+float UKDGBenchLib_096::Lib096_Fn086(const FTransform& In0, FName In1, FString& Out2, const TArray< int32 >& In3) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn087(int32 In0, bool In1, float In2, float In3, FName In4, FName In5) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn088(bool In0, bool In1, bool In2, const FString& In3, UObject* In4, FName In5, const FVector& In6, float In7) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn089(FVector& Out0, int32 In1) { return {}; }
+void UKDGBenchLib_096::Lib096_Fn090(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, int32 In1, int32 In2, FVector& Out3) {}
+bool UKDGBenchLib_096::Lib096_Fn091(const FVector& In0, const FString& In1, FVector& Out2, const TArray< int32 >& In3, const TArray< int32 >& In4, const FString& In5) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn092(FVector& Out0, float In1) { return {}; }
+float UKDGBenchLib_096::Lib096_Fn093() { return {}; }
+float UKDGBenchLib_096::Lib096_Fn094(const FTransform& In0) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn095(int32 In0, bool In1, const FTransform& In2, UObject* In3, FName In4) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn096(FVector& Out0, float In1, float In2, const FString& In3, float In4, float In5, float In6) { return {}; }
+bool UKDGBenchLib_096::Lib096_Fn097(const FTransform& In0, bool In1, float In2, const FVector& In3, bool In4, FString& Out5, FString& Out6) { return {}; }
+int32 UKDGBenchLib_096::Lib096_Fn098(bool In0, const FTransform& In1) { return {}; }
+FString UKDGBenchLib_096::Lib096_Fn099(int32& Out0, const FVector& In1) { return {}; }
+
+int32 UKDGBenchLib_097::Lib097_Fn000(UObject* In0, int32& Out1, const FString& In2, int32& Out3, const FTransform& In4, int32& Out5) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn001(FVector& Out0, float In1, float In2, FString& Out3, const FString& In4, FName In5, int32 In6, FVector& Out7) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn002(int32& Out0, int32& Out1, FVector& Out2, int32& Out3, FString& Out4, FName In5) {}
+float UKDGBenchLib_097::Lib097_Fn003(const FString& In0, UObject* In1) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn004() { return {}; }
+void UKDGBenchLib_097::Lib097_Fn005(float In0) {}
+void UKDGBenchLib_097::Lib097_Fn006(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, bool In1, const FString& In2, const FString& In3) {}
+FString UKDGBenchLib_097::Lib097_Fn007(FName In0, const FTransform& In1, FVector& Out2, float In3, const FTransform& In4, const FString& In5, const FString& In6, const FString& In7) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn008(const FVector& In0, const FTransform& In1, UObject* In2, bool In3, FName In4) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn009(int32 In0, const FTransform& In1, const TArray< int32 >& In2, FString& Out3) {}
+void UKDGBenchLib_097::Lib097_Fn010(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0, FString& Out1, UObject* In2, float In3, float In4, const FTransform& In5, FName In6, int32& Out7) {}
+void UKDGBenchLib_097::Lib097_Fn011(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0) {}
+int32 UKDGBenchLib_097::Lib097_Fn012(int32 In0) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn013(FName In0, const FVector& In1, FString& Out2) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn014(const FVector& In0, FString& Out1, float In2, FVector& Out3) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn015(int32 In0, float In1, UObject* In2, FString& Out3, int32& Out4, const FString& In5) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn016(bool In0, float In1) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn017(const FString& In0, const FTransform& In1, FVector& Out2) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn018(FName In0, int32 In1, const TArray< int32 >& In2, const TArray< int32 >& In3) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn019(const FString& In0, const FTransform& In1, int32& Out2, int32& Out3) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn020(int32& Out0, FString& Out1, UObject* In2, UObject* In3, FString& Out4) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn021(UObject* In0, FName In1, FString& Out2, const FTransform& In3, FVector& Out4, float In5) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn022() { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn023(UObject* In0, bool In1, const TArray< int32 >& In2) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn024(int32 In0, int32& Out1, FName In2) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn025(UObject* In0, UObject* In1, float In2, const FString& In3, const FTransform& In4) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn026(bool In0, FString& Out1, bool In2, const FTransform& In3, const FString& In4, int32 In5) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn027(FName In0) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn028(const FTransform& In0, const FVector& In1, FVector& Out2, UObject* In3, int32& Out4, int32 In5, float In6, float In7) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn029(const FVector& In0, const TArray< int32 >& In1, FString& Out2) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn030(FVector& Out0) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn031(int32 In0, FName In1, FVector& Out2) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn032(FName In0, FString& Out1, FString& Out2) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn033(FName In0, const FVector& In1, const TArray< int32 >& In2, FVector& Out3, float In4, const FString& In5, FVector& Out6, FString& Out7) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, const TArray< int32 >& In1) {}
+FString UKDGBenchLib_097::Lib097_Fn035(FVector& Out0, bool In1, float In2, int32 In3, const FString& In4) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn036(const FTransform& In0) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn037(FVector& Out0) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn038(FString& Out0, int32& Out1, int32 In2, FName In3, float In4, const FTransform& In5, float In6, const FString& In7) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn039(int32 In0, const FTransform& In1, int32 In2, int32 In3, const FTransform& In4, int32& Out5, int32& Out6) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn040(int32 In0, float In1, float In2, const FString& In3, FString& Out4, const FTransform& In5, UObject* In6) {}
+void UKDGBenchLib_097::Lib097_Fn041(UObject* In0, const FVector& In1) {}
+bool UKDGBenchLib_097::Lib097_Fn042(bool In0, FString& Out1, const FVector& In2) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn043() { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn044(FVector& Out0, bool In1, FVector& Out2, int32& Out3, FVector& Out4, UObject* In5) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn045(const TArray< int32 >& In0, FName In1, FString& Out2, FVector& Out3, int32& Out4) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn046(const TArray< int32 >& In0) {}
+FVector UKDGBenchLib_097::Lib097_Fn047(FVector& Out0, const FVector& In1, const TArray< int32 >& In2, int32& Out3, const TArray< int32 >& In4, bool In5, float In6) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn048(const TArray< int32 >& In0, FString& Out1, const TArray< int32 >& In2) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn049(FName In0, UObject* In1) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn050(FString& Out0, int32& Out1, const TArray< int32 >& In2, int32 In3) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn051() { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn052(const TArray< int32 >& In0, int32 In1, FString& Out2, const FVector& In3, float In4, int32& Out5, bool In6) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn053(int32& Out0, const FVector& In1, FVector& Out2, const FString& In3) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn054(int32 In0, FVector& Out1, const FTransform& In2) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn055(const TArray< int32 >& In0, bool In1, bool In2, FVector& Out3, const FTransform& In4, float In5, const FVector& In6) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn056(const FString& In0, FVector& Out1, FVector& Out2, float In3, FName In4, FString& Out5, const FVector& In6, float In7) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn057(int32& Out0, UObject* In1, const FVector& In2, const FVector& In3, const FTransform& In4, FVector& Out5) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn058() { return {}; }
+float UKDGBenchLib_097::Lib097_Fn059(float In0, bool In1, const FString& In2) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn060(FVector& Out0, FVector& Out1, int32 In2, bool In3, FString& Out4, const FTransform& In5) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn061(bool In0, float In1, UObject* In2, bool In3, FVector& Out4, int32& Out5, bool In6) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn062(const FString& In0, UObject* In1, int32 In2, const TArray< int32 >& In3, const TArray< int32 >& In4, int32 In5) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn063(UObject* In0, const FString& In1, FString& Out2, const TArray< int32 >& In3) {}
+FVector UKDGBenchLib_097::Lib097_Fn064(bool In0) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn065(const TArray< int32 >& In0, FString& Out1, const FTransform& In2) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn066() { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn067(UObject* In0, float In1, FString& Out2, FString& Out3, UObject* In4, const FVector& In5, FVector& Out6, FString& Out7) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn068(const FVector& In0, UObject* In1, FName In2) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn069(const FString& In0, const FVector& In1, const FTransform& In2, bool In3, FName In4, bool In5, FVector& Out6) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn070(FString& Out0, float In1, float In2) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn071(const TArray< int32 >& In0, const FTransform& In1, float In2, float In3, float In4) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn072(FString& Out0, const TArray< int32 >& In1, bool In2, bool In3) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn073(UObject* In0, FVector& Out1, int32 In2, const TArray< int32 >& In3, UObject* In4, const FTransform& In5, float In6, UObject* In7) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn074(bool In0, int32& Out1, FName In2) {}
+int32 UKDGBenchLib_097::Lib097_Fn075(int32& Out0, FString& Out1, bool In2, const TArray< int32 >& In3, bool In4, bool In5) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn076(int32& Out0, float In1, float In2, int32& Out3, int32 In4, float In5) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn077(const FVector& In0, const TArray< int32 >& In1, FName In2, int32 In3, const FString& In4) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn078(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, FString& Out1, FName In2) {}
+FString UKDGBenchLib_097::Lib097_Fn079() { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn080(int32& Out0, float In1) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn081(FName In0, FVector& Out1) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn082(FString& Out0, int32& Out1, int32 In2, UObject* In3, FString& Out4, float In5) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn083(float In0, bool In1) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn084(FString& Out0, float In1, FName In2, const FVector& In3, FName In4, FString& Out5) {}
+int32 UKDGBenchLib_097::Lib097_Fn085(FString& Out0) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn086(int32& Out0, FString& Out1, int32 In2, FVector& Out3, UObject* In4, FVector& Out5, const FVector& In6) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn087(int32& Out0, const FVector& In1, const TArray< int32 >& In2, FName In3, FVector& Out4, int32 In5) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn088(bool In0, float In1, const FString& In2, const FString& In3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn089(FVector& Out0, FName In1, FVector& Out2, const FString& In3) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn090(int32 In0, const FString& In1, const FString& In2, UObject* In3, UObject* In4, FName In5, UObject* In6) { return {}; }
+void UKDGBenchLib_097::Lib097_Fn091(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FString& Out1, float In2, const FString& In3, const TArray< int32 >& In4, const TArray< int32 >& In5, FString& Out6, FName In7) {}
+FString UKDGBenchLib_097::Lib097_Fn092(const TArray< int32 >& In0, int32 In1, bool In2, const TArray< int32 >& In3, FName In4) { return {}; }
+FVector UKDGBenchLib_097::Lib097_Fn093(const FVector& In0, FVector& Out1, FVector& Out2, int32 In3, int32 In4) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn094(bool In0, FVector& Out1, const FVector& In2) { return {}; }
+int32 UKDGBenchLib_097::Lib097_Fn095(float In0, FName In1, int32& Out2) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn096(bool In0) { return {}; }
+float UKDGBenchLib_097::Lib097_Fn097(const FVector& In0, FString& Out1, float In2, const TArray< int32 >& In3, FName In4) { return {}; }
+FString UKDGBenchLib_097::Lib097_Fn098(UObject* In0) { return {}; }
+bool UKDGBenchLib_097::Lib097_Fn099(const FVector& In0, const TArray< int32 >& In1, const FVector& In2) { return {}; }
+
+int32 UKDGBenchLib_098::Lib098_Fn000(float In0) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn001(UObject* In0, const FTransform& In1) {}
+void UKDGBenchLib_098::Lib098_Fn002(UObject* WorldContextObject, FLatentActionInfo LatentInfo) {}
+float UKDGBenchLib_098::Lib098_Fn003(const FVector& In0, FName In1, const FTransform& In2, FName In3, bool In4) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn004() {}
+FString UKDGBenchLib_098::Lib098_Fn005(int32 In0, const TArray< int32 >& In1, const FVector& In2) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn006(const TArray< int32 >& In0, FVector& Out1, const TArray< int32 >& In2, const FVector& In3, FVector& Out4) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn007(const FVector& In0, const FString& In1, FString& Out2) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn008() { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn009(FString& Out0, FName In1, UObject* In2, FName In3, FName In4) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn010(const FString& In0, FVector& Out1, int32 In2, float In3, FVector& Out4, FString& Out5, const FTransform& In6, float In7) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn011() { return {}; }
+void UKDGBenchLib_098::Lib098_Fn012(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0, const FVector& In1, int32 In2, int32 In3, const FString& In4) {}
+FVector UKDGBenchLib_098::Lib098_Fn013(bool In0, const FVector& In1, const FVector& In2, int32& Out3) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn014(const FTransform& In0, FString& Out1, FString& Out2, const FTransform& In3) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn015(FString& Out0, FName In1, bool In2, float In3, const FTransform& In4, int32 In5, FString& Out6, UObject* In7) {}
+bool UKDGBenchLib_098::Lib098_Fn016() { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn017(UObject* In0, float In1, FName In2, const FVector& In3, FString& Out4, const TArray< int32 >& In5, bool In6, const FString& In7) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn018(bool In0, FVector& Out1, float In2, const TArray< int32 >& In3) {}
+FVector UKDGBenchLib_098::Lib098_Fn019(FName In0, int32 In1, FString& Out2, const FVector& In3, UObject* In4, float In5) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0, int32& Out1) {}
+bool UKDGBenchLib_098::Lib098_Fn021(FVector& Out0, bool In1, UObject* In2, const FTransform& In3, UObject* In4) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn022(FString& Out0) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn023(const FTransform& In0, float In1) { return {}; }
+FString UKDGBenchLib_098::Lib098_Fn024() { return {}; }
+void UKDGBenchLib_098::Lib098_Fn025(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, UObject* In2, UObject* In3, float In4) {}
+bool UKDGBenchLib_098::Lib098_Fn026(const TArray< int32 >& In0, int32& Out1, FVector& Out2, int32 In3, int32 In4) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn027() { return {}; }
+float UKDGBenchLib_098::Lib098_Fn028() { return {}; }
+float UKDGBenchLib_098::Lib098_Fn029(const FTransform& In0) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn030(int32& Out0, const FTransform& In1) {}
+float UKDGBenchLib_098::Lib098_Fn031(UObject* In0, const FString& In1, float In2) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn032(int32 In0, const FString& In1, const FTransform& In2, int32 In3, int32 In4, const FString& In5, FVector& Out6, const TArray< int32 >& In7) { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn033(const FVector& In0, const FVector& In1, float In2, FName In3, FVector& Out4, bool In5, FVector& Out6, float In7) { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn034(FString& Out0, const FVector& In1, FName In2, UObject* In3) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn035(const FString& In0, const FString& In1, float In2, int32& Out3, const FVector& In4, FString& Out5) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn036(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, bool In1, const TArray< int32 >& In2, float In3, FVector& Out4, FString& Out5, const FVector& In6, int32 In7) {}
+bool UKDGBenchLib_098::Lib098_Fn037() { return {}; }
+void UKDGBenchLib_098::Lib098_Fn038(const FTransform& In0, UObject* In1, int32 In2, int32& Out3, const FString& In4) {}
+float UKDGBenchLib_098::Lib098_Fn039(FVector& Out0, int32& Out1, float In2) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn040(FString& Out0) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn041(FName In0) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn042(int32 In0, float In1) {}
+float UKDGBenchLib_098::Lib098_Fn043(FVector& Out0, const FString& In1, UObject* In2, const FString& In3, FString& Out4, FVector& Out5, int32& Out6, FString& Out7) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn044(FVector& Out0, const FString& In1, FName In2, FVector& Out3, bool In4, bool In5) {}
+FVector UKDGBenchLib_098::Lib098_Fn045(int32& Out0, FVector& Out1, const TArray< int32 >& In2, FVector& Out3) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn046(int32 In0, bool In1, const FTransform& In2, int32 In3, const FString& In4, const FString& In5, const FTransform& In6) {}
+float UKDGBenchLib_098::Lib098_Fn047(int32 In0) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn048(const FTransform& In0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn049(float In0, int32 In1) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn050(int32& Out0, const FString& In1) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn051(int32& Out0, int32& Out1, const FString& In2, bool In3) { return {}; }
+FString UKDGBenchLib_098::Lib098_Fn052(int32& Out0, FName In1, const FVector& In2, FVector& Out3) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn053(int32 In0) {}
+void UKDGBenchLib_098::Lib098_Fn054(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FString& Out0, UObject* In1) {}
+int32 UKDGBenchLib_098::Lib098_Fn055(FVector& Out0, UObject* In1, FString& Out2, float In3) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn056(FString& Out0, float In1) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn057() { return {}; }
+float UKDGBenchLib_098::Lib098_Fn058(int32 In0, const FString& In1, bool In2, int32 In3, bool In4, float In5) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn059(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, FString& Out1, UObject* In2, int32 In3, int32& Out4, FVector& Out5, FVector& Out6, const TArray< int32 >& In7) {}
+int32 UKDGBenchLib_098::Lib098_Fn060(const FTransform& In0, FString& Out1, FString& Out2) { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn061(UObject* In0, UObject* In1, float In2, FVector& Out3) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn062() { return {}; }
+void UKDGBenchLib_098::Lib098_Fn063(bool In0, const FString& In1, FName In2, UObject* In3, const FVector& In4, const TArray< int32 >& In5, const FVector& In6, FName In7) {}
+FString UKDGBenchLib_098::Lib098_Fn064(FString& Out0, const FString& In1, float In2, const FString& In3, UObject* In4) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn065(bool In0, const FString& In1) { return {}; }
+FString UKDGBenchLib_098::Lib098_Fn066(FName In0, int32 In1, UObject* In2, int32& Out3, UObject* In4, const TArray< int32 >& In5, float In6) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn067(int32 In0, const FVector& In1, int32 In2, float In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn068(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, FVector& Out1) {}
+FString UKDGBenchLib_098::Lib098_Fn069(const FTransform& In0, FString& Out1, FVector& Out2, bool In3, FName In4, FString& Out5, FName In6) { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn070(const TArray< int32 >& In0, float In1) { return {}; }
+FString UKDGBenchLib_098::Lib098_Fn071(const FString& In0, const FVector& In1, const FVector& In2) { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn072(int32 In0, int32& Out1, FName In2, int32& Out3, const FTransform& In4, const FVector& In5) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn073(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FVector& In0, bool In1, float In2) {}
+FString UKDGBenchLib_098::Lib098_Fn074(const FVector& In0, UObject* In1) { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn075(int32& Out0, bool In1, bool In2, UObject* In3) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn076() { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn077(const FVector& In0) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn078(FVector& Out0) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn079(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray< int32 >& In0) {}
+bool UKDGBenchLib_098::Lib098_Fn080(const FString& In0, const TArray< int32 >& In1, FVector& Out2, int32 In3) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn081(int32 In0, const TArray< int32 >& In1, FVector& Out2, const FString& In3, UObject* In4) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn082(int32& Out0, FString& Out1) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn083(const TArray< int32 >& In0) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn084(UObject* In0, const FTransform& In1) { return {}; }
+float UKDGBenchLib_098::Lib098_Fn085(UObject* In0, FName In1, FVector& Out2, int32& Out3, FName In4) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn086(int32 In0, const FString& In1, int32 In2, UObject* In3) {}
+float UKDGBenchLib_098::Lib098_Fn087(UObject* In0, FName In1, const FVector& In2, FVector& Out3) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn088(FString& Out0, FString& Out1, const FString& In2, FString& Out3) {}
+void UKDGBenchLib_098::Lib098_Fn089() {}
+int32 UKDGBenchLib_098::Lib098_Fn090(FName In0, float In1, const TArray< int32 >& In2, FName In3, bool In4, const TArray< int32 >& In5, const FString& In6, FName In7) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn091(FVector& Out0, int32& Out1, const FTransform& In2, const FVector& In3, FString& Out4, const FVector& In5, FString& Out6) { return {}; }
+void UKDGBenchLib_098::Lib098_Fn092(FString& Out0, FVector& Out1) {}
+bool UKDGBenchLib_098::Lib098_Fn093(const FTransform& In0, float In1) { return {}; }
+FVector UKDGBenchLib_098::Lib098_Fn094(bool In0, FString& Out1, FName In2, const TArray< int32 >& In3, const FString& In4, FString& Out5, int32 In6, const FVector& In7) { return {}; }
+FString UKDGBenchLib_098::Lib098_Fn095(const FTransform& In0, FVector& Out1, float In2, const FString& In3) { return {}; }
+FString UKDGBenchLib_098::Lib098_Fn096() { return {}; }
+FString UKDGBenchLib_098::Lib098_Fn097(FName In0) { return {}; }
+bool UKDGBenchLib_098::Lib098_Fn098(int32& Out0, FVector& Out1, FString& Out2) { return {}; }
+int32 UKDGBenchLib_098::Lib098_Fn099(FString& Out0) { return {}; }
+
+void UKDGBenchLib_099::Lib099_Fn000(UObject* WorldContextObject, FLatentActionInfo LatentInfo, UObject* In0, const FString& In1) {}
+FString UKDGBenchLib_099::Lib099_Fn001(int32& Out0) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn002() { return {}; }
+float UKDGBenchLib_099::Lib099_Fn003(const TArray< int32 >& In0, UObject* In1, const FTransform& In2) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn004(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0, float In1, const FTransform& In2) {}
+void UKDGBenchLib_099::Lib099_Fn005() {}
+int32 UKDGBenchLib_099::Lib099_Fn006(FVector& Out0) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn007(FName In0, float In1, const FVector& In2, FVector& Out3, const FVector& In4, float In5, FName In6) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn008(FString& Out0, FVector& Out1) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn009(const FString& In0) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn010(const TArray< int32 >& In0) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn011(const TArray< int32 >& In0, UObject* In1, FVector& Out2, int32 In3, int32& Out4, FVector& Out5) {}
+FString UKDGBenchLib_099::Lib099_Fn012(float In0, int32 In1, int32 In2, const TArray< int32 >& In3, FName In4, float In5, UObject* In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn013(FVector& Out0, FVector& Out1, FVector& Out2) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn014(int32 In0, float In1, float In2, FVector& Out3, UObject* In4, FString& Out5, float In6, const TArray< int32 >& In7) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn015(const FString& In0, const FVector& In1, FString& Out2, FString& Out3, const FTransform& In4, int32& Out5, const TArray< int32 >& In6, FName In7) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn016(const FString& In0, bool In1, const FVector& In2, UObject* In3, FString& Out4, UObject* In5) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn017(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn018(const TArray< int32 >& In0, const FTransform& In1, FName In2, int32& Out3, const FTransform& In4) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn019(int32 In0, FVector& Out1, int32& Out2, UObject* In3, int32 In4, int32& Out5) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn020(UObject* WorldContextObject, FLatentActionInfo LatentInfo, bool In0) {}
+int32 UKDGBenchLib_099::Lib099_Fn021(FString& Out0, FVector& Out1, int32 In2, FString& Out3, bool In4) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn022() { return {}; }
+float UKDGBenchLib_099::Lib099_Fn023(float In0) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn024(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32& Out0, UObject* In1, FString& Out2, float In3, int32& Out4, FVector& Out5, UObject* In6, FVector& Out7) {}
+FVector UKDGBenchLib_099::Lib099_Fn025(const FVector& In0, int32& Out1, const FVector& In2, FString& Out3) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn026(const FVector& In0, const FString& In1, const FTransform& In2, FVector& Out3, const FTransform& In4, FString& Out5, bool In6) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn027(const FTransform& In0, FVector& Out1, const FVector& In2, FString& Out3, FString& Out4, const FVector& In5, int32& Out6) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn028(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FTransform& In0, int32& Out1, const TArray< int32 >& In2, bool In3, const FString& In4) {}
+int32 UKDGBenchLib_099::Lib099_Fn029(const FTransform& In0) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn030(FString& Out0, FString& Out1, FName In2, FVector& Out3, int32 In4, const FVector& In5) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn031(const TArray< int32 >& In0) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn032(int32 In0, UObject* In1, UObject* In2, int32& Out3, FName In4, UObject* In5, FVector& Out6) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn033(UObject* WorldContextObject, FLatentActionInfo LatentInfo, float In0, int32 In1, UObject* In2, const FVector& In3, float In4, FVector& Out5, int32& Out6) {}
+void UKDGBenchLib_099::Lib099_Fn034(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0) {}
+bool UKDGBenchLib_099::Lib099_Fn035() { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn036(FVector& Out0, FString& Out1, bool In2, UObject* In3, FVector& Out4) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn037(int32 In0, const FTransform& In1) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn038(FVector& Out0, bool In1, const FVector& In2) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn039(FString& Out0, FName In1, int32& Out2, const FTransform& In3, const FString& In4) {}
+void UKDGBenchLib_099::Lib099_Fn040(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FVector& Out0) {}
+void UKDGBenchLib_099::Lib099_Fn041(UObject* WorldContextObject, FLatentActionInfo LatentInfo, FName In0) {}
+FString UKDGBenchLib_099::Lib099_Fn042(FVector& Out0, FVector& Out1, FName In2) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn043(const FTransform& In0) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn044(const TArray< int32 >& In0) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn045(bool In0) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn046(const FVector& In0, const FTransform& In1, const FVector& In2, const FVector& In3, const TArray< int32 >& In4) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn047(int32& Out0, bool In1) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn048() { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn049() { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn050(int32& Out0, FName In1, const TArray< int32 >& In2, const FString& In3, UObject* In4, bool In5, const FString& In6, const FTransform& In7) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn051(float In0, FString& Out1) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn052(const FVector& In0, UObject* In1, FString& Out2, FName In3, FString& Out4, int32 In5, int32 In6, const FVector& In7) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn053(FName In0, int32 In1, FString& Out2, const FVector& In3, FVector& Out4) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn054(int32 In0, FName In1, FVector& Out2) {}
+FString UKDGBenchLib_099::Lib099_Fn055(float In0, FVector& Out1, int32& Out2, FVector& Out3, FVector& Out4, bool In5, const FString& In6) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn056(const FString& In0) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn057(const FTransform& In0, int32& Out1) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn058(UObject* WorldContextObject, FLatentActionInfo LatentInfo, int32 In0) {}
+FVector UKDGBenchLib_099::Lib099_Fn059(UObject* In0, int32 In1, UObject* In2, const TArray< int32 >& In3) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn060(bool In0, bool In1, float In2, float In3, float In4) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn061(UObject* In0, const TArray< int32 >& In1, int32& Out2, const FVector& In3, const FTransform& In4, const FTransform& In5, FVector& Out6, int32 In7) {}
+FString UKDGBenchLib_099::Lib099_Fn062(UObject* In0, float In1, bool In2, int32 In3, const TArray< int32 >& In4, FVector& Out5, bool In6) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn063(FName In0, bool In1) {}
+bool UKDGBenchLib_099::Lib099_Fn064(FVector& Out0, int32& Out1, int32& Out2, FName In3, FVector& Out4) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn065() { return {}; }
+void UKDGBenchLib_099::Lib099_Fn066(const TArray< int32 >& In0, const FTransform& In1, const FVector& In2, const TArray< int32 >& In3, const TArray< int32 >& In4, const FVector& In5, const FTransform& In6, FName In7) {}
+FVector UKDGBenchLib_099::Lib099_Fn067(FName In0) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn068(const TArray< int32 >& In0, bool In1) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn069(const FString& In0, const FVector& In1, int32 In2, FName In3, const FString& In4, FVector& Out5, FVector& Out6, FString& Out7) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn070(FVector& Out0, const FTransform& In1, float In2, const TArray< int32 >& In3, FName In4, const TArray< int32 >& In5, FVector& Out6) {}
+float UKDGBenchLib_099::Lib099_Fn071(int32& Out0, const FTransform& In1, UObject* In2, FVector& Out3, const FString& In4, FName In5, FVector& Out6) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn072(int32& Out0, int32& Out1, bool In2, const FString& In3, bool In4, const TArray< int32 >& In5) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn073(const FString& In0, bool In1, UObject* In2, int32 In3, const TArray< int32 >& In4, const FString& In5) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn074() { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn075(FVector& Out0, FVector& Out1, const FTransform& In2, const FTransform& In3, FVector& Out4) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn076(const FVector& In0, int32& Out1, float In2, float In3, const FString& In4) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn077(FName In0, const FString& In1) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn078() {}
+bool UKDGBenchLib_099::Lib099_Fn079(const FTransform& In0, bool In1) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn080(const FString& In0) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn081(const TArray< int32 >& In0) { return {}; }
+FVector UKDGBenchLib_099::Lib099_Fn082(const FVector& In0, FString& Out1) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn083() { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn084(bool In0, const TArray< int32 >& In1, const FTransform& In2, bool In3) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn085(FVector& Out0) {}
+float UKDGBenchLib_099::Lib099_Fn086(int32 In0, const FTransform& In1, FString& Out2, const FTransform& In3, const TArray< int32 >& In4, const FVector& In5) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn087(int32 In0, FString& Out1, const FTransform& In2, const FVector& In3, UObject* In4, int32& Out5, UObject* In6, FVector& Out7) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn088(FVector& Out0, FName In1, FString& Out2, FName In3, int32 In4, const TArray< int32 >& In5, float In6) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn089(UObject* In0, const TArray< int32 >& In1, const FString& In2, const FString& In3, int32 In4, float In5) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn090(FName In0, const FVector& In1, const FVector& In2, FString& Out3, bool In4) { return {}; }
+FString UKDGBenchLib_099::Lib099_Fn091(FVector& Out0, const FTransform& In1, bool In2, bool In3) { return {}; }
+float UKDGBenchLib_099::Lib099_Fn092(const TArray< int32 >& In0, FVector& Out1) { return {}; }
+bool UKDGBenchLib_099::Lib099_Fn093(FVector& Out0, const FString& In1, bool In2, UObject* In3, const FString& In4, UObject* In5) { return {}; }
+int32 UKDGBenchLib_099::Lib099_Fn094(int32& Out0, FName In1, UObject* In2, const FString& In3) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn095(UObject* In0, int32 In1) {}
+bool UKDGBenchLib_099::Lib099_Fn096(float In0, int32& Out1, int32 In2, const FTransform& In3, int32 In4, float In5) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn097(const FTransform& In0) {}
+int32 UKDGBenchLib_099::Lib099_Fn098(FVector& Out0, const TArray< int32 >& In1) { return {}; }
+void UKDGBenchLib_099::Lib099_Fn099(const TArray< int32 >& In0) {}
+
@@ -1,41 +1,128 @@
-var coll = document.getElementsByClassName("collapsible");
-var i;
+// A single listener handles every collapsible. Module collapsibles on the index are filled in from their
+// fragment script (index/{module}.js) the first time they're expanded.
 
-for (i = 0; i < coll.length; i++) 
+var KantanDocGenIndex = (function ()
 {
-  coll[i].addEventListener("click", function() 
-  {
-	this.classList.toggle("active");
-	var content = this.nextElementSibling;
-	if (content.style.display === "block") 
+	var fragments = {};
+	var pending = {};
+
+	function addRows(content, heading, rows)
 	{
-	  content.style.display = "none";
-	} 
-	else 
+		if (!rows.length)
+		{
+			return;
+		}
+		if (heading)
+		{
+			var p = document.createElement("p");
+			var i = document.createElement("i");
+			i.textContent = heading;
+			p.appendChild(i);
+			content.appendChild(p);
+		}
+		var table = document.createElement("table");
+		var body = document.createElement("tbody");
+		for (var r = 0; r < rows.length; r++)
+		{
+			var row = document.createElement("tr");
+			var name = document.createElement("td");
+			var link = document.createElement("a");
+			link.href = "./" + rows[r][0] + "/" + rows[r][0] + ".html";
+			link.textContent = rows[r][1];
+			name.appendChild(link);
+			var description = document.createElement("td");
+			description.textContent = rows[r][2];
+			row.appendChild(name);
+			row.appendChild(description);
+			body.appendChild(row);
+		}
+		table.appendChild(body);
+		content.appendChild(table);
+	}
+
+	function fill(button)
 	{
-	  content.style.display = "block";
+		var name = button.getAttribute("data-fragment");
+		var content = button.nextElementSibling;
+		var module = fragments[name];
+		if (!module || content.hasChildNodes())
+		{
+			return;
+		}
+		var rows = document.createDocumentFragment();
+		addRows(rows, null, module.classes);
+		addRows(rows, "Structs", module.structs);
+		addRows(rows, "Enums", module.enums);
+		content.appendChild(rows);
+	}
+
+	function load(button)
+	{
+		var name = button.getAttribute("data-fragment");
+		if (fragments[name])
+		{
+			fill(button);
+			return;
+		}
+		if (pending[name])
+		{
+			pending[name].push(button);
+			return;
+		}
+		pending[name] = [button];
+		var tag = document.createElement("script");
+		tag.src = "./index/" + name + ".js";
+		tag.onload = function ()
+		{
+			var buttons = pending[name];
+			delete pending[name];
+			for (var i = 0; i < buttons.length; i++)
+			{
+				fill(buttons[i]);
+			}
+		};
+		document.head.appendChild(tag);
 	}
-  });
-}
 
-function expandAll() 
+	function setExpanded(button, expanded)
+	{
+		button.classList.toggle("active", expanded);
+		button.nextElementSibling.style.display = expanded ? "block" : "none";
+		if (expanded && button.hasAttribute("data-fragment"))
+		{
+			load(button);
+		}
+	}
+
+	document.addEventListener("click", function (event)
+	{
+		var button = event.target.closest ? event.target.closest(".collapsible") : null;
+		if (button)
+		{
+			setExpanded(button, button.nextElementSibling.style.display !== "block");
+		}
+	});
+
+	return {
+		setExpanded: setExpanded,
+		addModule: function (name, data) { fragments[name] = data; }
+	};
+})();
+
+function expandAll()
 {
 	var coll = document.getElementsByClassName("collapsible");
-	var i;
-	for (i = 0; i < coll.length; i++) 
+	for (var i = 0; i < coll.length; i++)
 	{
-		var content = coll[i].nextElementSibling;
-	  content.style.display = "block";
+		KantanDocGenIndex.setExpanded(coll[i], true);
 	}
 }
 
-function collapseAll() 
+function collapseAll()
 {
 	var coll = document.getElementsByClassName("collapsible");
-	var i;
-	for (i = 0; i < coll.length; i++) 
+	for (var i = 0; i < coll.length; i++)
 	{
-		var content = coll[i].nextElementSibling;
-		content.style.display = "none";
+		KantanDocGenIndex.setExpanded(coll[i], false);
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,84 @@
+// Function list of a big class page, rendered a page at a time. The class's functions/{class}.js hands over the
+// node summaries, already sorted by title, as [id, title, description] rows.
+
+var KantanDocGenFunctions = (function ()
+{
+	var pageSize = 50;
+	var container = document.getElementById("function_list");
+
+	var rows = [];
+	var filtered = [];
+	var page = 0;
+
+	var filter = document.createElement("input");
+	filter.type = "search";
+	filter.placeholder = "Filter functions";
+	filter.className = "function_filter";
+
+	var table = document.createElement("table");
+	var body = document.createElement("tbody");
+	table.appendChild(body);
+
+	var pager = document.createElement("div");
+	pager.className = "function_pager";
+
+	function button(label, target)
+	{
+		var b = document.createElement("button");
+		b.type = "button";
+		b.textContent = label;
+		b.disabled = target < 0 || target * pageSize >= filtered.length || target === page;
+		b.addEventListener("click", function () { show(target); });
+		return b;
+	}
+
+	function show(target)
+	{
+		page = target;
+		var rendered = document.createDocumentFragment();
+		var end = Math.min(filtered.length, (page + 1) * pageSize);
+		for (var i = page * pageSize; i < end; i++)
+		{
+			var row = document.createElement("tr");
+			var name = document.createElement("td");
+			var link = document.createElement("a");
+			link.href = "./nodes/" + filtered[i][0] + ".html";
+			link.textContent = filtered[i][1];
+			name.appendChild(link);
+			var description = document.createElement("td");
+			description.textContent = filtered[i][2];
+			row.appendChild(name);
+			row.appendChild(description);
+			rendered.appendChild(row);
+		}
+		body.innerHTML = "";
+		body.appendChild(rendered);
+
+		var numPages = Math.max(1, Math.ceil(filtered.length / pageSize));
+		pager.innerHTML = "";
+		pager.appendChild(button("<", page - 1));
+		var status = document.createElement("span");
+		status.textContent = " Page " + (page + 1) + " of " + numPages + " (" + filtered.length + " functions) ";
+		pager.appendChild(status);
+		pager.appendChild(button(">", page + 1));
+	}
+
+	filter.addEventListener("input", function ()
+	{
+		var text = filter.value.toLowerCase();
+		filtered = text ? rows.filter(function (row) { return row[1].toLowerCase().indexOf(text) >= 0; }) : rows;
+		show(0);
+	});
+
+	return {
+		load: function (data)
+		{
+			rows = filtered = data;
+			container.innerHTML = "";
+			container.appendChild(filter);
+			container.appendChild(table);
+			container.appendChild(pager);
+			show(0);
+		}
+	};
+})();
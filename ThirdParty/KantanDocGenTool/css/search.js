@@ -0,0 +1,264 @@
+// Client side search over the index the generator writes to search/.
+// The index is loaded as scripts (pages opened from disk can't fetch json), which hand their data to the functions below.
+// Only the meta, the shards for the prefixes typed and the entry chunks for the results shown are ever loaded.
+
+var KantanDocGenSearch = (function ()
+{
+	var script = document.currentScript;
+	var root = script.getAttribute("data-root") || "./";
+	var kinds = ["Class", "Struct", "Enum", "Function"];
+	var maxResults = 50;
+
+	var meta = null;
+	var shardKeys = {};
+	var shards = {};
+	var chunks = {};
+	var pending = {};
+
+	function load(name, isLoaded, callback)
+	{
+		if (isLoaded())
+		{
+			callback();
+			return;
+		}
+		if (pending[name])
+		{
+			pending[name].push(callback);
+			return;
+		}
+		pending[name] = [callback];
+		var tag = document.createElement("script");
+		tag.src = root + "search/" + name + ".js";
+		tag.onload = tag.onerror = function ()
+		{
+			var callbacks = pending[name];
+			delete pending[name];
+			for (var i = 0; i < callbacks.length; i++)
+			{
+				callbacks[i]();
+			}
+		};
+		document.head.appendChild(tag);
+	}
+
+	function loadAll(names, isLoaded, callback)
+	{
+		var remaining = names.length + 1;
+		function done()
+		{
+			if (--remaining === 0)
+			{
+				callback();
+			}
+		}
+		for (var i = 0; i < names.length; i++)
+		{
+			(function (name)
+			{
+				load(name, function () { return isLoaded(name); }, done);
+			})(names[i]);
+		}
+		done();
+	}
+
+	// Must match FDocGenSearchIndex::Tokenize and GetShardKey
+	function tokenize(query)
+	{
+		var words = query.toLowerCase().split(/[^0-9a-z\u00c0-\uffff]+/);
+		var tokens = [];
+		for (var i = 0; i < words.length; i++)
+		{
+			if (words[i].length >= 2)
+			{
+				tokens.push(words[i].substring(0, 32));
+			}
+		}
+		return tokens;
+	}
+
+	function shardKey(token)
+	{
+		return token.substring(0, 2).replace(/[^0-9a-z]/g, "_");
+	}
+
+	function lowerBound(list, value)
+	{
+		var lo = 0, hi = list.length;
+		while (lo < hi)
+		{
+			var mid = (lo + hi) >> 1;
+			if (list[mid] < value)
+			{
+				lo = mid + 1;
+			}
+			else
+			{
+				hi = mid;
+			}
+		}
+		return lo;
+	}
+
+	// Best score of each entry for a single query term. Exact token matches count double.
+	function scoreTerm(term)
+	{
+		var scores = {};
+		var shard = shards[shardKey(term)];
+		if (!shard)
+		{
+			return scores;
+		}
+		for (var t = lowerBound(shard.t, term); t < shard.t.length && shard.t[t].lastIndexOf(term, 0) === 0; t++)
+		{
+			var factor = shard.t[t].length === term.length ? 2 : 1;
+			var postings = shard.p[t];
+			var entry = 0;
+			for (var p = 0; p < postings.length; p += 2)
+			{
+				entry += postings[p];
+				var score = postings[p + 1] * factor;
+				if (!(scores[entry] >= score))
+				{
+					scores[entry] = score;
+				}
+			}
+		}
+		return scores;
+	}
+
+	// Entries matching every term, best first
+	function rank(terms)
+	{
+		var total = scoreTerm(terms[0]);
+		for (var i = 1; i < terms.length; i++)
+		{
+			var scores = scoreTerm(terms[i]);
+			var combined = {};
+			for (var entry in total)
+			{
+				if (scores[entry] !== undefined)
+				{
+					combined[entry] = total[entry] + scores[entry];
+				}
+			}
+			total = combined;
+		}
+
+		var results = [];
+		for (var entry in total)
+		{
+			results.push(+entry);
+		}
+		results.sort(function (a, b) { return (total[b] - total[a]) || (a - b); });
+		return results;
+	}
+
+	function render(results, terms, elapsed)
+	{
+		var list = document.getElementById("search_results");
+		list.innerHTML = "";
+		list.style.display = terms.length ? "block" : "none";
+		if (!terms.length)
+		{
+			return;
+		}
+
+		var status = document.createElement("div");
+		status.className = "search_status";
+		status.textContent = results.length + (results.length === 1 ? " result" : " results") + " (" + elapsed.toFixed(1) + " ms)";
+		list.appendChild(status);
+
+		for (var i = 0; i < results.length && i < maxResults; i++)
+		{
+			var chunk = chunks[Math.floor(results[i] / meta.chunkSize)];
+			if (!chunk)
+			{
+				continue;
+			}
+			var entry = chunk[results[i] % meta.chunkSize];
+			var row = document.createElement("a");
+			row.className = "search_result";
+			row.href = root + entry[2];
+			var title = document.createElement("b");
+			title.textContent = entry[1];
+			var context = document.createElement("span");
+			context.className = "search_context";
+			context.textContent = kinds[entry[0]] + (entry[3] ? " - " + entry[3] : "");
+			row.appendChild(title);
+			row.appendChild(context);
+			list.appendChild(row);
+		}
+	}
+
+	function search(query)
+	{
+		var terms = tokenize(query);
+		if (!terms.length || !meta)
+		{
+			render([], terms, 0);
+			return;
+		}
+
+		var keys = [];
+		for (var i = 0; i < terms.length; i++)
+		{
+			var key = shardKey(terms[i]);
+			if (shardKeys[key] && keys.indexOf(key) < 0)
+			{
+				keys.push(key);
+			}
+		}
+
+		loadAll(keys.map(function (key) { return "s_" + key; }), function (name) { return !!shards[name.substring(2)]; }, function ()
+		{
+			if (document.getElementById("search_box").value !== query)
+			{
+				return;
+			}
+
+			var start = performance.now();
+			var results = rank(terms);
+			var elapsed = performance.now() - start;
+
+			var needed = [];
+			for (var i = 0; i < results.length && i < maxResults; i++)
+			{
+				var name = "e_" + Math.floor(results[i] / meta.chunkSize);
+				if (needed.indexOf(name) < 0)
+				{
+					needed.push(name);
+				}
+			}
+			loadAll(needed, function (name) { return !!chunks[name.substring(2)]; }, function ()
+			{
+				render(results, terms, elapsed);
+			});
+		});
+	}
+
+	var timer = null;
+	var box = document.getElementById("search_box");
+	box.addEventListener("input", function ()
+	{
+		clearTimeout(timer);
+		timer = setTimeout(function () { search(box.value); }, 30);
+	});
+	box.addEventListener("focus", function ()
+	{
+		load("meta", function () { return meta !== null; }, function () { search(box.value); });
+	});
+
+	return {
+		setMeta: function (data)
+		{
+			meta = data;
+			for (var i = 0; i < data.shards.length; i++)
+			{
+				shardKeys[data.shards[i]] = true;
+			}
+		},
+		addShard: function (key, data) { shards[key] = data; },
+		addEntries: function (chunk, data) { chunks[chunk] = data; }
+	};
+})();
@@ -0,0 +1,25 @@
+// Logs paint timings to the browser console when a page is opened with ?timing in its url,
+// so that render time can be compared between docsets and output formats.
+
+(function ()
+{
+	if (!/[?&]timing(=|&|$)/.test(window.location.search) || !window.PerformanceObserver)
+	{
+		return;
+	}
+
+	try
+	{
+		new PerformanceObserver(function (list)
+		{
+			var entries = list.getEntries();
+			for (var i = 0; i < entries.length; i++)
+			{
+				console.log("KantanDocGen: " + entries[i].name + " " + entries[i].startTime.toFixed(1) + " ms");
+			}
+		}).observe({ type: "paint", buffered: true });
+	}
+	catch (e)
+	{
+	}
+})();
@@ -0,0 +1,505 @@
+// Renders the index, class and node views of json output from the data scripts, each of which hands its json over
+// through KantanDocGenViewer.addData. Scripts rather than fetched json, so the viewer works opened from disk too.
+//
+//   #/                 index (data/index.js)
+//   #/{key}            class, struct or enum (data/{key}.js), keyed as class_{id}, struct_{id} or enum_{id}
+//   #/{key}/{node id}  node of a class
+
+var KantanDocGenViewer = (function ()
+{
+	var pageSize = 50;
+	var container = document.getElementById("content_container");
+
+	var data = {};
+	var pending = {};
+	var expanded = {};
+
+	function load(key, callback)
+	{
+		if (data[key])
+		{
+			callback(data[key]);
+			return;
+		}
+		if (pending[key])
+		{
+			pending[key].push(callback);
+			return;
+		}
+		pending[key] = [callback];
+		var tag = document.createElement("script");
+		tag.src = "./data/" + encodeURIComponent(key) + ".js";
+		tag.onerror = function ()
+		{
+			delete pending[key];
+			render(function (content) { content.appendChild(element("p", null, "Nothing documented as '" + key + "'.")); });
+		};
+		document.head.appendChild(tag);
+	}
+
+	function element(tag, className, text)
+	{
+		var e = document.createElement(tag);
+		if (className)
+		{
+			e.className = className;
+		}
+		if (text)
+		{
+			e.textContent = text;
+		}
+		return e;
+	}
+
+	function link(href, text)
+	{
+		var a = element("a", null, text);
+		if (href)
+		{
+			a.href = href;
+		}
+		return a;
+	}
+
+	// Index rows and hierarchy entries already carry their key
+	function route(key, nodeId)
+	{
+		return "#/" + encodeURIComponent(key) + (nodeId ? "/" + encodeURIComponent(nodeId) : "");
+	}
+
+	function dataKey(type)
+	{
+		return type.kind + "_" + type.id;
+	}
+
+	// Multi line descriptions keep their line breaks, as they do in the html output
+	function paragraph(text)
+	{
+		var p = element("p");
+		var lines = (text || "").split("\n");
+		for (var i = 0; i < lines.length; i++)
+		{
+			if (i > 0)
+			{
+				p.appendChild(element("br"));
+			}
+			p.appendChild(document.createTextNode(lines[i]));
+		}
+		return p;
+	}
+
+	function navbar(content, crumbs)
+	{
+		for (var i = 0; i < crumbs.length; i++)
+		{
+			if (i > 0)
+			{
+				content.appendChild(element("a", "navbar_style", ">"));
+			}
+			var crumb = link(crumbs[i][0], crumbs[i][1]);
+			crumb.className = "navbar_style";
+			content.appendChild(crumb);
+		}
+	}
+
+	function table(rows)
+	{
+		var t = element("table");
+		var body = element("tbody");
+		for (var r = 0; r < rows.length; r++)
+		{
+			var row = element("tr");
+			for (var c = 0; c < rows[r].length; c++)
+			{
+				var cell = element("td");
+				cell.appendChild(rows[r][c]);
+				row.appendChild(cell);
+			}
+			body.appendChild(row);
+		}
+		t.appendChild(body);
+		return t;
+	}
+
+	function param(name, type, extra)
+	{
+		var cell = document.createDocumentFragment();
+		cell.appendChild(element("div", "param_name title_style", name));
+		cell.appendChild(element("div", "param_type", type));
+		if (extra)
+		{
+			cell.appendChild(element("div", "param_type", extra));
+		}
+		return cell;
+	}
+
+	function section(content, title, rows)
+	{
+		if (rows.length)
+		{
+			content.appendChild(element("h3", "title_style", title));
+			content.appendChild(table(rows));
+		}
+	}
+
+	function byName(a, b)
+	{
+		return a[0] < b[0] ? -1 : a[0] > b[0] ? 1 : 0;
+	}
+
+	function render(build)
+	{
+		var content = document.createDocumentFragment();
+		build(content);
+		container.innerHTML = "";
+		container.appendChild(content);
+		window.scrollTo(0, 0);
+	}
+
+	function renderIndex(index)
+	{
+		document.title = index.title;
+		render(function (content)
+		{
+			content.appendChild(element("h1", "title_style", index.title + " Documentation"));
+
+			var filter = element("input", "function_filter");
+			filter.type = "search";
+			filter.placeholder = "Filter classes, structs and enums";
+			content.appendChild(filter);
+
+			var results = element("div");
+			content.appendChild(results);
+
+			var plugins = element("div");
+			content.appendChild(plugins);
+
+			for (var p = 0; p < index.plugins.length; p++)
+			{
+				var plugin = index.plugins[p];
+				collapsible(plugins, "plugin:" + plugin.name, plugin.name, plugin.description, fillPlugin.bind(null, plugin));
+			}
+
+			filter.addEventListener("input", function ()
+			{
+				var text = filter.value.toLowerCase();
+				results.innerHTML = "";
+				plugins.style.display = text ? "none" : "block";
+				if (!text)
+				{
+					return;
+				}
+				var matches = [];
+				for (var p = 0; p < index.plugins.length; p++)
+				{
+					for (var m = 0; m < index.plugins[p].modules.length; m++)
+					{
+						var module = index.plugins[p].modules[m];
+						var all = module.classes.concat(module.structs, module.enums);
+						for (var i = 0; i < all.length; i++)
+						{
+							if (all[i][1].toLowerCase().indexOf(text) >= 0)
+							{
+								matches.push(all[i]);
+							}
+						}
+					}
+				}
+				indexRows(results, matches.length + " matches", matches.slice(0, pageSize * 4));
+			});
+		});
+	}
+
+	function fillPlugin(plugin, content)
+	{
+		for (var m = 0; m < plugin.modules.length; m++)
+		{
+			var module = plugin.modules[m];
+			var counts = [];
+			if (module.classes.length) { counts.push(module.classes.length + " classes"); }
+			if (module.structs.length) { counts.push(module.structs.length + " structs"); }
+			if (module.enums.length) { counts.push(module.enums.length + " enums"); }
+			collapsible(content, "module:" + module.name, module.name, counts.join(" "), fillModule.bind(null, module));
+		}
+	}
+
+	function fillModule(module, content)
+	{
+		indexRows(content, null, module.classes);
+		indexRows(content, "Structs", module.structs);
+		indexRows(content, "Enums", module.enums);
+	}
+
+	// Contents are only built the first time they're shown. Expanded state is kept across views, so going back to
+	// the index leaves it as it was.
+	function collapsible(parent, key, title, subtitle, fill)
+	{
+		var button = element("button", "collapsible");
+		button.type = "button";
+		button.appendChild(element("b", null, title));
+		if (subtitle)
+		{
+			button.appendChild(element("span", "module_counts", " " + subtitle));
+		}
+		var content = element("div", "collapsible_content");
+		var show = function (visible)
+		{
+			if (visible && fill)
+			{
+				fill(content);
+				fill = null;
+			}
+			button.classList.toggle("active", visible);
+			content.style.display = visible ? "block" : "none";
+		};
+		button.addEventListener("click", function ()
+		{
+			expanded[key] = !expanded[key];
+			show(expanded[key]);
+		});
+		show(!!expanded[key]);
+		parent.appendChild(button);
+		parent.appendChild(content);
+		return content;
+	}
+
+	function indexRows(content, heading, rows)
+	{
+		if (!rows.length)
+		{
+			return;
+		}
+		if (heading)
+		{
+			var p = element("p");
+			p.appendChild(element("i", null, heading));
+			content.appendChild(p);
+		}
+		var tableRows = [];
+		for (var r = 0; r < rows.length; r++)
+		{
+			tableRows.push([link(route(rows[r][0]), rows[r][1]), document.createTextNode(rows[r][2])]);
+		}
+		content.appendChild(table(tableRows));
+	}
+
+	function renderType(type)
+	{
+		document.title = type.name;
+		var index = data.index;
+		render(function (content)
+		{
+			navbar(content, [["#/", index ? index.title : "Index"], [null, type.name]]);
+			content.appendChild(element("h1", "title_style", type.name));
+			content.appendChild(paragraph(type.description));
+
+			var hierarchy = function (entries, indent)
+			{
+				var rows = [];
+				for (var i = 0; i < entries.length; i++)
+				{
+					var a = link(entries[i][0] ? route(entries[i][0]) : null, entries[i][1]);
+					if (indent)
+					{
+						a.style.paddingLeft = ((i + 1) * 5) + "px";
+					}
+					rows.push([a]);
+				}
+				return rows;
+			};
+			section(content, "Inheritance Hierarchy", hierarchy(type.inheritance || [], true));
+			section(content, "Implemented Interfaces", hierarchy(type.interfaces || [], false));
+
+			var references = [];
+			var addReference = function (name, value)
+			{
+				if (value)
+				{
+					references.push([element("b", null, name), document.createTextNode(value)]);
+				}
+			};
+			addReference("Module", type.module);
+			addReference("Header", type.header);
+			addReference("Source", type.source);
+			addReference("Include", type.include);
+			section(content, "References", references);
+
+			var enumerators = [];
+			for (var e = 0; e < (type.enumerators || []).length; e++)
+			{
+				var enumerator = type.enumerators[e];
+				enumerators.push([param(enumerator[0], String(enumerator[2])), paragraph(enumerator[1])]);
+			}
+			section(content, "Values", enumerators);
+
+			var properties = (type.properties || []).slice().sort(byName);
+			var propertyRows = [];
+			for (var p = 0; p < properties.length; p++)
+			{
+				var property = properties[p];
+				propertyRows.push([param(property[0], property[1], property[4] ? "Read Only" : "Read/Write"), paragraph(property[2])]);
+			}
+			section(content, "Properties", propertyRows);
+
+			if (type.nodes && type.nodes.length)
+			{
+				content.appendChild(element("h3", "title_style", "Functions"));
+				functionList(content, type);
+			}
+		});
+	}
+
+	// Sorted by title, a page at a time, as big class pages are in the html output
+	function functionList(content, type)
+	{
+		var rows = type.nodes.slice().sort(function (a, b)
+		{
+			return a.title < b.title ? -1 : a.title > b.title ? 1 : 0;
+		});
+		var filtered = rows;
+
+		var list = element("div");
+		var filter = element("input", "function_filter");
+		filter.type = "search";
+		filter.placeholder = "Filter functions";
+		var body = element("div");
+		var pager = element("div", "function_pager");
+		if (rows.length > pageSize)
+		{
+			list.appendChild(filter);
+		}
+		list.appendChild(body);
+		list.appendChild(pager);
+		content.appendChild(list);
+
+		var button = function (label, target)
+		{
+			var b = element("button", null, label);
+			b.type = "button";
+			b.disabled = target < 0 || target * pageSize >= filtered.length;
+			b.addEventListener("click", function () { show(target); });
+			return b;
+		};
+
+		var show = function (page)
+		{
+			var tableRows = [];
+			var end = Math.min(filtered.length, (page + 1) * pageSize);
+			for (var i = page * pageSize; i < end; i++)
+			{
+				tableRows.push([link(route(dataKey(type), filtered[i].id), filtered[i].title), document.createTextNode(filtered[i].description)]);
+			}
+			body.innerHTML = "";
+			body.appendChild(table(tableRows));
+
+			pager.innerHTML = "";
+			if (filtered.length > pageSize)
+			{
+				var numPages = Math.ceil(filtered.length / pageSize);
+				pager.appendChild(button("<", page - 1));
+				pager.appendChild(element("span", null, " Page " + (page + 1) + " of " + numPages + " (" + filtered.length + " functions) "));
+				pager.appendChild(button(">", page + 1));
+			}
+		};
+
+		filter.addEventListener("input", function ()
+		{
+			var text = filter.value.toLowerCase();
+			filtered = text ? rows.filter(function (row) { return row.title.toLowerCase().indexOf(text) >= 0; }) : rows;
+			show(0);
+		});
+
+		show(0);
+	}
+
+	function renderNode(type, node)
+	{
+		document.title = node.title;
+		var index = data.index;
+		render(function (content)
+		{
+			navbar(content, [["#/", index ? index.title : "Index"], [route(dataKey(type)), type.name], [null, node.title]]);
+			content.appendChild(element("h1", "title_style", node.title));
+			content.appendChild(paragraph(node.description));
+			if (node.image)
+			{
+				var img = element("img");
+				img.src = node.image;
+				content.appendChild(img);
+			}
+
+			var pins = function (list)
+			{
+				var rows = [];
+				for (var i = 0; i < list.length; i++)
+				{
+					rows.push([param(list[i][0], list[i][1]), paragraph(list[i][2])]);
+				}
+				return rows;
+			};
+			section(content, "Inputs", pins(node.inputs));
+			section(content, "Outputs", pins(node.outputs));
+		});
+	}
+
+	function navigate()
+	{
+		var hash = location.hash;
+		var parts = hash.replace(/^#\/?/, "").split("/");
+		var key = decodeURIComponent(parts[0] || "");
+		var nodeId = parts.length > 1 ? decodeURIComponent(parts[1]) : null;
+
+		// The index is always loaded, for the title in the navbar
+		load("index", function (index)
+		{
+			if (!key)
+			{
+				if (location.hash === hash)
+				{
+					renderIndex(index);
+				}
+				return;
+			}
+			load(key, function (type)
+			{
+				// Navigated elsewhere while it was loading
+				if (location.hash !== hash)
+				{
+					return;
+				}
+				if (!nodeId)
+				{
+					renderType(type);
+					return;
+				}
+				for (var i = 0; i < (type.nodes || []).length; i++)
+				{
+					if (type.nodes[i].id === nodeId)
+					{
+						renderNode(type, type.nodes[i]);
+						return;
+					}
+				}
+				render(function (content) { content.appendChild(element("p", null, "Nothing documented as '" + nodeId + "'.")); });
+			});
+		});
+	}
+
+	window.addEventListener("hashchange", navigate);
+
+	// Run once the returned object exists, as a data script may already be loaded by then
+	setTimeout(navigate, 0);
+
+	return {
+		addData: function (key, value)
+		{
+			data[key] = value;
+			var callbacks = pending[key] || [];
+			delete pending[key];
+			for (var i = 0; i < callbacks.length; i++)
+			{
+				callbacks[i](value);
+			}
+		}
+	};
+})();
@@ -29,11 +29,19 @@ version="2.0">
 		</a>
 		<a class="navbar_style">&gt;</a>
 		<a class="navbar_style"><xsl:value-of select="display_name" /></a>
+		<div class="search_container">
+			<input type="search" id="search_box" placeholder="Search" autocomplete="off" />
+			<div id="search_results"></div>
+		</div>
+		<script src="../css/search.js" data-root="../" >//</script>
+		<script src="../css/timing.js" >//</script>
 		<h1 class="title_style"><xsl:value-of select="display_name" /></h1>
 		<p><xsl:value-of select="description" /></p>
 		<xsl:apply-templates select="inheritance" />
 		<xsl:apply-templates select="interfaces" />
 		<xsl:apply-templates select="references" />
+		<xsl:apply-templates select="enumerators" />
+		<xsl:apply-templates select="properties" />
 		<xsl:apply-templates select="nodes" />
 	</xsl:template>
 	
@@ -137,18 +145,88 @@ version="2.0">
 		</table>	
 	</xsl:template>
 
-	<!-- Templates to match specific elements in the input xml -->
-	<xsl:template match="nodes">
-		<h3 class="title_style">Functions</h3>
+	<xsl:template match="properties">
+		<h3 class="title_style">Properties</h3>
 		<table>
 			<tbody>
-				<xsl:apply-templates select="node">
-					<xsl:sort select="shorttitle"/>
+				<xsl:apply-templates select="property">
+					<xsl:sort select="name"/>
 				</xsl:apply-templates>
 			</tbody>
 		</table>	
 	</xsl:template>
 
+	<xsl:template match="property">
+		<tr>
+			<td>
+				<div class="param_name title_style">
+					<xsl:apply-templates select="name" />
+				</div>
+				<div class="param_type">
+					<xsl:apply-templates select="type" />
+				</div>
+				<div class="param_type">
+					<xsl:apply-templates select="access" />
+				</div>
+			</td>
+			<td>
+				<xsl:apply-templates select="description" />	
+			</td>
+		</tr>
+	</xsl:template>
+
+	<xsl:template match="enumerators">
+		<h3 class="title_style">Values</h3>
+		<table>
+			<tbody>
+				<xsl:apply-templates select="enumerator" />
+			</tbody>
+		</table>	
+	</xsl:template>
+
+	<xsl:template match="enumerator">
+		<tr>
+			<td>
+				<div class="param_name title_style">
+					<xsl:apply-templates select="name" />
+				</div>
+				<div class="param_type">
+					<xsl:apply-templates select="value" />
+				</div>
+			</td>
+			<td>
+				<xsl:apply-templates select="description" />	
+			</td>
+		</tr>
+	</xsl:template>
+
+	<!-- Templates to match specific elements in the input xml -->
+	<xsl:template match="nodes">
+		<h3 class="title_style">Functions</h3>
+		<xsl:choose>
+			<!-- Big classes render their (already sorted) functions a page at a time from a separate script -->
+			<xsl:when test="../functions_script">
+				<div id="function_list">
+					<p class="navbar_style"><xsl:value-of select="count(node)" /> functions</p>
+				</div>
+				<script src="../css/functions.js" >//</script>
+				<script>
+					<xsl:attribute name="src"><xsl:value-of select="../functions_script" /></xsl:attribute>
+					//
+				</script>
+			</xsl:when>
+			<xsl:otherwise>
+				<table>
+					<tbody>
+						<xsl:apply-templates select="node">
+							<xsl:sort select="shorttitle"/>
+						</xsl:apply-templates>
+					</tbody>
+				</table>
+			</xsl:otherwise>
+		</xsl:choose>
+	</xsl:template>
+
 	<xsl:template match="node">
 		<tr>
 			<td>
@@ -19,6 +19,7 @@ version="2.0">
 					<xsl:apply-templates />
 				</div>
 				<script src="./css/collapsible.js" >//</script>
+				<script src="./css/timing.js" >//</script>
 			</body>
 		</html>
 	</xsl:template>
@@ -26,6 +27,11 @@ version="2.0">
 	<!-- Templates to match specific elements in the input xml -->
 	<xsl:template match="/root">
 		<h1 class="title_style"><xsl:value-of select="display_name" /> Documentation</h1><br></br>
+		<div class="search_container">
+			<input type="search" id="search_box" placeholder="Search classes, functions, categories and pins" autocomplete="off" />
+			<div id="search_results"></div>
+		</div>
+		<script src="./css/search.js" data-root="./" >//</script>
 		<button type="button" onclick="expandAll()">[Expand All]</button>
 		<button type="button" onclick="collapseAll()">[Collapse All]</button>
 		<xsl:for-each select="plugin">
@@ -45,34 +51,18 @@ version="2.0">
 		</xsl:apply-templates>
 	</xsl:template>
 	
+	<!-- Each module's classes, structs and enums are only loaded (from index/{module}.js) when it's expanded -->
 	<xsl:template match="module">
-		<b><xsl:value-of select="display_name" /></b>
-		<xsl:apply-templates select="classes" />
-		<br></br>
-	</xsl:template>
-
-	<xsl:template match="classes">
-		<table>
-			<tbody>
-				<xsl:apply-templates select="class">
-					<xsl:sort select="display_name"/>
-				</xsl:apply-templates>
-			</tbody>
-		</table>
-	</xsl:template>
-
-	<xsl:template match="class">
-		<tr>
-			<td>
-				<a>
-					<xsl:attribute name="href">./<xsl:value-of select="id" />/<xsl:value-of select="id" />.html</xsl:attribute>
-					<xsl:apply-templates select="display_name" />				
-				</a>
-			</td>
-			<td>
-				<xsl:apply-templates select="description" />	
-			</td>
-		</tr>
+		<button type="button" class="collapsible module_collapsible">
+			<xsl:attribute name="data-fragment"><xsl:value-of select="display_name" /></xsl:attribute>
+			<b><xsl:value-of select="display_name" /></b>
+			<span class="module_counts">
+				<xsl:if test="classes/class"><xsl:value-of select="count(classes/class)" /> classes </xsl:if>
+				<xsl:if test="structs/struct"><xsl:value-of select="count(structs/struct)" /> structs </xsl:if>
+				<xsl:if test="enums/enum"><xsl:value-of select="count(enums/enum)" /> enums</xsl:if>
+			</span>
+		</button>
+		<div class="collapsible_content"></div>
 	</xsl:template>
 
 </xsl:stylesheet>